@@ -0,0 +1,156 @@
+/*
+
+    MEA8000_Announce.cpp
+
+    Spoken messages from templates with slots, see MEA8000_Announce.h
+
+ */
+
+#include "MEA8000_Announce.h"
+
+
+const SoundSpan announceMonths [12] PROGMEM = {
+    SOUND(Sound_C3_JANVIER),    SOUND(Sound_C3_FEVRIER),    SOUND(Sound_C3_MARS),       SOUND(Sound_C3_AVRIL),
+    SOUND(Sound_C3_MAI),        SOUND(Sound_C3_JUIN),       SOUND(Sound_C3_JUILLET),    SOUND(Sound_C3_AOUT),
+    SOUND(Sound_C3_SEPTEMBRE),  SOUND(Sound_C3_OCTOBRE),    SOUND(Sound_C3_NOVEMBRE),   SOUND(Sound_C3_DECEMBRE) };
+
+
+const AnnounceItem announceTime [] PROGMEM = {
+    ANNOUNCE_NUMBER(0, ANNOUNCE_FEMININE),
+    ANNOUNCE_SOUND(Sound_C3_HEURE),
+    ANNOUNCE_NUMBER(1, ANNOUNCE_FEMININE | ANNOUNCE_OPTIONAL),
+    ANNOUNCE_SOUND(Sound_C3_MINUTE),
+    ANNOUNCE_END };
+
+const AnnounceItem announceDate [] PROGMEM = {
+    ANNOUNCE_SOUND(Sound_C2_LE),
+    ANNOUNCE_NUMBER(0, ANNOUNCE_FIRST),
+    ANNOUNCE_LIST(1, 0, 1, announceMonths),
+    ANNOUNCE_END };
+
+const AnnounceItem announceDistance [] PROGMEM = {
+    ANNOUNCE_NUMBER(0, ANNOUNCE_OPTIONAL),
+    ANNOUNCE_SOUND(Sound_C3_KILO),
+    ANNOUNCE_SOUND(Sound_C3_METRE),
+    ANNOUNCE_NUMBER(1, ANNOUNCE_OPTIONAL),
+    ANNOUNCE_SOUND(Sound_C3_METRE),
+    ANNOUNCE_END };
+
+const AnnounceItem announcePrice [] PROGMEM = {
+    ANNOUNCE_NUMBER(0, ANNOUNCE_OPTIONAL),
+    ANNOUNCE_SOUND(Sound_C2_FRANC),
+    ANNOUNCE_NUMBER(1, ANNOUNCE_OPTIONAL),
+    ANNOUNCE_SOUND(Sound_C3_CENTIME),
+    ANNOUNCE_END };
+
+
+// -- making a plan -----------------------------------------------------------------
+
+// A slot "{n...}", 'text' is just past the '{'. Returns false when it is not a valid slot.
+static bool announceSlot(const char **text, AnnounceItem *item) {
+    const char *c = *text;
+
+    if (*c < '0' || *c > '9') return false;
+    AnnounceItem slot = ANNOUNCE_NUMBER((byte)(*c++ - '0'), 0);
+
+    for (; *c != '}'; c++) {
+        switch (*c) {
+            case 'f':   slot.flags |= ANNOUNCE_FEMININE;   break;
+            case 'p':   slot.flags |= ANNOUNCE_FIRST;      break;
+            case '?':   slot.flags |= ANNOUNCE_OPTIONAL;   break;
+            case 'm': {
+                AnnounceItem month = ANNOUNCE_LIST(slot.slot, slot.flags, 1, announceMonths);
+                slot = month;
+                break;
+            }
+            default:    return false;       // also the end of the text
+        }
+    }
+    *item = slot;
+    *text = c + 1;
+    return true;
+}
+
+byte announceCompile(const char *text, AnnounceItem *plan, byte maxItems) {
+    byte count = 0;
+
+    for (;;) {
+        while (*text == ' ' || *text == ',' || *text == '.') text++;
+        if (count >= maxItems) return 0;
+        if (!*text) break;
+
+        if (*text == '{') {
+            text++;
+            if (!announceSlot(&text, &plan[count++])) return 0;
+            continue;
+        }
+
+        uint16_t    id;
+        byte        parts;
+        byte        size = frenchWordLookup(text, &id, &parts);
+        if (size == 0 || count + parts >= maxItems) return 0;
+
+        for (byte i = 0; i < parts; i++) {
+            AnnounceItem item = ANNOUNCE_END;
+            item.kind     = ANNOUNCE_ITEM_SOUND;
+            item.sound    = catalogSound(id + i);
+            plan[count++] = item;
+        }
+        text += size;
+    }
+
+    AnnounceItem end = ANNOUNCE_END;
+    plan[count++] = end;
+    return count;
+}
+
+
+// -- saying a message --------------------------------------------------------------
+
+static byte announceItems(const AnnounceItem *plan, bool flash, const uint32_t *values, SoundSpan *spans, byte maxSpans) {
+    byte    count    = 0;
+    bool    skipping = false;
+
+    for (;; plan++) {
+        AnnounceItem item;
+        if (flash) memcpy_P(&item, plan, sizeof(AnnounceItem));
+        else       item = *plan;
+
+        if (item.kind == ANNOUNCE_ITEM_END) break;
+
+        if (item.kind == ANNOUNCE_ITEM_SOUND) {
+            if (skipping) continue;
+            if (count + 1 > maxSpans) break;
+            spans[count++] = item.sound;
+            continue;
+        }
+
+        uint32_t value = item.slot < ANNOUNCE_MAX_SLOTS ? values[item.slot] : 0;
+        skipping = value == 0 && (item.flags & ANNOUNCE_OPTIONAL);
+        if (skipping) continue;
+
+        if (item.kind == ANNOUNCE_ITEM_LIST) {
+            if (value < item.first || value - item.first >= item.count) continue;
+            if (count + 1 > maxSpans) break;
+            spans[count++] = readSoundSpan(&item.list[value - item.first]);
+        } else if (value == 1 && (item.flags & ANNOUNCE_FIRST)) {
+            const SoundSpan premier = SOUND(Sound_C2_PREMIER);
+            if (count + 1 > maxSpans) break;
+            spans[count++] = premier;
+        } else {
+            SoundSpan   number [FRENCH_NUMBER_MAX_PARTS];
+            byte        parts = frenchNumber(value, number, item.flags & ANNOUNCE_FEMININE);
+            if (count + parts > maxSpans) break;
+            for (byte i = 0; i < parts; i++) spans[count++] = number[i];
+        }
+    }
+    return count;
+}
+
+byte announce(const AnnounceItem *plan, const uint32_t *values, SoundSpan *spans, byte maxSpans) {
+    return announceItems(plan, false, values, spans, maxSpans);
+}
+
+byte announce_P(const AnnounceItem *plan, const uint32_t *values, SoundSpan *spans, byte maxSpans) {
+    return announceItems(plan, true, values, spans, maxSpans);
+}
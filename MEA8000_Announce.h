@@ -0,0 +1,84 @@
+/*
+
+    MEA8000_Announce.h
+
+    Spoken messages from templates with slots: times, dates, distances, prices.
+
+    A template is made into a plan once: a row of items that are either a fixed sound
+    or a slot for a value (a French number, or one of a list like the months).
+    Saying a message is then going over the plan with the values, a few table lookups
+    per item, no text is read and nothing is allocated.
+
+    Plans can be written in Flash with the ANNOUNCE_... macros (the ones below are),
+    or made at run time from a text with announceCompile():
+
+        "{0f} heure {1f?} minute"       -> une heure vingt et une minute
+        "le {0p} {1m}"                  -> le premier janvier
+
+    A slot is {n} with n the index of its value (0 .. 9), followed by flags:
+        f   feminine number (une)
+        p   1 is said as PREMIER
+        ?   leave the slot out when its value is 0, with the fixed sounds after it
+            up to the next slot
+        m   the value is a month, 1 .. 12 (JANVIER .. DECEMBRE)
+    The words around the slots are looked up in catalog 2 and 3 (MEA8000_Words.h).
+
+ */
+
+#ifndef MEA8000_ANNOUNCE_H
+#define MEA8000_ANNOUNCE_H
+
+#include "MEA8000_Numbers.h"
+#include "MEA8000_Words.h"
+
+
+enum AnnounceKind : byte {
+    ANNOUNCE_ITEM_END = 0,
+    ANNOUNCE_ITEM_SOUND,
+    ANNOUNCE_ITEM_NUMBER,
+    ANNOUNCE_ITEM_LIST
+};
+
+#define ANNOUNCE_FEMININE       0x01
+#define ANNOUNCE_FIRST          0x02        // 1 is PREMIER
+#define ANNOUNCE_OPTIONAL       0x04
+
+#define ANNOUNCE_MAX_SLOTS      10
+
+
+struct AnnounceItem {
+    byte                kind;
+    byte                slot;       // index of the value (NUMBER, LIST)
+    byte                flags;
+    byte                first;      // LIST: the value of list[0]
+    byte                count;      // LIST: entries in list
+    SoundSpan           sound;      // SOUND
+    const SoundSpan     *list;      // LIST: in Flash
+};
+
+#define ANNOUNCE_SOUND(name)                { ANNOUNCE_ITEM_SOUND,  0,    0,     0,     0, SOUND(name), NULL }
+#define ANNOUNCE_NUMBER(slot, flags)        { ANNOUNCE_ITEM_NUMBER, slot, flags, 0,     0, { NULL, 0 }, NULL }
+#define ANNOUNCE_LIST(slot, flags, first, list) \
+    { ANNOUNCE_ITEM_LIST, slot, flags, first, sizeof(list) / sizeof(list[0]), { NULL, 0 }, list }
+#define ANNOUNCE_END                        { ANNOUNCE_ITEM_END,    0,    0,     0,     0, { NULL, 0 }, NULL }
+
+
+extern const SoundSpan      announceMonths [12] PROGMEM;
+
+// Plans in Flash
+extern const AnnounceItem   announceTime [] PROGMEM;        // {0f} HEURE {1f?} MINUTE
+extern const AnnounceItem   announceDate [] PROGMEM;        // LE {0p} {1m}
+extern const AnnounceItem   announceDistance [] PROGMEM;    // {0?} KILO METRE {1?} METRE
+extern const AnnounceItem   announcePrice [] PROGMEM;       // {0?} FRANC {1?} CENTIME
+
+// Make a plan (in RAM) from a template text, see above.
+// Returns the number of items written (the ANNOUNCE_ITEM_END included),
+// 0 for an error: a word that is not in the catalogs, a bad slot or no room.
+byte announceCompile(const char *text, AnnounceItem *plan, byte maxItems);
+
+// The sounds for a message, 'values' has the values of the slots.
+// Stops at the last item that fits in 'spans'. Returns the number of spans.
+byte announce(const AnnounceItem *plan, const uint32_t *values, SoundSpan *spans, byte maxSpans);      // plan in RAM
+byte announce_P(const AnnounceItem *plan, const uint32_t *values, SoundSpan *spans, byte maxSpans);    // plan in Flash
+
+#endif
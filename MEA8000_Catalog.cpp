@@ -0,0 +1,835 @@
+/*
+
+    MEA8000_Catalog.cpp
+
+    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.
+
+ */
+
+#include "MEA8000_Catalog.h"
+
+
+const SoundSpan soundCatalog [SOUND_COUNT] PROGMEM = {
+    // SOUND_GROUP_PHONEMES
+    SOUND(NoSound),
+    SOUND(Sound_a),
+    SOUND(Sound_e),
+    SOUND(Sound_i),
+    SOUND(Sound_oo),
+    SOUND(Sound_u),
+    SOUND(Sound_eh),
+    SOUND(Sound_ee),
+    SOUND(Sound_oh),
+    SOUND(Sound_w),
+    SOUND(Sound_A),
+    SOUND(Sound_I),
+    SOUND(Sound_O),
+    SOUND(Sound_W),
+    SOUND(Sound_b),
+    SOUND(Sound_d),
+    SOUND(Sound_f),
+    SOUND(Sound_g),
+    SOUND(Sound_j),
+    SOUND(Sound_k),
+    SOUND(Sound_l),
+    SOUND(Sound_m),
+    SOUND(Sound_n),
+    SOUND(Sound_p),
+    SOUND(Sound_R),
+    SOUND(Sound_r),
+    SOUND(Sound_s),
+    SOUND(Sound_t),
+    SOUND(Sound_v),
+    SOUND(Sound_z),
+    SOUND(Sound_ch),
+    SOUND(Sound_N),
+    SOUND(Sound_ai),
+    SOUND(Sound_ej),
+    SOUND(Sound_ui),
+    SOUND(Sound_ie),
+    SOUND(Sound_oi),
+    SOUND(Sound_o),
+
+    // SOUND_GROUP_NATO
+    SOUND(Sound_Alpha),
+    SOUND(Sound_Bravo),
+    SOUND(Sound_Charlie),
+    SOUND(Sound_Delta),
+    SOUND(Sound_Echo),
+    SOUND(Sound_Foxtrot),
+    SOUND(Sound_Golf),
+    SOUND(Sound_Hotel),
+    SOUND(Sound_India),
+    SOUND(Sound_Juliet),
+    SOUND(Sound_Kilo),
+    SOUND(Sound_Lima),
+    SOUND(Sound_Michael),
+    SOUND(Sound_November),
+    SOUND(Sound_Oscar),
+    SOUND(Sound_Papa),
+    SOUND(Sound_Quebec),
+    SOUND(Sound_Romeo),
+    SOUND(Sound_Sierra),
+    SOUND(Sound_Tango),
+    SOUND(Sound_Uniform),
+    SOUND(Sound_Victor),
+    SOUND(Sound_Whisky),
+    SOUND(Sound_X_ray),
+    SOUND(Sound_Yankee),
+    SOUND(Sound_Zulu),
+
+    // SOUND_GROUP_SELF
+    SOUND(Sound_hooo),
+    SOUND(Sound_ho),
+    SOUND(Sound_h),
+    SOUND(Sound_hu),
+    SOUND(Sound_he),
+    SOUND(Sound_ha),
+
+    // SOUND_GROUP_ENGLISH
+    SOUND(Sound_ZerOO),
+    SOUND(Sound_One),
+    SOUND(Sound_Two),
+    SOUND(Sound_Three),
+    SOUND(Sound_Four),
+    SOUND(Sound_Five),
+    SOUND(Sound_Six),
+    SOUND(Sound_Seven),
+    SOUND(Sound_Eight),
+    SOUND(Sound_Nine),
+    SOUND(Sound_Ten),
+    SOUND(Sound_Eleven),
+    SOUND(Sound_Twelve),
+    SOUND(Sound_Thir_),
+    SOUND(Sound_Four_),
+    SOUND(Sound_Fif_),
+    SOUND(Sound__teen),
+    SOUND(Sound_Twen_),
+    SOUND(Sound__ty),
+    SOUND(Sound_Hundred),
+    SOUND(Sound_Telephone),
+    SOUND(Sound_Number),
+    SOUND(Sound_Code),
+    SOUND(Sound_And),
+
+    // SOUND_GROUP_CATALOG2
+    SOUND(Sound_C2_A),
+    SOUND(Sound_C2_ACCOLADE),
+    SOUND(Sound_C2_AIMER),
+    SOUND(Sound_C2_ALLER),
+    SOUND(Sound_C2_ALORS),
+    SOUND(Sound_C2_AMI),
+    SOUND(Sound_C2_ANIMAL),
+    SOUND(Sound_C2_ANIMAUX),
+    SOUND(Sound_C2_ANNEE),
+    SOUND(Sound_C2_ANNIVERSAIRE),
+    SOUND(Sound_C2_ANTI),
+    SOUND(Sound_C2_APPRENDRE),
+    SOUND(Sound_C2_APPUI),
+    SOUND(Sound_C2_APRES),
+    SOUND(Sound_C2_ARRET),
+    SOUND(Sound_C2_ASSEZ),
+    SOUND(Sound_C2_ASSIETTE),
+    SOUND(Sound_C2_ASTERISQUE),
+    SOUND(Sound_C2_AU),
+    SOUND(Sound_C2_AUSSI),
+    SOUND(Sound_C2_AVANT),
+    SOUND(Sound_C2_AVOIR),
+    SOUND(Sound_C2_B),
+    SOUND(Sound_C2_BARRE),
+    SOUND(Sound_C2_BAS),
+    SOUND(Sound_C2_BIEN),
+    SOUND(Sound_C2_BLOCAGE),
+    SOUND(Sound_C2_BOIRE),
+    SOUND(Sound_C2_BON),
+    SOUND(Sound_C2_BONJOUR),
+    SOUND(Sound_C2_BONNE),
+    SOUND(Sound_C2_BRAVO),
+    SOUND(Sound_C2_C_EST),
+    SOUND(Sound_C2_C_ETAIT),
+    SOUND(Sound_C2_C),
+    SOUND(Sound_C2_CALCUL),
+    SOUND(Sound_C2_CE),
+    SOUND(Sound_C2_CECI),
+    SOUND(Sound_C2_CHIFFRE),
+    SOUND(Sound_C2_CHOISI),
+    SOUND(Sound_C2_CHOIX),
+    SOUND(Sound_C2_CLASSE),
+    SOUND(Sound_C2_CLAVIER),
+    SOUND(Sound_C2_CLEF),
+    SOUND(Sound_C2_COMBIEN),
+    SOUND(Sound_C2_COMME),
+    SOUND(Sound_C2_COMMERCIAL),
+    SOUND(Sound_C2_COMPRENDRE),
+    SOUND(Sound_C2_COMPTER),
+    SOUND(Sound_C2_CONNAITRE),
+    SOUND(Sound_C2_COPIE),
+    SOUND(Sound_C2_CORRESPONDANTE),
+    SOUND(Sound_C2_COTEE),
+    SOUND(Sound_C2_COULEUR),
+    SOUND(Sound_C2_CRAYON),
+    SOUND(Sound_C2_CROCHET),
+    SOUND(Sound_C2_CURSEUR),
+    SOUND(Sound_C2_D_),
+    SOUND(Sound_C2_D),
+    SOUND(Sound_C2_DANS),
+    SOUND(Sound_C2_DE),
+    SOUND(Sound_C2_DEBUT),
+    SOUND(Sound_C2_DEJA),
+    SOUND(Sound_C2_DELETE),
+    SOUND(Sound_C2_DEMANDER),
+    SOUND(Sound_C2_DEMI),
+    SOUND(Sound_C2_DES),
+    SOUND(Sound_C2_DESIRER),
+    SOUND(Sound_C2_DIEZE),
+    SOUND(Sound_C2_DIFFICILE),
+    SOUND(Sound_C2_DIRE),
+    SOUND(Sound_C2_DIRIGE),
+    SOUND(Sound_C2_DO),
+    SOUND(Sound_C2_DOLLARD),
+    SOUND(Sound_C2_DONC),
+    SOUND(Sound_C2_DONNE),
+    SOUND(Sound_C2_DROITE),
+    SOUND(Sound_C2_DU),
+    SOUND(Sound_C2_E),
+    SOUND(Sound_C2_ECOUTE),
+    SOUND(Sound_C2_ECOUTEUR),
+    SOUND(Sound_C2_ECRAN),
+    SOUND(Sound_C2_ECRIS),
+    SOUND(Sound_C2_EFFACE),
+    SOUND(Sound_C2_EGAL),
+    SOUND(Sound_C2_ELLE),
+    SOUND(Sound_C2_EN),
+    SOUND(Sound_C2_ENCORE),
+    SOUND(Sound_C2_ENFANT),
+    SOUND(Sound_C2_ENTER),
+    SOUND(Sound_C2_ESCAPE),
+    SOUND(Sound_C2_ESPACE),
+    SOUND(Sound_C2_ESSAY),
+    SOUND(Sound_C2_EST),
+    SOUND(Sound_C2_EST_CE),
+    SOUND(Sound_C2_ET),
+    SOUND(Sound_C2_ETRE),
+    SOUND(Sound_C2_EU),
+    SOUND(Sound_C2_EXACTE),
+    SOUND(Sound_C2_EXCLAMATION),
+    SOUND(Sound_C2_EXEMPLE),
+    SOUND(Sound_C2_EXERCICE),
+    SOUND(Sound_C2_F),
+    SOUND(Sound_C2_FACILE),
+    SOUND(Sound_C2_FAIRE),
+    SOUND(Sound_C2_FAIS),
+    SOUND(Sound_C2_FEMME),
+    SOUND(Sound_C2_FLECHE),
+    SOUND(Sound_C2_FOIS),
+    SOUND(Sound_C2_FONCTION),
+    SOUND(Sound_C2_FRANC),
+    SOUND(Sound_C2_G),
+    SOUND(Sound_C2_GAUCHE),
+    SOUND(Sound_C2_GRAND),
+    SOUND(Sound_C2_GUILLEMET),
+    SOUND(Sound_C2_H),
+    SOUND(Sound_C2_HA_NOM),
+    SOUND(Sound_C2_I),
+    SOUND(Sound_C2_IL),
+    SOUND(Sound_C2_INEXACTE),
+    SOUND(Sound_C2_INFERIEUR),
+    SOUND(Sound_C2_INTERROGATION),
+    SOUND(Sound_C2_J),
+    SOUND(Sound_C2_JAMAIS),
+    SOUND(Sound_C2_JE),
+    SOUND(Sound_C2_JOUR),
+    SOUND(Sound_C2_JOYSTICK),
+    SOUND(Sound_C2_JUSTE),
+    SOUND(Sound_C2_K),
+    SOUND(Sound_C2_L_),
+    SOUND(Sound_C2_L_ECRAN),
+    SOUND(Sound_C2_L),
+    SOUND(Sound_C2_LA_BAS),
+    SOUND(Sound_C2_LA),
+    SOUND(Sound_C2_LE),
+    SOUND(Sound_C2_LES),
+    SOUND(Sound_C2_LEUR),
+    SOUND(Sound_C2_LIVRE),
+    SOUND(Sound_C2_M),
+    SOUND(Sound_C2_MA),
+    SOUND(Sound_C2_MADAME),
+    SOUND(Sound_C2_MAINTENANT),
+    SOUND(Sound_C2_MAIS),
+    SOUND(Sound_C2_MAISON),
+    SOUND(Sound_C2_MAJUSCULE),
+    SOUND(Sound_C2_MANETTE),
+    SOUND(Sound_C2_MATIN),
+    SOUND(Sound_C2_ME),
+    SOUND(Sound_C2_MERCI),
+    SOUND(Sound_C2_MES),
+    SOUND(Sound_C2_MESDAMES),
+    SOUND(Sound_C2_MESSIEURS),
+    SOUND(Sound_C2_MET),
+    SOUND(Sound_C2_METTRE),
+    SOUND(Sound_C2_MI),
+    SOUND(Sound_C2_MIDI),
+    SOUND(Sound_C2_MIEN),
+    SOUND(Sound_C2_MIEUX),
+    SOUND(Sound_C2_MOI),
+    SOUND(Sound_C2_MOINS),
+    SOUND(Sound_C2_MON),
+    SOUND(Sound_C2_MONSIEUR),
+    SOUND(Sound_C2_MOYEN),
+    SOUND(Sound_C2_MOT),
+    SOUND(Sound_C2_N),
+    SOUND(Sound_C2_NE),
+    SOUND(Sound_C2_NOMBRE),
+    SOUND(Sound_C2_NOM),
+    SOUND(Sound_C2_NOS),
+    SOUND(Sound_C2_NOTE),
+    SOUND(Sound_C2_NOTRE),
+    SOUND(Sound_C2_NOUS),
+    SOUND(Sound_C2_NUMERO),
+    SOUND(Sound_C2_O),
+    SOUND(Sound_C2_ON),
+    SOUND(Sound_C2_OPTIQUE),
+    SOUND(Sound_C2_OR),
+    SOUND(Sound_C2_OU),
+    SOUND(Sound_C2_OUI),
+    SOUND(Sound_C2_P),
+    SOUND(Sound_C2_PARENTHESE),
+    SOUND(Sound_C2_PARFAIT),
+    SOUND(Sound_C2_PARLER),
+    SOUND(Sound_C2_PASSER),
+    SOUND(Sound_C2_PENSER),
+    SOUND(Sound_C2_PETIT),
+    SOUND(Sound_C2_PEUT_ETRE),
+    SOUND(Sound_C2_PLUS),
+    SOUND(Sound_C2_POIGNEE),
+    SOUND(Sound_C2_POINT),
+    SOUND(Sound_C2_POSITIONNE),
+    SOUND(Sound_C2_POUR),
+    SOUND(Sound_C2_POUR_CENT),
+    SOUND(Sound_C2_PREMIER),
+    SOUND(Sound_C2_PRENDRE),
+    SOUND(Sound_C2_PRENOM),
+    SOUND(Sound_C2_PROBLEME),
+    SOUND(Sound_C2_PUIS),
+    SOUND(Sound_C2_PUISSANCE),
+    SOUND(Sound_C2_Q),
+    SOUND(Sound_C2_QU_),
+    SOUND(Sound_C2_QU_EST_CE),
+    SOUND(Sound_C2_QUAND),
+    SOUND(Sound_C2_QUE),
+    SOUND(Sound_C2_QUEL),
+    SOUND(Sound_C2_QUELQUE),
+    SOUND(Sound_C2_QUESTION),
+    SOUND(Sound_C2_QUI),
+    SOUND(Sound_C2_QU_IL),
+    SOUND(Sound_C2_QUOI),
+    SOUND(Sound_C2_R),
+    SOUND(Sound_C2_RE),
+    SOUND(Sound_C2_RECOMMENCE),
+    SOUND(Sound_C2_REGARDE),
+    SOUND(Sound_C2_REPONSE),
+    SOUND(Sound_C2_RESULTAT),
+    SOUND(Sound_C2_RIEN),
+    SOUND(Sound_C2_S),
+    SOUND(Sound_C2_SA),
+    SOUND(Sound_C2_SANS),
+    SOUND(Sound_C2_SAVOIR),
+    SOUND(Sound_C2_SCORE),
+    SOUND(Sound_C2_SE),
+    SOUND(Sound_C2_SELECTIONNEE),
+    SOUND(Sound_C2_SES),
+    SOUND(Sound_C2_SI),
+    SOUND(Sound_C2_SI_NOTE_),
+    SOUND(Sound_C2_SIEN),
+    SOUND(Sound_C2_SIMPLE),
+    SOUND(Sound_C2_SLASH),
+    SOUND(Sound_C2_SOIR),
+    SOUND(Sound_C2_SOL),
+    SOUND(Sound_C2_SOLUTION),
+    SOUND(Sound_C2_SON),
+    SOUND(Sound_C2_SUITE),
+    SOUND(Sound_C2_SUPERIEUR),
+    SOUND(Sound_C2_SUR),
+    SOUND(Sound_C2_T),
+    SOUND(Sound_C2_TA),
+    SOUND(Sound_C2_TE),
+    SOUND(Sound_C2_TEMPS),
+    SOUND(Sound_C2_TES),
+    SOUND(Sound_C2_TIEN),
+    SOUND(Sound_C2_TIRET),
+    SOUND(Sound_C2_TOI),
+    SOUND(Sound_C2_TON),
+    SOUND(Sound_C2_TOUJOURS),
+    SOUND(Sound_C2_TOUT),
+    SOUND(Sound_C2_TRES),
+    SOUND(Sound_C2_TROUVER),
+    SOUND(Sound_C2_TU),
+    SOUND(Sound_C2_T_UN),
+    SOUND(Sound_C2_T_UNE),
+    SOUND(Sound_C2_U),
+    SOUND(Sound_C2_UN),
+    SOUND(Sound_C2_UNE),
+    SOUND(Sound_C2_V),
+    SOUND(Sound_C2_VALIDATION),
+    SOUND(Sound_C2_VENIR),
+    SOUND(Sound_C2_VENT),
+    SOUND(Sound_C2_VIRGULE),
+    SOUND(Sound_C2_VOICI),
+    SOUND(Sound_C2_VOILA),
+    SOUND(Sound_C2_VOIR),
+    SOUND(Sound_C2_VOS),
+    SOUND(Sound_C2_VOTRE),
+    SOUND(Sound_C2_VOUS),
+    SOUND(Sound_C2_VRAIMENT),
+    SOUND(Sound_C2_W),
+    SOUND(Sound_C2_X),
+    SOUND(Sound_C2_Y),
+    SOUND(Sound_C2_Z),
+    SOUND(Sound_C2_ZERO_NR),
+    SOUND(Sound_C2_UN_NR),
+    SOUND(Sound_C2_DEUX_NR),
+    SOUND(Sound_C2_TROIS_NR),
+    SOUND(Sound_C2_QUATRE_NR),
+    SOUND(Sound_C2_CINQ_NR),
+    SOUND(Sound_C2_CIN_CENT_NR),
+    SOUND(Sound_C2_SIX_NR),
+    SOUND(Sound_C2_SI_CENT_NR),
+    SOUND(Sound_C2_SEPT_NR),
+    SOUND(Sound_C2_HUIT_NR),
+    SOUND(Sound_C2_HUI_CENT_NR),
+    SOUND(Sound_C2_NEUF_NR),
+    SOUND(Sound_C2_DIX_NR),
+    SOUND(Sound_C2_DI_MILLE_NR),
+    SOUND(Sound_C2_ONZE_NR_ugly),
+    SOUND(Sound_C2_ONZE_NR),
+    SOUND(Sound_C2_DOUZE_NR),
+    SOUND(Sound_C2_TREIZE_NR),
+    SOUND(Sound_C2_QUATORZE_NR),
+    SOUND(Sound_C2_QUINZE_NR),
+    SOUND(Sound_C2_SEIZE_NR),
+    SOUND(Sound_C2_DIX_SEPT_NR),
+    SOUND(Sound_C2_DIX_HUIT),
+    SOUND(Sound_C2_DIX_HUI_MILLE_NR),
+    SOUND(Sound_C2_DIX_NEUF_NR),
+    SOUND(Sound_C2_VINGT_NR),
+    SOUND(Sound_C2_VIN_MILLE_NR),
+    SOUND(Sound_C2_TRENTE_NR),
+    SOUND(Sound_C2_QUARANTE_NR),
+    SOUND(Sound_C2_CINQUANTE_NR),
+    SOUND(Sound_C2_SOIXANTE_NR),
+    SOUND(Sound_C2_QUATRE_VINGT_NR),
+    SOUND(Sound_C2_CENT_NR),
+    SOUND(Sound_C2_MILLE_NR),
+    SOUND(Sound_C2_MILLION_NR),
+    SOUND(Sound_C2_ET_UN_NR),
+    SOUND(Sound_C2_ET_NR),
+
+    // SOUND_GROUP_CATALOG3
+    SOUND(Sound_C3_ADDITIONNE),
+    SOUND(Sound_C3_AFFICHE),
+    SOUND(Sound_C3_AJOUTE),
+    SOUND(Sound_C3_ALPHABET),
+    SOUND(Sound_C3_ANALYSE),
+    SOUND(Sound_C3_ATTENTION),
+    SOUND(Sound_C3_BEBE),
+    SOUND(Sound_C3_BONHOMME),
+    SOUND(Sound_C3_CORRECTION),
+    SOUND(Sound_C3_COUSIN),
+    SOUND(Sound_C3_DIMINUE),
+    SOUND(Sound_C3_ENFANT),
+    SOUND(Sound_C3_EVITE),
+    SOUND(Sound_C3_FAMILLE),
+    SOUND(Sound_C3_FREINE),
+    SOUND(Sound_C3_LENTEMENT),
+    SOUND(Sound_C3_LIGNE),
+    SOUND(Sound_C3_LIT),
+    SOUND(Sound_C3_MAMAN),
+    SOUND(Sound_C3_MERE),
+    SOUND(Sound_C3_MULTIPILIE),
+    SOUND(Sound_C3_OBSTACLE),
+    SOUND(Sound_C3_ONCLE),
+    SOUND(Sound_C3_ORTHOGRAPHE),
+    SOUND(Sound_C3_PAPA),
+    SOUND(Sound_C3_PARENT),
+    SOUND(Sound_C3_PERE),
+    SOUND(Sound_C3_PLACE),
+    SOUND(Sound_C3_RECOMMENCE),
+    SOUND(Sound_C3_RECULE),
+    SOUND(Sound_C3_SOEUR),
+    SOUND(Sound_C3_SOUSTRAIT),
+    SOUND(Sound_C3_SYNTHESE),
+    SOUND(Sound_C3_TANTE),
+    SOUND(Sound_C3_AUTO),
+    SOUND(Sound_C3_AUTOBUS),
+    SOUND(Sound_C3_AVION),
+    SOUND(Sound_C3_BAS),
+    SOUND(Sound_C3_BATEAU),
+    SOUND(Sound_C3_CAMPINGCAR),
+    SOUND(Sound_C3_CAR),
+    SOUND(Sound_C3_CARRE),
+    SOUND(Sound_C3_CENTIME),
+    SOUND(Sound_C3_CERCLE),
+    SOUND(Sound_C3_ELECTRICITE),
+    SOUND(Sound_C3_FENETRE),
+    SOUND(Sound_C3_FRANC),
+    SOUND(Sound_C3_GARE),
+    SOUND(Sound_C3_HAUT),
+    SOUND(Sound_C3_HELICOPTERE),
+    SOUND(Sound_C3_HEURE),
+    SOUND(Sound_C3_KILO),
+    SOUND(Sound_C3_L_),
+    SOUND(Sound_C3_LA),
+    SOUND(Sound_C3_LE),
+    SOUND(Sound_C3_LES),
+    SOUND(Sound_C3_LUMIERE),
+    SOUND(Sound_C3_METRE),
+    SOUND(Sound_C3_METRO),
+    SOUND(Sound_C3_MINUTE),
+    SOUND(Sound_C3_MUR),
+    SOUND(Sound_C3_PIECE),
+    SOUND(Sound_C3_PLANCHER),
+    SOUND(Sound_C3_PORTE),
+    SOUND(Sound_C3_RECTANGLE),
+    SOUND(Sound_C3_TABLE),
+    SOUND(Sound_C3_TAXI),
+    SOUND(Sound_C3_TELEPHONE),
+    SOUND(Sound_C3_TELEVISION),
+    SOUND(Sound_C3_TONNE),
+    SOUND(Sound_C3_TRAIN),
+    SOUND(Sound_C3_TRIANGLE),
+    SOUND(Sound_C3_UN),
+    SOUND(Sound_C3_UNE),
+    SOUND(Sound_C3_UNE_),
+    SOUND(Sound_C3_VETEMENT),
+    SOUND(Sound_C3_VOITURE),
+    SOUND(Sound_C3_ANE),
+    SOUND(Sound_C3_BANQUE),
+    SOUND(Sound_C3_BOITE_DE_NUIT),
+    SOUND(Sound_C3_BOUCHE),
+    SOUND(Sound_C3_BRAS),
+    SOUND(Sound_C3_BUREAU_DE_POSTE),
+    SOUND(Sound_C3_CANARD),
+    SOUND(Sound_C3_CENTRE_COMMERCIAL),
+    SOUND(Sound_C3_CHAT),
+    SOUND(Sound_C3_CHEVAL),
+    SOUND(Sound_C3_CHEVEUX),
+    SOUND(Sound_C3_CHIEN),
+    SOUND(Sound_C3_DENTISTE),
+    SOUND(Sound_C3_DOIGT),
+    SOUND(Sound_C3_GRENOUILLE),
+    SOUND(Sound_C3_HOPITAL),
+    SOUND(Sound_C3_JAMBE),
+    SOUND(Sound_C3_MAIN),
+    SOUND(Sound_C3_MEDECIN),
+    SOUND(Sound_C3_NEZ),
+    SOUND(Sound_C3_OPTICIEN),
+    SOUND(Sound_C3_OREILLE),
+    SOUND(Sound_C3_PAPETERIE),
+    SOUND(Sound_C3_PHARMACIE),
+    SOUND(Sound_C3_PIED),
+    SOUND(Sound_C3_POULE),
+    SOUND(Sound_C3_SALON_DE_COIFFURE),
+    SOUND(Sound_C3_STATION_SERVICE),
+    SOUND(Sound_C3_TABAC),
+    SOUND(Sound_C3_TETE),
+    SOUND(Sound_C3_VACHE),
+    SOUND(Sound_C3_VITRINE),
+    SOUND(Sound_C3_ARMOIRE),
+    SOUND(Sound_C3_BAIGNOIRE),
+    SOUND(Sound_C3_BALAIS),
+    SOUND(Sound_C3_BIBERON),
+    SOUND(Sound_C3_BOUCHON),
+    SOUND(Sound_C3_BOUTEILLE),
+    SOUND(Sound_C3_CARAFE),
+    SOUND(Sound_C3_CASSEROLE),
+    SOUND(Sound_C3_CHAISE),
+    SOUND(Sound_C3_CHAMBRE),
+    SOUND(Sound_C3_CLEF),
+    SOUND(Sound_C3_COMPTEUR),
+    SOUND(Sound_C3_CUISINE),
+    SOUND(Sound_C3_CUISINIERE),
+    SOUND(Sound_C3_ECLAIRAGE),
+    SOUND(Sound_C3_EPONGE),
+    SOUND(Sound_C3_EVIER),
+    SOUND(Sound_C3_FAUTEUIL),
+    SOUND(Sound_C3_GARAGE),
+    SOUND(Sound_C3_INTERRUPTEUR),
+    SOUND(Sound_C3_LAMPE),
+    SOUND(Sound_C3_LAVABO),
+    SOUND(Sound_C3_LAVE_VAISSEILE),
+    SOUND(Sound_C3_LINGE),
+    SOUND(Sound_C3_MACHINE_A_LAVER_LE_LINGE_A),
+    SOUND(Sound_C3_MACHINE_A_LAVER_LE_LINGE_B),
+    SOUND(Sound_C3_MAISON),
+    SOUND(Sound_C3_NAPPE),
+    SOUND(Sound_C3_OUVRE_BOITE),
+    SOUND(Sound_C3_PELLE),
+    SOUND(Sound_C3_PLACARD),
+    SOUND(Sound_C3_PLAFOND),
+    SOUND(Sound_C3_PLAT),
+    SOUND(Sound_C3_POELE),
+    SOUND(Sound_C3_POUBELLE),
+    SOUND(Sound_C3_RADIATEUR),
+    SOUND(Sound_C3_REFRIGERATEUR),
+    SOUND(Sound_C3_RIDEAU),
+    SOUND(Sound_C3_ROBINET),
+    SOUND(Sound_C3_SALADIER),
+    SOUND(Sound_C3_SALLE_A_MANGER),
+    SOUND(Sound_C3_SALLE_DE_BAIN),
+    SOUND(Sound_C3_SALON),
+    SOUND(Sound_C3_SERPILLIERE),
+    SOUND(Sound_C3_SERVIETTE),
+    SOUND(Sound_C3_SOL),
+    SOUND(Sound_C3_TAPIS),
+    SOUND(Sound_C3_TIRE_BOUCHON),
+    SOUND(Sound_C3_TOILETTE),
+    SOUND(Sound_C3_TOIT),
+    SOUND(Sound_C3_VAISSELLE),
+    SOUND(Sound_C3_VOLET),
+    SOUND(Sound_C3_AVEC),
+    SOUND(Sound_C3_CEINTURE),
+    SOUND(Sound_C3_CHAPEAU),
+    SOUND(Sound_C3_CHAUSSETTE),
+    SOUND(Sound_C3_CHAUSSURE),
+    SOUND(Sound_C3_CHEMISE),
+    SOUND(Sound_C3_CHEMISE_DE_NUIT),
+    SOUND(Sound_C3_CUBE),
+    SOUND(Sound_C3_CUILLERE),
+    SOUND(Sound_C3_CUILLERE_A_DESSERT),
+    SOUND(Sound_C3_CUILLERE_A_SOUPE),
+    SOUND(Sound_C3_DERRIERE),
+    SOUND(Sound_C3_DEVANT),
+    SOUND(Sound_C3_DISTANCE),
+    SOUND(Sound_C3_GANT),
+    SOUND(Sound_C3_GILET),
+    SOUND(Sound_C3_GRANDEUR),
+    SOUND(Sound_C3_HAUTEUR),
+    SOUND(Sound_C3_IMPERMEABLE),
+    SOUND(Sound_C3_JUPE),
+    SOUND(Sound_C3_LARGEUR),
+    SOUND(Sound_C3_LOIN_DE),
+    SOUND(Sound_C3_LONGUEUR),
+    SOUND(Sound_C3_MANTEAU),
+    SOUND(Sound_C3_PAIRE_DE_LUNETTE),
+    SOUND(Sound_C3_PANTALON),
+    SOUND(Sound_C3_PARAPLUIE),
+    SOUND(Sound_C3_PIJAMA),
+    SOUND(Sound_C3_POIDS),
+    SOUND(Sound_C3_PRES_DE),
+    SOUND(Sound_C3_PROFONDEUR),
+    SOUND(Sound_C3_PULLOVER),
+    SOUND(Sound_C3_ROBE_DE_CHAMBRE),
+    SOUND(Sound_C3_SHORT),
+    SOUND(Sound_C3_SOUS_VETEMENT),
+    SOUND(Sound_C3_SURFACE),
+    SOUND(Sound_C3_TABLIER),
+    SOUND(Sound_C3_VERRE),
+    SOUND(Sound_C3_VESTE),
+    SOUND(Sound_C3_VOLUME),
+    SOUND(Sound_C3_ABRICOT),
+    SOUND(Sound_C3_AUTOROUTE),
+    SOUND(Sound_C3_BANANE),
+    SOUND(Sound_C3_BEEFSTEAK),
+    SOUND(Sound_C3_BIERE),
+    SOUND(Sound_C3_BLANC),
+    SOUND(Sound_C3_BLEU),
+    SOUND(Sound_C3_BOEUF),
+    SOUND(Sound_C3_CAFE),
+    SOUND(Sound_C3_CAMPAGNE),
+    SOUND(Sound_C3_CHOCOLAT),
+    SOUND(Sound_C3_CITRON),
+    SOUND(Sound_C3_CLEMENTINE),
+    SOUND(Sound_C3_CORNICHON),
+    SOUND(Sound_C3_ESCARGOT),
+    SOUND(Sound_C3_FLEUVE),
+    SOUND(Sound_C3_FRAISE),
+    SOUND(Sound_C3_FROMAGE),
+    SOUND(Sound_C3_GATEAU),
+    SOUND(Sound_C3_HUITRE),
+    SOUND(Sound_C3_JAMBON),
+    SOUND(Sound_C3_LAIT),
+    SOUND(Sound_C3_MARRON),
+    SOUND(Sound_C3_MER),
+    SOUND(Sound_C3_MONTAGNE),
+    SOUND(Sound_C3_MOULE),
+    SOUND(Sound_C3_MOUTARDE),
+    SOUND(Sound_C3_MOUTON),
+    SOUND(Sound_C3_NOIR),
+    SOUND(Sound_C3_OEUF),
+    SOUND(Sound_C3_OLIVE),
+    SOUND(Sound_C3_ORANGE),
+    SOUND(Sound_C3_PAIN),
+    SOUND(Sound_C3_PAMPLEMOUSSE),
+    SOUND(Sound_C3_PATE),
+    SOUND(Sound_C3_PECHE),
+    SOUND(Sound_C3_PLAGE),
+    SOUND(Sound_C3_POIRE),
+    SOUND(Sound_C3_POMME),
+    SOUND(Sound_C3_PORC),
+    SOUND(Sound_C3_POULET),
+    SOUND(Sound_C3_PRUNE),
+    SOUND(Sound_C3_RAISIN),
+    SOUND(Sound_C3_RIVIERE),
+    SOUND(Sound_C3_RIZ),
+    SOUND(Sound_C3_ROSEE),
+    SOUND(Sound_C3_ROUTE),
+    SOUND(Sound_C3_SAUCE),
+    SOUND(Sound_C3_SUCRE),
+    SOUND(Sound_C3_THE),
+    SOUND(Sound_C3_TOMATE),
+    SOUND(Sound_C3_VEAU),
+    SOUND(Sound_C3_VERT),
+    SOUND(Sound_C3_VILLAGE),
+    SOUND(Sound_C3_VILLE),
+    SOUND(Sound_C3_VINAIGRE),
+    SOUND(Sound_C3_VIOLET),
+    SOUND(Sound_C3_VIRAGE),
+    SOUND(Sound_C3_YAOURT),
+    SOUND(Sound_C3_ADDITION),
+    SOUND(Sound_C3_ALPHABETIQUE),
+    SOUND(Sound_C3_ALPHANUMERIQUE),
+    SOUND(Sound_C3_AOUT),
+    SOUND(Sound_C3_APPREND),
+    SOUND(Sound_C3_AUGMENTE),
+    SOUND(Sound_C3_AVRIL),
+    SOUND(Sound_C3_CASSETTE),
+    SOUND(Sound_C3_COULEUR),
+    SOUND(Sound_C3_DECEMBRE),
+    SOUND(Sound_C3_DEPLACE),
+    SOUND(Sound_C3_DISQUETTE),
+    SOUND(Sound_C3_DIVISION),
+    SOUND(Sound_C3_EXPLICATION),
+    SOUND(Sound_C3_FEVRIER),
+    SOUND(Sound_C3_FICHE),
+    SOUND(Sound_C3_INDEX),
+    SOUND(Sound_C3_JANVIER),
+    SOUND(Sound_C3_JUILLET),
+    SOUND(Sound_C3_JUIN),
+    SOUND(Sound_C3_LECTEUR),
+    SOUND(Sound_C3_MAGNETOPHONE),
+    SOUND(Sound_C3_MAI),
+    SOUND(Sound_C3_MARS),
+    SOUND(Sound_C3_MOIS),
+    SOUND(Sound_C3_MONITEUR),
+    SOUND(Sound_C3_MONOCHROME),
+    SOUND(Sound_C3_MULTIPLICATION),
+    SOUND(Sound_C3_NOVEMBRE),
+    SOUND(Sound_C3_NUMERIQUE),
+    SOUND(Sound_C3_OCTOBRE),
+    SOUND(Sound_C3_REGARDE),
+    SOUND(Sound_C3_REGLE),
+    SOUND(Sound_C3_RETENUE),
+    SOUND(Sound_C3_RETIENT),
+    SOUND(Sound_C3_SEMAINE),
+    SOUND(Sound_C3_SEPTEMBRE),
+    SOUND(Sound_C3_SON),
+    SOUND(Sound_C3_SUIS),
+    SOUND(Sound_C3_TRAVAIL),
+    SOUND(Sound_C3_VOLUME_2),
+
+    // SOUND_GROUP_EXTRA
+    SOUND(Sound_OMELETTE),
+
+    // SOUND_GROUP_INTRO
+    SOUND(Sound_INTRO_MEA8000_P1),
+    SOUND(Sound_INTRO_MEA8000_P2),
+    SOUND(Sound_INTRO_MEA8000_P3),
+};
+
+const SoundTrim soundTrim [SOUND_COUNT] PROGMEM = {
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 1, 0 }, { 1, 0 },
+    { 0, 0 }, { 1, 0 }, { 0, 0 }, { 1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 2, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 5, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 4 }, { 1, 0 }, { 1, 0 }, { 1, 0 }, { 0, 0 }, { 1, 1 }, { 1, 1 }, { 1, 0 },
+    { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 0 }, { 1, 0 }, { 1, 0 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 0 }, { 1, 0 }, { 1, 0 }, { 1, 1 }, { 1, 0 },
+    { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 2 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 2, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 3 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 },
+    { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 },
+    { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 2 }, { 1, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 2 }, { 1, 1 },
+    { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 2 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 0, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 0 }, { 1, 1 },
+    { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 2 }, { 1, 1 }, { 1, 1 }, { 1, 2 },
+    { 1, 1 }, { 1, 0 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+    { 1, 1 }, { 1, 1 }, { 0, 0 }, { 0, 2 }, { 1, 1 },
+};
+
+const uint16_t soundGroupFirst [SOUND_GROUPS + 1] PROGMEM = {
+    0, 38, 64, 70, 94, 404, 705, 706, 709,
+};
+
+static_assert(SOUND_COUNT == 709, "SOUND_COUNT in MEA8000_Catalog.h is out of date");
@@ -0,0 +1,116 @@
+/*
+
+    MEA8000_Catalog.h
+
+    All sounds of MEA8000_Sounds.h in one table in Flash, so a sound can be given by
+    a number (its id) instead of a pointer: the words of the word trie, lists of sounds
+    in a file or on a serial line, the host tools that go over every sound.
+
+    The ids follow the order of MEA8000_Sounds.h, by group. MEA8000_Catalog.cpp is made by
+    tools/MEA8000_MakeCatalog.cpp, run it again after adding or removing sounds.
+
+ */
+
+#ifndef MEA8000_CATALOG_H
+#define MEA8000_CATALOG_H
+
+#include "MEA8000_Sounds.h"
+#include "MEA8000_Tables.h"
+
+
+enum SoundGroup : byte {
+    SOUND_GROUP_PHONEMES = 0,       // NoSound .. Sound_o
+    SOUND_GROUP_NATO,               // Sound_Alpha .. Sound_Zulu
+    SOUND_GROUP_SELF,               // Sound_hooo .. Sound_ha
+    SOUND_GROUP_ENGLISH,            // Sound_ZerOO .. Sound_And
+    SOUND_GROUP_CATALOG2,           // Sound_C2_...
+    SOUND_GROUP_CATALOG3,           // Sound_C3_...
+    SOUND_GROUP_EXTRA,              // Sound_OMELETTE
+    SOUND_GROUP_INTRO,              // Sound_INTRO_MEA8000_P1 .. P3
+    SOUND_GROUPS
+};
+
+#define SOUND_COUNT     709
+#define SOUND_NONE      0xFFFF
+
+
+// The silent frames (AMPL 0) at the start and at the end of a sound, counted by
+// tools/MEA8000_MakeCatalog.cpp. Both are 0 for a sound that is all silence.
+struct SoundTrim {
+    byte    lead;
+    byte    tail;
+};
+
+
+extern const SoundSpan  soundCatalog [SOUND_COUNT] PROGMEM;
+extern const uint16_t   soundGroupFirst [SOUND_GROUPS + 1] PROGMEM;     // first id of each group, SOUND_COUNT at the end
+extern const SoundTrim  soundTrim [SOUND_COUNT] PROGMEM;
+
+inline SoundSpan catalogSound(uint16_t id)      { return readSoundSpan(&soundCatalog[id]); }
+inline uint16_t  soundGroupBegin(byte group)    { return pgm_read_word(&soundGroupFirst[group]); }
+inline uint16_t  soundGroupEnd(byte group)      { return pgm_read_word(&soundGroupFirst[group + 1]); }
+
+// The id of the sound that 'data' points into (its start, a frame of it), SOUND_NONE if it
+// is not in the catalog. A search over all sounds, to be done once per sound, not per frame.
+inline uint16_t catalogFind(const byte *data) {
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        const byte *start = (const byte *)pgm_read_ptr(&soundCatalog[id].data);
+        if (data >= start && data < start + pgm_read_word(&soundCatalog[id].length)) return id;
+    }
+    return SOUND_NONE;
+}
+
+// The sound without its silent lead-in and lead-out, so the first frame played is heard
+// (most sounds start with one or more silent frames). A header goes with the lead-in:
+// give the player soundPitch(id) as the start pitch of a list that begins with it.
+// 'lead' / 'tail' false keeps that end, for the parts (_A, _B) of one word.
+inline SoundSpan trimmedSound(uint16_t id, bool lead = true, bool tail = true) {
+    SoundSpan   span   = catalogSound(id);
+    byte        first  = lead ? pgm_read_byte(&soundTrim[id].lead) : 0;
+    byte        last   = tail ? pgm_read_byte(&soundTrim[id].tail) : 0;
+    byte        header = soundHeaderSize(span.data, span.length);
+    uint16_t    end    = header + ((span.length - header) / MEA8000_FRAME_SIZE - last) * MEA8000_FRAME_SIZE;
+    uint16_t    begin  = first ? header + first * MEA8000_FRAME_SIZE : 0;
+
+    span.data  += begin;
+    span.length = end - begin;
+    return span;
+}
+
+// The pitch (Hz / 2) at byte 'offset' of a sound: the start pitch of its header, moved on by
+// the PI of the frames in front, as the chip does (in silent frames too). Rounded to the
+// byte the chip takes (1 .. 255, 0 would mean 'from the header' to the players), so it may
+// be 1 Hz off.
+inline byte soundPitchAt(const byte *data, uint16_t length, uint16_t offset) {
+    byte header = soundHeaderSize(data, length);
+    int  hz     = 2 * soundStartPitch(data, length);
+
+    for (uint16_t at = header; header && at + MEA8000_FRAME_SIZE <= offset; at += MEA8000_FRAME_SIZE) {
+        byte frame [MEA8000_FRAME_SIZE];
+        memcpy_P(frame, data + at, MEA8000_FRAME_SIZE);
+        hz += pitchIncrement(framePI(frame)) * frameSteps(frame);
+    }
+    hz = (hz + 1) / 2;
+    return hz < 1 ? 1 : hz > 255 ? 255 : (byte)hz;
+}
+
+// The start pitch for trimmedSound(id, lead): the pitch after the lead-in that is left out
+inline byte soundPitch(uint16_t id, bool lead = true) {
+    SoundSpan   span  = catalogSound(id);
+    byte        first = lead ? pgm_read_byte(&soundTrim[id].lead) : 0;
+    return soundPitchAt(span.data, span.length, soundHeaderSize(span.data, span.length) + first * MEA8000_FRAME_SIZE);
+}
+
+// The start pitch for a list that begins with 'span': its header, or for a part of a sound
+// of the catalog (trimmedSound) the pitch there. A search over the catalog, once per list.
+inline byte spanPitch(const SoundSpan &span) {
+    if (soundHeaderSize(span.data, span.length)) return soundPitchAt(span.data, span.length, 0);
+
+    uint16_t id = catalogFind(span.data);
+    if (id == SOUND_NONE) return MEA8000_DEFAULT_PITCH;
+
+    SoundSpan whole = catalogSound(id);
+    return soundPitchAt(whole.data, whole.length, span.data - whole.data);
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+
+    MEA8000_Driver.cpp
+
+    Feeding the MEA8000 from its REQ interrupt, see MEA8000_Driver.h
+
+ */
+
+#include "MEA8000_Driver.h"
+
+
+#ifdef DRIVER_COUNT_CYCLES
+uint32_t driverCycles = 0;
+#endif
+
+
+MEA8000Driver::MEA8000Driver() {
+    begin(NULL);
+}
+
+void MEA8000Driver::begin(MEA8000Bus *bus) {
+    this->bus = bus;
+    head      = tail = 0;
+    state     = DRIVER_IDLE;
+    waiting   = false;
+    late      = 0;
+    prefetch.begin(NULL);
+}
+
+bool MEA8000Driver::queue(const SoundSpan *spans, byte count, byte pitch) {
+    byte next = (tail + 1) % DRIVER_QUEUE;
+    if (next == head || count == 0) return false;
+
+    phrases[tail].spans = spans;
+    phrases[tail].count = count;
+    phrases[tail].pitch = pitch;
+    tail = next;
+    return true;
+}
+
+// Answers a request: the next frame, or the stop at the end. False when there is nothing yet.
+bool MEA8000Driver::answer() {
+    byte frame [MEA8000_FRAME_SIZE];
+
+    if (prefetch.nextFrame(frame)) {
+        DRIVER_COST(4 * 6);
+        for (byte i = 0; i < MEA8000_FRAME_SIZE; i++) bus->write(frame[i]);
+        return true;
+    }
+    if (!prefetch.isDone()) return false;
+
+    state = DRIVER_STOPPING;
+    bus->stop();
+    return true;
+}
+
+
+void MEA8000Driver::service() {
+    DRIVER_COST(12);
+    if (state == DRIVER_SPEAKING) {
+        prefetch.fill();
+        if (!waiting) return;
+
+        // The request came before the frames, answer it now
+        noInterrupts();
+        if (waiting && answer()) waiting = false;
+        interrupts();
+        return;
+    }
+    if (state != DRIVER_IDLE || !bus || head == tail) return;
+
+    const Phrase &phrase = phrases[head];
+    byte          pitch  = phrase.pitch ? phrase.pitch : soundStartPitch(phrase.spans[0].data, phrase.spans[0].length);
+
+    DRIVER_COST(60);
+    stream.begin(phrase.spans, phrase.count);
+    prefetch.begin(&stream);
+    prefetch.fill();
+    prefetch.fill();
+    head    = (head + 1) % DRIVER_QUEUE;
+    waiting = false;
+
+    state = DRIVER_SPEAKING;        // before the pitch: the chip asks for the first frame right away
+    bus->write(pitch);
+}
+
+void MEA8000Driver::onRequest() {
+    DRIVER_COST(30);                // getting in and out of the interrupt
+    if (state == DRIVER_STOPPING) {
+        state = DRIVER_IDLE;
+        return;
+    }
+    if (state != DRIVER_SPEAKING) return;
+
+    if (!answer()) {
+        waiting = true;
+        late++;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+
+    MEA8000_Driver.h
+
+    Feeding the MEA8000 from its REQ interrupt, while the main loop does other things.
+
+    The chip takes a start pitch byte and then 4 byte frames. It raises its REQ line when
+    it starts to play a frame: the next one has to be there before that frame ends (8, 16,
+    32 or 64 ms, FD), else the chip runs dry and the word is cut. So:
+
+    - The main loop queues whole phrases (lists of sounds, up to DRIVER_QUEUE) with queue(),
+      and calls service() often: it starts the next phrase (the pitch byte) and reads
+      frames from Flash into the free half of a FramePrefetch double buffer.
+    - onRequest() is called from the interrupt of the REQ line and writes the next frame
+      from the full half: a few bytes, no Flash reads, no waiting.
+
+    When the buffer is empty at a request (service came late) the frame is written by the
+    next service() instead: late, but in time as long as that is before the frame playing
+    ends. At the end of a phrase the chip is told to stop, it raises REQ once more when it
+    is done and the next phrase can start.
+
+    The chip is reached through MEA8000Bus, the wiring is up to the board. A simulated chip
+    with the timing of the frames is in host/MEA8000_ChipSim, see tools/MEA8000_DriverSim.cpp.
+
+    Cycles: built with DRIVER_COUNT_CYCLES (on the host) the driver adds an estimate of its
+    ATmega cost to driverCycles (the Flash reads go to flashCycles).
+
+ */
+
+#ifndef MEA8000_DRIVER_H
+#define MEA8000_DRIVER_H
+
+#include "MEA8000_Flash.h"
+#include "MEA8000_Tables.h"
+
+
+#define DRIVER_QUEUE    4       // places for phrases (one is kept free)
+
+#ifdef DRIVER_COUNT_CYCLES
+extern uint32_t driverCycles;
+#define DRIVER_COST(cycles)     (driverCycles += (cycles))
+#else
+#define DRIVER_COST(cycles)
+#endif
+
+
+class MEA8000Bus {
+public:
+    // A data byte: the pitch first, then the bytes of the frames
+    virtual void write(byte value) = 0;
+
+    // No more frames: the chip stops after the frame it plays
+    virtual void stop() = 0;
+};
+
+
+class MEA8000Driver {
+public:
+    MEA8000Driver();
+
+    void begin(MEA8000Bus *bus);
+
+    // Queue a phrase, false when the queue is full. The list and the sounds must stay
+    // in place until the phrase has been said. 'pitch' is the start pitch (Hz / 2), 0 takes
+    // the header of the first sound: give it for a list of trimmed sounds (soundPitch,
+    // spanPitch in MEA8000_Catalog.h), their headers are left out.
+    bool queue(const SoundSpan *spans, byte count, byte pitch = 0);
+
+    // From the main loop, as often as it can
+    void service();
+
+    // From the interrupt of the REQ line
+    void onRequest();
+
+    bool     isSpeaking() const     { return state != DRIVER_IDLE; }
+    bool     isIdle() const         { return state == DRIVER_IDLE && head == tail; }
+
+    // Requests the buffer was empty for, the frame came from service() instead
+    uint16_t lateFrames() const     { return late; }
+
+private:
+    enum State { DRIVER_IDLE, DRIVER_SPEAKING, DRIVER_STOPPING };
+
+    struct Phrase {
+        const SoundSpan *spans;
+        byte            count;
+        byte            pitch;          // 0: from the header
+    };
+
+    bool answer();
+
+    MEA8000Bus      *bus;
+    Phrase          phrases [DRIVER_QUEUE];
+    volatile byte   head;           // next phrase to say
+    volatile byte   tail;           // next free place
+    SoundStream     stream;
+    FramePrefetch   prefetch;
+    volatile State  state;
+    volatile bool   waiting;        // the chip asked and got nothing yet
+    volatile uint16_t late;
+};
+
+#endif
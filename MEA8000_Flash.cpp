@@ -0,0 +1,69 @@
+/*
+
+    MEA8000_Flash.cpp
+
+    Reading the sound data from Flash, see MEA8000_Flash.h
+
+ */
+
+#include "MEA8000_Flash.h"
+
+
+#ifdef FLASH_COUNT_CYCLES
+uint32_t flashCycles = 0;
+#endif
+
+#ifdef FLASH_TEST_HANDOFF
+void (*flashHandoff)(bool handedOver) = NULL;
+#endif
+
+
+FramePrefetch::FramePrefetch() {
+    begin(NULL);
+}
+
+FramePrefetch::FramePrefetch(FrameSource *source) {
+    begin(source);
+}
+
+void FramePrefetch::begin(FrameSource *source) {
+    this->source = source;
+    count[0]  = count[1] = 0;
+    readHalf  = 0;
+    readIndex = 0;
+    writeHalf = 0;
+    ended     = source == NULL;
+    misses    = 0;
+}
+
+void FramePrefetch::fill() {
+    if (ended || count[writeHalf] != 0) return;
+
+    byte n = 0;
+    while (n < FLASH_PREFETCH_FRAMES && source->nextFrame(&frames[writeHalf][n * MEA8000_FRAME_SIZE])) n++;
+    FLASH_HANDOFF(false);
+    if (n > 0) {
+        asm volatile ("" : : : "memory");   // the frames are stored before the count says so
+        count[writeHalf] = n;               // hands the half over to nextFrame
+        writeHalf ^= 1;
+        FLASH_HANDOFF(true);
+    }
+    // Only after the handoff: an interrupt in between would see the end with the last
+    // block still here, and stop too soon
+    if (n < FLASH_PREFETCH_FRAMES) ended = true;
+}
+
+bool FramePrefetch::nextFrame(byte *frame) {
+    byte n = count[readHalf];
+    if (n == 0) {
+        if (!ended) misses++;
+        return false;
+    }
+    memcpy(frame, &frames[readHalf][readIndex * MEA8000_FRAME_SIZE], MEA8000_FRAME_SIZE);
+    if (++readIndex == n) {
+        readIndex       = 0;
+        count[readHalf] = 0;        // gives the half back to fill
+        readHalf ^= 1;
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+/*
+
+    MEA8000_Flash.h
+
+    Reading the sound data from Flash a frame (or a block) at a time.
+
+    pgm_read_byte sets up the address for every byte, memcpy_P is a function call with
+    a loop. flashRead reads a row of bytes with LPM Z+ (the address register counts up by
+    itself): on an ATmega 3 cycles for the read and 2 for the store, a frame in about 22
+    cycles. On a host it is memcpy.
+
+    FramePrefetch is a small double buffer in front of any FrameSource: the main loop
+    fills one half (fill) with a block of frames, while the other half is handed out
+    (nextFrame, e.g. from an interrupt). Only the owner of a half touches it: the
+    reader gives a half back by setting its count to 0, the filler hands it over by
+    setting its count. The end is set after the last handoff, so isDone never comes
+    while a block is read but not yet handed over.
+
+    Cycles: built with FLASH_COUNT_CYCLES (on the host) the reads add an estimate of their
+    ATmega cost to flashCycles, see tools/MEA8000_FlashBench.cpp.
+
+    Races: built with FLASH_TEST_HANDOFF (on the host) fill calls flashHandoff, when it is
+    set, where an interrupt could come in: after the reads of a block (false) and after its
+    handoff (true). tools/MEA8000_DriverSim.cpp answers a REQ there.
+
+ */
+
+#ifndef MEA8000_FLASH_H
+#define MEA8000_FLASH_H
+
+#include "MEA8000_Stream.h"
+
+
+#define FLASH_PREFETCH_FRAMES   4       // frames in each half of the double buffer
+
+#ifdef FLASH_COUNT_CYCLES
+extern uint32_t flashCycles;
+#define FLASH_COST(cycles)      (flashCycles += (cycles))
+#else
+#define FLASH_COST(cycles)
+#endif
+
+#ifdef FLASH_TEST_HANDOFF
+extern void (*flashHandoff)(bool handedOver);
+#define FLASH_HANDOFF(handedOver)   (flashHandoff ? flashHandoff(handedOver) : (void)0)
+#else
+#define FLASH_HANDOFF(handedOver)
+#endif
+
+
+// Copy 'size' bytes from Flash
+inline void flashRead(byte *dest, const byte *source, byte size) {
+    FLASH_COST(4 + 5 * size);
+#ifdef __AVR__
+    while (size--) {
+        byte value;
+        asm volatile ("lpm %0, Z+" : "=r" (value), "+z" (source));
+        *dest++ = value;
+    }
+#else
+    memcpy(dest, source, size);
+#endif
+}
+
+// Copy one frame from Flash, unrolled
+inline void flashReadFrame(byte *frame, const byte *source) {
+    FLASH_COST(2 + 5 * MEA8000_FRAME_SIZE);
+#ifdef __AVR__
+    asm volatile (
+        "lpm __tmp_reg__, Z+ \n\t"  "st X+, __tmp_reg__ \n\t"
+        "lpm __tmp_reg__, Z+ \n\t"  "st X+, __tmp_reg__ \n\t"
+        "lpm __tmp_reg__, Z+ \n\t"  "st X+, __tmp_reg__ \n\t"
+        "lpm __tmp_reg__, Z+ \n\t"  "st X+, __tmp_reg__ \n\t"
+        : "+z" (source), "+x" (frame) : : "memory");
+#else
+    memcpy(frame, source, MEA8000_FRAME_SIZE);
+#endif
+}
+
+
+class FramePrefetch : public FrameSource {
+public:
+    FramePrefetch();
+    FramePrefetch(FrameSource *source);
+
+    void begin(FrameSource *source);
+
+    // Read a block of frames into the free half, if there is one. From the main loop.
+    void fill();
+
+    // The next frame of the full half. False when there is none: at the end (isDone),
+    // or because fill came too late (an underrun, counted).
+    bool nextFrame(byte *frame);
+
+    bool     isDone() const     { return ended && count[0] == 0 && count[1] == 0; }
+    uint16_t underruns() const  { return misses; }
+
+private:
+    FrameSource     *source;
+    byte            frames [2][FLASH_PREFETCH_FRAMES * MEA8000_FRAME_SIZE];
+    volatile byte   count [2];      // frames in each half, 0 = free (owned by fill)
+    byte            readHalf;
+    byte            readIndex;
+    byte            writeHalf;
+    volatile bool   ended;
+    volatile uint16_t misses;
+};
+
+#endif
@@ -0,0 +1,81 @@
+/*
+
+    MEA8000_Frame.h
+
+    The layout of the sound arrays.
+
+    A sound is a row of 4 byte frames, as they are sent to the MEA8000.
+    The sounds from catalog 2 and 3 (and a few others in base-10) start with a
+    4 byte header in front of the frames:
+
+        byte 0-1    length of the original array (high, low)
+        byte 2      start pitch (Hz / 2)
+        byte 3      (mostly 47)
+
+    There is no flag for the header in the data, it is recognized by its values.
+    Checked against all arrays in MEA8000_Sounds*.cpp: no first frame looks like a header.
+
+ */
+
+#ifndef MEA8000_FRAME_H
+#define MEA8000_FRAME_H
+
+#include "MEA8000_Platform.h"
+
+
+#define MEA8000_FRAME_SIZE      4
+#define MEA8000_HEADER_SIZE     4
+
+#define MEA8000_PI_NOISE        16      // the PI value for a noise (unvoiced) frame
+
+
+// The fields of a frame (in RAM), see the bit table at the top of MEA8000_Sounds.cpp
+constexpr byte frameBW1(const byte *frame)          { return frame[0] >> 6; }
+constexpr byte frameBW2(const byte *frame)          { return (frame[0] >> 4) & 0x03; }
+constexpr byte frameBW3(const byte *frame)          { return (frame[0] >> 2) & 0x03; }
+constexpr byte frameBW4(const byte *frame)          { return frame[0] & 0x03; }
+constexpr byte frameFM3(const byte *frame)          { return frame[1] >> 5; }
+constexpr byte frameFM2(const byte *frame)          { return frame[1] & 0x1F; }
+constexpr byte frameFM1(const byte *frame)          { return frame[2] >> 3; }
+constexpr byte frameAMPL(const byte *frame)         { return ((frame[2] & 0x07) << 1) | (frame[3] >> 7); }
+constexpr byte frameFD(const byte *frame)           { return (frame[3] >> 5) & 0x03; }
+constexpr byte framePI(const byte *frame)           { return frame[3] & 0x1F; }
+
+// Frame duration in 8 ms steps (1, 2, 4, 8)
+constexpr byte frameSteps(const byte *frame)        { return 1 << frameFD(frame); }
+
+// PI as a signed value (-15 .. +15 Hz per 8 ms), 0 for noise
+constexpr int8_t pitchIncrement(byte pi)            { return pi == MEA8000_PI_NOISE ? 0 : pi < 16 ? (int8_t)pi : (int8_t)(pi - 32); }
+constexpr byte   pitchIncrementCode(int increment)  { return (byte)((increment < -15 ? -15 : increment > 15 ? 15 : increment) & 0x1F); }
+
+constexpr bool frameIsSilent(const byte *frame)     { return frameAMPL(frame) == 0; }
+
+inline void setFrameAMPL(byte *frame, byte ampl) {
+    frame[2] = (frame[2] & 0xF8) | (ampl >> 1);
+    frame[3] = (frame[3] & 0x7F) | (byte)(ampl << 7);
+}
+
+inline void packFrame(byte *frame, byte bw1, byte bw2, byte bw3, byte bw4,
+                      byte fm3, byte fm2, byte fm1, byte ampl, byte fd, byte pi) {
+    frame[0] = (byte)((bw1 << 6) | ((bw2 & 0x03) << 4) | ((bw3 & 0x03) << 2) | (bw4 & 0x03));
+    frame[1] = (byte)((fm3 << 5) | (fm2 & 0x1F));
+    frame[2] = (byte)((fm1 << 3) | ((ampl >> 1) & 0x07));
+    frame[3] = (byte)((ampl << 7) | ((fd & 0x03) << 5) | (pi & 0x1F));
+}
+
+inline void setFrameFD(byte *frame, byte fd)        { frame[3] = (frame[3] & 0x9F) | (byte)((fd & 0x03) << 5); }
+inline void setFramePI(byte *frame, byte pi)        { frame[3] = (frame[3] & 0xE0) | (pi & 0x1F); }
+
+
+// The header test on its bytes (0, 2 and 3)
+constexpr bool isSoundHeader(byte lengthHigh, byte pitch, byte mark) {
+    return lengthHigh <= 1 && pitch < 64 && mark >= 32 && mark < 64;
+}
+
+// Size of the header in front of the frames, 0 or MEA8000_HEADER_SIZE (data in Flash)
+inline byte soundHeaderSize(const byte *data, uint16_t length) {
+    if (length < MEA8000_HEADER_SIZE) return 0;
+    return isSoundHeader(pgm_read_byte(data), pgm_read_byte(data + 2), pgm_read_byte(data + 3)) ? MEA8000_HEADER_SIZE : 0;
+}
+
+#endif
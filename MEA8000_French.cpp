@@ -0,0 +1,326 @@
+/*
+
+    MEA8000_French.cpp
+
+    French text to speech with the phonemes, see MEA8000_French.h
+
+ */
+
+#include "MEA8000_French.h"
+
+
+const SoundSpan frenchPhonemes [FR_PHONEMES] PROGMEM = {
+    SOUND(Sound_a),  SOUND(Sound_e),  SOUND(Sound_i),  SOUND(Sound_oo), SOUND(Sound_u),  SOUND(Sound_eh),
+    SOUND(Sound_ee), SOUND(Sound_oh), SOUND(Sound_w),  SOUND(Sound_A),  SOUND(Sound_I),  SOUND(Sound_O),
+    SOUND(Sound_W),  SOUND(Sound_b),  SOUND(Sound_d),  SOUND(Sound_f),  SOUND(Sound_g),  SOUND(Sound_j),
+    SOUND(Sound_k),  SOUND(Sound_l),  SOUND(Sound_m),  SOUND(Sound_n),  SOUND(Sound_p),  SOUND(Sound_R),
+    SOUND(Sound_r),  SOUND(Sound_s),  SOUND(Sound_t),  SOUND(Sound_v),  SOUND(Sound_z),  SOUND(Sound_ch),
+    SOUND(Sound_N),  SOUND(Sound_ai), SOUND(Sound_ej), SOUND(Sound_ui), SOUND(Sound_ie), SOUND(Sound_oi),
+    SOUND(Sound_o) };
+
+
+// -- Spelling rules ----------------------------------------------------------------
+//
+// A rule matches when its letters are at the current position and its context holds.
+// The first rule that matches is used, so the longer and the special ones come first.
+// Rules are grouped by their first letter.
+
+#define NEXT_END        0x01    // nothing follows
+#define NEXT_VOWEL      0x02    // a vowel follows
+#define NEXT_NASAL      0x04    // a consonant other than m or n follows, or nothing
+#define NEXT_SOFT       0x08    // e, i or y follows (soft c and g)
+#define NEXT_TWO_CONS   0x10    // two consonants follow
+#define PREV_VOWEL      0x20    // a vowel is in front
+#define NOT_FIRST       0x40    // not at the start of the word (nor the 2nd letter)
+
+struct FrenchRule {
+    char    letters [5];
+    byte    context;
+    byte    phonemes [3];
+};
+
+static const FrenchRule frenchRules [] PROGMEM = {
+    { "aim",  NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "ain",  NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "am",   NEXT_NASAL,           { FR_A,    FR_NONE, FR_NONE } },
+    { "an",   NEXT_NASAL,           { FR_A,    FR_NONE, FR_NONE } },
+    { "ai",   0,                    { FR_eh,   FR_NONE, FR_NONE } },
+    { "au",   0,                    { FR_o,    FR_NONE, FR_NONE } },
+    { "ay",   0,                    { FR_eh,   FR_NONE, FR_NONE } },
+    { "a",    0,                    { FR_a,    FR_NONE, FR_NONE } },
+
+    { "bb",   0,                    { FR_b,    FR_NONE, FR_NONE } },
+    { "b",    0,                    { FR_b,    FR_NONE, FR_NONE } },
+
+    { "cc",   NEXT_SOFT,            { FR_k,    FR_s,    FR_NONE } },
+    { "ch",   0,                    { FR_ch,   FR_NONE, FR_NONE } },
+    { "ck",   0,                    { FR_k,    FR_NONE, FR_NONE } },
+    { "c",    NEXT_SOFT,            { FR_s,    FR_NONE, FR_NONE } },
+    { "c",    0,                    { FR_k,    FR_NONE, FR_NONE } },
+
+    { "dd",   0,                    { FR_d,    FR_NONE, FR_NONE } },
+    { "d",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "d",    0,                    { FR_d,    FR_NONE, FR_NONE } },
+
+    { "eau",  0,                    { FR_o,    FR_NONE, FR_NONE } },
+    { "ein",  NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "em",   NEXT_NASAL,           { FR_A,    FR_NONE, FR_NONE } },
+    { "en",   NEXT_NASAL,           { FR_A,    FR_NONE, FR_NONE } },
+    { "er",   NEXT_END | NOT_FIRST, { FR_ee,   FR_NONE, FR_NONE } },
+    { "es",   NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "es",   NEXT_END,             { FR_eh,   FR_NONE, FR_NONE } },
+    { "est",  NEXT_END,             { FR_eh,   FR_NONE, FR_NONE } },
+    { "et",   NEXT_END,             { FR_eh,   FR_NONE, FR_NONE } },
+    { "ez",   NEXT_END,             { FR_ee,   FR_NONE, FR_NONE } },
+    { "ei",   0,                    { FR_eh,   FR_NONE, FR_NONE } },
+    { "eu",   0,                    { FR_e,    FR_NONE, FR_NONE } },
+    { "e",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "e",    NEXT_TWO_CONS,        { FR_eh,   FR_NONE, FR_NONE } },
+    { "e",    0,                    { FR_e,    FR_NONE, FR_NONE } },
+
+    { "ff",   0,                    { FR_f,    FR_NONE, FR_NONE } },
+    { "f",    0,                    { FR_f,    FR_NONE, FR_NONE } },
+
+    { "gn",   0,                    { FR_N,    FR_NONE, FR_NONE } },
+    { "gu",   NEXT_SOFT,            { FR_g,    FR_NONE, FR_NONE } },
+    { "ge",   NEXT_VOWEL,           { FR_j,    FR_NONE, FR_NONE } },
+    { "g",    NEXT_SOFT,            { FR_j,    FR_NONE, FR_NONE } },
+    { "g",    0,                    { FR_g,    FR_NONE, FR_NONE } },
+
+    { "h",    0,                    { FR_NONE, FR_NONE, FR_NONE } },
+
+    { "ien",  NEXT_NASAL,           { FR_ie,   FR_I,    FR_NONE } },
+    { "ill",  PREV_VOWEL,           { FR_ie,   FR_NONE, FR_NONE } },
+    { "ill",  0,                    { FR_i,    FR_ie,   FR_NONE } },
+    { "im",   NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "in",   NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "ion",  NEXT_NASAL,           { FR_i,    FR_O,    FR_NONE } },
+    { "ie",   0,                    { FR_ie,   FR_NONE, FR_NONE } },
+    { "i",    0,                    { FR_i,    FR_NONE, FR_NONE } },
+
+    { "j",    0,                    { FR_j,    FR_NONE, FR_NONE } },
+    { "k",    0,                    { FR_k,    FR_NONE, FR_NONE } },
+
+    { "ll",   0,                    { FR_l,    FR_NONE, FR_NONE } },
+    { "l",    0,                    { FR_l,    FR_NONE, FR_NONE } },
+
+    { "mm",   0,                    { FR_m,    FR_NONE, FR_NONE } },
+    { "m",    0,                    { FR_m,    FR_NONE, FR_NONE } },
+
+    { "nn",   0,                    { FR_n,    FR_NONE, FR_NONE } },
+    { "n",    0,                    { FR_n,    FR_NONE, FR_NONE } },
+
+    { "oeu",  0,                    { FR_e,    FR_NONE, FR_NONE } },
+    { "oin",  NEXT_NASAL,           { FR_oo,   FR_I,    FR_NONE } },
+    { "om",   NEXT_NASAL,           { FR_O,    FR_NONE, FR_NONE } },
+    { "on",   NEXT_NASAL,           { FR_O,    FR_NONE, FR_NONE } },
+    { "oi",   0,                    { FR_oi,   FR_NONE, FR_NONE } },
+    { "oy",   0,                    { FR_oi,   FR_NONE, FR_NONE } },
+    { "ou",   0,                    { FR_oo,   FR_NONE, FR_NONE } },
+    { "o",    NEXT_TWO_CONS,        { FR_oh,   FR_NONE, FR_NONE } },
+    { "o",    0,                    { FR_o,    FR_NONE, FR_NONE } },
+
+    { "ph",   0,                    { FR_f,    FR_NONE, FR_NONE } },
+    { "pp",   0,                    { FR_p,    FR_NONE, FR_NONE } },
+    { "p",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "p",    0,                    { FR_p,    FR_NONE, FR_NONE } },
+
+    { "qu",   0,                    { FR_k,    FR_NONE, FR_NONE } },
+    { "q",    0,                    { FR_k,    FR_NONE, FR_NONE } },
+
+    { "rr",   0,                    { FR_R,    FR_NONE, FR_NONE } },
+    { "r",    0,                    { FR_R,    FR_NONE, FR_NONE } },
+
+    { "sc",   NEXT_SOFT,            { FR_s,    FR_NONE, FR_NONE } },
+    { "ss",   0,                    { FR_s,    FR_NONE, FR_NONE } },
+    { "s",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "s",    PREV_VOWEL|NEXT_VOWEL,{ FR_z,    FR_NONE, FR_NONE } },
+    { "s",    0,                    { FR_s,    FR_NONE, FR_NONE } },
+
+    { "tion", 0,                    { FR_s,    FR_i,    FR_O } },
+    { "th",   0,                    { FR_t,    FR_NONE, FR_NONE } },
+    { "tt",   0,                    { FR_t,    FR_NONE, FR_NONE } },
+    { "t",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "t",    0,                    { FR_t,    FR_NONE, FR_NONE } },
+
+    { "ui",   0,                    { FR_ui,   FR_NONE, FR_NONE } },
+    { "um",   NEXT_NASAL,           { FR_W,    FR_NONE, FR_NONE } },
+    { "un",   NEXT_NASAL,           { FR_W,    FR_NONE, FR_NONE } },
+    { "u",    0,                    { FR_u,    FR_NONE, FR_NONE } },
+
+    { "v",    0,                    { FR_v,    FR_NONE, FR_NONE } },
+    { "w",    0,                    { FR_v,    FR_NONE, FR_NONE } },
+
+    { "x",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "x",    0,                    { FR_k,    FR_s,    FR_NONE } },
+
+    { "yn",   NEXT_NASAL,           { FR_I,    FR_NONE, FR_NONE } },
+    { "y",    0,                    { FR_i,    FR_NONE, FR_NONE } },
+
+    { "z",    NEXT_END | NOT_FIRST, { FR_NONE, FR_NONE, FR_NONE } },
+    { "z",    0,                    { FR_z,    FR_NONE, FR_NONE } },
+
+    { "@",    0,                    { FR_ee,   FR_NONE, FR_NONE } },
+    { "&",    0,                    { FR_eh,   FR_NONE, FR_NONE } },
+    { "$",    0,                    { FR_s,    FR_NONE, FR_NONE } },
+    { "%u",   0,                    { FR_e,    FR_NONE, FR_NONE } },
+    { "%",    0,                    { FR_e,    FR_NONE, FR_NONE } } };
+
+#define FRENCH_RULES    (sizeof(frenchRules) / sizeof(FrenchRule))
+
+
+static bool isVowel(char letter) {
+    return letter && strchr("aeiouy@&%", letter) != NULL;
+}
+
+static bool contextHolds(byte context, const char *word, byte length, byte position, byte size) {
+    byte next       = position + size;
+    char after      = next < length ? word[next] : 0;
+
+    if ((context & NEXT_END)      && after)                                         return false;
+    if ((context & NEXT_VOWEL)    && !isVowel(after))                               return false;
+    if ((context & NEXT_NASAL)    && (isVowel(after) || after == 'm' || after == 'n')) return false;
+    if ((context & NEXT_SOFT)     && !(after == 'e' || after == 'i' || after == 'y' ||
+                                       after == '@' || after == '&'))               return false;
+    if ((context & NEXT_TWO_CONS) && (next + 1 >= length || isVowel(after) ||
+                                      isVowel(word[next + 1])))                     return false;
+    if ((context & PREV_VOWEL)    && (position == 0 || !isVowel(word[position - 1]))) return false;
+    if ((context & NOT_FIRST)     && position < 2)                                  return false;
+    return true;
+}
+
+// The rule for the letters at 'position', NULL if there is none
+static const FrenchRule *findRule(const char *word, byte length, byte position, byte *size) {
+    char letter = word[position];
+
+    for (byte r = 0; r < FRENCH_RULES; r++) {
+        const FrenchRule *rule = &frenchRules[r];
+        if ((char)pgm_read_byte(&rule->letters[0]) != letter) continue;
+
+        byte n = 1;
+        char c;
+        while (n < sizeof(rule->letters) && (c = (char)pgm_read_byte(&rule->letters[n])) != 0) {
+            if (position + n >= length || word[position + n] != c) break;
+            n++;
+        }
+        if (n < sizeof(rule->letters) && pgm_read_byte(&rule->letters[n]) != 0) continue;
+
+        if (contextHolds(pgm_read_byte(&rule->context), word, length, position, n)) {
+            *size = n;
+            return rule;
+        }
+    }
+    return NULL;
+}
+
+byte frenchWord(const char *word, byte length, SoundSpan *spans, byte maxSpans) {
+    byte count    = 0;
+    byte position = 0;
+
+    while (position < length) {
+        byte size;
+        const FrenchRule *rule = findRule(word, length, position, &size);
+        if (rule == NULL) {
+            position++;
+            continue;
+        }
+        for (byte p = 0; p < sizeof(rule->phonemes); p++) {
+            byte phoneme = pgm_read_byte(&rule->phonemes[p]);
+            if (phoneme == FR_NONE || count >= maxSpans) break;
+            spans[count++] = readSoundSpan(&frenchPhonemes[phoneme]);
+        }
+        position += size;
+    }
+    return count;
+}
+
+
+// Latin-1 0xE0 .. 0xFF (also the 2nd byte of UTF-8 0xC3 ..) to the letters of the rules
+static const char frenchAccents [32] PROGMEM = {
+    'a', 'a', 'a', 'a', 'a', 'a', 'e', '$',     // à á â ã ä å æ ç
+    '&', '@', '&', '&', 'i', 'i', 'i', 'i',     // è é ê ë ì í î ï
+     0,  'n', 'o', 'o', 'o', 'o', 'o',  0,      // ð ñ ò ó ô õ ö ÷
+    'o', 'u', 'u', 'u', 'u', 'y',  0,  'y' };   // ø ù ú û ü ý þ ÿ
+
+char frenchNormalize(const char **text) {
+    byte c = (byte)*(*text)++;
+
+    if (c >= 'A' && c <= 'Z') return c - 'A' + 'a';
+    if (c >= 'a' && c <= 'z') return c;
+    if (c < 0xC0) return 0;
+
+    byte next = (byte)**text;
+    if ((next & 0xC0) != 0x80) return pgm_read_byte(&frenchAccents[c & 0x1F]);     // Latin-1
+
+    // UTF-8: the letters of Latin-1 (0xC3 ..) and œ, anything else (’ « » …) is skipped whole
+    (*text)++;
+    if (c == 0xC3)                                  return pgm_read_byte(&frenchAccents[next & 0x1F]);
+    if (c == 0xC5 && (next == 0x92 || next == 0x93)) return '%';
+    for (byte more = c >= 0xF0 ? 2 : c >= 0xE0 ? 1 : 0; more > 0 && ((byte)**text & 0xC0) == 0x80; more--) (*text)++;
+    return 0;
+}
+
+
+FrenchReader::FrenchReader() {
+    begin("");
+}
+
+FrenchReader::FrenchReader(const char *text) {
+    begin(text);
+}
+
+void FrenchReader::begin(const char *text) {
+    this->text = text;
+}
+
+bool FrenchReader::nextWord(SoundSpan *spans, byte maxSpans, byte *count) {
+    char word [FRENCH_MAX_WORD];
+    byte length = 0;
+
+    while (*text) {
+        char letter = frenchNormalize(&text);
+        if (letter) {
+            if (length < FRENCH_MAX_WORD) word[length++] = letter;
+        } else if (length > 0) {
+            break;
+        }
+    }
+    if (length == 0) return false;
+
+    *count = frenchWord(word, length, spans, maxSpans);
+    return true;
+}
+
+
+FrenchStream::FrenchStream() {
+    begin("");
+}
+
+FrenchStream::FrenchStream(const char *text, byte gap) {
+    begin(text, gap);
+}
+
+void FrenchStream::begin(const char *text, byte gap) {
+    this->gap = gap;
+    first     = true;
+    reader.begin(text);
+    join.begin(NULL, 0);
+}
+
+bool FrenchStream::nextFrame(byte *frame) {
+    while (!join.nextFrame(frame)) {
+        const SoundSpan silence = SOUND(NoSound);
+        byte            count   = 0;
+
+        if (!first) {
+            for (; count < gap && count < FRENCH_MAX_PHONEMES; count++) spans[count] = silence;
+        }
+        byte phonemes;
+        if (!reader.nextWord(spans + count, FRENCH_MAX_PHONEMES - count, &phonemes)) return false;
+        if (phonemes == 0) continue;
+
+        first = false;
+        join.begin(spans, count + phonemes);
+    }
+    return true;
+}
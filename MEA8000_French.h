@@ -0,0 +1,107 @@
+/*
+
+    MEA8000_French.h
+
+    French text to speech with the phonemes of MEA8000_SoundsPhonemes.cpp,
+    for words that are not in catalog 2 or 3.
+
+    The text is read one word at a time. Every word is written with a small table of
+    spelling rules (in Flash) as a row of phonemes, so the delay before the first
+    sound is one word, whatever the length of the text.
+
+    Accents may be given in UTF-8 or in Latin-1 (é, è, ê, à, ç, ...), and œ in UTF-8.
+    The rules are simple and cover the common French spellings only; it sounds like
+    a French speaking robot, as it should.
+
+    The names of the phoneme arrays are not documented in the data set,
+    the table below gives the sounds they are used for.
+
+ */
+
+#ifndef MEA8000_FRENCH_H
+#define MEA8000_FRENCH_H
+
+#include "MEA8000_Join.h"
+
+
+enum FrenchPhoneme : byte {
+    FR_a = 0,   // a        papa
+    FR_e,       // e        le, de
+    FR_i,       // i        lit, y
+    FR_oo,      // ou       tout
+    FR_u,       // u        tu
+    FR_eh,      // è        père, lait
+    FR_ee,      // é        été, parler
+    FR_oh,      // o (open) porte
+    FR_w,       // (not used by the rules)
+    FR_A,       // an, en   enfant
+    FR_I,       // in, ain  matin, pain
+    FR_O,       // on       bon
+    FR_W,       // un       brun
+    FR_b, FR_d, FR_f, FR_g, FR_j, FR_k, FR_l, FR_m, FR_n, FR_p,
+    FR_R,       // r
+    FR_r,       // (not used by the rules)
+    FR_s, FR_t, FR_v, FR_z,
+    FR_ch,      // ch       chat
+    FR_N,       // gn       ligne
+    FR_ai,      // (not used by the rules)
+    FR_ej,      // (not used by the rules)
+    FR_ui,      // ui       huit
+    FR_ie,      // ie, ill  pied, fille
+    FR_oi,      // oi       moi
+    FR_o,       // o        mot, eau
+    FR_PHONEMES,
+    FR_NONE = 0xFF
+};
+
+#define FRENCH_MAX_WORD         32      // letters, longer words are cut
+#define FRENCH_MAX_PHONEMES     40      // per word
+
+
+extern const SoundSpan frenchPhonemes [FR_PHONEMES] PROGMEM;
+
+// Phonemes of one word, 'word' is already normalized (lower case, see frenchNormalize)
+// Returns the number of spans written to 'spans'.
+byte frenchWord(const char *word, byte length, SoundSpan *spans, byte maxSpans);
+
+// One character of the text in the form the rules use: 'a' .. 'z', '@' for é,
+// '&' for è, ê and ë, '$' for ç, '%' for œ; 0 for anything that is not a letter.
+// 'text' is moved past the character (all its bytes for UTF-8).
+char frenchNormalize(const char **text);
+
+
+// Reads a text word by word
+class FrenchReader {
+public:
+    FrenchReader();
+    FrenchReader(const char *text);
+
+    void begin(const char *text);
+
+    // The phonemes of the next word, false when the text is done
+    bool nextWord(SoundSpan *spans, byte maxSpans, byte *count);
+
+private:
+    const char  *text;
+};
+
+
+// Speaks a text, word by word, with smooth joins between the phonemes
+// and 'gap' times NoSound between the words.
+class FrenchStream : public FrameSource {
+public:
+    FrenchStream();
+    FrenchStream(const char *text, byte gap = 1);
+
+    void begin(const char *text, byte gap = 1);
+    bool nextFrame(byte *frame);
+
+private:
+    FrenchReader    reader;
+    JoinStream      join;
+    SoundSpan       spans [FRENCH_MAX_PHONEMES];
+    byte            gap;
+    bool            first;
+};
+
+#endif
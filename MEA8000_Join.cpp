@@ -0,0 +1,71 @@
+/*
+
+    MEA8000_Join.cpp
+
+    Smooth joining of sounds, see MEA8000_Join.h
+
+ */
+
+#include "MEA8000_Join.h"
+
+
+// 'from' and 'to' mixed at step / total, rounded
+static int blend(int from, int to, byte step, byte total) {
+    int value = from * (total - step) + to * step;
+    return (value >= 0 ? value + total / 2 : value - total / 2) / total;
+}
+
+void joinFrame(byte *frame, const byte *from, const byte *to, byte step, byte steps) {
+    byte total = steps + 1;
+
+    // A glide between voiced and noise stays voiced, noise counts as PI 0
+    byte pi = (framePI(from) == MEA8000_PI_NOISE && framePI(to) == MEA8000_PI_NOISE)
+              ? MEA8000_PI_NOISE
+              : pitchIncrementCode(blend(pitchIncrement(framePI(from)), pitchIncrement(framePI(to)), step, total));
+
+    packFrame(frame,
+              blend(frameBW1(from),  frameBW1(to),  step, total),
+              blend(frameBW2(from),  frameBW2(to),  step, total),
+              blend(frameBW3(from),  frameBW3(to),  step, total),
+              blend(frameBW4(from),  frameBW4(to),  step, total),
+              blend(frameFM3(from),  frameFM3(to),  step, total),
+              blend(frameFM2(from),  frameFM2(to),  step, total),
+              blend(frameFM1(from),  frameFM1(to),  step, total),
+              blend(frameAMPL(from), frameAMPL(to), step, total),
+              0, pi);
+}
+
+
+JoinStream::JoinStream() {
+    begin(NULL, 0);
+}
+
+JoinStream::JoinStream(const SoundSpan *spans, byte count, byte steps) {
+    begin(spans, count, steps);
+}
+
+void JoinStream::begin(const SoundSpan *spans, byte count, byte steps) {
+    this->steps = steps > JOIN_MAX_STEPS ? JOIN_MAX_STEPS : steps;
+    step        = 0;
+    stream.begin(spans, count);
+    haveNext    = stream.nextFrame(next);
+}
+
+bool JoinStream::nextFrame(byte *frame) {
+    if (step > 0) {
+        joinFrame(frame, last, next, step, steps);
+        step = (step < steps) ? step + 1 : 0;
+        return true;
+    }
+    if (!haveNext) return false;
+
+    memcpy(frame, next, MEA8000_FRAME_SIZE);
+    memcpy(last,  next, MEA8000_FRAME_SIZE);
+
+    byte span = stream.spanIndex();
+    haveNext  = stream.nextFrame(next);
+    if (haveNext && steps > 0 && stream.spanIndex() != span &&
+        !frameIsSilent(last) && !frameIsSilent(next)) step = 1;
+
+    return true;
+}
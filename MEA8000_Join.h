@@ -0,0 +1,50 @@
+/*
+
+    MEA8000_Join.h
+
+    Smooth joining of sounds (coarticulation).
+
+    Playing phonemes one after the other (Sound_b + Sound_a) gives abrupt jumps of the
+    formants at the seams. JoinStream plays a list of sounds like SoundStream, but at
+    every seam it inserts a few extra 8 ms frames that glide from the last frame of the
+    left sound to the first frame of the right one.
+
+    The glide is done on the frame fields themselves (BW, FM1/FM2/FM3 index, AMPL, PI),
+    no audio is involved, so it costs a few additions per inserted frame. The FM tables
+    are close to logarithmic, so a straight line in index is a smooth glide in pitch.
+    Seams next to a silent frame (a gap between words) are left alone.
+
+ */
+
+#ifndef MEA8000_JOIN_H
+#define MEA8000_JOIN_H
+
+#include "MEA8000_Stream.h"
+
+
+#define JOIN_DEFAULT_STEPS      2
+#define JOIN_MAX_STEPS          8
+
+
+// Frame 'step' of 'steps' inserted frames on the way from 'from' to 'to' (step 1 .. steps)
+void joinFrame(byte *frame, const byte *from, const byte *to, byte step, byte steps);
+
+
+class JoinStream : public FrameSource {
+public:
+    JoinStream();
+    JoinStream(const SoundSpan *spans, byte count, byte steps = JOIN_DEFAULT_STEPS);
+
+    void begin(const SoundSpan *spans, byte count, byte steps = JOIN_DEFAULT_STEPS);
+    bool nextFrame(byte *frame);
+
+private:
+    SoundStream stream;
+    byte        steps;                      // inserted frames per seam
+    byte        step;                       // next inserted frame, 0 when not in a seam
+    bool        haveNext;
+    byte        last [MEA8000_FRAME_SIZE];  // last frame handed out from the sounds
+    byte        next [MEA8000_FRAME_SIZE];  // read ahead
+};
+
+#endif
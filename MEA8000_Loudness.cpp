@@ -0,0 +1,36 @@
+/*
+
+    MEA8000_Loudness.cpp
+
+    The same loudness for all sounds, see MEA8000_Loudness.h
+
+ */
+
+#include "MEA8000_Loudness.h"
+
+
+LoudnessStream::LoudnessStream() {
+    begin(NULL, 0);
+}
+
+LoudnessStream::LoudnessStream(const SoundSpan *spans, byte count) {
+    begin(spans, count);
+}
+
+void LoudnessStream::begin(const SoundSpan *spans, byte count) {
+    this->spans = spans;
+    stream.begin(spans, count);
+    index      = 0xFF;
+    correction = 0;
+}
+
+bool LoudnessStream::nextFrame(byte *frame) {
+    if (!stream.nextFrame(frame)) return false;
+
+    if (stream.spanIndex() != index) {
+        index      = stream.spanIndex();
+        correction = loudnessCorrection(catalogFind(spans[index].data));
+    }
+    if (correction) setFrameAMPL(frame, loudnessAMPL(frameAMPL(frame), correction));
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+
+    MEA8000_Loudness.h
+
+    The same loudness for all sounds, without a gain stage at playback.
+
+    The sounds come from many sources, the words of catalog 2 and 3 are much louder
+    than most of the hex data of the first part. tools/MEA8000_MakeLoudness.cpp renders
+    every sound once, measures its level (over the frames that are heard) and writes the
+    correction for it to MEA8000_LoudnessTable.cpp, in AMPL steps: the amplitude table
+    of the chip goes up by 3 dB a step, so adding to AMPL is a gain in steps of 3 dB.
+
+    LoudnessStream plays a list of sounds with the correction added to AMPL of every frame
+    (silent frames stay silent, the result is kept in 1 .. 15). The host renderer can take
+    the same correction as a gain (loudnessGain in host/MEA8000_Render.h), for WAV files.
+
+ */
+
+#ifndef MEA8000_LOUDNESS_H
+#define MEA8000_LOUDNESS_H
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Stream.h"
+
+
+#define LOUDNESS_STEP_DB    3       // dB per AMPL step
+
+// Correction of every sound in AMPL steps, by sound id (generated)
+extern const int8_t soundLoudness [SOUND_COUNT] PROGMEM;
+
+inline int8_t loudnessCorrection(uint16_t id)   { return id < SOUND_COUNT ? (int8_t)pgm_read_byte(&soundLoudness[id]) : 0; }
+
+// AMPL with 'steps' added
+constexpr byte loudnessAMPL(byte ampl, int steps) {
+    return ampl == 0 ? 0 : ampl + steps < 1 ? 1 : ampl + steps > 15 ? 15 : (byte)(ampl + steps);
+}
+
+
+class LoudnessStream : public FrameSource {
+public:
+    LoudnessStream();
+    LoudnessStream(const SoundSpan *spans, byte count);
+
+    // The spans may be trimmed (trimmedSound), sounds that are not in the catalog are not changed
+    void begin(const SoundSpan *spans, byte count);
+    bool nextFrame(byte *frame);
+
+private:
+    SoundStream     stream;
+    const SoundSpan *spans;
+    byte            index;          // span of 'correction'
+    int8_t          correction;
+};
+
+#endif
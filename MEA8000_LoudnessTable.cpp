@@ -0,0 +1,59 @@
+/*
+
+    MEA8000_LoudnessTable.cpp
+
+    Generated by tools/MEA8000_MakeLoudness.cpp, do not edit.
+    Target level -0.3 dB (host renderer).
+
+ */
+
+#include "MEA8000_Loudness.h"
+
+
+const int8_t soundLoudness [SOUND_COUNT] PROGMEM = {
+     0,  -1,   2,  -2,   4,   1,  -3,  -3,   1,  -2,   0,   0,   3,   4,   6,   5,
+    -9,   1,  -5,  -2,   4,   5,   3,   0,   2,   3,  -3,  -3,   2,  -3,  -6,  -2,
+    -3,  -4,  -2,  -5,  -2,   2,  -2,  -2,  -3,  -2,  -2,  -1,   0,  -1,  -2,  -3,
+    -2,  -1,  -2,  -1,  -2,  -3,  -2,   0,  -4,  -2,  -1,   0,  -2,  -2,  -2,   3,
+     1,   1,   8,   5,  -2,  -2,   1,   1,  -3,   0,   1,  -4,  -9, -10,  -6,   0,
+    -4,   0,  -2,   0,   0,  -3,  -6,  -1,  -5,  -1,   0,   2,  -2,   0,  -2,  -1,
+     0,  -1,  -1,   0,   1,   0,   0,   1,   1,   2,   1,   0,   0,  -2,  -1,   0,
+     5,   0,   0,   1,   1,  -1,   0,   0,  -2,  -1,   6,   0,   0,   2,  -1,   0,
+    -2,   0,  -5,  -2,  -8,  -4,  -7,  -1,   0,   1,   2,   4,   0,   0,   0,   0,
+     2,   1,  -1,   1,  -2,  -5,  -1,   6,  -1,   0,   3,   1,   0,   0,   2,  -2,
+     0,   0,  -1,   1,   1,   0,   3,  -1,  -2,   3,   1,   2,   3,   0,   2,   1,
+     0,  -1,  -1,   0,   2,   3,   0,  -1,  -2,  -2,  -1,   0,   1,   1,  -1,   3,
+     0,   0,   1,  -2,   1,   0,   0,  -1,  -3,  -7,  -1,  -2,  -3,  -3,  -6,   1,
+     1,  -3,   0,   0,   2,   0,   1,  -3,  -2,  -2,  -1,  -1,   0,   2,  -3,   3,
+     1,  -1,  -1,  -1,   2,   0,   0,   2,   0,  -2,   0,   2,  -1,   1,   1,   0,
+     0,   3,  -3,  -1,  -1,   1,  -1,  -2,   2,   3,   0,   1,  -1,   0,   3,  -5,
+     1,   6,   0,   3,   4,   4,   4,   1,  -2,   3,  -1,   5,   2,  -3,   2,   6,
+     1,  -2,  -1,   1,   1,   0,   1,  -2,  -1,   1,   1,   0,   0,   1,   1,   0,
+     1,  -1,   1,  -2,  -1,   1,   0,   0,  -1,  -1,  -2,  -2,   0,  -9,  -9,   0,
+    -1,   0,   1,   0,   1,   0,  -1,  -1,   1,  -6,   1,   0,  -5,   0,  -6,  -1,
+    -2, -10,  -6,  -4,  -5,  -5,  -6,  -6,  -6,  -5,  -6,  -1,  -2,   1,   0,   1,
+     0,   1,  -1,  -2,  -5,  -5,  -1,  -1,  -2,   0,  -6,   2,  -2,   4,  -1,  -6,
+     2,   1,   3,   0,   0,   1,   3,  -2,   3,   1,   1,  -1,   0,  -2,   0,  -2,
+     1,  -2,  -2,  -1,   0,   0,   1,  -2,   2,   3,  -1,   0,   2,  -2,   3,   3,
+    -2,   1,  -2,  -2,   1,   1,   1,   0,  -1,  -1,  -2,  -1,  -1,  -3,  -2,  -1,
+     1,   1,  -2,   0,  -2,  -8,   1,  -1,   0,  -5,  -1,   3,   0,   1,   0,  -2,
+     0,  -1,  -1,   3,   2,   0,  -1,  -1,   2,   0,  -1,   1,  -1,   0,  -1,  -2,
+     3,   1,  -4,  -1,  -1,   0,  -1,  -3,   3,  -1,   0,   0,   0,   0,  -2,  -3,
+    -1,  -1,   2,  -1,   5,   1,   1,   4,   7,   2,   4,   2,   1,  -1,   2,   6,
+     2,  -1,  -7,   2,   3,  -2,   1,   0,   0,   1,  -2,   1,   2,   4,   6,   0,
+     2,  -1,   2,   2,  -4,   1,   2,   0,   0,  -6,  -1,  -9,  -5,  -2,   1,   5,
+     1,   1,  -1,   2,   0,   0,   0,   0,   2,  -2,   5,   1,   0,  -1,  -1,  -3,
+     0,   1,   1,   1,   4,  -4,  -1,   0,   0,  -3,  -9,  -1,   2,  -1,   1,   1,
+     1,   2,   2,  -1,   3,   1,  -1,   1,   1,  -3,  11,   3,   0,   1,  -2,   0,
+     1,  -1,   0,   0,   1,   2,   2,   2,  -1,   1,   0,   0,  -1,   1,   2,   1,
+    -4,   0,   2,   1,   0,   0,   2,  -6,  -6,  -6,  -3,  -3,   2,   1,   0,   0,
+     0,   3,   1,   1,   2,   2,   2,   0,   5,   1,   1,   1,   3,   2,   0,   1,
+     1,   1,   0,   2,   1,   0,  -2,   3,   1,   2,  -2,   0,   4,   2,   4,  -1,
+     2,   0,   1,   3,   0,   1,  -1,  -5,  -2,   1,  -5,   1,   0,  -1,   1,  -1,
+     2,   2,  -1,   2,  -2,  -1,   4,   0,   2,   0,   0,   3,   4,  -1,   4,   0,
+    -1,  -1,   0,   2,   1,   0,   5,   2,  -1,   2,   4,   1,   0,   0,   0,   3,
+     6,  -1,  -1,   5,  -1,   1,   0,   1,  -5,  -1,   0,  -1,  -1,   1,   1,  -1,
+     1,   1,   1,  -1,   1,  -1,   1,  -8,   0,   2,  -1,   2,   0,   0,   0,  -1,
+     1,   1,   5,  -1,   4,   2,   1,  -1,  -1,   3,  -1,   2,   0,  -6, -10,  -1,
+     2,   1,  -2,  -1,  -1,
+};
@@ -0,0 +1,150 @@
+/*
+
+    MEA8000_Numbers.cpp
+
+    English numbers (0 .. 999), see MEA8000_Numbers.h
+
+ */
+
+#include "MEA8000_Numbers.h"
+
+
+const SoundSpan englishParts [EN_PARTS] PROGMEM = {
+    SOUND(Sound_ZerOO), SOUND(Sound_One),    SOUND(Sound_Two),    SOUND(Sound_Three), SOUND(Sound_Four),
+    SOUND(Sound_Five),  SOUND(Sound_Six),    SOUND(Sound_Seven),  SOUND(Sound_Eight), SOUND(Sound_Nine),
+    SOUND(Sound_Ten),   SOUND(Sound_Eleven), SOUND(Sound_Twelve),
+    SOUND(Sound_Thir_), SOUND(Sound_Four_),  SOUND(Sound_Fif_),   SOUND(Sound__teen), SOUND(Sound_Twen_),
+    SOUND(Sound__ty),   SOUND(Sound_Hundred), SOUND(Sound_And) };
+
+
+// Some checks on the composer, all done by the compiler
+static_assert(englishNumberCount(0)    == 1 && englishNumberPart(0, 0)   == EN_ZERO,   "zero");
+static_assert(englishNumberPart(15, 0) == EN_FIF_ && englishNumberPart(15, 1) == EN__TEEN, "fifteen");
+static_assert(englishNumberPart(40, 0) == EN_FOUR_ && englishNumberCount(40) == 2,       "forty");
+static_assert(englishNumberPart(200, 1) == EN_HUNDRED && englishNumberCount(200) == 2,   "two hundred");
+static_assert(englishNumberCount(777)  == ENGLISH_NUMBER_MAX_PARTS,                      "longest");
+static_assert(englishNumberPart(777, 5) == EN_SEVEN && englishNumberPart(777, 4) == EN__TY, "777");
+static_assert(englishNumberCount(1000) == 0,                                             "out of range");
+
+
+// The table of all numbers, filled in at compile time
+#define EN_ROW(n)       { englishNumberPart(n, 0), englishNumberPart(n, 1), englishNumberPart(n, 2), \
+                          englishNumberPart(n, 3), englishNumberPart(n, 4), englishNumberPart(n, 5) }
+#define EN_ROW10(n)     EN_ROW(n),         EN_ROW(n + 1),      EN_ROW(n + 2),      EN_ROW(n + 3),      EN_ROW(n + 4), \
+                        EN_ROW(n + 5),     EN_ROW(n + 6),      EN_ROW(n + 7),      EN_ROW(n + 8),      EN_ROW(n + 9)
+#define EN_ROW100(n)    EN_ROW10(n),       EN_ROW10(n + 10),   EN_ROW10(n + 20),   EN_ROW10(n + 30),   EN_ROW10(n + 40), \
+                        EN_ROW10(n + 50),  EN_ROW10(n + 60),   EN_ROW10(n + 70),   EN_ROW10(n + 80),   EN_ROW10(n + 90)
+
+const byte englishNumberTable [ENGLISH_NUMBER_MAX + 1][ENGLISH_NUMBER_MAX_PARTS] PROGMEM = {
+    EN_ROW100(0),   EN_ROW100(100), EN_ROW100(200), EN_ROW100(300), EN_ROW100(400),
+    EN_ROW100(500), EN_ROW100(600), EN_ROW100(700), EN_ROW100(800), EN_ROW100(900) };
+
+#undef EN_ROW
+#undef EN_ROW10
+#undef EN_ROW100
+
+
+byte englishNumber(uint16_t number, SoundSpan *spans) {
+    if (number > ENGLISH_NUMBER_MAX) return 0;
+
+    byte count = 0;
+    for (byte i = 0; i < ENGLISH_NUMBER_MAX_PARTS; i++) {
+        byte part = pgm_read_byte(&englishNumberTable[number][i]);
+        if (part == EN_NONE) break;
+        spans[count++] = readSoundSpan(&englishParts[part]);
+    }
+    return count;
+}
+
+
+const SoundSpan frenchNumberParts [NB_PARTS] PROGMEM = {
+    SOUND(Sound_C2_ZERO_NR),     SOUND(Sound_C2_UN_NR),        SOUND(Sound_C2_DEUX_NR),      SOUND(Sound_C2_TROIS_NR),
+    SOUND(Sound_C2_QUATRE_NR),   SOUND(Sound_C2_CINQ_NR),      SOUND(Sound_C2_SIX_NR),       SOUND(Sound_C2_SEPT_NR),
+    SOUND(Sound_C2_HUIT_NR),     SOUND(Sound_C2_NEUF_NR),      SOUND(Sound_C2_DIX_NR),       SOUND(Sound_C2_ONZE_NR),
+    SOUND(Sound_C2_DOUZE_NR),    SOUND(Sound_C2_TREIZE_NR),    SOUND(Sound_C2_QUATORZE_NR),  SOUND(Sound_C2_QUINZE_NR),
+    SOUND(Sound_C2_SEIZE_NR),    SOUND(Sound_C2_DIX_SEPT_NR),  SOUND(Sound_C2_DIX_HUIT),     SOUND(Sound_C2_DIX_NEUF_NR),
+    SOUND(Sound_C2_VINGT_NR),    SOUND(Sound_C2_TRENTE_NR),    SOUND(Sound_C2_QUARANTE_NR),  SOUND(Sound_C2_CINQUANTE_NR),
+    SOUND(Sound_C2_SOIXANTE_NR), SOUND(Sound_C2_QUATRE_VINGT_NR),
+    SOUND(Sound_C2_CENT_NR),     SOUND(Sound_C2_MILLE_NR),     SOUND(Sound_C2_MILLION_NR),   SOUND(Sound_C2_ET_NR),
+    SOUND(Sound_C2_ET_UN_NR),    SOUND(Sound_C3_UNE),
+    SOUND(Sound_C2_CIN_CENT_NR), SOUND(Sound_C2_SI_CENT_NR),   SOUND(Sound_C2_HUI_CENT_NR),  SOUND(Sound_C2_DI_MILLE_NR),
+    SOUND(Sound_C2_DIX_HUI_MILLE_NR), SOUND(Sound_C2_VIN_MILLE_NR) };
+
+
+static_assert(frenchBelow100Part(21, 1) == NB_ET_UN && frenchBelow100Count(21) == 2,   "vingt et un");
+static_assert(frenchBelow100Part(71, 0) == NB_SOIXANTE && frenchBelow100Part(71, 2) == NB_ONZE, "soixante et onze");
+static_assert(frenchBelow100Part(77, 1) == NB_DIX_SEPT,                                 "soixante-dix-sept");
+static_assert(frenchBelow100Part(81, 1) == NB_UN && frenchBelow100Count(80) == 1,      "quatre-vingt-un");
+static_assert(frenchBelow100Part(99, 0) == NB_QUATRE_VINGT && frenchBelow100Part(99, 1) == NB_DIX_NEUF, "99");
+static_assert(frenchBelow100Part(45, 1) == NB_CINQ && frenchBelow100Part(45, 2) == NB_NONE, "45");
+
+
+#define NB_ROW(n)       { frenchBelow100Part(n, 0), frenchBelow100Part(n, 1), frenchBelow100Part(n, 2) }
+#define NB_ROW10(n)     NB_ROW(n),         NB_ROW(n + 1),      NB_ROW(n + 2),      NB_ROW(n + 3),      NB_ROW(n + 4), \
+                        NB_ROW(n + 5),     NB_ROW(n + 6),      NB_ROW(n + 7),      NB_ROW(n + 8),      NB_ROW(n + 9)
+
+const byte frenchBelow100Table [100][FRENCH_BELOW100_MAX_PARTS] PROGMEM = {
+    NB_ROW10(0),  NB_ROW10(10), NB_ROW10(20), NB_ROW10(30), NB_ROW10(40),
+    NB_ROW10(50), NB_ROW10(60), NB_ROW10(70), NB_ROW10(80), NB_ROW10(90) };
+
+#undef NB_ROW
+#undef NB_ROW10
+
+
+static void frenchBelow100(uint16_t number, byte *parts, byte *count) {
+    for (byte i = 0; i < FRENCH_BELOW100_MAX_PARTS; i++) {
+        byte part = pgm_read_byte(&frenchBelow100Table[number][i]);
+        if (part == NB_NONE) break;
+        parts[(*count)++] = part;
+    }
+}
+
+// 1 .. 999, 'before' is the word that follows (CENT is never said with UN)
+static void frenchBelow1000(uint16_t number, byte *parts, byte *count, byte before) {
+    uint16_t hundreds = number / 100;
+    uint16_t rest     = number % 100;
+
+    if (hundreds > 0) {
+        if (hundreds > 1) {
+            parts[(*count)++] = hundreds == 5 ? (byte)NB_CIN_ : hundreds == 6 ? (byte)NB_SI_
+                              : hundreds == 8 ? (byte)NB_HUI_ : (byte)hundreds;
+        }
+        parts[(*count)++] = NB_CENT;
+    }
+    if (rest == 0) return;
+
+    if (before == NB_MILLE && (rest == 10 || rest == 18 || rest == 20)) {
+        parts[(*count)++] = rest == 10 ? (byte)NB_DI_ : rest == 18 ? (byte)NB_DIX_HUI_ : (byte)NB_VIN_;
+    } else {
+        frenchBelow100(rest, parts, count);
+    }
+}
+
+byte frenchNumber(uint32_t number, SoundSpan *spans, bool feminine) {
+    if (number > FRENCH_NUMBER_MAX) return 0;
+
+    byte        parts [FRENCH_NUMBER_MAX_PARTS];
+    byte        count     = 0;
+    uint16_t    millions  = number / 1000000UL;
+    uint16_t    thousands = (number / 1000) % 1000;
+    uint16_t    units     = number % 1000;
+
+    if (number == 0) parts[count++] = NB_ZERO;
+    if (millions > 0) {
+        frenchBelow1000(millions, parts, &count, NB_MILLION);
+        parts[count++] = NB_MILLION;
+    }
+    if (thousands > 0) {
+        if (thousands > 1) frenchBelow1000(thousands, parts, &count, NB_MILLE);
+        parts[count++] = NB_MILLE;
+    }
+    if (units > 0) frenchBelow1000(units, parts, &count, NB_NONE);
+
+    if (feminine) {
+        if (parts[count - 1] == NB_UN)    parts[count - 1] = NB_UNE;
+        if (parts[count - 1] == NB_ET_UN) { parts[count - 1] = NB_ET; parts[count++] = NB_UNE; }
+    }
+
+    for (byte i = 0; i < count; i++) spans[i] = readSoundSpan(&frenchNumberParts[parts[i]]);
+    return count;
+}
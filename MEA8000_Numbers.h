@@ -0,0 +1,142 @@
+/*
+
+    MEA8000_Numbers.h
+
+    English numbers (0 .. 999) built from the "Numbers in English" sounds,
+    and French numbers (0 .. 999 999 999) built from the numbers of catalog 2.
+
+        13 .. 19    Thir_ / Four_ / Fif_ / Six .. Nine    + _teen
+        20 .. 99    Twen_ / Thir_ / Four_ / Fif_ / Six .. Nine    + _ty  (+ One .. Nine)
+        100 .. 999  One .. Nine + Hundred  (+ And + the number below 100)
+
+    The composer functions are constexpr, so a number can be turned into its parts
+    at compile time. MEA8000_Numbers.cpp uses them to fill a table in Flash for all
+    numbers 0 .. 999, at run time a number costs a single table lookup.
+
+    French works the same way for 0 .. 99 (vingt et un, soixante et onze, quatre-vingt-dix),
+    CENT, MILLE and MILLION are put around that at run time. In front of CENT and MILLE
+    some numbers are said shorter ("cin cents", "di mille"), catalog 2 has those forms.
+
+ */
+
+#ifndef MEA8000_NUMBERS_H
+#define MEA8000_NUMBERS_H
+
+#include "MEA8000_Sounds.h"
+
+
+// The parts a number is built from, index into englishParts[]
+// (EN_ZERO .. EN_TWELVE have the value of their number)
+enum EnglishPart : byte {
+    EN_ZERO = 0, EN_ONE, EN_TWO, EN_THREE, EN_FOUR, EN_FIVE, EN_SIX, EN_SEVEN, EN_EIGHT, EN_NINE,
+    EN_TEN, EN_ELEVEN, EN_TWELVE,
+    EN_THIR_, EN_FOUR_, EN_FIF_, EN__TEEN, EN_TWEN_, EN__TY, EN_HUNDRED, EN_AND,
+    EN_PARTS,
+    EN_NONE = 0xFF
+};
+
+// "seven hundred and seventy seven" is the longest one
+#define ENGLISH_NUMBER_MAX_PARTS    6
+#define ENGLISH_NUMBER_MAX          999
+
+
+// Prefix for 13 .. 19 (teen) and for 20 .. 90 (ty)
+constexpr byte englishTeenStem(uint16_t digit) {
+    return digit == 3 ? (byte)EN_THIR_ : digit == 4 ? (byte)EN_FOUR_ : digit == 5 ? (byte)EN_FIF_ : (byte)digit;
+}
+
+constexpr byte englishTyStem(uint16_t digit) {
+    return digit == 2 ? (byte)EN_TWEN_ : englishTeenStem(digit);
+}
+
+constexpr byte englishBelow100Count(uint16_t number) {
+    return number <= 12 ? 1 : number < 20 ? 2 : number % 10 ? 3 : 2;
+}
+
+constexpr byte englishBelow100Part(uint16_t number, byte index) {
+    return number <= 12 ? (byte)number
+         : number < 20  ? (index == 0 ? englishTeenStem(number - 10) : (byte)EN__TEEN)
+         : index == 0   ? englishTyStem(number / 10)
+         : index == 1   ? (byte)EN__TY
+         :                (byte)(number % 10);
+}
+
+// Number of parts for 'number', 0 when out of range
+constexpr byte englishNumberCount(uint16_t number) {
+    return number > ENGLISH_NUMBER_MAX ? 0
+         : number < 100     ? englishBelow100Count(number)
+         : number % 100     ? 3 + englishBelow100Count(number % 100)
+         :                    2;
+}
+
+// Part 'index' of 'number', EN_NONE past the last part
+constexpr byte englishNumberPart(uint16_t number, byte index) {
+    return index >= englishNumberCount(number) ? (byte)EN_NONE
+         : number < 100     ? englishBelow100Part(number, index)
+         : index == 0       ? (byte)(number / 100)
+         : index == 1       ? (byte)EN_HUNDRED
+         : index == 2       ? (byte)EN_AND
+         :                    englishBelow100Part(number % 100, index - 3);
+}
+
+
+extern const SoundSpan  englishParts [EN_PARTS] PROGMEM;
+extern const byte       englishNumberTable [ENGLISH_NUMBER_MAX + 1][ENGLISH_NUMBER_MAX_PARTS] PROGMEM;
+
+// Fill 'spans' (room for ENGLISH_NUMBER_MAX_PARTS) with the sounds for 'number'.
+// Returns the number of spans, 0 if the number is out of range.
+byte englishNumber(uint16_t number, SoundSpan *spans);
+
+
+
+// The parts of a French number, index into frenchNumberParts[]
+// (NB_ZERO .. NB_DIX_NEUF have the value of their number)
+enum FrenchNumberPart : byte {
+    NB_ZERO = 0, NB_UN, NB_DEUX, NB_TROIS, NB_QUATRE, NB_CINQ, NB_SIX, NB_SEPT, NB_HUIT, NB_NEUF,
+    NB_DIX, NB_ONZE, NB_DOUZE, NB_TREIZE, NB_QUATORZE, NB_QUINZE, NB_SEIZE, NB_DIX_SEPT, NB_DIX_HUIT, NB_DIX_NEUF,
+    NB_VINGT, NB_TRENTE, NB_QUARANTE, NB_CINQUANTE, NB_SOIXANTE, NB_QUATRE_VINGT,
+    NB_CENT, NB_MILLE, NB_MILLION, NB_ET, NB_ET_UN, NB_UNE,
+    NB_CIN_, NB_SI_, NB_HUI_, NB_DI_, NB_DIX_HUI_, NB_VIN_,        // short forms in front of CENT / MILLE
+    NB_PARTS,
+    NB_NONE = 0xFF
+};
+
+#define FRENCH_BELOW100_MAX_PARTS   3           // soixante et onze
+#define FRENCH_NUMBER_MAX_PARTS     18
+#define FRENCH_NUMBER_MAX           999999999UL
+
+
+// 70 .. 79 are soixante + 10 .. 19, 80 .. 99 are quatre-vingt + 0 .. 19
+constexpr byte frenchTens(uint16_t tens) {
+    return tens >= 8 ? (byte)NB_QUATRE_VINGT : tens == 7 ? (byte)NB_SOIXANTE : (byte)(NB_VINGT + tens - 2);
+}
+
+constexpr byte frenchBelow100Count(uint16_t number) {
+    return number < 20  ? 1
+         : number < 70  ? (number % 10 ? 2 : 1)
+         : number < 80  ? (number == 71 ? 3 : 2)
+         :                (number == 80 ? 1 : 2);
+}
+
+// Part 'index' of 0 .. 99, NB_NONE past the last part
+constexpr byte frenchBelow100Part(uint16_t number, byte index) {
+    return index >= frenchBelow100Count(number) ? (byte)NB_NONE
+         : number < 20  ? (byte)number
+         : index == 0   ? frenchTens(number / 10)
+         : number == 71 ? (index == 1 ? (byte)NB_ET : (byte)NB_ONZE)
+         : number >= 70 && number < 80 ? (byte)(number - 60)
+         : number >= 80 ? (byte)(number - 80)
+         : number % 10 == 1 ? (byte)NB_ET_UN
+         :                (byte)(number % 10);
+}
+
+
+extern const SoundSpan  frenchNumberParts [NB_PARTS] PROGMEM;
+extern const byte       frenchBelow100Table [100][FRENCH_BELOW100_MAX_PARTS] PROGMEM;
+
+// Fill 'spans' (room for FRENCH_NUMBER_MAX_PARTS) with the sounds for 'number',
+// 'feminine' for une heure, vingt et une minutes.
+// Returns the number of spans, 0 if the number is out of range.
+byte frenchNumber(uint32_t number, SoundSpan *spans, bool feminine = false);
+
+#endif
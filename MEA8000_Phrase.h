@@ -0,0 +1,181 @@
+/*
+
+    MEA8000_Phrase.h
+
+    Compile time joining of sounds into one array ("fused" phrases).
+
+    A fixed prompt like BONJOUR + ANNIVERSAIRE is built by the compiler into a single
+    array in Flash, so it is played with one pointer like any other sound:
+
+        MEA8000_PHRASE(Phrase_BONJOUR_ANNIVERSAIRE, Sound_C2_BONJOUR, Sound_C2_ANNIVERSAIRE);
+
+    While joining:
+    - The header of the first sound (if any) is kept, with the new length.
+      The headers of the other sounds are dropped.
+    - At every seam the silent frames at the end of the left sound and at the start
+      of the right sound are dropped (a sound that is all silence is kept as it is).
+    - The pitch is carried over the seam: the first frame of a right sound with a
+      header gets its PI corrected, so the pitch moves from where the left sound ended
+      to where the right sound wants to be (as far as -15 .. +15 Hz per 8 ms allows).
+
+    The builder has to read the sound data, so it only works in a file that has the
+    definitions of the arrays (see MEA8000_Phrases.cpp), not only the declarations.
+    Everything here is C++11 constexpr, nothing of it runs on the Arduino.
+
+ */
+
+#ifndef MEA8000_PHRASE_H
+#define MEA8000_PHRASE_H
+
+#include "MEA8000_Sounds.h"
+#include "MEA8000_Frame.h"
+
+
+template <unsigned N> struct PhraseBytes {
+    byte data [N];
+};
+
+
+// -- one sound (part) of a phrase --------------------------------------------------
+
+template <unsigned N> constexpr unsigned phraseHeaderSize(const byte (&part)[N]) {
+    return N >= MEA8000_HEADER_SIZE && isSoundHeader(part[0], part[2], part[3]) ? MEA8000_HEADER_SIZE : 0;
+}
+
+template <unsigned N> constexpr unsigned phraseSkipSilence(const byte (&part)[N], unsigned position) {
+    return position + MEA8000_FRAME_SIZE <= N && frameIsSilent(part + position)
+           ? phraseSkipSilence(part, position + MEA8000_FRAME_SIZE) : position;
+}
+
+template <unsigned N> constexpr unsigned phraseTrimSilence(const byte (&part)[N], unsigned begin, unsigned end) {
+    return end >= begin + MEA8000_FRAME_SIZE && frameIsSilent(part + end - MEA8000_FRAME_SIZE)
+           ? phraseTrimSilence(part, begin, end - MEA8000_FRAME_SIZE) : end;
+}
+
+// First byte of the part that is used (the first part keeps its lead-in)
+template <unsigned N> constexpr unsigned phraseBegin(const byte (&part)[N], bool first) {
+    return first || phraseSkipSilence(part, phraseHeaderSize(part)) >= N
+           ? phraseHeaderSize(part) : phraseSkipSilence(part, phraseHeaderSize(part));
+}
+
+// One past the last byte of the part that is used (the last part keeps its lead-out)
+template <unsigned N> constexpr unsigned phraseEnd(const byte (&part)[N], bool last) {
+    return last || phraseTrimSilence(part, phraseHeaderSize(part), N) <= phraseHeaderSize(part)
+           ? N : phraseTrimSilence(part, phraseHeaderSize(part), N);
+}
+
+template <unsigned N> constexpr unsigned phrasePartLength(const byte (&part)[N], bool first, bool last) {
+    return phraseEnd(part, last) - phraseBegin(part, first);
+}
+
+// Pitch (Hz) at the start of the frame at 'position', following the part's own PI
+// values from its header pitch. Only for parts with a header.
+template <unsigned N> constexpr int phrasePitchAt(const byte (&part)[N], unsigned position) {
+    return position <= MEA8000_HEADER_SIZE
+           ? 2 * part[2]
+           : phrasePitchAt(part, position - MEA8000_FRAME_SIZE)
+             + pitchIncrement(framePI(part + position - MEA8000_FRAME_SIZE)) * frameSteps(part + position - MEA8000_FRAME_SIZE);
+}
+
+template <unsigned N> constexpr int phrasePitchSum(const byte (&part)[N], unsigned position, unsigned end) {
+    return position + MEA8000_FRAME_SIZE > end ? 0
+         : pitchIncrement(framePI(part + position)) * frameSteps(part + position)
+           + phrasePitchSum(part, position + MEA8000_FRAME_SIZE, end);
+}
+
+// Pitch (Hz) at the end of the part, -1 when not known
+template <unsigned N> constexpr int phrasePitchAfter(const byte (&part)[N], bool last, int pitch) {
+    return phraseHeaderSize(part) ? phrasePitchAt(part, phraseEnd(part, last))
+         : pitch < 0              ? -1
+         :                          pitch + phrasePitchSum(part, phraseHeaderSize(part), phraseEnd(part, last));
+}
+
+// The PI byte of the first used frame of a right part, corrected to carry the pitch
+template <unsigned N> constexpr byte phraseSeamByte(const byte (&part)[N], unsigned position, int pitch) {
+    return framePI(part + position - 3) == MEA8000_PI_NOISE
+           ? part[position]
+           : (byte)((part[position] & 0xE0) |
+                    pitchIncrementCode((phrasePitchAt(part, position + 1) - pitch) / frameSteps(part + position - 3)));
+}
+
+template <unsigned N> constexpr byte phrasePartByte(const byte (&part)[N], unsigned index, bool first, int pitch) {
+    return !first && index == 3 && pitch >= 0 && phraseHeaderSize(part)
+           ? phraseSeamByte(part, phraseBegin(part, first) + index, pitch)
+           : part[phraseBegin(part, first) + index];
+}
+
+
+// -- all parts ---------------------------------------------------------------------
+
+constexpr unsigned phraseSum(bool) { return 0; }
+
+template <unsigned N, typename... Rest> constexpr unsigned phraseSum(bool first, const byte (&part)[N], const Rest &... rest) {
+    return phrasePartLength(part, first, sizeof...(Rest) == 0) + phraseSum(false, rest...);
+}
+
+// Total length in bytes of the fused phrase
+template <unsigned N, typename... Rest> constexpr unsigned phraseLength(const byte (&part)[N], const Rest &... rest) {
+    return phraseHeaderSize(part) + phraseSum(true, part, rest...);
+}
+
+constexpr byte phraseByte(unsigned, bool, int) { return 0; }
+
+// Byte 'index' of the frames of the phrase, 'pitch' is the pitch at the start of 'part'
+template <unsigned N, typename... Rest>
+constexpr byte phraseByte(unsigned index, bool first, int pitch, const byte (&part)[N], const Rest &... rest) {
+    return index < phrasePartLength(part, first, sizeof...(Rest) == 0)
+           ? phrasePartByte(part, index, first, pitch)
+           : phraseByte(index - phrasePartLength(part, first, sizeof...(Rest) == 0), false,
+                        phrasePitchAfter(part, sizeof...(Rest) == 0, pitch), rest...);
+}
+
+// Byte 'index' of the phrase, header included
+template <unsigned N, typename... Rest>
+constexpr byte phraseFusedByte(unsigned index, unsigned length, const byte (&part)[N], const Rest &... rest) {
+    return index >= phraseHeaderSize(part) ? phraseByte(index - phraseHeaderSize(part), true,
+                                                        phraseHeaderSize(part) ? 2 * part[2] : -1, part, rest...)
+         : index == 0 ? (byte)(length >> 8)
+         : index == 1 ? (byte)(length & 0xFF)
+         :              part[index];
+}
+
+
+// -- 0 .. N-1 as a template parameter pack (log depth, phrases can be long) ----------
+
+template <unsigned... I> struct PhraseIndices {};
+
+template <class Low, class High> struct PhraseIndicesJoin;
+template <unsigned... I, unsigned... J> struct PhraseIndicesJoin<PhraseIndices<I...>, PhraseIndices<J...> > {
+    typedef PhraseIndices<I..., (sizeof...(I) + J)...> type;
+};
+
+template <unsigned N> struct PhraseIndicesOf {
+    typedef typename PhraseIndicesJoin<typename PhraseIndicesOf<N / 2>::type,
+                                       typename PhraseIndicesOf<N - N / 2>::type>::type type;
+};
+template <> struct PhraseIndicesOf<0> { typedef PhraseIndices<>  type; };
+template <> struct PhraseIndicesOf<1> { typedef PhraseIndices<0> type; };
+
+
+template <unsigned L, unsigned... I, typename... Parts>
+constexpr PhraseBytes<L> phraseFuse(PhraseIndices<I...>, const Parts &... parts) {
+    return PhraseBytes<L> { { phraseFusedByte(I, L, parts...)... } };
+}
+
+template <unsigned L, typename... Parts>
+constexpr PhraseBytes<L> phraseFuse(const Parts &... parts) {
+    return phraseFuse<L>(typename PhraseIndicesOf<L>::type(), parts...);
+}
+
+
+// Define the fused phrase 'name' (a SoundSpan, declare it in a header as
+// "extern const SoundSpan name;") from the sounds that follow. The sounds are
+// taken from the namespace PhraseSource, where the definitions were included.
+#define MEA8000_PHRASE(name, ...)                                                               \
+    namespace PhraseSource {                                                                    \
+        static constexpr PhraseBytes<phraseLength(__VA_ARGS__)> name##_data PROGMEM =           \
+            phraseFuse<phraseLength(__VA_ARGS__)>(__VA_ARGS__);                                 \
+    }                                                                                           \
+    const SoundSpan name = { PhraseSource::name##_data.data, sizeof(PhraseSource::name##_data.data) }
+
+#endif
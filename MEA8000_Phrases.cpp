@@ -0,0 +1,28 @@
+/*
+
+    MEA8000_Phrases.cpp
+
+    Fixed prompts, see MEA8000_Phrases.h
+
+ */
+
+#include "MEA8000_Phrases.h"
+#include "MEA8000_Phrase.h"
+
+
+// The phrase builder reads the sound data at compile time, so this file needs the
+// definitions of the arrays (only catalog 2 is used). They are included a second time
+// in a namespace of their own; only the fused phrases end up in the program (with
+// optimisation on, as the Arduino IDE always compiles), the copies are never referenced
+// at run time.
+namespace PhraseSource {
+#include "MEA8000_SoundsCatalog2.cpp"
+}
+
+
+MEA8000_PHRASE(Phrase_BONJOUR_ANNIVERSAIRE, Sound_C2_BONJOUR,   Sound_C2_ANNIVERSAIRE);
+MEA8000_PHRASE(Phrase_BONJOUR_MADAME,       Sound_C2_BONJOUR,   Sound_C2_MADAME);
+MEA8000_PHRASE(Phrase_BONJOUR_MONSIEUR,     Sound_C2_BONJOUR,   Sound_C2_MONSIEUR);
+MEA8000_PHRASE(Phrase_C_EST_BIEN,           Sound_C2_C_EST,     Sound_C2_BIEN);
+MEA8000_PHRASE(Phrase_C_EST_EXACTE,         Sound_C2_C_EST,     Sound_C2_EXACTE);
+MEA8000_PHRASE(Phrase_C_EST_INEXACTE,       Sound_C2_C_EST,     Sound_C2_INEXACTE);
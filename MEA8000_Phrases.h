@@ -0,0 +1,23 @@
+/*
+
+    MEA8000_Phrases.h
+
+    Fixed prompts, each fused at compile time into a single sound (see MEA8000_Phrase.h).
+    Play them like any other sound, e.g. SoundStream stream(&Phrase_C_EST_BIEN, 1);
+
+ */
+
+#ifndef MEA8000_PHRASES_H
+#define MEA8000_PHRASES_H
+
+#include "MEA8000_Sounds.h"
+
+
+extern const SoundSpan Phrase_BONJOUR_ANNIVERSAIRE;
+extern const SoundSpan Phrase_BONJOUR_MADAME;
+extern const SoundSpan Phrase_BONJOUR_MONSIEUR;
+extern const SoundSpan Phrase_C_EST_BIEN;
+extern const SoundSpan Phrase_C_EST_EXACTE;
+extern const SoundSpan Phrase_C_EST_INEXACTE;
+
+#endif
@@ -0,0 +1,40 @@
+/*
+
+    MEA8000_Platform.h
+
+    The few Arduino definitions the sound data and the code around it depends on.
+    On an Arduino they come from <Arduino.h> and <avr/pgmspace.h>, on a host (Linux)
+    they are replaced by plain RAM versions, so the same files can also be compiled
+    and checked on a PC.
+
+ */
+
+#ifndef MEA8000_PLATFORM_H
+#define MEA8000_PLATFORM_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+#else
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t byte;
+
+// On a host there is only one address space, Flash reads are plain reads.
+#define PROGMEM
+#define pgm_read_byte(address)      (*(const uint8_t *)(address))
+#define pgm_read_word(address)      (*(const uint16_t *)(address))
+#define pgm_read_ptr(address)       (*(const void * const *)(address))
+#define memcpy_P(dest, src, size)   memcpy((dest), (src), (size))
+
+// No interrupts on a host: a simulated interrupt never runs in the middle of the main loop.
+#define noInterrupts()
+#define interrupts()
+
+#endif
+
+#endif
@@ -0,0 +1,103 @@
+/*
+
+    MEA8000_Prosody.cpp
+
+    Intonation and speaking rate, see MEA8000_Prosody.h
+
+ */
+
+#include "MEA8000_Prosody.h"
+
+
+const ProsodyPoint prosodyContours [PROSODY_CONTOURS][PROSODY_POINTS] PROGMEM = {
+    { {   0,   0 }, {  85,   0 }, { 170,   0 }, { 255,   0 } },     // PROSODY_FLAT
+    { {   0,   0 }, {  64,   6 }, { 200,  -4 }, { 255, -24 } },     // PROSODY_STATEMENT
+    { {   0,   0 }, { 128,  -4 }, { 192,   0 }, { 255,  50 } },     // PROSODY_QUESTION
+    { {   0,   0 }, {  48,  30 }, { 160,  10 }, { 255, -20 } },     // PROSODY_EXCLAMATION
+};
+
+int prosodyPitch(byte contour, byte position) {
+    const ProsodyPoint *points = prosodyContours[contour < PROSODY_CONTOURS ? contour : (byte)PROSODY_FLAT];
+    byte                from   = 0;
+    int                 pitch  = 0;
+
+    for (byte i = 0; i < PROSODY_POINTS; i++) {
+        byte    to      = pgm_read_byte(&points[i].position);
+        int     toPitch = (int8_t)pgm_read_byte(&points[i].pitch);
+
+        if (position <= to) {
+            if (to == from) return toPitch;
+            return pitch + (toPitch - pitch) * (position - from) / (to - from);
+        }
+        from  = to;
+        pitch = toPitch;
+    }
+    return pitch;
+}
+
+uint16_t prosodySteps(const SoundSpan *spans, byte count) {
+    SoundStream stream(spans, count);
+    byte        frame [MEA8000_FRAME_SIZE];
+    uint16_t    steps = 0;
+
+    while (stream.nextFrame(frame)) steps += frameSteps(frame);
+    return steps;
+}
+
+
+ProsodyStream::ProsodyStream() {
+    begin(NULL, 0);
+}
+
+ProsodyStream::ProsodyStream(FrameSource *source, uint16_t steps, byte contour, byte rate) {
+    begin(source, steps, contour, rate);
+}
+
+void ProsodyStream::begin(FrameSource *source, uint16_t steps, byte contour, byte rate) {
+    this->source  = source;
+    this->steps   = steps;
+    this->contour = contour;
+    this->rate    = rate < PROSODY_RATE_MIN ? PROSODY_RATE_MIN : rate > PROSODY_RATE_MAX ? PROSODY_RATE_MAX : rate;
+    done          = 0;
+    owed          = 0;
+    sourcePitch   = 0;
+    outPitch      = 0;
+}
+
+bool ProsodyStream::nextFrame(byte *frame) {
+    // Read frames until there is time for one step; at a high rate some are dropped,
+    // at a low rate the current one is sent again (the chip holds its values)
+    while (owed < rate) {
+        if (!source || !source->nextFrame(current)) {
+            // The source has ended: the time left over (less than a step) is sent as
+            // one more step of the last frame when it is half a step or more
+            if (owed * 2 < rate) return false;
+            owed = rate;
+            break;
+        }
+
+        byte frameTime = frameSteps(current);
+        owed        += frameTime * 100;
+        done        += frameTime;
+        sourcePitch += pitchIncrement(framePI(current)) * frameTime;
+    }
+
+    byte fd = 3;
+    while (fd > 0 && (uint16_t)(rate << fd) > owed) fd--;
+    byte sent = 1 << fd;
+    owed -= rate * sent;
+
+    memcpy(frame, current, MEA8000_FRAME_SIZE);
+    setFrameFD(frame, fd);
+
+    if (framePI(current) != MEA8000_PI_NOISE) {
+        byte position = steps == 0 ? 0 : done >= steps ? 255 : (byte)((uint32_t)done * 255 / steps);
+        int  change   = sourcePitch + prosodyPitch(contour, position) - outPitch;
+        int  pi       = (change >= 0 ? change + sent / 2 : change - sent / 2) / sent;
+
+        byte code = pitchIncrementCode(pi);
+        setFramePI(frame, code);
+        outPitch += pitchIncrement(code) * sent;
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+
+    MEA8000_Prosody.h
+
+    Intonation and speaking rate, applied while the frames are streamed.
+
+    ProsodyStream reads the frames of any FrameSource and rewrites two fields:
+    - FD (frame duration) for the speaking rate: 150 is one and a half times as fast.
+      Frames are made shorter or longer (8 .. 64 ms), dropped or sent twice, the time
+      that does not fit is carried over to the next frame, so the total comes out right
+      (what is left at the end is one more step when it is half a step or more).
+    - PI (pitch increment) for a contour over the whole sentence, e.g. the rise at the
+      end of a question. The pitch of the sound itself is kept on top of the contour.
+    Noise frames (PI 16) are left as they are. Nothing is changed in Flash.
+
+    The contour needs the length of the sentence, prosodySteps() gives it for a list of
+    sounds (glides added by JoinStream are not counted, it does not have to be exact).
+
+ */
+
+#ifndef MEA8000_PROSODY_H
+#define MEA8000_PROSODY_H
+
+#include "MEA8000_Stream.h"
+
+
+enum ProsodyContour : byte {
+    PROSODY_FLAT = 0,           // the pitch of the sounds only
+    PROSODY_STATEMENT,          // slowly down, falling at the end
+    PROSODY_QUESTION,           // rising at the end
+    PROSODY_EXCLAMATION,        // high at the start
+    PROSODY_CONTOURS
+};
+
+#define PROSODY_POINTS          4
+
+#define PROSODY_RATE_NORMAL     100     // rate in %
+#define PROSODY_RATE_MIN        50
+#define PROSODY_RATE_MAX        250
+
+
+// A point of a contour: the pitch (Hz, from the start pitch) at 'position' (0 .. 255 = whole sentence)
+struct ProsodyPoint {
+    byte    position;
+    int8_t  pitch;
+};
+
+extern const ProsodyPoint prosodyContours [PROSODY_CONTOURS][PROSODY_POINTS] PROGMEM;
+
+// Pitch of 'contour' at 'position' (0 .. 255), in Hz from the start pitch
+int prosodyPitch(byte contour, byte position);
+
+// Length of a list of sounds in 8 ms steps
+uint16_t prosodySteps(const SoundSpan *spans, byte count);
+
+
+class ProsodyStream : public FrameSource {
+public:
+    ProsodyStream();
+    ProsodyStream(FrameSource *source, uint16_t steps, byte contour = PROSODY_FLAT, byte rate = PROSODY_RATE_NORMAL);
+
+    // 'steps' is the length of what 'source' gives (see prosodySteps), 'rate' in %
+    void begin(FrameSource *source, uint16_t steps, byte contour = PROSODY_FLAT, byte rate = PROSODY_RATE_NORMAL);
+    bool nextFrame(byte *frame);
+
+private:
+    FrameSource *source;
+    uint16_t    steps;
+    uint16_t    done;           // steps read from the source
+    uint16_t    owed;           // time still to send of the frames read, in 1/100 step
+    int         sourcePitch;    // pitch at the end of the frames read, Hz from the start
+    int         outPitch;       // pitch at the end of the frames sent
+    byte        contour;
+    byte        rate;
+    byte        current [MEA8000_FRAME_SIZE];
+};
+
+#endif
@@ -0,0 +1,137 @@
+/*
+
+    MEA8000_SoftSynth.cpp
+
+    The MEA8000 in software, see MEA8000_SoftSynth.h
+
+ */
+
+#include "MEA8000_SoftSynth.h"
+
+
+#define PULSE_PERIOD    ((uint32_t)MEA8000_SAMPLE_RATE * 64)   // 'phase' at which a pulse is due
+#define MIN_PITCH       (16 * 64)
+
+#ifdef SOFTSYNTH_COUNT_CYCLES
+uint32_t softSynthCycles = 0;
+#endif
+
+
+SoftSynth::SoftSynth() {
+    begin(NULL);
+}
+
+void SoftSynth::begin(FrameSource *source, byte pitch, byte volume) {
+    // The values before the first frame, as in host/MEA8000_Render.cpp
+    static const byte rows [4] = { 19, SOFTSYNTH_ROW_FM2 + 21, SOFTSYNTH_ROW_FM3 + 5, SOFTSYNTH_ROW_FM4 };
+
+    this->source = source;
+    this->volume = volume;
+    for (byte i = 0; i < 4; i++) {
+        bTo[i] = b[i] = (int16_t)pgm_read_word(&softResonators[rows[i]][0].b);
+        cTo[i] = c[i] = (int16_t)pgm_read_word(&softResonators[rows[i]][0].c);
+        y1[i] = y2[i] = 0;
+    }
+    ampl      = amplTo = 0;
+    this->pitch = pitch * 2 * 64;
+    increment = 0;
+    phase     = 0;
+    noise     = 1;
+    left      = 0;
+    done      = source == NULL;
+}
+
+void SoftSynth::startFrame() {
+    byte frame [MEA8000_FRAME_SIZE];
+
+    SOFTSYNTH_COST(45);                     // FramePrefetch::nextFrame: the call, 4 bytes from RAM
+    if (!source->nextFrame(frame)) {
+        done = true;
+        return;
+    }
+    SOFTSYNTH_COST(250);
+
+    byte shift = 3 + frameFD(frame);                        // blocks in the frame: 1 << shift
+    byte rows [4] = { frameFM1(frame), (byte)(SOFTSYNTH_ROW_FM2 + frameFM2(frame)),
+                      (byte)(SOFTSYNTH_ROW_FM3 + frameFM3(frame)), SOFTSYNTH_ROW_FM4 };
+    byte bws [4]  = { frameBW1(frame), frameBW2(frame), frameBW3(frame), frameBW4(frame) };
+
+    for (byte i = 0; i < 4; i++) {
+        b[i]     = bTo[i];
+        c[i]     = cTo[i];
+        bTo[i]   = (int16_t)pgm_read_word(&softResonators[rows[i]][bws[i]].b);
+        cTo[i]   = (int16_t)pgm_read_word(&softResonators[rows[i]][bws[i]].c);
+        bStep[i] = (int16_t)(bTo[i] - b[i]) >> shift;
+        cStep[i] = (int16_t)(cTo[i] - c[i]) >> shift;
+    }
+    ampl      = amplTo;
+    amplTo    = (int16_t)(((uint32_t)pgm_read_word(&frameAMPLScale[frameAMPL(frame)]) * 4096 + 500) / 1000);
+    amplStep  = (int16_t)(amplTo - ampl) >> shift;
+    voiced    = framePI(frame) != MEA8000_PI_NOISE;
+    increment = voiced ? pitchIncrement(framePI(frame)) : 0;
+    left      = MEA8000_STEP_SAMPLES << frameFD(frame);
+    blockLeft = 0;
+}
+
+int16_t SoftSynth::nextValue() {
+    if (done) return 0;
+    if (left == 0) {
+        startFrame();
+        if (done) return 0;
+    }
+    SOFTSYNTH_COST(60);
+
+    // A straight line to the values of the frame, the last block ends on them
+    if (blockLeft == 0) {
+        bool last = left <= SOFTSYNTH_BLOCK;
+        for (byte i = 0; i < 4; i++) {
+            b[i] = last ? bTo[i] : b[i] + bStep[i];
+            c[i] = last ? cTo[i] : c[i] + cStep[i];
+            a[i] = (int16_t)((1 << SOFTSYNTH_COEF_BITS) - b[i] - c[i]);
+        }
+        ampl      = last ? amplTo : ampl + amplStep;
+        blockLeft = SOFTSYNTH_BLOCK;
+        SOFTSYNTH_COST(70);
+    }
+    blockLeft--;
+    left--;
+
+    int16_t x = 0;
+    if (voiced) {
+        phase += pitch > MIN_PITCH ? pitch : MIN_PITCH;
+        if (phase >= PULSE_PERIOD) {
+            phase -= PULSE_PERIOD;
+            // ampl * sqrt(period), in 1/64
+            x = (int16_t)(((int32_t)ampl * pgm_read_byte(&softPulseGain[(pitch >> 9) & 0x7F])) >> 9);
+            SOFTSYNTH_COST(40);
+        }
+        pitch += increment;
+        SOFTSYNTH_COST(20);
+    } else {
+        noise ^= noise << 7;
+        noise ^= noise >> 9;
+        noise ^= noise << 8;
+        // ampl * 1.73 * (-1 .. 1), in 1/64: 1/4096 * 1/32768 * 64 * 1.73 is about 1/1211000
+        int32_t value = ((int32_t)ampl * (int16_t)noise) >> 20;
+        x = (int16_t)(value - (value >> 3));
+        SOFTSYNTH_COST(50);
+    }
+
+    for (byte i = 0; i < 4; i++) {
+        // Rounded: with a plain shift the error would build up in the filter to an offset
+        int32_t sum = (int32_t)a[i] * x + (int32_t)b[i] * y1[i] + (int32_t)c[i] * y2[i] + (1 << (SOFTSYNTH_COEF_BITS - 1));
+        sum >>= SOFTSYNTH_COEF_BITS;
+        int16_t y = sum > 32767 ? 32767 : sum < -32768 ? -32768 : (int16_t)sum;
+        y2[i] = y1[i];
+        y1[i] = y;
+        x     = y;
+    }
+    SOFTSYNTH_COST(4 * 80);
+    return x;
+}
+
+byte SoftSynth::nextSample() {
+    int16_t value = (int16_t)(((int32_t)nextValue() * volume) >> 13);
+    SOFTSYNTH_COST(25);
+    return value > 127 ? 255 : value < -128 ? 0 : (byte)(SOFTSYNTH_SILENCE + value);
+}
@@ -0,0 +1,110 @@
+/*
+
+    MEA8000_SoftSynth.h
+
+    The MEA8000 in software, for boards without the chip: integers only, one sample at a
+    time, fast enough to be called from a timer interrupt at 8 kHz on an ATmega.
+
+        SoundStream     stream(spans, count);
+        FramePrefetch   prefetch(&stream);
+        SoftSynth       synth;
+        prefetch.fill();
+        synth.begin(&prefetch);
+
+        ISR(TIMER1_COMPA_vect) { OCR2A = synth.nextSample(); }      // 8 kHz, 8 bit PWM
+        void loop() { prefetch.fill(); ... }
+
+    It is the model of host/MEA8000_Render.cpp in fixed point: a pulse train (or noise for
+    PI 16) through 4 formant filters in a row, with the filter coefficients and the
+    amplitude going in a straight line from one frame to the next (updated every 8
+    samples). The coefficients come from tables in Flash (MEA8000_SoftSynthTables.cpp,
+    made by tools/MEA8000_MakeSynthTables.cpp), a sample costs 12 multiplications of
+    16 x 16 bits and no division.
+
+    In the interrupt the frames must come from a FramePrefetch (MEA8000_Flash.h) that the
+    main loop fills, as for the chip driver: then a new frame is 4 bytes from RAM. The
+    reads from Flash and the work of the streams (prosody, voices, loudness) per frame
+    are done by fill, so put the streams in front of the prefetch. When fill comes too
+    late the prefetch has no frame and the sound ends, as the chip cuts a word.
+
+    Values: filter states are signed 16 bit, 64 is 1.0 of the host renderer (the loudest
+    sounds of the catalog reach about 143). Coefficients are in 1/8192, the amplitude in
+    1/4096, the pitch in 1/64 Hz (so PI is added to it every sample).
+
+    Cycles: built with SOFTSYNTH_COUNT_CYCLES (on the host) every part adds a fixed estimate
+    of its ATmega cost to softSynthCycles, the frame from the FramePrefetch included, see
+    tools/MEA8000_SoftSynthCheck.cpp. A sample costs the sum of the parts it goes through,
+    so the worst one is known from the estimates. A source other than a FramePrefetch is
+    not counted. At 16 MHz there are 2000 cycles for a sample.
+
+ */
+
+#ifndef MEA8000_SOFTSYNTH_H
+#define MEA8000_SOFTSYNTH_H
+
+#include "MEA8000_Flash.h"
+#include "MEA8000_Tables.h"
+
+
+#define SOFTSYNTH_COEF_BITS     13
+#define SOFTSYNTH_BLOCK         8       // samples between coefficient updates
+#define SOFTSYNTH_ROWS          73      // FM1 (32), FM2 (32), FM3 (8), FM4 (1)
+#define SOFTSYNTH_ROW_FM2       32
+#define SOFTSYNTH_ROW_FM3       64
+#define SOFTSYNTH_ROW_FM4       72
+#define SOFTSYNTH_VOLUME        64      // 64: the loudest sounds reach about 72 of 127
+#define SOFTSYNTH_SILENCE       128     // the PWM value of 0
+
+
+struct SoftResonator {
+    int16_t b;
+    int16_t c;
+};
+
+extern const SoftResonator  softResonators [SOFTSYNTH_ROWS][4] PROGMEM;     // [row][bandwidth]
+extern const byte           softPulseGain [128] PROGMEM;                    // [pitch / 8 Hz]
+
+#ifdef SOFTSYNTH_COUNT_CYCLES
+extern uint32_t softSynthCycles;
+#define SOFTSYNTH_COST(cycles)      (softSynthCycles += (cycles))
+#else
+#define SOFTSYNTH_COST(cycles)
+#endif
+
+
+class SoftSynth {
+public:
+    SoftSynth();
+
+    // 'pitch' is the start pitch (Hz / 2, the header byte), 'volume' the output level (see SOFTSYNTH_VOLUME)
+    void begin(FrameSource *source, byte pitch = MEA8000_DEFAULT_PITCH, byte volume = SOFTSYNTH_VOLUME);
+
+    // The next sample for an 8 bit PWM (128 is 0), 128 after the last frame
+    byte    nextSample();
+
+    // The next sample as it comes out of the filters (64 is 1.0), 0 after the last frame
+    int16_t nextValue();
+
+    bool    isDone() const  { return done; }
+
+private:
+    void    startFrame();
+
+    FrameSource *source;
+    int16_t     b [4], c [4], a [4];        // current coefficients
+    int16_t     bStep [4], cStep [4];       // change per block
+    int16_t     bTo [4], cTo [4];           // at the end of the frame
+    int16_t     y1 [4], y2 [4];
+    int16_t     ampl, amplStep, amplTo;
+    int16_t     pitch;                      // 1/64 Hz
+    int8_t      increment;                  // PI, added to 'pitch' every sample
+    uint32_t    phase;                      // sum of the pitch since the last pulse
+    uint16_t    noise;
+    uint16_t    left;                       // samples left in the frame
+    byte        blockLeft;
+    byte        volume;
+    bool        voiced;
+    bool        done;
+};
+
+#endif
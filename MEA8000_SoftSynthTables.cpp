@@ -0,0 +1,97 @@
+/*
+
+    MEA8000_SoftSynthTables.cpp
+
+    Generated by tools/MEA8000_MakeSynthTables.cpp, do not edit.
+
+ */
+
+#include "MEA8000_SoftSynth.h"
+
+
+const SoftResonator softResonators [SOFTSYNTH_ROWS][4] PROGMEM = {
+    { {  12234,  -4632 }, {  14411,  -6427 }, {  15491,  -7426 }, {  15954,  -7877 } },     //  150 Hz
+    { {  12220,  -4632 }, {  14394,  -6427 }, {  15473,  -7426 }, {  15936,  -7877 } },     //  162 Hz
+    { {  12205,  -4632 }, {  14376,  -6427 }, {  15454,  -7426 }, {  15916,  -7877 } },     //  174 Hz
+    { {  12186,  -4632 }, {  14354,  -6427 }, {  15429,  -7426 }, {  15891,  -7877 } },     //  188 Hz
+    { {  12165,  -4632 }, {  14330,  -6427 }, {  15403,  -7426 }, {  15864,  -7877 } },     //  202 Hz
+    { {  12141,  -4632 }, {  14302,  -6427 }, {  15373,  -7426 }, {  15833,  -7877 } },     //  217 Hz
+    { {  12114,  -4632 }, {  14269,  -6427 }, {  15339,  -7426 }, {  15797,  -7877 } },     //  233 Hz
+    { {  12083,  -4632 }, {  14233,  -6427 }, {  15299,  -7426 }, {  15757,  -7877 } },     //  250 Hz
+    { {  12050,  -4632 }, {  14194,  -6427 }, {  15257,  -7426 }, {  15713,  -7877 } },     //  267 Hz
+    { {  12010,  -4632 }, {  14147,  -6427 }, {  15207,  -7426 }, {  15662,  -7877 } },     //  286 Hz
+    { {  11968,  -4632 }, {  14097,  -6427 }, {  15154,  -7426 }, {  15607,  -7877 } },     //  305 Hz
+    { {  11921,  -4632 }, {  14042,  -6427 }, {  15094,  -7426 }, {  15545,  -7877 } },     //  325 Hz
+    { {  11868,  -4632 }, {  13979,  -6427 }, {  15027,  -7426 }, {  15476,  -7877 } },     //  346 Hz
+    { {  11809,  -4632 }, {  13910,  -6427 }, {  14952,  -7426 }, {  15399,  -7877 } },     //  368 Hz
+    { {  11743,  -4632 }, {  13833,  -6427 }, {  14869,  -7426 }, {  15314,  -7877 } },     //  391 Hz
+    { {  11671,  -4632 }, {  13748,  -6427 }, {  14778,  -7426 }, {  15220,  -7877 } },     //  415 Hz
+    { {  11591,  -4632 }, {  13654,  -6427 }, {  14677,  -7426 }, {  15116,  -7877 } },     //  440 Hz
+    { {  11504,  -4632 }, {  13551,  -6427 }, {  14566,  -7426 }, {  15001,  -7877 } },     //  466 Hz
+    { {  11404,  -4632 }, {  13433,  -6427 }, {  14440,  -7426 }, {  14871,  -7877 } },     //  494 Hz
+    { {  11295,  -4632 }, {  13305,  -6427 }, {  14302,  -7426 }, {  14729,  -7877 } },     //  523 Hz
+    { {  11172,  -4632 }, {  13160,  -6427 }, {  14146,  -7426 }, {  14569,  -7877 } },     //  554 Hz
+    { {  11034,  -4632 }, {  12997,  -6427 }, {  13971,  -7426 }, {  14388,  -7877 } },     //  587 Hz
+    { {  10879,  -4632 }, {  12814,  -6427 }, {  13775,  -7426 }, {  14186,  -7877 } },     //  622 Hz
+    { {  10706,  -4632 }, {  12611,  -6427 }, {  13556,  -7426 }, {  13961,  -7877 } },     //  659 Hz
+    { {  10514,  -4632 }, {  12385,  -6427 }, {  13313,  -7426 }, {  13711,  -7877 } },     //  698 Hz
+    { {  10297,  -4632 }, {  12129,  -6427 }, {  13038,  -7426 }, {  13428,  -7877 } },     //  740 Hz
+    { {  10057,  -4632 }, {  11847,  -6427 }, {  12734,  -7426 }, {  13115,  -7877 } },     //  784 Hz
+    { {   9794,  -4632 }, {  11536,  -6427 }, {  12400,  -7426 }, {  12771,  -7877 } },     //  830 Hz
+    { {   9493,  -4632 }, {  11182,  -6427 }, {  12019,  -7426 }, {  12379,  -7877 } },     //  880 Hz
+    { {   9164,  -4632 }, {  10795,  -6427 }, {  11603,  -7426 }, {  11950,  -7877 } },     //  932 Hz
+    { {   8793,  -4632 }, {  10358,  -6427 }, {  11134,  -7426 }, {  11467,  -7877 } },     //  988 Hz
+    { {   8384,  -4632 }, {   9876,  -6427 }, {  10616,  -7426 }, {  10933,  -7877 } },     // 1047 Hz
+    { {  11591,  -4632 }, {  13654,  -6427 }, {  14677,  -7426 }, {  15116,  -7877 } },     //  440 Hz
+    { {  11504,  -4632 }, {  13551,  -6427 }, {  14566,  -7426 }, {  15001,  -7877 } },     //  466 Hz
+    { {  11404,  -4632 }, {  13433,  -6427 }, {  14440,  -7426 }, {  14871,  -7877 } },     //  494 Hz
+    { {  11295,  -4632 }, {  13305,  -6427 }, {  14302,  -7426 }, {  14729,  -7877 } },     //  523 Hz
+    { {  11172,  -4632 }, {  13160,  -6427 }, {  14146,  -7426 }, {  14569,  -7877 } },     //  554 Hz
+    { {  11034,  -4632 }, {  12997,  -6427 }, {  13971,  -7426 }, {  14388,  -7877 } },     //  587 Hz
+    { {  10879,  -4632 }, {  12814,  -6427 }, {  13775,  -7426 }, {  14186,  -7877 } },     //  622 Hz
+    { {  10706,  -4632 }, {  12611,  -6427 }, {  13556,  -7426 }, {  13961,  -7877 } },     //  659 Hz
+    { {  10514,  -4632 }, {  12385,  -6427 }, {  13313,  -7426 }, {  13711,  -7877 } },     //  698 Hz
+    { {  10297,  -4632 }, {  12129,  -6427 }, {  13038,  -7426 }, {  13428,  -7877 } },     //  740 Hz
+    { {  10057,  -4632 }, {  11847,  -6427 }, {  12734,  -7426 }, {  13115,  -7877 } },     //  784 Hz
+    { {   9794,  -4632 }, {  11536,  -6427 }, {  12400,  -7426 }, {  12771,  -7877 } },     //  830 Hz
+    { {   9493,  -4632 }, {  11182,  -6427 }, {  12019,  -7426 }, {  12379,  -7877 } },     //  880 Hz
+    { {   9164,  -4632 }, {  10795,  -6427 }, {  11603,  -7426 }, {  11950,  -7877 } },     //  932 Hz
+    { {   8793,  -4632 }, {  10358,  -6427 }, {  11134,  -7426 }, {  11467,  -7877 } },     //  988 Hz
+    { {   8384,  -4632 }, {   9876,  -6427 }, {  10616,  -7426 }, {  10933,  -7877 } },     // 1047 Hz
+    { {   8001,  -4632 }, {   9425,  -6427 }, {  10131,  -7426 }, {  10434,  -7877 } },     // 1100 Hz
+    { {   7405,  -4632 }, {   8722,  -6427 }, {   9376,  -7426 }, {   9656,  -7877 } },     // 1179 Hz
+    { {   6812,  -4632 }, {   8024,  -6427 }, {   8626,  -7426 }, {   8883,  -7877 } },     // 1254 Hz
+    { {   6129,  -4632 }, {   7220,  -6427 }, {   7761,  -7426 }, {   7993,  -7877 } },     // 1337 Hz
+    { {   5350,  -4632 }, {   6302,  -6427 }, {   6775,  -7426 }, {   6977,  -7877 } },     // 1428 Hz
+    { {   4463,  -4632 }, {   5257,  -6427 }, {   5651,  -7426 }, {   5820,  -7877 } },     // 1528 Hz
+    { {   3446,  -4632 }, {   4060,  -6427 }, {   4364,  -7426 }, {   4494,  -7877 } },     // 1639 Hz
+    { {   2299,  -4632 }, {   2708,  -6427 }, {   2911,  -7426 }, {   2998,  -7877 } },     // 1761 Hz
+    { {    996,  -4632 }, {   1173,  -6427 }, {   1261,  -7426 }, {   1298,  -7877 } },     // 1897 Hz
+    { {   -455,  -4632 }, {   -536,  -6427 }, {   -576,  -7426 }, {   -593,  -7877 } },     // 2047 Hz
+    { {  -2061,  -4632 }, {  -2428,  -6427 }, {  -2610,  -7426 }, {  -2688,  -7877 } },     // 2214 Hz
+    { {  -3807,  -4632 }, {  -4484,  -6427 }, {  -4820,  -7426 }, {  -4964,  -7877 } },     // 2400 Hz
+    { {  -5671,  -4632 }, {  -6679,  -6427 }, {  -7180,  -7426 }, {  -7395,  -7877 } },     // 2609 Hz
+    { {  -7566,  -4632 }, {  -8912,  -6427 }, {  -9580,  -7426 }, {  -9867,  -7877 } },     // 2842 Hz
+    { {  -9399,  -4632 }, { -11072,  -6427 }, { -11901,  -7426 }, { -12257,  -7877 } },     // 3105 Hz
+    { { -10977,  -4632 }, { -12930,  -6427 }, { -13899,  -7426 }, { -14314,  -7877 } },     // 3400 Hz
+    { {   7405,  -4632 }, {   8722,  -6427 }, {   9376,  -7426 }, {   9656,  -7877 } },     // 1179 Hz
+    { {   6129,  -4632 }, {   7220,  -6427 }, {   7761,  -7426 }, {   7993,  -7877 } },     // 1337 Hz
+    { {   4463,  -4632 }, {   5257,  -6427 }, {   5651,  -7426 }, {   5820,  -7877 } },     // 1528 Hz
+    { {   2299,  -4632 }, {   2708,  -6427 }, {   2911,  -7426 }, {   2998,  -7877 } },     // 1761 Hz
+    { {   -455,  -4632 }, {   -536,  -6427 }, {   -576,  -7426 }, {   -593,  -7877 } },     // 2047 Hz
+    { {  -3807,  -4632 }, {  -4484,  -6427 }, {  -4820,  -7426 }, {  -4964,  -7877 } },     // 2400 Hz
+    { {  -7566,  -4632 }, {  -8912,  -6427 }, {  -9580,  -7426 }, {  -9867,  -7877 } },     // 2842 Hz
+    { { -10977,  -4632 }, { -12930,  -6427 }, { -13899,  -7426 }, { -14314,  -7877 } },     // 3400 Hz
+    { { -11382,  -4632 }, { -13407,  -6427 }, { -14412,  -7426 }, { -14843,  -7877 } },     // 3500 Hz
+};
+
+const byte softPulseGain [128] PROGMEM = {
+   179, 179, 160, 135, 119, 108,  99,  92,  87,  82,  78,  75,  72,  69,  66,  64,
+    62,  60,  59,  57,  56,  55,  53,  52,  51,  50,  49,  48,  47,  47,  46,  45,
+    44,  44,  43,  42,  42,  41,  41,  40,  40,  39,  39,  38,  38,  38,  37,  37,
+    36,  36,  36,  35,  35,  35,  34,  34,  34,  33,  33,  33,  33,  32,  32,  32,
+    31,  31,  31,  31,  31,  30,  30,  30,  30,  30,  29,  29,  29,  29,  29,  28,
+    28,  28,  28,  28,  28,  27,  27,  27,  27,  27,  27,  26,  26,  26,  26,  26,
+    26,  26,  25,  25,  25,  25,  25,  25,  25,  25,  25,  24,  24,  24,  24,  24,
+    24,  24,  24,  24,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  22,  22,
+};
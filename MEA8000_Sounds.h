@@ -0,0 +1,768 @@
+/*
+
+    MEA8000_Sounds.h
+
+    Declarations of all the sound arrays, one MEA8000_Sounds*.cpp file per group
+    (see MEA8000_Sounds.cpp).
+    Include this file (and not the .cpp) from every other file that uses the sounds.
+
+    A sound is handed around as a SoundSpan: the Flash address of the array and its
+    length in bytes. Use SOUND(name) to make one, e.g. SOUND(Sound_Alpha).
+
+ */
+
+#ifndef MEA8000_SOUNDS_H
+#define MEA8000_SOUNDS_H
+
+#include "MEA8000_Platform.h"
+
+
+struct SoundSpan {
+    const byte  *data;      // in Flash (PROGMEM)
+    uint16_t    length;     // in bytes
+};
+
+#define SOUND(name)     { name, sizeof(name) }
+
+// Copy a SoundSpan that is itself stored in Flash into RAM.
+inline SoundSpan readSoundSpan(const SoundSpan *span) {
+    SoundSpan   result;
+    memcpy_P(&result, span, sizeof(SoundSpan));
+    return result;
+}
+
+
+// = Most sounds based on French phonemes  ====================================================================================
+
+extern const byte NoSound                              [8] PROGMEM;
+extern const byte Sound_a                              [32] PROGMEM;
+extern const byte Sound_e                              [32] PROGMEM;
+extern const byte Sound_i                              [32] PROGMEM;
+extern const byte Sound_oo                             [32] PROGMEM;
+extern const byte Sound_u                              [32] PROGMEM;
+extern const byte Sound_eh                             [32] PROGMEM;
+extern const byte Sound_ee                             [32] PROGMEM;
+extern const byte Sound_oh                             [32] PROGMEM;
+extern const byte Sound_w                              [32] PROGMEM;
+extern const byte Sound_A                              [32] PROGMEM;
+extern const byte Sound_I                              [56] PROGMEM;
+extern const byte Sound_O                              [32] PROGMEM;
+extern const byte Sound_W                              [32] PROGMEM;
+extern const byte Sound_b                              [24] PROGMEM;
+extern const byte Sound_d                              [24] PROGMEM;
+extern const byte Sound_f                              [32] PROGMEM;
+extern const byte Sound_g                              [16] PROGMEM;
+extern const byte Sound_j                              [20] PROGMEM;
+extern const byte Sound_k                              [16] PROGMEM;
+extern const byte Sound_l                              [20] PROGMEM;
+extern const byte Sound_m                              [32] PROGMEM;
+extern const byte Sound_n                              [16] PROGMEM;
+extern const byte Sound_p                              [20] PROGMEM;
+extern const byte Sound_R                              [16] PROGMEM;
+extern const byte Sound_r                              [20] PROGMEM;
+extern const byte Sound_s                              [28] PROGMEM;
+extern const byte Sound_t                              [16] PROGMEM;
+extern const byte Sound_v                              [28] PROGMEM;
+extern const byte Sound_z                              [16] PROGMEM;
+extern const byte Sound_ch                             [28] PROGMEM;
+extern const byte Sound_N                              [52] PROGMEM;
+extern const byte Sound_ai                             [60] PROGMEM;
+extern const byte Sound_ej                             [60] PROGMEM;
+extern const byte Sound_ui                             [60] PROGMEM;
+extern const byte Sound_ie                             [60] PROGMEM;
+extern const byte Sound_oi                             [40] PROGMEM;
+extern const byte Sound_o                              [32] PROGMEM;
+
+// Words - NATO phonetic alphabet ---------------------------------------------------------------------------------------
+
+extern const byte Sound_Alpha                          [140] PROGMEM;
+extern const byte Sound_Bravo                          [120] PROGMEM;
+extern const byte Sound_Charlie                        [164] PROGMEM;
+extern const byte Sound_Delta                          [140] PROGMEM;
+extern const byte Sound_Echo                           [100] PROGMEM;
+extern const byte Sound_Foxtrot                        [232] PROGMEM;
+extern const byte Sound_Golf                           [124] PROGMEM;
+extern const byte Sound_Hotel                          [184] PROGMEM;
+extern const byte Sound_India                          [152] PROGMEM;
+extern const byte Sound_Juliet                         [148] PROGMEM;
+extern const byte Sound_Kilo                           [108] PROGMEM;
+extern const byte Sound_Lima                           [124] PROGMEM;
+extern const byte Sound_Michael                        [188] PROGMEM;
+extern const byte Sound_November                       [200] PROGMEM;
+extern const byte Sound_Oscar                          [164] PROGMEM;
+extern const byte Sound_Papa                           [128] PROGMEM;
+extern const byte Sound_Quebec                         [148] PROGMEM;
+extern const byte Sound_Romeo                          [156] PROGMEM;
+extern const byte Sound_Sierra                         [120] PROGMEM;
+extern const byte Sound_Tango                          [120] PROGMEM;
+extern const byte Sound_Uniform                        [204] PROGMEM;
+extern const byte Sound_Victor                         [160] PROGMEM;
+extern const byte Sound_Whisky                         [128] PROGMEM;
+extern const byte Sound_X_ray                          [104] PROGMEM;
+extern const byte Sound_Yankee                         [160] PROGMEM;
+extern const byte Sound_Zulu                           [116] PROGMEM;
+
+// Self designed samples
+
+extern const byte Sound_hooo                           [64] PROGMEM;
+extern const byte Sound_ho                             [32] PROGMEM;
+extern const byte Sound_h                              [16] PROGMEM;
+extern const byte Sound_hu                             [24] PROGMEM;
+extern const byte Sound_he                             [32] PROGMEM;
+extern const byte Sound_ha                             [28] PROGMEM;
+
+// Numbers in English
+
+extern const byte Sound_ZerOO                          [56] PROGMEM;
+extern const byte Sound_One                            [64] PROGMEM;
+extern const byte Sound_Two                            [64] PROGMEM;
+extern const byte Sound_Three                          [72] PROGMEM;
+extern const byte Sound_Four                           [64] PROGMEM;
+extern const byte Sound_Five                           [84] PROGMEM;
+extern const byte Sound_Six                            [92] PROGMEM;
+extern const byte Sound_Seven                          [108] PROGMEM;
+extern const byte Sound_Eight                          [64] PROGMEM;
+extern const byte Sound_Nine                           [68] PROGMEM;
+extern const byte Sound_Ten                            [76] PROGMEM;
+extern const byte Sound_Eleven                         [120] PROGMEM;
+extern const byte Sound_Twelve                         [88] PROGMEM;
+extern const byte Sound_Thir_                          [68] PROGMEM;
+extern const byte Sound_Four_                          [52] PROGMEM;
+extern const byte Sound_Fif_                           [64] PROGMEM;
+extern const byte Sound__teen                          [96] PROGMEM;
+extern const byte Sound_Twen_                          [64] PROGMEM;
+extern const byte Sound__ty                            [60] PROGMEM;
+extern const byte Sound_Hundred                        [92] PROGMEM;
+extern const byte Sound_Telephone                      [124] PROGMEM;
+extern const byte Sound_Number                         [96] PROGMEM;
+extern const byte Sound_Code                           [76] PROGMEM;
+extern const byte Sound_And                            [60] PROGMEM;
+
+// From catalog 2 ----------------------------------------------------------------------------------------------------
+
+extern const byte Sound_C2_A                           [48] PROGMEM;
+extern const byte Sound_C2_ACCOLADE                    [184] PROGMEM;
+extern const byte Sound_C2_AIMER                       [76] PROGMEM;
+extern const byte Sound_C2_ALLER                       [76] PROGMEM;
+extern const byte Sound_C2_ALORS                       [92] PROGMEM;
+extern const byte Sound_C2_AMI                         [56] PROGMEM;
+extern const byte Sound_C2_ANIMAL                      [108] PROGMEM;
+extern const byte Sound_C2_ANIMAUX                     [100] PROGMEM;
+extern const byte Sound_C2_ANNEE                       [80] PROGMEM;
+extern const byte Sound_C2_ANNIVERSAIRE                [140] PROGMEM;
+extern const byte Sound_C2_ANTI                        [100] PROGMEM;
+extern const byte Sound_C2_APPRENDRE                   [116] PROGMEM;
+extern const byte Sound_C2_APPUI                       [104] PROGMEM;
+extern const byte Sound_C2_APRES                       [68] PROGMEM;
+extern const byte Sound_C2_ARRET                       [76] PROGMEM;
+extern const byte Sound_C2_ASSEZ                       [88] PROGMEM;
+extern const byte Sound_C2_ASSIETTE                    [144] PROGMEM;
+extern const byte Sound_C2_ASTERISQUE                  [168] PROGMEM;
+extern const byte Sound_C2_AU                          [40] PROGMEM;
+extern const byte Sound_C2_AUSSI                       [76] PROGMEM;
+extern const byte Sound_C2_AVANT                       [84] PROGMEM;
+extern const byte Sound_C2_AVOIR                       [96] PROGMEM;
+extern const byte Sound_C2_B                           [80] PROGMEM;
+extern const byte Sound_C2_BARRE                       [92] PROGMEM;
+extern const byte Sound_C2_BAS                         [48] PROGMEM;
+extern const byte Sound_C2_BIEN                        [60] PROGMEM;
+extern const byte Sound_C2_BLOCAGE                     [152] PROGMEM;
+extern const byte Sound_C2_BOIRE                       [88] PROGMEM;
+extern const byte Sound_C2_BON                         [32] PROGMEM;
+extern const byte Sound_C2_BONJOUR                     [104] PROGMEM;
+extern const byte Sound_C2_BONNE                       [88] PROGMEM;
+extern const byte Sound_C2_BRAVO                       [100] PROGMEM;
+extern const byte Sound_C2_C_EST                       [48] PROGMEM;
+extern const byte Sound_C2_C_ETAIT                     [96] PROGMEM;
+extern const byte Sound_C2_C                           [56] PROGMEM;
+extern const byte Sound_C2_CALCUL                      [136] PROGMEM;
+extern const byte Sound_C2_CE                          [60] PROGMEM;
+extern const byte Sound_C2_CECI                        [80] PROGMEM;
+extern const byte Sound_C2_CHIFFRE                     [176] PROGMEM;
+extern const byte Sound_C2_CHOISI                      [84] PROGMEM;
+extern const byte Sound_C2_CHOIX                       [76] PROGMEM;
+extern const byte Sound_C2_CLASSE                      [84] PROGMEM;
+extern const byte Sound_C2_CLAVIER                     [100] PROGMEM;
+extern const byte Sound_C2_CLEF                        [48] PROGMEM;
+extern const byte Sound_C2_COMBIEN                     [112] PROGMEM;
+extern const byte Sound_C2_COMME                       [116] PROGMEM;
+extern const byte Sound_C2_COMMERCIAL                  [108] PROGMEM;
+extern const byte Sound_C2_COMPRENDRE                  [128] PROGMEM;
+extern const byte Sound_C2_COMPTER                     [84] PROGMEM;
+extern const byte Sound_C2_CONNAITRE                   [112] PROGMEM;
+extern const byte Sound_C2_COPIE                       [96] PROGMEM;
+extern const byte Sound_C2_CORRESPONDANTE              [180] PROGMEM;
+extern const byte Sound_C2_COTEE                       [76] PROGMEM;
+extern const byte Sound_C2_COULEUR                     [112] PROGMEM;
+extern const byte Sound_C2_CRAYON                      [88] PROGMEM;
+extern const byte Sound_C2_CROCHET                     [116] PROGMEM;
+extern const byte Sound_C2_CURSEUR                     [108] PROGMEM;
+extern const byte Sound_C2_D_                          [20] PROGMEM;
+extern const byte Sound_C2_D                           [64] PROGMEM;
+extern const byte Sound_C2_DANS                        [56] PROGMEM;
+extern const byte Sound_C2_DE                          [52] PROGMEM;
+extern const byte Sound_C2_DEBUT                       [76] PROGMEM;
+extern const byte Sound_C2_DEJA                        [92] PROGMEM;
+extern const byte Sound_C2_DELETE                      [124] PROGMEM;
+extern const byte Sound_C2_DEMANDER                    [116] PROGMEM;
+extern const byte Sound_C2_DEMI                        [80] PROGMEM;
+extern const byte Sound_C2_DES                         [52] PROGMEM;
+extern const byte Sound_C2_DESIRER                     [116] PROGMEM;
+extern const byte Sound_C2_DIEZE                       [120] PROGMEM;
+extern const byte Sound_C2_DIFFICILE                   [124] PROGMEM;
+extern const byte Sound_C2_DIRE                        [64] PROGMEM;
+extern const byte Sound_C2_DIRIGE                      [120] PROGMEM;
+extern const byte Sound_C2_DO                          [48] PROGMEM;
+extern const byte Sound_C2_DOLLARD                     [128] PROGMEM;
+extern const byte Sound_C2_DONC                        [80] PROGMEM;
+extern const byte Sound_C2_DONNE                       [92] PROGMEM;
+extern const byte Sound_C2_DROITE                      [96] PROGMEM;
+extern const byte Sound_C2_DU                          [44] PROGMEM;
+extern const byte Sound_C2_E                           [44] PROGMEM;
+extern const byte Sound_C2_ECOUTE                      [108] PROGMEM;
+extern const byte Sound_C2_ECOUTEUR                    [120] PROGMEM;
+extern const byte Sound_C2_ECRAN                       [96] PROGMEM;
+extern const byte Sound_C2_ECRIS                       [84] PROGMEM;
+extern const byte Sound_C2_EFFACE                      [100] PROGMEM;
+extern const byte Sound_C2_EGAL                        [136] PROGMEM;
+extern const byte Sound_C2_ELLE                        [56] PROGMEM;
+extern const byte Sound_C2_EN                          [32] PROGMEM;
+extern const byte Sound_C2_ENCORE                      [108] PROGMEM;
+extern const byte Sound_C2_ENFANT                      [88] PROGMEM;
+extern const byte Sound_C2_ENTER                       [144] PROGMEM;
+extern const byte Sound_C2_ESCAPE                      [136] PROGMEM;
+extern const byte Sound_C2_ESPACE                      [152] PROGMEM;
+extern const byte Sound_C2_ESSAY                       [72] PROGMEM;
+extern const byte Sound_C2_EST                         [28] PROGMEM;
+extern const byte Sound_C2_EST_CE                      [52] PROGMEM;
+extern const byte Sound_C2_ET                          [36] PROGMEM;
+extern const byte Sound_C2_ETRE                        [88] PROGMEM;
+extern const byte Sound_C2_EU                          [36] PROGMEM;
+extern const byte Sound_C2_EXACTE                      [172] PROGMEM;
+extern const byte Sound_C2_EXCLAMATION                 [160] PROGMEM;
+extern const byte Sound_C2_EXEMPLE                     [144] PROGMEM;
+extern const byte Sound_C2_EXERCICE                    [136] PROGMEM;
+extern const byte Sound_C2_F                           [52] PROGMEM;
+extern const byte Sound_C2_FACILE                      [120] PROGMEM;
+extern const byte Sound_C2_FAIRE                       [104] PROGMEM;
+extern const byte Sound_C2_FAIS                        [48] PROGMEM;
+extern const byte Sound_C2_FEMME                       [108] PROGMEM;
+extern const byte Sound_C2_FLECHE                      [116] PROGMEM;
+extern const byte Sound_C2_FOIS                        [72] PROGMEM;
+extern const byte Sound_C2_FONCTION                    [124] PROGMEM;
+extern const byte Sound_C2_FRANC                       [88] PROGMEM;
+extern const byte Sound_C2_G                           [60] PROGMEM;
+extern const byte Sound_C2_GAUCHE                      [88] PROGMEM;
+extern const byte Sound_C2_GRAND                       [68] PROGMEM;
+extern const byte Sound_C2_GUILLEMET                   [120] PROGMEM;
+extern const byte Sound_C2_H                           [68] PROGMEM;
+extern const byte Sound_C2_HA_NOM                      [80] PROGMEM;
+extern const byte Sound_C2_I                           [32] PROGMEM;
+extern const byte Sound_C2_IL                          [60] PROGMEM;
+extern const byte Sound_C2_INEXACTE                    [172] PROGMEM;
+extern const byte Sound_C2_INFERIEUR                   [192] PROGMEM;
+extern const byte Sound_C2_INTERROGATION               [156] PROGMEM;
+extern const byte Sound_C2_J                           [40] PROGMEM;
+extern const byte Sound_C2_JAMAIS                      [88] PROGMEM;
+extern const byte Sound_C2_JE                          [72] PROGMEM;
+extern const byte Sound_C2_JOUR                        [84] PROGMEM;
+extern const byte Sound_C2_JOYSTICK                    [136] PROGMEM;
+extern const byte Sound_C2_JUSTE                       [112] PROGMEM;
+extern const byte Sound_C2_K                           [24] PROGMEM;
+extern const byte Sound_C2_L_                          [32] PROGMEM;
+extern const byte Sound_C2_L_ECRAN                     [124] PROGMEM;
+extern const byte Sound_C2_L                           [60] PROGMEM;
+extern const byte Sound_C2_LA_BAS                      [84] PROGMEM;
+extern const byte Sound_C2_LA                          [52] PROGMEM;
+extern const byte Sound_C2_LE                          [52] PROGMEM;
+extern const byte Sound_C2_LES                         [64] PROGMEM;
+extern const byte Sound_C2_LEUR                        [96] PROGMEM;
+extern const byte Sound_C2_LIVRE                       [108] PROGMEM;
+extern const byte Sound_C2_M                           [72] PROGMEM;
+extern const byte Sound_C2_MA                          [64] PROGMEM;
+extern const byte Sound_C2_MADAME                      [128] PROGMEM;
+extern const byte Sound_C2_MAINTENANT                  [128] PROGMEM;
+extern const byte Sound_C2_MAIS                        [60] PROGMEM;
+extern const byte Sound_C2_MAISON                      [104] PROGMEM;
+extern const byte Sound_C2_MAJUSCULE                   [148] PROGMEM;
+extern const byte Sound_C2_MANETTE                     [100] PROGMEM;
+extern const byte Sound_C2_MATIN                       [92] PROGMEM;
+extern const byte Sound_C2_ME                          [56] PROGMEM;
+extern const byte Sound_C2_MERCI                       [76] PROGMEM;
+extern const byte Sound_C2_MES                         [64] PROGMEM;
+extern const byte Sound_C2_MESDAMES                    [148] PROGMEM;
+extern const byte Sound_C2_MESSIEURS                   [112] PROGMEM;
+extern const byte Sound_C2_MET                         [60] PROGMEM;
+extern const byte Sound_C2_METTRE                      [108] PROGMEM;
+extern const byte Sound_C2_MI                          [48] PROGMEM;
+extern const byte Sound_C2_MIDI                        [64] PROGMEM;
+extern const byte Sound_C2_MIEN                        [68] PROGMEM;
+extern const byte Sound_C2_MIEUX                       [68] PROGMEM;
+extern const byte Sound_C2_MOI                         [68] PROGMEM;
+extern const byte Sound_C2_MOINS                       [84] PROGMEM;
+extern const byte Sound_C2_MON                         [84] PROGMEM;
+extern const byte Sound_C2_MONSIEUR                    [96] PROGMEM;
+extern const byte Sound_C2_MOYEN                       [80] PROGMEM;
+extern const byte Sound_C2_MOT                         [48] PROGMEM;
+extern const byte Sound_C2_N                           [88] PROGMEM;
+extern const byte Sound_C2_NE                          [68] PROGMEM;
+extern const byte Sound_C2_NOMBRE                      [120] PROGMEM;
+extern const byte Sound_C2_NOM                         [60] PROGMEM;
+extern const byte Sound_C2_NOS                         [72] PROGMEM;
+extern const byte Sound_C2_NOTE                        [96] PROGMEM;
+extern const byte Sound_C2_NOTRE                       [100] PROGMEM;
+extern const byte Sound_C2_NOUS                        [56] PROGMEM;
+extern const byte Sound_C2_NUMERO                      [112] PROGMEM;
+extern const byte Sound_C2_O                           [36] PROGMEM;
+extern const byte Sound_C2_ON                          [32] PROGMEM;
+extern const byte Sound_C2_OPTIQUE                     [112] PROGMEM;
+extern const byte Sound_C2_OR                          [68] PROGMEM;
+extern const byte Sound_C2_OU                          [28] PROGMEM;
+extern const byte Sound_C2_OUI                         [64] PROGMEM;
+extern const byte Sound_C2_P                           [52] PROGMEM;
+extern const byte Sound_C2_PARENTHESE                  [172] PROGMEM;
+extern const byte Sound_C2_PARFAIT                     [116] PROGMEM;
+extern const byte Sound_C2_PARLER                      [88] PROGMEM;
+extern const byte Sound_C2_PASSER                      [68] PROGMEM;
+extern const byte Sound_C2_PENSER                      [96] PROGMEM;
+extern const byte Sound_C2_PETIT                       [80] PROGMEM;
+extern const byte Sound_C2_PEUT_ETRE                   [104] PROGMEM;
+extern const byte Sound_C2_PLUS                        [80] PROGMEM;
+extern const byte Sound_C2_POIGNEE                     [108] PROGMEM;
+extern const byte Sound_C2_POINT                       [72] PROGMEM;
+extern const byte Sound_C2_POSITIONNE                  [188] PROGMEM;
+extern const byte Sound_C2_POUR                        [60] PROGMEM;
+extern const byte Sound_C2_POUR_CENT                   [112] PROGMEM;
+extern const byte Sound_C2_PREMIER                     [104] PROGMEM;
+extern const byte Sound_C2_PRENDRE                     [92] PROGMEM;
+extern const byte Sound_C2_PRENOM                      [100] PROGMEM;
+extern const byte Sound_C2_PROBLEME                    [152] PROGMEM;
+extern const byte Sound_C2_PUIS                        [64] PROGMEM;
+extern const byte Sound_C2_PUISSANCE                   [128] PROGMEM;
+extern const byte Sound_C2_Q                           [52] PROGMEM;
+extern const byte Sound_C2_QU_                         [24] PROGMEM;
+extern const byte Sound_C2_QU_EST_CE                   [68] PROGMEM;
+extern const byte Sound_C2_QUAND                       [60] PROGMEM;
+extern const byte Sound_C2_QUE                         [56] PROGMEM;
+extern const byte Sound_C2_QUEL                        [60] PROGMEM;
+extern const byte Sound_C2_QUELQUE                     [92] PROGMEM;
+extern const byte Sound_C2_QUESTION                    [96] PROGMEM;
+extern const byte Sound_C2_QUI                         [56] PROGMEM;
+extern const byte Sound_C2_QU_IL                       [88] PROGMEM;
+extern const byte Sound_C2_QUOI                        [52] PROGMEM;
+extern const byte Sound_C2_R                           [72] PROGMEM;
+extern const byte Sound_C2_RE                          [64] PROGMEM;
+extern const byte Sound_C2_RECOMMENCE                  [152] PROGMEM;
+extern const byte Sound_C2_REGARDE                     [112] PROGMEM;
+extern const byte Sound_C2_REPONSE                     [164] PROGMEM;
+extern const byte Sound_C2_RESULTAT                    [128] PROGMEM;
+extern const byte Sound_C2_RIEN                        [72] PROGMEM;
+extern const byte Sound_C2_S                           [72] PROGMEM;
+extern const byte Sound_C2_SA                          [60] PROGMEM;
+extern const byte Sound_C2_SANS                        [76] PROGMEM;
+extern const byte Sound_C2_SAVOIR                      [128] PROGMEM;
+extern const byte Sound_C2_SCORE                       [120] PROGMEM;
+extern const byte Sound_C2_SE                          [52] PROGMEM;
+extern const byte Sound_C2_SELECTIONNEE                [148] PROGMEM;
+extern const byte Sound_C2_SES                         [68] PROGMEM;
+extern const byte Sound_C2_SI                          [48] PROGMEM;
+extern const byte Sound_C2_SI_NOTE_                    [76] PROGMEM;
+extern const byte Sound_C2_SIEN                        [72] PROGMEM;
+extern const byte Sound_C2_SIMPLE                      [128] PROGMEM;
+extern const byte Sound_C2_SLASH                       [116] PROGMEM;
+extern const byte Sound_C2_SOIR                        [112] PROGMEM;
+extern const byte Sound_C2_SOL                         [116] PROGMEM;
+extern const byte Sound_C2_SOLUTION                    [128] PROGMEM;
+extern const byte Sound_C2_SON                         [68] PROGMEM;
+extern const byte Sound_C2_SUITE                       [104] PROGMEM;
+extern const byte Sound_C2_SUPERIEUR                   [176] PROGMEM;
+extern const byte Sound_C2_SUR                         [64] PROGMEM;
+extern const byte Sound_C2_T                           [56] PROGMEM;
+extern const byte Sound_C2_TA                          [40] PROGMEM;
+extern const byte Sound_C2_TE                          [40] PROGMEM;
+extern const byte Sound_C2_TEMPS                       [56] PROGMEM;
+extern const byte Sound_C2_TES                         [68] PROGMEM;
+extern const byte Sound_C2_TIEN                        [44] PROGMEM;
+extern const byte Sound_C2_TIRET                       [120] PROGMEM;
+extern const byte Sound_C2_TOI                         [68] PROGMEM;
+extern const byte Sound_C2_TON                         [56] PROGMEM;
+extern const byte Sound_C2_TOUJOURS                    [120] PROGMEM;
+extern const byte Sound_C2_TOUT                        [36] PROGMEM;
+extern const byte Sound_C2_TRES                        [56] PROGMEM;
+extern const byte Sound_C2_TROUVER                     [92] PROGMEM;
+extern const byte Sound_C2_TU                          [44] PROGMEM;
+extern const byte Sound_C2_T_UN                        [68] PROGMEM;
+extern const byte Sound_C2_T_UNE                       [88] PROGMEM;
+extern const byte Sound_C2_U                           [48] PROGMEM;
+extern const byte Sound_C2_UN                          [64] PROGMEM;
+extern const byte Sound_C2_UNE                         [84] PROGMEM;
+extern const byte Sound_C2_V                           [84] PROGMEM;
+extern const byte Sound_C2_VALIDATION                  [128] PROGMEM;
+extern const byte Sound_C2_VENIR                       [84] PROGMEM;
+extern const byte Sound_C2_VENT                        [68] PROGMEM;
+extern const byte Sound_C2_VIRGULE                     [128] PROGMEM;
+extern const byte Sound_C2_VOICI                       [92] PROGMEM;
+extern const byte Sound_C2_VOILA                       [72] PROGMEM;
+extern const byte Sound_C2_VOIR                        [120] PROGMEM;
+extern const byte Sound_C2_VOS                         [52] PROGMEM;
+extern const byte Sound_C2_VOTRE                       [108] PROGMEM;
+extern const byte Sound_C2_VOUS                        [44] PROGMEM;
+extern const byte Sound_C2_VRAIMENT                    [108] PROGMEM;
+extern const byte Sound_C2_W                           [148] PROGMEM;
+extern const byte Sound_C2_X                           [84] PROGMEM;
+extern const byte Sound_C2_Y                           [132] PROGMEM;
+extern const byte Sound_C2_Z                           [96] PROGMEM;
+extern const byte Sound_C2_ZERO_NR                     [80] PROGMEM;
+extern const byte Sound_C2_UN_NR                       [56] PROGMEM;
+extern const byte Sound_C2_DEUX_NR                     [64] PROGMEM;
+extern const byte Sound_C2_TROIS_NR                    [72] PROGMEM;
+extern const byte Sound_C2_QUATRE_NR                   [80] PROGMEM;
+extern const byte Sound_C2_CINQ_NR                     [84] PROGMEM;
+extern const byte Sound_C2_CIN_CENT_NR                 [64] PROGMEM;
+extern const byte Sound_C2_SIX_NR                      [76] PROGMEM;
+extern const byte Sound_C2_SI_CENT_NR                  [52] PROGMEM;
+extern const byte Sound_C2_SEPT_NR                     [100] PROGMEM;
+extern const byte Sound_C2_HUIT_NR                     [92] PROGMEM;
+extern const byte Sound_C2_HUI_CENT_NR                 [52] PROGMEM;
+extern const byte Sound_C2_NEUF_NR                     [80] PROGMEM;
+extern const byte Sound_C2_DIX_NR                      [68] PROGMEM;
+extern const byte Sound_C2_DI_MILLE_NR                 [36] PROGMEM;
+extern const byte Sound_C2_ONZE_NR_ugly                [72] PROGMEM;
+extern const byte Sound_C2_ONZE_NR                     [72] PROGMEM;
+extern const byte Sound_C2_DOUZE_NR                    [68] PROGMEM;
+extern const byte Sound_C2_TREIZE_NR                   [104] PROGMEM;
+extern const byte Sound_C2_QUATORZE_NR                 [120] PROGMEM;
+extern const byte Sound_C2_QUINZE_NR                   [80] PROGMEM;
+extern const byte Sound_C2_SEIZE_NR                    [116] PROGMEM;
+extern const byte Sound_C2_DIX_SEPT_NR                 [120] PROGMEM;
+extern const byte Sound_C2_DIX_HUIT                    [136] PROGMEM;
+extern const byte Sound_C2_DIX_HUI_MILLE_NR            [104] PROGMEM;
+extern const byte Sound_C2_DIX_NEUF_NR                 [136] PROGMEM;
+extern const byte Sound_C2_VINGT_NR                    [92] PROGMEM;
+extern const byte Sound_C2_VIN_MILLE_NR                [72] PROGMEM;
+extern const byte Sound_C2_TRENTE_NR                   [128] PROGMEM;
+extern const byte Sound_C2_QUARANTE_NR                 [112] PROGMEM;
+extern const byte Sound_C2_CINQUANTE_NR                [132] PROGMEM;
+extern const byte Sound_C2_SOIXANTE_NR                 [164] PROGMEM;
+extern const byte Sound_C2_QUATRE_VINGT_NR             [140] PROGMEM;
+extern const byte Sound_C2_CENT_NR                     [76] PROGMEM;
+extern const byte Sound_C2_MILLE_NR                    [84] PROGMEM;
+extern const byte Sound_C2_MILLION_NR                  [84] PROGMEM;
+extern const byte Sound_C2_ET_UN_NR                    [72] PROGMEM;
+extern const byte Sound_C2_ET_NR                       [32] PROGMEM;
+
+// From catalog 3 ----------------------------------------------------------------------------------------------------
+
+extern const byte Sound_C3_ADDITIONNE                  [176] PROGMEM;
+extern const byte Sound_C3_AFFICHE                     [104] PROGMEM;
+extern const byte Sound_C3_AJOUTE                      [128] PROGMEM;
+extern const byte Sound_C3_ALPHABET                    [128] PROGMEM;
+extern const byte Sound_C3_ANALYSE                     [148] PROGMEM;
+extern const byte Sound_C3_ATTENTION                   [128] PROGMEM;
+extern const byte Sound_C3_BEBE                        [104] PROGMEM;
+extern const byte Sound_C3_BONHOMME                    [96] PROGMEM;
+extern const byte Sound_C3_CORRECTION                  [140] PROGMEM;
+extern const byte Sound_C3_COUSIN                      [100] PROGMEM;
+extern const byte Sound_C3_DIMINUE                     [124] PROGMEM;
+extern const byte Sound_C3_ENFANT                      [96] PROGMEM;
+extern const byte Sound_C3_EVITE                       [124] PROGMEM;
+extern const byte Sound_C3_FAMILLE                     [124] PROGMEM;
+extern const byte Sound_C3_FREINE                      [88] PROGMEM;
+extern const byte Sound_C3_LENTEMENT                   [116] PROGMEM;
+extern const byte Sound_C3_LIGNE                       [136] PROGMEM;
+extern const byte Sound_C3_LIT                         [56] PROGMEM;
+extern const byte Sound_C3_MAMAN                       [92] PROGMEM;
+extern const byte Sound_C3_MERE                        [120] PROGMEM;
+extern const byte Sound_C3_MULTIPILIE                  [176] PROGMEM;
+extern const byte Sound_C3_OBSTACLE                    [128] PROGMEM;
+extern const byte Sound_C3_ONCLE                       [104] PROGMEM;
+extern const byte Sound_C3_ORTHOGRAPHE                 [204] PROGMEM;
+extern const byte Sound_C3_PAPA                        [84] PROGMEM;
+extern const byte Sound_C3_PARENT                      [120] PROGMEM;
+extern const byte Sound_C3_PERE                        [96] PROGMEM;
+extern const byte Sound_C3_PLACE                       [144] PROGMEM;
+extern const byte Sound_C3_RECOMMENCE                  [172] PROGMEM;
+extern const byte Sound_C3_RECULE                      [132] PROGMEM;
+extern const byte Sound_C3_SOEUR                       [96] PROGMEM;
+extern const byte Sound_C3_SOUSTRAIT                   [112] PROGMEM;
+extern const byte Sound_C3_SYNTHESE                    [156] PROGMEM;
+extern const byte Sound_C3_TANTE                       [92] PROGMEM;
+extern const byte Sound_C3_AUTO                        [84] PROGMEM;
+extern const byte Sound_C3_AUTOBUS                     [148] PROGMEM;
+extern const byte Sound_C3_AVION                       [96] PROGMEM;
+extern const byte Sound_C3_BAS                         [56] PROGMEM;
+extern const byte Sound_C3_BATEAU                      [80] PROGMEM;
+extern const byte Sound_C3_CAMPINGCAR                  [184] PROGMEM;
+extern const byte Sound_C3_CAR                         [84] PROGMEM;
+extern const byte Sound_C3_CARRE                       [108] PROGMEM;
+extern const byte Sound_C3_CENTIME                     [136] PROGMEM;
+extern const byte Sound_C3_CERCLE                      [96] PROGMEM;
+extern const byte Sound_C3_ELECTRICITE                 [168] PROGMEM;
+extern const byte Sound_C3_FENETRE                     [112] PROGMEM;
+extern const byte Sound_C3_FRANC                       [84] PROGMEM;
+extern const byte Sound_C3_GARE                        [112] PROGMEM;
+extern const byte Sound_C3_HAUT                        [44] PROGMEM;
+extern const byte Sound_C3_HELICOPTERE                 [180] PROGMEM;
+extern const byte Sound_C3_HEURE                       [100] PROGMEM;
+extern const byte Sound_C3_KILO                        [88] PROGMEM;
+extern const byte Sound_C3_L_                          [36] PROGMEM;
+extern const byte Sound_C3_LA                          [44] PROGMEM;
+extern const byte Sound_C3_LE                          [48] PROGMEM;
+extern const byte Sound_C3_LES                         [64] PROGMEM;
+extern const byte Sound_C3_LUMIERE                     [120] PROGMEM;
+extern const byte Sound_C3_METRE                       [116] PROGMEM;
+extern const byte Sound_C3_METRO                       [96] PROGMEM;
+extern const byte Sound_C3_MINUTE                      [132] PROGMEM;
+extern const byte Sound_C3_MUR                         [104] PROGMEM;
+extern const byte Sound_C3_PIECE                       [96] PROGMEM;
+extern const byte Sound_C3_PLANCHER                    [104] PROGMEM;
+extern const byte Sound_C3_PORTE                       [100] PROGMEM;
+extern const byte Sound_C3_RECTANGLE                   [156] PROGMEM;
+extern const byte Sound_C3_TABLE                       [92] PROGMEM;
+extern const byte Sound_C3_TAXI                        [104] PROGMEM;
+extern const byte Sound_C3_TELEPHONE                   [140] PROGMEM;
+extern const byte Sound_C3_TELEVISION                  [136] PROGMEM;
+extern const byte Sound_C3_TONNE                       [112] PROGMEM;
+extern const byte Sound_C3_TRAIN                       [68] PROGMEM;
+extern const byte Sound_C3_TRIANGLE                    [140] PROGMEM;
+extern const byte Sound_C3_UN                          [56] PROGMEM;
+extern const byte Sound_C3_UNE                         [56] PROGMEM;
+extern const byte Sound_C3_UNE_                        [48] PROGMEM;
+extern const byte Sound_C3_VETEMENT                    [124] PROGMEM;
+extern const byte Sound_C3_VOITURE                     [144] PROGMEM;
+extern const byte Sound_C3_ANE                         [100] PROGMEM;
+extern const byte Sound_C3_BANQUE                      [104] PROGMEM;
+extern const byte Sound_C3_BOITE_DE_NUIT               [148] PROGMEM;
+extern const byte Sound_C3_BOUCHE                      [92] PROGMEM;
+extern const byte Sound_C3_BRAS                        [80] PROGMEM;
+extern const byte Sound_C3_BUREAU_DE_POSTE             [180] PROGMEM;
+extern const byte Sound_C3_CANARD                      [108] PROGMEM;
+extern const byte Sound_C3_CENTRE_COMMERCIAL           [244] PROGMEM;
+extern const byte Sound_C3_CHAT                        [68] PROGMEM;
+extern const byte Sound_C3_CHEVAL                      [132] PROGMEM;
+extern const byte Sound_C3_CHEVEUX                     [112] PROGMEM;
+extern const byte Sound_C3_CHIEN                       [76] PROGMEM;
+extern const byte Sound_C3_DENTISTE                    [144] PROGMEM;
+extern const byte Sound_C3_DOIGT                       [76] PROGMEM;
+extern const byte Sound_C3_GRENOUILLE                  [132] PROGMEM;
+extern const byte Sound_C3_HOPITAL                     [160] PROGMEM;
+extern const byte Sound_C3_JAMBE                       [116] PROGMEM;
+extern const byte Sound_C3_MAIN                        [68] PROGMEM;
+extern const byte Sound_C3_MEDECIN                     [112] PROGMEM;
+extern const byte Sound_C3_NEZ                         [68] PROGMEM;
+extern const byte Sound_C3_OPTICIEN                    [164] PROGMEM;
+extern const byte Sound_C3_OREILLE                     [164] PROGMEM;
+extern const byte Sound_C3_PAPETERIE                   [148] PROGMEM;
+extern const byte Sound_C3_PHARMACIE                   [152] PROGMEM;
+extern const byte Sound_C3_PIED                        [64] PROGMEM;
+extern const byte Sound_C3_POULE                       [96] PROGMEM;
+extern const byte Sound_C3_SALON_DE_COIFFURE           [204] PROGMEM;
+extern const byte Sound_C3_STATION_SERVICE             [216] PROGMEM;
+extern const byte Sound_C3_TABAC                       [76] PROGMEM;
+extern const byte Sound_C3_TETE                        [92] PROGMEM;
+extern const byte Sound_C3_VACHE                       [68] PROGMEM;
+extern const byte Sound_C3_VITRINE                     [140] PROGMEM;
+extern const byte Sound_C3_ARMOIRE                     [140] PROGMEM;
+extern const byte Sound_C3_BAIGNOIRE                   [144] PROGMEM;
+extern const byte Sound_C3_BALAIS                      [84] PROGMEM;
+extern const byte Sound_C3_BIBERON                     [108] PROGMEM;
+extern const byte Sound_C3_BOUCHON                     [68] PROGMEM;
+extern const byte Sound_C3_BOUTEILLE                   [124] PROGMEM;
+extern const byte Sound_C3_CARAFE                      [132] PROGMEM;
+extern const byte Sound_C3_CASSEROLE                   [112] PROGMEM;
+extern const byte Sound_C3_CHAISE                      [116] PROGMEM;
+extern const byte Sound_C3_CHAMBRE                     [104] PROGMEM;
+extern const byte Sound_C3_CLEF                        [76] PROGMEM;
+extern const byte Sound_C3_COMPTEUR                    [128] PROGMEM;
+extern const byte Sound_C3_CUISINE                     [116] PROGMEM;
+extern const byte Sound_C3_CUISINIERE                  [148] PROGMEM;
+extern const byte Sound_C3_ECLAIRAGE                   [188] PROGMEM;
+extern const byte Sound_C3_EPONGE                      [128] PROGMEM;
+extern const byte Sound_C3_EVIER                       [116] PROGMEM;
+extern const byte Sound_C3_FAUTEUIL                    [148] PROGMEM;
+extern const byte Sound_C3_GARAGE                      [148] PROGMEM;
+extern const byte Sound_C3_INTERRUPTEUR                [192] PROGMEM;
+extern const byte Sound_C3_LAMPE                       [108] PROGMEM;
+extern const byte Sound_C3_LAVABO                      [124] PROGMEM;
+extern const byte Sound_C3_LAVE_VAISSEILE              [188] PROGMEM;
+extern const byte Sound_C3_LINGE                       [88] PROGMEM;
+extern const byte Sound_C3_MACHINE_A_LAVER_LE_LINGE_A  [256] PROGMEM;
+extern const byte Sound_C3_MACHINE_A_LAVER_LE_LINGE_B  [12] PROGMEM;
+extern const byte Sound_C3_MAISON                      [92] PROGMEM;
+extern const byte Sound_C3_NAPPE                       [100] PROGMEM;
+extern const byte Sound_C3_OUVRE_BOITE                 [164] PROGMEM;
+extern const byte Sound_C3_PELLE                       [100] PROGMEM;
+extern const byte Sound_C3_PLACARD                     [128] PROGMEM;
+extern const byte Sound_C3_PLAFOND                     [100] PROGMEM;
+extern const byte Sound_C3_PLAT                        [60] PROGMEM;
+extern const byte Sound_C3_POELE                       [112] PROGMEM;
+extern const byte Sound_C3_POUBELLE                    [120] PROGMEM;
+extern const byte Sound_C3_RADIATEUR                   [160] PROGMEM;
+extern const byte Sound_C3_REFRIGERATEUR               [184] PROGMEM;
+extern const byte Sound_C3_RIDEAU                      [104] PROGMEM;
+extern const byte Sound_C3_ROBINET                     [128] PROGMEM;
+extern const byte Sound_C3_SALADIER                    [136] PROGMEM;
+extern const byte Sound_C3_SALLE_A_MANGER              [128] PROGMEM;
+extern const byte Sound_C3_SALLE_DE_BAIN               [148] PROGMEM;
+extern const byte Sound_C3_SALON                       [104] PROGMEM;
+extern const byte Sound_C3_SERPILLIERE                 [164] PROGMEM;
+extern const byte Sound_C3_SERVIETTE                   [140] PROGMEM;
+extern const byte Sound_C3_SOL                         [84] PROGMEM;
+extern const byte Sound_C3_TAPIS                       [96] PROGMEM;
+extern const byte Sound_C3_TIRE_BOUCHON                [116] PROGMEM;
+extern const byte Sound_C3_TOILETTE                    [132] PROGMEM;
+extern const byte Sound_C3_TOIT                        [76] PROGMEM;
+extern const byte Sound_C3_VAISSELLE                   [120] PROGMEM;
+extern const byte Sound_C3_VOLET                       [88] PROGMEM;
+extern const byte Sound_C3_AVEC                        [104] PROGMEM;
+extern const byte Sound_C3_CEINTURE                    [168] PROGMEM;
+extern const byte Sound_C3_CHAPEAU                     [92] PROGMEM;
+extern const byte Sound_C3_CHAUSSETTE                  [116] PROGMEM;
+extern const byte Sound_C3_CHAUSSURE                   [128] PROGMEM;
+extern const byte Sound_C3_CHEMISE                     [124] PROGMEM;
+extern const byte Sound_C3_CHEMISE_DE_NUIT             [164] PROGMEM;
+extern const byte Sound_C3_CUBE                        [88] PROGMEM;
+extern const byte Sound_C3_CUILLERE                    [112] PROGMEM;
+extern const byte Sound_C3_CUILLERE_A_DESSERT          [204] PROGMEM;
+extern const byte Sound_C3_CUILLERE_A_SOUPE            [168] PROGMEM;
+extern const byte Sound_C3_DERRIERE                    [140] PROGMEM;
+extern const byte Sound_C3_DEVANT                      [108] PROGMEM;
+extern const byte Sound_C3_DISTANCE                    [152] PROGMEM;
+extern const byte Sound_C3_GANT                        [60] PROGMEM;
+extern const byte Sound_C3_GILET                       [108] PROGMEM;
+extern const byte Sound_C3_GRANDEUR                    [132] PROGMEM;
+extern const byte Sound_C3_HAUTEUR                     [128] PROGMEM;
+extern const byte Sound_C3_IMPERMEABLE                 [192] PROGMEM;
+extern const byte Sound_C3_JUPE                        [80] PROGMEM;
+extern const byte Sound_C3_LARGEUR                     [148] PROGMEM;
+extern const byte Sound_C3_LOIN_DE                     [132] PROGMEM;
+extern const byte Sound_C3_LONGUEUR                    [132] PROGMEM;
+extern const byte Sound_C3_MANTEAU                     [104] PROGMEM;
+extern const byte Sound_C3_PAIRE_DE_LUNETTE            [204] PROGMEM;
+extern const byte Sound_C3_PANTALON                    [132] PROGMEM;
+extern const byte Sound_C3_PARAPLUIE                   [136] PROGMEM;
+extern const byte Sound_C3_PIJAMA                      [108] PROGMEM;
+extern const byte Sound_C3_POIDS                       [76] PROGMEM;
+extern const byte Sound_C3_PRES_DE                     [100] PROGMEM;
+extern const byte Sound_C3_PROFONDEUR                  [188] PROGMEM;
+extern const byte Sound_C3_PULLOVER                    [140] PROGMEM;
+extern const byte Sound_C3_ROBE_DE_CHAMBRE             [204] PROGMEM;
+extern const byte Sound_C3_SHORT                       [104] PROGMEM;
+extern const byte Sound_C3_SOUS_VETEMENT               [152] PROGMEM;
+extern const byte Sound_C3_SURFACE                     [116] PROGMEM;
+extern const byte Sound_C3_TABLIER                     [124] PROGMEM;
+extern const byte Sound_C3_VERRE                       [104] PROGMEM;
+extern const byte Sound_C3_VESTE                       [92] PROGMEM;
+extern const byte Sound_C3_VOLUME                      [140] PROGMEM;
+extern const byte Sound_C3_ABRICOT                     [116] PROGMEM;
+extern const byte Sound_C3_AUTOROUTE                   [152] PROGMEM;
+extern const byte Sound_C3_BANANE                      [136] PROGMEM;
+extern const byte Sound_C3_BEEFSTEAK                   [112] PROGMEM;
+extern const byte Sound_C3_BIERE                       [92] PROGMEM;
+extern const byte Sound_C3_BLANC                       [68] PROGMEM;
+extern const byte Sound_C3_BLEU                        [60] PROGMEM;
+extern const byte Sound_C3_BOEUF                       [80] PROGMEM;
+extern const byte Sound_C3_CAFE                        [84] PROGMEM;
+extern const byte Sound_C3_CAMPAGNE                    [124] PROGMEM;
+extern const byte Sound_C3_CHOCOLAT                    [100] PROGMEM;
+extern const byte Sound_C3_CITRON                      [96] PROGMEM;
+extern const byte Sound_C3_CLEMENTINE                  [148] PROGMEM;
+extern const byte Sound_C3_CORNICHON                   [120] PROGMEM;
+extern const byte Sound_C3_ESCARGOT                    [128] PROGMEM;
+extern const byte Sound_C3_FLEUVE                      [104] PROGMEM;
+extern const byte Sound_C3_FRAISE                      [100] PROGMEM;
+extern const byte Sound_C3_FROMAGE                     [132] PROGMEM;
+extern const byte Sound_C3_GATEAU                      [80] PROGMEM;
+extern const byte Sound_C3_HUITRE                      [100] PROGMEM;
+extern const byte Sound_C3_JAMBON                      [104] PROGMEM;
+extern const byte Sound_C3_LAIT                        [64] PROGMEM;
+extern const byte Sound_C3_MARRON                      [100] PROGMEM;
+extern const byte Sound_C3_MER                         [76] PROGMEM;
+extern const byte Sound_C3_MONTAGNE                    [144] PROGMEM;
+extern const byte Sound_C3_MOULE                       [96] PROGMEM;
+extern const byte Sound_C3_MOUTARDE                    [128] PROGMEM;
+extern const byte Sound_C3_MOUTON                      [92] PROGMEM;
+extern const byte Sound_C3_NOIR                        [100] PROGMEM;
+extern const byte Sound_C3_OEUF                        [60] PROGMEM;
+extern const byte Sound_C3_OLIVE                       [112] PROGMEM;
+extern const byte Sound_C3_ORANGE                      [140] PROGMEM;
+extern const byte Sound_C3_PAIN                        [48] PROGMEM;
+extern const byte Sound_C3_PAMPLEMOUSSE                [136] PROGMEM;
+extern const byte Sound_C3_PATE                        [88] PROGMEM;
+extern const byte Sound_C3_PECHE                       [76] PROGMEM;
+extern const byte Sound_C3_PLAGE                       [120] PROGMEM;
+extern const byte Sound_C3_POIRE                       [104] PROGMEM;
+extern const byte Sound_C3_POMME                       [92] PROGMEM;
+extern const byte Sound_C3_PORC                        [100] PROGMEM;
+extern const byte Sound_C3_POULET                      [76] PROGMEM;
+extern const byte Sound_C3_PRUNE                       [96] PROGMEM;
+extern const byte Sound_C3_RAISIN                      [108] PROGMEM;
+extern const byte Sound_C3_RIVIERE                     [116] PROGMEM;
+extern const byte Sound_C3_RIZ                         [52] PROGMEM;
+extern const byte Sound_C3_ROSEE                       [104] PROGMEM;
+extern const byte Sound_C3_ROUTE                       [108] PROGMEM;
+extern const byte Sound_C3_SAUCE                       [72] PROGMEM;
+extern const byte Sound_C3_SUCRE                       [100] PROGMEM;
+extern const byte Sound_C3_THE                         [52] PROGMEM;
+extern const byte Sound_C3_TOMATE                      [116] PROGMEM;
+extern const byte Sound_C3_VEAU                        [56] PROGMEM;
+extern const byte Sound_C3_VERT                        [92] PROGMEM;
+extern const byte Sound_C3_VILLAGE                     [116] PROGMEM;
+extern const byte Sound_C3_VILLE                       [112] PROGMEM;
+extern const byte Sound_C3_VINAIGRE                    [116] PROGMEM;
+extern const byte Sound_C3_VIOLET                      [100] PROGMEM;
+extern const byte Sound_C3_VIRAGE                      [108] PROGMEM;
+extern const byte Sound_C3_YAOURT                      [112] PROGMEM;
+extern const byte Sound_C3_ADDITION                    [124] PROGMEM;
+extern const byte Sound_C3_ALPHABETIQUE                [184] PROGMEM;
+extern const byte Sound_C3_ALPHANUMERIQUE              [208] PROGMEM;
+extern const byte Sound_C3_AOUT                        [72] PROGMEM;
+extern const byte Sound_C3_APPREND                     [100] PROGMEM;
+extern const byte Sound_C3_AUGMENTE                    [152] PROGMEM;
+extern const byte Sound_C3_AVRIL                       [124] PROGMEM;
+extern const byte Sound_C3_CASSETTE                    [120] PROGMEM;
+extern const byte Sound_C3_COULEUR                     [100] PROGMEM;
+extern const byte Sound_C3_DECEMBRE                    [132] PROGMEM;
+extern const byte Sound_C3_DEPLACE                     [116] PROGMEM;
+extern const byte Sound_C3_DISQUETTE                   [136] PROGMEM;
+extern const byte Sound_C3_DIVISION                    [116] PROGMEM;
+extern const byte Sound_C3_EXPLICATION                 [176] PROGMEM;
+extern const byte Sound_C3_FEVRIER                     [140] PROGMEM;
+extern const byte Sound_C3_FICHE                       [112] PROGMEM;
+extern const byte Sound_C3_INDEX                       [128] PROGMEM;
+extern const byte Sound_C3_JANVIER                     [128] PROGMEM;
+extern const byte Sound_C3_JUILLET                     [100] PROGMEM;
+extern const byte Sound_C3_JUIN                        [76] PROGMEM;
+extern const byte Sound_C3_LECTEUR                     [108] PROGMEM;
+extern const byte Sound_C3_MAGNETOPHONE                [188] PROGMEM;
+extern const byte Sound_C3_MAI                         [76] PROGMEM;
+extern const byte Sound_C3_MARS                        [112] PROGMEM;
+extern const byte Sound_C3_MOIS                        [60] PROGMEM;
+extern const byte Sound_C3_MONITEUR                    [128] PROGMEM;
+extern const byte Sound_C3_MONOCHROME                  [176] PROGMEM;
+extern const byte Sound_C3_MULTIPLICATION              [184] PROGMEM;
+extern const byte Sound_C3_NOVEMBRE                    [152] PROGMEM;
+extern const byte Sound_C3_NUMERIQUE                   [132] PROGMEM;
+extern const byte Sound_C3_OCTOBRE                     [136] PROGMEM;
+extern const byte Sound_C3_REGARDE                     [144] PROGMEM;
+extern const byte Sound_C3_REGLE                       [116] PROGMEM;
+extern const byte Sound_C3_RETENUE                     [128] PROGMEM;
+extern const byte Sound_C3_RETIENT                     [120] PROGMEM;
+extern const byte Sound_C3_SEMAINE                     [112] PROGMEM;
+extern const byte Sound_C3_SEPTEMBRE                   [168] PROGMEM;
+extern const byte Sound_C3_SON                         [68] PROGMEM;
+extern const byte Sound_C3_SUIS                        [68] PROGMEM;
+extern const byte Sound_C3_TRAVAIL                     [152] PROGMEM;
+extern const byte Sound_C3_VOLUME_2                    [124] PROGMEM;
+
+// My own extra's
+
+extern const byte Sound_OMELETTE                       [168] PROGMEM;
+
+// One extra and long one from catalog 1, split into parts of max. 256 bytes
+
+extern const byte Sound_INTRO_MEA8000_P1               [256] PROGMEM;
+extern const byte Sound_INTRO_MEA8000_P2               [256] PROGMEM;
+extern const byte Sound_INTRO_MEA8000_P3               [176] PROGMEM;
+
+#endif
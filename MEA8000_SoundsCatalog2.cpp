@@ -0,0 +1,2483 @@
+/*
+
+    MEA8000_SoundsCatalog2.cpp
+
+    The words of catalog 2 (Sound_C2_...).
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// From catalog 2
+// Formatted (C-code) from the OCR-ed data files
+// (Here the values are in base-10)
+
+constexpr byte Sound_C2_A [48] PROGMEM = {
+       0,  48,  47,  47,   0, 153, 248,   0, 153, 177, 204, 143, 234, 176, 197, 160,
+     246, 177, 198,  64, 186, 177, 198, 160, 186, 177, 206, 223, 186, 177, 206,  63,
+     186, 177, 197, 160, 184, 145, 189,  32, 164, 145, 180,  32, 173, 145, 168,  23 };
+
+constexpr byte Sound_C2_ACCOLADE [184] PROGMEM = {
+       0, 184,  47,  47,   0, 117, 248,   0,   0, 117, 250, 144, 184, 180, 173,   6,
+     185, 180, 174,   7, 233, 148, 174,  32, 185, 149, 158,  62, 121, 118, 126,  61,
+     160, 151, 124, 160, 132, 119, 147,  32, 144, 150, 130,  32,  80, 148, 136,  80,
+      96, 181, 235, 159,  16, 116, 221,  16,  32, 177, 109,  48, 218, 144, 108,  40,
+     174, 144, 117,  62, 234, 144, 125, 159, 234, 146, 125, 191, 169, 146, 126,  27,
+     169, 148, 118,  32, 100, 181,  93, 160, 188, 180,  93, 192, 108, 181, 110,   3,
+     184, 181, 142, 128, 248, 181, 151,   0, 185, 180, 175,  64, 185, 180, 175,  64,
+     189, 181, 159,  64, 184, 181, 142, 188, 184, 181, 126,   0, 184, 181, 109, 128,
+     136, 181, 104,  32,  64, 151, 128,  64,  64, 181,  66, 128,   5, 181,  35, 128,
+     190, 181, 100,  64, 250, 180, 115, 160, 237, 180, 115,   0, 237, 179, 131,  64,
+     228, 179, 122, 223, 216, 179, 122,  29, 216, 179, 113, 159, 217, 179, 113,   1,
+     213, 178, 112, 159, 144, 178, 112,   7 };
+
+constexpr byte Sound_C2_AIMER [76] PROGMEM = {
+       0,  76,  47,  47,   0, 153, 248,   0, 182, 184, 101,  60, 245, 184,  94,  32,
+     246, 184, 102,  65, 245, 184, 110, 192, 170, 182,  86,  64, 132, 183,  52, 223,
+     136, 183,  52, 192, 137, 183,  53,  63, 137, 183,  53,  64, 102, 184,  95,  34,
+     118, 184, 103,  63, 186, 184, 119,  63, 249, 185, 102, 192, 229, 185,  93, 192,
+     245, 185,  93, 193, 229, 185,  84,  34, 229, 185,  88,   2 };
+
+constexpr byte Sound_C2_ALLER [76] PROGMEM = {
+       0,  76,  47,  47,  41, 181, 216,   0, 105, 181, 197, 155, 248, 181, 182, 160,
+     184, 182, 166, 192, 185, 182, 151,  64, 188, 182, 111,  64, 188, 183, 102, 160,
+     188, 183,  94,  63, 189, 183,  94,  63, 186, 182,  85, 191, 122, 183,  78,  33,
+     185, 184, 102, 192, 185, 185,  94, 223, 245, 185,  86,  32, 228, 185,  84, 191,
+     229, 185,  76,  62, 229, 185,  91, 133, 212, 185,  72,  14 };
+
+constexpr byte Sound_C2_ALORS [92] PROGMEM = {
+       0,  92,  44,  47,  40, 181, 216,   0, 252, 181, 182,  32, 212, 181, 182,  32,
+     232, 181, 175,  32, 248, 182, 159,  64, 249, 182, 143,  33, 184, 182, 119,  63,
+     188, 181, 110, 160, 172, 181, 102, 160, 250, 181, 127,  64, 170, 180, 143,  95,
+     170, 179, 143,  95, 170, 178, 134, 192, 170, 177, 134,  63, 238, 176, 133, 223,
+     154, 176, 133,  95, 170, 176, 124, 192,  90, 176, 132,  63, 123, 175, 124,  32,
+     110, 174, 100,  80,  38, 173,  76,  80,  34, 174,  72,  15 };
+
+constexpr byte Sound_C2_AMI [56] PROGMEM = {
+       0,  56,  47,  47,  84, 180, 168,   0, 169, 180, 175,   2, 184, 180, 175,  32,
+     165, 181, 167,  64, 169, 182, 143,  64,  85, 149, 102,  63, 132, 150,  69, 160,
+     160, 216,  69, 224, 133, 151,  52, 189, 201, 215,  52, 224, 196, 246,  60, 224,
+      64, 216,  52,  95,  69, 217,  24,  10 };
+
+constexpr byte Sound_C2_ANIMAL [108] PROGMEM = {
+       0, 108,  47,  47,  20, 182, 128,   0, 164, 182, 165, 130, 216, 181, 159,  64,
+     168, 182, 134, 161, 108, 183, 101, 160, 163, 183,  76, 193, 162, 184,  69,  32,
+     136, 215,  78,  32, 136, 214,  78, 160, 137, 215,  87,  64, 134, 184,  78, 190,
+     133, 181,  69, 160, 133, 181,  69, 223, 132, 180,  61, 223, 169, 181, 159,  94,
+     105, 180, 159,  95, 121, 180, 151,  64, 169, 181, 174, 223, 169, 181, 134,  64,
+     252, 181, 117, 192, 237, 181, 109, 192, 237, 181, 109, 192, 108, 181, 101,  64,
+     172, 181, 101,  64, 169, 181, 116, 163, 109, 181, 152,  14 };
+
+constexpr byte Sound_C2_ANIMAUX [100] PROGMEM = {
+       0, 100,  47,  47, 101, 180,  80,   0, 164, 181, 165,  17, 248, 181, 175,   0,
+     252, 181, 174,   0, 228, 182, 158, 166, 216, 182, 151,  35, 232, 182, 135,  33,
+     216, 183, 127,  33, 108, 183,  78,  32, 172, 183,  69, 162, 145, 151,  68, 192,
+     136, 212,  69,  64, 133, 215,  78, 192, 136, 183,  69, 222, 132, 184,  69, 223,
+     136, 181,  53,  95,  73, 179,  52, 223, 142, 174,  92, 186, 142, 172, 108, 192,
+     142, 170, 108, 192, 141, 169, 100,  64,  46, 165,   3, 223,  46, 165,   0,  13,
+      46, 165,   0,  12 };
+
+constexpr byte Sound_C2_ANNEE [80] PROGMEM = {
+       0,  80,  47,  47, 164, 181, 184,   0, 164, 181, 187, 157, 228, 182, 189, 128,
+     224, 182, 175,  32, 152, 183, 167,  64, 152, 183, 126, 192, 136, 183, 101, 160,
+     140, 178,  60, 161, 140, 179,  61,  32, 140, 182,  61,  63, 140, 179,  61,  63,
+     140, 178,  52, 191, 204, 183,  52, 160, 232, 184,  94,  95, 212, 185,  85, 223,
+     153, 185,  77, 222, 169, 185,  76,  32, 234, 185,  75, 137, 165, 185,  56,  14 };
+
+constexpr byte Sound_C2_ANNIVERSAIRE [140] PROGMEM = {
+       0, 140,  47,  47,   0, 153, 248,   0, 164, 182, 173, 192, 164, 182, 142,  64,
+     152, 183, 117, 161, 140, 182,  68,  66, 136, 183,  68, 192, 136, 217,  78,  32,
+     229, 217,  78,  64, 182, 184,  85, 222, 169, 182, 101,  64, 250, 183, 118, 162,
+     250, 183, 127,  32, 185, 183, 135,  32, 185, 182, 135,  32, 165, 182, 125, 191,
+     101, 182, 133, 144,  36, 181, 134,  48,  64, 187, 134,  80,  17, 182, 133, 176,
+      17, 215, 125,  48,   5, 182, 125,  80,   5, 184, 117,  80,  86, 215, 118,  80,
+     230, 182, 110,  23, 248, 181, 126,  32, 232, 181, 126,  60, 233, 182, 134,  63,
+     185, 183, 126,  96, 230, 182, 117, 189, 186, 183, 101, 224, 117, 183, 116, 192,
+     181, 183, 115,  64, 170, 183, 112,   7, 170, 183, 112,  14 };
+
+constexpr byte Sound_C2_ANTI [100] PROGMEM = {
+       0, 100,  47,  47,   0, 153, 248,   0,  21, 175, 187,  15,  85, 176, 189, 128,
+      86, 175, 182,   0,  86, 174, 183,  32,  86, 174, 191,  33,  82, 174, 191,  32,
+      86, 173, 175,  32,  84, 173, 167,  64,  68, 173, 158, 158,  65, 145, 150,  32,
+       8, 179, 125, 191,  72, 178, 101,  31, 152, 178,  92, 158, 152, 178,  76,  29,
+     152, 178,  75, 128, 128, 214,  96, 112,   8, 215,   5, 208, 221, 216,  62,  48,
+     229, 216,  61, 165, 240, 216,  61,  94, 228, 216,  60, 158, 152, 185,  60, 224,
+      89, 184,  16,  25 };
+
+constexpr byte Sound_C2_APPRENDRE [116] PROGMEM = {
+       0, 116,  47,  47, 185, 180, 200,   0, 152, 180, 188, 156, 165, 179, 182, 194,
+     169, 179, 158,  34,  64, 147, 140,  63, 132, 178, 144,  80, 133, 186, 232, 112,
+     137, 174, 229, 176,  25, 170,   5,  61,  22, 171, 181, 160,  26, 171, 190,  33,
+      69, 175, 198, 192,  70, 175, 198, 223,  26, 169, 198,  95,  27, 169, 197, 223,
+      26, 170, 181, 192,  26, 173, 157, 223,  94, 175, 141, 191,  31, 176, 117,  60,
+      17, 178,  80, 112, 110, 177, 125, 165,  25, 174,   5,  63,  42, 176,   4, 188,
+      42, 176, 157,  64, 106, 176, 148,  63,  42, 175,   3,  32,  26, 175,  66, 140,
+      27, 176,  16,  14 };
+
+constexpr byte Sound_C2_APPUI [104] PROGMEM = {
+       0, 104,  48,  47, 133, 182, 112,   0,  68, 178, 198,   5, 106, 181, 143,  64,
+     185, 181, 143,  32, 149, 180, 126, 160, 153, 180,  94,  63, 132, 179,  67, 160,
+     128, 214, 120,  80, 128, 214, 120, 112,   1, 183,   4, 144,  22, 183,   7, 176,
+      21, 183,   6,  16,   5, 151, 166,  16,  37, 182, 238,  48,  36, 182,   5,  16,
+     181, 183,  45,  34, 209, 151,  44, 192, 166, 150,  45,  32, 234, 151,  37, 160,
+     230, 217,  46,  96, 225, 217,  46,  65, 228, 217,  45, 162, 229, 217,  45,  64,
+     217, 185,  37, 161,  89, 218,   0,  17 };
+
+constexpr byte Sound_C2_APRES [68] PROGMEM = {
+       0,  68,  47,  47, 249, 179, 184,   0, 148, 179, 190,  31, 164, 179, 182, 224,
+     164, 179, 174,  64, 164, 178, 150,  64, 164, 178, 123, 161,  18, 210, 136, 112,
+      22, 180, 183,  80, 165, 182,  86,  64, 165, 182, 117, 160, 185, 182, 110,  32,
+     186, 183, 102, 223, 186, 183, 102, 192, 186, 183, 102,  95, 186, 183, 101, 191,
+     186, 183,  96,   9 };
+
+constexpr byte Sound_C2_ARRET [76] PROGMEM = {
+       0,  76,  46,  47,   0, 181, 208,   0, 100, 178, 189, 191, 170, 179, 190, 160,
+      21, 179, 190, 193,  85, 179, 199,  64, 105, 178, 191,  62,  85, 178, 182, 160,
+     106, 178, 157, 191,  36, 177, 254,  48,  37, 178,  46,  48,  21, 179, 253, 208,
+      21, 180, 126,  80, 105, 181, 125,  36, 149, 183, 134,  94, 246, 183, 125, 223,
+     246, 183, 117, 192, 181, 184, 100,  94, 181, 184,  80,  15 };
+
+constexpr byte Sound_C2_ASSEZ [88] PROGMEM = {
+       0,  88,  47,  47,   0, 180, 208,   0, 248, 181, 165, 185, 216, 181, 159,  64,
+     180, 181, 126, 193, 244, 182, 126,  64, 101, 183, 134,  64,  33, 215, 174, 208,
+      38, 183, 182, 208,  38, 215, 214,  80,  38, 183, 230, 208,  23, 183, 150,  80,
+     187, 182,  86,  48, 244, 182,  85, 190, 249, 183,  85, 192, 224, 184,  85, 192,
+     229, 184,  85, 192, 213, 185,  85, 160, 213, 185,  85, 162, 212, 184,  85,  33,
+     201, 184,  68, 161, 196, 184,  64,   6 };
+
+constexpr byte Sound_C2_ASSIETTE [144] PROGMEM = {
+       0, 144,  47,  47,  20, 182, 216,   0, 168, 181, 182,   3, 228, 181, 174, 160,
+     168, 181, 175,  32, 184, 181, 158, 161, 168, 181, 142,  32, 153, 183, 125, 191,
+       4, 183,  94,  48,   1, 215, 133, 208,   5, 184, 125,  80,  21, 216, 117,  80,
+       9, 218, 110,  80,   8, 219, 102,  80,  88, 217,  69,  32, 246, 184,  86,  62,
+     245, 184, 110, 190, 185, 183, 143,  94, 233, 183, 126, 190, 185, 183, 118,  63,
+     225, 183,  84,  32, 192, 182, 112,  48, 192, 182, 112,  80, 192, 182, 112, 112,
+      16, 215, 184, 112,  21, 214, 219, 144, 102, 215, 236,  16,  22, 182, 204,  16,
+     102, 181, 115, 159, 214, 180, 114, 159, 214, 180, 113, 192, 106, 180, 113, 190,
+      85, 180,  81,  63,  89, 179, 145,  63,  89, 179, 121,  15,  37, 180,  96,  14 };
+
+constexpr byte Sound_C2_ASTERISQUE [168] PROGMEM = {
+       0, 168,  47,  47,   4, 180, 224,   0,   4, 180, 228,  11, 168, 180, 190, 128,
+     168, 180, 183,  64, 168, 180, 167,  32,  99, 180, 141, 191,  88, 181, 101,  62,
+       4, 182,   5,  48,  84, 183, 189, 208,   4, 151, 253,  80,   4, 151, 252, 144,
+       4, 151, 248,  48,   4, 151, 248, 112,   0, 183, 245, 144,   4, 183, 198,  16,
+      88, 183, 110, 144, 168, 183,  94,  14, 248, 184,  94, 191, 232, 184,  94, 189,
+     228, 184,  94, 191, 233, 184, 103,  62, 232, 184, 110, 191, 152, 183, 110,  62,
+     153, 182, 101, 187, 166, 184,  96,  80, 150, 183, 100, 138, 149, 184,  93, 130,
+     152, 184,  86,   0, 148, 185,  85, 159, 224, 217,  69,  95, 228, 217,  60, 223,
+      20, 182, 244, 240, 137, 152, 252, 208, 137, 152, 248, 112,  17, 153, 252, 144,
+      16, 185, 253, 144,  20, 185, 190,  16, 169, 183,  93,  16, 200, 150, 107, 189,
+     216, 150, 114, 160, 216, 150, 112,  14 };
+
+constexpr byte Sound_C2_AU [40] PROGMEM = {
+       0,  40,  47,  47,   0, 151, 216,   0, 254, 169, 108, 188, 202, 168, 109,  65,
+     135, 167, 117,  64, 218, 169, 101,  64, 217, 167,  92, 223, 130, 169, 100,  62,
+     150, 168,  91, 191, 129, 167,  88,  14 };
+
+constexpr byte Sound_C2_AUSSI [76] PROGMEM = {
+       0,  76,  47,  47,  20, 167, 104,   0,  89, 171, 100,   2, 153, 171, 101,  32,
+     141, 171, 109, 160,  90, 175, 101, 193, 165, 179,  93, 192, 149, 182, 101,  32,
+       1, 184,  69,  16, 103, 216, 118,  80, 102, 216, 109, 208,  98, 215, 126,  48,
+      27, 183,  94, 112,  11, 216,  78, 112, 174, 216,  77, 188, 238, 216,  53,  63,
+     250, 216,  53,  96, 233, 217,  52, 223, 234, 217,  48,   8 };
+
+constexpr byte Sound_C2_AVANT [84] PROGMEM = {
+       0,  84,  47,  47, 117, 179, 160,   0, 164, 179, 167,  60, 184, 180, 183,  64,
+     164, 178, 159,  64, 169, 178, 151,  33, 181, 178, 134,  32, 170, 177, 117, 191,
+     190, 177, 125, 190, 149, 178,  92, 189, 105, 177,  76, 160,  41, 177,  68, 191,
+      25, 176,   5,  65, 252, 174, 117, 193, 186, 173, 134,  64,  90, 171, 142,  64,
+      74, 168, 141, 192,  70, 171, 142,  66,  73, 171, 149, 161,   5, 166, 132,  63,
+      68, 173, 120,   4 };
+
+constexpr byte Sound_C2_AVOIR [96] PROGMEM = {
+       0,  96,  47,  47,  41, 180, 232,   0, 120, 179, 182,  11, 164, 180, 191,  32,
+     170, 180, 142, 192, 154, 178, 125, 221, 150, 178, 108,  62,  65, 181, 116,  60,
+       1, 183,   5, 208,  69, 179, 109, 195,  90, 172, 109, 192,  22, 169, 118, 192,
+      43, 171, 119,  63, 111, 175, 151,  64, 190, 176, 166, 192, 187, 177, 166, 223,
+     174, 177, 158,  95, 105, 177, 158,  64,  58, 177, 142,  64, 122, 177, 125, 192,
+      38, 176, 180, 240, 129, 178, 252,  80,  54, 177, 211, 176,  34, 176,   0,  11 };
+
+constexpr byte Sound_C2_B [80] PROGMEM = {
+       0,  80,  47,  47, 209, 180,   0,   0, 197, 180,  11, 135, 212, 180,   4,  61,
+     213, 180,   4, 159, 213, 180,   4, 128, 192, 181,   2,  13, 198, 180,  20, 131,
+     198, 184,  78, 128, 217, 183,  95,  32, 216, 184,  87,  61, 233, 184,  78, 224,
+     228, 185,  78, 192, 232, 185,  78, 158, 229, 185,  69,  31, 217, 185,  76, 159,
+     212, 186,  59, 128, 216, 185,  67,   4, 224, 185,  50, 128, 200, 185,  32,  22 };
+
+constexpr byte Sound_C2_BARRE [92] PROGMEM = {
+       0,  92,  47,  47, 149, 179,   0,   0, 149, 178,  11, 152, 152, 178,  69,   2,
+     168, 178, 134,   1, 184, 179, 158, 130, 189, 179, 190, 224, 189, 178, 198, 224,
+     125, 178, 198, 160, 168, 178, 198,  95, 188, 177, 181, 192, 184, 177, 173,  63,
+     188, 177, 164, 191, 168, 177, 147, 144, 168, 175, 131, 208, 184, 176, 131,  48,
+     101, 176,  99,  48, 121, 177, 131,  48, 121, 177, 115,  48,  32, 210,   3,  48,
+      52, 177, 179,  48,  32, 177,  98, 176,  32, 177,  96,  11 };
+
+constexpr byte Sound_C2_BAS [48] PROGMEM = {
+       0,  48,  47,  47, 169, 177,  56,   0,   0, 152,  84, 157,   0, 152, 102,   6,
+      68, 151, 159,  29, 173, 178, 135,  63, 173, 178, 166, 192, 109, 178, 182, 255,
+     172, 178, 181, 160,  72, 176, 196,  32,  92, 176, 170, 156,  92, 177, 128,  14 };
+
+constexpr byte Sound_C2_BIEN [60] PROGMEM = {
+       0,  60,  47,  47, 129, 148,  16,   0,  32, 182,   4,  22,  54, 216,   6,  33,
+     185, 217,  53, 192, 185, 217,  61, 192, 169, 216,  94, 193, 169, 183, 119,  64,
+     109, 182, 151,  64, 121, 181, 150, 191, 116, 181, 150,  32,  84, 181, 125, 191,
+     112, 180,  93,  63,  85, 179,  59, 160,  37, 179,  96,  10 };
+
+constexpr byte Sound_C2_BLOCAGE [152] PROGMEM = {
+       0, 152,  47,  47, 148, 181,  16,   0,  20, 180,  12, 135,  96, 149,  86,   0,
+      96, 149,  85, 128,  96, 148,  85,   0, 180, 116,  85,  32, 164, 115,  84, 160,
+     181, 146, 117, 160, 189, 175, 126,  64, 253, 174, 125, 158, 173, 173, 117, 191,
+     190, 172, 108, 158, 106, 172, 100,   0, 109, 139,  96,  16, 208, 174, 112,  80,
+     192, 180, 112, 112,   1, 153, 252, 144,   4, 184, 238, 144,   4, 186, 214,  16,
+     228, 184,  92, 169, 228, 183, 126,  32, 244, 182, 143,  62, 248, 181, 159, 223,
+     185, 181, 167, 192, 189, 180, 151, 224, 125, 180, 151,  63, 125, 180, 127,  64,
+      30, 182, 118,  31,  30, 183, 117, 160,  30, 183, 117, 192,  30, 183, 117, 176,
+      30, 183, 117,  16,  30, 183, 116, 144, 237, 180,  92,  80, 173, 178,  91, 189,
+     109, 178,  91,  63, 109, 178,  88,   0 };
+
+constexpr byte Sound_C2_BOIRE [88] PROGMEM = {
+       0,  88,  44,  47,   0, 113, 248,   0,  69, 172, 115,  59, 149, 170, 107, 160,
+      41, 170, 109,  32, 106, 170, 125, 160,  89, 172, 142,  33,  89, 173, 158, 160,
+      41, 175, 175,  32, 105, 177, 183,  64, 174, 178, 183,  95, 173, 178, 191,  64,
+     168, 178, 182,  62, 105, 177, 181, 223, 109, 176, 189,  64, 109, 176, 148, 160,
+      38, 208, 220,  32,  34, 176, 203, 160,  34, 176, 251, 160, 194, 181, 251,  64,
+     194, 181, 250, 160,  39, 176, 232,  15 };
+
+constexpr byte Sound_C2_BON [32] PROGMEM = {
+       0,  32,  46,  47, 128, 181,  16,   0,   0, 178,   6,  18,   0, 116, 126,  34,
+      73, 170, 132, 191,  73, 164, 132, 224,  69, 163, 132, 224, 133, 162, 128,  11 };
+
+constexpr byte Sound_C2_BONJOUR [104] PROGMEM = {
+       0, 104,  46,  47, 128, 181,  16,   0,   0, 178,   6, 146,   0, 116, 126, 162,
+      73, 170, 133,  63,  73, 164, 133,  95,  69, 163, 133,  96,  84, 182, 101, 130,
+      20, 182,  78,  32,   0, 184,  54, 160,   4, 184,   6, 208,  32, 218,   6, 208,
+       4, 184, 254, 208,   4, 182, 254, 130,  69, 182,  78,  34,  73, 171, 110,  96,
+     154, 170,  92, 192, 154, 168,  84, 127, 141, 167,  92,  64, 133, 165, 124, 224,
+      19, 203, 164, 208,  35, 173, 148, 208,  66, 178, 220, 208,  82, 206, 196, 176,
+      66, 176, 236,  48,  35, 174, 208,  15 };
+
+constexpr byte Sound_C2_BONNE [88] PROGMEM = {
+       0,  88,  47,  47, 213, 177,  24,   0,  16, 178,  76,   4,  97, 178, 126,   0,
+     154, 177, 126, 128, 234, 177, 143,  64, 250, 177, 151,  32, 185, 178, 151,  64,
+     169, 178, 151,  62, 168, 179, 142, 223, 132, 175,  93, 220, 136, 177,  85,  32,
+     128, 184,  93,  64, 132, 186,  52, 192, 196, 183,  44, 192, 132, 183,  44, 192,
+     132, 183,  53,  32,  84, 181,  85,  33, 136, 148,  93,  63,  72, 179,  85,  33,
+      20, 181,   0,   7,  24, 181,   0,  11 };
+
+constexpr byte Sound_C2_BRAVO [100] PROGMEM = {
+       0, 100,  47,  47,  37, 170,   0,   0,  37, 173, 116,   1,  37, 175, 189,  32,
+      21, 174, 205, 128,  21, 176, 141,  32, 101, 176, 149, 175, 104, 176, 166, 166,
+     104, 177, 183,  66, 148, 177, 174, 162, 157, 175, 150,  32, 169, 176, 101,  63,
+      89, 175, 100, 156,  68, 175,  92,  55,   4, 175,  68,  31,  16, 172,  28,  64,
+      20, 173,  92, 160, 251, 171, 109,  64, 254, 171, 109,  62, 254, 170, 100, 222,
+     250, 169,  92,  61, 189, 168,  91, 223, 169, 166,  91,  95, 137, 165,  98, 188,
+     153, 164,  88,   4 };
+
+constexpr byte Sound_C2_C_EST [48] PROGMEM = {
+       0,  48,  47,  47,  20, 183,  80,   0,  21, 215,  84,  48,  21, 183,  85,  48,
+       5, 184,  85,  48,  26, 183,  85, 176, 248, 183, 102,  66, 249, 184, 119,  64,
+     249, 184, 103,  95, 249, 184,  86,  61, 224, 184,  83, 191, 197, 215,  96,   4 };
+
+constexpr byte Sound_C2_C_ETAIT [96] PROGMEM = {
+       0,  96,  47,  47,   1, 182, 224,   0,   1, 182, 228, 144,  17, 184, 253, 208,
+      23, 182, 214,  48, 189, 182, 102,  39, 185, 183, 110, 186, 185, 184, 102, 127,
+     229, 184,  93, 189, 246, 184,  93,  63, 225, 184,  84,  63, 225, 185,  83, 160,
+       0, 153, 248,  80,  20, 180, 236,  16,  69, 183, 254, 144,   1, 182, 190,   7,
+     229, 214, 109, 128, 244, 182, 117, 128, 228, 182, 133, 224, 228, 182, 133, 192,
+     248, 183, 125, 224, 248, 183, 117, 160, 228, 183,  84, 160, 228, 183,  96,   9 };
+
+constexpr byte Sound_C2_C [56] PROGMEM = {
+       0,  56,  47,  47,   1, 182, 224,   0,   1, 182, 229, 144,  17, 184, 254, 208,
+      23, 182, 215,  48, 189, 182, 103,  39, 185, 183, 111, 186, 185, 184, 103, 127,
+     229, 184,  94, 223, 246, 184,  94,  62, 225, 184,  85,  63, 225, 185,  84, 192,
+     212, 184,  83, 163, 213, 184,  72,  10 };
+
+constexpr byte Sound_C2_CALCUL [136] PROGMEM = {
+       0, 136,  47,  47,   4, 183, 224,   0,   4, 183, 220, 143, 224, 183, 101, 160,
+     176, 183, 127,  32, 164, 182, 151, 190, 185, 182, 143, 192, 248, 182, 135,  29,
+     253, 182, 110, 160, 166, 183,  94,  64, 150, 183,  77,  63, 145, 182,  75, 160,
+     208, 182,  64,  16, 133, 151,  88,  48, 128, 216,  80, 112,  24, 184, 222, 176,
+      12, 185, 213, 176,  25, 185,  61, 144, 168, 185,  61,  34, 250, 151,  68, 193,
+     251, 151,  69,  63, 250, 151,  69, 224, 234, 151,  77, 194, 230, 151,  85, 164,
+     229, 150,  85,  32, 229, 150,  76, 129, 161, 150,  68,   2, 181, 150,  60,  64,
+     245, 150,  76, 160, 248, 182,  76, 223, 248, 181,  76, 158, 250, 181,  76, 192,
+     229, 181,  72,  22, 229, 181,  72,  17 };
+
+constexpr byte Sound_C2_CE [60] PROGMEM = {
+       0,  60,  47,  47,  21, 215, 248,   0,  21, 214, 252, 176,   5, 214, 253,  80,
+       1, 215, 253, 208,   1, 220, 254,  48,   4, 216, 254, 112,  89, 180, 102,  63,
+      90, 180, 102,  32, 106, 180, 110,  64, 239, 181, 110,  95, 187, 180, 101, 190,
+     230, 181,  92, 160, 211, 181, 100,  33, 133, 182,  96,   8 };
+
+constexpr byte Sound_C2_CECI [80] PROGMEM = {
+       0,  80,  47,  47,  25, 183, 160,   0,   7, 183, 253,  48,   5, 183, 253, 240,
+      81, 183, 254, 112,  74, 183, 254, 208, 186, 180, 102, 191, 254, 180, 103,  64,
+     255, 181, 102, 191,  95, 182,  78,  32,  17, 187,  71,  48,  18, 216,  71,  80,
+       5, 215,  70, 176,  21, 216,  62, 112,  10, 219,  54, 112, 157, 216,  61, 223,
+     212, 217,  69, 225, 192, 217,  60, 160, 200, 217,  51, 161, 196, 219,  40,  30 };
+
+constexpr byte Sound_C2_CHIFFRE [176] PROGMEM = {
+       0, 176,  47,  47,  19, 218,   0,   0,  19, 186, 253,  16,  10, 186, 253, 144,
+      19, 186, 253, 176,  17, 217, 254,  48,  17, 218,   6,  48,  21, 218, 174,  48,
+      21, 218, 206, 176,  36, 251, 238, 176,  37, 219, 246, 176,  20, 250, 254, 144,
+      33, 219, 254, 208,  10, 184, 254, 208, 234, 215,  86, 167, 245, 215,  78, 160,
+     246, 215,  70, 160, 230, 215,  62, 160, 226, 215,  62, 162, 242, 216,  62,   2,
+     245, 184,  70,  65,  89, 184,  62,  80,  21, 184,  14,  48,  17, 183,   6,  80,
+      22, 183, 166,  48,  17, 182,   6,  48,  17, 181, 198,  48,  68, 181, 254,  48,
+      17, 183,  94,  48,  65, 152, 182,  48,   0, 149, 238,  48, 130, 146, 198,  48,
+      81, 174, 150,  16,  37, 174, 181, 176,  34, 174, 133, 144, 119, 176, 101, 157,
+     171, 176, 117, 190, 171, 176, 133, 160, 170, 177, 149, 192, 170, 177, 157,  32,
+     101, 177, 148, 191, 165, 177, 124,  59,  64, 177, 123, 155,  84, 177, 112,   0 };
+
+constexpr byte Sound_C2_CHOISI [84] PROGMEM = {
+       0,  84,  47,  47,  17, 186, 248,   0,  20, 218, 254,  48,  69, 218, 254, 112,
+      64, 215, 253, 208, 145, 182, 236,  80,  69, 140, 100,  37, 101, 141, 101, 160,
+     169, 144, 126, 160, 185, 180, 143,  64, 184, 181, 119,  95, 244, 213,  93,  95,
+     149, 214, 108,  80,  82, 215, 101,  80,  87, 215, 109, 208, 158, 216,  69, 208,
+     213, 217,  60, 220, 229, 216,  68,  96, 249, 216,  68, 127, 249, 216,  68,   8,
+     249, 216,  64,  14 };
+
+constexpr byte Sound_C2_CHOIX [76] PROGMEM = {
+       0,  76,  47,  47,  16, 184, 192,   0,  19, 216, 238,  48,  19, 217, 254, 208,
+      83, 184, 254, 240,  67, 183, 254,  48, 131, 215, 253,  48, 135, 140, 216,  48,
+      89, 136, 124,  36,  86, 139, 117, 223,  86, 139, 134,  63, 106, 141, 150,  32,
+      22, 174, 158,  32, 170, 175, 158,  64, 170, 175, 158,  62, 184, 175, 141,   0,
+     116, 174, 124, 160, 101, 174,  98,  63,  98, 175, 112,   4 };
+
+constexpr byte Sound_C2_CLASSE [84] PROGMEM = {
+       0,  84,  47,  47,   5, 153, 216,   0,  17, 185, 190,  48,  81, 214,  93,   0,
+     166, 182, 101,  32, 249, 182, 118,  32, 249, 182, 135,  32, 164, 181, 183, 192,
+     144, 180, 183,  95,  72, 179, 150,  95, 169, 180, 125,  61,   0, 186, 253,  80,
+      17, 183, 253, 112,  64, 186, 253, 112,  16, 181, 165, 112,  84, 181, 109,  48,
+     229, 179, 116,  32, 228, 179, 123, 192,  64, 178, 123, 192,  16, 178,   2,  32,
+      81, 178,  64,  14 };
+
+constexpr byte Sound_C2_CLAVIER [100] PROGMEM = {
+       0, 100,  47,  47,   5, 153, 216,   0,  17, 185, 190,  48,  81, 214,  93,   0,
+     166, 182, 101,  32, 249, 182, 118,  32, 249, 182, 135,  32, 245, 182, 143, 191,
+     185, 183, 135, 192, 181, 183, 127,  60, 169, 150, 101, 191, 149, 151, 100, 144,
+     145, 184, 117,  48, 149, 185,  93,  80, 169, 217,  61, 208, 230, 216,  53,  48,
+     233, 216,  59, 223, 228, 216,  68,  33, 249, 216,  68, 161, 234, 184,  85,  64,
+     245, 184,  93, 161, 249, 184,  94,  32, 249, 184, 102,  64, 244, 184,  93, 161,
+     240, 185,  88,   8 };
+
+constexpr byte Sound_C2_CLEF [48] PROGMEM = {
+       0,  48,  47,  47,   4, 182,   0,   0,   8, 181,   5, 144, 196, 215,  69, 173,
+     225, 182,  69, 160, 178, 214,  62,  32, 233, 184, 102, 255, 228, 185, 102, 255,
+     212, 185,  94,  61, 216, 185,  85, 159, 200, 185,  68, 128, 196, 185,  56,  29 };
+
+constexpr byte Sound_C2_COMBIEN [112] PROGMEM = {
+       0, 112,  47,  47, 130, 178, 216,   0, 194, 174, 228, 130,  35, 173, 221,   0,
+      69, 149, 158,  32, 137, 176, 134, 160, 133, 177, 150, 223, 132, 179, 135,  64,
+      72, 182, 102, 190, 137, 182,  62,  64,  73, 148,  53, 191, 129, 152,  61,  63,
+     196, 152,  52,  63, 165, 152,  44,  62,  37, 152,  46,   1,  20, 184,  54, 134,
+     185, 184,  61, 129, 250, 184,  61, 160, 250, 216,  61,  64, 233, 215,  77, 190,
+     233, 183,  94,  32, 233, 182, 127,  64, 165, 181, 126, 192, 169, 180, 126,  64,
+     149, 179, 126,  64, 101, 178, 142, 192, 105, 177, 109, 191,  85, 177,  80,  14 };
+
+constexpr byte Sound_C2_COMME [116] PROGMEM = {
+       0, 116,  47,  47,  97,  81, 224,   0, 209, 180, 248,  15,  81, 176, 252,  39,
+      86, 145, 132, 160,  70, 141, 109, 160, 101, 142, 101, 192, 102, 175, 174,  63,
+      91, 176, 182,  94,  90, 176, 173, 191,  90, 175,  68, 188,  73, 180,  77,  33,
+      89, 176,  69,  94,  74, 178,  53,  64,  90, 178,  44, 223, 138, 179,  36,  62,
+     154, 177,  35, 191, 223, 177,  27,  32, 238, 177,  42, 160, 202, 179,  43,  64,
+     218, 178,  59,  64, 169, 177, 124, 160, 185, 177, 132, 189, 181, 177, 125,  32,
+     190, 177, 140, 192, 100, 177, 156,  64,  80, 208, 187, 160, 130, 148, 250, 160,
+     130, 148, 248,  13 };
+
+constexpr byte Sound_C2_COMMERCIAL [108] PROGMEM = {
+       0, 108,  47,  47,   0, 153, 248,   0,  16, 179, 171,  16,  80, 145, 221, 176,
+     149, 144, 116,  38, 238, 142, 117, 192, 172, 142,  92,  57, 156, 143,  51, 162,
+     137, 143,  68,  33, 148, 145,  60,  65, 232, 150, 143,  64, 165, 182, 143,  94,
+     101, 181, 150,  57,  20, 180, 142,  80,  85, 183, 125, 208,  16, 181, 117,  80,
+      14, 215,  93, 240,   4, 218,  86, 208, 240, 182, 110,  67, 218, 147, 158, 192,
+     234, 179, 166, 192, 244, 180, 150,  64, 237, 180,  92, 223, 237, 179,  83, 192,
+     237, 179,  91,  64, 237, 179, 146,  95, 237, 179, 144,  10 };
+
+constexpr byte Sound_C2_COMPRENDRE [128] PROGMEM = {
+       0, 128,  47,  47,  64, 204, 224,   0, 129, 207, 214,  48,  80, 206, 165, 144,
+      81, 174, 157,   7,  70, 174, 134, 160, 133, 179, 142, 160, 137, 172, 150, 192,
+      72, 169, 166, 192,  72, 173, 118, 160,   0, 173, 110,  63, 133, 186, 232,  96,
+     137, 174, 231, 208,  25, 170,   6, 223,  22, 171, 182,  32,  26, 171, 190, 160,
+      69, 175, 199,  64,  70, 175, 199,  64,  26, 169, 198, 192,  27, 169, 198,  64,
+      26, 170, 182,  95,  26, 173, 158,  64,  94, 175, 142,  62,  31, 176, 117,  32,
+      17, 178,  80, 112, 110, 177, 125, 162,  25, 174,  69,  32,  42, 176,  84, 189,
+      42, 176, 156, 192, 106, 176, 148,  63,  42, 175,  91,  32,  42, 175,  88,  11 };
+
+constexpr byte Sound_C2_COMPTER [84] PROGMEM = {
+       0,  84,  47,  47,  64, 204, 224,   0, 129, 207, 214,  48,  80, 206, 165, 144,
+      81, 174, 157,   7,  70, 174, 134, 160, 133, 179, 142, 160, 137, 172, 150, 192,
+      72, 169, 166, 192,  72, 173, 118, 160,   0, 173, 110,  63, 129, 148, 128, 112,
+     129, 185, 120, 112,  16, 215, 207,  48, 169, 183, 158, 176, 249, 183,  94, 188,
+     250, 183, 103, 223, 246, 184,  95,  94, 233, 184,  86,  96, 226, 185,  69,  32,
+     226, 185,  72,  15 };
+
+constexpr byte Sound_C2_CONNAITRE [112] PROGMEM = {
+       0, 112,  47,  47, 128, 180, 248,   0,   0, 146, 202, 144,  85, 182, 245, 144,
+     150, 147, 142, 192, 155, 179, 142, 192,  85, 179, 126, 189, 153, 180,  69,  32,
+     136, 180,  68, 191, 152, 181,  69,  32, 153, 181,  77,  64, 168, 182, 126, 191,
+     184, 182, 126, 191, 164, 183, 142, 224, 245, 183, 126, 193, 228, 183, 117, 162,
+     212, 183,  83, 161, 212, 247, 112, 112, 128, 185, 112, 112,   0, 119, 253,  16,
+      64, 181, 254,  16,  32, 181, 182,  16,  17, 148, 254,  16,  33, 180,   5,  16,
+      33, 180,   4,   0, 192, 150, 252, 159, 192, 185, 252, 160, 128, 185, 248,   3 };
+
+constexpr byte Sound_C2_COPIE [96] PROGMEM = {
+       0,  96,  47,  47, 128, 178, 248,   0,  33, 145, 222,  15,  16,  50, 254, 135,
+      32, 177, 190, 128, 161, 177, 109, 160, 170, 143, 118,  32, 174, 142, 134,  95,
+     191, 141, 134,  63, 190, 141, 126,  32, 174, 141, 117,  27, 196, 175,  96,  80,
+     192, 217, 120, 112,  20, 181, 141,  16,  41, 182,   7,  48,  29, 151,   6,   6,
+     153, 184,  70, 128, 245, 215,  62, 254, 244, 215,  62,  62, 244, 216,  53, 190,
+     224, 247,  53,  63, 216, 215,  52, 190, 212, 216,  44,  64, 212, 216,  40,  13 };
+
+constexpr byte Sound_C2_CORRESPONDANTE [180] PROGMEM = {
+       0, 180,  47,  47,  32, 211, 224,   0,  32, 211, 230,  16,  49, 211, 214,  48,
+      97, 177, 117, 162,  86, 144, 126,  32,  26, 142, 134,  62,  21, 171, 126,  62,
+      37, 139, 133, 160,  21, 143, 158,  64, 169, 148, 150,  64, 164, 182, 141, 160,
+     148, 182, 125, 188,  69, 183, 141, 144,   6, 183, 158,  48,  20, 215, 134,  80,
+       4, 216, 149, 208, 144, 216, 120,  48, 101, 171, 128, 100,  17, 169, 149,  51,
+      33, 169, 109, 158,  16, 169,  77, 224, 132, 182,  92, 191, 132, 182,  77,  63,
+     132, 181,  76, 191, 137, 176,  76,  63,  65, 213,  77,  32,  90, 176, 125, 161,
+      85, 175, 157, 192,  21, 173, 157, 192,  37, 170, 117, 192,  37, 171,  93, 193,
+      38, 171,  93, 162,  25, 171, 117,  35,  85, 172, 133, 163,  25, 170,  76, 162,
+       1, 171,  91, 192,  69, 177, 216,  48,  64, 165, 128, 112,  64, 165, 128, 112,
+      16, 216, 254,  48,   1, 214, 237,  48,  21, 181, 252, 176,  17, 149, 252,  48,
+      17, 149, 248,  22 };
+
+constexpr byte Sound_C2_COTEE [76] PROGMEM = {
+       0,  76,  47,  47, 128, 180, 248,   0,   0, 146, 203, 144,  85, 182, 246, 144,
+     150, 147, 103,  95, 155, 179, 102, 224,  85, 179, 102, 191, 133, 177, 112,  48,
+     192, 186, 104, 112,  70, 183, 160, 112, 237, 183,  95,  36, 250, 184, 103,  94,
+     234, 184,  95,  95, 234, 184,  87,  64, 234, 184,  94, 193, 246, 185,  85,  35,
+     229, 185,  68, 160, 212, 185,  76,  32, 197, 185,  56,   0 };
+
+constexpr byte Sound_C2_COULEUR [112] PROGMEM = {
+       0, 112,  47,  47,  33, 140,   0,   0,  21, 139,  61,  48,  22, 169,   5,  37,
+       6, 134,   5,  32,   1, 139,   5,  32,  21, 176,   5,  61,  33,  84,   5,  60,
+     100, 150,  77,  63, 100, 150,  85,  32, 148, 182, 109, 161, 229, 181, 125, 191,
+     170, 180, 134,  63, 170, 180, 142,  63, 238, 180, 142, 192, 234, 180, 142, 192,
+     254, 180, 142, 192, 238, 180, 142, 192, 170, 179, 142, 224, 170, 179, 150, 193,
+     235, 179, 142, 193, 230, 178, 133, 163, 234, 178, 125,  35, 229, 178, 116, 162,
+     166, 177,  92,  32, 101, 177,  59, 160,  50, 177,  35,  80,  49, 208,   0,  18 };
+
+constexpr byte Sound_C2_CRAYON [88] PROGMEM = {
+       0,  88,  47,  47,  36, 182, 192,   0,  32, 182, 255,  48, 128, 186, 254, 176,
+     164, 182,  93, 160, 168, 183, 119,  32, 184, 184, 119,  96, 185, 184,  95,  95,
+     245, 216,  86,  62, 245, 216,  77, 160, 228, 217,  69,  63, 209, 216,  77,  32,
+     229, 184,  85, 160, 149, 184, 110,  33,  85, 151, 126,  32,  69, 176, 142,  64,
+      20, 168, 134,  96,  36, 168, 125, 160,  20, 165, 125,  33,  40, 165, 116,  34,
+      36, 164, 115, 162, 100, 164, 112,  30 };
+
+constexpr byte Sound_C2_CROCHET [116] PROGMEM = {
+       0, 116,  47,  47,   2, 173, 192,   0,   6, 137, 198,  16,   7, 145, 198, 144,
+       2, 174, 198,  15,   6, 175, 197, 158,   7, 165, 109,  30, 139, 170, 140, 158,
+      91, 169, 125,  32, 171, 170, 125, 160, 170, 170, 126,   1, 169, 142, 126, 192,
+     101, 144, 119,  61,  81, 179, 110,  32,  16, 184,  86, 176,  16, 184,   7,  16,
+       4, 185, 255,  80, 100, 218, 255, 112,  29, 181, 215,  48,  26, 182,   6, 136,
+     107, 181,  94, 128, 189, 182, 110, 190, 189, 182, 119,  95, 249, 183, 111,  96,
+     249, 184, 110, 160, 249, 184,  94,  64, 233, 184,  93, 159, 249, 184,  92, 188,
+     244, 184,  88,   5 };
+
+constexpr byte Sound_C2_CURSEUR [108] PROGMEM = {
+       0, 108,  47,  47,  13, 150, 208,   0,  16, 152, 253, 176,  48, 183,  69,   4,
+     170, 150,  86,  32, 171, 150, 102, 160,  90, 180, 118, 160, 170, 178, 118,  62,
+       5, 178,  69,  32,  17, 178, 253, 176,  66, 183, 254, 208,  17, 182,   6, 112,
+      90, 180, 126, 112, 229, 179, 118, 191, 170, 179, 127,  62, 238, 180, 135,  95,
+     238, 180, 143,  64, 170, 179, 143,  96, 170, 179, 151,  65, 235, 179, 143,  65,
+     230, 178, 134,  35, 234, 178, 125, 163, 229, 178, 117,  34, 166, 177,  92, 160,
+     101, 177,  60,  32,  50, 177,  35, 208,  49, 208,   0,  18 };
+
+constexpr byte Sound_C2_D_ [20] PROGMEM = {
+       0,  20,  47,  47, 144, 176,  40,   0,   0, 179,  67,  15, 169, 181, 117, 160,
+     253, 180, 136,  17 };
+
+constexpr byte Sound_C2_D [64] PROGMEM = {
+       0,  64,  47,  47, 212, 182,  24,   0, 208, 214,  26, 165, 196, 182,  27,  32,
+     212, 182,  27, 160, 105, 183,  77,  32, 185, 184,  86, 160, 184, 184,  95,  32,
+     181, 184, 103, 160, 245, 184, 103, 160, 245, 184,  95,  32, 229, 184,  94, 160,
+     229, 185,  94,  32, 245, 185,  93,  32, 209, 185,  83, 160, 209, 185,  56,  22 };
+
+constexpr byte Sound_C2_DANS [56] PROGMEM = {
+       0,  56,  47,  47, 217, 180,  24,   0,  17, 215,   4,  19,   0, 247, 149, 130,
+      16, 215, 142,   4, 106, 180, 126, 163,  46, 178, 134, 160,  25, 176, 159,  96,
+      25, 204, 183,  95,  37, 203, 158, 223,  20, 169, 173, 160,  20, 199, 181,  62,
+      73, 201, 124,  32,  20, 167,   0,  13 };
+
+constexpr byte Sound_C2_DE [52] PROGMEM = {
+       0,  52,  47,  47,   1,  31,   0,   0,   1,  31,   3,  16,   1, 122, 108, 144,
+       1, 150, 125, 145,  29, 181,  94,  37, 153, 181, 102,  32, 229, 181, 110,  32,
+     229, 180, 110,  64, 233, 180, 109, 190, 253, 180, 101, 192, 253, 180, 101, 160,
+     136, 176,  56,   9 };
+
+constexpr byte Sound_C2_DEBUT [76] PROGMEM = {
+       0,  76,  47,  47,  96, 215,  88,   0, 249, 184,  94, 167, 249, 184, 102, 192,
+     233, 184,  94, 192, 249, 184,  86, 191, 153, 149,  78,  49, 208, 184,  67, 186,
+     208, 185,  72,  80,   5, 147, 224, 112,  49, 183,   5, 172,  97, 183,  29, 163,
+     101, 151,  45, 192, 101, 151,  54,  66, 101, 151,  61, 193, 177, 151,  61,  38,
+     214, 151,  60, 162, 245, 150,  59, 186, 245, 150,  48,  17 };
+
+constexpr byte Sound_C2_DEJA [92] PROGMEM = {
+       0,  92,  47,  47,   0, 186, 248,   0,  37, 184,  29, 129, 169, 184,  94,  32,
+     186, 184, 102, 192, 186, 184, 102, 223, 102, 184,  94, 223,  18, 216,  22, 160,
+      17, 215,   7,  48,   2, 182,   7,  80,   9, 214,   7,  80,   5, 217,   6, 208,
+       2, 181,   6,  64, 102, 181, 126,  32, 105, 180, 134, 191, 165, 180, 142, 160,
+     186, 179, 158, 191, 185, 179, 166,  32, 166, 179, 174, 192, 102, 178, 174, 161,
+     102, 178, 182, 194, 102, 177, 157, 160, 102, 177, 136,   1 };
+
+constexpr byte Sound_C2_DELETE [124] PROGMEM = {
+       0, 124,  44,  47,  20, 215,   0,   0,  20, 214,  60, 143,  25, 215,  62,   4,
+     186, 216,  69, 160, 181, 216,  70,  32, 169, 184,  62,  33, 245, 184,  62,  64,
+     245, 184,  70,  63, 145, 182,  77, 223, 248, 182, 110,  62, 248, 182, 118, 159,
+     248, 182, 119,  30, 248, 182, 127,  30, 248, 182, 135,  63, 248, 182, 135,  95,
+     232, 182, 134, 157, 232, 183, 126,  30, 228, 182, 117, 189, 212, 183, 125,  29,
+     228, 183, 101,  62, 244, 182,  84, 191, 128, 215, 112,  16, 192, 216, 120,  48,
+     128, 214,  96,  80,   0, 152, 251,  16,   0, 183, 244,  16,   0, 188, 252, 144,
+       0, 183, 245,  16,  20, 214, 204, 144,  21, 181, 168,  15 };
+
+constexpr byte Sound_C2_DEMANDER [116] PROGMEM = {
+       0, 116,  47,  47, 129, 152, 248,   0, 230, 180, 110,  65, 170, 180, 110, 160,
+     154, 180, 110,  95,  69, 181,  69,  61,  80, 186,  60, 191,  72, 181,  60, 192,
+      80, 187,  69,  32,   9, 172, 110, 160,  10, 170, 198, 192,  26, 170, 158,  63,
+      74, 173, 166,  64,  25, 174, 126,  64,  28, 176, 101, 160,  73, 178,  60, 190,
+      76, 179,  68,  32, 136, 178,  72,  16,  20, 216, 136, 112,  42, 182,   5, 135,
+     106, 183,  94,   1, 122, 183, 103,  31, 122, 183, 111,  61, 246, 184, 102,  64,
+     228, 184,  85,  64, 228, 184,  93,  96, 230, 185,  84,  33, 230, 185,  59,  33,
+     217, 184,  64,   9 };
+
+constexpr byte Sound_C2_DEMI [80] PROGMEM = {
+       0,  80,  47,  47, 128, 215,  24, 128,   6, 181, 252, 144,  18, 186, 254, 144,
+      18, 181, 254,  15,  33, 214,  54, 133,  38, 181,  71,   0, 107, 181, 103,  32,
+     127, 148, 119,  95, 107, 149, 103,  95, 107, 149,  79,  29,  26, 148,  70, 157,
+      90, 148,  78,  30,  72, 148,  53,  33, 137, 116,  61,  64, 137, 114,  60, 161,
+      69, 245,  69, 224, 145, 215,  77, 189,  96, 215,  77,  31, 145, 152,  72,  31 };
+
+constexpr byte Sound_C2_DES [52] PROGMEM = {
+       0,  52,  47,  47,  16, 184, 248,   0,  16, 184, 252, 159, 244, 183,  85, 160,
+     248, 183, 102, 160, 245, 184, 111,  64, 249, 184, 103,  95, 233, 184, 102, 191,
+     228, 185,  93, 160, 224, 185,  93,  32, 212, 185,  92,  32, 196, 184,  91,  32,
+     200, 184,  88,   7 };
+
+constexpr byte Sound_C2_DESIRER [116] PROGMEM = {
+       0, 116,  47,  47,  98, 215, 168,   0, 229, 184,  86,  63, 228, 184, 103,  64,
+     232, 184,  95,  32, 232, 184,  95,  63, 172, 183,  78,  62, 233, 184,  69, 160,
+     149, 184,  69,  48, 174, 184,  62,  80,  94, 185,  70, 176, 110, 217,  63,  48,
+     106, 217,  70,  31, 174, 217,  70, 160, 244, 217,  78, 160, 232, 185,  86, 160,
+     229, 184,  94, 192, 213, 182,  94,  60,  81, 183,  86,  60,  33, 181,   6,  48,
+     101, 181, 102, 176, 169, 181, 109, 165, 233, 182, 126, 160, 232, 183, 126, 192,
+     228, 183, 118, 160, 232, 184, 102,  64, 216, 185,  93,  63, 248, 185,  92, 161,
+     217, 184,  72,  15 };
+
+constexpr byte Sound_C2_DIEZE [120] PROGMEM = {
+       0, 120,  47,  47, 170, 216,  32,   0, 245, 217,  52, 192, 230, 216,  61,  34,
+     245, 216,  77, 131, 229, 184, 102,  32, 229, 183, 110, 129, 233, 183, 126, 160,
+     249, 183, 143,  95, 249, 183, 143,  64, 249, 182, 143,  95, 233, 182, 135,  95,
+     169, 183, 134, 159, 185, 183, 126, 191, 189, 182, 118, 223, 125, 182, 110,  64,
+     189, 182, 109, 191, 188, 182,  93,  31, 188, 182,  84, 128, 185, 182,  84,  32,
+     185, 181,  67, 160, 188, 181,  59,   0, 185, 181,  75,  32, 101, 181,  67,  64,
+     122, 180,  83,  64, 105, 179,  83,  64, 106, 179,  90, 128, 101, 179,  90,   0,
+     101, 179,  89, 128, 164, 179,  88,  14 };
+
+constexpr byte Sound_C2_DIFFICILE [124] PROGMEM = {
+       0, 124,  47,  47,   8, 215,   0,   0,  77, 218,  61,   5, 174, 217,  61, 145,
+     217, 217,  62,  34, 216, 218,  54,  34, 216, 217,  62,  64,  21, 217,   7,  48,
+      20, 218,   6, 208,  20, 183,   6,  80,   9, 218,   6, 208, 229, 217,  62,  32,
+     244, 217,  62,  64, 221, 217,  62,  59,   9, 217,   6,   0,  72, 212,   7, 208,
+       4, 215,   6,  80,   9, 183,   6, 240,  25, 217,   7, 112, 104, 217,  70,  13,
+     233, 217,  54,  94, 229, 216,  53, 255,  72, 216,  53, 192, 244, 215,  69,  95,
+     244, 214,  69,  95, 245, 214,  76, 222, 232, 181,  92, 192, 180, 181, 131, 192,
+     104, 180, 160,   1, 184, 179, 152,  15, 104, 179, 184,  15 };
+
+constexpr byte Sound_C2_DIRE [64] PROGMEM = {
+       0,  64,  47,  47, 200, 216,  24,   0,  16, 215,   4, 146,  24, 214,   5, 128,
+     157, 218,  46,  65, 233, 218,  54, 193, 169, 218,  54, 192, 233, 218,  54, 224,
+     229, 186,  70,  96, 101, 180, 117, 224,  41, 178, 109,  60,  21, 179,  69,  16,
+       0, 211,   4, 208,  25, 177, 148,  80,  57, 177, 124,  80,  57, 208, 184,  14 };
+
+constexpr byte Sound_C2_DIRIGE [120] PROGMEM = {
+       0, 120,  47,  47,   0, 184, 104,   0, 254, 217,  61, 188, 185, 217,  70,  34,
+     245, 217,  70, 162, 249, 185,  78, 192, 185, 184,  94, 223, 121, 183,  86, 191,
+      37, 215,   6,  36,  33, 183,   7,  80,  36, 216,   6, 187, 249, 184,  95,  34,
+     185, 185, 103,  32, 185, 185,  95,  63, 250, 185,  87,  32, 186, 185,  87,  32,
+     185, 185,  78, 160, 245, 185,  70,  65, 249, 184,  78,  65, 186, 184,  78,  33,
+     114, 216,  70,  32,  17, 216,  22,  32,   5, 184,  22, 176,  16, 217,  22, 208,
+       6, 182,  22, 208,  68, 185,  68,  36, 144, 180,  75, 161, 128, 185,  58, 160,
+     132, 181,   9, 160, 144, 180,   0,  18 };
+
+constexpr byte Sound_C2_DO [48] PROGMEM = {
+       0,  48,  47,  47,  65, 182, 120,   0,  86, 180,  71,  36, 234, 178,  94, 161,
+     182, 173,  86,  96, 166, 172,  94,  96, 166, 172,  93, 159,  82, 163,  53,  32,
+     130, 198, 108, 158, 210, 201,  75, 128, 234, 168,  74, 159, 170, 168,  72,  26 };
+
+constexpr byte Sound_C2_DOLLARD [128] PROGMEM = {
+       0, 128,  47,  47, 100, 181,  64,   0, 100, 181,  69,   9, 154, 180, 101, 160,
+     234, 174, 109, 192, 254, 173, 117,  31, 253, 174, 117,  64, 253, 174, 117, 130,
+     249, 144, 117, 191, 228, 146, 117, 157, 160, 147, 101, 191, 104, 180, 101, 192,
+     172, 180, 102,  63, 184, 180, 126, 157, 248, 180, 151,  32, 248, 180, 175,  32,
+     249, 179, 183,  64, 173, 179, 183,  95, 189, 178, 183,  64, 124, 178, 191,  32,
+     125, 178, 190, 160, 125, 178, 190, 191, 125, 177, 190, 160, 184, 177, 190, 192,
+     188, 177, 181, 159, 180, 177, 173,  32, 168, 176, 172, 160, 184, 176, 172, 192,
+     124, 176, 139, 192, 104, 176, 138, 223, 100, 176, 138,  64, 104, 176, 128,  13 };
+
+constexpr byte Sound_C2_DONC [80] PROGMEM = {
+       0,  80,  47,  47,  38, 183,   0,   0,  17, 183,   7, 176, 134, 179, 109, 160,
+      65, 208, 125, 191,  85, 169, 141, 192, 136, 166, 157, 223, 138, 212, 141, 224,
+     137, 177, 141,  64, 141, 168, 133,  65, 136, 177, 116, 194,  80, 218,  76,  65,
+      64, 217,  80,  48, 128, 185, 104, 112,  68, 185, 254,  16,   8, 185, 254,  48,
+      73, 185, 253, 176, 133, 216, 253,  48,  54, 184, 132, 176,  54, 183,   0,  22 };
+
+constexpr byte Sound_C2_DONNE [92] PROGMEM = {
+       0,  92,  47,  47,  38, 183,   0,   0,  17, 183,   5,  48, 134, 179, 110,  32,
+     169, 177, 142,  32, 169, 177, 142,  32, 169, 177, 150,  64, 169, 177, 150,  64,
+     173, 179, 142,  64, 169, 179, 118,  61, 173, 179, 102,  62, 220, 179,  45, 191,
+     140, 177,  60,  32, 200, 181,  44, 223, 136, 182,  36, 255,  25, 180,  52, 160,
+     164, 179, 108, 160, 165, 179, 132, 192, 169, 179, 124, 138, 153, 178, 124, 142,
+     105, 179, 116,  32,  85, 180,  84,  64,  21, 179,  64,   0 };
+
+constexpr byte Sound_C2_DROITE [96] PROGMEM = {
+       0,  96,  41,  47,   5, 181, 248,   0,   2, 147, 254,  48,   2, 169,   4,  60,
+      37, 170,   3,  32, 129, 177, 187, 176, 199, 170, 179, 208, 214, 166, 123,   0,
+     138, 166, 132,  32, 155, 167, 124, 160, 138, 167, 133,  32, 133, 139, 150,  34,
+     132, 173, 174, 160, 132, 143, 182, 158, 188, 175, 198, 192, 184, 176, 190,   1,
+     184, 176, 189, 160, 152, 179, 181,  62,  64, 173, 168,  80,  64, 173, 168, 112,
+       4, 183, 237,  48, 109, 181, 140,  48, 232, 181,  99, 191, 232, 179, 123, 192 };
+
+constexpr byte Sound_C2_DU [44] PROGMEM = {
+       0,  44,  47,  47, 212, 183,  32,   0,  65, 153,   4,  18,  82, 216, 173, 129,
+     101, 184,   6,  33, 164, 216,  46,  33, 182, 184,  38, 193, 166, 184,  38, 192,
+     231, 184,  54, 192, 246, 183,  54, 223, 117, 183,   0,   9 };
+
+constexpr byte Sound_C2_E [44] PROGMEM = {
+       0,  44,  47,  47,  65, 182,  88,   0,  85, 179, 101,  38, 233, 179,  94, 255,
+     169, 179, 102, 191, 169, 179, 102, 190, 229, 179,  93, 161, 208, 180,  92,  32,
+     192, 179,  99,  33, 192, 180,  98, 191, 192, 179,  96,   0 };
+
+constexpr byte Sound_C2_ECOUTE [108] PROGMEM = {
+       0, 108,  47,  47,  41, 185,  16,   0, 164, 185, 102, 140, 185, 185,  95, 192,
+     233, 185,  87,  62, 217, 186,  77,  63, 196, 184,  88, 112, 128, 153, 232, 112,
+     192, 144, 237,  16,  16, 141,   3,   3,  70, 172,  85,  32,   6, 172,  86,  61,
+       2, 173,  70,  62,  81, 209,  86, 191,  81, 211,  86, 191, 154, 182,  85, 189,
+     137, 181,  51,  61, 128, 214,  64, 112,   0, 150, 248,  96,  80, 216, 224,  97,
+       5, 218, 252,  16,  65, 185, 252, 176,   1, 215, 197, 176,  18, 182, 157, 208,
+      82, 182, 157,  48, 163, 181, 148,  16, 146, 181, 144,   9 };
+
+constexpr byte Sound_C2_ECOUTEUR [120] PROGMEM = {
+       0, 120,  46,  47,   0, 150, 232,   0, 144, 184, 117, 135, 224, 185, 103,  64,
+     216, 185,  86, 192, 212, 185,  83, 160, 196, 184,  88,  32, 208, 153,  88,  80,
+      17, 174,   0, 112,  64, 147, 237,  16,  22, 145,  61,  37,  97, 177,  77, 187,
+     149, 211,  69,  62, 132, 181,  59,  58, 132, 212,  72,  48, 128, 181,  72, 112,
+     100, 215, 184, 112,  21, 214, 173, 143, 213, 213, 101, 145, 229, 180, 126, 192,
+     229, 180, 134, 192, 217, 178, 133, 191, 214, 179, 125, 192, 234, 180, 117, 192,
+     218, 180, 125, 192, 202, 179, 133,  64, 238, 180, 125,  95, 238, 180, 124, 222,
+     153, 179, 112,   7, 141, 177, 112,  15 };
+
+constexpr byte Sound_C2_ECRAN [96] PROGMEM = {
+       0,  96,  47,  47, 165, 183,  88,   0, 233, 183, 110,   2, 232, 184, 119,  32,
+     229, 185, 103,  64, 165, 185,  94, 160, 217, 185,  85,  63,  32, 214, 248, 112,
+      38, 178, 224, 112,  37, 176, 245, 144,  53, 176, 198,  16,  37, 176,   6,  48,
+      42, 175,  36, 154,  22, 173, 125,  32, 105, 173, 149, 160,  42, 172, 150,  32,
+      42, 170, 126, 192,  42, 170, 126,  63,  38, 169, 126,  65,  41, 169, 133,  33,
+      42, 168, 108, 162,  25, 165,  84,  34,  25, 163,  59, 164,  78, 168,  48,  18 };
+
+constexpr byte Sound_C2_ECRIS [84] PROGMEM = {
+       0,  84,  47,  47,  64, 148, 240,   0, 144, 218,  92, 131, 208, 185,  85, 128,
+     224, 217,  93, 160, 224, 217,  94,  33, 244, 217,  86, 192, 224, 218,  69, 190,
+     196, 217,  76, 160,  96, 185,  40, 112, 101, 185, 117, 144,  97, 184, 206, 176,
+      98, 183, 190,  80,  81, 215,   5, 176, 213, 185,  53,  38, 202, 152,  61,  64,
+     225, 186,  53,  63, 209, 217,  45,  64, 209, 217,  44, 192, 196, 217,  43, 160,
+     212, 217,  24,  21 };
+
+constexpr byte Sound_C2_EFFACE [100] PROGMEM = {
+       0, 100,  47,  47,  16, 184, 104,   0, 228, 184, 100, 162, 250, 184, 102,  32,
+     117, 184,  95,  64, 117, 184, 110, 189, 116, 184,  93,  63,  37, 183,   6, 176,
+      17, 183, 254, 112,  64, 152, 254, 112, 101, 179, 157, 175, 166, 179, 158, 145,
+     106, 180, 175,  92, 102, 180, 182, 222,  86, 180, 174,  62, 165, 180, 165, 157,
+     101, 181, 149,  63, 102, 181, 141,  47,  85, 181, 133, 144,  17, 217, 181, 208,
+       0, 216, 196, 208,  16, 215, 252, 208, 137, 181, 116,  80, 105, 180, 147, 208,
+      89, 179, 128,  24 };
+
+constexpr byte Sound_C2_EGAL [136] PROGMEM = {
+       0, 136,  47,  47,   4, 184,   0,   0, 244, 185, 101,  43, 224, 185,  93,  64,
+     204, 185,  85, 192, 200, 185,  77,  27, 176, 186,  68,  59, 224, 186,  50, 136,
+     224, 186,  40,  16, 140, 182,  40,  48,  12, 183,   0,  80,  88, 185,  77,  30,
+     217, 185,  93, 128, 233, 184, 110, 129, 153, 183, 134, 160, 184, 182, 166, 191,
+     184, 181, 182, 191, 188, 180, 190, 223, 184, 180, 190, 192, 188, 180, 182, 222,
+     184, 180, 182, 189, 184, 181, 166, 160, 188, 181, 142, 191, 185, 181, 142,  32,
+     184, 181, 125, 192, 184, 181, 117,  32, 248, 181, 108,  32, 252, 181, 108,  63,
+     188, 181,  92,  64, 252, 181,  83, 160, 252, 181,  83,  31, 248, 181,  74, 160,
+     252, 180,  82, 192, 236, 180,  96,  13 };
+
+constexpr byte Sound_C2_ELLE [56] PROGMEM = {
+       0,  56,  47,  47, 184, 183, 144,   0, 248, 183, 150,  95, 244, 183, 134, 192,
+     184, 215, 143,  64, 185, 183, 135,  95, 249, 183, 102,  64, 252, 183, 101, 223,
+     252, 182, 101, 223, 252, 182, 100, 223, 253, 182,  99, 192, 248, 181,  91,  64,
+     188, 181,  99,   6, 173, 181, 104,  14 };
+
+constexpr byte Sound_C2_EN [32] PROGMEM = {
+       0,  32,  47,  47,   0, 153, 248,   0,  68, 203, 189,  19, 170, 204, 142, 192,
+      85, 204, 150, 193, 101, 203, 142, 192,  40, 202, 126, 224,  84, 169, 120,   9 };
+
+constexpr byte Sound_C2_ENCORE [108] PROGMEM = {
+       0, 108,  47,  47,  42, 175,  32,   0,  42, 170, 124, 189,  42, 170, 126, 160,
+      42, 170, 126,  63,  38, 169, 126,  65,  41, 169, 133,  33,  42, 168, 108, 160,
+      25, 165,  84,  32,  25, 163,  59, 161,  45, 170,  40,  48,  16, 145, 232, 112,
+      17, 177, 213, 176,  37, 178,  45,  37,   1, 142, 142,  32,   5, 170, 158, 191,
+      21, 173, 158, 190,  22, 173, 174,  63, 105, 173, 166, 127, 105, 173, 158,  63,
+      41, 173, 126,  62, 188, 173, 125, 192, 121, 173, 117, 192, 121, 173, 101,  80,
+      42, 172,   4, 208, 194, 179, 236,  80, 199, 178, 232,  12 };
+
+constexpr byte Sound_C2_ENFANT [88] PROGMEM = {
+       0,  88,  47,  47,  64, 153, 224,   0, 133, 207, 155, 142, 133, 205, 166,   4,
+     102, 202, 150,  32, 194, 202, 182,  64, 198, 201, 174,  64, 102, 200, 126,  32,
+     202, 202, 142,  95, 132, 168, 101,  57,  37, 183,   6, 176,  17, 183, 254, 112,
+      64, 152, 254, 112,  46, 171, 150,  35,  38, 171, 158,  94,  38, 202, 102,  64,
+      39, 202,   6,  95,  39, 169,  77, 191,  99, 170, 116, 160,  22, 167,   4,  64,
+      22, 168,   3, 190,  21, 168,   0,  12 };
+
+constexpr byte Sound_C2_ENTER [144] PROGMEM = {
+       0, 144,  44,  47, 164, 182, 168,   0, 248, 182, 174,  15, 180, 182, 158,  36,
+     164, 182, 158, 160, 180, 182, 159,  32, 184, 182, 159, 223, 188, 182, 151,  27,
+     188, 182, 142, 128, 108, 182, 126,  29,  72, 182,  85, 161, 152, 180,  85,  32,
+     152, 180,  84, 158, 148, 179,  76,  64,  65, 179,  68,  61,  66, 180,  67,   0,
+      68, 180, 128,  48, 128, 214,  96, 112,   0, 149, 251,  16,  16, 213, 245, 176,
+      21, 214, 197,  16,  25, 182,  13,  16, 221, 180, 100,  36, 233, 179, 125,  58,
+     249, 179, 133,  62, 169, 179, 141,  95, 236, 147, 133,  63, 232, 147, 132, 128,
+     232, 147, 132,  32, 173, 146, 140, 157, 237, 146, 141,  63, 253, 146, 132,   0,
+     212, 145, 123, 191, 217, 145, 107,  95, 137, 114, 122, 192,  88, 114,  88,  15 };
+
+constexpr byte Sound_C2_ESCAPE [136] PROGMEM = {
+       0, 136,  47,  47,  16, 183, 152,   0, 100, 183, 150,  15, 232, 182, 142,  33,
+     244, 182, 126,  64, 248, 182, 125, 129, 172, 181, 101,  28, 252, 181, 100, 128,
+      16, 185, 181,  48,  16, 214,   5, 176,  20, 183,   5, 240,  80, 183, 245,  48,
+      16, 181, 248,  48,   0, 184,   0, 112,   8, 186, 246, 144,   8, 185, 247, 144,
+       8, 184, 206, 144, 228, 184,  93, 167, 232, 184, 110, 189, 244, 184, 127,  58,
+     248, 183, 143,  61, 248, 183, 143,  95, 248, 183, 135,  63, 248, 183, 134, 159,
+     232, 183, 134,   0, 216, 183, 133, 159, 232, 184, 125,  32, 232, 184, 125, 159,
+     228, 183, 126,  30, 228, 184, 125, 159, 245, 184,  92, 223, 245, 184,  84,  63,
+     217, 151,  67,  64, 217, 150,  72,  14 };
+
+constexpr byte Sound_C2_ESPACE [152] PROGMEM = {
+       0, 152,  43,  47,  16, 183,  88,   0, 168, 182, 134,  15, 228, 182, 134,  32,
+     244, 183, 126, 160, 248, 182, 127,  33, 248, 182, 127,  63, 248, 182, 127, 158,
+     184, 182, 127,  26, 184, 182, 118,   0, 152, 182, 109,   0,  85, 183, 134,  80,
+      16, 186, 254, 112,   0, 185, 253, 176,  21, 182, 141, 208,  84, 180, 152, 112,
+     168, 178, 149, 143, 248, 177, 150,   0, 248, 178, 175,  54, 248, 178, 175, 159,
+     185, 178, 183, 190, 184, 179, 183, 223, 184, 179, 183,  32, 168, 179, 182, 158,
+     168, 179, 174, 191, 168, 179, 174,   0, 168, 180, 165, 157, 100, 179, 157,  30,
+     152, 178, 132, 176,  20, 182, 117,  80,   4, 182, 189, 112,  20, 181, 172, 240,
+      89, 181, 124,  48, 232, 179, 115,   0, 232, 178, 115,  63, 228, 179, 122, 160,
+      80, 146, 114,  95,  80, 147,  56,  15 };
+
+constexpr byte Sound_C2_ESSAY [72] PROGMEM = {
+       0,  72,  47,  47, 169, 184,  93, 128, 250, 184, 102, 165, 249, 184,  94,  64,
+     169, 184,  77,  32,  89, 184,  60, 176, 101, 216, 117,  48,  16, 216,  92, 176,
+       1, 153, 254,  80,   1, 153, 254,  80,  21, 215, 206, 208, 101, 215,  94,  39,
+     253, 182, 127,  64, 122, 183, 119, 127, 182, 216,  94, 224, 181, 216,  86, 127,
+     230, 182,  77,  64,   1, 178, 152,  24 };
+
+constexpr byte Sound_C2_EST [28] PROGMEM = {
+       0,  28,  47,  47,  20, 181, 104,   0, 233, 183, 134, 161, 233, 183, 134,  96,
+     233, 183, 134,  64, 228, 182, 126,  64, 228, 183, 104,  30 };
+
+constexpr byte Sound_C2_EST_CE [52] PROGMEM = {
+       0,  52,  47,  47,  20, 181, 104,   0, 233, 183, 134, 161, 233, 183, 134,  96,
+     233, 183, 134,  64, 228, 182, 126,  64, 228, 183, 109, 191,  68, 184, 109, 160,
+      89, 182, 142, 112,  20, 215, 126,  80,   0, 186, 109, 240,   0, 186, 109,  80,
+      16, 180, 104,   0 };
+
+constexpr byte Sound_C2_ET [36] PROGMEM = {
+       0,  36,  47,  47,   0, 153, 248,   0, 148, 184,  91,  12, 248, 185,  93, 192,
+     229, 185,  94,  64, 229, 185,  94, 192, 228, 185,  94, 223, 164, 185,  94,  60,
+     180, 153,  96,   0 };
+
+constexpr byte Sound_C2_ETRE [88] PROGMEM = {
+       0,  88,  47,  47,   0, 153, 248,   0,  84, 182, 171, 135, 253, 182, 158,  32,
+     233, 182, 150, 160, 250, 182, 151,  65, 168, 183, 135,  64, 244, 183, 118,  33,
+     232, 183, 117, 191, 233, 183,  92, 190, 161, 215, 100,  63, 192, 215, 104, 112,
+     128, 153, 112, 112,   1, 185, 251, 176,   4, 183, 253, 176,  23, 181, 253, 176,
+     128, 186, 253,  80, 129, 150, 253,  80,  37, 177, 244, 208,  25, 175,   4, 208,
+      85, 177, 148,  48,  25, 176,  96,  27 };
+
+constexpr byte Sound_C2_EU [36] PROGMEM = {
+       0,  36,  47,  47,   0, 208,   0,   0, 254, 180, 100, 187, 209, 180,  93, 223,
+     217, 180,  86,  33, 209, 213,  94,  64, 197, 181,  85, 192, 190, 180,  85, 192,
+     190, 180,  80,  12 };
+
+constexpr byte Sound_C2_EXACTE [172] PROGMEM = {
+       0, 172,  47,  47,   0, 153, 248,   0, 180, 183, 158,  39, 184, 183, 150, 134,
+     168, 184, 127,  66, 232, 185, 126, 162, 152, 184, 101,  32, 164, 184,  96,  16,
+     176, 153, 120,  48, 160, 217,  64,  80,  16, 118,  84,  48,  20, 150,  50, 144,
+      85, 184,  44, 191,  20, 183,   5,  29,   5, 184,   5,  94,  21, 183,   5, 144,
+       4, 182,   5, 208,  24, 181,  37,  61, 105, 181, 110, 164, 105, 181, 127,   2,
+     169, 181, 159, 192, 169, 181, 175,  22, 165, 148, 175,  61, 180, 149, 166, 188,
+     185, 149, 149, 190, 188, 149, 132, 128, 168, 149, 155, 144, 160, 149, 154,  16,
+     160, 181, 144,  16, 128, 215, 120, 112, 132, 183, 146,  16,   4, 183, 229,  16,
+       8, 151, 245, 144,  32, 153, 252, 144,   0, 184, 250,  16,   0, 184, 248,  16,
+       0, 184, 248,  48,   0, 184, 248,  80,   0, 183, 211, 144,  85, 215, 221,  48,
+      85, 182, 189,  80,  90, 181, 172,  48,  90, 181, 168,   5 };
+
+constexpr byte Sound_C2_EXCLAMATION [160] PROGMEM = {
+       0, 160,  47,  47,  20, 181, 104,   0, 233, 183, 134, 161, 233, 183, 134,  96,
+     233, 183, 134,  32, 180, 151, 118,  32,  20, 150,  61, 240,  16, 150,  61, 240,
+      16, 150,  61, 144,  24, 149, 150, 176,   4, 150,   5, 176,  20, 182, 109,  16,
+     164, 181,  93,  35, 233, 180,  93, 160, 248, 181, 126, 191, 248, 181, 151,  63,
+     185, 180, 159,  95, 185, 148, 142, 128,  72, 147,  85,  33,  72, 146,  85,  64,
+     152, 147, 142,  32, 168, 180, 150, 191, 168, 180, 150, 192, 108, 181, 142,  32,
+      85, 183, 124, 240,   5, 177, 196, 240,   9, 182, 253,  48,   9, 184, 253,  80,
+       9, 217,   5, 176,  25, 186,  77, 176,   8, 184,  29, 176, 153, 183,  77, 144,
+     246, 150,  84, 191, 245, 117,  92,  32,  84, 143,  92, 192,  84, 142, 100,  29,
+      68, 169, 107, 160, 128, 148, 131,  32, 128, 182, 130, 128, 129, 150, 128,   5 };
+
+constexpr byte Sound_C2_EXEMPLE [144] PROGMEM = {
+       0, 144,  47,  47, 148, 184, 186, 128, 232, 184, 149,  47, 245, 184, 142, 192,
+     181, 185, 110, 193, 217, 185,  84,  32, 212, 185,  74,  63, 200, 152,  73, 190,
+      84, 149,  80,  64, 254, 151,  83, 187, 185, 182,  84, 223, 106, 182,  76, 190,
+     106, 181,  60,  60,  85, 181,  27, 223, 170, 179,  92,  65, 106, 178, 125, 193,
+      41, 178, 150,  63,  37, 174, 174,  95,  53, 204,  45,  95,  37, 169, 189,  95,
+     133, 173, 196, 192,  37, 168, 164, 191,  36, 168,  51, 191,  21, 167,  67,  32,
+      73, 162, 122, 191,   0, 175, 136,  80,   0, 175, 136, 112,  16, 149,  48, 112,
+      20, 182,  13, 144,  40, 181, 101,  48, 108, 181, 100, 161, 109, 180, 108, 192,
+     185, 179, 147, 160, 169, 179, 138, 160,  89, 177, 130,  63,  94, 177, 120,  14 };
+
+constexpr byte Sound_C2_EXERCICE [136] PROGMEM = {
+       0, 136,  47,  47,   0, 153, 248,   0, 228, 185, 111,  64, 216, 185,  85, 222,
+     208, 186,  51, 160,  96, 151,  76, 192, 180, 183,  61,  32, 165, 184,  69, 192,
+     217, 184,  86,  35, 164, 183, 103,  65, 228, 183, 119, 192, 228, 183, 119, 160,
+     180, 183, 127,  95, 169, 181, 102,  32,  32, 181,   7,  48,  64, 186, 254, 240,
+      38, 215, 182, 112, 223, 217,  78, 240, 222, 217,  69, 146, 212, 216,  61,  64,
+     228, 217,  60, 223, 233, 185,  60, 222, 105, 185,  69, 144,  30, 184,  94,  48,
+      21, 216, 102, 112,  21, 215, 102, 112,  30, 215, 110, 112,  37, 181, 101, 176,
+     165, 181, 109,  13, 233, 180, 108, 161, 217, 181, 116, 145, 216, 181, 124,  32,
+     148, 180,  75, 142,  80, 212,  88,  14 };
+
+constexpr byte Sound_C2_F [52] PROGMEM = {
+       0,  52,  47,  47,  20, 183, 160,   0, 168, 183, 149, 133, 245, 183, 150,  32,
+     249, 183, 142,  64, 233, 183, 142, 223, 165, 183, 135,  95, 189, 150, 118,  61,
+     104, 149, 133,  29,  16, 183, 149, 240,  64, 182, 157, 112,   1, 182, 164, 240,
+      17, 184, 152,  12 };
+
+constexpr byte Sound_C2_FACILE [120] PROGMEM = {
+       0, 120,  47,  47,  37, 183,   0,   0,  17, 183, 253, 112,  64, 152, 254, 112,
+      22, 182, 254,  16,  22, 182, 222,  48,  22, 182, 157, 142, 170, 180, 142,  32,
+     187, 181, 158, 160, 185, 181, 150, 223, 181, 181, 134,  63, 105, 183, 141, 208,
+     149, 215, 149,  48, 149, 215, 140, 176, 165, 216, 124,  80,  85, 216, 132, 208,
+      90, 184, 148, 208,  14, 218, 124, 208, 174, 216,  77,  48, 234, 216,  60, 223,
+     230, 217,  60, 223, 239, 216,  60, 192, 234, 215,  60, 194, 241, 182,  68, 193,
+     181, 213,  68, 193, 101, 182,  76, 161, 101, 181,  84,  65, 101, 181,  84,  32,
+     101, 181,  84,  60, 101, 181,  80,  18 };
+
+constexpr byte Sound_C2_FAIRE [104] PROGMEM = {
+       0, 104,  46,  47,  37, 183,   0,   0,  17, 183, 253, 112,  64, 152, 254, 112,
+      22, 182, 254,  16,  22, 182, 222,  48, 168, 181, 134, 192, 253, 182, 143,  96,
+     249, 182, 126, 223, 248, 183, 126, 127, 248, 183, 126,  64, 249, 183, 118,  94,
+     233, 183, 117,  60, 249, 183, 117,  95, 185, 183, 117,  64, 121, 183, 117,  66,
+     169, 182, 117,  66, 249, 182, 117,  16, 102, 181,  85,  48,  64, 152, 133,  16,
+     128, 186, 125,  48,  32, 179, 125,  48, 160, 179, 125,  80,  33, 180, 124, 176,
+      21, 179, 124, 208,  21, 178, 120,  15 };
+
+constexpr byte Sound_C2_FAIS [48] PROGMEM = {
+       0,  48,  47,  47,  37, 183,   0,   0,  17, 183, 253, 112,  64, 152, 254, 112,
+      22, 182, 254,  16,  22, 182, 222,  48, 168, 181, 134, 192, 253, 182, 143,  96,
+     249, 182, 134, 223, 248, 183, 134, 127, 248, 183, 134,  64, 249, 183, 112,  12 };
+
+constexpr byte Sound_C2_FEMME [108] PROGMEM = {
+       0, 108,  47,  47,  37, 215, 248,   0,  16, 215, 254,  16,  16, 215, 254,  48,
+      17, 216, 254, 208,  17, 216, 254, 208,  17, 214, 238, 208, 149, 179, 134,  61,
+     234, 178, 150, 160, 170, 179, 175,  95, 170, 179, 183,  95, 106, 179, 175,  64,
+      86, 178, 167,  64,  86, 178, 150, 160,  70, 179, 126,  32, 133, 182,  85,   1,
+     137, 182,  69,  33, 133, 184,  69, 192, 138, 184,  61, 192, 153, 184,  70,  65,
+     154, 184,  70,  65,  72, 181,  69, 192,   8, 179,  86,   3, 103, 177, 126,  32,
+      86, 180, 125, 160,  90, 181,  92, 192,  86, 181,  80,   0 };
+
+constexpr byte Sound_C2_FLECHE [116] PROGMEM = {
+       0, 116,  47,  47, 116, 184,  88,  32,  37, 183,   5,  48,  17, 183, 254, 112,
+      64, 152, 254,  80,   0, 183,   5, 164, 152, 182, 101,  32, 104, 181, 101, 129,
+      44, 181,  94, 161, 105, 182, 135, 160, 165, 182, 143, 192, 165, 183, 135,  95,
+     185, 183, 118, 222, 249, 182, 109, 187, 165, 183, 117,  32,  17, 185,  77, 128,
+      10, 185, 255,  16,  10, 185, 255,  48,  21, 217, 255,  80,  25, 218, 175,  80,
+      21, 217, 254, 208,  69, 219, 254, 144,  68, 220, 254,  48,   8, 220, 253, 208,
+      28, 218, 253,  80,   8, 217, 252, 176,   8, 218, 252,  48,   1, 153,  67, 176,
+       0, 184,  80,  11 };
+
+constexpr byte Sound_C2_FOIS [72] PROGMEM = {
+       0,  72,  47,  47,  65, 153, 248,   0,  16, 184, 246,  48,  16, 217, 198, 176,
+      69, 183, 246, 208,   4, 146, 222, 208,  65, 148, 205, 176, 133, 135, 132, 160,
+      70, 166, 125,  64, 134, 170, 125, 191,  74, 169, 150,  32, 198, 174, 150, 191,
+     158, 176, 166, 192, 138, 177, 159,  64, 154, 177, 166, 192, 150, 176, 166,  33,
+      86, 176,  93,  32,  38, 176,  64,   2 };
+
+constexpr byte Sound_C2_FONCTION [124] PROGMEM = {
+       0, 124,  47,  47,  16, 181, 248,   0,  17, 182, 245, 144,  80, 182, 246,  48,
+      17, 180, 254,  80,  85, 182, 238, 176,  85, 181, 238,  80,  69, 182, 229, 176,
+     146, 170, 133,  34, 132, 172, 174,  32, 136, 171, 174,  64,  72, 178, 141, 191,
+      72, 179, 100, 191, 129, 212,  68, 192,  69, 174, 107, 188,  17, 175, 118,  48,
+      17, 183, 119,  48,  21, 217, 119,  48,  17, 218, 119,  48,  34, 186, 118, 208,
+      33, 219, 118, 208,   9, 185, 119,  80,  21, 185, 118, 208, 149, 183,  94,   1,
+      85, 147, 126,  64,  68, 141, 149, 192,  69, 175, 157,  32,  69, 170, 148,  33,
+       8, 178, 140,  33,  65, 185, 115, 160,  68, 180, 104,   3 };
+
+constexpr byte Sound_C2_FRANC [88] PROGMEM = {
+       0,  88,  47,  47,  17, 182, 232,   0,  17, 214, 230,  16,  65, 185, 255,  80,
+      82, 182, 222,  80,  65, 178, 220, 176, 130, 172, 220, 176,  18, 173, 212, 176,
+      67, 182, 245,  48,   1, 249, 245,  48,  70, 186, 205, 176,  70, 172, 150, 189,
+     150, 172, 143,  64,  86, 204, 151,  95,  22, 199, 174, 192,  66, 200, 166, 192,
+      69, 168, 175,  65, 106, 200, 109, 163,  69, 164, 116,  34,   5, 163,  99, 165,
+      68, 187,  51,  64,  64, 186,  80,  18 };
+
+constexpr byte Sound_C2_G [60] PROGMEM = {
+       0,  60,  47,  47, 165, 183,  72,   0,  21, 183,  20, 190,   1, 185,   5,  32,
+       1, 185, 254, 208,   5, 184, 254, 208,   4, 183, 255,  80,  40, 183,  63,  33,
+     117, 184, 103,  64, 117, 184, 103,  32, 117, 184, 102, 224, 245, 185, 101,  64,
+     233, 185, 100, 155, 165, 184,  84,   1, 164, 185,  80,   6 };
+
+constexpr byte Sound_C2_GAUCHE [88] PROGMEM = {
+       0,  88,  47,  47,  54, 171,   0,   0,  55, 171,   5, 134,  50, 171,   4, 128,
+      68, 116, 149,   0, 169, 140, 110,  32, 165, 171, 110, 160, 169, 171, 109, 160,
+     169, 171, 109, 192, 173, 170, 109, 192, 174, 170, 109, 223,  32, 178,   5,  48,
+     132, 184, 254, 176, 132, 185, 254, 176, 129, 185, 254, 208, 133, 218, 254, 240,
+      64, 216, 254, 112,  33, 181, 214,  16, 160, 179, 116, 191, 208, 179, 116,  32,
+     228, 179, 124,  32, 164, 179, 120,   0 };
+
+constexpr byte Sound_C2_GRAND [68] PROGMEM = {
+       0,  68,  47,  47,  41, 160,   0,   0,  68, 152, 252, 185,  41, 180,   5, 176,
+      90, 180,  70,  34, 153, 181, 109, 162,  21, 180,  94,  29,  38, 177,  70,  63,
+      70, 178, 126,  32,  94, 176, 142,  64, 110, 174, 158, 193, 174, 174, 166, 192,
+     171, 172, 158,  64, 154, 171, 141, 192,  26, 170, 149, 191,  20, 165, 116,  64,
+      69, 167, 120,   9 };
+
+constexpr byte Sound_C2_GUILLEMET [120] PROGMEM = {
+       0, 120,  47,  47,   1, 214,   0,   0,  85, 212,  44,   6, 242, 217,  53,  64,
+     244, 249,  45,  96, 248, 249,  44, 160, 242, 249,  44,  30, 179, 217,  60,  63,
+     216, 249,  52,  64, 225, 217,  44, 160, 233, 185,  53, 163, 250, 184,  54,   0,
+     169, 150,  78,  63, 152, 149,  77, 154, 136, 148,  76, 128, 136, 148,  76, 192,
+     200, 150,  76, 192, 136, 148,  84, 192, 169, 181,  94,  32, 185, 182, 118, 191,
+     169, 182, 127,   0, 169, 182, 135,  32, 105, 182, 143,  64, 185, 183, 135,  32,
+     232, 182, 117, 160, 201, 181,  93,  31, 217, 183, 101,  32, 216, 183, 100, 160,
+     213, 183,  84,  32, 137, 151,  96,   3 };
+
+constexpr byte Sound_C2_H [68] PROGMEM = {
+       0,  68,  47,  47, 166, 178, 208,   0, 250, 178, 206,   7, 233, 179, 198,  64,
+     183, 179, 199,  95, 103, 179, 191,  62, 107, 180, 191,  32, 106, 180, 182, 191,
+      41, 180, 174,   0, 107, 180, 133,  16,  10, 181,   6,  48,   0, 185, 254, 176,
+       0, 185, 254, 208,   0, 186, 246,  48,   0, 186, 254,  48,   0, 187, 254, 112,
+       0, 186, 248,   3 };
+
+constexpr byte Sound_C2_HA_NOM [80] PROGMEM = {
+       0,  80,  47,  47,  84, 179, 192,   0, 149, 176, 182,  66, 102, 178, 207,  64,
+     102, 178, 207,  95, 106, 180, 183,  95, 106, 180, 134, 191,  90, 180,  45, 191,
+     158, 180,  44, 193, 222, 180,  60, 193, 153, 179,  61,  36, 162, 211, 117, 162,
+     166, 173, 125, 193, 132, 174, 141, 194, 133, 178, 125, 192, 197, 180, 117, 221,
+     197, 179, 124, 220, 133, 179, 108,  61, 128, 213,  91,  63, 132, 214,  88,   8 };
+
+constexpr byte Sound_C2_I [32] PROGMEM = {
+       0,  32,  47,  47, 248, 249,  48,   0, 248, 249,  46, 196, 248, 249,  38, 160,
+     248, 249,  38, 192, 248, 249,  38, 223, 248, 249,  38, 222, 248, 249,  32,  28 };
+
+constexpr byte Sound_C2_IL [60] PROGMEM = {
+       0,  60,  47,  47,   0, 183,   0,   0, 209, 186,  70, 192, 225, 216,  54, 192,
+     228, 217,  62, 192, 246, 217,  62, 192, 104, 217,  54, 222, 226, 183,  78, 192,
+     226, 182,  78,  64, 230, 182,  78,  64, 234, 181,  78,  95, 237, 181, 118, 223,
+     189, 180, 126, 222, 106, 180, 142, 138, 173, 180, 136,  14 };
+
+constexpr byte Sound_C2_INEXACTE [172] PROGMEM = {
+       0, 172,  47,  47, 212, 216,  80,   0, 212, 216,  85,  14, 213, 216,  94,  39,
+     218, 184,  94, 160, 153, 181,  85, 160, 152, 181,  85, 192, 232, 183, 110, 161,
+     232, 183, 127,  32, 233, 183, 135, 192, 229, 184, 127,   1, 212, 185, 118, 160,
+      96, 186, 109,  32,  68, 185,  82, 160, 132, 151,  80,  80,  84, 150,  84,  33,
+      89, 183,  76, 222, 149, 182,  84,  30,  21, 182,  68,  95,  21, 182,  68, 159,
+     105, 181,  93, 162, 169, 181, 110, 162, 185, 181, 135,  32, 165, 181, 143, 157,
+     101, 181, 175, 224, 102, 181, 175,  27, 165, 181, 167,  32, 165, 149, 142,  32,
+     168, 149, 133, 160, 164, 149, 108, 160, 160, 149, 121,  48, 160, 182, 144,  80,
+      64, 215, 112, 112,  64, 215, 112, 112,   0, 183, 112,  16,  20, 213, 112,  80,
+     232, 180, 117,  34, 237, 180, 134,  95, 168, 180, 133, 223, 164, 179, 141,  62,
+     169, 179, 132, 190, 148, 178, 115,  62, 132, 177, 112,  30 };
+
+constexpr byte Sound_C2_INFERIEUR [192] PROGMEM = {
+       0, 192,  47,  47, 100, 180, 192,   0, 100, 180, 194, 143, 164, 180, 188,   1,
+     164, 180, 173, 128, 165, 180, 174,   0, 165, 180, 174, 128, 100, 180, 182, 192,
+     168, 180, 174, 160, 104, 180, 166, 191, 168, 180, 166,  30, 100, 179, 149, 155,
+       4, 180, 204, 176,   5, 181, 197,  48,   5, 183, 197,  80,  21, 182, 109,  48,
+       8, 182,  13, 176,  41, 183,  54,  48, 233, 183,  93,  41, 249, 183, 101, 189,
+     249, 183, 102,  29, 249, 183, 118,  63, 189, 182, 118,  95, 117, 181, 149, 187,
+      53, 182,  85, 176,  85, 184,  69, 208, 133, 184,  84, 134, 148, 216,  84,  32,
+     149, 183,  67, 128, 165, 215,  64,  96, 229, 215,  68, 131, 229, 215,  77,   0,
+     250, 183,  93, 128, 250, 182, 102,   0, 250, 182, 126,  32, 185, 181, 134,  63,
+     253, 180, 142,  96, 253, 180, 142,  96, 252, 180, 141, 191, 232, 179, 141,  32,
+      37, 177, 205, 208,  53, 176, 205,  16,  53, 177, 172, 176,  37, 177, 156,  30,
+      37, 177, 115, 128,  25, 177,  83,   0,  24, 177,  66,   0,  44, 177,  56,  29 };
+
+constexpr byte Sound_C2_INTERROGATION [156] PROGMEM = {
+       0, 156,  47,  47, 173, 180, 160,   0, 173, 180, 166, 143, 169, 180, 175,  64,
+     168, 180, 159,  32,  88, 180, 150, 189,  92, 176,  84,  60, 128, 179, 128, 112,
+       4, 183, 156,  16,   8, 182, 189,  16,  25, 182, 181, 144, 221, 182,  92,  47,
+     233, 183,  93,  60, 233, 183, 101, 188, 253, 148, 117, 223, 102, 173, 123, 222,
+      86, 170, 112,  80,  86, 169, 115,   7, 170, 170, 124,  32, 170, 170, 124, 161,
+     167, 139, 100, 223, 183, 142,  74, 191,  80, 151,  56,  80, 230, 151, 101,  32,
+     233, 151, 117, 160, 249, 150, 142, 160, 248, 181, 133, 224,  10, 247, 128,  48,
+      11, 247, 130, 144,  10, 247, 132, 208,  10, 247, 132, 240, 154, 183, 100,  64,
+     154, 183, 100,  32, 214, 145, 107, 192,  72, 137, 139, 192, 132, 168, 123,  32,
+      68, 168, 123,  64, 148, 168, 114, 160, 129, 151, 136,  26 };
+
+constexpr byte Sound_C2_J [40] PROGMEM = {
+       0,  40,  47,  47,  30, 186, 120,   0,  30, 186, 125,  32,  30, 186, 117, 160,
+      30, 186, 118,  16,  30, 186, 110,  48,  26, 186,  94,  32, 246, 217,  45, 224,
+     246, 217,  45, 224, 246, 217,  40,   0 };
+
+constexpr byte Sound_C2_JAMAIS [88] PROGMEM = {
+       0,  88,  47,  47,  30, 186, 120,   0,  30, 186, 124,  18,  30, 186, 125,  32,
+      30, 186, 117, 160,  30, 186, 118,  80, 160, 213, 118,  66, 160, 180, 142,  64,
+     144, 180, 141, 190, 148, 180, 141, 191, 148, 179, 117, 190, 132, 146,  67, 191,
+     200, 146,  67, 192, 136, 146,  59,  33, 200, 148,  67, 192, 212, 182, 101,  32,
+     233, 183, 109, 160, 228, 184, 101,  96, 209, 185,  93,  64, 208, 185,  84, 162,
+     233, 184,  68,  33, 214, 152,  56,  10 };
+
+constexpr byte Sound_C2_JE [72] PROGMEM = {
+       0,  72,  48,  47,  16, 218,   0,   0,  17, 187,   6,  48,   9, 182, 254,  48,
+      33, 219,  86, 176, 116, 218, 110, 176,   9, 183, 254,  25,  73, 181, 102, 192,
+      84, 180, 102, 192, 154, 180, 110, 193, 154, 180, 102,  35, 234, 179, 101,  35,
+     234, 179,  92, 162, 231, 180,  92, 161, 129, 180,  83, 160, 129, 180,  59,  34,
+     132, 213,  50,  63, 132, 212,  56,  17 };
+
+constexpr byte Sound_C2_JOUR [84] PROGMEM = {
+       0,  84,  44,  47,  84, 181,  88,   0,  84, 182, 101, 146,  20, 182,  78,  32,
+       0, 184,  54, 160,   4, 184,   6, 208,  32, 218,   6, 208,   4, 184, 254, 208,
+       4, 182, 254, 130,  69, 182,  78,  34,  73, 171, 110,  96,  25, 160, 125, 192,
+     154, 170,  92, 192, 154, 168,  84, 127, 133, 165, 124, 223,  19, 203, 164, 208,
+      35, 173, 149,  80,  66, 178, 221,  80,  82, 206, 196, 176,  66, 176, 236,  48,
+      35, 174, 208,  15 };
+
+constexpr byte Sound_C2_JOYSTICK [136] PROGMEM = {
+       0, 136,  47,  47, 216, 181,  32,   0,  17, 216,  53, 144,   2, 217,  79,  48,
+      17, 218,  71,  48,  86, 182, 111,  34, 169, 148, 127,  32, 166, 146, 143,  63,
+     174, 146, 151,  96, 170, 148, 135,  64, 249, 183, 110, 192, 235, 183,  93, 222,
+      17, 217, 110,  48,  85, 216, 109, 176, 149, 216, 116, 176, 145, 215, 116,  48,
+     144, 216, 112,  80,  80, 215, 192, 112,   6, 216, 165,  16, 174, 216,  84,  48,
+     249, 184,  86,  36, 245, 184,  86,  64, 229, 185,  77, 160, 229, 185,  77,  32,
+     213, 185,  60,  32, 224, 217,  67,  63, 152, 184,  75,  32, 192, 214,  64, 112,
+     192, 214,  64, 112,  20, 185, 229,  16,  88, 185, 166,  48,  21, 184,  85,  80,
+      37, 184, 108, 176,  37, 184, 104,   0 };
+
+constexpr byte Sound_C2_JUSTE [112] PROGMEM = {
+       0, 112,  47,  47,  16, 118,   0,   0,   4, 117,   4,  16,  17, 181,   5, 144,
+      17, 182,   6, 144,  16, 216,   7,  48,  17, 185,   7,  80,  17, 182,   7,  37,
+      32, 181,   7,  34, 102, 150,  71,  67, 107, 150,  71,  65, 170, 150,  70, 160,
+     170, 182,  70, 160, 148, 215,  69, 160,  88, 215,  45, 176,   5, 181,   6,  80,
+       0, 187,   5, 240,   0, 184,   5,  48,  17, 213,   4, 144,  17, 213,   0, 127,
+      17, 213,   0,  96,  16, 180,  10, 144,   0, 215,  85, 176, 244, 179, 125,  95,
+     210, 178, 125,  63, 153, 179, 125,  32, 165, 179,  84,  61, 165, 179,  80,  22 };
+
+constexpr byte Sound_C2_K [24] PROGMEM = {
+       0,  24,  47,  47, 165, 151, 112,   0, 169, 150, 151,  36, 171, 178, 199,  96,
+     190, 178, 199,  95, 190, 178, 192,  28 };
+
+constexpr byte Sound_C2_L_ [32] PROGMEM = {
+       0,  32,  45,  47, 252, 182,  96,   0, 164, 182, 108,  19, 248, 182,  92, 160,
+     232, 182,  93,  32, 248, 182,  93, 193, 248, 214,  94,  33, 245, 214,  86,  65 };
+
+constexpr byte Sound_C2_L_ECRAN [124] PROGMEM = {
+       0, 124,  47,  47, 252, 182,  96,   0, 164, 182, 108,  19, 248, 182,  92, 160,
+     232, 182,  93,  32, 248, 182,  93, 193, 248, 214,  94,  33, 245, 214,  86,  65,
+     165, 214,  78, 161, 233, 183, 111,  33, 232, 184, 119,  32, 229, 185, 103,  64,
+     165, 185,  94, 160, 217, 185,  85,  63,  32, 214, 248, 112,  38, 178, 224, 112,
+      37, 176, 245, 144,  53, 176, 198,  16,  37, 176,   6,  48,  42, 175,  36, 155,
+      22, 173, 125,  32, 105, 173, 149, 160,  42, 172, 150,  32,  42, 170, 126, 192,
+      42, 170, 126,  63,  38, 169, 126,  65,  41, 169, 133,  33,  42, 168, 108, 162,
+      25, 165,  84,  34,  25, 163,  59, 164,  78, 168,  48,  18 };
+
+constexpr byte Sound_C2_L [60] PROGMEM = {
+       0,  60,  47,  47,   0, 153, 248,   0,  84, 183, 163, 134, 168, 183, 157,  64,
+     228, 183, 159,  32, 249, 183, 143,  64, 182, 183, 158, 161, 186, 183, 142, 190,
+     120, 183, 126, 192, 120, 182, 126, 224, 124, 182, 118,  95, 108, 182, 100, 192,
+      60, 181,  92,  63, 124, 181, 122, 191, 189, 181, 144,   4 };
+
+constexpr byte Sound_C2_LA_BAS [84] PROGMEM = {
+       0,  84,  47,  47, 248, 181,  96,   0, 248, 181, 100,  18, 248, 181,  84, 128,
+     253, 181,  85,  33, 237, 181,  93, 161, 249, 181, 110, 193, 248, 181, 151,  33,
+     249, 181, 159,  64, 170, 180, 135,  95, 166, 179, 118,  60, 128, 177,  96,  80,
+      17, 181,   0, 112, 150, 179, 134,  40, 170, 178, 151,  61, 233, 179, 167,  95,
+     185, 178, 183,  96, 170, 177, 175,  64, 165, 177, 166, 193,  88, 177, 149,  33,
+     148, 176, 144,   4 };
+
+constexpr byte Sound_C2_LA [52] PROGMEM = {
+       0,  52,  47,  47, 244, 214, 104,   0, 241, 214, 109,  33, 245, 214, 109, 160,
+     245, 214, 110,  64, 233, 180, 109, 192, 233, 180, 118,   1, 168, 180, 142, 128,
+     249, 180, 158, 128, 250, 180, 174, 159, 250, 178, 182, 224, 169, 177, 182, 192,
+      90, 173, 120,  30 };
+
+constexpr byte Sound_C2_LE [52] PROGMEM = {
+       0,  52,  47,  47,  84, 182,  32,   0, 249, 149,  85,  58, 153, 150,  77,  32,
+     233, 149,  69, 161, 233, 149,  69,  64, 214, 150,  61, 162, 250, 149,  61, 161,
+      88, 151,  62, 160, 234, 181,  94, 160, 254, 180, 102, 192, 254, 180, 102,  32,
+     233, 180,  96,   4 };
+
+constexpr byte Sound_C2_LES [64] PROGMEM = {
+       0,  64,  47,  47, 248, 182,  88,   0, 248, 182,  85,  57, 232, 182,  84, 191,
+     248, 182,  85,  32, 240, 182,  85,  65, 244, 214,  86,  34, 228, 214,  86,  65,
+     252, 184, 111,  33, 212, 185, 103,  96, 228, 185, 102,  61, 228, 185, 101, 191,
+     232, 185,  85,  62, 228, 185,  92,  34, 228, 185,  99, 161, 228, 185,  88,   8 };
+
+constexpr byte Sound_C2_LEUR [96] PROGMEM = {
+       0,  96,  47,  47,  21, 181,  88,   0, 106, 181, 117,  18, 229, 181, 117,  59,
+     246, 181, 101, 160, 213, 182, 102,  35, 181, 182,  86,  33, 184, 182,  86, 193,
+     184, 181,  78,  32, 184, 181,  70,  64, 172, 213, 103,  34, 252, 181, 127,  32,
+     252, 180, 135,  64, 233, 180, 143,  64, 249, 180, 135,  96, 253, 180, 135,  64,
+     249, 180, 126, 192, 249, 179, 127,  33, 244, 180, 126, 161, 248, 180, 126,  33,
+     232, 179, 125, 161, 233, 180, 100, 160, 236, 180, 107, 160, 152, 179,  88,   0 };
+
+constexpr byte Sound_C2_LIVRE [108] PROGMEM = {
+       0, 108,  40,  47,  72, 215, 120,   0, 152, 183,  92, 128, 248, 215,  77,  62,
+     200, 215,  61,  33, 180, 215,  70,  34, 116, 215,  86, 160,  96, 215,  70, 193,
+      98, 186,  54, 192, 101, 185,  54, 224, 109, 151,  70, 223, 110, 150,  78,  24,
+     110, 149,  86,  63, 106, 147,  77, 190, 105, 176,  69,  63,  25, 175,  53, 160,
+       9, 175,  53, 160,   4, 174,  77, 160,   4, 172, 101, 160, 104, 173, 109,  32,
+     122, 173, 101,   0, 185, 175, 117,  64, 169, 176, 125,   0, 168, 175, 125,  32,
+     189, 176, 125,  64, 100, 176, 133,   0,  88, 175, 116, 160 };
+
+constexpr byte Sound_C2_M [72] PROGMEM = {
+       0,  72,  47,  47,   0, 153, 248,   0, 100, 183, 164,  14, 244, 183, 134,  37,
+     180, 183, 126,  32, 164, 183, 142, 160, 185, 183, 143,  64, 117, 183, 143,  33,
+     105, 182, 126, 222, 140, 182,  61,  34, 156, 183,  52, 192, 136, 183,  44, 255,
+     141, 182,  36, 255,  78, 179,  12, 254, 106, 177,  93,  64, 105, 178, 157,  64,
+     120, 178, 148, 223, 120, 178, 144,  14 };
+
+constexpr byte Sound_C2_MA [64] PROGMEM = {
+       0,  64,  47,  47,  68, 182,  64, 128, 136, 184,  66, 186, 132, 183,  59,  32,
+     136, 183,  60,  32, 136, 183,  60,  34, 136, 183,  60, 160, 136, 182,  68, 161,
+     166, 177, 134,  33, 166, 178, 158, 160, 165, 179, 175,  64, 169, 179, 183, 160,
+     165, 178, 183, 192, 149, 178, 182, 192,  98, 146, 157,  63, 100, 178, 152,   6 };
+
+constexpr byte Sound_C2_MADAME [128] PROGMEM = {
+       0, 128,  47,  47, 153, 180,  72,   0, 157, 179,  58,   7, 156, 184,  75,  32,
+     205, 183,  59, 183,  93, 179,  60, 193,  37, 178,  54, 160, 106, 180, 167,  33,
+     185, 181, 167,  64, 184, 182, 142, 160, 184, 182, 118,  32,  64, 219, 248, 112,
+     245, 182, 117, 163, 185, 182, 142, 188, 185, 181, 150, 190, 168, 181, 166, 160,
+     169, 181, 174, 191, 106, 180, 183,  64, 170, 179, 166, 192, 105, 179, 141, 160,
+     153, 179,  84, 160, 153, 181,  68,  65, 153, 183,  76, 161, 137, 182,  69,  64,
+     153, 182,  69,  65, 148, 181,  76, 161, 136, 180,  76,  65,  90, 179, 132, 194,
+      85, 181, 124, 193,  89, 180,  99, 160,  21, 179,   3,  32,  20, 181,   0,  17 };
+
+constexpr byte Sound_C2_MAINTENANT [128] PROGMEM = {
+       0, 128,  47,  47, 196, 181,  64,   0, 197, 183,  59,  59, 196, 183,  59,  35,
+     197, 183,  60, 163, 197, 183,  60, 161, 197, 151,  60, 192, 197, 182,  69,  32,
+     132, 181, 102,  33, 228, 181, 166, 224, 208, 180, 142,  65, 212, 179, 117,  60,
+     129, 179, 124,  32, 208, 213, 104,  48, 196, 213, 112,  80,  86, 184, 168, 112,
+      86, 182, 198,  48,  87, 182,  54,  48, 203, 182,  93, 160, 197, 175,  75, 190,
+     213, 177,  67,  63, 201, 178,  67,  64, 206, 179,  59, 158, 201, 182,  59, 160,
+     216, 178, 109,  64, 132, 176, 132, 192, 150, 173, 132, 192, 217, 172, 132, 160,
+     134, 169, 140, 161,  82, 172, 140, 192, 101, 170, 140, 192,  37, 170, 136,   4 };
+
+constexpr byte Sound_C2_MAIS [60] PROGMEM = {
+       0,  60,  47,  47, 220, 180,  48,   0, 220, 179,  50, 185, 204, 181,  50, 192,
+     204, 180,  43,  65, 200, 178,  43, 162, 200, 181,  52,  64, 189, 183, 110,  62,
+     184, 184, 118, 162, 185, 184, 127,  32, 172, 184, 118, 192, 148, 185, 109, 192,
+     236, 185, 101,  94, 220, 185, 108,  32, 216, 185, 120,  14 };
+
+constexpr byte Sound_C2_MAISON [104] PROGMEM = {
+       0, 104,  47,  47,   0, 153, 248,   0,   4, 181,  66, 185,  68, 184,  84, 192,
+      68, 183,  61,  64,  69, 150,  61,  65,  69, 149,  45, 162, 102, 183, 103,  32,
+     118, 184, 103,  33, 182, 184, 103,  64, 249, 184,  94, 161, 186, 183,  94,  64,
+     186, 183,  77, 190, 187, 183,  85,  63, 166, 215,  84, 222, 119, 214,  60, 160,
+      39, 182,   4, 191,   3, 181,   5, 192,  86, 212, 109, 163,  85, 179, 125, 161,
+      68, 174, 125, 192, 133, 171, 133,  64, 136, 208, 125,  96, 132, 209, 116,  34,
+     128, 184, 114, 161, 132, 216, 112,   4 };
+
+constexpr byte Sound_C2_MAJUSCULE [148] PROGMEM = {
+       0, 148,  47,  47, 204, 179,  56,   0, 200, 178,  58, 139, 204, 151,  50, 160,
+     216, 145,  59,  34, 148, 179, 108, 128, 168, 181, 150,  64, 168, 181, 150, 128,
+     185, 181, 126, 192, 120, 181, 118,  23,  36, 182,  86,  62,  21, 182,  30, 112,
+     181, 150,  76, 164, 168, 182,  76, 223, 188, 182,  68,  61,  85, 188,  44, 144,
+       4, 187,  68, 176,  38, 182, 252, 240,   1, 185, 253,  80,  32, 152, 252, 144,
+      32, 184, 230, 144,  33, 152, 174,  16,   5, 149,   5,  16,  33, 152,  37,  16,
+     165, 184,  60,   4, 217, 120,  59, 160, 233, 151,  68,  30, 169, 151,  68, 190,
+     169, 151,  85,  95, 249, 150,  76,  95, 229, 150,  75, 157, 224, 214,  67, 160,
+     181, 150,  51, 192, 237, 182,  59, 192, 252, 181,  67, 192, 190, 180,  67,  96,
+     172, 180,  88,  13 };
+
+constexpr byte Sound_C2_MANETTE [100] PROGMEM = {
+       0, 100,  59,  47, 200, 181,  32,   0, 132, 182,  59, 146, 196, 183,  59, 193,
+     132, 180,  60, 160, 153, 179, 142, 162, 164, 181, 167,  64, 168, 182, 151,  64,
+     152, 181, 126, 160, 136, 181,  77, 160, 136, 181,  69,  32, 136, 180,  60, 160,
+     132, 183,  69, 161, 168, 183, 118, 160, 164, 183, 135,  32, 164, 183, 143,  64,
+     164, 183, 143,  65, 164, 183, 127,  34, 228, 183, 117, 162, 209, 185, 124,  32,
+     192, 214,  64, 112,  33, 182, 208, 112, 102, 182, 190,  48,  43, 181, 166,  16,
+     246, 180, 107,  68 };
+
+constexpr byte Sound_C2_MATIN [92] PROGMEM = {
+       0,  92,  47,  47, 205, 179,  40,   0, 136, 181,  51, 190, 140, 181,  45,  64,
+     136, 181,  54,  65,  73, 183,  70, 192,  73, 181,  70, 192, 105, 179, 111,  35,
+     184, 181, 175,  64, 168, 182, 167,  64, 152, 181, 101, 192, 212, 181, 136,  48,
+     129, 152, 144, 112,  86, 181, 120, 112, 169, 180, 118, 129, 168, 180, 150,  95,
+     169, 180, 158, 222, 101, 180, 158, 192, 165, 179, 158, 192, 100, 179, 150, 193,
+     180, 178, 108,  66,  64, 141,  82, 164,   0, 173,  16,  17 };
+
+constexpr byte Sound_C2_ME [56] PROGMEM = {
+       0,  56,  47,  47, 200, 182,  44,  59, 137, 182,  52, 160,  69, 183,  45,  32,
+     137, 182,  45,  32,  72, 183,  45, 192,   0, 180,  46,  34,  38, 178,  62, 160,
+      26, 180,  78, 160,  90, 180, 110, 192, 171, 179, 110,  62, 169, 179, 109,  32,
+     175, 179,  75, 190, 106, 180,  80,  14 };
+
+constexpr byte Sound_C2_MERCI [76] PROGMEM = {
+       0,  76,  47,  47, 132, 186,  72,   0, 148, 185,  75,  17, 208, 185,  51, 191,
+     165, 183,  85,  66, 164, 151, 126,  64, 228, 151, 126, 192, 169, 150, 118,  63,
+      32, 181, 246, 189,  68, 186, 254, 208,  64, 217, 254, 208,  80, 220, 101, 208,
+      16, 214, 101, 208,  26, 216, 101, 208, 245, 217,  69, 171, 249, 217,  70, 192,
+     229, 217,  69, 194, 209, 217,  43, 161, 209, 217,  40,  17 };
+
+constexpr byte Sound_C2_MES [64] PROGMEM = {
+       0,  64,  47,  47, 136, 181,  48,   0, 204, 179,  43, 222, 152, 181,  52, 192,
+     156, 180,  52, 192,  72, 181,  45,  64, 169, 182, 110, 161, 173, 184, 127,  64,
+     233, 185, 119,  64, 232, 185, 118, 160, 232, 185, 110, 192, 164, 185, 102,  33,
+     132, 186, 101,  33, 216, 186,  83, 161, 132, 187,  59,  37, 132, 186,  56,  22 };
+
+constexpr byte Sound_C2_MESDAMES [148] PROGMEM = {
+       0, 148,  47,  47, 200, 179,  32,   0, 204, 180,  33, 158, 204, 184,  35, 161,
+     204, 184,  35, 193, 204, 183,  35, 194, 201, 183,  44,  66, 137, 182,  45,  38,
+     185, 184, 102, 160, 169, 185,  94, 193, 168, 217, 111,  64, 185, 185,  77, 188,
+     212, 184,  66, 160, 212, 184,  72,  16,  64, 182,   0, 112,  88, 182,  84,  17,
+     253, 183, 118,  62, 233, 182, 142, 189, 249, 181, 166, 190, 185, 180, 182, 191,
+     254, 179, 182,  63, 190, 179, 198,  64, 189, 179, 181, 223, 105, 178, 149, 191,
+     110, 178,  68, 190, 157, 179,  44,  32, 157, 179,  28,  64, 158, 179,  43, 160,
+     217, 178,  34, 192, 222, 180,  35,  64, 223, 180,  59,  64, 158, 180,  51, 192,
+     166, 177,  67,  64, 189, 177, 115, 160, 185, 178, 147, 160, 185, 178, 147, 160,
+     189, 178, 144,  15 };
+
+constexpr byte Sound_C2_MESSIEURS [112] PROGMEM = {
+       0, 112,  47,  47, 200, 184,  56,   0, 204, 183,  43,  20, 204, 183,  43,   0,
+     204, 184,  35, 195, 204, 183,  36,  65, 204, 184,  45,  35, 204, 183,  53,  66,
+     148, 184,  70, 161, 185, 184,  95, 192, 248, 185,  95,  34, 232, 184,  78,  63,
+     185, 184,  69,  64, 175, 184,  69,  16, 167, 216,  76, 208,  91, 215,  69, 112,
+      79, 217,  61, 240, 107, 184,  61, 240, 245, 183,  77, 221, 230, 152,  78,  95,
+     213, 151,  86,  95, 209, 151,  86,  95, 145, 182,  94,  32, 166, 181,  94,  64,
+      86, 181,  85, 192, 214, 181,  84, 160, 213, 181,  83, 130, 192, 151,  80,   0 };
+
+constexpr byte Sound_C2_MET [60] PROGMEM = {
+       0,  60,  47,  47, 132, 152,  56,   0, 132, 151,  61,  61, 144, 184,  61,  32,
+     144, 153,  69,  63,  80, 183,  69, 161, 165, 182, 119,   0, 181, 182, 127,  32,
+     185, 183, 127,  32, 185, 183, 127,  64, 169, 183, 127,  65, 148, 184, 110,  65,
+     212, 184,  93,  33, 132, 153,  68,  36, 132, 183,  56,  20 };
+
+constexpr byte Sound_C2_METTRE [108] PROGMEM = {
+       0, 108,  47,  47, 200, 181,  48,   0, 140, 182,  66, 148, 204, 181,  59, 160,
+     204, 182,  60, 192, 148, 181,  77,  66, 169, 182, 134, 160, 185, 183, 151, 192,
+     184, 183, 143,  33, 232, 183, 134, 192, 248, 184, 118,  61, 228, 183, 108, 191,
+      20, 215, 224,  80,  21, 215,  72, 112,  64, 181,  96, 112,  16, 183, 116,  16,
+      20, 216, 238,  16,  21, 215, 230, 144,  21, 215, 158,  16,   2, 181, 254,  80,
+      33, 178, 253, 208, 106, 178, 125,  94,  90, 177, 132, 223,   5, 175, 123, 192,
+     106, 177,  98, 223,  37, 177,   0,  12, 101, 177, 144,  14 };
+
+constexpr byte Sound_C2_MI [48] PROGMEM = {
+       0,  48,  47,  47,  80, 217,  56,   0, 137, 146,  58,  31, 201, 139,  42, 160,
+     202, 150,  43, 192, 201, 151,  45,  64, 142, 148,  53,  65, 136, 214,  70,  64,
+     136, 248,  70,  96, 130, 217,  77, 192, 212, 245,  59,  95, 128, 247,  56,   1 };
+
+constexpr byte Sound_C2_MIDI [64] PROGMEM = {
+       0,  64,  47,  47, 137, 148,  64,   0, 137, 148,  70,  65, 137, 148,  69, 160,
+     146, 183,  79,  32, 133, 215,  79,  64, 197, 216,  70, 191, 192, 217,  61,  62,
+     144, 185,  75, 160, 128, 184,  48,  80, 222, 216,  24, 112, 237, 217,  44, 176,
+     250, 217,  36, 187, 245, 217,  36, 192, 233, 217,  44, 224, 217, 217,  32,  12 };
+
+constexpr byte Sound_C2_MIEN [68] PROGMEM = {
+       0,  68,  47,  47, 144, 152,  40,   0, 160, 184,  44, 223,  84, 215,  53, 160,
+     164, 215,  69, 193, 164, 215,  78,  32, 164, 214,  86,  65, 164, 214,  94, 161,
+     169, 215, 103,  32, 185, 182, 135,  64, 169, 181, 159,  95, 100, 180, 167,  95,
+     100, 180, 166, 191,  84, 180, 174,  62,  84, 213, 141,  62,   4, 176, 100,  63,
+      68, 178, 128,  14 };
+
+constexpr byte Sound_C2_MIEUX [68] PROGMEM = {
+       0,  68,  45,  47,   0, 153, 248,   0, 144, 212,  67,  24, 128, 181,  60,   0,
+     144, 217,  44,  32, 144, 216,  44, 160, 137, 150,  52, 192, 129, 151,  53, 161,
+     144, 186,  62,  32, 128, 185,  62,  64, 148, 185,  70,  64, 148, 185,  78, 191,
+     169, 183,  95,  32, 104, 182, 103,  64, 169, 180, 119,  64, 105, 179, 111,  96,
+     105, 180, 104,   4 };
+
+constexpr byte Sound_C2_MOI [68] PROGMEM = {
+       0,  68,  47,  47, 200, 180,  24,   0, 200, 183,  27,  17, 196, 184,  19, 162,
+     132, 216,  29,  64, 136, 216,  29,  65, 200, 216,  45, 194, 196, 217, 102,  64,
+     196, 220, 118, 193, 193, 187, 142, 193, 196, 214, 166, 160,  84, 209, 150, 191,
+      85, 175, 174, 191, 106, 173, 190, 223, 169, 174, 198, 222, 169, 175, 198,  60,
+     169, 175, 184,  15 };
+
+constexpr byte Sound_C2_MOINS [84] PROGMEM = {
+       0,  84,  47,  47, 204, 180,  32,   0, 201, 183,  43,  62, 201, 184,  27, 160,
+     132, 183,  36,  34, 136, 217,  36,  32, 136, 215,  37,  64, 200, 215,  45, 193,
+     136, 215,  54,  35, 200, 215, 102,  33, 197, 215, 118, 193, 196, 210, 150, 193,
+     132, 204, 167,  64, 101, 174, 167,  64, 106, 177, 183,  95, 105, 178, 198, 222,
+     105, 179, 198, 191, 105, 179, 198, 223, 101, 179, 190,  62, 101, 179, 157,  61,
+     165, 179, 144,   8 };
+
+constexpr byte Sound_C2_MON [84] PROGMEM = {
+       0,  84,  47,  47, 204, 177,  48,   0, 200, 181,  59, 160, 204, 181,  43, 160,
+     200, 178,  36,  32, 201, 182,  44, 160, 201, 183,  45, 160, 201, 183,  37, 161,
+     201, 184,  37, 192, 201, 183,  46,  65, 202, 183,  54,  64, 201, 183, 102,  32,
+      70, 173, 142,  34, 130, 177, 158,  64, 133, 178, 158,  64, 133, 174, 150,  28,
+     133, 174, 150,  64, 133, 174, 150,  95, 128, 184, 141,  63, 133, 196, 124,  62,
+     133, 196, 120,   4 };
+
+constexpr byte Sound_C2_MONSIEUR [96] PROGMEM = {
+       0,  96,  47,  47,  64, 182,  56,   0, 144, 185,  83, 145, 196, 184,  44, 189,
+     208, 185,  52, 162,  84, 181,  94, 193,  84, 181, 103,  64, 144, 213, 102, 161,
+     144, 213,  86,  64, 118, 216, 134, 144,  57, 184, 126, 208,  22, 183, 150, 208,
+      14, 185, 254, 240,   8, 184, 255,  80, 245, 183,  77, 192, 230, 152,  78,  64,
+     213, 151,  86,  95, 209, 151,  86,  64, 145, 182,  94, 161, 166, 181,  94,  64,
+      86, 181,  85, 193, 214, 181,  84, 160, 213, 181,  83, 128, 192, 151,  80,   9 };
+
+constexpr byte Sound_C2_MOYEN [80] PROGMEM = {
+       0,  80,  47,  47, 196, 175,  48,   0, 136, 181,  51, 186, 137, 211,  44,  65,
+     137, 213,  61, 193, 136, 165, 149, 192, 106, 174, 134, 192, 166, 180, 143,  64,
+     165, 184, 119,  64, 233, 216,  86,  95, 233, 216,  61,  94, 234, 216,  68, 192,
+     249, 184,  94,  65, 245, 183, 118, 192,  85, 180, 142, 192, 106, 179, 159,  64,
+     169, 177, 142,  64,  98, 146, 141, 195, 170, 178,  84, 193,  89, 177,  88,  28 };
+
+constexpr byte Sound_C2_MOT [48] PROGMEM = {
+       0,  48,  47,  47,  84, 251,  48,   0, 132, 185,  59, 186, 140, 183,  52,  65,
+     141, 181,  52, 192, 141, 182,  61,  64, 137, 182,  61,  65, 158, 170, 117,  63,
+     158, 168, 117,  64, 173, 168, 101,  95, 234, 167, 100,  32, 169, 167,  80,  10 };
+
+constexpr byte Sound_C2_N [88] PROGMEM = {
+       0,  88,  47,  47, 128, 150, 248,   0, 244, 183, 173,  15, 248, 183, 157, 164,
+     229, 183, 157, 192, 244, 183, 158,  63, 249, 183, 158, 192, 250, 183, 158, 223,
+     234, 183, 150, 191, 155, 183,  77,  95, 207, 182,  68, 191, 207, 183,  60, 223,
+     143, 183,  44, 191, 143, 182,  12, 223, 143, 182,  44, 224,  79, 182,   4, 223,
+     207, 181,  59,  94, 140, 181,  58, 192,  70, 181,  76, 191, 170, 180, 140, 192,
+     185, 179, 123, 192, 181, 179, 120,  15 };
+
+constexpr byte Sound_C2_NE [68] PROGMEM = {
+       0,  68,  47,  47, 136, 182,  40,   0, 141, 182,  50, 192, 142, 182,  35, 192,
+     141, 182,  36, 192, 141, 182,  45,  66, 142, 182,  45, 192, 142, 182,  53,  65,
+     137, 183,  53,  65,  74, 182,  46,  35,  22, 181,  62, 160,  21, 180,  71,  32,
+      41, 180,  86, 224,  89, 180, 118,  61, 165, 179, 100, 189, 137, 179,  99, 190,
+     153, 179,  80,  26 };
+
+constexpr byte Sound_C2_NOMBRE [120] PROGMEM = {
+       0, 120,  49,  47, 213, 179,  48,   0, 212, 180,  43,   1, 216, 179,  43, 160,
+     216, 180,  44,   0, 232, 180,  44, 128, 237, 180,  45,  65, 222, 179,  45, 224,
+     158, 180,  46,   9,  90, 180,  62,   1, 102, 179, 110,   1, 105, 177, 142,  32,
+     134, 172, 158,  64, 133, 174, 158,  64, 133, 174, 142,  65, 132, 175, 134,   2,
+     133, 179, 126,  34, 133, 180, 110,  33,  73, 178,  93, 162,  72, 179,  85,  34,
+      76, 175,  84, 190, 140, 176,  51,  63,  64, 181,  96,  93, 149, 170,  99, 128,
+      85, 174, 100,  64, 170, 174, 108,  95, 163, 174, 116,  62, 169, 176, 124,  64,
+     153, 175, 116,  62, 148, 177, 100,  63 };
+
+constexpr byte Sound_C2_NOM [60] PROGMEM = {
+       0,  60,  47,  47,  84, 251,  48,   0,  80, 187,  51, 148, 132, 185,  59, 128,
+     140, 183,  52,  65, 141, 181,  52, 192, 141, 182,  61,  64, 137, 182,  61,  65,
+      21, 179, 110, 160,  21, 174, 150, 192,  73, 175, 166,  64,  68, 209, 157, 191,
+     129, 150, 156, 190,  20, 194,   2, 191,  69, 194, 128,  12 };
+
+constexpr byte Sound_C2_NOS [72] PROGMEM = {
+       0,  72,  47,  47, 213, 179,  48,   0, 212, 180,  43,   1, 216, 179,  43, 160,
+     216, 180,  44,   0, 232, 180,  44, 128, 237, 180,  45,  65, 222, 179,  45, 224,
+     158, 180,  46,   9,  90, 180,  62,   1, 102, 179, 110,   1, 105, 177, 142,  32,
+     129, 176, 126, 221,  74, 169, 126, 223, 154, 168, 118,  62, 173, 168, 101,  61,
+     234, 167, 100,  32, 169, 167,  80,  10 };
+
+constexpr byte Sound_C2_NOTE [96] PROGMEM = {
+       0,  96,  47,  47, 141, 180,  48,   0, 141, 181,  61,  33, 141, 182,  61, 161,
+     141, 181,  61, 193, 157, 180,  61, 160, 108, 213,  87,  33, 168, 180, 143, 160,
+     168, 179, 151, 160, 105, 178, 151,  63, 104, 178, 151,  64, 169, 179, 134, 190,
+     169, 180, 125,  32, 192, 178, 120, 112, 128, 217, 120, 112,   0, 214, 192, 112,
+       0, 215, 173, 176,  37, 213,   6,  80, 149, 182, 101, 176, 233, 181,  92,  57,
+     184, 180,  84,  95,  89, 179,  83, 192,  89, 178,  26, 160,  24, 177,   0,  14 };
+
+constexpr byte Sound_C2_NOTRE [100] PROGMEM = {
+       0, 100,  47,  47, 204, 180,  48,   0, 204, 180,  44,  20, 201, 182,  44, 161,
+     202, 181,  45,  64, 137, 179,  37,  64, 137, 182,  54,  34, 105, 179, 118, 160,
+     102, 178, 126, 191,  37, 176, 134, 192,  37, 176, 142, 192, 122, 177, 142, 163,
+     186, 177, 126,  32, 245, 210, 101,  32, 130, 209, 112, 112,   2, 216, 176, 112,
+      82, 185, 254,  16,  17, 185, 254, 176,  18, 178, 197, 208, 130, 151, 253, 208,
+      38, 209, 237,  80, 123, 177,  84,  48, 186, 177,  84,  40, 186, 177,  83, 160,
+     186, 177,  80,  18 };
+
+constexpr byte Sound_C2_NOUS [56] PROGMEM = {
+       0,  56,  47,  47, 136, 182,  80,   0, 196, 185,  60, 185, 206, 184,  45, 163,
+     205, 179,  53,  64, 205, 182,  45, 162, 206, 179,  45, 192,  69, 180,  87,  64,
+     137, 181,  95,  65, 205, 180,  94, 192, 141, 174,  93, 223, 141, 172,  76, 189,
+     141, 173,  51, 191, 137, 177,  72,  12 };
+
+constexpr byte Sound_C2_NUMERO [112] PROGMEM = {
+       0, 112,  47,  47, 192, 184,  40,   0, 144, 215,  44,  64, 148, 215,  45,  33,
+     233, 215,  45, 193, 153, 215,  46,  34, 149, 184,  62, 162, 165, 184,  62, 193,
+     229, 152,  61, 161, 149, 149,  61,  32, 137, 146,  52,  63, 132, 150,  52, 191,
+     132, 149,  52, 223, 149, 182,  86,  32, 181, 183, 111,  62, 181, 183, 119, 191,
+     185, 184, 119, 224, 169, 183, 127,  61, 105, 181, 118,  63,  37, 178,  54,  48,
+      37, 175, 165, 208,  17, 171, 220, 176, 146, 168, 108,  61, 234, 168,  99, 160,
+     150, 168, 107, 192, 214, 168,  99,  64, 214, 166,  90, 160, 214, 165,  96,   8 };
+
+constexpr byte Sound_C2_O [36] PROGMEM = {
+       0,  36,  47,  47,   0, 153, 248,   0,  64, 174, 132,  15, 217, 168, 117,  32,
+     169, 167, 109,  32, 153, 198, 109,  96, 237, 166, 100,  59, 217, 165,  99, 159,
+     148, 165,  88,  28 };
+
+constexpr byte Sound_C2_ON [32] PROGMEM = {
+       0,  32,  47,  47,   0, 153, 248,   0,  89, 200, 158, 160, 133, 169, 150, 224,
+     136, 208, 126, 224, 196, 211, 117,  60, 129, 185, 116,  32, 128, 177, 128,   8 };
+
+constexpr byte Sound_C2_OPTIQUE [112] PROGMEM = {
+       0, 112,  45,  47,  90, 177, 152,   0, 234, 176, 142, 160, 251, 177, 143,  32,
+     251, 177, 143,  64, 251, 176, 127,  63, 186, 176, 118,  32, 149, 174,  88,  48,
+     129, 182, 112, 112,   5, 182, 190, 176,   1, 182, 254, 176,  80, 218, 248, 112,
+       4, 182, 213,  16,  21, 216, 190,  48, 234, 216,  61,  63, 250, 217,  70, 190,
+     249, 217,  71,  32, 186, 217,  63,  96, 182, 217,  54, 191, 230, 218,  45,  60,
+      64, 216,  40,  80,  64, 216,  40,  96,   4, 182, 253,  16,   4, 186, 255, 176,
+       4, 186,  46,  16,  20, 186,   5,  48, 117, 184, 124, 176, 117, 184, 120,  15 };
+
+constexpr byte Sound_C2_OR [68] PROGMEM = {
+       0,  68,  50,  47, 185, 175, 120,   0, 169, 175, 133, 222, 169, 174, 134,  96,
+     253, 174, 142,  64, 185, 174, 142, 195, 185, 174, 141, 163, 182, 174, 125,  33,
+     255, 173, 116, 162, 249, 173, 116,  32, 186, 174, 100,  65, 186, 174, 100,   2,
+     106, 173,  60,  32,  38, 175,  61,  48,  22, 176,  69,  80,  38, 175,  68, 208,
+      39, 176,  64,  17 };
+
+constexpr byte Sound_C2_OU [28] PROGMEM = {
+       0,  28,  47,  49,  21, 179,   0,   0,  70, 168,  94,  96,  70, 168,  94,  96,
+      67, 200,  93,  93, 130, 213,  84, 223, 146, 182,  80,  12 };
+
+constexpr byte Sound_C2_OUI [64] PROGMEM = {
+       0,  64,  47,  47, 152, 164,  80,   0, 157, 164,  74,  18, 132, 166,  74,  65,
+     128, 177,  75,  34,  80, 172,  83, 161, 165, 173,  76,  34, 170, 175,  68, 161,
+     166, 181,  69, 161,  91, 184,  63,  32, 123, 185,  63,  63, 187, 217,  62, 191,
+     250, 217,  70,  62, 245, 217,  53, 190, 153, 218,  52,  95, 136, 218,  64,  12 };
+
+constexpr byte Sound_C2_P [52] PROGMEM = {
+       0,  52,  47,  47,  69, 151, 248,   0, 166, 150,  93,  39, 170, 150, 110, 129,
+     186, 183, 119,  32, 169, 183, 119, 189, 249, 184, 119, 191, 181, 184, 111, 223,
+     245, 184, 111,  64, 249, 184, 102, 191, 245, 184,  93, 160, 225, 184,  84,  32,
+     233, 184,  80,  31 };
+
+constexpr byte Sound_C2_PARENTHESE [172] PROGMEM = {
+       0, 172,  45,  47,  20, 180, 192,   0, 169, 175, 157, 166,  88, 175, 174, 129,
+     188, 176, 182, 160, 188, 177, 183,  95, 124, 176, 183,  63, 121, 176, 174,  61,
+      41, 175, 189, 189, 101, 142, 165,  48,  40, 140, 165,  48,  37, 171, 149,   7,
+      88, 170, 165,  32,  89, 170, 157,  32, 149, 170, 149,  32, 134, 169, 149,  64,
+     134, 170, 149,  34, 106, 173, 125,  64,  90, 173, 109,  27,  88, 173, 108,  28,
+     128, 151, 144, 112, 168, 180, 112,  96, 188, 180, 117, 143, 252, 180, 134,   3,
+     252, 181, 134, 128, 188, 181, 143,   0, 189, 181, 151, 159, 189, 181, 151, 160,
+     125, 181, 151, 191, 121, 182, 143, 192, 121, 182, 135, 192, 185, 182, 135,  32,
+     189, 182, 127,  64, 188, 182, 118, 191, 124, 181, 102,  63, 124, 181,  85, 157,
+     124, 181,  93,   0, 188, 181, 109,  62, 185, 180, 101, 112, 181, 180, 100, 191,
+     249, 179, 115, 160, 249, 179, 123, 160, 233, 179, 123,  63 };
+
+constexpr byte Sound_C2_PARFAIT [116] PROGMEM = {
+       0, 116,  47,  47,   0, 153, 248,   0,   0, 152, 122, 143,  89, 176, 174, 160,
+     188, 177, 183,  64, 184, 177, 166,  32, 105, 177, 141, 160,  38, 177, 165, 176,
+      33, 176, 181, 176, 101, 176, 181, 144,  22, 175, 189, 176,  85, 180, 189,  48,
+      85, 180, 213,  16,  84, 182, 229,  80,  20, 179, 213,  48,   4, 180, 197,  80,
+      21, 181, 213, 176,   5, 182, 213, 144,  25, 181, 181, 176,  21, 181, 165, 176,
+      26, 181, 125, 176, 165, 179, 109,  63, 168, 180, 142, 160, 184, 182, 150, 221,
+     184, 183, 134,  57, 212, 183, 124,  32, 212, 184, 115, 160, 228, 184, 107,  32,
+     164, 184,  96,  13 };
+
+constexpr byte Sound_C2_PARLER [88] PROGMEM = {
+       0,  88,  49,  47,  16, 213,   0,   0,   1, 214, 253, 144, 169, 178, 142,  33,
+     154, 178, 158, 160, 154, 179, 175,  95, 170, 178, 182, 192,  86, 177, 174,  32,
+      86, 175, 150,  60,  22, 177,   6,  48,  22, 178, 118,  48,  88, 179, 126,  48,
+      88, 178, 117,  37, 168, 180,  93,  65, 169, 181,  77,  65, 104, 214,  69, 163,
+     248, 183, 102,  34, 232, 184,  94,  65, 233, 184,  93, 191, 233, 184,  93, 192,
+     214, 150,  92,  32, 208, 184,  88,  17 };
+
+constexpr byte Sound_C2_PASSER [68] PROGMEM = {
+       0,  68,  45,  47, 150, 149, 128,   0, 217, 179, 150,   6, 232, 180, 150, 223,
+     232, 181, 133, 223, 216, 181, 141,  62, 154, 183, 142,  48, 148, 216, 157, 208,
+     185, 215, 157, 208, 123, 215, 157,  80,  27, 184, 157, 208,  63, 183, 149,  80,
+     254, 183,  92, 223, 248, 183,  93,  95, 248, 184,  84, 223, 248, 184,  92, 192,
+     249, 184,  88,  15 };
+
+constexpr byte Sound_C2_PENSER [96] PROGMEM = {
+       0,  96,  47,  47,   5, 149, 200,   0,  22, 179, 174,   5,  85, 173, 150,  32,
+      21, 168, 166, 192,  69, 173, 174, 192,  68, 174, 166, 223,  89, 175, 142, 191,
+      65, 178, 117, 191,  86, 215, 125, 161,  16, 247, 125, 208,  20, 215, 109, 240,
+      22, 214, 101, 240, 249, 182, 101,  32, 245, 182, 102,  63, 245, 183, 102, 190,
+     182, 184, 102, 192, 246, 184,  94, 192, 246, 184,  94,  32, 242, 184,  93, 161,
+     230, 184,  92, 161, 233, 184,  83, 160, 210, 184,  83,  33, 209, 184,  80,   1 };
+
+constexpr byte Sound_C2_PETIT [80] PROGMEM = {
+       0,  80,  47,  47,   0, 150, 248,   0, 102, 183, 230, 144,  22, 182, 239, 144,
+      43, 180,   6, 144, 107, 180, 110,  63, 111, 180, 111,  32, 171, 180, 103,  64,
+     186, 182, 102, 223, 187, 182,  93,  62, 153, 181,  80,  80,   0, 249, 176, 112,
+      13, 216, 221, 176,  26, 217, 126,  48,  31, 217,  85, 176, 238, 217,  61,  37,
+     250, 217,  61,  93, 250, 217,  52, 192, 229, 217,  35, 192, 245, 217,  56,  12 };
+
+constexpr byte Sound_C2_PEUT_ETRE [104] PROGMEM = {
+       0, 104,  47,  47,   2, 147,  80,   0,   2, 179,   5, 158, 150, 181, 110,  64,
+     149, 182,  86,  64, 196, 183,  96,  96,  37, 215, 200, 112, 249, 182, 118,  80,
+     249, 182, 126, 189, 186, 183, 134, 223, 182, 183, 135,  64, 186, 183, 126, 160,
+     246, 183, 126,  34, 245, 183, 109,  33, 208, 184,  92, 163, 182, 183, 100,  32,
+     209, 216, 120,  80, 192, 183,  96, 112,  82, 185, 253, 144,  17, 185, 253, 176,
+      18, 178, 196, 208,  38, 209, 236,  80, 123, 177,  83,  48, 186, 177,  82, 165,
+     186, 177,  82,  32, 186, 177,  80,  22 };
+
+constexpr byte Sound_C2_PLUS [80] PROGMEM = {
+       0,  80,  45,  47,   5, 178, 176,   0,   5, 178, 182,  16,  17, 179,   5,  14,
+     100, 148,  85, 128,  97, 116,  78, 160, 116, 117,  62, 192, 117, 117,  53, 190,
+     104, 149,  79,  34, 186, 149,  87,  32, 187, 150,  79,  64,  37, 151,   6, 255,
+      21, 151,   6, 150, 100, 183,  70,  32,  82, 218,  78,  48,  10, 181,   6,  80,
+      10, 181,   5, 176,   2, 183,   5, 208,   2, 186, 205,  48,   2, 182, 165,  48 };
+
+constexpr byte Sound_C2_POIGNEE [108] PROGMEM = {
+       0, 108,  47,  47,   5, 183,   0,   0,   4, 183, 221, 176,   0, 185, 252,  16,
+       0, 152, 252,  48,  64, 150, 115,  15,  22, 165,   4,  41,  23, 167,  29,  32,
+      91, 174, 134,  32,  26, 176, 142,  32,  26, 179, 158, 160, 101, 183, 150, 192,
+     105, 183, 126,  63, 152, 182,  77, 160, 148, 182,  60, 190,  80, 184,  60, 223,
+     136, 150,  60,  94,  96, 185,  68,  61, 164, 249,  60, 190, 152, 249,  69,  95,
+     152, 217,  77,  95, 105, 217,  94,  95, 105, 217, 110,  63, 185, 185, 117, 160,
+     245, 184, 101,  95, 229, 184,  92,  64, 185, 185,  72,  13 };
+
+constexpr byte Sound_C2_POINT [72] PROGMEM = {
+       0,  72,  47,  47,   0, 152, 224,   0,  65, 110, 246, 176,  80, 174, 230,  16,
+       1, 109, 229,  63,  64, 173, 108, 160,  64, 172, 125, 159, 132, 172, 125, 160,
+      68, 171, 166,  64,  20, 168, 158, 191,  85, 175, 174, 192, 100, 144, 174, 160,
+     117, 177, 182, 160, 166, 177, 182, 160, 101, 178, 174, 194, 102, 178, 158,  34,
+      85, 177, 132,  32,  85, 177, 128,  25 };
+
+constexpr byte Sound_C2_POSITIONNE [188] PROGMEM = {
+       0, 188,  47,  47,  81, 184, 248,   0,  65, 152, 253,   1, 186, 175, 118,  32,
+     171, 177, 111,  32, 169, 148, 103,  64, 166, 182,  94, 191, 234, 182,  86,  32,
+      21, 245, 116,   1,  21, 245, 116, 128,  21, 245, 116, 128,  21, 245, 117,   0,
+      21, 245, 117, 128,  21, 245, 117, 128,  21, 245, 118,   0,  21, 245, 118,   0,
+     234, 182,  86,  32, 235, 183,  85, 191, 174, 183,  77, 223, 166, 184,  78,  32,
+     173, 184,  70,  64, 110, 185,  53, 192, 154, 183, 142,  48, 148, 216, 157, 208,
+     185, 215, 157, 208, 123, 215, 157,  80,  27, 184, 157, 208,  63, 183, 149,  80,
+     249, 183,  94, 160, 181, 183, 103,  32, 165, 182, 119,  63, 214, 181, 127,  63,
+     154, 148, 135,  63, 169, 179, 143,  64, 166, 180, 135,  64,  89, 180, 127,  33,
+      73, 180,  70,  32, 136, 180,  69, 161, 152, 179,  69,  66, 152, 179,  69,  66,
+     136, 180,  69,  64, 136, 179,  76, 160, 132, 182,  92, 161,  72, 181, 108, 160,
+     148, 179,  68, 192, 148, 181,  28,  33, 149, 180,   8,  20 };
+
+constexpr byte Sound_C2_POUR [60] PROGMEM = {
+       0,  60,  46,  47, 192, 182,  64,   0,   1, 183, 253,  16,   1, 179, 254, 144,
+      37, 146, 253, 208, 154, 170,  92, 222, 154, 168,  84, 127, 141, 167,  92,  64,
+     133, 165, 124, 224,  19, 203, 164, 208,  35, 173, 148, 208,  66, 178, 220, 208,
+      82, 206, 196, 176,  66, 176, 236,  48,  35, 174, 208,  15 };
+
+constexpr byte Sound_C2_POUR_CENT [112] PROGMEM = {
+       0, 112,  47,  47,   4, 180, 160,   0,  25, 132, 117,  39, 155, 168, 117, 192,
+      91, 167, 125, 159,  27, 166, 117, 189,  22, 163, 116, 160,  38, 165, 116,  29,
+      38, 167,   4,  48,  70, 169, 147, 176,  33, 173, 188, 176,   2, 175, 189, 176,
+      86, 178, 206,  16,  18, 180, 230,  48,  17, 181, 222,  80,  20, 181, 173, 192,
+      89, 178, 133, 143, 170, 175, 126,  61, 106, 174, 150,  59,  43, 205, 150,  32,
+      38, 203, 158,  63,  37, 203, 158,  95,  33, 202, 158,  32,  17, 202, 158,  63,
+      16, 169, 173, 160,  16, 170, 157,  30,  17, 169,  12, 160,  17, 169,   8,   7 };
+
+constexpr byte Sound_C2_PREMIER [104] PROGMEM = {
+       0, 104,  47,  47,  34, 170,   0,   0,  39, 170, 132, 144, 134, 174, 196, 176,
+     130, 174, 227, 176,  38, 171,   3,  14,  23, 172, 118,  32,  39, 173,  70,  32,
+     171, 180, 102,  32, 171, 180, 102,  64,  73, 148,  69, 160, 136, 150,  69,  64,
+     137, 150,  61,  32, 136, 151,  60, 192,  82, 152,  45,  32, 104, 248,  53, 192,
+     165, 248,  62,  64, 169, 216,  94, 191, 122, 216, 102, 160, 122, 184, 119,  63,
+     117, 184, 118, 192, 165, 184, 110,  62, 245, 184, 109, 191, 229, 184, 100, 160,
+     224, 184,  83, 192, 208, 217,  80,  28 };
+
+constexpr byte Sound_C2_PRENDRE [92] PROGMEM = {
+       0,  92,  47,  47, 133, 186, 232,   0, 137, 174, 229, 176,  25, 170,   5,  32,
+      22, 171, 182,  32,  26, 171, 190, 161,  69, 175, 199,  64,  70, 175, 199,  95,
+      26, 169, 198, 223,  27, 169, 198,  95,  26, 170, 182,  64,  26, 173, 158,  95,
+      94, 175, 142,  63,  31, 176, 117,  32,  17, 178,  80, 112, 110, 177, 125, 160,
+      25, 174,   5,  32,  42, 176,   4, 160,  42, 176, 157,  64, 106, 176, 148,  33,
+      42, 175,   3,  32,  26, 175,  66, 128,  27, 176,  16,  14 };
+
+constexpr byte Sound_C2_PRENOM [100] PROGMEM = {
+       0, 100,  47,  47,  17, 178, 248,   0,  66, 183, 229,  16, 133, 185, 253, 176,
+     129, 184, 254,  48,  22, 180,  46, 176, 149, 181, 109, 166, 170, 182, 119,  32,
+     170, 183, 127,  64, 105, 183, 119,  60, 106, 182, 102, 190,  90, 181,  69, 223,
+      74, 182,  69, 191,  74, 182,  69, 192,  25, 177, 118,  95,  40, 174,  77,  28,
+      40, 174,  77,   0,  40, 174,  77,   0,  40, 174,  77,   0,  40, 174,  77,   0,
+      25, 170,   4, 160,  29, 167,   4,  32,  40, 165,   3, 160,  40, 163,   3,  32,
+      28, 160,   0,  14 };
+
+constexpr byte Sound_C2_PROBLEME [152] PROGMEM = {
+       0, 152,  48,  47, 134, 171, 176,   0,  91, 137, 116,  39,  27, 165, 149,  40,
+      27, 169, 149, 162,  91, 167, 150,   0, 154, 170, 125, 160, 154, 170, 125, 192,
+     170, 170, 117,  28, 169, 171,  83, 184, 169, 171,  80,  95, 152, 144,  92, 158,
+     152, 147, 101,   8, 165, 179, 110,  63, 108, 180, 102, 190, 172, 180,  94,  31,
+     172, 180,  94,  32, 172, 180, 118, 160, 185, 181, 142, 128, 233, 181, 150, 160,
+     233, 182, 150, 192, 229, 182, 150, 192, 169, 182, 142, 192, 169, 182, 142, 131,
+     169, 150, 134, 129, 169, 149, 126, 128, 169, 148, 109, 128, 200, 149,  60, 161,
+     200, 150,  52,  33, 200, 149,  60,  64, 136, 181,  68,  32, 136, 180,  68,  64,
+     136, 179,  60,  33, 136, 178,  68,  32, 152, 178,  76,  33, 152, 177,  75, 160,
+     165, 177, 131,  95, 165, 176, 128,  17 };
+
+constexpr byte Sound_C2_PUIS [64] PROGMEM = {
+       0,  64,  47,  47, 145, 217, 248,   0, 209, 218, 254,  16, 144, 185, 254, 144,
+     128, 152, 253, 152,  32, 151, 190,   0,  38, 151,   6, 192,  38, 150,   6, 161,
+      22, 150,   7,  33,  50, 184,   7, 192, 118, 217,  31, 160, 118, 217,  63,  32,
+     182, 217,  54, 191, 181, 217,  46,  63, 109, 217,  29,  62, 110, 217,  24,  12 };
+
+constexpr byte Sound_C2_PUISSANCE [128] PROGMEM = {
+       0, 128,  40,  47,  37, 181,   0,   0,  37, 182, 198,  16,  52, 182,   6,  48,
+     235, 151,  54,  70, 235, 184,  54, 160, 230, 216,  54, 192, 157, 217,  62, 222,
+       9, 183,   7,  80,   4, 181, 214, 176,  21, 183, 214, 208,  21, 182, 222,  80,
+      40, 182, 246, 176,   8, 181, 222,  80, 169, 180, 118,  35,  90, 178, 150, 189,
+      22, 174, 174, 221, 102, 173, 166, 160,  22, 172, 174, 223,  38, 172, 166, 191,
+      37, 171, 174, 192,  22, 170, 174,  95,  22, 170, 173, 157,  21, 172, 149, 192,
+     165, 173, 124, 223, 144, 140,  99,  64,   4, 180,   5,  16,   8, 178,   5, 112,
+       8, 178,   5, 112,  29, 179,   4, 208,  12, 176,   3, 208,  24, 179,   2, 176 };
+
+constexpr byte Sound_C2_Q [52] PROGMEM = {
+       0,  52,  47,  47,  64, 151, 212, 128,   4, 152, 174, 165,  48, 185,  94,  32,
+      33, 184,  54,  32, 182, 152,  62, 160, 166, 152,  63,  32, 114, 151,  47,  95,
+     162, 152,  70, 192, 235, 151,  70,  63, 206, 150,  60,  32, 202, 120,  51,  63,
+     225, 152,  56,  30 };
+
+constexpr byte Sound_C2_QU_ [24] PROGMEM = {
+       0,  24,  47,  47,  21, 185, 168,   0,  90, 185, 125, 129, 233, 185, 102,   0,
+     244, 184, 118, 160, 244, 184, 112,  31 };
+
+constexpr byte Sound_C2_QU_EST_CE [68] PROGMEM = {
+       0,  68,  47,  47,  21, 185, 168,   0,  90, 185, 125,   1, 233, 185, 101, 128,
+     244, 184, 119,  32, 248, 183, 127, 160, 244, 183, 127,  62, 244, 183, 135,  32,
+     244, 183, 126, 160, 244, 183, 117, 160, 236, 183,  93,  32,  91, 184, 125, 208,
+      86, 184, 125, 208,  86, 184, 133, 208,  22, 183,   5, 176, 144, 186, 253,  80,
+      20, 182,   0,   3 };
+
+constexpr byte Sound_C2_QUAND [60] PROGMEM = {
+       0,  60,  47,  47,   0, 153, 248,   0,  32, 181, 253, 144,  32, 117, 199, 144,
+      33, 150, 134, 144, 113, 180, 125, 190,  70, 147, 142, 160,  70, 144, 166, 160,
+       5, 172, 182, 160,  21, 170, 198, 223,  68, 171, 198, 191,   0, 169, 182,  62,
+     128, 171, 188, 160,  36, 167, 163, 160,  65, 152, 168,  14 };
+
+constexpr byte Sound_C2_QUE [56] PROGMEM = {
+       0,  56,  47,  47,   0, 153, 248,   0,  32, 181, 253, 144,  32, 117, 199, 144,
+      33, 150, 134, 144, 113, 180, 125, 190, 233, 150, 101, 191, 234, 149, 101, 190,
+     213, 149, 109, 223, 233, 149, 100, 160, 200, 150,  92,  64, 205, 149,  91, 160,
+     149, 149,  81, 160, 169, 149,  96,  14 };
+
+constexpr byte Sound_C2_QUEL [60] PROGMEM = {
+       0,  60,  47,  47, 133, 153, 248,   0,  21, 184, 253,  16,  22, 184, 135, 176,
+     234, 216,  85,   2, 181, 184, 103,   0, 246, 183, 127,  64, 178, 183, 143,  32,
+     246, 183, 143,  64, 182, 183, 127,  63, 101, 183, 102, 160, 181, 215,  94,  64,
+     165, 215,  85, 160, 150, 184,  85,  64,  66, 184,  96,   0 };
+
+constexpr byte Sound_C2_QUELQUE [92] PROGMEM = {
+       0,  92,  47,  47, 133, 153, 248,   0,  21, 184, 253,  16,  22, 184, 135, 176,
+     234, 216,  85,   2, 181, 184, 103,   0, 246, 183, 127,  64, 178, 183, 143,  32,
+     246, 183, 143,  64, 182, 183, 127,  63, 181, 215,  94,  64, 165, 215,  85, 192,
+     150, 184,  85,  64,  34, 214,  48,  80, 209, 215,  96, 112,   1, 150,   4, 144,
+      33, 152, 255,  48,  34, 183,   6,  16, 181, 183,  93,  31, 166, 182, 109,  32,
+     166, 182, 109,  64, 166, 182, 107, 192, 146, 182, 112,   1 };
+
+constexpr byte Sound_C2_QUESTION [96] PROGMEM = {
+       0,  96,  47,  47, 228, 184,  88,   0, 229, 184, 102,  38, 250, 183, 119, 160,
+     249, 182, 127, 192, 196, 182, 109, 192, 132, 183, 100, 186, 148, 182, 124, 208,
+      64, 216, 140, 240,  65, 184, 131, 176,   0, 218, 248,  16,   0, 218, 248,  80,
+       0, 218, 252,  16,  25, 218,   5, 208,  72, 218,  45,  48, 234, 183,  68, 166,
+     230, 151,  93, 160, 154, 148, 118,  63,  74, 170, 166,  96, 132, 168, 149, 224,
+       5, 165, 116,  64,   9, 160,  99, 191,   4, 160,  99,  31,   0, 182, 112,  25 };
+
+constexpr byte Sound_C2_QUI [56] PROGMEM = {
+       0,  56,  47,  47,   0, 153, 248,   0,   8, 216, 246,  16,   4, 216, 223,  48,
+      16, 254, 254,  48,   8, 217, 174,  48,  89, 217,  61, 134, 164, 217,  62,  32,
+     229, 217,  62, 223, 229, 217,  62,  63, 245, 217,  61, 190, 225, 217,  53, 223,
+      72, 213,  60, 192,  29, 211,   0,   8 };
+
+constexpr byte Sound_C2_QU_IL [88] PROGMEM = {
+       0,  88,  47,  47,   0, 153, 248,   0,   8, 216, 246,  16,   4, 216, 223,  48,
+      16, 254, 254,  48,   8, 217, 174,  48,  89, 217,  61, 134, 164, 217,  62,  32,
+     229, 217,  62, 223, 225, 216,  54, 192, 228, 217,  62, 192, 246, 217,  62, 223,
+     104, 217,  54, 223, 226, 183,  78, 192, 226, 182,  78,  95, 230, 182,  78,  64,
+     234, 181,  78,  95, 237, 181,  77, 191, 238, 181,  85, 192, 237, 181, 117,  64,
+     237, 181, 120,   5, 172, 181, 112,  11 };
+
+constexpr byte Sound_C2_QUOI [52] PROGMEM = {
+       0,  52,  47,  47, 134, 176, 200,   0, 129, 150, 222,  48,  85, 172, 117,  32,
+     150, 171, 109, 160, 222, 139, 117, 160, 221, 173, 134, 191, 154, 175, 159,  64,
+     237, 176, 151,  64, 229, 177, 142, 163, 139, 172, 150,  32,  91, 177, 117, 162,
+      91, 177,  88,  24 };
+
+constexpr byte Sound_C2_R [72] PROGMEM = {
+       0,  72,  47,  47,   0, 153, 248,   0,  84, 183, 171,   2, 232, 183, 157, 160,
+     228, 183, 148, 128, 212, 183, 141,  32, 233, 183, 141, 160, 233, 184, 134,  63,
+     233, 183, 142, 160, 249, 183, 143,  31, 169, 183, 143,  32, 174, 183, 135,  64,
+     109, 182, 134, 161,  89, 182, 134,  33, 189, 180, 133, 160, 172, 180, 124, 188,
+     120, 180, 124,   0, 121, 179, 120,   5 };
+
+constexpr byte Sound_C2_RE [64] PROGMEM = {
+       0,  64,  47,  47, 113, 179, 104,   0, 113, 179, 108, 133, 102, 180, 109,   0,
+     170, 180, 118,   2, 174, 181, 118, 131, 174, 181, 127,   1, 234, 182, 127,  32,
+     234, 183, 119,  95, 250, 183, 102, 224, 250, 183, 102, 192, 249, 183,  93, 189,
+     224, 152,  92,  32, 201, 148,  99,  32, 200, 181,  98, 160, 192, 186, 104,  31 };
+
+constexpr byte Sound_C2_RECOMMENCE [152] PROGMEM = {
+       0, 152,  46,  47,  86, 174,  96,   0,   6, 174,  51, 129,   6, 174,   5,  16,
+     129, 180, 237,  80,  33, 174,   5, 176,  17, 206, 101,  34, 107, 176, 118, 163,
+      86, 179, 119, 193, 170, 179, 102, 160, 117, 146,  68, 160, 129, 179, 104,  48,
+     129, 181, 104,  80, 129, 175, 245,  48,  38, 176, 133,  40, 166, 143, 118,  32,
+      90, 173, 127,  94,   9, 172,   6, 189, 136, 180,  38,  63, 137, 182,  62,  64,
+      22, 170,   7,  62,  38, 204, 143, 191,  22, 204, 175, 192,  34, 204, 167,  62,
+      34, 203, 142, 192,  34, 203, 126,  62,  89, 172, 117,  64,  42, 173,   5,  94,
+      22, 173,   4, 191,   0, 215, 133,  80,   0, 213, 157,  80,  21, 181,   5,  80,
+       9, 181, 237,  80,   9, 180, 165,  80, 250, 177, 116, 192, 166, 178, 100,  64,
+       2, 175,  35, 192,  22, 177,  24,  36 };
+
+constexpr byte Sound_C2_REGARDE [112] PROGMEM = {
+       0, 112,  47,  47,   6, 168, 160,   0,  22, 173, 148,  28,  38, 173, 133,  32,
+     101, 176, 134, 163, 106, 178, 134, 161, 106, 178, 134, 192,  90, 148, 110, 162,
+      43, 150,  38, 191, 133, 150,  60, 191, 142, 147,  51, 160,  21, 182,   0,  80,
+      21, 182,   5, 158, 186, 184,  94, 160, 169, 184, 119, 191, 165, 183, 143, 160,
+     170, 181, 151,  63, 174, 180, 151,  96, 169, 178, 150,  62, 253, 176, 134,  64,
+     174, 175, 117, 192, 130, 211, 104,  48, 130, 211, 104,  80, 166, 211, 101,  48,
+     169, 180, 108, 144, 106, 180, 116, 192, 105, 181, 100,  94,  25, 180,  24,  14 };
+
+constexpr byte Sound_C2_REPONSE [164] PROGMEM = {
+       0, 164,  47,  47, 105, 180, 104,   0,  89, 180, 118,  48, 169, 180, 117, 142,
+     169, 181, 126,   0, 170, 181, 126, 128, 169, 182, 135,  31, 168, 183, 127, 160,
+     232, 183, 127,   0, 249, 184, 119,  32, 169, 151, 111,  32, 169, 151, 102,  31,
+     153, 149,  92, 128, 144, 184,  72,  16, 208, 184, 120,  80,   0, 119, 112, 112,
+       0, 146, 132,   9, 105, 172, 124, 159, 174, 171, 133,  63, 158, 169, 149,  30,
+      42, 166, 149, 158, 133, 172, 141, 161, 132, 173, 133, 224, 132, 173, 133, 225,
+     132, 173, 141, 128, 132, 173, 141, 160, 132, 173, 141, 128, 132, 173, 125, 160,
+     132, 173, 125,  32, 136, 173, 124, 128, 152, 172,  99, 160,  68, 178,  51, 192,
+       0, 184,  80,  58,  16, 214,  93,  16,  16, 247, 125,  48,  16, 247, 125,  48,
+      16, 247, 133,  48,   0, 247, 132, 144,  16, 247, 156,  48,   4, 246, 155, 176,
+       4, 245, 152,  20 };
+
+constexpr byte Sound_C2_RESULTAT [128] PROGMEM = {
+       0, 128,  47,  47,   4, 178, 146, 128, 148, 148, 148, 148, 165, 180, 141,  32,
+     149, 180, 141, 160, 145, 180, 134,  32, 101, 180, 133, 192, 101, 149, 134, 195,
+     165, 149, 135,  35, 164, 181, 135,  36, 165, 182, 127,  34, 184, 182, 118, 160,
+     185, 182,  85, 191, 154, 183,  85, 190, 166, 183,  93, 176,  71, 216, 125, 208,
+      22, 184,  46, 208, 101, 182,  78, 189,  36, 182,  22,  95, 113, 213,  29, 223,
+     101, 214,  53, 222, 161, 182,  64,  80,   4, 216, 200, 112, 101, 214, 150, 176,
+     164, 181, 118,  39, 249, 180, 151,  95, 164, 178, 175,  96, 164, 177, 166, 161,
+     164, 176, 149, 163,  85, 176, 125,  35, 105, 176,  76, 160, 105, 176,  64,  18 };
+
+constexpr byte Sound_C2_RIEN [72] PROGMEM = {
+       0,  72,  47,  47,  33, 180, 224,   0,  38, 181, 254, 176,  53, 181, 222,  48,
+     228, 184,  94,  64, 212, 185,  86,  32, 229, 185,  70,  94,  80, 184,  70,  31,
+     144, 217,  78,  32, 213, 217,  86,  33, 233, 184, 102,  32, 169, 184, 118, 160,
+     121, 183, 142, 192, 169, 181, 150, 192, 168, 181, 158,  61, 100, 180, 133,  32,
+      84, 180, 124,  32,  17, 180,  80,  13 };
+
+constexpr byte Sound_C2_S [72] PROGMEM = {
+       0,  72,  47,  47, 104, 183, 144,   0, 232, 183, 150, 133, 232, 183, 142,  32,
+     228, 183, 142, 192, 248, 183, 143,  63, 249, 183, 143,  63, 184, 183, 143,  63,
+     249, 183, 135,  64,  88, 184, 127,  32,  88, 184, 118,   0, 170, 183, 117,  48,
+      82, 183, 142, 176,   0, 184, 150,  48, 161, 215, 125, 208, 165, 215, 133,  48,
+      18, 215, 148, 208,  17, 183, 144,   1 };
+
+constexpr byte Sound_C2_SA [60] PROGMEM = {
+       0,  60,  46,  47,   0, 153, 128,   0,  21, 215, 124, 176,   0, 217, 125,  80,
+      20, 214, 125,  80,   5, 184, 125, 208,  22, 183, 126,  80,  22, 183, 126,   0,
+     228, 179, 158, 192, 168, 179, 166, 223, 168, 178, 174, 192, 168, 178, 174, 223,
+      88, 177, 173, 189, 104, 178, 101,  63, 100, 177, 120,  15 };
+
+constexpr byte Sound_C2_SANS [76] PROGMEM = {
+       0,  76,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+       8, 179, 103,  34,  20, 174, 199,  64,  85, 174, 174, 190, 101, 173, 166,  63,
+      86, 170, 182,  64,  70, 169, 190,  95,  69, 169, 173,  62,  64, 170, 164,  63,
+      64, 139, 147, 159,  80, 167, 130, 128,  84, 166, 112,  13 };
+
+constexpr byte Sound_C2_SAVOIR [128] PROGMEM = {
+       0, 128,  47,  47,  64, 153, 248,   0,  72, 185, 252,  48,  64, 185, 252, 240,
+      36, 215, 165,  80,  21, 184, 197, 208,  69, 183, 148, 128, 152, 181, 142, 160,
+     172, 181, 158, 160, 153, 180, 150, 192, 173, 178, 134,  62,  65, 150, 133,  94,
+       4, 141, 108, 192,  22, 137, 100, 162,  74, 168, 125,  64,  26, 169,  85, 161,
+      26, 170, 134, 191,  90, 176, 150, 223, 159, 177, 166, 192, 174, 178, 174, 223,
+      94, 178, 174, 192, 158, 178, 174,  95, 190, 177, 174,  32, 110, 177, 181, 224,
+     109, 177, 173, 144, 190, 177, 165, 176,  89, 178, 133, 208,  37, 177, 156, 208,
+      33, 184, 180, 208,  32, 177, 164, 208,  33, 177, 160,   6,  32, 177, 160,  14 };
+
+constexpr byte Sound_C2_SCORE [120] PROGMEM = {
+       0, 120,  47,  47,  53, 181,   0,   0,  22, 182,   4, 176,  43, 182, 117,  48,
+       6, 214, 253, 208,  64, 187, 253, 208,  80, 185, 251, 176,  16, 212, 248,  80,
+      17, 116, 253,  48,   0, 151, 253, 176,  53, 182, 198, 176,  52, 181, 159,  48,
+      48, 181,   5, 136,  85, 146, 126, 160,  86, 177, 134, 160,  85, 175, 150, 192,
+     154, 177, 158, 224, 174, 176, 150, 224, 110, 175, 142, 161, 233, 175, 141, 161,
+     230, 175, 125,  34, 249, 207, 124, 162, 237, 207, 124, 192, 238, 208, 100,  64,
+      38, 208,  68,  80,  38, 208, 101,  48,  22, 174, 188, 208,   6, 177,   4, 208,
+      22, 175,   0,  25,  22, 173,   0,  19 };
+
+constexpr byte Sound_C2_SE [52] PROGMEM = {
+       0,  52,  47,  47,   5, 214, 248,   0,   1, 215, 253, 208,   1, 220, 254,  48,
+       4, 216, 254, 112,  89, 180, 102,  63,  90, 180, 102,  32, 106, 180, 110,  64,
+     239, 181, 110,  95, 187, 180, 101, 190, 230, 181,  92, 160, 211, 181, 100,  33,
+     133, 182,  96,   8 };
+
+constexpr byte Sound_C2_SELECTIONNEE [148] PROGMEM = {
+       0, 148,  47,  47,  20, 183, 224,   0,   4, 183, 117,  80,  21, 184, 117, 176,
+      37, 183, 118,  48, 165, 183, 102,  32, 180, 183, 110,  32, 180, 182,  94,  63,
+     152, 214,  77, 191, 216, 182, 109, 192, 228, 183, 127,  32, 181, 183, 127,  32,
+     181, 152, 102, 160, 237, 152,  84,  32, 136, 152,  80,  16, 196, 152, 112,  48,
+      16, 119, 109,  16,  96, 215, 109, 176,  68, 184, 102,  80,   8, 184,  94,  80,
+       5, 187,  94, 208,  15, 183,  86, 208,  79, 183,  86,   8, 250, 149, 103,  94,
+     149, 181, 102, 222, 152, 179,  61,  32, 152, 180,  69,  32, 136, 180,  69,  32,
+     137, 180,  61,  32, 137, 180,  61,  32, 233, 182, 126, 192, 233, 183, 127,  64,
+     170, 183, 127,  65, 186, 183, 110, 162, 229, 183, 101, 161, 213, 151,  84, 160,
+     196, 183,  64,   2 };
+
+constexpr byte Sound_C2_SES [68] PROGMEM = {
+       0,  68,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     244, 182, 102,  94, 246, 183, 118,  95, 249, 183, 110,  64, 245, 183, 110,  64,
+     229, 184,  94,  64, 229, 184,  93, 193, 229, 184,  92, 161, 241, 184,  83, 161,
+     226, 153,  64,   4 };
+
+constexpr byte Sound_C2_SI [48] PROGMEM = {
+       0,  48,  47,  47,  38, 215,  56,   0,   7, 216,  54, 240,  95, 217,  46, 240,
+     239, 216,  70, 155, 182, 217,  62, 192, 250, 217,  54, 160, 246, 217,  54, 192,
+     245, 217,  54, 188, 233, 217,  61, 223, 105, 216,  37, 164,  89, 216,  56,   9 };
+
+constexpr byte Sound_C2_SI_NOTE_ [76] PROGMEM = {
+       0,  76,  47,  47,  64, 184,  40,   0,  21, 182, 230,  48,   9, 183, 246,  48,
+       5, 183, 254,  80,  10, 184, 246,  48,  78, 185, 230,  16,  14, 184, 166,   5,
+     173, 215,  62,  32, 250, 216,  46,  96, 250, 216,  46,  96, 250, 216,  46,  32,
+     250, 216,  46,  32, 250, 216,  45, 160, 250, 216,  45,  32, 250, 216,  44, 128,
+     250, 216,  44,   0, 246, 216,  43, 128, 249, 216,  40,  27 };
+
+constexpr byte Sound_C2_SIEN [72] PROGMEM = {
+       0,  72,  47,  47,  22, 249, 240,   0,  18, 248, 252, 176,  21, 247, 254,  48,
+      17, 248, 255,  16,   5, 248, 255,  48,   5, 247, 255,  80,  32, 251, 254, 208,
+     164, 215,  69, 192, 160, 215,  78,  32, 169, 215, 102, 192, 185, 182, 134, 223,
+     168, 181, 158, 192, 100, 180, 166, 223,  84, 180, 174,  95,  84, 213, 141,  32,
+       4, 176, 100,  63,  68, 178, 128,  14 };
+
+constexpr byte Sound_C2_SIMPLE [128] PROGMEM = {
+       0, 128,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     168, 179, 141, 175, 168, 179, 183, 163, 169, 211, 191, 191, 165, 179, 199, 222,
+     166, 179, 207,  94, 165, 179, 182, 221, 165, 179, 174,  61, 101, 178, 157, 189,
+     100, 178, 117,  63, 105, 178, 101,  62, 173, 178,  67,  63, 200, 147,  48,  16,
+      65, 178,  56, 112,  20, 181,   0, 112,  20, 181,  76,  16,  85, 149,  93,  48,
+     228, 181,  91,  33, 152, 182,  92,  63,  92, 182,  85,  32,  88, 180, 125, 160,
+     105, 179, 133,  64, 105, 179, 123,  32,  21, 178, 123,  32,  21, 178, 128,  14 };
+
+constexpr byte Sound_C2_SLASH [116] PROGMEM = {
+       0, 116,  47,  47,   0, 153, 248,   0,  95, 183, 213,  48,  95, 183, 214,  48,
+      95, 183, 215, 112,  88, 183, 214, 144,   4, 184,  78,  16, 228, 213,  76, 194,
+     232, 180,  92, 224, 232, 181, 134,  31, 228, 181, 166, 160, 228, 181, 175,  30,
+     164, 180, 199,  96, 116, 180, 198, 154, 164, 180, 206, 191, 168, 180, 206,  62,
+     100, 180, 197, 159,  80, 180, 173, 191, 100, 180, 172, 191,  84, 179, 144,  80,
+      25, 179, 133,  16,  10, 180, 174,  16,  73, 182, 254,  80,  69, 185, 254,  80,
+       4, 217, 254,  80, 133, 186, 253, 144,  72, 218, 253,  48,   4, 218, 252, 144,
+       4, 219, 248,  12 };
+
+constexpr byte Sound_C2_SOIR [112] PROGMEM = {
+       0, 112,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     149, 174, 100, 188, 130, 169, 108,  32, 214, 170,  99, 192, 214, 172, 125,  32,
+     150, 174, 133, 160, 150, 175, 150, 160, 150, 176, 166, 160, 166, 177, 174, 192,
+     102, 177, 182, 192,  86, 177, 182, 192, 166, 177, 182, 192, 102, 177, 174, 192,
+     166, 176, 158,  65, 154, 176, 149, 160, 102, 177, 125,  33, 107, 177, 109,  33,
+      39, 177,  61,  33,  38, 176,   5,  80,  64, 210, 253, 112,  64, 213, 248,  30 };
+
+constexpr byte Sound_C2_SOL [116] PROGMEM = {
+       0, 116,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+      69, 213, 109, 142, 166, 179, 117, 128, 234, 179, 126,   0, 171, 178, 134, 128,
+     171, 178, 150, 160, 171, 176, 158, 192, 171, 177, 158, 160, 175, 177, 150, 191,
+     175, 177, 142, 192, 154, 179, 134, 192, 153, 179, 126,  31, 169, 179, 118,  64,
+     168, 179, 109, 160, 168, 180, 109,  31, 236, 179, 101,  32, 236, 179, 100, 160,
+     236, 179,  92,   0, 232, 179,  91, 128, 200, 178,  91,  32, 220, 180,  82, 160,
+     220, 180,  80,  22 };
+
+constexpr byte Sound_C2_SOLUTION [128] PROGMEM = {
+       0, 128,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+      86, 178, 119,  68, 105, 147, 111,  64,  89, 148, 103,  64, 245, 148,  61, 161,
+     149, 149,  61,  32, 164, 182,  70,  32, 210, 152,  70, 192, 213, 183,  70,  64,
+     153, 183,  69, 222,  18, 216, 253, 176,  21, 215, 254,  48,  17, 216, 255,  16,
+       5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208, 171, 150, 101, 192,
+     170, 150, 109, 160,  90, 178, 125, 192,   5, 170, 141, 192, 132, 168, 141,  64,
+      64, 162, 149,  64, 128, 129, 132, 190,  32, 161, 124,  32,  32, 161, 120,  26 };
+
+constexpr byte Sound_C2_SON [68] PROGMEM = {
+       0,  68,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+      70, 173, 150,  95,  69, 177, 158,  95, 129, 179, 150,  64, 133, 177, 150,  64,
+     133, 179, 142,  64, 196, 180, 134,  64, 133, 171, 124, 160, 129, 172, 107,  32,
+      21, 160,   0,   8 };
+
+constexpr byte Sound_C2_SUITE [104] PROGMEM = {
+       0, 104,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     181, 183,  62,  64, 245, 151,  62,  32, 250, 151,  62, 160, 186, 184,  71,  32,
+     247, 184,  63,  32, 250, 217,  71,  64, 250, 217,  70,  32, 226, 217,  68,  62,
+     209, 215,  67, 162, 192, 215,  64,  80, 192, 214,  64, 112,  33, 182, 208, 112,
+     102, 182, 191, 176,  43, 181, 167, 144, 246, 180, 108, 195, 154, 179, 116, 192,
+     154, 178,  92, 130, 138, 177,  88,  18 };
+
+constexpr byte Sound_C2_SUPERIEUR [176] PROGMEM = {
+       0, 176,  47,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     101, 183,  45, 167, 181, 183,  69,  64, 185, 150,  68, 192, 185, 117,  59,  61,
+      20, 182,  96,  80, 170, 150, 108,  38, 250, 150, 117,  27, 249, 182, 126,  61,
+     185, 182, 134, 190, 185, 181, 142, 192, 185, 181, 142, 224, 106, 181, 142,  32,
+      53, 182,  85, 176,  85, 184,  69, 208, 133, 184,  84, 129, 148, 216,  84,  32,
+     149, 183,  67, 128, 165, 215,  64,  64, 229, 215,  68, 131, 229, 215,  77,   0,
+     250, 183,  93, 128, 250, 182, 102,   0, 250, 182, 126,  32, 185, 181, 134,  63,
+     253, 180, 142,  96, 253, 180, 142,  96, 252, 180, 141, 191, 232, 179, 141,  32,
+      37, 177, 205, 208,  53, 176, 205,  16,  53, 177, 172, 176,  37, 177, 156,  30,
+      37, 177, 115, 128,  25, 177,  83,   0,  24, 177,  66,   0,  44, 177,  56,  29 };
+
+constexpr byte Sound_C2_SUR [64] PROGMEM = {
+       0,  64,  46,  47,  22, 217, 240,   0,  18, 216, 252, 176,  21, 215, 254,  48,
+      17, 216, 255,  16,   5, 216, 255,  48,   5, 215, 255,  80,  32, 219, 254, 208,
+     240, 216,  77, 221, 234, 150,  77, 224,  89, 179,  93, 224, 100, 210, 101,  62,
+      50, 175, 245,  48,  70, 176, 237,  48, 134, 184, 252, 176, 134, 184, 248,  15 };
+
+constexpr byte Sound_C2_T [56] PROGMEM = {
+       0,  56,  47,  47,   0, 153, 248,   0,  84, 215, 229, 176,  38, 183, 142,  47,
+     170, 183,  94, 166, 185, 183, 103,  32, 185, 183, 111,  62, 186, 184, 111,  61,
+     186, 184, 103,  94, 186, 184,  94, 223, 250, 184,  94,  63, 245, 184,  84, 160,
+     233, 184,  83,  62, 232, 184,  80,  18 };
+
+constexpr byte Sound_C2_TA [40] PROGMEM = {
+       0,  40,  47,  47,  16, 186, 248,   0, 233, 181, 126,  33, 233, 180, 143, 160,
+     250, 179, 159, 223, 170, 178, 167,  64, 185, 178, 174, 190,  97, 177, 166,  63,
+      82, 176, 165, 191, 102, 177, 152,  10 };
+
+constexpr byte Sound_C2_TE [40] PROGMEM = {
+       0,  40,  47,  47,  17, 184, 208, 128,  82, 214, 159,  48,  17, 214, 158, 144,
+     129, 215, 102,  61, 158, 180,  94, 224, 234, 180,  94, 224, 213, 180,  93,  32,
+     213, 181,  84,  32, 133, 181,  80,   6 };
+
+constexpr byte Sound_C2_TEMPS [56] PROGMEM = {
+       0,  56,  47,  47,  16, 184, 240,   0,  16, 184, 246, 144,  85, 179, 150, 176,
+     170, 176, 126, 191, 170, 175, 142, 160, 164, 175, 158, 189,  85, 174, 158, 191,
+      85, 172, 166, 192,  85, 170, 158,  64,  85, 170, 157,  94,  85, 170, 156,  95,
+      85, 170, 152,  10,  69, 167, 152,  12 };
+
+constexpr byte Sound_C2_TES [68] PROGMEM = {
+       0,  68,  47,  47,   0, 153, 248,   0,   0, 183,   5, 144,   5, 183, 159, 176,
+     149, 183, 143,  16, 196, 181,  78,  67, 212, 184,  86, 160, 213, 183,  86, 153,
+     229, 183,  94, 156, 213, 184,  94, 160, 212, 184,  94, 158, 212, 184,  94, 160,
+     213, 184,  94, 192, 209, 184,  94, 192, 225, 184,  86,  31, 224, 185,  69, 128,
+     224, 217,  56,   2 };
+
+constexpr byte Sound_C2_TIEN [44] PROGMEM = {
+       0,  44,  47,  47,   9, 217, 232,   0,  10, 218,   5, 176,  89, 217,  45, 176,
+      93, 216,  61,   0, 153, 217,  77,  32, 170, 183, 111,  64, 150, 180, 151,  96,
+      85, 179, 150, 192, 149, 178, 150,  64, 154, 179, 136,   0 };
+
+constexpr byte Sound_C2_TIRET [120] PROGMEM = {
+       0, 120,  47,  47,   0, 213, 200,   0,   4, 213, 205,  16,   8, 209, 141,  16,
+       8, 214, 181,  16,  10, 214,   5,  16, 153, 216,  61,  39, 245, 216,  61,  64,
+     229, 216,  61,  64, 181, 184,  69, 159, 170, 184,  85, 160, 170, 184,  94,   0,
+     170, 184,  94, 128, 110, 183, 111,  32,  46, 182, 118, 189,  36, 181, 110,  61,
+      37, 181,  86,  16, 101, 181, 118,  48, 105, 180, 126,  48, 121, 180, 125,   0,
+     121, 181, 133, 132, 189, 181, 142,  33, 189, 181, 142, 128, 185, 181, 158, 192,
+     104, 182, 142, 223, 185, 183, 125, 160, 184, 183, 125,  31, 164, 182, 124, 160,
+     244, 151, 116,  30, 164, 183,  96,   0 };
+
+constexpr byte Sound_C2_TOI [68] PROGMEM = {
+       0,  68,  47,  47,   4, 180, 248,   0,   4, 183, 238, 144,  21, 179, 135, 144,
+      66, 151, 255,  16, 128, 152, 254,  48, 101, 143, 109,  59, 251, 171,  91, 192,
+     231, 171, 100,  32, 171, 172, 109,  32, 175, 173, 125, 160, 175, 174, 134,  63,
+      90, 175, 150, 160, 174, 176, 158, 224, 169, 176, 166,  32, 169, 175, 149,  32,
+      89, 175, 104,  12 };
+
+constexpr byte Sound_C2_TON [56] PROGMEM = {
+       0,  56,  47,  47,   5, 215, 248,   0,   1, 215, 247,  48,   1, 181, 222,   7,
+     151, 176, 109,  32, 170, 176, 126,  32,  89, 173, 142,  62,  73, 171, 158,  95,
+     132, 173, 142,  62, 132, 179, 134,  64, 200, 179, 125,  95, 136, 178, 116, 223,
+     137, 168, 107, 160, 136, 176, 112,  13 };
+
+constexpr byte Sound_C2_TOUJOURS [120] PROGMEM = {
+       0, 120,  47,  47,   0, 153, 248,   0,   0, 184, 253, 144,  69, 183, 255, 176,
+     130, 217, 255,  16,  16, 179,   5, 163,  85, 176,  93, 160,   9, 172,  53, 160,
+      73, 175,  85, 191,  72, 181,  93, 192,  25, 147,  77, 189,  30, 218, 125,  57,
+      30, 218, 125, 128,  30, 218, 125, 160,  30, 218, 117, 160,  30, 218, 118,  80,
+      30, 218, 117, 132, 136, 147, 101, 160, 132, 146, 101, 160, 149, 174,  93,  64,
+     217, 172,  84,  64, 197, 170,  92,  64, 134, 168,  92,  64,  70, 168, 100, 192,
+     138, 170, 108, 192, 154, 171, 100,  32, 134, 174,  83, 160,  81, 175,  99,  32,
+       0, 151, 249, 160,  16, 238,   0,  12 };
+
+constexpr byte Sound_C2_TOUT [36] PROGMEM = {
+       0,  36,  47,  47,  40, 216, 208,   0,  24, 216, 207, 144,  64, 185, 255, 144,
+      21, 179,   6,  34,  70, 168,  93,  96,  67, 200,  92,  93, 130, 213,  83, 223,
+     146, 182,  80,  12 };
+
+constexpr byte Sound_C2_TRES [56] PROGMEM = {
+       0,  56,  47,  47,  36, 181, 248,   0,  36, 181, 253,  16,  53, 181, 237, 208,
+      37, 180, 213,  80,  37, 181, 181, 144, 164, 181, 126,  32, 184, 182, 135,  32,
+     253, 182, 135, 192, 228, 183, 135,  64, 186, 183, 119,  64, 169, 182, 110,   0,
+     148, 149, 100,   0,  64, 150,  56,   0 };
+
+constexpr byte Sound_C2_TROUVER [92] PROGMEM = {
+       0,  92,  47,  47,   5, 149, 248,   0,   5, 149, 252,  16,   4, 185, 239, 176,
+       1, 175,  77, 176,  69, 182, 205,  48, 215, 182, 181,  80, 139, 182, 188, 208,
+      22, 161, 124, 191, 137, 172, 109, 192,  68, 174, 117, 223,  68, 182, 117, 222,
+      73, 147,  85,  64, 234, 149, 101, 193, 232, 183, 101, 192, 237, 183,  93, 192,
+     228, 184,  93, 192, 228, 184,  77,  32, 249, 184,  68, 161, 212, 185,  76,  63,
+     196, 184,  75,  32, 224, 184,  66, 191, 196, 183,  72,  12 };
+
+constexpr byte Sound_C2_TU [44] PROGMEM = {
+       0,  44,  47,  47,  85, 184, 240,   0,  20, 216, 254,  16,  34, 216, 174, 176,
+      22, 184,   6,  63, 113, 184,  62, 160, 118, 183,  70, 160, 118, 184,  62, 223,
+     182, 184,  62,  63, 182, 184,  61, 190, 179, 184,  64,  12 };
+
+constexpr byte Sound_C2_T_UN [68] PROGMEM = {
+       0,  68,  47,  47, 208, 183,  96,   0,   0, 182, 166,  16,  20, 182, 206, 176,
+     101, 181, 175,  16, 105, 180, 142,  15, 185, 179, 142, 156, 170, 179, 142, 156,
+     186, 179, 150, 156, 169, 179, 158, 160,  86, 179, 166, 223,  86, 179, 182, 192,
+     102, 177, 174, 190,  86, 177, 166, 160,  81, 177, 158, 161, 145, 177, 158, 128,
+     146, 175, 144,   3 };
+
+constexpr byte Sound_C2_T_UNE [88] PROGMEM = {
+       0,  88,  47,  47,   1, 181, 248,   0,   0, 185, 254, 144,  36, 250, 230, 144,
+      36, 218, 223,  16,  17, 218, 255,  16,  80, 185,  62,  37, 166, 151,  70, 192,
+     102, 151,  71,  62,  98, 151,  55, 128, 101, 151,  39, 160, 100, 183,  79, 160,
+      84, 183,  87,   0,  72, 183,  70, 128, 152, 179,  62,  33, 216, 181,  53,  32,
+     152, 179,  60, 192, 220, 175,  60, 192, 220, 176,  60,  64, 132, 177,  68,  32,
+     213, 178, 100,  63, 234, 179, 123, 189 };
+
+constexpr byte Sound_C2_U [48] PROGMEM = {
+       0,  48,  47,  47, 209, 184,  64,   0, 225, 152,  70,  37,  97, 152,  71,  63,
+      97, 152,  55,  63,  96, 152,  71,  96,  96, 152,  62, 160, 165, 151,  70,  62,
+     165, 151,  77, 160, 161, 185,  68, 191, 225, 184,  59, 128, 208, 151,  56,   0 };
+
+constexpr byte Sound_C2_UN [64] PROGMEM = {
+       0,  64,  47,  47, 208, 179, 224,   0, 208, 179, 227,   8, 149, 177, 181, 160,
+     150, 177, 166, 160, 166, 177, 167,  32, 183, 177, 167, 191, 183, 177, 167, 224,
+     183, 177, 167,  61, 182, 177, 167,  95, 181, 177, 158, 191, 116, 177, 125,  62,
+     100, 177, 100,  62, 100, 177,  83,  48,  84, 177,  74, 144,  84, 177,  72,  14 };
+
+constexpr byte Sound_C2_UNE [84] PROGMEM = {
+       0,  84,  47,  47,  80, 185,  56,   0, 166, 151,  70, 194, 102, 151,  70, 191,
+      98, 151,  54, 128, 101, 151,  38, 160, 100, 183,  78, 160,  84, 183,  86, 128,
+      72, 183,  70, 128, 216, 181,  53,  33, 152, 179,  60, 192, 220, 176,  60,  64,
+     132, 177,  68,  32, 213, 178, 100,  63, 234, 179, 123, 189, 235, 179, 123, 128,
+     171, 179, 131,   0, 235, 179, 130, 128, 170, 179, 138,   0, 251, 180, 137,   0,
+     247, 179, 128,   0 };
+
+constexpr byte Sound_C2_V [84] PROGMEM = {
+       0,  84,  47,  47,  21, 180,  64,   0, 105, 147,  82, 151, 170, 147,  82, 160,
+     101, 179,  83,  32,  21, 179,   4,  32,   4, 181, 157,  48,  20, 183,   5, 176,
+      20, 180, 174,  80,  21, 180,   5, 165,  37, 182,   6, 164, 106, 182, 119,  36,
+     186, 182, 127, 161, 185, 183, 127, 192, 185, 183, 119, 190, 170, 184, 111,  63,
+     185, 184, 111,  95, 185, 184,  94, 191, 248, 184,  93,  62, 233, 184,  75, 191,
+     233, 184,  72,  31 };
+
+constexpr byte Sound_C2_VALIDATION [128] PROGMEM = {
+       0, 128,  47,  47,   0, 179, 168,   0,  41, 180, 118, 194, 105, 180, 143,  63,
+      90, 181, 127,  95, 169, 183, 110, 192, 105, 183,  86,  32, 105, 216,  77, 190,
+     105, 216,  77, 194, 186, 216,  70,  32, 187, 217,  78,  96,  21, 214, 112,  94,
+     254, 183, 102,  34, 169, 182, 119,  63, 169, 182, 119,  64, 125, 182, 134, 191,
+     125, 182, 134, 192, 165, 182, 125, 191, 165, 182, 125, 192,   5, 183, 253, 144,
+      50, 220, 254,  80,  10, 185, 254, 208,  72, 185, 253, 208,  97, 183, 181,  13,
+     165, 150, 109,  35, 128, 148, 116, 186,  72, 176, 116, 223,  72, 176, 132,  64,
+     136, 173, 115, 192,  72, 171,  90,  33, 140, 171,  65, 160, 136, 173,  56,  31 };
+
+constexpr byte Sound_C2_VENIR [84] PROGMEM = {
+       0,  84,  47,  47,  84, 182,  96,   0, 152, 181,  93,  28, 153, 180, 102,  33,
+     173, 180, 111,  32, 253, 182,  94, 224, 220, 181,  69, 160, 232, 183,  77, 192,
+     212, 183,  69, 192, 217, 216,  70,  64, 201, 216,  78,  64, 216, 216,  70,  95,
+     212, 216,  70,  95, 213, 217,  69, 192, 196, 217,  69,  95, 212, 217,  68, 223,
+     212, 217,  68, 192, 148, 217,  77,  95, 228, 185,  76, 223, 228, 185,  72,  12,
+     208, 186,  80,  14 };
+
+constexpr byte Sound_C2_VENT [68] PROGMEM = {
+       0,  68,  47,  47,  90, 180,  64,   0,  89, 180,  93, 154,  85, 180, 102,  32,
+      26, 177, 110,  61,   6, 178, 118,  32,  78, 179, 142,  33,  94, 176, 142,  33,
+      94, 174, 166, 192, 175, 174, 166, 192, 170, 173, 158, 191, 170, 172, 158,  32,
+     150, 172, 157, 160,  90, 170, 173, 192, 102, 170, 125,  33,  84, 169, 107, 160,
+      68, 165, 120,   8 };
+
+constexpr byte Sound_C2_VIRGULE [128] PROGMEM = {
+       0, 128,  47,  47, 148, 181,  96,   0,  85, 181,  66, 133,  85, 183, 108, 160,
+      25, 182,  46,  32, 212, 216,  62,  65, 228, 184,  86, 193, 248, 182, 126, 192,
+     117, 180, 110,  93,  33, 213,  77, 192,  32, 182, 141,  30, 144, 182,  82,  32,
+     132, 146,  40,  96, 129, 184,  51,   0,  96, 152,  36,   0, 160, 184,  52, 160,
+     233, 152,  52,  32, 166, 152,  60, 128, 170, 151,  61,  32, 166, 151,  69, 160,
+     166, 151,  77, 223, 165, 151,  76, 191, 233, 150,  68,  32, 213, 150,  76,  64,
+     228, 150,  67,  60, 160, 150,  50, 191, 165, 150,  68, 162, 233, 150,  68,   1,
+     233, 150,  68,  32, 236, 182,  60,  96, 105, 181, 107, 224, 184, 180, 120,  12 };
+
+constexpr byte Sound_C2_VOICI [92] PROGMEM = {
+       0,  92,  47,  47,  81, 183,  96,   0,  16, 213, 100,  34,  65, 183, 116, 160,
+      22, 172, 117,  33,  27, 170, 117, 161,  22, 173, 118,  32, 153, 169,  92, 165,
+     170, 172, 125, 194, 238, 176, 158, 192, 238, 179, 150, 192, 152, 181, 110,  64,
+      85, 215, 149, 112,  17, 216, 173, 112,   6, 184, 181, 208,  26, 216, 198,  48,
+      26, 216,   6, 176, 106, 216,  62,  61, 186, 216,  62,  64, 186, 216,  70,  64,
+     182, 216,  53, 192, 182, 216,  53, 223, 101, 215,  48,  17 };
+
+constexpr byte Sound_C2_VOILA [72] PROGMEM = {
+       0,  72,  47,  47,  81, 183,  96,   0,  16, 213, 100,  34,  65, 183, 116, 160,
+      22, 172, 117,  33,  27, 170, 117, 161,  22, 173, 118,  32, 153, 169,  92, 165,
+     170, 172, 125, 194, 238, 176, 158, 192, 238, 179, 150, 192, 152, 181, 110,  64,
+     237, 181,  94,  64, 233, 181, 143,  64, 238, 180, 159,  95, 234, 177, 166,  96,
+     162, 175, 157, 222, 162, 175, 152,  18 };
+
+constexpr byte Sound_C2_VOIR [120] PROGMEM = {
+       0, 120,  47,  47,  73, 177,  96,   0, 154, 176,  92,  54,  90, 177, 100, 160,
+       1, 174,   4, 160,   0, 151, 204, 160,   5, 152, 220, 161,  80, 215, 117, 164,
+     128, 215, 109, 160, 129, 144, 117, 160, 151, 171, 117, 192,  66, 171, 158, 161,
+      86, 174, 159,  64, 169, 177, 167,  64, 184, 177, 175,  64, 164, 177, 175,  64,
+     168, 177, 174, 189, 169, 177, 174, 191,  88, 178, 174,  63, 168, 178, 174,  62,
+     100, 178, 165, 160,  41, 177, 133, 160,  40, 177, 149, 160,  41, 177, 149, 160,
+      40, 177, 133, 160,  89, 178, 149,  80,  36, 177, 140, 208,  32, 208, 140, 240,
+      32, 208, 136,   8,  32, 208, 136,  14 };
+
+constexpr byte Sound_C2_VOS [52] PROGMEM = {
+       0,  52,  47,  47,   5, 177,  48,   0,  16, 178,  52, 185,   0, 179,  60, 193,
+      64, 215,  85, 194,  64, 152, 118,  34, 137, 171, 134, 162, 129, 176, 127,  65,
+      74, 169, 127,  64, 154, 168, 118,  62, 173, 168, 101,  61, 234, 167, 100,  32,
+     169, 167,  80,   0 };
+
+constexpr byte Sound_C2_VOTRE [108] PROGMEM = {
+       0, 108,  47,  47,  21, 177,   0,   0,   0, 180,  29,  18,  64, 181, 125, 161,
+     170, 176, 126, 162, 175, 175, 143,  32, 106, 175, 143,  32, 154, 175, 143,  32,
+     174, 175, 143,  32, 154, 176, 135,  32, 166, 176, 135,  33, 169, 178, 127,  32,
+     250, 178, 109, 162, 196, 173, 112, 112,  81, 216, 120, 112,  64, 249, 254, 144,
+      17, 147, 255,  48,  64, 184, 254, 176,  65, 148, 253, 176, 128, 152, 253, 176,
+      21, 178,  61,  48,  17, 177, 205,  48,  21, 176,  76, 176, 213, 178,  92,  37,
+     197, 179,  83, 160, 197, 179,  91, 160, 234, 179,  56,  24 };
+
+constexpr byte Sound_C2_VOUS [44] PROGMEM = {
+       0,  44,  47,  47,  82, 180,  64,   0,  87, 178,  68, 152, 164, 178,  69,  32,
+      68, 179,  77, 192,  80, 214,  54, 223,  89, 174,  87,  65, 129, 174, 103,  65,
+      69, 166, 110, 192,  21, 161, 110, 192,  69, 167,  96,   4 };
+
+constexpr byte Sound_C2_VRAIMENT [108] PROGMEM = {
+       0, 108,  47,  47,  80, 178,  72,   0,  84, 178,  93,  18,  81, 178, 125,  34,
+      85, 176, 125,  32, 170, 176, 124, 191, 150, 178, 116, 189,  81, 178, 108, 160,
+     229, 180, 116, 194, 233, 149, 133, 164, 185, 149, 142, 160, 184, 182, 143,  64,
+     180, 182, 142, 191, 101, 149, 126, 160,  68, 150,  69,  63,  68, 151,  69,  64,
+      68, 182,  77,  64,   0, 176, 134, 160,  21, 173, 159,  96,   5, 172, 174, 192,
+      72, 168, 190,  64,  68, 166, 173,  35,  93, 169, 116,  35,  20, 167, 107, 160,
+      64, 165,  51,  63,  68, 171,  18, 191, 132, 174,  40,  30 };
+
+constexpr byte Sound_C2_W [148] PROGMEM = {
+       0, 148,  47,  47,  33, 217, 200,   0,  17, 182,   6, 139,  86, 181,  70, 128,
+       1, 177,  78, 160,  21, 166,  46,  32,  21, 166,  45, 192,  21, 166,  45,   0,
+      21, 166,  44, 190,  69, 170,  76, 160,  65, 175,  60,  62, 132, 175,  35,  27,
+     132, 164,  32,  16, 128, 149,  40,  48,  20, 146,   0,  80,  20, 147,   4,   6,
+      24, 115,  29,  32, 182, 117,  61, 192, 117, 117,  54,  29, 100, 149,  70, 130,
+     169, 180, 111,  96, 174, 179, 102,  60, 165, 179,  85,  62,  85, 179,  80,   0,
+     128, 181,  80,  94,  89, 182,  56,  97, 184, 182,  93, 162, 245, 182, 102, 161,
+     249, 183, 103,  64, 249, 183, 102, 158, 249, 184, 102, 160, 248, 184, 102, 192,
+     249, 184,  94, 160, 228, 184,  93, 129, 225, 153,  92, 161, 200, 153,  67, 161,
+     200, 152,  72,   0 };
+
+constexpr byte Sound_C2_X [84] PROGMEM = {
+       0,  84,  47,  47,  81, 186,  80,   0, 161, 217,  69, 140, 248, 217,  70, 160,
+     248, 217,  62, 192, 184, 217,  63,  94, 180, 250,  62,  62,  64, 153,  32,  16,
+      64, 149, 248,  80,  17, 184, 246, 112,  16, 215, 253, 176,  16, 216, 253, 176,
+      64, 217, 253, 208,  16, 214, 253,  48,  17, 215, 253,  80,  22, 214, 229,  48,
+     170, 181, 100,  34, 169, 180, 100,  32, 166, 180,  99,  32, 122, 180,  88, 160,
+      98, 180, 104,  28 };
+
+constexpr byte Sound_C2_Y [132] PROGMEM = {
+       0, 132,  47,  47,   0, 153, 248,   0, 164, 249,  75, 135, 248, 249,  61,  36,
+     248, 217,  53,  64, 244, 217,  53,  95, 244, 218,  52, 188, 244, 250,  44,  30,
+     136, 148,  40,  48, 141, 146,  24,  80,   5, 184,   5,  16,   0, 183,   6, 144,
+       5, 150,   6,  16,   5, 153,  37, 144, 153, 183, 101, 192,  29, 181, 102,  93,
+      40, 180,  93, 160, 153, 180, 117,  36, 152, 181, 134,   2,  89, 181, 143,   1,
+     236, 181, 159,  95, 232, 182, 158, 190, 225, 183, 134, 192, 216, 184, 102,  64,
+     216, 185, 101, 131, 144, 216, 112, 112,   4, 185, 252, 144,   4, 184, 254,  16,
+      24, 184, 197, 208,  41, 185, 165,  16,  36, 184, 156, 176,  85, 184, 148,  48,
+      85, 184, 144,   5 };
+
+constexpr byte Sound_C2_Z [96] PROGMEM = {
+       0,  96,  47,  47,  46, 181,  48,   0, 126, 181, 101,  33, 126, 181, 109, 163,
+     190, 181, 126,  32, 190, 181, 126, 160, 190, 181, 143,   0, 190, 182, 151, 156,
+     254, 182, 151,  62, 126, 183, 151, 192, 190, 183, 127,  94, 254, 183, 126, 157,
+     238, 183, 109, 157, 190, 183, 100, 128, 254, 183,  92,  20,  64, 215,  16, 112,
+       0, 183,  10, 144,  84, 182, 187, 144,  96, 182, 164,  16, 237, 181, 123,  32,
+     253, 181, 139, 192, 185, 180, 138, 161, 248, 180, 129, 165, 148, 178, 136,  14 };
+
+constexpr byte Sound_C2_ZERO_NR [80] PROGMEM = {
+       0,  80,  47,  47, 149, 181,  32,   0, 121, 181,  12,  61,  22, 181,   4, 192,
+      41, 181,   5,  33, 106, 181,  86,  37, 191, 181,  94, 164, 186, 183, 103, 192,
+     186, 151, 111, 192, 171, 150, 119,  63,  91, 146, 118, 186,  90, 144, 125, 176,
+      34, 139, 132, 176,  69, 135, 140,  48,  73, 165, 125, 127, 137, 164, 116, 191,
+     105, 167, 108,  63, 104, 175, 107, 191, 168, 181, 115,  33, 136, 179,  88,  12 };
+
+constexpr byte Sound_C2_UN_NR [56] PROGMEM = {
+       0,  56,  47,  47, 208, 179, 224,   0, 208, 179, 227,   8, 149, 177, 181, 160,
+     150, 177, 166, 160, 166, 177, 167,  32, 183, 177, 167, 191, 183, 177, 167, 224,
+     181, 177, 158, 186, 116, 177, 125,  62, 100, 177, 100,  62, 100, 177,  83,  48,
+      84, 177,  74, 144,  84, 177,  72,  14 };
+
+constexpr byte Sound_C2_DEUX_NR [64] PROGMEM = {
+       0,  64,  47,  47,   1,  31,   0,   0,   1,  31,   3,  16,   1, 122, 108, 144,
+       1, 150, 125, 145,  29, 181,  95,  42, 153, 181, 103,  32, 229, 181, 111,  64,
+     229, 180, 111,  64, 233, 180, 109, 191, 254, 180, 101,  61, 237, 180,  92,  60,
+     213, 180,  99,  60, 192, 180, 106, 160, 192, 180, 106,   5, 192, 180, 104,  14 };
+
+constexpr byte Sound_C2_TROIS_NR [72] PROGMEM = {
+       0,  72,  47,  47, 192, 180, 104,   0,   4, 185, 252,   0,  69, 184, 255,  48,
+      38, 173, 198,  48, 130, 178, 181, 176, 135, 174, 173,  48,  39, 166, 117,  48,
+      38, 160,   3, 176, 154, 162, 124,  32, 154, 163, 141,  64, 106, 165, 149, 160,
+     173, 170, 150,  64, 169, 172, 166, 223, 185, 172, 174, 191, 109, 172, 174,  63,
+     109, 172, 173, 154, 109, 172, 168,  14 };
+
+constexpr byte Sound_C2_QUATRE_NR [80] PROGMEM = {
+       0,  80,  47,  47,  16, 217, 248,   0,  16, 217, 254, 144, 136, 184,  94,  47,
+     245, 183, 126,  57, 229, 149, 151,  56, 233, 147, 183,  95, 184, 147, 183,  64,
+     168, 179, 167,  64, 168, 180, 157, 191, 128, 215, 144,  80,  17, 150, 155,  48,
+      20, 180, 165, 176,  17, 178, 205, 176,  97, 180, 221, 176, 117, 178, 181, 176,
+     121, 177, 141,  48, 121, 177, 108, 176,  41, 177,  83, 144,  41, 177,  80,   6 };
+
+constexpr byte Sound_C2_CINQ_NR [84] PROGMEM = {
+       0,  84,  47,  47,   0, 247,  48,   0,  16, 247,  92, 176,  20, 247, 173,  48,
+       4, 245, 189, 208,  85, 177, 134, 163, 168, 178, 143,  32, 164, 178, 167, 192,
+      84, 179, 167, 255,  84, 180, 166, 223,  64, 148, 100, 223, 148, 150, 100,  63,
+     132, 150,  91, 191,  80, 184,  91,  32,  69, 182,  56,  80,   4, 182, 252, 176,
+       8, 185, 206,  48,   9, 186, 197, 208,   8, 184,   4, 176,  29, 183,  67, 144,
+      29, 183,  64,  14 };
+
+constexpr byte Sound_C2_CIN_CENT_NR [64] PROGMEM = {
+       0,  64,  47,  47,   0, 247,  48,   0,  16, 247,  92, 176,  20, 247, 173,  48,
+       4, 245, 189, 208,  85, 177, 134,  35, 168, 178, 142, 160, 164, 178, 167,  64,
+      84, 179, 167,  94,  84, 180, 166, 190, 100, 180, 141,  61,  64, 148, 100, 160,
+     148, 150, 100,  32, 132, 150,  91, 191,  80, 184,  91,  32,  69, 182,  56,  14 };
+
+constexpr byte Sound_C2_SIX_NR [76] PROGMEM = {
+       0,  76,  47,  47,   5, 216, 128,   0,   5, 216, 132, 144,   5, 215,  85, 176,
+      10, 215,  70,  48,  10, 215,  70, 176,  10, 215,  70, 176, 174, 216,  62, 176,
+     168, 217,  62, 208, 120, 217,  46, 194, 120, 217,  46, 224, 120, 217,  46, 224,
+       2, 183, 110,  80,   2, 215, 109, 208,   2, 215, 109, 208,   6, 215, 109, 208,
+       6, 214, 109,  48,   6, 214, 108,  16,   6, 214, 104,  24 };
+
+constexpr byte Sound_C2_SI_CENT_NR [52] PROGMEM = {
+       0,  52,  47,  47,   5, 216, 128,   0,   5, 216, 132, 144,   5, 215,  85, 176,
+      10, 215,  70,  48,  10, 215,  70, 176,  10, 215,  70, 176, 174, 216,  62, 176,
+     168, 217,  62, 208, 120, 217,  46,  66, 120, 217,  45, 192, 120, 217,  45, 224,
+       6, 182,   0,  24 };
+
+constexpr byte Sound_C2_SEPT_NR [100] PROGMEM = {
+       0, 100,  47,  47,  16, 214, 184,   0,  16, 214, 188,  16,  16, 217, 244, 176,
+       0, 216, 253,  48,   0, 215, 253, 176,  16, 215, 254,  48,  16, 214, 238,  80,
+      88, 182, 158, 176, 168, 181, 118, 163, 184, 181, 143,  32, 180, 182, 143, 255,
+     248, 183, 135,  62, 248, 183, 118,  63, 228, 183, 116,  48, 228, 183, 130, 176,
+     192, 183, 128, 112, 192, 183, 131,  48,   1, 182, 253, 176,  65, 182, 254, 176,
+      21, 181, 238,  48,  85, 181, 221, 176,  85, 181, 212, 176,  85, 181, 179, 144,
+      85, 181, 176,   8 };
+
+constexpr byte Sound_C2_HUIT_NR [92] PROGMEM = {
+       0,  92,  47,  47,  85, 150,  80,   0,  85, 150,  83,  24, 229, 148,  44, 192,
+     149, 148,  45,  65, 238, 151,  46,  67, 229, 185,  46, 160, 240, 249,  46, 223,
+     240, 249,  46,  63, 212, 217,  53,  32, 144, 217,  52,  48, 128, 185,  51,  48,
+     129, 183,  40,  80, 129, 183,  40, 112,  16, 182, 110,  48,  16, 182, 126, 176,
+      16, 182, 150, 176,  86, 181, 198,  80,  85, 181, 174,  48, 153, 181, 142,  48,
+     218, 181, 133,  48, 218, 181, 124,  16, 218, 181, 120,  30 };
+
+constexpr byte Sound_C2_HUI_CENT_NR [52] PROGMEM = {
+       0,  52,  47,  47,  85, 150,  80,   0,  85, 150,  83,  24, 229, 148,  44, 192,
+     149, 148,  45,  65, 238, 151,  46,  67, 229, 185,  46, 160, 240, 249,  46, 223,
+     240, 249,  46,  63, 212, 217,  53,  32, 144, 217,  52,  48, 128, 185,  51,  48,
+     129, 183,  40,  30 };
+
+constexpr byte Sound_C2_NEUF_NR [80] PROGMEM = {
+       0,  80,  47,  47,   0, 177,   0,   0, 132, 181,  35,  61, 218, 179,  35, 192,
+     214, 180,  36, 193, 222, 180,  45,  64, 154, 181,  54,  34, 185, 181, 119,  32,
+     186, 180, 159, 191, 189, 180, 151, 223, 189, 180, 135, 190, 189, 180, 134, 190,
+     189, 180, 134,  32,  84, 183, 157, 208,  85, 185, 165,  48,  85, 187, 172, 208,
+      85, 155, 196, 208,  81, 155, 236, 208,  81, 155, 251, 144,  81, 155, 248,  12 };
+
+constexpr byte Sound_C2_DIX_NR [68] PROGMEM = {
+       0,  68,  47,  47, 161, 255,   8,   0,  65, 216,  30,  59, 129, 214,  46, 160,
+     153, 216,  46, 163, 246, 217,  46, 194, 244, 217,  46, 192, 170, 217,  46, 223,
+      20, 248,  46, 176,   4, 248,  46, 208,   0, 247,  38, 112,   0, 247,  37, 208,
+       0, 247,  29,  48,   0, 247,  28, 176,   0, 246,  28,  48,   0, 246,  27, 144,
+       0, 246,  24,   0 };
+
+constexpr byte Sound_C2_DI_MILLE_NR [36] PROGMEM = {
+       0,  36,  47,  47, 161, 255,   8,   0,  65, 216,  30,  59, 129, 214,  46, 160,
+     153, 216,  46, 163, 246, 217,  46, 194, 244, 217,  46, 192, 170, 217,  46, 223,
+      37, 248,  48,   0 };
+
+// The ugly and NOT '11' one from the catalog
+constexpr byte Sound_C2_ONZE_NR_ugly [72] PROGMEM = {
+       0,  72,  47,  47, 193, 183, 168,   0, 194, 217, 166, 175, 198, 216, 167,  34,
+     198, 214, 159,  64, 198, 216, 159,  64, 198, 215, 135,  95, 198, 215, 134, 189,
+     198, 216, 142, 255, 197, 216, 150, 126, 197, 185, 142,  64, 132, 186, 158,  95,
+      85, 245, 117,  95,  85, 245, 116, 192, 173, 180, 108,  64, 157, 178,  91, 190,
+     157, 178,  91, 160, 157, 178,  88,  12 };
+
+// A beter '11' by myself...
+constexpr byte Sound_C2_ONZE_NR [72] PROGMEM = {
+       0,  32,  47,  47,   0, 153, 248,   0,  89, 200, 158, 160, 133, 169, 150, 224,
+     136, 208, 126, 224, 196, 211, 117,  60, 129, 185, 116,  32, 128, 177, 128,   8,
+     101, 170,  85, 224, 102, 169,  93, 221, 196, 176, 133, 187,  85, 245, 117,  96,  
+      84, 245, 116, 191,  84, 245, 116, 192, 173, 180, 108,  64, 157, 178,  91, 191, 
+     157, 178,  91, 191, 157, 178,  88,  13 };
+
+
+constexpr byte Sound_C2_DOUZE_NR [68] PROGMEM = {
+       0,  68,  47,  47, 132, 181, 176,   0,   1, 182, 126, 132,   1, 182,  95,   3,
+      21, 179,  71,  36, 101, 174,  70, 192, 101, 170,  78,  64, 101, 170,  85, 224,
+     102, 169,  93, 221, 196, 176, 133, 187,  85, 245, 117,  96,  84, 245, 116, 191,
+      84, 245, 116, 192, 173, 180, 108,  64, 157, 178,  91, 191, 157, 178,  91, 191,
+     157, 178,  88,  13 };
+
+constexpr byte Sound_C2_TREIZE_NR [104] PROGMEM = {
+       0, 104,  47,  47,  37, 180, 248,   0,  57, 180, 164, 144,  41, 180, 228, 144,
+      41, 179, 156, 144,  42, 180,  36, 144,  41, 180, 124, 144, 121, 180, 132, 176,
+     108, 180, 140, 165, 109, 180, 149, 160, 125, 180, 166, 161, 189, 181, 175,  63,
+     120, 181, 175,  95, 184, 182, 175,  62, 120, 182, 167,  64, 109, 182, 159,  95,
+     125, 183, 151,  64, 173, 183, 134,  62, 189, 182, 125, 191, 174, 182, 117,  63,
+     173, 182, 108, 223, 185, 181, 108,  64, 105, 213,  75, 192,  89, 213,  75,  32,
+      22, 212,  58, 192,  21, 213,  64,  14 };
+
+constexpr byte Sound_C2_QUATORZE_NR [120] PROGMEM = {
+       0, 120,  47,  47,  17, 187, 224,   0, 216, 184,  94,  43, 228, 183, 127,  32,
+     164, 182, 143, 189, 169, 181, 151,  63, 168, 181, 125, 189, 224, 181, 120,  48,
+     192, 215, 128, 112,   0, 215, 149,  48,   4, 181, 181, 176, 149, 179, 124, 164,
+     165, 146, 133,  59, 185, 177, 150,  62, 173, 175, 150, 192, 173, 174, 150,  95,
+     189, 173, 150,  64, 189, 173, 149, 223, 189, 173, 141, 223, 125, 173, 141,  30,
+     109, 172, 141,  64, 109, 172, 124, 191, 188, 172, 132,  32, 188, 172, 123, 160,
+     109, 172, 115,  32,  30, 171, 107,  64,  28, 238, 115,  64,  76, 207, 114, 192,
+      27, 208, 106, 192,  27, 208, 104,  14 };
+
+constexpr byte Sound_C2_QUINZE_NR [80] PROGMEM = {
+       0,  80,  47,  47, 168, 216,  88,   0, 168, 216,  93, 141, 229, 183, 118, 162,
+     233, 182, 143, 160, 168, 181, 175, 192, 100, 181, 175, 223, 100, 181, 183, 223,
+     100, 181, 175,  95, 101, 180, 175,  95, 100, 180, 166, 222,  80, 180, 158,  95,
+      80, 179, 157, 160, 100, 179, 141,  63,  80, 179, 124, 160,  80, 178, 116,  63,
+      88, 178,  91, 192,  86, 213,  67,  64,  75, 213,  19,  64,  22, 212,   0,  15 };
+
+constexpr byte Sound_C2_SEIZE_NR [116] PROGMEM = {
+       0, 116,  47,  47,  15, 218, 112,   0,  15, 218, 115, 176,  15, 218, 116, 176,
+      15, 218, 117,  48,  15, 218, 117,  16,   9, 216, 117, 176,   9, 214, 101, 176,
+     153, 181, 110,  48, 248, 181, 126,  38, 224, 181, 142, 191, 248, 181, 151,  63,
+     248, 181, 151, 158, 248, 182, 151, 191, 248, 182, 143, 223, 185, 182, 143, 192,
+     169, 183, 143, 190, 185, 183, 127,  95, 249, 183, 126, 190, 233, 183, 118, 160,
+     253, 183, 109, 160, 232, 182, 101,  32, 233, 181,  92, 160, 173, 181,  76,  64,
+      84, 219,  84,  31,  84, 219,  83, 192,  85, 181, 107,  64, 144, 179, 123,  64,
+     144, 178, 120,  13 };
+
+constexpr byte Sound_C2_DIX_SEPT_NR [120] PROGMEM = {
+       0, 120,  47,  47,   0, 182,   0,   0,   0, 181,   3, 130,   4, 214,   4, 128,
+     137, 214,  37,   0, 132, 216,  36, 128, 212, 216,  36,   3, 229, 217,  35, 130,
+     230, 217,  36,   1, 228, 249,  45,  64, 228, 249,  38,   2, 153, 217,  46,  95,
+      16, 217,  40,  48,  16, 184,  64,  80,  16, 184,  69, 208,  17, 183,  85, 208,
+      85, 183,  94,  80, 174, 181, 102,  35, 252, 181, 119,  32, 253, 181, 143,  93,
+     169, 182, 135,  64, 190, 182, 127,  60, 253, 183, 109, 191, 208, 215, 112,  80,
+     208, 215, 112, 112,  20, 214, 189, 176,  16, 214, 190,  48, 144, 214, 189,  48,
+     144, 214, 188,  32, 148, 214, 192,  10 };
+
+constexpr byte Sound_C2_DIX_HUIT [136] PROGMEM = {
+       0, 136,  47,  47, 132, 216,  16,   0,   0, 180,   6,   7,  25, 213,  15,  32,
+      72, 215,  30,   0, 148, 216,  47,  33, 245, 217,  47,  65, 245, 217,  47,  95,
+     233, 185,  47,  64, 105, 184,  46, 222, 121, 183,  46,  63, 105, 183,  21,  48,
+      21, 183,   4, 176,  21, 184,   4, 208,   5, 185,   5, 176,   2, 217,   6, 176,
+      90, 185,  14, 188, 101, 184,  39,  65, 169, 152,  55,  65, 234, 184,  55,  64,
+     234, 184,  55,  95, 250, 216,  54, 223, 237, 216,  45,  63, 212, 216,  43,  32,
+     212, 216,  58, 191, 192, 215,  66,  80, 128, 215,  72, 112,  20, 176, 212,  16,
+       5, 177, 230, 144,   1, 179,  71,  16,   1, 147, 238, 144,   0, 179, 229, 176,
+       0, 179, 228, 176,  21, 182, 112,  13 };
+
+constexpr byte Sound_C2_DIX_HUI_MILLE_NR [104] PROGMEM = {
+       0, 104,  47,  47, 132, 216,  16,   0,   0, 180,   6,   7,  25, 213,  15,  32,
+      72, 215,  30,   0, 148, 216,  47,  33, 245, 217,  47,  65, 245, 217,  47,  95,
+     233, 185,  47,  64, 105, 184,  46, 222, 121, 183,  46,  63, 105, 183,  21,  48,
+      21, 183,   4, 176,  21, 184,   4, 208,   5, 185,   5, 176,   2, 217,   6, 176,
+      90, 185,  14, 188, 101, 184,  39,  65, 169, 152,  55,  65, 234, 184,  55,  64,
+     234, 184,  55,  95, 250, 216,  54, 223, 237, 216,  45,  63, 212, 216,  43,  32,
+     212, 216,  58, 191, 192, 215,  64,  13 };
+
+constexpr byte Sound_C2_DIX_NEUF_NR [136] PROGMEM = {
+       0, 136,  47,  47,   1, 213,   0,   0,  21, 213, 165,  10,  21, 213, 174,   0,
+      89, 215,  54, 128, 153, 216,  45, 128, 213, 217,  45,  32, 226, 217,  45, 160,
+     226, 217,  46,  64, 229, 217,  46,  64, 160, 185,  69, 189,   0, 188, 172, 176,
+       0, 188, 244, 176,   0, 188, 252, 208,   4, 156, 220, 176,  64, 183,  60, 162,
+     148, 180,  60, 160, 212, 176,  60, 191, 216, 178,  61,  95, 221, 178,  61, 160,
+     234, 181, 102, 160, 237, 181, 135, 223, 186, 180, 143,  95, 185, 180, 143,  95,
+     185, 180, 134,  63, 181, 179, 125,  63, 165, 181, 124,  48, 134, 183, 117,  48,
+       4, 181, 149, 240,   4, 181, 149,  48,   4, 181, 148, 176,   4, 181, 148,  48,
+       4, 181, 147,  16,   4, 181, 144,  14 };
+
+constexpr byte Sound_C2_VINGT_NR [92] PROGMEM = {
+       0,  92,  47,  47, 153, 179,  16,   0, 153, 180,  19,  58, 153, 180,  19, 160,
+       4, 180,   4,  64,   5, 180,   5, 192,  24, 180,  46, 163, 169, 180, 143, 163,
+     185, 180, 167, 192, 100, 180, 175,  64,  96, 180, 167,  63, 100, 180, 142, 192,
+     100, 180, 134, 191, 104, 180, 126, 192, 104, 180, 118,  62,  72, 180,  84, 160,
+     152, 178,  67, 191, 129, 152, 120,  80,   0, 185, 252, 144,  16, 183, 254, 144,
+      16, 183, 231,  16,   0, 179,   6, 144,  21, 179, 152,  10 };
+
+constexpr byte Sound_C2_VIN_MILLE_NR [72] PROGMEM = {
+       0,  72,  47,  47, 153, 179,  16,   0, 153, 180,  19,  58, 153, 180,  19, 160,
+       4, 180,   4,  64,   5, 180,   5, 192,  24, 180,  46, 163, 169, 180, 143, 163,
+     185, 180, 167, 192, 100, 180, 175,  64,  96, 180, 167,  63, 100, 180, 142, 192,
+     100, 180, 134, 191, 104, 180, 126, 192, 104, 180, 118,  62,  72, 180,  84, 160,
+     152, 178,  67, 191, 144, 178,  64,  10 };
+
+constexpr byte Sound_C2_TRENTE_NR [128] PROGMEM = {
+       0, 128,  46,  47,   0, 153, 248,   0,  21, 216, 237, 144,  16, 216, 239,  16,
+      64, 154, 255, 144,  17, 147, 175,  16,  17, 113, 238, 144,  54, 179, 158,  16,
+      17, 177, 206,  48, 193, 180, 253, 176, 129, 177, 253,  48,  33, 173,   4, 143,
+      85, 174, 133,   2, 106, 173, 142, 160, 102, 173, 159,  63,  81, 173, 191,  63,
+      65, 172, 207,  32,  81, 173, 174, 191,  97, 204, 166, 191, 162, 204, 158,  63,
+     166, 172, 149, 190, 167, 171, 149,  63,  20, 169, 140,  60,  89, 171, 123, 189,
+      68, 170,  99,  62, 128, 184, 136,  80, 129, 152, 120,  80,   0, 185, 252,  16,
+      16, 183, 254,  16,  16, 183, 230, 144,   0, 179,   6,  16,  21, 179, 152,  15 };
+
+constexpr byte Sound_C2_QUARANTE_NR [112] PROGMEM = {
+       0, 112,  47,  47, 148, 184, 152,   0, 216, 183, 123,  15, 164, 182, 133,  10,
+     164, 182, 158, 128, 170, 148, 182, 188, 121, 178, 199,  95, 121, 178, 199,   0,
+     109, 178, 190, 191, 104, 147, 190,  63,   5, 174, 216,  48,  41, 174, 156, 176,
+      41, 173,   4, 144, 112, 173, 148, 208, 105, 173, 158,  60, 101, 172, 166, 191,
+     101, 172, 174, 160,  37, 170, 174, 192,  25, 170, 174, 190,  25, 169, 158,  32,
+      20, 168, 101,  63,   4, 148, 208,  80,   4, 148, 208, 112,  20, 181, 180, 144,
+     100, 181, 181, 144, 105, 181, 157,  16, 168, 179, 124,  30,  21, 179, 152,   9 };
+
+constexpr byte Sound_C2_CINQUANTE_NR [132] PROGMEM = {
+       0, 132,  47,  47,   0, 153, 248,   0,  68, 185, 252, 176,  16, 181, 253,  48,
+       0, 215, 253,  48,  64, 182, 253,  48,  16, 216, 253, 176,   0, 182, 253, 176,
+       4, 177,   5, 143,  88, 178, 158, 160,  84, 180, 199,  64,  84, 181, 191,  64,
+     105, 182, 167, 223,  88, 151, 117,  60,  68, 151, 124,  31,   0, 139, 120,  16,
+      96, 179, 144,  80, 148, 147, 132, 135, 173, 144, 158, 189, 186, 175, 158, 191,
+     105, 174, 174, 223,  25, 172, 182, 192,  25, 172, 166,  61, 101, 173, 141,  31,
+     178, 173, 132, 190, 180, 172, 123, 192, 120, 174,  66, 192,   4, 180, 184,  80,
+       4, 180, 184, 112,   4, 180, 165,  16,   4, 182, 197, 144,  69, 181, 133,  16,
+      20, 179,   0,  14 };
+
+constexpr byte Sound_C2_SOIXANTE_NR [164] PROGMEM = {
+       0, 164,  47,  47,   0, 153, 248,   0,   1, 153, 253,  48,   1, 218, 253,  80,
+      66, 152, 253, 176,   2, 181, 253, 208,   3, 185, 254,  48,  16, 146, 254,  80,
+       5, 137,   4, 167,  70, 136, 123,  32,  86, 138, 100,  32, 234, 141, 125, 162,
+     185, 142, 142, 160, 185, 144, 167,  32, 168, 179, 159,  95,  85, 180, 174, 208,
+       0, 185, 222, 176,  84, 215, 174, 208,  20, 183, 174, 176,   1, 182, 198, 176,
+       0, 218, 254, 176,  20, 182, 254, 208,  85, 182, 254, 176,  81, 179, 142, 160,
+     104, 176, 158, 190, 105, 175, 166, 188,  89, 174, 182, 223,  21, 171, 174,  95,
+      22, 171, 157, 190,  38, 171, 133, 192,  21, 171, 149,  62, 100, 171, 132, 160,
+     104, 171, 108,  31, 120, 171,  91, 160,   4, 178,   0,  80,   4, 178,   0, 112,
+       4, 178,   4,  16,  64, 181, 253, 144,  85, 182, 149, 144,  85, 181, 125,  16,
+      21, 179, 152,  15 };
+
+constexpr byte Sound_C2_QUATRE_VINGT_NR [140] PROGMEM = {
+       0, 140,  47,  47,  24, 185, 112,   0, 185, 184, 117, 143, 181, 183, 134, 135,
+     165, 182, 167,  32, 170, 180, 175,  95, 185, 180, 175,  64, 184, 181, 157,  62,
+     184, 181, 147, 159, 145, 182, 152,  48,  17, 181, 173,  16,  37, 180, 255,  48,
+      37, 180, 231,  48,  36, 179, 238, 176,  39, 178, 246,  64, 119, 176,  88,  32,
+     174, 176, 116, 132, 220, 176, 125, 191, 173, 176, 126,  63, 173, 177, 126, 191,
+     173, 177, 118,  62, 174, 177, 117, 222, 105, 178,  93,  61,  24, 178, 109,  62,
+      73, 176, 112, 112, 217, 144, 122, 134, 104, 176, 149, 160, 121, 178, 158, 192,
+     120, 177, 150,  32,  85, 175, 126,  64, 100, 176, 117, 160,  88, 175, 125,  64,
+      68, 177, 156, 159,  84, 177, 116,  32,   4, 175,  32,   6 };
+
+constexpr byte Sound_C2_CENT_NR [76] PROGMEM = {
+       0,  76,  47,  47,   0, 215, 248,   0,  16, 182, 251,  16,   1, 181, 251, 144,
+      69, 182, 253,  80,  64, 185, 253, 176,  64, 184, 254,  48,  17, 181, 255,  48,
+       8, 179, 103,  34,  20, 174, 199,  64,  85, 174, 174, 190, 101, 173, 166,  63,
+      86, 170, 182,  64,  70, 169, 190,  95,  69, 169, 173,  62,  64, 170, 164,  63,
+      64, 139, 147, 159,  80, 167, 130, 128,  84, 166, 112,  13 };
+
+constexpr byte Sound_C2_MILLE_NR [84] PROGMEM = {
+       0,  84,  47,  47,   4, 183, 248,   0,  68, 182,  99,  31,  72, 148,  84, 128,
+     136, 149,  69,  64, 140, 152,  69, 192, 145, 184,  70, 163, 153, 216,  79,  64,
+     212, 217,  79,  64, 213, 216,  79,  95, 245, 217,  78, 223, 178, 215,  62,  64,
+     191, 182,  78,  95, 186, 181,  85, 192, 122, 181,  69,  62, 127, 181,  84, 160,
+     110, 181, 100,  32, 190, 181, 147, 191, 254, 180, 155,  32, 106, 180, 154, 159,
+     174, 180, 152,  14 };
+
+constexpr byte Sound_C2_MILLION_NR [84] PROGMEM = {
+       0,  84,  47,  47, 200, 176,  32,   0, 200, 151,  35,   0, 200, 152,  35,  32,
+     140, 150,  43, 193, 140, 149,  44,  64, 162, 186,  69, 224, 149, 184,  70,  94,
+     165, 185,  62,  32, 182, 185,  53, 224, 166, 185,  86, 162, 172, 150, 134, 192,
+     111, 177, 166, 223,  68, 174, 190,  64, 132, 178, 165, 160, 129, 186, 157, 192,
+     128, 186, 141,  30, 128, 177, 124, 160, 132, 174, 124,   1, 132, 173, 115,   0,
+     128, 168,  96,   5 };
+
+constexpr byte Sound_C2_ET_UN_NR [72] PROGMEM = {
+       0,  72,  47,  47,  21, 179, 152,   0, 181, 185,  92, 165, 181, 185,  85, 192,
+     185, 185,  94, 190, 181, 185, 103,  32, 168, 184, 151,  64, 104, 181, 159,  95,
+     121, 180, 183,  95, 121, 179, 191,  95, 121, 179, 174,  29,  96, 178, 173,  95,
+     164, 177, 156,  63,  84, 177, 131, 191,  88, 176, 123,  32,   8, 173, 122, 160,
+     104, 177,  74,  33,  20, 177,  40,  15 };
+
+constexpr byte Sound_C2_ET_NR [32] PROGMEM = {
+       0,  32,  47,  47,  21, 179, 152,   0, 181, 185,  92, 165, 181, 185,  85, 192,
+     181, 185,  86, 191, 181, 185,  86, 224, 181, 185,  86, 158, 181, 185,  96,  26 };
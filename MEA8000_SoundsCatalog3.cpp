@@ -0,0 +1,2931 @@
+/*
+
+    MEA8000_SoundsCatalog3.cpp
+
+    The words of catalog 3 (Sound_C3_...).
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// From catalog 3
+// Formatted (C-code) from the OCR-ed data files
+// (Here the values are in base-10)
+
+constexpr byte Sound_C3_ADDITIONNE [176] PROGMEM = {
+       0, 176,  47,  47, 193, 118, 248,   0, 233, 180, 182, 171, 230, 180, 183,  32,
+     234, 181, 175,  66, 189, 182, 127,  65, 216, 182,  68,  63, 144, 181,  91,  63,
+     132, 179,  82, 160, 192, 216,  67,  32, 148, 215,  75, 190, 249, 216,  60, 160,
+     250, 217,  61,  33, 250, 216,  61,  64, 233, 217,  52,  32, 153, 217,  43, 144,
+      69, 216,  44, 208,  73, 217, 204, 240,  69, 217, 253,  48,  78, 217, 213, 176,
+      89, 217, 238,  48,  89, 217,   6,  80, 153, 185,  37,  53,  37, 184,   6, 160,
+     105, 181, 135,  94,  45, 178, 158, 223, 109, 177, 158,  63, 173, 176, 149, 160,
+      25, 177, 149, 223, 106, 180, 133, 192,  89, 180, 101,  62, 158, 179,  60,  32,
+     222, 178,  59,  33, 222, 179,  67, 160, 206, 180,  68,  32, 206, 180,  60,  64,
+     222, 180,  59, 160, 206, 179,  59,  64, 154, 180, 116, 161, 170, 180, 140, 160,
+     170, 180, 148, 160, 182, 179, 116, 192, 170, 179,  75, 191,  73, 177,   0,  14 };
+
+constexpr byte Sound_C3_AFFICHE [104] PROGMEM = {
+       0, 104,  47,  47,   0, 153, 248,   0, 169, 179, 182,  43, 186, 180, 183,  64,
+     190, 180, 167, 193, 125, 181, 150, 162, 101, 182,  60, 187,  20, 182,   4, 144,
+      37, 183, 165, 240,  25, 184,   5, 240,  26, 184,   5,  48, 183, 216,  61,  94,
+     182, 216,  53,  93, 102, 216,  45, 223, 118, 184,  45,  30, 102, 184,  36, 191,
+      17, 184,   4, 191,   9, 183, 253, 176,  84, 251, 254, 208,  21, 218, 254, 240,
+      22, 218, 254, 112,   2, 182, 253, 240, 181, 180, 124,  32, 217, 180, 123,  63,
+     152, 180, 130,  32, 152, 180, 128,  12 };
+
+constexpr byte Sound_C3_AJOUTE [128] PROGMEM = {
+       0, 128,  47,  47,  20, 181,  80,   0, 101, 181, 156, 148, 229, 180, 174,  32,
+     134, 179, 158, 160, 230, 181, 167,  32, 185, 181, 143,  64, 104, 181, 119,  64,
+       0, 181,   7,  63,   4, 184,   6, 192,   4, 184,   7,  80,   0, 180, 246,  35,
+      68, 181, 101, 162,  68, 174,  93, 192,  72, 171,  93,  64,  88, 172,  69,  65,
+       8, 173,  37, 162, 140, 178,  76, 190, 136, 179,  66, 161, 192, 214,  80, 112,
+     128, 182,  80, 112,   0, 153, 251, 144,   1, 183, 237, 176,  20, 182, 213,  48,
+       9, 181, 164, 176, 138, 180, 100,   5, 196, 174, 116,  64, 192, 212, 107, 160,
+     212, 179,  91, 192, 134, 177,  83,  64, 216, 179,  75,  63, 197, 177,  80,  27 };
+
+constexpr byte Sound_C3_ALPHABET [128] PROGMEM = {
+       0, 128,  47,  47,   0, 178,   0,   0, 165, 180, 190, 170, 173, 180, 183,  64,
+     189, 181, 175, 164, 104, 181, 151, 162, 104, 181, 126, 162, 104, 181, 118,  32,
+     104, 181, 101, 191, 168, 181,  93,  63,  73, 185,  37,  62,   5, 181, 190, 176,
+      21, 181,   6,  80,   0, 181, 253, 208,   1, 183, 245,  80,  26, 180, 206,  80,
+     173, 179, 150, 163, 191, 180, 167, 221, 111, 180, 159,  95, 111, 179, 133, 184,
+     153, 178,  80,  32, 132, 177,  80, 112,  70, 182,  77,  48, 153, 183,  85,  30,
+     170, 182, 118,  61, 170, 183, 126, 190, 186, 184, 119,  64, 255, 184, 117, 192,
+     250, 184, 109,  62, 229, 184, 100, 160, 246, 184,  92,  32, 246, 184,  88,  14 };
+
+constexpr byte Sound_C3_ANALYSE [148] PROGMEM = {
+       0, 148,  47,  47,   0, 176,   0,   0, 149, 179, 196, 143, 165, 179, 190,  35,
+     166, 180, 190, 160, 118, 181, 183,  66, 121, 181, 159,  36, 100, 182, 142, 160,
+      88, 181,  69, 163,  88, 181,  69, 160,  72, 182,  77, 192, 104, 182, 118, 189,
+     121, 182, 151,  63, 105, 182, 167,  94, 121, 183, 159,  95, 104, 183, 134, 160,
+     106, 183, 110,  63, 118, 183,  70,  62, 114, 215,  37,  61, 102, 216,  60, 189,
+     121, 216,  53,  32, 181, 217,  61,  32, 181, 217,  60, 222, 181, 217,  68, 224,
+     181, 217,  60,  60, 249, 217,  60,  95, 229, 217,  60,  63, 232, 217,  52,  32,
+     214, 185,  60,  32, 170, 184,  61,  64, 170, 184,  68, 192, 170, 184,  68,  64,
+     253, 180, 115,  35, 229, 179, 130,  63, 153, 179,  98,  32, 149, 177,  89, 160,
+     153, 179, 104,  13 };
+
+constexpr byte Sound_C3_ATTENTION [128] PROGMEM = {
+       0, 128,  47,  47,   0, 151, 248,   0, 152, 179, 191,  66, 164, 181, 167, 192,
+     164, 181, 143,  33, 164, 180, 100, 186, 148, 180, 136,  48,  81, 214, 152,  80,
+      64, 251, 237, 176,  70, 181, 156, 176,  86, 175, 142, 163,  22, 172, 143,  32,
+      22, 171, 150, 192,  86, 171, 142,  32, 101, 172, 117,  63,  85, 172,  84, 188,
+       4, 183, 213,  36,   1, 213, 126,  16,   1, 215,   6,  80,  20, 251, 214, 112,
+       5, 185, 254, 208,  36, 219, 230,  48,   9, 181, 253, 176, 149, 183,  93,   1,
+      84, 149, 110, 188,  20, 144, 126,  95,  20, 171, 126,  64,  20, 169, 126,  33,
+      25, 169, 141, 193,  72, 163, 132,  66,  72, 164,  99,  33,  24, 161,   0,  25 };
+
+constexpr byte Sound_C3_BEBE [104] PROGMEM = {
+       0, 104,  47,  47, 217, 145,  24,   0,  17, 181,   4, 135,  81, 182, 102, 128,
+     210, 183, 102,   0, 233, 183, 110, 160, 249, 183, 111,  32, 250, 184, 111, 160,
+     185, 184, 103, 192, 185, 183, 103,  32,  89, 150,  93, 189, 132, 150,  67, 160,
+     144, 185,  48,  48, 150, 149,  48,  80, 154, 151,  85,  32, 234, 183,  93, 160,
+     250, 183, 102, 160, 249, 184, 111,  32, 249, 184, 103,  64, 249, 184,  94, 195,
+     212, 184,  93, 160, 196, 183,  93,  32, 202, 151,  84, 160, 201, 151,  51,  32,
+     200, 149,  58, 160, 137, 143,  56,  19 };
+
+constexpr byte Sound_C3_BONHOMME [96] PROGMEM = {
+       0,  96,  47,  47, 132, 145,  40,   0, 145, 182,  52,  22,  86, 175, 109, 165,
+     170, 177, 118, 193, 171, 180, 102, 192,  89, 180,  78,  61, 137, 179,  61,  64,
+      68, 181,  70,  64, 169, 180, 126, 223, 105, 179, 150, 192, 105, 178, 150, 223,
+     105, 177, 126,  95,  89, 177, 101, 191, 133, 179,  52,  33, 200, 178,  51, 160,
+     196, 181,  51, 192, 200, 181,  44,  32, 132, 182,  44,  64, 132, 182,  44,  64,
+     132, 180,  44,  64,  68, 178,  76, 144,  37, 178,  52, 208,  37, 178,  56,  14 };
+
+constexpr byte Sound_C3_CORRECTION [140] PROGMEM = {
+       0, 140,  47,  47,   0, 153, 248,   0, 134, 178, 252,  16,  33, 178, 132, 176,
+      70, 147, 132, 143,  27, 142, 134,  42,  22, 171, 134, 223,  39, 171, 133,  61,
+      42, 173, 132,  63, 103, 175, 140,  33, 106, 178, 149, 162, 110, 180, 158, 161,
+     110, 181, 143,  63, 106, 183, 135,  63,  41, 183, 103,  16, 106, 152,  77, 176,
+      16, 182, 128, 112,   4, 117, 189,  16,  36, 215,  85,  48,  20, 215, 252, 176,
+      21, 216, 212, 208,  22, 216,   4, 208,  26, 216, 252, 208,  19, 218,   4, 240,
+     101, 186,  44, 146, 106, 184,  52, 186, 101, 151,  69,  63,  17, 151,  37,  63,
+       5, 146, 100, 188,   8, 169, 132, 223,  72, 168, 148,  64,  72, 176, 123, 160,
+      96, 187,  99,  32,  68, 176,  74,  32,  68, 186,  96,  15 };
+
+constexpr byte Sound_C3_COUSIN [100] PROGMEM = {
+       0, 100,  47,  47,   0, 119, 216,   0, 129, 118, 196, 144, 130, 145, 189, 144,
+     128, 216, 220, 144, 192, 181, 221, 176,  16, 139,   4, 163,   5, 139,   4, 163,
+      23, 172,   5, 192,  42, 145,  54,  64,  81, 214,  69, 222,   6, 181,  53,  59,
+      22, 245, 117,  64,  89, 179,  93, 192, 168, 179, 126,  65, 168, 179, 143,  33,
+     165, 179, 151,  63,  86, 179, 167,  64,  86, 146, 167,  95, 166, 146, 158, 192,
+     165, 145, 141, 163, 165, 144, 124, 162, 165, 177, 100,  33, 133, 144,  74, 160,
+      86, 144,  56,  26 };
+
+constexpr byte Sound_C3_DIMINUE [124] PROGMEM = {
+       0, 124,  47,  47, 196, 216,  25,   0, 209, 183,  34, 138, 153, 215,  53, 176,
+     250, 216,  61, 169, 250, 217,  63,  35, 250, 217,  71,  68, 230, 185,  79,  64,
+     200, 183,  78, 160, 201, 183,  70, 255, 209, 186,  79,  60, 202, 217,  71,  62,
+     222, 217,  71,  63, 222, 217,  63,  95, 208, 185,  62,  32, 224, 185,  61, 191,
+     200, 152,  61, 160, 200, 153,  53, 223, 224, 185,  53, 187, 224, 216,  53, 222,
+     224, 216,  53,  61, 212, 184,  53,  64, 164, 217,  62,  63, 176, 184,  54,  63,
+     160, 184,  62,  32, 160, 184,  62,  64, 165, 152,  62,  63, 161, 152,  61, 160,
+     161, 184,  69, 192, 225, 152,  60,  63, 241, 152,  48,  14 };
+
+constexpr byte Sound_C3_ENFANT [96] PROGMEM = {
+       0,  96,  47,  47, 196, 185,  72,   0,  16, 137, 205,  35, 167, 171, 141,  32,
+     166, 171, 149, 161,  68, 173, 166, 192,  89, 171, 150,  33,  73, 170, 141, 160,
+       9, 165, 149,  63,   2, 180,  93,  62,   0, 184, 246, 176,  80, 215, 254, 240,
+       4, 181, 254, 240,   0, 185, 253, 176,  64, 179, 125,   5, 101, 173, 141,  63,
+      17, 141, 182, 189,  22, 173, 190, 223,  89, 171, 174, 224,  85, 171, 149, 164,
+      85, 170, 124,  32,  20, 160, 107, 161,  73, 166,  99,  33,   8, 162,  88,  23 };
+
+constexpr byte Sound_C3_EVITE [124] PROGMEM = {
+       0, 124,  47,  47,   0, 153, 248,   0, 144, 216, 123,  31, 228, 185, 102,  32,
+     244, 217,  93,   0, 244, 217, 101,  32, 228, 185, 102, 161, 249, 185,  95,  32,
+     186, 184,  87, 192, 170, 184,  78,  32, 234, 150,  77,  62, 237, 150,  76,  32,
+     213, 150,  67, 191,  85, 151,  68, 161, 170, 184,  69, 162, 250, 217,  78, 163,
+     245, 217,  70, 193, 244, 217,  70,  34, 228, 217,  61,  34, 244, 217,  60, 162,
+     224, 217,  51,  32, 129, 182,  72, 112,   0, 182, 160, 112,   0, 215, 214,  48,
+      85, 181, 173,  48, 169, 182, 141,  80, 149, 180,  92,  31, 132, 179,  67,  60,
+     148, 179,  50, 160, 136, 176,  34, 160, 137, 178,  24,  18 };
+
+constexpr byte Sound_C3_FAMILLE [124] PROGMEM = {
+       0, 124,  47,  47,  77, 150, 176,   0,  13, 179, 253,  48,  77, 185, 253,  80,
+      13, 181, 229, 112,  29, 181, 213, 176,  86, 180, 156,   6, 230, 147, 125,  35,
+     234, 180, 151,  64, 165, 180, 159,  30, 165, 148, 142, 191, 164, 147, 101,  63,
+     136, 146,  76, 160, 153, 146,  60,  32, 137, 148,  69,  64, 133, 185,  86,  63,
+     133, 215,  86, 190, 134, 215,  86,  63, 130, 216,  78,  64, 146, 216,  78,  64,
+     130, 215,  78,  64, 130, 216,  69, 191, 194, 216,  69, 192, 130, 214,  69,  64,
+     193, 215,  68, 160, 194, 217,  67, 161, 198, 215,  68,  32, 229, 216,  84,  66,
+     229, 184,  75, 161, 168, 183,  43,  33, 213, 183,  56,  22 };
+
+constexpr byte Sound_C3_FREINE [88] PROGMEM = {
+       0,  88,  47,  47,   5, 183, 128,   0,  17, 214, 220, 240,  85, 177, 228, 240,
+     101, 180, 133, 240, 165, 180, 149,  32, 230, 181, 167, 192, 250, 181, 159,  64,
+     233, 183, 143,  64, 233, 183, 142, 191, 164, 183, 134,  63, 168, 183, 126,  32,
+     168, 182, 101,  63, 136, 181,  76, 160, 136, 180,  68,  33, 136, 179,  68,  64,
+     136, 180,  68,  97, 136, 180,  68,  64, 152, 179,  92, 193, 148, 178, 116, 192,
+     148, 179,  92,  33, 148, 180,  72,  22 };
+
+constexpr byte Sound_C3_LENTEMENT [116] PROGMEM = {
+       0, 116,  47,  47, 108, 181,  88,   0,  92, 181,  91,  60, 156, 180,  92, 160,
+     173, 179,  93, 160,  92, 179, 118,  34,  88, 177, 151,  35, 155, 176, 159,  34,
+      91, 173, 158, 161, 107, 173, 134,  33, 165, 172, 125,  33, 170, 172, 100,  32,
+     132, 173, 104, 112, 145, 216, 115, 144,   2, 215, 196, 176,   1, 213,   5,  48,
+       2, 180, 101, 208, 102, 178, 100,  48, 169, 177, 100,  17, 137, 178,  60, 223,
+     138, 177,  68,  95, 201, 173,  59,  61, 197, 183,  59, 160,   5, 173,  84, 160,
+      22, 171, 124, 223,  22, 168,   3, 223,  41, 168,   3, 192,  30, 168,   2, 165,
+      46, 167,   0,  15 };
+
+constexpr byte Sound_C3_LIGNE [136] PROGMEM = {
+       0, 136,  47,  47, 116, 183, 112,   0, 184, 183, 101,  61, 184, 215,  93,  32,
+     248, 215,  84, 161, 232, 215,  76,  33, 168, 216,  77,  33, 188, 215,  78,  32,
+     185, 184,  78,  33, 118, 183,  45, 161, 163, 215,  61,  33, 181, 217,  70,  37,
+     182, 217,  62, 193, 182, 218,  62, 160, 182, 218,  62,  64, 146, 218,  62,  64,
+     145, 218,  62,  94, 145, 186,  54,  62, 136, 183,  45,  94, 137, 152,  45,  95,
+     137, 153,  44, 189, 140, 151,  52,  63, 141, 152,  52, 223, 204, 151,  44, 192,
+     200, 151,  44,  63, 204, 152,  44,  32, 212, 217,  52, 160, 200, 216,  52, 192,
+     196, 216,  61,  32, 132, 216,  69,  32, 149, 184,  92, 192, 169, 184, 108,  33,
+     169, 183, 123, 161, 169, 183, 120,  14 };
+
+constexpr byte Sound_C3_LIT [56] PROGMEM = {
+       0,  56,  47,  47,  84, 182,  96,   0, 226, 182, 107,  58, 233, 183,  92,  33,
+     104, 183,  93,  33, 184, 215,  94,  35, 124, 215,  86, 193, 125, 183,  78, 194,
+     119, 183,  46, 192,  38, 215,   6, 162, 182, 217,  71,  66, 179, 217,  63,  96,
+     183, 217,  54, 187, 183, 217,  48,  20 };
+
+constexpr byte Sound_C3_MAMAN [92] PROGMEM = {
+       0,  92,  47,  47, 136, 184,  40,   0, 200, 182,  42,  30, 201, 180,  42, 160,
+     201, 182,  35,  32, 141, 184,  36, 160, 142, 182,  36, 162, 142, 182,  61,  66,
+     142, 180,  53, 161,  90, 178,  45, 164, 106, 178, 175,  32, 170, 179, 199, 192,
+     106, 178, 191, 192,  26, 177,  94, 190,  74, 181,  54,  32,  10, 177,   6,  95,
+      10, 179,   5, 189,  10, 179,   5, 223,  26, 170, 182,  62,  37, 201, 142, 127,
+      37, 200,  77,  95,  54, 200,   4, 160,  36, 199,   0,  14 };
+
+constexpr byte Sound_C3_MERE [120] PROGMEM = {
+       0, 120,  47,  47, 136, 184,  40,   0, 200, 182,  42,  30, 201, 180,  42, 160,
+     203, 182,  35,  32, 141, 184,  34, 160, 142, 182,  36, 162, 142, 182,  61,  66,
+     142, 180,  53, 161,  90, 178,  45, 164, 110, 180, 134,  34, 190, 180, 151,   1,
+     190, 180, 151,  32, 190, 181, 167,  64, 189, 182, 159,  95, 189, 182, 159,  94,
+     189, 182, 150, 189, 121, 182, 159,  95, 125, 183, 150, 222, 253, 183, 142,  95,
+     185, 183, 142,  64, 185, 183, 134,  64, 170, 183, 133, 192, 169, 182, 125,  64,
+     174, 179, 133,  80,  36, 178,   3, 176,  33, 178, 196, 208,  38, 178, 156,  80,
+      38, 177, 124,  80,  42, 177, 104,   9 };
+
+constexpr byte Sound_C3_MULTIPILIE [176] PROGMEM = {
+       0, 176,  47,  47, 202, 147,  40,   0, 207, 145,  42, 160, 206, 149,  35,  32,
+     206, 151,  36, 161, 202, 152,  45,  67, 202, 151,  61, 195,  81, 151,  71,  40,
+      21, 151,  63, 162, 101, 183,  87, 162,  97, 183,  79,  33,  90, 181,  78, 162,
+     102, 180,  70,  33, 101, 181,  61, 190,  85, 181,  37,  63,  21, 148,   0,  48,
+     129, 180,  64,  80, 133, 180,  88, 112,   4, 180, 252, 144,   9, 215, 156, 176,
+      93, 216,  68,  48, 250, 216,  69, 185, 182, 216,  63,  60, 182, 217,  62, 190,
+     102, 184,  54, 191, 146, 152,  51, 190, 144, 153,  72, 112,   5, 181,   0, 112,
+      80, 183,  85, 176, 165, 150,  76, 155, 105, 182,  86,  61, 106, 182,  86, 190,
+     114, 214,  62,  62, 118, 214,  37,  63, 105, 184,  78,  32, 181, 216,  86,  32,
+     181, 216,  77, 191, 245, 216,  69,  32, 245, 216,  61,  64, 245, 216,  60, 190,
+     229, 217,  43, 223, 213, 216,  43,  63, 193, 216,  50, 160, 133, 213,  49, 141 };
+
+constexpr byte Sound_C3_OBSTACLE [128] PROGMEM = {
+       0, 128,  47,  47, 152, 182,  80,   0, 253, 179, 132, 191, 233, 179, 133, 160,
+     233, 179, 134, 192, 254, 178, 117,  60, 217, 177, 128,  48, 197, 180, 120,  80,
+      81, 185, 125,  16,   4, 217, 126,  48,  69, 216, 149, 176,  17, 216, 141,  48,
+      84, 215, 140, 176,   0, 182, 176, 112,  68, 181, 205,  16, 164, 180, 125,  41,
+     232, 180, 150, 220, 232, 180, 166, 223, 228, 180, 167,  65, 184, 181, 159,  65,
+     184, 149, 142, 163, 233, 149, 125, 161, 144, 214, 128, 112, 144, 183, 112, 112,
+      32, 216, 190, 176,  37, 216,  93, 176,  33, 183,   5,  48, 148, 182,  91, 194,
+     144, 213,  91, 161, 128, 182,  67,  32,  22, 148,   2, 160,  17, 179,   0,  18 };
+
+constexpr byte Sound_C3_ONCLE [104] PROGMEM = {
+       0, 104,  47,  47,  66, 177,  96,   0, 133, 176, 125, 191, 197, 176, 118,  96,
+     137, 176, 110,  64,  73, 176, 110,  65, 141, 176, 101, 160, 140, 177,  84, 160,
+     153, 173,  67,  63, 133, 167,  96,  48, 129, 152, 136,  80,  25, 146,  96, 112,
+      17, 150, 246, 144,  48, 247, 190, 176,  49, 215,  94,  48,   1, 185, 254, 176,
+     213, 182,  92, 166, 217, 180,  92, 191, 216, 179, 100,  63, 212, 146,  99, 160,
+     148, 178,  99, 192, 149, 178, 108,  32, 153, 178,  75, 161,  85, 178,  59, 160,
+      20, 177,  19, 191,  90, 178,   8,  24 };
+
+constexpr byte Sound_C3_ORTHOGRAPHE [204] PROGMEM = {
+       0, 204,  47,  47,   0, 153, 248,   0,  85, 174, 180, 172,  82, 174, 166,  64,
+      21, 174, 174, 162, 123, 205, 142, 161,  21, 172,  36, 191,  69, 173, 156, 144,
+      65, 177, 164, 176,  17, 180, 197,  80,   1, 180,   5,  48,  64, 185, 136,  16,
+     128, 179, 128,  48,  69, 216,  96,  80,   5, 217, 205, 144,  18, 212,   6,  48,
+      22, 180,   5,   7,  23, 177, 111,  64,  27, 175,  86, 190,  43, 174,  70,  60,
+      39, 172,   5,  56, 106, 173,  50, 191, 137, 135,  72,  48, 129,  84, 248,  80,
+      37, 176,   4, 158,  69, 145, 245,  63,   6, 174,   6,  16,  22, 177,  77, 176,
+      86, 177, 124,  31,  38, 175,   5,  63,  22, 174, 165, 191, 106, 175, 182,  32,
+      90, 175, 198, 189, 169, 176, 190,  64, 185, 176, 182,  64, 189, 177, 174,  64,
+     121, 176, 157, 161, 105, 176, 133,  63, 104, 177,  99, 190,  20, 178,  88,  16,
+       0, 183, 253,  16,  21, 213, 157, 208,   4, 182, 253, 240,   5, 180, 253, 112,
+       5, 180, 116, 208,  69, 179, 104,  16, 149, 176, 112,  48,  89, 177, 147,   1,
+      89, 177, 139,  32, 102, 178, 114, 160, 102, 178, 112,  13 };
+
+constexpr byte Sound_C3_PAPA [84] PROGMEM = {
+       0,  84,  47,  47,   0, 153, 248,   0,   8, 180, 173, 176,  25, 179,   5, 143,
+     222, 178, 166, 168, 175, 178, 175, 160, 174, 178, 183, 223, 174, 178, 166,  62,
+     173, 177, 140, 160, 221, 177, 152,  80, 132, 175, 152, 112, 132, 175, 152, 112,
+      21, 183, 204, 144,   0, 180, 133, 176, 174, 177, 174, 220, 186, 177, 190, 222,
+     190, 177, 190, 222, 190, 177, 190,  62, 121, 177, 189, 191, 233, 176, 180,  32,
+     253, 176, 168,  15 };
+
+constexpr byte Sound_C3_PARENT [120] PROGMEM = {
+       0, 120,  47,  47,  16, 212,   0,   0,   0, 180, 253, 144,   0, 182, 199,  16,
+     146, 178, 141, 163, 165, 176, 158,  33, 153, 177, 183,  63, 169, 177, 191,  95,
+     168, 177, 183,  95, 168, 176, 182, 191, 184, 176, 173, 160,  35, 176, 189,  16,
+      35, 176, 189,   4,  19, 208, 141,  16,   2, 178,  93,   0,   6, 177, 125,  16,
+      35, 176, 189,  16,  35, 176, 189,   0,  19, 208, 141,  16,   2, 178,  93,   0,
+       6, 177, 125,  16, 105, 172, 132,  24, 100, 172, 140, 160, 101, 172, 165,  64,
+     101, 172, 173, 161,  37, 171, 165,  64,  38, 170, 124, 193,  26, 167,  84,  33,
+      26, 169,   3, 161,  42, 169,   0,  30 };
+
+constexpr byte Sound_C3_PERE [96] PROGMEM = {
+       0,  96,  47,  47,   0, 153, 248,   0,  20, 180, 140, 144,  25, 181, 173, 176,
+     110, 180, 134,  44, 190, 180, 151,   1, 190, 180, 151,  32, 190, 181, 167,  64,
+     189, 182, 159,  95, 189, 182, 159,  94, 189, 182, 150, 189, 121, 182, 159,  95,
+     125, 183, 150, 222, 253, 183, 142,  95, 185, 183, 142,  64, 185, 183, 134,  64,
+     170, 183, 133, 192, 169, 182, 125,  64, 174, 179, 133,  80,  36, 178,   3, 176,
+      33, 178, 196, 208,  38, 178, 156,  80,  38, 177, 124,  80,  42, 177, 104,   9 };
+
+constexpr byte Sound_C3_PLACE [144] PROGMEM = {
+       0, 144,  47,  47,   0, 153, 248,   0,   0, 148, 253, 144,   1, 181, 253, 144,
+      16, 180, 140, 143,  21, 149,   5, 164,  32, 181,   6, 160,  40, 181,   7,  64,
+      44, 181,  55,  34,  45, 181,  79,  64, 189, 181, 151, 160, 186, 181, 183, 160,
+     170, 180, 183, 192, 174, 180, 191,  62, 169, 180, 182, 222, 104, 180, 182,  61,
+     168, 181, 165,  63,  37, 248,  53,  48,  25, 248,  45, 176,  25, 248,  45, 176,
+       1, 248,  45, 208,   1, 247,  37,  80,   1, 247,  37,  80,  37, 248,  53,  48,
+       1, 248,  45, 208,   1, 247,  37,  80,   1, 247,  36, 208, 186, 179, 115, 152,
+     254, 179, 123, 191, 225, 179, 131, 192, 229, 178, 131,  95, 106, 178,  99,  62,
+      89, 177, 106, 160,  85, 178, 106,  63,  85, 178,  81, 191,  89, 178,  96,  15 };
+
+constexpr byte Sound_C3_RECOMMENCE [172] PROGMEM = {
+       0, 172,  47,  47,  35, 176, 184,   0,  35, 176, 189,  16,  35, 176, 189,   0,
+      19, 208, 141,  16,   2, 178,  93,   0,   6, 177, 125,  16,  22, 171, 148, 131,
+      38, 171,   5,  35,  22, 170,   6,  41,  26, 175, 134, 196,  26, 178, 126, 161,
+     107, 178, 110, 160,  86, 146, 100, 177, 154, 178,  80,  48, 128, 179,  96, 112,
+      33, 144, 132, 144,  17, 176, 198,  48,  33, 144, 181,   9,  86, 143, 109, 170,
+      26, 171, 102, 222,  29, 170,   6,  60, 137, 180,  61, 191, 138, 182,  61, 223,
+     138, 182,  53, 222,   6, 167, 142,  61,  22, 201, 182, 223,  38, 203, 126,  94,
+      22, 201, 165, 223,  38, 170, 149,  64,  43, 169, 140, 223, 106, 172, 116, 223,
+       1, 248,  45, 208,   1, 247,  37,  80,   1, 247,  36, 208,   1, 247,  37, 112,
+       1, 247,  36, 208, 249, 178, 124,   4, 234, 178, 132,  32, 150, 177, 131, 192,
+     166, 177, 107, 191,  89, 175,  91,  32,  89, 176, 104,   0 };
+
+constexpr byte Sound_C3_RECULE [132] PROGMEM = {
+       0, 132,  47,  47,   0, 153, 248,   0, 165, 176, 124,  48, 224, 207, 124, 221,
+     249, 174, 107, 160,  69, 204, 124, 160,  90, 173, 108,  64, 161, 173, 124, 167,
+     165, 174, 126,  34, 106, 177, 127,  65, 169, 178, 118, 161, 166, 178, 101,  32,
+      81, 177, 128,  80,  97, 214, 120, 112,  34, 182, 254,  48,  49, 183, 141,  48,
+      48, 215,   5, 176, 177, 183,  76, 147, 233, 150,  68, 191, 213, 150,  77,  62,
+     165, 151,  77, 223, 213, 151,  77, 223, 229, 150,  85,  64, 160, 184,  86,  65,
+      96, 184,  77, 160,  41, 183,  54,  65, 122, 182,  78, 163, 190, 182,  85, 194,
+     233, 181,  76, 161, 144, 148,  91, 193,  85, 145,  66, 192,  85, 147,  42,  33,
+      85, 147,   8,  17 };
+
+constexpr byte Sound_C3_SOEUR [96] PROGMEM = {
+       0,  96,  47,  47,  14, 218, 248,   0,  78, 218, 253, 112,  14, 214, 237, 112,
+      30, 214, 149, 208, 165, 180, 125,  12, 170, 180, 135,  58, 250, 179, 135,  63,
+     250, 179, 142, 191, 247, 179, 150, 192, 234, 179, 150, 192, 234, 179, 143,  64,
+     250, 180, 134, 193, 249, 180, 134,  34, 252, 180, 141, 192, 232, 179, 141,  32,
+      37, 177, 205, 208,  53, 176, 205,  16,  53, 177, 172, 176,  37, 177, 156,  31,
+      37, 177, 115, 128,  25, 177,  83,   0,  24, 177,  66,   0,  44, 177,  56,  29 };
+
+constexpr byte Sound_C3_SOUSTRAIT [112] PROGMEM = {
+       0, 112,  47,  47,  86, 213, 144,   0,   2, 215, 134, 144,   2, 215, 134, 176,
+       2, 215, 134, 240,  70, 171, 117, 136,  70, 171, 117, 224,   2, 215, 134, 208,
+       2, 215, 134, 240,  81, 180, 248,  48,  81, 180, 248,  80,  80, 179, 136, 112,
+     128, 187, 254,  48, 100, 211, 102,  48,  80, 179, 133, 176,  85, 179, 229, 176,
+     118, 180, 229, 176, 166, 181,  93, 176, 233, 180, 117,  32, 234, 181, 142, 160,
+     190, 181, 143, 191, 170, 182, 143, 223, 106, 183, 119,  64, 250, 183, 118, 190,
+     250, 183, 110,  32, 166, 184, 109,  63, 229, 184,  99, 160, 165, 151,  72,   4 };
+
+constexpr byte Sound_C3_SYNTHESE [156] PROGMEM = {
+       0, 156,  47,  47,  68, 217, 248,   0,  68, 218, 252,  16, 132, 218, 252, 208,
+      68, 216, 252, 176, 132, 218, 253,  48, 168, 178, 141, 175, 168, 179, 167,  38,
+     168, 179, 175,  32, 168, 180, 183,  32, 164, 180, 191,  32, 152, 180, 166, 192,
+     152, 180, 150,  32, 152, 178,  68, 185, 128, 178,  80,  48, 192, 213, 152,  80,
+     192, 213, 152, 112,  65, 148,   3, 144, 153, 214, 180, 176, 212, 182, 115, 159,
+     249, 181, 134,  63, 249, 181, 150, 188, 233, 182, 158, 222, 254, 182, 150, 192,
+     249, 182, 150, 223, 254, 182, 142,  95, 254, 182, 134,  64, 254, 182, 133, 160,
+     191, 182, 109, 192, 170, 184,  61,  93, 170, 184,  68, 192, 170, 184,  68,  64,
+     222, 180,  91,  33, 254, 180,  99,  32, 253, 180, 115,  63, 229, 179, 130,  63,
+     153, 179,  98,  32, 149, 177,  89, 160, 153, 179, 104,  13 };
+
+constexpr byte Sound_C3_TANTE [92] PROGMEM = {
+       0,  92,  47,  47,  35, 208, 168,   0,   4, 177, 212, 144,   0, 216, 238, 176,
+      85, 180, 133, 176, 149, 178,  92,   6,  98, 174, 141,  95, 102, 174, 166,  62,
+      18, 173, 183,  63,  34, 172, 167,  63,  34, 171, 166, 192,  34, 171, 134,  63,
+      18, 170, 134,  65,  22, 173, 150,  65,  22, 172, 133,  34,  70, 174, 100,  32,
+     130, 178,  83,  62,  65, 172, 104,  80,   0, 149, 248, 112,   0, 186, 253,  16,
+       5, 180, 149,  80, 132, 178,  42, 160, 153, 179,   8,   0 };
+
+constexpr byte Sound_C3_AUTO [84] PROGMEM = {
+       0,  84,  47,  47,   0, 142, 216,   0,  90, 170, 125,  36, 170, 171, 109, 160,
+     186, 173, 118,  32, 186, 176, 102,  64, 149, 179,  93, 191, 128, 177,  88, 112,
+     128, 179,  96, 112,  21, 184, 214,  16,  84, 215, 215, 176,   1, 215, 182,   0,
+     153, 177, 110, 191, 154, 176, 110, 190, 171, 173, 110, 192, 102, 172, 110, 190,
+     106, 170, 110,  64, 219, 170, 109,  33, 146, 169,  92,  34, 194, 163,  91, 161,
+      70, 177,  88,  28 };
+
+constexpr byte Sound_C3_AUTOBUS [148] PROGMEM = {
+       0, 148,  47,  47,  69, 168, 192,   0, 134, 170, 125,  27, 145, 172, 117, 160,
+     153, 173, 110,  32,  86, 146, 102, 192, 128, 183,  83, 186, 212, 176,  96,  48,
+     193, 179,  96,  80,   5, 183, 230,  48,  72, 215, 175,  48, 144, 212, 101, 175,
+     165, 143, 101, 187, 233, 142, 101, 222, 160, 141, 100, 190, 144, 172,  51,  60,
+     132, 172,  48,  48,  32, 128,   0,  80, 132, 132,  58,  16,  81, 181,  59, 152,
+      16, 182,  29,  35,  69, 151,  70,  35, 160, 183,  78, 192, 144, 151,  77, 161,
+     218, 150,  69,  32, 160, 151,  70,  65,  96, 183,  63,  66, 100, 151,  71,  34,
+     164, 183,  70, 162, 164, 183,  70,  32,  93, 185,  53, 190,  30, 215,   6, 176,
+      74, 214, 254, 240,  30, 215,   6, 112,  26, 214, 173, 240,  94, 213, 213, 112,
+      94, 213, 208,  27 };
+
+constexpr byte Sound_C3_AVION [96] PROGMEM = {
+       0,  96,  47,  47,   0, 181, 248,   0, 100, 181, 189,  22, 232, 180, 173, 160,
+     132, 181, 157,  32, 184, 181, 142,  32, 164, 181, 126,  64, 153, 148, 109,  62,
+     133, 144,  83,  62, 133, 181,  67,  64, 138, 184,  77,  33, 213, 184,  77,  65,
+     214, 184,  77,  63, 229, 216,  77, 191, 233, 183,  77, 192, 181, 183,  94,  33,
+     101, 150, 118,  33,  85, 148, 126,  33,  24, 168, 141,  64,  24, 163, 141,  64,
+     136, 165, 124,  35,  24, 160,  91,  33,  24, 160,   2, 162,  40, 160,   0,  30 };
+
+constexpr byte Sound_C3_BAS [56] PROGMEM = {
+       0,  56,  47,  47, 213, 176,  16,   0,  84, 179,   4,   1, 100, 179,  21, 155,
+     169, 180, 134,  28, 234, 176, 149, 129, 170, 177, 166, 190, 250, 177, 175,  32,
+     169, 177, 174, 192, 186, 177, 175,  64, 165, 176, 182,  32, 160, 176, 173,  32,
+      88, 174, 148, 161, 101, 174, 112,   9 };
+
+constexpr byte Sound_C3_BATEAU [80] PROGMEM = {
+       0,  80,  47,  47, 213, 176,  16,   0,  84, 179,   4,   1, 100, 179,  21, 155,
+     169, 180, 134,  28, 233, 180, 150, 161, 184, 181, 151,  64, 180, 182, 142, 160,
+     150, 213, 109, 160, 224, 181, 120,  80, 161, 182, 136, 112,  69, 216, 131, 144,
+      86, 182, 214,  48,  81, 213, 101, 187, 154, 175, 101, 194, 169, 173, 101, 160,
+     169, 172, 101,  32, 154, 170,  92, 192, 230, 169,  82, 161, 150, 168,  72,   6 };
+
+constexpr byte Sound_C3_CAMPINGCAR [184] PROGMEM = {
+       0, 184,  47,  47, 144, 182,  88,   0,  32, 183, 215,  48,  16, 214, 213, 144,
+     145, 180, 126,  47, 106, 175, 126,  36,  89, 171, 142,  64,  89, 170, 125, 161,
+      72, 170, 117, 160, 156, 175,  68, 190, 136, 172,  67, 191, 136, 174,  58, 183,
+      68, 160,  56,  16, 192, 149,  96,  80,  21, 182,  94, 176,  37, 183,   5,  17,
+     217, 184,  69, 162, 129, 216,  69, 192, 137, 150,  61, 160, 132, 185,  60, 191,
+     136, 184,  61,  32, 132, 185,  60, 192, 136, 153,  61,  63, 136, 153,  52, 160,
+     136, 149,  59, 191, 144, 185,  56,  48, 128, 181,  64, 112,   1, 184, 252,  16,
+       4, 216, 190, 176, 196, 216,  93,  63, 228, 184, 118,  32, 228, 183, 142, 191,
+     164, 181, 142, 223, 160, 180, 158, 192, 164, 180, 158, 223, 164, 179, 157, 223,
+     184, 178, 157, 192, 232, 178, 157, 190, 164, 177, 165,  32, 144, 210, 164, 191,
+     132, 178, 155, 176, 148, 177, 147, 176,  84, 177, 155, 176,  84, 176, 139, 208,
+     104, 177, 128,  11, 104, 177, 128,  12 };
+
+constexpr byte Sound_C3_CAR [84] PROGMEM = {
+       0,  84,  47,  47, 128, 181,  64,   0,   1, 184, 252,  16,   4, 216, 190, 176,
+     196, 216,  93,  47, 228, 184, 118,  63, 228, 183, 142, 190, 164, 181, 174, 223,
+     160, 180, 190, 221, 164, 180, 190, 222, 164, 179, 189, 222, 184, 178, 189, 220,
+     232, 178, 189, 160, 164, 177, 181,  32, 144, 210, 180, 160, 132, 178, 171, 176,
+     148, 177, 163, 176,  84, 177, 155, 176,  84, 176, 139, 208, 104, 177, 128,  12,
+     104, 177, 128,  12 };
+
+constexpr byte Sound_C3_CARRE [108] PROGMEM = {
+       0, 108,  47,  47,   0, 153, 248,   0,   4, 182,   3,  16,  20, 215, 230,  16,
+      72, 216, 190, 144, 164, 215, 109, 164, 160, 182, 142, 160, 229, 149, 167,  63,
+     165, 180, 183,  64, 165, 148, 183,  64, 164, 147, 174,  32, 168, 147, 165, 191,
+      89, 179, 149,  63,  37, 179, 173, 208,  22, 178, 173,  48,  49, 211, 141,  80,
+     101, 180,  92,  48, 165, 181, 108,  31, 212, 182, 116, 191, 228, 183, 117, 192,
+     249, 183, 118,  63, 185, 184, 110,  32, 249, 184, 101, 160, 228, 152, 100, 161,
+     225, 152,  75, 193, 213, 152,  51,  65, 197, 152,  72,  25 };
+
+constexpr byte Sound_C3_CENTIME [136] PROGMEM = {
+       0, 136,  47,  47, 130, 216, 136,   0,   6, 214, 197,  16,   6, 216, 253,  80,
+      22, 213, 197,  80,  70, 218, 252, 176, 144, 176, 117, 175, 161, 173, 134,  64,
+     145, 172, 126,  95, 161, 173, 117, 190, 145, 171,  83, 186, 145, 171, 112,  48,
+     128, 178, 112, 112,  73, 218, 120, 112,  30, 218, 125, 176,   8, 218,  37, 176,
+     200, 217,  52, 182, 208, 249,  52, 164, 224, 249,  44, 191, 248, 249,  36, 189,
+     240, 152,  51, 191, 200, 144,  51, 192, 204, 145,  51,  95, 140, 149,  60, 192,
+     140, 180,  60, 190, 140, 147,  59, 191, 220, 177,  51, 192, 249, 178,  67, 160,
+     168, 179,  91, 192, 164, 179,  91, 191,  96, 210,  90, 192,  80, 178,  90,  63,
+       0, 175, 104,  12,   0, 175, 104,  14 };
+
+constexpr byte Sound_C3_CERCLE [96] PROGMEM = {
+       0,  96,  47,  47, 161, 216,  64,   0,  14, 220, 252,  80,  30, 214,   4, 208,
+     168, 182, 125, 165, 248, 182, 134, 189, 213, 183, 142, 192, 229, 183, 143,  64,
+     228, 183, 142,  32, 209, 151, 133, 161, 228, 183, 116, 160, 166, 182,  92, 144,
+      33, 181, 133,  80,  17, 148,   5,  80, 177, 182, 128, 112, 177, 182, 128, 112,
+      16, 214, 252,  16,  48, 214, 189, 176,  98, 215,  45,  80, 196, 182,  85,  65,
+     208, 180,  92, 161,  69, 182,  76, 193,  87, 148,  27, 192,  86, 179,   0,  17 };
+
+constexpr byte Sound_C3_ELECTRICITE [168] PROGMEM = {
+       0, 168,  47,  47,  32, 184,  80,   0, 164, 184, 110, 156, 245, 184, 110, 161,
+     245, 184, 111,  32, 245, 183, 111,  32, 234, 183, 103,  64, 250, 183, 111, 161,
+     230, 184, 103,  64, 231, 185,  94,  62, 206, 153,  91, 160, 209, 216,  99, 161,
+     224, 184,  82, 160, 180, 183,  99,  32, 240, 183, 101,  16,  16, 215,  47,  48,
+      21, 215, 117, 176,  16, 184, 101,  48,  17, 184,   5, 176,  16, 217,   5, 208,
+     230, 185,  77,  34, 234, 184,  76, 220, 102, 184,  69, 144,  26, 185,  69,  80,
+      22, 216, 125,  80,  30, 217, 205, 176,  74, 217,  78,  48, 253, 217,  69,  38,
+     226, 217,  60, 223, 144, 216,  51, 188, 128, 183,  64,  48,   0, 184, 248, 112,
+      85, 215, 181, 176,   5, 216, 189,  48, 234, 184,  93, 169, 250, 183, 102, 189,
+     249, 184, 103,  95, 250, 184, 103,  64, 249, 184,  94, 161, 213, 152,  93,  34,
+     202, 184,  84, 160, 202, 183,  72,   0 };
+
+constexpr byte Sound_C3_FENETRE [112] PROGMEM = {
+       0, 112,  47,  47,  35, 180,   0,   0,  37, 180, 253, 208,  42, 181, 254,  80,
+      41, 181, 182,  80,  86, 180, 125, 208, 214, 179, 109,  10, 234, 179, 118,  61,
+     153, 181, 127,  95,  89, 181,  94,  60, 140, 177,  68, 161, 137, 176,  69,  32,
+     132, 183,  69,  64, 169, 182, 135,  64, 165, 182, 143, 223, 186, 182, 143, 192,
+     170, 182, 135, 162, 245, 183, 127,  34, 213, 182, 101, 162, 181, 183, 100, 191,
+     208, 183, 112,  80,  80, 215, 112, 112,  16, 216, 158,  48,   2, 182, 205, 208,
+      33, 179, 221, 176,  17, 178, 205,  80, 128, 211, 251, 160,  17, 211, 208,   0 };
+
+constexpr byte Sound_C3_FRANC [84] PROGMEM = {
+       0,  84,  47,  47,  64, 215, 112,   0,  21, 181,   5,  48,  21, 182,  77, 112,
+      21, 182, 181, 176,  69, 180, 237, 208,  85, 179, 221, 176,   5, 176, 173,  48,
+      69, 174, 205,  48, 197, 177, 237,  80, 133, 182, 229,  48,   6, 169, 147, 170,
+      86, 173, 140, 160,  86, 172, 149, 160, 147, 171, 157, 192,  83, 170, 165, 222,
+      82, 170, 165, 221,  22, 167, 140, 189,  85, 168, 131, 188, 162, 169, 114,  32,
+      16, 165, 128,  14 };
+
+constexpr byte Sound_C3_GARE [112] PROGMEM = {
+       0, 112,  47,  47, 132, 182,  56,   0,  36, 183,   5,  16, 229, 185,  85,  37,
+     229, 184, 118, 160, 229, 183, 143, 160, 244, 182, 159, 161, 184, 181, 167, 161,
+     164, 180, 175,  32, 165, 180, 183, 191, 165, 180, 175,  32, 180, 179, 174, 222,
+     169, 179, 174, 221, 164, 178, 174,  95, 168, 178, 174,  95, 169, 178, 174,  95,
+     169, 177, 157, 192, 169, 177, 149,  32, 168, 177, 124, 160, 168, 176,  83,  32,
+     104, 209,  83,  32, 121, 177,  91,  32,  49, 177,   4,  16,  36, 209, 212,  80,
+     121, 177,  76,  80, 169, 176,  99, 176,  96, 175,  58, 176,  36, 176,   0,  42 };
+
+constexpr byte Sound_C3_HAUT [44] PROGMEM = {
+       0,  44,  47,  47, 106, 169, 120,   0, 106, 169, 125,  27, 170, 169, 125,  63,
+     235, 169, 116, 160, 175, 168, 108, 192, 175, 168, 116, 192, 239, 168, 108, 193,
+     187, 167,  83, 163, 239, 166,  90, 164, 134, 164,  96,  21 };
+
+constexpr byte Sound_C3_HELICOPTERE [180] PROGMEM = {
+       0, 180,  47,  47, 229, 215,  56,   0, 228, 216,  92, 137, 228, 216, 109, 162,
+     228, 217, 102, 162, 228, 217, 103,  34, 248, 217,  95,  32, 225, 216,  53, 191,
+     212, 216,  45,  32, 209, 216,  68,  33, 192, 249,  76, 160, 232, 217,  77, 163,
+     241, 217,  61, 161, 241, 217,  60,  32, 145, 217,  80, 112,  48, 181, 230, 176,
+      48, 213, 173, 159, 225, 180, 101, 160, 213, 179, 118, 187, 234, 176, 118,  59,
+     145, 144,  67, 181, 196, 178,  96, 112,  85, 182, 116, 144,  17, 186,  45, 176,
+     145, 217,  99, 144, 192, 182, 112,  16,  81, 185, 248, 112,  16, 183, 254,  16,
+      84, 214, 117, 176, 252, 182, 118, 165, 253, 182, 134, 187, 244, 182, 134,  63,
+     185, 182, 134, 192, 249, 182, 142,  95, 212, 182, 125,  62, 212, 182, 133,  63,
+     228, 183, 132, 192, 212, 183, 132, 192, 229, 183, 124, 192, 229, 183, 116, 192,
+     229, 182, 100,  63, 165, 181, 108,  32, 169, 180, 115, 160,  82, 179, 115, 160,
+      18, 179,  40,  46 };
+
+constexpr byte Sound_C3_HEURE [100] PROGMEM = {
+       0, 100,  47,  47,  64, 132, 152,   0, 149, 179, 139,   4, 233, 179, 149, 160,
+     234, 179, 150,  34, 230, 179, 150, 160, 250, 179, 150, 224, 233, 179, 142, 192,
+     233, 179, 142,  61, 229, 180, 134,  64, 169, 180, 134,  93, 229, 180, 133,  62,
+     149, 180, 117,  64, 217, 147, 116,  64, 214, 147, 115, 191, 154, 179, 116,  32,
+      49, 176, 180, 144,  48, 177, 171, 157,  53, 177, 180, 144,  33, 177, 171, 128,
+      49, 177, 172, 144,  85, 177,  91,  32, 149, 175, 114, 160, 144, 175, 114,  34,
+     101, 177,  64,  15 };
+
+constexpr byte Sound_C3_KILO [88] PROGMEM = {
+       0,  88,  47,  47, 128, 181,  64,   0,   1, 184, 252,   0,   4, 216, 189,   0,
+       4, 216, 189,  16, 137, 217,  44, 143, 193, 217,  61,  70, 208, 216,  61,  94,
+     209, 215,  60, 188, 166, 214,  45,  62, 101, 184,  54,  60, 166, 183,  54,  62,
+     166, 182,  54,  62, 149, 182,  86,  63, 145, 179, 101, 223, 149, 176, 109,  62,
+      65, 174, 108, 191, 128, 170, 108,  62, 213, 170,  91, 160, 213, 170,  83, 160,
+     149, 168,  74,  32, 214, 168,  80,  13 };
+
+constexpr byte Sound_C3_L_ [36] PROGMEM = {
+       0,  36,  47,  47, 208, 151,  64,   0, 208, 151,  66,   1, 200, 115,  58, 160,
+     241, 150,  60,  32, 245, 150,  60, 161, 162, 149,  61,  32,  98, 181,  61,  36,
+      86, 179,  88,  21 };
+
+constexpr byte Sound_C3_LA [44] PROGMEM = {
+       0,  44,  47,  47, 216, 215,  88,   0, 236, 214,  91,  92, 236, 214,  83, 161,
+     236, 182,  68, 161, 252, 182,  76,  33, 164, 182, 109, 160, 184, 181, 166,  64,
+     249, 180, 150,  64, 168, 179, 100, 161,  76, 178,  64,   8 };
+
+constexpr byte Sound_C3_LE [48] PROGMEM = {
+       0,  48,  47,  47, 160, 182,  80,   0, 244, 181,  83,  59, 224, 182,  67, 160,
+     164, 182,  60, 191, 180, 182,  60, 160, 164, 182,  85, 163, 168, 181, 102,  32,
+     234, 181, 102,  32, 165, 181,  93, 191, 232, 180,  52,  63, 200, 180,  40,  10 };
+
+constexpr byte Sound_C3_LES [64] PROGMEM = {
+       0,  64,  47,  47,   0, 153, 248,   0, 248, 215,  99, 160, 228, 215,  91, 160,
+     226, 183,  75, 160, 225, 183,  76, 160, 241, 183,  69,  32, 241, 183,  69,  64,
+     249, 183,  94,  34, 229, 184, 110, 160, 246, 184, 102, 192, 245, 184,  94, 160,
+     248, 184,  86,  95, 232, 184,  69,  60, 233, 184,  76, 191, 230, 184,  64,  10 };
+
+constexpr byte Sound_C3_LUMIERE [120] PROGMEM = {
+       0, 120,  47,  47,  84, 150,  56,   0, 169, 150,  76, 183, 233, 150,  67, 160,
+     253, 150,  68,  32, 185, 150,  60, 162, 170, 150,  44, 193, 100, 151,  53, 161,
+      97, 184,  54,  34, 165, 184,  70,  65, 149, 151,  70,  32, 136, 148,  61,  96,
+     136, 148,  61,  63, 148, 248,  70,  95, 212, 216,  86, 192, 169, 183, 127,  96,
+     166, 182, 135,  96, 154, 182, 135,  96, 170, 183, 127,  64, 165, 151, 118,  65,
+     151, 151, 109, 161, 232, 151, 100, 162, 169, 150,  76,  35, 138, 150,  83, 162,
+     150, 149,  76, 144,  18, 180,   4, 208,  34, 179,   4, 208,  17, 179, 244, 176,
+      49, 178,   3, 208,  49, 178,   0,  18 };
+
+constexpr byte Sound_C3_METRE [116] PROGMEM = {
+       0, 116,  47,  47, 233, 180,  56,   0, 236, 180,  34, 146, 216, 180,  42, 162,
+     221, 180,  43, 162, 140, 181,  60, 162, 140, 181,  60, 163, 169, 180,  61,  34,
+     229, 181, 151,  39, 244, 182, 151, 163, 180, 182, 151, 161, 160, 183, 143,  63,
+     224, 183, 134, 189, 164, 183, 133, 188, 168, 184, 109,  60, 212, 184, 107, 191,
+     145, 183, 120,  80,  16, 215, 168, 112,  33, 180, 168, 112,  96, 244, 204, 208,
+      36, 179, 180,  48, 145, 177, 116,  80,  68, 177, 131, 185, 144, 207, 131, 222,
+      89, 175, 115, 189,  64, 170, 123,  32,  85, 174,  82, 191,  81, 176,  90,  32,
+      17, 177,   0,  45 };
+
+constexpr byte Sound_C3_METRO [96] PROGMEM = {
+       0,  96,  47,  47, 170, 180,  80,   0, 232, 180,  52,  21, 136, 183,  44,  66,
+     136, 150,  52, 194, 234, 183, 110, 167, 229, 184, 118, 161, 228, 184, 102, 161,
+     248, 184,  85, 160, 128, 184,  83, 160, 208, 153, 104, 112,  81, 216, 125, 144,
+      65, 180, 254,  48,  17, 146, 245,  48,  33, 208, 132,  48,  18, 170,  96,  80,
+      22, 170,  75, 177,  18, 169,   4, 160, 214, 169, 108,  33, 213, 168,  92,  64,
+     213, 168,  99, 190, 213, 167,  91,  62, 149, 167,  66,  32, 145, 199,  64,  13 };
+
+constexpr byte Sound_C3_MINUTE [132] PROGMEM = {
+       0, 132,  47,  47, 132, 145,  16,   0, 132, 113,  18,  22, 136, 112,  34, 161,
+     192, 143,  11,  35, 200, 146,  20,  32, 204, 146,  20, 194, 205, 146,  29,  35,
+     200, 148,  29, 163, 208, 218,  45, 162, 129, 218,  45, 193, 129, 186,  45,  32,
+     201, 144,  36, 161, 200, 145,  28, 223, 201, 146,  29,  92, 132, 215,  29, 189,
+     244, 217,  46,  94, 224, 217,  45, 189, 225, 184,  37,  63, 208, 184,  36,  62,
+     192, 216,  48, 112,  64, 180,  24, 112,  20, 183, 120, 112,   0, 215, 117, 176,
+       6, 182,   6,  48, 154, 181,  92, 136, 233, 180, 108, 190, 228, 179, 116,  63,
+     212, 179, 123,  95,  84, 180,  91,  62, 148, 179,  66, 191,  81, 179,  56,  13,
+      81, 179,  56,  13 };
+
+constexpr byte Sound_C3_MUR [104] PROGMEM = {
+       0, 104,  49,  47,  68, 181,  48,   0, 132, 181,  58, 148, 132, 154,  43,  32,
+     144, 185,  52, 160, 144, 217,  52, 193,  80, 217,  53,  64,  80, 217,  61, 161,
+      84, 183,  78,  32, 100, 183,  86, 224, 144, 184,  86, 224, 149, 183,  86,  64,
+     213, 182,  85, 192, 212, 183,  84, 193, 197, 183,  84,  33, 229, 182,  75, 161,
+     233, 181,  66, 160, 228, 181,  82, 169, 161, 181,  60,  16,  32, 180,   4,  48,
+     192, 148, 252,  48,  18, 179, 252, 208,  66, 183, 252, 208,  50, 209, 252, 208,
+     128, 186, 252,  80, 128, 183, 248,  17 };
+
+constexpr byte Sound_C3_PIECE [96] PROGMEM = {
+       0,  96,  47,  47,   0, 153, 248,   0,  68, 186, 255,  48,   8, 184,   6, 176,
+       5, 217,   6,  16, 154, 216,  77,  31, 229, 216,  69,  64, 228, 184,  93, 160,
+     228, 183, 102, 160, 228, 183, 119,  62, 249, 182, 135,  64, 250, 182, 135,  64,
+     249, 182, 127,  34, 229, 182, 126, 161, 229, 182, 118,  32, 229, 182, 100, 161,
+     218, 214, 116,  16,  22, 215,  93, 112,  26, 215,  84, 176,  26, 215,  60, 112,
+      27, 215,  36, 112,  22, 213,  28,  48,  14, 214,   4, 112,  10, 213,   0,  29 };
+
+constexpr byte Sound_C3_PLANCHER [104] PROGMEM = {
+       0, 104,  47,  47,  37, 178, 136,   0,  81, 184, 254,  48,   5, 115, 212, 143,
+     148, 117, 100, 186,  84, 148, 101, 191,  88, 148, 109, 190,  84, 178, 125, 161,
+      22, 174, 158, 192,  21, 170, 134,  95,  36, 170, 125, 160,  36, 171,  92, 160,
+       4, 171, 131, 160,   4, 182, 254,  48,   1, 188, 254,  48,   5, 219, 254, 112,
+      24, 219, 254,  80, 135, 186, 253, 176, 181, 182, 109,  38, 233, 183, 109, 221,
+     233, 184, 101, 223, 229, 184, 101,  32, 233, 184,  84, 160, 201, 153,  75,  33,
+     213, 184,  66, 160, 213, 184,   0,   7 };
+
+constexpr byte Sound_C3_PORTE [100] PROGMEM = {
+       0, 100,  47,  47,   0, 153, 248,   0,  82, 182, 166, 176, 107, 173, 124, 190,
+     169, 173, 133, 160, 186, 174, 141, 191, 174, 174, 150,  63, 105, 174, 150,  64,
+     185, 174, 141,  33, 189, 174, 123, 160, 186, 174, 100,  16,  86, 206, 132,  48,
+      21, 206, 165,  48,  86, 207, 157,  48,  66, 207, 172, 176,   2, 209, 196, 208,
+       5, 179, 189,  48,  16, 213, 156, 176,  16, 214,  80, 112,  16, 214,  80, 112,
+      65, 216, 205,  48,  66, 216, 165,  48,  18, 181, 180, 176,  19, 180, 132,  48,
+      35, 180,   0,   6 };
+
+constexpr byte Sound_C3_RECTANGLE [156] PROGMEM = {
+       0, 156,  47,  47,  68, 214,  56,   0, 105, 179, 100, 208, 169, 179, 116,  80,
+     165, 179, 116, 129, 148, 180, 124, 165, 164, 180, 141, 162, 180, 149, 150, 161,
+     164, 149, 142,  32, 228, 151, 117, 160, 164, 183, 108, 185, 213, 183, 120, 112,
+       4, 151, 158,  48,  33, 215, 116, 176,  33, 215, 112, 112,   1, 183, 156, 144,
+       5, 182, 197,  48, 133, 180, 140, 129, 165, 178, 142,  33,  89, 177, 166, 189,
+      22, 175, 174, 190,  33, 172, 174, 192,  37, 171, 158, 192,  25, 171, 142,  64,
+       4, 170, 149, 161,  73, 178, 101,  33, 137, 180,  84, 160, 136, 146,  75, 192,
+     132, 147,  75, 159, 132, 147,  72,  32, 129, 150,  76,  16, 162, 181,  84,  35,
+     165, 150,  84,  32, 165, 180,  92,  64, 225, 180,  91, 161, 212, 180,  91,  32,
+     168, 180,  99,  64,  85, 180,  50,  64,  85, 180,  32,  25 };
+
+constexpr byte Sound_C3_TABLE [92] PROGMEM = {
+       0,  92,  47,  47,   4, 170,  48,   0,  16, 184, 246, 176,  64, 217, 221, 151,
+     212, 181, 134,  34, 244, 180, 159,  35, 245, 180, 175,  64, 165, 180, 183,  63,
+     160, 179, 182, 192, 165, 179, 191,  64, 170, 179, 175,  95, 171, 178, 158, 191,
+     170, 177, 124, 189, 149, 176,  82, 160,  64, 116, 160, 112,  21, 147, 245,  48,
+     164, 149,  91, 162, 168, 181, 100,  65, 168, 180, 115, 192, 168, 180, 131, 161,
+      84, 179, 123,  32,  84, 178,  98, 160, 165, 179,  64,   3 };
+
+constexpr byte Sound_C3_TAXI [104] PROGMEM = {
+       0, 104,  47,  47,   0, 179, 208,   0,  16, 215, 206,  48, 224, 182, 117, 161,
+     228, 182, 150, 160, 229, 150, 151,  62, 185, 150, 135,  63, 229, 150, 133,  61,
+      96, 182, 148, 176, 164, 182, 136,  16, 208, 213, 128,  80,  80, 148, 156,  16,
+      33, 182, 149,  48,  37, 183, 117,  80,  36, 215, 148, 208,  37, 184, 156, 208,
+      26, 184, 205,  80,  25, 184,   5, 208, 233, 185,  69,  38, 249, 217,  62,  64,
+     234, 217,  62,  64, 228, 217,  69,  33, 212, 250,  60,  32,  65, 181,  35, 160,
+     132, 182,  43,  32, 201, 209,  32,  28 };
+
+constexpr byte Sound_C3_TELEPHONE [140] PROGMEM = {
+       0, 140,  47,  47,   0, 148, 248,   0,  16, 215, 238,  16,  16, 215, 158, 176,
+     229, 183, 101, 193, 245, 183, 110, 160, 229, 183, 111,  63, 250, 183, 103,  62,
+     187, 183, 102, 190, 155, 183,  94,  63, 234, 184, 102, 161, 249, 183, 103,  64,
+     249, 183, 102, 160, 234, 150,  93,  63, 105, 182,  85,  16,  21, 182,   6, 176,
+      21, 183,  55,  80,  32, 182,   6,  80,  21, 180, 254,  80,  33, 147, 229, 208,
+     217, 177, 125,  37, 250, 177, 134,  61, 234, 177, 134, 190, 174, 177, 134, 191,
+     170, 177, 142, 192, 171, 179, 143,  64, 106, 179, 126, 161,  73, 180,  77, 160,
+     156, 179,  69,  34, 136, 179,  77,  65, 136, 179,  68, 161, 136, 178,  60,  65,
+     200, 186,  59, 161, 132, 181,  34, 162, 132, 183,  48,  20 };
+
+constexpr byte Sound_C3_TELEVISION [136] PROGMEM = {
+       0, 136,  47,  47,  64, 153, 248,   0,  81, 184, 205,  16, 144, 183, 205, 176,
+     249, 183, 101, 175, 250, 183, 119,  39, 170, 184, 119, 192, 186, 215, 103,  62,
+     166, 215,  53,  32, 182, 215,  60, 162, 165, 215,  53,  32, 186, 184,  94, 223,
+     186, 216,  78, 223, 167, 184,  61, 188, 215, 151,  60,  32, 155, 151,  27, 188,
+     102, 184,   4, 160, 247, 216,  53, 160, 251, 216,  53, 192, 251, 216,  45, 192,
+     251, 216,  53,  95, 186, 216,  52, 222, 191, 183,  44, 159,  94, 184,  20, 160,
+      22, 245, 116,  56,  22, 245, 116, 193,  21, 183,   5,  32, 109, 214,  85, 160,
+      21, 183,   5,  64,  97, 150,  85, 192,  41, 168,   4, 224,  41, 162,   3,  64,
+     136, 179,  82, 224,  69, 174,  72,   5 };
+
+constexpr byte Sound_C3_TONNE [112] PROGMEM = {
+       0, 112,  47,  47,   2, 185, 240,   0,  85, 215, 165, 176, 228, 179, 117,  47,
+     229, 177, 134,  63, 234, 177, 142, 191, 170, 176, 151,  62, 170, 176, 159,  95,
+     186, 177, 159,  95, 166, 177, 158, 188, 166, 179, 142,  61, 166, 179, 117, 189,
+     234, 179, 100, 187, 140, 178,  68,  32, 140, 178,  60,  64, 204, 177,  59, 190,
+     140, 179,  59, 192, 140, 183,  67, 192, 204, 179,  60,  64, 204, 179,  59, 160,
+     204, 181,  59, 192, 216, 180,  83, 161, 213, 180, 123, 160, 233, 179, 123, 191,
+     165, 179, 131,  95, 164, 178, 115,  63, 144, 178, 123,  32, 144, 179, 120,  45 };
+
+constexpr byte Sound_C3_TRAIN [68] PROGMEM = {
+       0,  68,  47,  47,   0, 153, 248,   0,   0, 216, 221,  16,   0, 217, 254, 176,
+      37, 181, 206,  80,  22, 178,   5,  48,  26, 180, 102,  48,  84, 177, 133,  61,
+      85, 178, 158,  32, 102, 178, 182,  64, 145, 178, 182,  95,  85, 178, 173, 161,
+      64, 145, 165, 162,  80, 145, 124, 161,  84, 178,  75, 164,  21, 177,   3,  32,
+      21, 177,   0,  26 };
+
+constexpr byte Sound_C3_TRIANGLE [140] PROGMEM = {
+       0, 140,  47,  47,  85, 183,  56,   0,  17, 118, 253,  48,  98, 213, 214,  48,
+      34, 183,  21, 208, 209, 184,  77,  40, 224, 217,  77, 192, 212, 217,  69, 191,
+     164, 217,  69,  62, 132, 217,  77,  95, 196, 216,  85,  33, 233, 184, 102, 160,
+     165, 183, 127,  63, 101, 181, 151,  63,  85, 178, 158, 191,  22, 173, 182, 223,
+      86, 173, 190, 192,  42, 172, 174,  64, 106, 172, 157, 160,  41, 172, 133, 161,
+       8, 171, 125, 160, 136, 179,  92, 160, 136, 179,  84,  64, 136, 148,  75, 191,
+     200, 146,  66,  32,  73, 145,  64,  48, 129, 150,  76,  16, 162, 181,  84,  35,
+     165, 150,  84, 160, 165, 180,  92,  65, 225, 180,  91, 160, 212, 180,  91,  32,
+     168, 180,  99,  64,  85, 180,  50,  64,  85, 180,  32,  24 };
+
+constexpr byte Sound_C3_UN [56] PROGMEM = {
+       0,  56,  47,  47,   0, 116, 248,   0,  80, 146, 172, 153, 161, 178, 157, 160,
+     160, 178, 157, 162,  64, 146, 125,  32,  97, 179, 150, 160, 113, 179, 158, 191,
+      97, 179, 142, 192, 117, 180, 126,  61, 169, 180,  76, 191, 204, 178,  51,  33,
+     196, 177,  50, 161, 132, 177,  40,   9 };
+
+constexpr byte Sound_C3_UNE [56] PROGMEM = {
+       0,  56,  47,  48, 148, 183,  64,  16, 229, 183,  76,   0, 229, 183,  77,  32,
+     229, 183,  77, 160, 228, 183,  86,  64, 229, 184,  78,  64, 228, 184,  77, 191,
+     140, 182,  52, 223, 204, 184,  52,  64, 153, 180,  60,  95, 204, 178,  51,  63,
+     136, 175,  34,  32, 213, 175,  24,  10 };
+
+constexpr byte Sound_C3_UNE_ [48] PROGMEM = {
+       0,  48,  47,  47,   0, 153, 248,   0, 245, 151,  60, 191, 229, 151,  60, 160,
+     225, 153,  69,  64, 225, 184,  69, 160, 196, 217,  44, 191, 145, 152,  35,  32,
+     161, 183,  43, 192, 168, 215,  44,  33, 216, 182,  53,  36, 164, 182,  72,  26 };
+
+constexpr byte Sound_C3_VETEMENT [124] PROGMEM = {
+       0, 124,  47,  47,  85, 178,  56,   0, 233, 178,  59,  32, 173, 178,  59,  32,
+     168, 178,  74, 160, 168, 178,  58, 160, 105, 179,  51, 192,  85, 181, 117,  36,
+     249, 180, 126,  37, 233, 181, 134, 161, 232, 182, 134, 192, 168, 182, 134, 160,
+     180, 215, 116, 160, 224, 214, 112,  80, 144, 215, 120, 112,   0, 216, 245, 176,
+      21, 215, 190, 176,   6, 181, 190,  48,   5, 178,   5, 144, 133, 177,  59, 191,
+     212, 174,  59,  95, 196, 178,  59, 223, 196, 178,  59, 160,  70, 176, 101, 160,
+     169, 173, 124, 189,  74, 172, 149,  32,  25, 170, 117, 192,  41, 170, 125,  64,
+      41, 169,  92,  32,  90, 170,  58, 161,  26, 169,  32,  26 };
+
+constexpr byte Sound_C3_VOITURE [144] PROGMEM = {
+       0, 144,  47,  47,  64, 180, 120,   0,  68, 213,  75,  17, 128, 213,  83,  32,
+     128, 180,  67,  33,  80, 185, 107, 164, 128, 173, 108,  38, 149, 173, 109,  36,
+     233, 178, 134, 193, 229, 181, 127,  33, 240, 182, 109, 160, 224, 246, 115, 190,
+     224, 150, 106,  33, 208, 149, 104,  16,  70, 215, 136, 112, 164, 251, 141,  48,
+      32, 186,   5, 208, 164, 184,  60, 184, 161, 184,  61, 223, 176, 184,  61,  32,
+     176, 184,  69,  64, 176, 184,  61,  95, 161, 152,  69,  64, 161, 184,  69, 223,
+     241, 184,  77,  95, 225, 183,  77,  64, 241, 183,  84,  32, 225, 151,  84, 190,
+     209, 150,  91, 190, 148, 148,  67, 163,  85, 146,  91, 160, 165, 177,  91,  32,
+     102, 176,  91,  64, 102, 176,  75,  32, 102, 176,  75,   0,  18, 176,   0,  15 };
+
+constexpr byte Sound_C3_ANE [100] PROGMEM = {
+       0, 100,  40,  47, 160, 181, 176,   0, 160, 180, 188,  41, 164, 180, 189, 160,
+     164, 180, 190, 160, 164, 180, 191,  32, 164, 180, 191,  64, 100, 212, 183,  93,
+      96, 180, 174, 221,  96, 212, 174,  60, 100, 212, 157, 190, 180, 180, 149, 191,
+     164, 181, 124, 190, 152, 181,  67, 160, 140, 183,  51, 160, 140, 184,  51, 192,
+     140, 183,  52,  64, 140, 183,  51, 192, 140, 185,  51, 192, 140, 185,  51, 128,
+     140, 185,  51,  32, 169, 180,  66, 160, 165, 180,  82,  32, 100, 180,  89, 192,
+     100, 180,  88,  11 };
+
+constexpr byte Sound_C3_BANQUE [104] PROGMEM = {
+       0, 104,  47,  47, 196, 179,  16,   0, 132, 182,  67,  16, 132, 176, 116, 167,
+     174, 175, 142, 161,  84, 175, 167,  33,  69, 173, 183,  65,  18, 138, 158, 192,
+      83, 138, 142,  32, 102, 171, 149, 189,  85, 170, 157, 221,  85, 171, 149, 222,
+      86, 171, 149,  62,  21, 170, 125,  95, 117, 171, 108, 190,  84, 174,  99, 192,
+     152, 175,  99,  61, 132, 178,  80,  48,  64, 182,  72,  80,   4, 183,   0, 112,
+       4, 184, 150, 176, 200, 185,  84,  32, 228, 181, 131, 160, 148, 179, 123,  46,
+      80, 147, 122, 163, 164, 178, 104,  20 };
+
+constexpr byte Sound_C3_BOITE_DE_NUIT [148] PROGMEM = {
+       0, 148,  47,  47, 128, 216,   0,   0, 192, 184,  10, 144,   0, 180,   4, 144,
+       0, 180,  69,  15, 169, 171,  93,  35, 238, 172, 110,  36, 249, 175, 126, 163,
+     233, 178, 143,  64, 164, 180, 134, 165, 132, 213, 110,  34, 129, 175, 124, 185,
+      16, 161,  80,  80,   0, 215, 189,  16, 101, 213, 118,  48, 128, 151,  88,  80,
+     129, 182,  32, 112,  85, 213,  69,  49, 170, 182,  86, 169, 250, 181, 103,  32,
+     250, 182,  95,  95, 250, 182,  94, 190, 196, 181,  69, 191, 136, 181,  61,  63,
+     152, 215,  53, 223, 152, 216,  61,  60, 224, 217,  61, 223, 217, 151,  70,  94,
+     218, 150,  69, 191, 221, 150,  61,  32, 213, 152,  61,  64, 229, 216,  61, 192,
+     212, 216,  61,  62, 209, 185,  68,  64, 210, 217,  59, 223, 134, 153,  72,   8,
+     134, 153,  72,  15 };
+
+constexpr byte Sound_C3_BOUCHE [92] PROGMEM = {
+       0,  92,  47,  47,  64, 117,  72,   0,  64, 182,  58,  21,  64, 183,  58,  48,
+       1, 181,  28, 171,   1, 171,  85,  33,  69, 170,  93, 162,  65, 134, 117, 192,
+      66, 138,  85, 127,  65, 147,  76, 222,  17, 144,   5,  62,  69, 184, 254, 208,
+      69, 185, 254, 112, 101, 185, 254, 112,  69, 185, 253, 208,  37, 184, 205, 144,
+     208, 179, 116,  92, 144, 180, 139, 223,  85, 178, 139, 192,  81, 177, 123,  62,
+      85, 178, 114, 191,  85, 179, 128,  14,   1, 178,  88,  15 };
+
+constexpr byte Sound_C3_BRAS [80] PROGMEM = {
+       0,  80,  47,  47,  65, 179,  88,   0,  85, 173, 108,  27, 156, 173, 140, 189,
+      86, 175, 140,  58,  17, 176, 100,  32,  37, 177, 109,  16,  37, 177, 108, 128,
+      53, 176, 117,  16,  36, 176,  92, 128, 101, 177, 116,  41, 165, 175, 140, 164,
+     180, 176, 157, 163, 184, 176, 166, 160, 168, 176, 182, 222, 180, 175, 182, 191,
+     164, 175, 182,  61, 100, 206, 173, 191, 100, 207, 131, 189,  36, 205,  32,  15 };
+
+constexpr byte Sound_C3_BUREAU_DE_POSTE [180] PROGMEM = {
+       0, 180,  47,  47, 128, 215,  24,   0, 148, 180,  42, 144, 101, 183,  70,  43,
+     102, 151,  62, 163, 186, 150,  87,  66, 155, 178, 103,  64, 170, 174, 102,  63,
+     150, 172, 100, 187, 150, 171, 116,  35, 155, 172, 100, 163, 155, 172, 118,  35,
+     171, 176, 111,  64, 171, 179, 103, 189, 153, 178,  61,  49, 214, 178,  51, 177,
+     197, 212,  52,  43, 149, 181,  69,  34, 234, 180,  94, 163, 234, 179,  93,  32,
+     166, 178,  72,  16, 197, 178,  48,  48, 193, 179,  96,  80, 149, 213,  72, 112,
+      68, 180,  68,  48, 148, 175, 108,  31, 249, 175, 134,  57, 253, 176, 142,  94,
+     253, 177, 134,  95, 249, 177, 133,  61, 208, 178, 115, 160,  84, 215, 133, 208,
+      84, 214, 140, 240,  64, 215, 140,  48,  64, 215, 136, 112,  64, 215, 136, 112,
+       0, 215, 189,  16, 101, 213, 118,  48, 250, 180, 107, 136, 217, 178, 123, 160,
+     212, 179, 132,  63, 152, 179, 107, 223,  68, 177,  91,  32, 148, 179,  90, 139,
+      81, 147,  88,  12 };
+
+constexpr byte Sound_C3_CANARD [108] PROGMEM = {
+       0, 108,  47,  47, 192, 213,  80,   0,  20, 185,   4,  16, 104, 185, 150, 176,
+     212, 217, 100, 143, 228, 184, 117, 166, 224, 183, 143,  62, 228, 182, 151, 160,
+     180, 182, 143,  32, 168, 182, 126, 160, 168, 182,  85,  62,  72, 183,  68, 223,
+     136, 180,  60,  92, 228, 181, 125, 188, 164, 181, 141, 188, 164, 180, 174,  32,
+     165, 180, 190, 192, 229, 179, 198,  64, 164, 179, 190,  64, 164, 178, 182,  95,
+     164, 178, 173,  95, 168, 178, 164, 223,  68, 175, 147,  32,  24, 177,  99, 160,
+      84, 175,  98, 191, 121, 177,  90, 168,  37, 177,   0,  15 };
+
+constexpr byte Sound_C3_CENTRE_COMMERCIAL [244] PROGMEM = {
+       0, 244,  47,  47,  70, 178,  56,   0,  74, 215, 125,  48,  74, 214, 133, 208,
+      26, 212,   5, 240,  26, 214, 230,  80,   4, 215, 101, 143, 160, 177, 134, 172,
+     165, 176, 143,  62,  81, 175, 151, 191,  82, 173, 151,  32, 166, 172, 142, 160,
+      97, 172, 126, 192, 165, 173, 118,  62, 148, 174, 101, 191, 148, 204,  67, 177,
+     132, 203, 112,  80, 149, 214, 109, 144,   1, 213, 142,  48,  22, 206, 118,  48,
+     150, 209, 116,  48, 138, 177, 109,  33, 154, 177, 101, 190, 218, 176,  84,  58,
+     128, 181,  88, 112,  32, 175, 230,  48,  32, 112, 229, 174, 230, 144, 118,  47,
+     235, 144, 127,  67, 221, 177,  77, 192, 221, 145,  69,  61, 218, 145,  77, 160,
+     180, 183, 119,  94, 180, 183, 134, 187, 224, 181, 102,  60, 100, 181,  85, 179,
+      20, 179,   5, 188, 105, 180, 126,  16,  64, 185, 254,  80,   5, 214,  13, 208,
+      37, 215, 109,  80,   5, 183,   5, 208,  25, 218, 118,  80, 217, 216,  77,  38,
+     245, 215,  94,  63, 245, 183, 111,  63, 244, 182, 135, 191, 168, 181, 159,  61,
+     228, 179, 174, 223, 233, 179, 175,  63, 168, 180, 158, 192, 232, 180, 133, 223,
+     232, 180, 125,  32, 252, 180, 125, 191, 252, 180, 117,  64, 252, 180, 108, 223,
+     248, 180, 108,  64, 232, 180, 123, 161, 216, 179, 154, 192, 148, 179, 153, 140,
+     104, 179, 152,  15 };
+
+constexpr byte Sound_C3_CHAT [68] PROGMEM = {
+       0,  68,  47,  47,   4, 150,   0,   0,  69, 183, 255,  48,   5, 184, 255,  80,
+      21, 185, 254, 240,  21, 187, 254, 240,  69, 184, 254,  48, 137, 181, 109, 143,
+     145, 179, 126,  38, 229, 179, 142, 190, 229, 178, 159,  62, 170, 177, 175, 189,
+     234, 177, 175, 190, 169, 176, 175,  61, 160, 176, 174,  61,  80, 175, 156, 160,
+      84, 173, 152,   3 };
+
+constexpr byte Sound_C3_CHEVAL [132] PROGMEM = {
+       0, 132,  47,  47,   4, 182,  48,   0,  17, 217,   6, 112,  65, 218, 253, 176,
+      21, 218,   5, 240,   5, 185, 173, 145,  84, 212, 110,  47,  86, 179, 118, 193,
+      91, 179, 101, 191,  87, 146,  76, 188, 151, 178,  92,  61, 166, 178,  83, 190,
+      21, 179,  85, 161, 165, 179, 142,  32, 185, 179, 158, 190, 185, 179, 167,  62,
+     185, 179, 183,  63, 185, 179, 183,  95, 185, 179, 182, 191, 249, 180, 174,  64,
+     169, 180, 166,  95, 189, 180, 133, 192, 253, 180, 125,  64, 189, 180, 117,  64,
+     237, 180, 100, 223, 248, 180,  92,  32, 252, 180,  91, 160, 185, 180,  91, 192,
+      84, 178,  91,  61, 105, 179,  90, 161,  89, 179,  82,  32, 100, 180,  90,  14,
+      36, 180,  72,  13 };
+
+constexpr byte Sound_C3_CHEVEUX [112] PROGMEM = {
+       0, 112,  47,  47,  22, 216,   0,   0,   6, 215, 255,  16,  22, 216,   6, 176,
+     134, 218, 255,  80,  70, 218, 254, 176,  70, 219, 254, 240,   6, 219, 254,  48,
+      20, 217,  29, 145, 149, 181, 102, 175, 166, 179, 102, 193, 102, 179, 102,  63,
+     170, 178,  93,  62, 234, 178,  76,  62, 164, 178,  67,  32, 193, 178,  66,  32,
+     197, 180,  82, 160,  84, 182,  60,  32,  85, 180,  84, 184, 169, 179,  93, 160,
+     185, 179, 101, 190, 233, 179, 109, 190, 249, 179, 109,  63, 228, 178,  99, 191,
+     196, 178,  99,  63, 228, 179,  83,  64, 229, 178,  90, 167, 229, 178,  88,   7 };
+
+constexpr byte Sound_C3_CHIEN [76] PROGMEM = {
+       0,  76,  47,  47,  20, 217,  32,   0,  21, 218,  78, 176,   9, 185, 254, 208,
+      73, 185, 254, 240,  25, 216, 254, 112,   4, 217, 253,  80,  73, 215,  84,  15,
+     197, 181,  93, 167, 210, 183,  94, 189, 214, 183, 118, 188, 149, 182, 126, 223,
+     145, 180, 150, 222, 145, 179, 133, 190, 144, 178, 117,  62,  65, 170, 116,  60,
+     144, 178,  83, 160,  80, 178,  67,  32,  80, 178,   8,  13 };
+
+constexpr byte Sound_C3_DENTISTE [144] PROGMEM = {
+       0, 144,  47,  47, 132, 177,  40,   0, 132, 217,  51, 149,  80, 212,  92, 176,
+     234, 177, 126, 175, 166, 175, 142, 161, 146, 174, 159,  32, 146, 173, 142, 162,
+     162, 204, 134,  64, 162, 173, 117,  33, 160, 205,  92, 160, 145, 171, 114, 185,
+     209, 202, 120,  16, 128, 215, 120, 112,   8, 214, 189,  48,  72, 217, 141,  48,
+     153, 217,  69, 208, 212, 217,  69, 148, 244, 216,  62,  64, 244, 216,  61, 189,
+     245, 217,  53, 192, 245, 217,  53,  33, 228, 184,  52, 160, 221, 184,  43, 161,
+     149, 183,  67,  64,  94, 215,  69,  80,  14, 217, 253,  80,  94, 215,  12, 208,
+      84, 215,   8,  80,  84, 215,   8, 112,   0, 214, 140, 144,   8, 183, 148, 176,
+      85, 213,  60, 176, 197, 177,  91,  41, 217, 179,  67,  63, 133, 179,  40,  17 };
+
+constexpr byte Sound_C3_DOIGT [76] PROGMEM = {
+       0,  76,  47,  47,  68, 215,  56,   0,   4, 215, 212, 145,  37, 214,  61,  63,
+      80, 214,  68, 143, 149, 175,  84, 162, 149, 172,  92, 193, 153, 170, 100, 193,
+     217, 172, 117, 160, 149, 173, 134, 160, 148, 176, 159,  63, 168, 175, 159,  62,
+     168, 175, 166, 189, 184, 175, 166,  61, 184, 175, 157,  32, 164, 175, 124,  57,
+      80, 175, 131,  63, 160, 175, 122, 139, 144, 206, 128,  13 };
+
+constexpr byte Sound_C3_GRENOUILLE [132] PROGMEM = {
+       0, 132,  47,  47, 148, 145,  64,   0,   5,  79,   4,  56,  33, 178,  76,  48,
+      81, 179, 108,   9,   2, 143,   4, 189,   2, 170, 132, 161, 103, 171, 108, 164,
+       7, 167, 141,  39, 214, 175, 126,  40, 165, 178, 118, 193, 149, 180,  95,  62,
+     136, 180,  61, 191, 140, 179,  53,  94, 153, 179,  86,  95, 136, 177,  93,  94,
+     136, 171, 109,  95, 141, 170,  92, 223,  69, 175,  84, 222, 133, 152,  77,  63,
+     161, 184,  69,  63, 230, 216,  61,  95, 217, 216,  36,  63, 212, 216,  43, 192,
+     213, 216,  43, 192, 164, 216,  68,  64, 144, 216,  92, 192,  85, 181,  68,  61,
+     152, 179,  83, 161,  68, 178,  67,  32,  80, 179,  66, 160,  80, 178,  65, 140,
+      64, 178,  40,  13 };
+
+constexpr byte Sound_C3_HOPITAL [160] PROGMEM = {
+       0, 160,  46,  47, 150, 180,  80,   0, 214, 178, 101,  47, 214, 177, 102,  42,
+     214, 177, 102, 160, 214, 177, 103,  32, 218, 175, 102, 162, 170, 174,  85, 160,
+     209, 174,  59, 189, 230, 173,  56,  16, 196, 175,  72, 112,   4, 180, 238, 176,
+      25, 184,   6,   7, 233, 216,  53, 190, 246, 216,  53, 189, 229, 216,  53,  61,
+     213, 215,  43, 177, 193, 184,  40,  16, 193, 182,  48,  80, 128, 247,  48, 112,
+       0, 182,  76,  16,  85, 183, 181, 176,  84, 182, 124, 143, 228, 181, 109, 184,
+     228, 181, 134, 187, 233, 181, 150, 188, 169, 180, 167,  32, 233, 180, 167,  61,
+     245, 180, 166,  64, 165, 180, 166, 192, 165, 180, 150,  64, 168, 180, 125,  63,
+     224, 180, 116, 160, 232, 180,  92, 192, 232, 180,  84,  64, 232, 180,  84, 192,
+     233, 180,  92,  63, 169, 180, 115, 191, 160, 180, 114, 163, 160, 180, 112,  15 };
+
+constexpr byte Sound_C3_JAMBE [116] PROGMEM = {
+       0, 116,  47,  47,  84, 213, 112,   0, 133, 216, 115, 186,  85, 218, 109,  32,
+      84, 218,  94, 144,  20, 218,   5, 132,  20, 218,  54, 144,  89, 218,  86, 134,
+      64, 219, 119,  37,  80, 179, 135,  34,  84, 178, 143,  32,  96, 176, 151,  32,
+     102, 173, 151,  64, 102, 172, 143,  32,  86, 171, 142, 223,  85, 170, 150, 222,
+      89, 170, 141, 222,  85, 169, 133, 222,  84, 169, 124,  95,   4, 166, 124,  32,
+      72, 176,  44,  95,  92, 175,  43, 160, 172, 175,  40,  16, 212, 177,  24, 112,
+      64, 181,  77,  48, 148, 177,  84,  16, 244, 177, 107, 160, 232, 177, 114,  37,
+     164, 178, 104,  14 };
+
+constexpr byte Sound_C3_MAIN [68] PROGMEM = {
+       0,  68,  47,  47, 156, 179,  48,   0, 220, 179,  50, 152, 204, 180,  52,  33,
+      92, 180,  45,  32, 156, 179,  53,  33, 156, 179,  61, 161, 169, 177, 110,  37,
+     182, 178, 159,  33, 181, 179, 167, 160, 181, 179, 167,  64,  96, 178, 159,  63,
+      96, 178, 166, 189, 100, 178, 149, 190,  80, 210, 140, 188, 128,  84, 115,  62,
+      80, 177, 112,  14 };
+
+constexpr byte Sound_C3_MEDECIN [112] PROGMEM = {
+       0, 112,  47,  47,  69, 180,  72,   0, 137, 149,  59, 222, 137, 148,  52, 193,
+     136, 147,  53,  35, 230, 183, 102, 165, 230, 183, 119,  33, 230, 183, 103,  32,
+     235, 183,  86, 160, 150, 182,  68, 185, 192, 183,  51, 165,  85, 215, 112, 112,
+      87, 214, 116, 208,   3, 213,  12, 208,  23, 215, 149,  80, 155, 181, 149, 176,
+       7, 178, 181, 208,  69, 180,  84,  28, 148, 178, 109, 191, 149, 178, 126,  95,
+     146, 178, 142,  95, 146, 178, 142,  64, 146, 178, 142,  64, 146, 178, 141, 160,
+     129,  80, 108,  32, 129, 110, 107, 191, 130, 143,  83,  32, 130, 143,  80,   6 };
+
+constexpr byte Sound_C3_NEZ [68] PROGMEM = {
+       0,  68,  47,  47, 156, 181,  32,   0, 140, 181,  44, 189, 220, 181,  37, 161,
+     140, 181,  46,  33, 140, 182,  46,  65, 140, 182,  54,  34, 140, 183,  46, 162,
+     233, 183, 103,  32, 233, 184, 103,  33, 233, 184, 103,  64, 229, 184, 111,  61,
+     229, 184, 102, 189, 208, 185,  86, 189, 224, 185, 101,  61, 160, 218,  76, 191,
+      72, 183,  32,  14 };
+
+constexpr byte Sound_C3_OPTICIEN [164] PROGMEM = {
+       0, 164,  47,  47, 229, 181, 120,   0, 229, 180, 133, 143, 245, 179, 142, 164,
+     245, 179, 143,  32, 245, 179, 143, 160, 250, 177, 127,  32, 168, 177,  77,  60,
+     208, 178, 123, 163, 209, 177, 120,  16, 213, 176,  96,  48, 192, 182, 120,  80,
+       0, 185, 150,  16,  17, 185,  71,  48,  65, 216, 133, 144, 192, 184, 128,  48,
+     128, 214, 120,  80,   4, 215, 190,  48,  10, 215,   5,  48, 154, 216,  53,  28,
+     233, 216,  61, 167, 233, 217,  53, 192, 200, 217,  53,  60, 141, 185,  44, 177,
+     139, 215,  69,  48,  27, 215,  93,  80,  11, 216,   5,  48,  11, 213,   5,  80,
+      27, 215,   5, 208,  91, 217,  70, 112, 213, 217,  61,   4, 196, 219,  60, 160,
+     192, 186,  77,  32, 192, 218,  94,  63, 192, 185, 118,  62, 144, 183, 118,  61,
+      85, 181, 142,  64,  80, 179, 133,  63,  80, 146,  92, 160,  85, 177,  84, 162,
+      85, 178,  88,  13 };
+
+constexpr byte Sound_C3_OREILLE [164] PROGMEM = {
+       0, 164,  47,  47, 230, 179, 112,   0, 229, 178, 123,  15, 234, 177, 124,  35,
+     234, 177, 125,  32, 234, 177, 126,  32, 234, 177, 126, 160, 145, 175, 134, 192,
+     229, 173, 117, 160, 229, 173, 116, 189, 150, 174, 116,  32,  85, 176, 124, 176,
+       5, 208, 101,  48,   5, 178,  45,  32, 164, 179, 117,  62, 149, 180, 142, 190,
+     229, 180, 159,  61, 233, 181, 159, 222, 185, 182, 151,  95, 185, 182, 135,  95,
+     181, 182, 134, 157, 244, 183, 125, 191, 240, 183, 117, 160, 228, 183, 109,  32,
+     240, 183,  92, 160, 224, 215,  84, 160, 244, 216,  68,  63, 228, 216,  59, 191,
+     229, 215,  59,  95, 249, 215,  51, 192, 233, 216,  68,  64, 245, 183, 101,  65,
+     233, 182, 125,  62, 164, 182, 124, 160,  81, 181, 116,  62, 148, 180, 147, 161,
+     164, 180, 114, 160,  85, 179,  90,  32,  84, 179,  57, 160,  81, 178,  96,  15,
+      80, 179,  72,  15 };
+
+constexpr byte Sound_C3_PAPETERIE [148] PROGMEM = {
+       0, 148,  47,  47, 192, 181,  72,   0, 225, 214, 116,  16, 192, 148, 125,  47,
+     212, 179, 150,  41, 212, 179, 150, 192, 212, 180, 142,  32, 192, 173, 131, 191,
+     192, 147, 146, 161, 192, 180, 136,  16, 128, 212, 120,  48, 132, 183, 120,  80,
+     228, 181, 109,   4, 248, 182, 126, 190, 185, 183, 127, 187, 249, 183, 127, 188,
+     248, 183, 102, 191, 232, 183,  93,  61, 192, 183,  75, 177, 224, 183, 104,  48,
+      16, 215, 136, 112,  17, 214, 125, 144,  33, 212, 125, 208, 224, 180, 238,  80,
+      32, 213, 141, 176,  33, 213, 125,  48,  97, 214,  76, 176, 182, 182,  84,   4,
+     230, 183,  84,  32, 233, 184,  93, 160, 185, 184,  78,  61, 249, 216,  77, 190,
+     233, 216,  68, 160, 229, 216,  51, 192, 229, 216,  51,  32, 200, 217,  66, 192,
+     200, 217,  56,  14 };
+
+constexpr byte Sound_C3_PHARMACIE [152] PROGMEM = {
+       0, 152,  47,  47,  69, 181,  64,   0,   5, 182,   4,  16,  21, 181,   4,  48,
+       5, 181,   5,  80,  85, 184,  69,  80,   5, 183, 237,  80,  85, 182, 157, 176,
+     144, 145, 125,  47, 217, 177, 150,  34, 153, 177, 167,  63, 169, 177, 175,  62,
+     164, 176, 158, 190,  22, 174, 101, 176,  81, 207,  85,  37,   2, 166,  68,  32,
+     136, 169,  60,  63, 216, 174,  52,  35, 216, 176,  53,  62, 152, 177,  54,  60,
+     169, 177,  54,  62, 161, 180, 151,  60, 168, 181, 151,  64, 164, 181, 134,  62,
+     148, 182,  93,  62, 137, 214, 109,  16,  89, 215,  93, 112,  89, 216,  77, 112,
+      73, 216,  69, 112, 220, 216,  52,  28, 216, 216,  45,  60, 228, 216,  45, 189,
+     244, 249,  45,  64, 248, 249,  44, 191, 242, 217,  36,  32, 216, 249,  27, 193,
+     194, 218,  43, 194, 130, 186,  40,   2 };
+
+constexpr byte Sound_C3_PIED [64] PROGMEM = {
+       0,  64,  47,  47, 129, 181,  88,   0,  36, 182,  36,  16,  72, 183, 254,  48,
+       9, 216, 254,  48,   8, 216, 173,  48, 196, 217,  60,  41, 228, 216,  69, 191,
+     245, 216,  78, 191, 229, 216,  86, 190, 229, 184, 102, 222, 229, 184,  94,  63,
+     229, 184,  85, 191, 201, 153,  84,  59, 228, 217,  74, 191, 208, 217,  80,  14 };
+
+constexpr byte Sound_C3_POULE [96] PROGMEM = {
+       0,  96,  42,  47,  64, 217, 112,   0,   0, 216, 125,  48,   0, 214, 252,  48,
+      64, 181, 108,  47, 135, 168, 100, 192, 151, 168,  92, 192, 151, 137,  84, 223,
+      75, 136, 101,  61, 155, 143,  85,  92, 229, 116,  77,  94, 164, 182,  85, 221,
+     228, 181,  92,  95, 248, 181,  83, 223, 216, 181,  83, 192, 197, 181, 108, 191,
+     170, 179, 124, 192,  89, 179, 116, 191,  36, 179,  28,  63, 116, 178,  91, 161,
+     169, 178,  82,  62, 132, 178,  57,  36,  69, 179,  17,  32,  85, 179,   0,  15 };
+
+constexpr byte Sound_C3_SALON_DE_COIFFURE [204] PROGMEM = {
+       0, 204,  37,  47,  74, 211, 112,   0,  26, 214, 125, 208,  90, 215, 117,  48,
+      26, 215, 141, 112,  90, 214, 117, 176, 164, 213, 101,  15, 164, 181, 134, 168,
+     228, 181, 135,  64, 164, 181, 118, 191, 168, 181,  85, 162, 164, 179,  93, 194,
+     149, 174, 118,  65, 137, 169, 126,  65, 134, 173, 126,  64, 134, 175, 118, 160,
+     157, 175,  69,  57, 157, 174,  51, 185,  84, 213,  68, 189, 154, 180, 102,  32,
+     234, 179, 110, 189, 231, 177, 101,  63, 129, 147,  88,  80, 132, 175, 136, 112,
+       0, 174,   4,  48, 170, 174, 126,  43, 233, 144, 142, 190, 170, 146, 143,  61,
+     228, 147, 142, 189, 132, 147, 117,  32, 152, 182, 133, 176, 154, 183, 142, 176,
+      37, 182, 142, 240,  41, 182, 142,  80,  37, 183,  77, 176,  52, 183,  53,  48,
+     181, 183,  60,  17, 241, 183,  60,  61, 224, 184,  68,  94, 224, 247,  59, 223,
+     240, 183,  68,  96, 225, 151,  76,  95, 197, 119,  91, 160, 196, 149,  99, 160,
+     237, 178, 123, 223, 169, 177, 107,  32, 117, 176, 107, 189,  85, 177, 108, 144,
+      21, 175,   4, 208,  21, 174,   4,  48,  21, 174,   0,  15 };
+
+constexpr byte Sound_C3_STATION_SERVICE [216] PROGMEM = {
+       0, 216,  47,  47,  64, 216, 104,   0,  74, 216, 109, 176,  74, 216, 109, 176,
+      64, 186, 253, 128,  16, 182,  61, 128, 232, 181, 126, 175, 232, 181, 143, 192,
+     232, 181, 134, 160, 212, 181, 117, 191, 148, 182,  85,  63, 196, 214, 124,  64,
+     197, 214, 133,  16, 133, 217, 141, 176,  10, 218, 109, 176,  90, 218, 150, 176,
+       5, 185,   6, 176, 149, 183,  93, 131, 150, 150, 110, 172,  85, 175, 110, 220,
+      69, 173, 126,  62, 165, 173, 101,  62, 225, 172,  92,  63,  65, 180,  52, 188,
+       2, 212,   4, 144,   4, 215, 101, 208,   1, 183,  53, 112,  29, 182,   5, 176,
+     109, 182,  84, 141, 248, 182, 102,  63, 245, 182, 119,  60, 249, 182, 127,  94,
+     181, 182, 118, 190, 161, 181, 101,  62, 161, 181, 124,  32, 145, 179, 100, 193,
+     153, 179, 109, 190, 149, 147, 100,  61, 197, 145,  83,  60, 144, 152,  75,  62,
+     208, 216,  67, 160, 224, 216,  60,  63, 192, 215,  59, 223, 208, 248,  51, 191,
+     217, 216,  59, 223, 214, 184,  51, 223,  74, 217,  92, 208,  10, 214,  76,  48,
+      26, 215,   4, 112,  26, 214, 124,  80,  26, 213,   4, 240, 138, 214, 108,  48,
+     148, 180,  98,  13, 105, 180,  48,  15 };
+
+constexpr byte Sound_C3_TABAC [76] PROGMEM = {
+       0,  76,  47,  47,  64, 183, 104,   0,  20, 215, 206,  48, 232, 182, 134, 175,
+     248, 181, 159, 161, 228, 180, 175, 223, 233, 179, 159,  62, 164, 177, 117,  49,
+      81, 148, 139, 175,  64, 116, 120, 112, 248, 177, 133,  49, 253, 178, 166, 189,
+     249, 178, 174,  63, 232, 177, 174,  63, 164, 177, 181, 192, 148, 176, 172, 188,
+     144, 207, 163, 160, 180, 208, 155, 137, 184, 176, 136,  15 };
+
+constexpr byte Sound_C3_TETE [92] PROGMEM = {
+       0,  92,  47,  47, 128, 214,  96,   0,  20, 215, 214,  48, 228, 182, 109, 175,
+     244, 182, 119,  37, 248, 182, 135, 189, 245, 182, 127, 188, 249, 182, 119, 189,
+     244, 183, 119,  62, 232, 183,  94,  62, 228, 183,  93,  62, 212, 183, 104,  48,
+     208, 215,  96,  80, 128, 215,  96, 112, 128, 215,  88, 112,  21, 183, 190,  48,
+     153, 182, 149, 176, 153, 181,  92,  16, 213, 180,  75, 144, 208, 180,  83, 184,
+     192, 145,  91,  63, 208, 180, 107, 190, 229, 179,  80,  14 };
+
+constexpr byte Sound_C3_VACHE [68] PROGMEM = {
+       0,  68,  47,  47,   0, 213, 248,   0,  85, 180,  84,  14, 169, 179, 158,  33,
+     233, 179, 167,  33, 233, 179, 183,  64, 169, 180, 175,  95, 185, 180, 166, 188,
+     164, 180, 141, 190, 169, 180, 124, 189, 116, 219, 157, 176,  20, 218, 181, 208,
+      20, 218, 253, 240,  68, 218, 253,  48,  37, 186, 253, 112,  21, 186, 252, 176,
+       5, 177, 152,   4 };
+
+constexpr byte Sound_C3_VITRINE [140] PROGMEM = {
+       0, 140,  47,  47, 148, 215,  24,   0, 148, 183,  36,  15, 165, 184,  69,  35,
+     234, 185,  62,  36, 233, 217,  62,  39, 228, 249,  61,  34, 196, 218,  59, 185,
+     145, 217,  48,  16, 192, 216,  64,  48,  20, 183,   0, 112,  37, 214, 158, 176,
+      16, 182, 238, 176,  32, 214, 191,  48,  33, 215, 118,  80, 212, 184,  85, 182,
+     233, 185,  95,  61, 229, 217,  95,  94, 245, 217,  86, 190, 229, 217,  78, 189,
+     245, 217,  70,  63, 224, 249,  77,  32, 196, 182,  68, 160, 200, 175,  59, 223,
+     204, 180,  59, 223, 136, 180,  67,  32, 200, 175,  59,  64, 200, 175,  59,  64,
+     232, 181,  76,  32, 169, 181, 116,  64, 165, 180, 123, 189, 165, 179, 123,  32,
+     145, 147,  98,  64, 166, 179,  97, 140,  97, 178,  64,  15 };
+
+constexpr byte Sound_C3_ARMOIRE [140] PROGMEM = {
+       0, 140,  46,  47, 180, 181, 168,   0, 165, 180, 172, 167, 165, 180, 174,  32,
+     165, 180, 175,   0, 170, 179, 191,  33, 169, 178, 166, 163,  80, 178, 149, 163,
+     101, 176, 109,  63,  42, 177,  68, 190,  18, 176,  48,  80,  98, 175,  67,   8,
+     134, 167,  98, 191, 129, 184,  58,  32, 200, 175,  50, 223, 136, 178,  43,  59,
+     136, 182,  52,  62,  72, 184,  52,  63, 130, 186, 124, 190, 136, 179, 132, 160,
+     150, 171, 140, 223, 181, 174, 157, 223, 184, 175, 173, 192, 184, 176, 174,  95,
+     185, 176, 181, 192, 184, 176, 173,  64, 168, 176, 165,  95, 168, 176, 156, 223,
+     232, 176, 148,  64, 244, 175, 131,  32, 232, 175, 124,  48, 149, 174, 100,  48,
+     117, 175,  92,  48,  41, 176,   4,  16,  33, 177,   0,  15 };
+
+constexpr byte Sound_C3_BAIGNOIRE [144] PROGMEM = {
+       0, 144,  47,  47,  64, 182,  56,   0,  97, 182,  92, 143, 241, 182, 110, 162,
+     232, 184, 103,  65, 228, 217,  94, 162, 248, 217,  77, 191, 164, 217,  68,  34,
+     205, 145,  60,  64, 200, 146,  60,  95, 210, 217,  61,  63, 129, 186,  77, 189,
+     213, 182,  85, 189, 153, 179, 101, 189, 137, 176, 117, 189, 137, 172, 133,  95,
+      86, 173, 158,  95, 169, 176, 166,  64, 186, 177, 182, 223, 169, 177, 182,  96,
+     250, 178, 190,  94, 250, 177, 181, 160, 186, 177, 173,  32, 100, 177, 156, 192,
+     100, 176, 132,  32, 185, 176, 131, 192, 121, 176,  91,  32,  37, 176,  59,  32,
+      57, 176,   3,  59,  49, 176,   3, 144,  37, 176,   3, 176,  41, 176,   3, 176,
+     105, 176,  99,  68,  84, 175,  91,  95,  84, 177,  58, 193,  32, 177,   0,  15 };
+
+constexpr byte Sound_C3_BALAIS [84] PROGMEM = {
+       0,  84,  47,  47, 144, 150,  40,   0, 148, 180,  91, 145, 249, 180, 142, 175,
+     228, 181, 167,  65, 228, 182, 150, 193, 228, 214, 134,  33, 232, 214, 117,  63,
+     236, 214,  92, 190, 248, 183,  84, 221, 164, 183,  85,  94, 233, 183, 102,  61,
+     233, 184, 118,  62, 233, 184, 117, 157, 229, 184, 109, 191, 245, 185, 101,  95,
+     229, 185, 100, 158, 224, 185,  91, 160, 208, 185,  83,  65, 208, 217,  82,  34,
+     228, 217,  88,  14 };
+
+constexpr byte Sound_C3_BIBERON [108] PROGMEM = {
+       0, 108,  47,  47,  64, 116,  32,   0,  21, 180,   4, 144,   4, 149,   5,  15,
+     165, 185,  62,  34, 245, 217,  54,  65, 242, 185,  61, 193, 133, 146,  51, 191,
+     133, 142,  50, 191, 208, 185,  32,  48, 192, 181,  24,  80,   0, 117, 213,  55,
+      85, 176, 117,  32, 185, 173, 125,  62, 165, 171, 125,  64, 177, 202, 115, 187,
+      22, 167, 131,  60,  87, 168, 123,  63, 170, 167, 123,  64, 153, 168, 140,  34,
+     142, 166, 156, 160, 137, 165, 148, 223, 136, 167, 139, 192, 132, 169, 123, 223,
+     132, 170, 123, 192, 132, 171, 114, 164, 129, 140, 112,  15 };
+
+constexpr byte Sound_C3_BOUCHON [68] PROGMEM = {
+       0,  68,   0,  47, 129, 215,  50, 186, 129, 145, 108,  34, 130, 173, 100, 192,
+     130, 142,  92,  64,  66, 146,  75, 190, 192, 180, 252, 176, 132, 184, 254,  80,
+      96, 186, 254, 112,  16, 217, 254, 112, 144, 176, 116, 221,  90, 170, 140,  95,
+      74, 167, 140,  62,  25, 163,  92,  32,  72, 167,  99, 160,  44, 160,   3,  32,
+      40, 160,  72,   6 };
+
+constexpr byte Sound_C3_BOUTEILLE [124] PROGMEM = {
+       0, 124,  46,  47,  64, 182,  56,   0, 241, 182, 109,  40,   1, 177,   4, 183,
+      65, 172, 100, 169,  69, 171,  84, 195, 132, 175,  68, 193,  68, 172,  52,  60,
+     196, 171,  66, 177, 225, 218,  72,  48,   0, 184, 248, 112,  84, 215, 173, 176,
+     234, 182, 118,  45, 249, 182, 134, 190, 248, 182, 143,  93, 248, 182, 150, 187,
+     249, 182, 151,  95, 232, 183, 142, 223, 232, 183, 134,  95, 249, 184, 125, 192,
+     244, 216, 101,  64, 244, 216,  68, 192, 232, 217,  68,  62, 227, 185,  67,  32,
+     232, 249,  59, 223, 228, 216,  51,  64, 228, 216,  51, 161, 228, 183,  75, 192,
+     212, 181,  83,  64, 153, 180,  90, 164, 168, 180,  80,  15 };
+
+constexpr byte Sound_C3_CARAFE [132] PROGMEM = {
+       0, 132,  47,  47, 129, 151,  88,   0,  16, 186, 198,  48,  64, 186, 157,  15,
+     224, 184, 118,  45, 228, 183, 151,  61, 160, 181, 183,  94, 144, 179, 174, 190,
+      64, 174, 181, 191,  84, 177, 133,  63,  68, 179, 125,  16, 148, 179, 131, 176,
+      84, 177, 107,  48,  80, 177, 115, 176,  84, 177, 140, 145, 169, 176, 174,  63,
+     185, 176, 190, 221, 184, 176, 198,  62, 169, 177, 190,  95, 184, 177, 173, 191,
+     164, 177, 164, 191, 168, 176, 123, 189,  88, 176, 123,  32,   4, 215, 163,  16,
+      84, 214, 164, 176,   5, 211, 244, 240,   0, 184, 237, 112,   0, 214, 252, 208,
+     153, 179,  99,  48, 152, 178,  90, 133, 212, 174, 122,  64,  84, 177,  89, 194,
+     101, 177,  72,  15 };
+
+constexpr byte Sound_C3_CASSEROLE [112] PROGMEM = {
+       0, 112,  47,  47,   0, 182,  88,   0,   4, 185, 254,  48, 228, 184, 109,  47,
+     232, 183, 135,  36, 232, 182, 151,  30, 244, 181, 159,  63, 160, 181, 150, 189,
+     148, 182, 124, 191, 148, 213, 141,  80,   0, 247, 141, 112,  37, 177, 140, 240,
+     150, 173, 108, 112, 170, 173, 140, 177, 170, 172, 149,  94, 250, 173, 149,  64,
+     254, 174, 149,  95, 254, 177, 141,  95, 249, 179, 133,  95, 184, 180, 117,  63,
+     168, 180, 109,  32, 252, 180,  92,  63, 252, 180,  91,  32, 236, 180,  91,  64,
+     236, 179,  91,  64, 236, 179,  90, 160, 236, 179,  89, 167, 236, 179, 104,  14 };
+
+constexpr byte Sound_C3_CHAISE [116] PROGMEM = {
+       0, 116,  47,  47, 176, 182, 128,   0, 106, 182, 101, 144,   4, 217,   6, 112,
+       2, 218, 253, 208, 138, 182, 253, 240, 228, 181, 117, 173, 244, 182, 134, 191,
+     249, 182, 142, 191, 249, 183, 143,  96, 181, 183, 135,  59, 245, 183, 142, 190,
+     249, 183, 134, 222, 250, 183, 126, 222, 250, 183, 118,  62, 245, 183, 109, 191,
+     245, 183, 101,  32, 244, 182, 100, 191, 244, 182, 100,  63, 245, 182,  83, 191,
+     224, 181,  99,  63, 234, 182,  67,  64, 150, 182,  82, 192, 170, 182,  58,  64,
+     154, 181,  66, 192, 224, 180,  90, 192, 209,  84, 122, 192, 145, 179, 114, 194,
+     144, 179, 120,  14 };
+
+constexpr byte Sound_C3_CHAMBRE [104] PROGMEM = {
+       0, 104,  35,  47,  90, 215, 136,   0,  90, 218, 158, 144,  10, 214, 255,  48,
+      26, 218, 199,  80,  26, 219, 190, 176,  26, 219, 254, 208, 106, 219, 254, 208,
+     160, 176, 133, 199, 162, 174, 142,  95,  97, 170, 150, 127,  97, 170, 150,  93,
+      81, 169, 125,  94,  33, 168,  77,  95,  21, 165, 173,  94,  68, 166, 100,  93,
+     140, 177,  35,  65, 131, 153,  58, 160,   0, 147,   0,  80, 102, 176, 104, 112,
+     102, 175, 116, 176,  22, 174, 107, 176, 104, 174, 148, 208, 169, 174, 140,   2,
+     165, 174, 115, 191,  33, 142,  19,  32 };
+
+constexpr byte Sound_C3_CLEF [76] PROGMEM = {
+       0,  76,  47,  47,   4, 116, 200,   0,  68, 183, 254,  16,   4, 215, 207,  48,
+      17, 217, 125, 176,  85, 216,  45,  15, 216, 248,  84, 165, 224, 215,  93,  32,
+     240, 246,  85,  63, 245, 182,  77,  64, 244, 183, 102, 162, 228, 183, 111,  32,
+     245, 184, 103,  95, 229, 184, 102, 222, 229, 185,  94,  61, 224, 185,  93,  60,
+     200, 149,  99, 190, 224, 186,  90, 189, 224, 185,  80,   9 };
+
+constexpr byte Sound_C3_COMPTEUR [128] PROGMEM = {
+       0, 128,  47,  47, 128, 212,  88,   0,  81, 176, 198,  48, 148, 139, 116, 202,
+      73, 169, 141, 160, 136, 169, 141, 162, 130, 140, 133, 161, 132, 173, 125,  63,
+     133, 170, 117,  62, 149, 169, 116,  62, 128, 173,  91, 189,  68, 174, 120,  16,
+     128, 145,  96,  48, 128, 152, 112,  80,  16, 196, 152, 112,  16, 181, 198,  16,
+      21, 214, 150,  48, 169, 180, 117, 183, 249, 180, 126,  59, 249, 180, 142,  93,
+     249, 179, 150,  32, 229, 179, 142,  95, 249, 179, 142,  95, 250, 180, 141, 192,
+     233, 180, 141,  64, 232, 180, 133,  95, 232, 180, 124,  95, 168, 180,  99, 160,
+     149, 179,  83,  32, 152, 146, 115,  64, 185, 177, 130, 141,  32, 178, 136,  13 };
+
+constexpr byte Sound_C3_CUISINE [116] PROGMEM = {
+       0, 116,  47,  47, 148, 182, 104,   0,  32, 185, 254, 176,  32, 184, 125, 176,
+      48, 183,   6,  48, 180, 182,  53, 163, 245, 151,  53, 191, 218, 152,  62,  32,
+     234, 152,  54, 161, 246, 185,  55,  32, 246, 217,  55,  33, 229, 217,  63,  34,
+     228, 217,  62, 161, 228, 184,  53, 192, 228, 184,  61, 192, 213, 216,  69, 223,
+     192, 249,  69, 192, 216, 216,  61, 223, 216, 216,  62,  95, 245, 217,  70, 222,
+     241, 217,  62,  95, 212, 249,  70, 192, 192, 184,  62,  95, 132, 119,  68, 192,
+     162, 151,  61,  64, 172, 182,  60, 223, 216, 181,  68,  32, 228, 182,  90, 164,
+     228, 182,  88,  10 };
+
+constexpr byte Sound_C3_CUISINIERE [148] PROGMEM = {
+       0, 148,  47,  47, 128, 184, 104,   0,  68, 150, 253, 144,  32, 185, 117,  48,
+      32, 216, 220, 176, 128, 183, 253,  48,  48, 182,   5,  47, 254, 151,  61,  68,
+     230, 152,  61, 161, 233, 184,  69, 160, 237, 216,  61, 191, 201, 183,  60,  93,
+     220, 184,  67, 188, 204, 185,  52,  64, 136, 215,  52,  32, 213, 216,  69, 192,
+     197, 216,  70,  32, 192, 249,  70,  63, 197, 149,  53,  61, 141, 146,  52, 190,
+     205, 146,  52,  94, 137, 143,  52,  62, 161, 249,  69,  62, 132, 250,  77, 222,
+     216, 217,  85, 190, 228, 184, 102,  64, 169, 184, 135,  64, 185, 183, 142, 223,
+     169, 183, 142, 192, 169, 183, 134, 192, 249, 183, 126,  64, 249, 183, 125, 191,
+     212, 151, 116, 192, 213, 150, 116, 192, 217, 150, 123, 160, 217, 181, 122, 164,
+     233, 148, 112,  12 };
+
+constexpr byte Sound_C3_ECLAIRAGE [188] PROGMEM = {
+       0, 188,  47,  47, 245, 183,  80,   0, 232, 183,  98,  46, 232, 183, 100,  32,
+     232, 216, 110, 161, 228, 185, 110, 193, 200, 154, 101, 190, 200, 184,  67, 191,
+     224, 186,  80,  16, 133, 184, 104, 112,   8, 182,   6,  16,  80, 217, 133, 176,
+     152, 217,  92, 131, 152, 216,  68, 134, 224, 183,  85,  32, 245, 214,  86,  93,
+     166, 183,  94, 191, 229, 184, 119,  64, 212, 184, 110,  32, 208, 152, 117,  62,
+     192, 151, 124, 191, 100, 181, 125,  64,  36, 180, 117, 144, 105, 180, 125, 176,
+      25, 179, 101,  48,  89, 179, 117,  48, 165, 176, 149,  55, 169, 177, 174,  62,
+     184, 177, 182,  62, 249, 177, 182,  95, 244, 177, 182,  64, 181, 177, 165, 191,
+     249, 177, 173, 223, 249, 178, 141,  64, 233, 179, 132, 192, 233, 179, 116,  64,
+     144, 182, 116,  64,  97, 186, 100,  62,  88, 217,  84,  32,   4, 217,   4, 144,
+      20, 218,   4, 208,  16, 186,   4,  48,  68, 181, 107,  32, 128, 218, 114,  32,
+     196, 182, 113, 160, 136, 180, 105, 194, 136, 180, 104,  15 };
+
+constexpr byte Sound_C3_EPONGE [128] PROGMEM = {
+       0, 128,  47,  47, 228, 216, 104,   0, 232, 184, 124, 171, 232, 184, 125, 160,
+     232, 184, 127,  32, 228, 184, 119,  66, 228, 183, 102, 162, 144, 183,  92,  63,
+     144, 184, 114, 162, 208, 184, 104,  48, 133, 178, 104, 112,   0, 180, 148, 176,
+      68, 176, 108, 146, 232, 173, 116,  63, 153, 173, 133, 188, 137, 171, 158,  61,
+     132, 175, 142,  94, 132, 217, 141,  95, 194, 185, 125,  95, 130, 185, 116, 223,
+     136, 185, 117,  95, 130, 186, 124, 192,  72, 184, 124,  62,  72, 182, 123, 191,
+      72, 178, 115,  64,  26, 186, 123, 193,  26, 186, 115, 162,  30, 186, 115, 144,
+      30, 186, 115, 176, 237, 178,  91, 176, 109, 178,  90,  40, 109, 178,  88,   0 };
+
+constexpr byte Sound_C3_EVIER [116] PROGMEM = {
+       0, 116,  47,  47, 228, 184,  96,   0, 228, 184, 107,  38, 228, 184, 108, 160,
+     228, 184, 110,   1, 228, 216, 110, 163, 240, 217,  95,  66, 228, 217,  86, 162,
+     228, 217,  78,  33, 224, 185,  69,  62, 228, 184,  60,  61, 224, 216,  67,  32,
+     148, 216,  50, 220,  85, 183,  67, 187, 149, 185,  60,  36, 153, 217,  52, 189,
+     213, 217,  44,  62, 192, 217,  35, 189, 248, 248,  52,  95, 228, 216,  68, 192,
+     244, 216,  85, 191, 244, 216,  93, 160, 244, 184, 101, 191, 228, 184, 101,  63,
+     208, 218,  92,  64, 208, 217,  91, 160, 228, 217,  83,  64, 240, 217,  66, 137,
+     240, 185,  64,  12 };
+
+constexpr byte Sound_C3_FAUTEUIL [148] PROGMEM = {
+       0, 148,  47,  47,  85, 148,  88,   0,  21, 149,   4, 144,  21, 150, 125, 208,
+      21, 150, 125, 176,  21, 150, 125, 240, 128, 150, 124,  47, 224, 173, 116,  41,
+     209, 175, 116, 192, 209, 175, 116, 191, 193, 147,  92,  32, 197, 179,  75,  61,
+     192, 170,  80,  48, 192, 181, 112, 112, 134, 216, 125,  16,  85, 215, 149,  48,
+      85, 182,  92, 147, 234, 181, 110,  59, 233, 180, 126, 191, 165, 180, 134, 188,
+     229, 180, 134, 222, 169, 180, 126,  62, 234, 180, 142, 223, 169, 181, 118, 223,
+     249, 183, 102,  64, 229, 183,  93, 191, 229, 215,  85, 160, 233, 215,  69,  63,
+     233, 216,  68, 223, 249, 216,  68,  32, 233, 215,  68,  64, 233, 215,  68, 192,
+     249, 215,  84, 192, 185, 183, 100, 160, 185, 182, 100,  32, 169, 181,  91, 164,
+      80, 182,  56,  13 };
+
+constexpr byte Sound_C3_GARAGE [148] PROGMEM = {
+       0, 148,  47,  47, 128, 149,  64,   0,   8, 183,   5,  32, 216, 185,  93, 143,
+     228, 184, 111,  35, 164, 182, 167, 192, 164, 149, 175, 160, 144, 149, 182, 161,
+      88, 179, 150,  34, 153, 146, 126,  63,  85, 180, 101,  32,  84, 179, 116, 160,
+      20, 179, 108, 160,  20, 178,   4, 128,  37, 179,   4,  32,  89, 177, 124, 160,
+     100, 178, 157, 181, 169, 177, 174, 160, 185, 177, 175,  61, 164, 177, 190, 223,
+     185, 178, 182, 223, 184, 178, 174,  62, 169, 178, 174,  64, 169, 179, 157, 223,
+     169, 179, 149,  63, 232, 179, 140, 160, 144, 180, 124,  64,  84, 181, 108, 191,
+      80, 217, 108, 190,  81, 217,  68, 160, 100, 218,  44,  32,  84, 218,  11, 161,
+      68, 181, 107, 161, 128, 218, 115,  32, 196, 182, 114,  32, 200, 180, 105, 194,
+     136, 180, 104,  15 };
+
+constexpr byte Sound_C3_INTERRUPTEUR [192] PROGMEM = {
+       0, 192,  47,  47, 168, 213, 112,   0, 168, 213, 131,  43, 168, 213, 132, 160,
+     168, 213, 134,   1, 164, 213, 150, 160,  84, 181, 142, 162, 164, 181, 134, 162,
+     162, 181, 133,  32, 128, 214,  91, 188,  81, 149, 106, 160, 144, 214, 120, 112,
+      20, 215, 181,  16, 120, 215, 141, 176, 216, 215,  84,  15, 212, 183, 101, 162,
+     233, 182, 110, 222, 232, 181, 110,  58, 228, 179,  92,  59, 209, 178,  75, 190,
+     196, 181,  91, 193, 233, 180,  85,  65, 217, 180,  76,  61, 192, 146,  66,  62,
+     192, 185,  80, 112,  20, 182, 132, 144,  53, 182,  14,  80,  36, 215,  77,  16,
+     165, 182,  80,  48, 129, 215,  80, 112,  20, 216, 172,  16,  85, 215, 173,  48,
+      85, 214, 100,  16, 229, 181, 100, 152, 169, 180, 118,  32, 169, 180, 126, 189,
+     233, 180, 134,  62, 228, 179, 124, 190, 244, 179, 132,  63, 244, 179, 132,  64,
+     228, 179, 116,  32, 168, 180, 116,  33, 169, 180, 116,  64, 168, 180, 115, 223,
+     152, 179, 107, 223, 148, 179,  83,  32, 117, 177,  58, 165,  48, 177,  88,  14 };
+
+constexpr byte Sound_C3_LAMPE [108] PROGMEM = {
+       0, 108,  47,  47, 248, 181, 112,   0, 252, 181, 114, 187, 252, 182, 109, 193,
+     252, 181, 102,  34, 252, 180, 110,  66, 168, 180, 150, 164, 181, 178, 167,  33,
+     166, 177, 183,  33,  84, 176, 183,  33,  85, 173, 199,  63,  81, 139, 174,  63,
+      85, 168, 173, 221,  85, 168, 149,  62,  36, 166, 132, 188,  41, 166, 124,  63,
+      20, 163, 139,  62,  36, 165,  82, 160,  92, 165,  66,  32,  65, 119, 152,  80,
+      64, 185, 136, 112,   1, 179, 224, 112,  21, 146, 181,  48,  20, 181, 180, 144,
+     168, 177, 116,  16, 168, 177, 130, 144, 188, 177, 136,  14 };
+
+constexpr byte Sound_C3_LAVABO [124] PROGMEM = {
+       0, 124,  45,  47,  36, 182,  40,   0, 184, 182,  59, 189, 253, 181,  69,  65,
+     250, 181,  69,  65, 248, 181, 126, 169, 248, 181, 159, 162, 244, 181, 167, 161,
+     228, 181, 159,  35, 228, 180, 150, 161, 228, 180, 125, 191, 148, 178, 100,  62,
+      64, 214, 124,  32,  68, 180, 108, 160, 228, 179, 125, 162, 228, 179, 150, 160,
+     249, 179, 151,  63, 233, 179, 159, 191, 169, 179, 151, 190, 186, 178, 126, 160,
+     229, 178, 100, 160, 128, 175, 115, 183,  64, 172,  90, 162,  84, 211,  96, 112,
+      85, 176, 100, 176, 104, 171,  83, 182, 168, 170,  91, 160, 237, 169,  99, 223,
+     217, 168,  91,  32, 216, 167,  90, 223, 232, 167,  88,  15 };
+
+constexpr byte Sound_C3_LAVE_VAISSEILE [188] PROGMEM = {
+       0, 188,  47,  47, 100, 182,  80,   0, 180, 182,  69,  59, 188, 182,  77, 193,
+     252, 181,  85, 162, 237, 181,  93, 163, 232, 181, 151,  37, 228, 181, 167,  34,
+     228, 181, 167,  67, 164, 181, 150, 165, 132, 181, 150,  35, 132, 183, 125,  32,
+     128, 212,  92,  59, 152, 178,  75, 160, 132, 178,  72,  16,   0, 152, 136,  48,
+      69, 180,  43,  95,  84, 179,  51, 223, 102, 179,  44,  94,  90, 180,  84, 160,
+     170, 180,  85,  33, 250, 182, 102, 192, 232, 183,  94,  64, 232, 183,  85,  62,
+     216, 183,  76, 190, 202, 184,  84, 176, 244, 215, 100, 208,  33, 214, 108, 240,
+      41, 182, 109, 112, 233, 182,  92,  25, 244, 181, 117, 188, 248, 181, 126, 188,
+     245, 182, 142,  62, 244, 182, 134,  94, 244, 182, 133, 192, 244, 183, 125, 192,
+     244, 183, 117,  63, 228, 182, 100, 160, 232, 182, 100,  32, 252, 182,  91, 160,
+     232, 181,  83, 224, 236, 181,  91, 192, 172, 181, 100, 192, 169, 180, 116,  63,
+     164, 180, 107, 160, 148, 180,  99,  11, 148, 179, 104,  14 };
+
+constexpr byte Sound_C3_LINGE [88] PROGMEM = {
+       0,  88,  47,  47, 164, 181,  72,   0, 232, 181,  59,  33, 236, 181,  77,  64,
+     232, 181, 134,  32, 248, 181, 142, 191, 181, 180, 159,  95, 180, 180, 158,  95,
+     160, 179, 133, 223, 160, 147, 125,  32,  80, 180, 124, 192, 164, 179, 108,  95,
+     164, 179, 107, 223, 153, 178,  83,  95, 144, 179,  83,  96,  80, 216,  83, 192,
+      89, 217,  84, 176, 105, 217,  60, 208, 152, 217, 100,  33, 128, 181, 107,  32,
+      80, 180,  58, 164,  84, 180,  16,  14 };
+
+constexpr byte Sound_C3_MACHINE_A_LAVER_LE_LINGE_A [256] PROGMEM = {
+       1,  12,  47,  47, 185, 180, 144,   0, 140, 181,  53,  64, 140, 180,  53,  66,
+     165, 180, 127,  38, 165, 181, 159, 193, 168, 181, 143,  33, 228, 181, 126,  32,
+      65, 217,  94,  63,  84, 251, 126, 176,   2, 185, 254, 240,  10, 186, 254,  80,
+       9, 183, 253, 208,  73, 186,  44, 208, 208, 217,  68, 200, 134, 184,  75, 164,
+     133, 180,  83, 193, 129, 119,  83,  65, 129, 181,  75, 125, 192, 214, 101,  61,
+     228, 182, 134, 180, 180, 181, 151,  61, 181, 181, 159,  60, 168, 181, 151,  63,
+     168, 181, 135,  62, 253, 181,  93, 192, 249, 181, 110,  36, 252, 181, 143,  34,
+     248, 181, 143,  66, 248, 181, 135,  33, 248, 181, 126,  63, 164, 181, 116,  32,
+     144, 214,  99, 160, 144, 215,  99,  69, 229, 182,  92, 164, 212, 182,  93, 164,
+     212, 184,  93, 192, 212, 184,  85, 189, 209, 183,  68, 190, 225, 181,  67, 223,
+     212, 182,  76,  32, 233, 180, 109,  60, 234, 148, 110,  62, 164, 181, 102,  94,
+     164, 181,  85, 188, 164, 181,  77,  60, 232, 181,  60, 160, 236, 181,  77,  64,
+     232, 181, 134,  63, 248, 181, 142, 191, 181, 180, 159,  95, 180, 180, 158,  95,
+     160, 179, 133, 223, 160, 147, 125,  32,  80, 180, 124, 192, 164, 179, 108,  95,
+     164, 179, 107, 223, 153, 178,  83,  95, 144, 179,  83,  96,  80, 216,  83, 192,
+      89, 217,  84, 176, 105, 217,  60, 208, 152, 217, 100,  33, 128, 181, 107,  32 };
+
+constexpr byte Sound_C3_MACHINE_A_LAVER_LE_LINGE_B [12] PROGMEM = {
+      64, 180, 107,  64,  80, 180,  58, 164,  84, 180,  16,  14 };
+
+constexpr byte Sound_C3_MAISON [92] PROGMEM = {
+       0,  92,  47,  47, 169, 180,  88,   0, 136, 181,  60, 160, 204, 181,  60, 161,
+     204, 148,  52, 194, 133, 150,  69, 166, 228, 184,  95,  65, 228, 184,  86, 160,
+     228, 183,  86, 192, 229, 183,  86,  63, 248, 183,  77, 190, 230, 182,  77,  94,
+     230, 181,  68, 189, 134, 181,  76,  95, 166, 179,  76,  64, 214, 178, 101,  32,
+     149, 177, 109, 160, 149, 174, 125, 223, 137, 172, 125,  62, 136, 163, 124, 222,
+      72, 166, 108,  62, 131, 151, 122, 162,  66, 150, 104,  14 };
+
+constexpr byte Sound_C3_NAPPE [100] PROGMEM = {
+       0, 100,  47,  45, 140, 183,  56,   1, 140, 183,  59,  33, 140, 183,  59, 163,
+     140, 183,  60, 193, 140, 183,  61,  66, 140, 184,  69,  65, 152, 213,  86,  34,
+     164, 214, 151,  32, 160, 213, 175,  62, 160, 181, 191,  63,  97, 180, 190, 191,
+      97, 180, 190, 223,  96, 179, 174,  95,  96, 177, 125,  59,  64, 182, 128, 112,
+      64, 182, 128, 112,  84, 179,  72, 112, 168, 178, 109, 176, 185, 178, 124, 128,
+     185, 178, 149, 188, 169, 179, 149,  62, 168, 179, 149,  63,  88, 177, 124,  33,
+     148, 177, 128,  13 };
+
+constexpr byte Sound_C3_OUVRE_BOITE [164] PROGMEM = {
+       0, 164,  47,  47, 157, 176,  80,   0, 157, 175,  84,  47, 157, 175,  85,  37,
+     157, 174,  86,  64, 158, 173,  85, 162, 154, 172,  77,  63,  64, 171,  84,  32,
+     128, 211,  67, 189, 148, 214,  52,  53,   0, 182,   5,  37,  64, 180,  68, 190,
+     129, 174,  83, 160, 130, 205,  99, 223, 215, 173, 117,  33, 235, 174, 126, 161,
+     250, 177, 127,  94, 234, 176, 102,  61, 161, 176,  52,  61, 149, 174,  56,  16,
+     144, 173,  48,  48,  36, 160,   0,  80,  64, 180,  84,  57, 128, 174, 100,  35,
+     218, 171, 125, 223, 153, 173, 142, 191, 125, 175, 150, 188, 249, 176, 166,  32,
+     249, 179, 174,  64, 248, 180, 165, 189, 248, 180, 157,  63, 233, 180, 128,  16,
+     128, 181, 128,  80,  64, 185, 152, 112,  64, 185, 152, 112,  20, 217, 244, 176,
+      21, 214, 180,  48, 200, 176, 123,  65, 192, 179, 130, 161,  68, 177, 106, 165,
+     148, 178,  96,  14 };
+
+constexpr byte Sound_C3_PELLE [100] PROGMEM = {
+       0, 100,  47,  47,  64, 183,  96,   0,  21, 183, 164, 144,  85, 182, 132, 143,
+     232, 181, 151,  42, 245, 182, 151,  32, 245, 182, 151, 190, 245, 183, 143, 222,
+     245, 183, 135,  94, 180, 183, 126, 189, 184, 183, 118,  93, 252, 182, 101, 190,
+     252, 182, 109,  94, 252, 182, 108, 191, 248, 182, 108,  32, 248, 181,  99, 192,
+     252, 181,  99, 223, 248, 181,  99,  64, 232, 180, 115, 223, 169, 179, 115,  32,
+      96, 211, 107,  63,  80, 178,  82, 192, 100, 178,  73, 192,  80, 211,  49,  15,
+      80, 179,  48,  12 };
+
+constexpr byte Sound_C3_PLACARD [128] PROGMEM = {
+       0, 128,  47,  47, 192, 181,  80,   0,   0, 151, 253,  48,  96, 150,  85,  46,
+     184, 182,  93,  63, 172, 181, 102,  32, 232, 181, 151,  32, 224, 181, 166, 191,
+     128, 150, 149, 160,  81, 151,  85,  32,  64, 152, 128,  16, 128, 183, 160,  80,
+     129, 215, 136, 112,   8, 185, 182,  48, 196, 217,  84,  49, 224, 184, 126, 190,
+     229, 183, 151,  35, 249, 182, 166, 189, 233, 180, 182, 190, 169, 180, 190, 223,
+     248, 179, 190,  95, 232, 179, 189,  32, 168, 179, 188, 160, 148, 178, 189,  64,
+     148, 178, 188, 190, 164, 177, 179, 160,  84, 176, 147,  32, 161, 176, 147,  64,
+      85, 175, 114, 160,  84, 175, 122,  32,  84, 175, 121, 166,  84, 175, 120,  14 };
+
+constexpr byte Sound_C3_PLAFOND [100] PROGMEM = {
+       0, 100,  47,  47,  80, 182, 112,   0,  32, 182,   4,  15, 100, 150,  84, 134,
+     184, 182,  93, 161, 172, 181, 110,  33, 232, 181, 151,  63, 245, 181, 167,  63,
+     228, 181, 166, 160, 144, 149, 141,  33, 149, 180,  92, 160, 149, 213, 124, 176,
+      21, 214, 173, 112,   5, 214, 213, 176,  21, 182, 189, 176,   5, 182, 221,  80,
+      85, 180, 101,  80,  64, 177, 115,  17, 238, 170, 123, 219,  93, 166, 139, 191,
+      72, 163, 147,  63,  40, 162, 131,  32,  40, 162, 130, 190, 130, 150, 130,  35,
+     130, 119, 128,  14 };
+
+constexpr byte Sound_C3_PLAT [60] PROGMEM = {
+       0,  60,  47,  47, 128, 214, 104,   0,   0, 119, 252,  48,  85, 150,  92, 143,
+     101, 181,  93, 164, 172, 181,  86,  64, 172, 180,  93, 192, 232, 180, 134,  63,
+     232, 180, 167,  61, 233, 179, 183,  61, 233, 178, 191,  93, 169, 177, 190, 190,
+     169, 177, 190,  61, 180, 177, 181, 160,  96, 176, 152,  13 };
+
+constexpr byte Sound_C3_POELE [112] PROGMEM = {
+       0, 112,  47,  47,   0, 178,   0,   0,  65, 152, 253, 176,   0, 183, 132,  16,
+      64, 176, 132,  47, 150, 170, 108, 160, 154, 171, 109,  32, 170, 172, 125, 191,
+     234, 175, 142, 160, 234, 176, 150, 190, 234, 179, 167,  95, 170, 179, 175,  62,
+     165, 180, 175,  94, 169, 180, 182, 189, 186, 180, 174, 222, 249, 180, 166,  60,
+     164, 180, 149,  63, 164, 180, 116, 191, 168, 181, 123, 191, 152, 180,  99,  32,
+     232, 181,  99,  63, 232, 181,  91,  64, 236, 181,  83,  64, 220, 180,  82,  64,
+     133, 180, 115, 160, 152, 179, 139, 192, 164, 178, 122, 194, 164, 178, 112,  14 };
+
+constexpr byte Sound_C3_POUBELLE [120] PROGMEM = {
+       0, 120,  47,  47, 128, 185, 144,   0,   0, 179, 157, 176,  16, 182, 180, 144,
+     128, 139,  91,  47, 129, 167,  74, 195,  32,  96,   2, 223, 128, 133,  72,  48,
+      69, 171,  32,  80, 128, 181,  50,  17,  85, 179,  93,  60, 170, 180, 118, 191,
+     169, 181, 135,  58, 181, 182, 135,  94, 249, 182, 143,  95, 249, 182, 142, 223,
+     185, 182, 126, 192, 185, 182, 118,  63, 245, 182, 109,  32, 253, 181, 109, 192,
+     249, 181, 101,  64, 250, 181, 100, 191, 254, 181, 100, 192, 250, 180, 100,  64,
+     249, 180, 108, 191, 228, 181, 116,  32, 169, 180, 123, 160, 169, 180, 123,  62,
+     185, 179, 114,  37, 250, 179, 112,  15 };
+
+constexpr byte Sound_C3_RADIATEUR [160] PROGMEM = {
+       0, 160,  40,  47,  37, 177, 128,   0,  37, 177, 125, 176, 100, 178, 124, 139,
+     165, 178, 158,  33, 169, 178, 174, 163, 234, 179, 175,  33, 248, 181, 158, 160,
+     164, 182, 126,  63,  64, 182, 123, 160,  65, 181, 123,  33,  80, 118, 130, 160,
+      65, 185, 112,  48,  66, 219,  67, 191, 236, 217,  77,  33, 233, 216,  94, 162,
+     245, 183, 119,  63, 245, 182, 135,  94, 245, 182, 126, 191, 224, 182,  91, 187,
+     209, 150, 112,  48, 208, 214, 104,  80, 134, 180, 112, 112,   5, 180, 117, 144,
+      10, 183,  85, 176, 234, 181, 101, 160, 250, 180, 126, 189, 169, 180, 134,  94,
+     254, 179, 142,  64, 186, 179, 134,  94, 249, 179, 133, 160, 246, 179, 133,  32,
+     234, 179, 140, 192, 233, 180, 132, 192, 233, 148, 124, 192, 148, 180, 116,  64,
+     224, 146,  99,  62, 224, 146,  98, 160, 168, 177,  82, 192, 121, 177,  88,   9 };
+
+constexpr byte Sound_C3_REFRIGERATEUR [184] PROGMEM = {
+       0, 184,  47,  47, 182, 178,  96,   0, 165, 180, 108,  63, 229, 181, 117,  39,
+     216, 181, 125, 167, 228, 182, 134, 165, 228, 183, 126, 165, 229, 183, 118, 161,
+     224, 184, 101, 191, 228, 183,  84, 189, 165, 215,  92, 164,  32, 214,   6,  80,
+     114, 213, 125, 176,  32, 215, 165, 208, 149, 216,  93,  48, 224, 186,  76,  34,
+     197, 185,  68,  94, 209, 186,  68, 190, 208, 217,  76, 221, 100, 218,  44, 190,
+      84, 218,  12, 160, 213, 182,  93,  65, 225, 183, 101, 192, 208, 183, 101,  62,
+     181, 182,  93,  58, 102, 181, 100,  48, 150, 181,  84,  37, 149, 179, 133, 191,
+     169, 179, 166, 189, 170, 179, 167,  62, 165, 180, 142, 190, 232, 180, 125, 160,
+     144, 179,  99,  51, 128, 177, 144,  80, 128, 215, 120, 112,  20, 183, 165, 176,
+      21, 214, 164, 176, 169, 180, 117, 195, 249, 180, 125,  94, 249, 180, 124, 192,
+     253, 180, 124, 224, 232, 180, 123, 255, 168, 148, 116,  64, 216, 146, 107,  64,
+     133, 178, 107,  67,  69, 177,  96,  12 };
+
+constexpr byte Sound_C3_RIDEAU [104] PROGMEM = {
+       0, 104,  47,  47,  37, 177,  56,   0,  38, 178,  93, 156,  33, 178,   5, 160,
+      33, 181,  62, 176,  18, 182,   5, 128, 228, 217,  86, 200, 228, 217,  71,  33,
+     245, 217,  63,  64, 229, 216,  54,  32, 208, 185,  52, 191, 133, 153,  52,  60,
+     145, 152,  43, 185, 192, 215,  40,  80,   2, 214,  21,  16,  21, 214,  94,   7,
+     165, 181,  93, 189, 213, 177, 109, 222, 153, 174, 101,  62, 201, 173, 124, 190,
+      69, 170, 116, 191, 154, 170, 100,  32, 137, 168,  99, 191, 213, 168,  91, 160,
+     197, 162,  99,  64, 132, 168,  80,  13 };
+
+constexpr byte Sound_C3_ROBINET [128] PROGMEM = {
+       0, 128,  45,  47,  22, 204,  88,   0,  21, 162,   3, 186, 150, 170, 115, 174,
+     217, 171, 124, 167, 170, 171, 125, 165, 190, 172, 126,  34, 254, 173, 109, 160,
+     165, 173,  67, 185, 224, 172,  66, 140, 208, 174,  64,  48, 128, 170,  56,  80,
+      16, 192,   3, 145, 153, 183,  77,  37, 229, 184,  61, 160, 228, 217,  61,  32,
+     228, 249,  60, 160, 228, 249,  52,  62, 200, 145,  51, 222, 197, 146,  60,  63,
+     152, 215,  60, 220, 140, 182,  60, 221, 136, 183,  69,  32, 228, 183,  93, 190,
+     233, 183, 110,  63, 168, 184, 110, 223, 232, 184, 126,  95, 228, 184, 117,  32,
+     144, 217,  99, 160, 208, 185,  75, 192,  68, 153,  42, 160,  68, 151,  24,  15 };
+
+constexpr byte Sound_C3_SALADIER [136] PROGMEM = {
+       0, 136,  47,  47,  26, 213,  56,   0,   9, 213,   4,  48,   9, 216, 132, 112,
+      10, 214, 140, 240, 169, 213, 100,  15, 232, 181, 134,  46, 248, 181, 159,  63,
+     248, 182, 159, 223, 248, 182, 151,  32, 232, 181, 118,  32, 248, 182, 126, 191,
+     248, 182, 151,  63, 248, 182, 151,  62, 248, 182, 151, 189, 248, 183, 127,  95,
+     168, 215, 109, 191, 164, 215,  88,  16, 146, 183, 120,  65, 145, 151, 133,  16,
+     145, 215, 123, 177, 132, 220,  92, 192, 212, 217,  45,  95, 228, 249,  53,  61,
+     212, 249,  68, 192, 232, 217,  68, 160, 245, 217,  76, 160, 245, 216,  93,  63,
+     229, 184,  92, 192, 212, 185,  92,  95, 224, 216,  83, 160, 224, 217,  83,  32,
+     224, 217,  74, 168, 208, 185,  80,   9 };
+
+constexpr byte Sound_C3_SALLE_A_MANGER [128] PROGMEM = {
+       0, 128,  47,  47, 106, 214,  88,   0,  90, 215, 124,  16,  90, 215, 172, 208,
+      26, 215, 140, 240, 148, 214, 100, 143, 168, 181, 134, 169, 248, 181, 159,  32,
+     232, 181, 159, 223, 232, 180, 126, 160, 168, 181, 126,  33, 168, 181, 143,  33,
+     164, 181, 159,  64, 169, 178, 142, 160, 152, 176,  69,  95, 136, 177,  68, 192,
+      86, 170, 125, 160,  69, 168, 141,  63,  17, 165, 141,  64,  16, 196, 149, 161,
+       8, 202, 149, 192,  72, 176, 133,  62, 148, 179, 117,  94, 100, 218,  45, 164,
+      84, 218,  13,  32, 148, 182, 101, 221, 228, 182, 101, 221, 229, 183, 100, 192,
+     225, 183, 100,  95, 224, 152,  91, 191, 225, 184,  75,  34, 201, 153,  80,   1 };
+
+constexpr byte Sound_C3_SALLE_DE_BAIN [148] PROGMEM = {
+       0, 148,  47,  47, 106, 214,  88,   0,  10, 215, 125,  80,  10, 216, 180, 240,
+      26, 215, 173, 112,  84, 182, 117,  15, 168, 181, 135,  42, 228, 181, 151, 223,
+     232, 181, 135,  63, 248, 181, 109, 194, 232, 181,  93,  32, 168, 181,  84, 190,
+     152, 181,  76,  63, 213, 214,  76,  32, 128, 183,  88,  48, 128, 151,  48,  80,
+      85, 214,  36, 185, 150, 181,  93, 164, 234, 180, 102, 192, 234, 179, 102, 190,
+     170, 179,  94,  61, 170, 178,  60, 189, 198, 145,  72,  56, 192, 180,  48, 112,
+     209, 181,  68, 128, 105, 179, 117,  32, 169, 179, 133, 129, 105, 179, 150, 160,
+     105, 179, 159,  63, 121, 179, 166, 223, 121, 179, 157, 190, 101, 178, 132, 160,
+      80, 177, 107, 160,  80, 177,  98, 190,  96, 177, 106, 160,  80, 177, 114,   6,
+      84, 178,  96,  14 };
+
+constexpr byte Sound_C3_SALON [104] PROGMEM = {
+       0, 104,  47,  47,  85, 214,  48,   0,  74, 216,  85, 144, 106, 214, 101, 176,
+     154, 215, 101, 176,  74, 214, 101, 208,  26, 213, 133, 240,  84, 182,  92,  21,
+     232, 181, 135,  47, 232, 181, 151, 165, 228, 181, 167, 191, 228, 181, 167, 192,
+     228, 181, 159,  62, 177, 182, 149, 160, 212, 213, 101,  63, 196, 213,  93,  32,
+     228, 181,  76, 221, 165, 149,  60, 190, 148, 180, 101, 191, 234, 178, 118,  61,
+     255, 176, 125, 190,  73, 172, 133, 192, 131, 185, 132, 223, 130, 118, 116,  63,
+      66, 172,  91, 191, 130, 151,  96,  15 };
+
+constexpr byte Sound_C3_SERPILLIERE [164] PROGMEM = {
+       0, 164,  46,  47, 171, 214, 136,   0,  91, 214, 180, 144,  11, 214, 252, 208,
+      11, 214, 132, 176,  91, 215, 156,  80,  27, 216, 252,  80,  27, 215, 164, 208,
+     228, 183, 101,  47, 232, 183, 110, 170, 148, 183, 126,  94, 161, 181, 109,  59,
+     149, 181, 108,  34, 149, 180, 112,  16, 128, 216,  88,  80, 192, 153, 120, 112,
+      16, 181, 253,  16,  24, 184,   5, 176, 217, 217,  60,  63, 228, 249,  52, 221,
+     228, 249,  52,  61, 226, 217,  59, 189, 196, 250,  51,  32, 196, 216,  43,  95,
+     244, 217,  60, 189, 244, 216,  85, 191, 248, 216, 102, 190, 248, 183, 126, 189,
+     244, 183, 133, 223, 228, 182, 142,  64, 245, 182, 142,  64, 245, 183, 141,  64,
+     229, 183, 125,  64, 229, 183, 117,  95, 229, 183, 117,  64, 233, 183, 124, 192,
+     169, 181, 116, 192, 148, 179, 107, 160, 148, 179,  83,  32, 101, 178,  66, 162,
+      25, 178,   0,  15 };
+
+constexpr byte Sound_C3_SERVIETTE [140] PROGMEM = {
+       0, 140,  47,  47,  78, 214, 144,   0,  78, 214, 149,  80,  14, 216, 164, 240,
+      14, 216, 109, 112, 233, 184,  76,  15, 228, 184, 102,  44, 228, 184, 118, 221,
+     228, 182, 109,  60,  65, 181,  92,  62,  16, 179, 124,  61, 161, 180, 115, 189,
+      80, 214,  67, 170, 144, 184,  67, 160, 193, 183,  67, 220, 209, 185,  60,  65,
+     233, 217,  35, 223, 212, 217,  51,  62, 249, 217,  68, 160, 248, 217,  77, 160,
+     249, 184, 109, 223, 224, 184, 108,  61, 208, 184, 107, 223, 224, 184,  91,  63,
+     225, 184,  66, 160, 193, 183,  96,  16, 128, 187,  96,  80, 192, 184, 104, 112,
+       0, 183, 240,  96,   0, 217, 220, 160,  81, 183, 147,  32, 234, 182,  99, 159,
+     217, 180, 115,  95,  68, 178, 106,  35, 132, 176, 104,  12 };
+
+constexpr byte Sound_C3_SOL [84] PROGMEM = {
+       0,  84,  47,  47, 228, 213,  96,   0, 153, 214, 100, 240,  21, 214,   4, 240,
+      26, 212,   4, 240, 153, 212, 100,  15, 248, 179, 118, 172, 245, 177, 142, 223,
+     164, 177, 151,  62, 164, 176, 151,  94, 233, 179, 134, 219, 152, 180, 118, 222,
+     232, 180, 126,  62, 168, 180, 109, 223, 169, 180, 109,  95, 169, 180, 100, 192,
+     168, 180, 108, 160, 105, 180, 116, 191, 106, 180, 107, 160,  17, 146,  58, 163,
+      81, 178,  88,  13 };
+
+constexpr byte Sound_C3_TAPIS [96] PROGMEM = {
+       0,  96,  47,  47,  64, 183,  88,   0,  32, 214, 205,  48, 160, 182, 124, 143,
+     248, 182, 134, 169, 248, 182, 151,  62, 228, 181, 159,  62, 224, 181, 142,  32,
+     164, 181, 116,  59, 224, 214, 138, 160, 224, 214, 136,  16, 144, 151, 160,  48,
+     129, 183, 120,  80, 128, 214,  88, 112,  21, 182, 116, 144,  36, 184,   6,  48,
+      41, 185,   5,  29, 233, 217,  60, 189, 249, 217,  52, 222, 248, 217,  43, 186,
+     228, 249,  43,  32, 213, 216,  34, 222, 152, 249,  26,  37, 133, 217,  32,  12 };
+
+constexpr byte Sound_C3_TIRE_BOUCHON [116] PROGMEM = {
+       0, 116,  47,  47,   4, 216,  88,   0,   4, 214, 181, 176, 216, 216,  68, 175,
+     229, 216,  77, 174, 230, 184,  94, 161, 234, 183, 111,  62, 230, 182, 118, 188,
+     165, 178,  93, 187,  80, 175, 108, 189, 129, 171,  99, 191, 128, 132,  64,  16,
+      32, 128,   0, 112, 129, 215,  50, 186, 129, 145, 108,  34, 130, 173, 100, 192,
+     130, 142,  92,  64,  66, 146,  75, 190, 192, 180, 252, 176, 132, 184, 254,  80,
+      96, 186, 254, 112,  16, 217, 254, 112, 144, 176, 116, 221,  90, 170, 140,  94,
+      74, 167, 139, 190,  25, 163,  91, 160,  72, 167,  99,  32,  44, 160,   2, 160,
+      40, 160,  72,   6 };
+
+constexpr byte Sound_C3_TOILETTE [132] PROGMEM = {
+       0, 132,  41,  47,  64, 216,  72,   0,  21, 216,  84, 144,  21, 214, 142,  48,
+      17, 117, 253, 144,  82, 181,  76, 143, 145, 144,  84,  36, 146, 173,  92, 160,
+     150, 173, 101, 162, 170, 174, 126, 161, 185, 177, 143,  32, 166, 180, 143, 160,
+     165, 181, 135,  63, 232, 181, 118,  60, 248, 182, 109, 222, 248, 182, 127,  61,
+     248, 182, 143,  32, 184, 182, 143,  91, 185, 182, 142, 190, 249, 183, 125, 192,
+     208, 215, 112, 112, 192, 217, 120, 112, 192, 217, 120, 112,   0, 216, 188, 144,
+       0, 184, 252, 176,   1, 213, 141,  48, 149, 180, 107,  38, 169, 180, 124,  32,
+     169, 179, 140,  62, 232, 179, 140,  58, 224, 179, 139, 190, 133, 179, 106, 160,
+      81, 181,  88,  15 };
+
+constexpr byte Sound_C3_TOIT [76] PROGMEM = {
+       0,  76,  47,  47,  64, 216,  72,   0,  21, 216,  84, 144,  21, 214, 142,  48,
+      17, 117, 253, 144,  82, 181,  76, 143, 145, 144,  84,  36, 145, 171,  83,  62,
+     150, 169,  92,  32, 134, 165, 117,  33,  86, 169, 125, 160, 214, 173, 142,  32,
+      85, 175, 174,  95, 105, 174, 173, 186, 164, 174, 165,  62, 113, 174, 149,  62,
+      97, 174, 123, 190, 163, 174, 114, 189, 162, 174, 120,  13 };
+
+constexpr byte Sound_C3_VAISSELLE [120] PROGMEM = {
+       0, 120,  47,  47,  76, 178,  64,   0, 106, 180,  98, 145, 148, 180,  91,  60,
+     128, 181,  83, 165, 149, 183,  76,  39, 170, 183, 102, 168, 249, 184,  95,  66,
+     232, 184,  94,  32, 233, 183,  77,  32, 217, 216,  84, 191, 148, 215,  84,  32,
+     164, 215, 100,  65,  16, 184, 125,  80,  81, 215, 125, 112, 217, 182,  84,  32,
+     249, 181, 118,  32, 249, 182, 134, 182, 245, 182, 142, 189, 181, 182, 134, 222,
+     245, 183, 134,  95, 185, 182, 118,  95, 254, 182,  93, 223, 250, 182, 101, 192,
+     250, 181, 101, 192, 249, 181, 100, 160, 249, 181,  92,  32, 250, 181,  91, 192,
+     251, 181,  90, 162, 235, 181,  88,  15 };
+
+constexpr byte Sound_C3_VOLET [88] PROGMEM = {
+       0,  88,  47,  47, 212, 179,  80,   0, 144, 182,  74, 187, 148, 182,  75,  32,
+      64, 180,  83, 173,  80, 175, 108, 165, 233, 173, 109, 164, 234, 173, 118,  35,
+     234, 175, 118, 161, 170, 178, 119,  64, 169, 148, 110, 188, 164, 181,  94, 189,
+     188, 181,  78,  91, 186, 181,  61, 191, 249, 182, 102,  32, 249, 182, 126, 189,
+     249, 183, 127,  62, 233, 183, 126, 222, 169, 183, 110, 223, 245, 183, 117, 160,
+     228, 184, 116, 161, 224, 184, 104,  14 };
+
+constexpr byte Sound_C3_AVEC [104] PROGMEM = {
+       0, 104,  47,  47,  20, 179, 184,   0, 148, 180, 181,  12, 165, 179, 182, 160,
+     168, 179, 183,  34, 168, 180, 159,  64, 169, 180, 142,  32, 168, 179, 117,  61,
+     212, 179, 108,  32,  85, 182,  68, 186,  85, 182,  92,  63, 153, 180,  84,  63,
+     101, 181, 100, 191, 185, 181, 125, 160, 249, 181, 134,  32, 249, 182, 134,  94,
+     181, 183, 126,  95, 229, 183, 125, 191, 229, 184, 101,  35, 160, 152,  83, 168,
+     208, 183,  96,  80, 209, 215, 112, 112,   0, 182,   0, 112,   4, 186, 205, 176,
+       8, 185, 252,  80,   8, 183, 248,   0 };
+
+constexpr byte Sound_C3_CEINTURE [168] PROGMEM = {
+       0, 168,  47,  47, 168, 181, 104,   0, 155, 215, 164, 208,  27, 214, 148, 112,
+     212, 179, 100,  15, 228, 179, 133, 174, 228, 180, 142, 191, 229, 180, 143,  32,
+     228, 180, 143,  63, 208, 180, 134,  63, 208, 181, 117,  62, 192, 180,  83,  56,
+     144, 212,  72,  80,   1, 218,  56, 112,  33, 187, 148, 176,  17, 184, 229,  80,
+     162, 184,  68, 189, 161, 183,  69, 188, 113, 183,  61, 160, 113, 183,  77, 192,
+     177, 183,  78,  95, 177, 183,  77, 190, 113, 183,  77, 224, 241, 183,  85,  95,
+     225, 151,  84, 191, 229, 150,  84, 192,  85, 148,  76,  63,  85, 179, 100, 190,
+      97, 177, 108,  62, 161, 209,  91,  63,  97, 209,  88,  16,  96, 210,  88,  48,
+      33, 210,  11,  64,  69, 175, 147,  64, 153, 175, 107, 167, 101, 176, 140, 188,
+     165, 176, 123, 191, 165, 175, 115,  32, 153, 175,  82, 191,  89, 176,  42, 191,
+      21, 176,   2,  37,  21, 177,   0,  13 };
+
+constexpr byte Sound_C3_CHAPEAU [92] PROGMEM = {
+       0,  92,  47,  47,   0, 185,   0,   0,   5, 184, 254, 208,   5, 187, 255, 112,
+      74, 186, 254, 208, 218, 181, 118,  47, 229, 180, 151,  66, 160, 179, 158, 191,
+     213, 145, 141, 191, 128, 142, 124,  63, 128, 180, 144,  48, 128, 184, 128, 112,
+     128, 181, 104, 112,   1, 151, 253,  48,   0, 117, 243, 176,  69, 171, 100,  49,
+     222, 169, 108,  59, 174, 168,  83, 223, 237, 166,  91,  62, 222, 167,  99,  95,
+     217, 165,  98,  63, 153, 166,  98,  36, 148, 168,  72,  14 };
+
+constexpr byte Sound_C3_CHAUSSETTE [116] PROGMEM = {
+       0, 116,  47,  47,   5, 183, 112,   0,  17, 219, 126, 144,  21, 219, 150, 176,
+       5, 187, 254, 208,  24, 218, 254, 240, 132, 186, 101, 175, 229, 176, 101,  37,
+     230, 176, 109,  95, 214, 176, 100, 188, 229, 214, 109, 240,  25, 182,  69, 240,
+     228, 181, 126, 186, 245, 181, 143, 182, 245, 182, 143,  63, 240, 182, 142, 191,
+     245, 182, 126, 222, 245, 182, 110,  61, 208, 216, 120, 112, 192, 182, 128, 112,
+      85, 181, 112, 112,  21, 182, 165,  48,  16, 214, 165,  48, 212, 179, 116,  36,
+     213, 178, 108,  62, 128, 214, 123, 190, 132, 178, 107, 191, 144, 179, 114, 165,
+     164, 179,  96,  14 };
+
+constexpr byte Sound_C3_CHAUSSURE [128] PROGMEM = {
+       0, 128,  47,  47,  66, 182, 112,   0,  17, 216, 118,  16,  85, 217, 167,  48,
+      33, 186, 254, 240, 149, 178, 102,  47, 134, 177,  94, 196, 214, 176,  85,  60,
+     197, 210,  84, 177,  73, 214,  77,  63,   8, 213,   6,  16,  88, 214,  70,  48,
+      41, 215,  37, 240, 104, 215,  69, 240, 164, 183,  69,   5, 180, 183,  69, 191,
+     165, 151,  70,  62, 177, 183,  70,  95, 161, 151,  69, 222, 113, 183,  70,  62,
+     177, 183,  77, 192, 241, 151,  69,  62, 177, 183,  77, 160, 177, 183,  78,  64,
+     241, 151,  77,  62, 225, 151,  84, 160, 213, 150,  92,  63, 196, 149, 100,  32,
+     132, 176,  99, 192, 101, 176,  91, 190,  86, 176,  99, 165,  37, 174,  96,  15 };
+
+constexpr byte Sound_C3_CHEMISE [124] PROGMEM = {
+       0, 124,  47,  47,  22, 182, 112,   0, 116, 218, 166, 176,  20, 217, 150,  80,
+       5, 187, 254, 112,  65, 183, 252, 143, 212, 181, 100, 173, 230, 148, 109, 190,
+     214, 148, 109, 191, 133, 115,  92, 191, 192, 114,  75, 160, 201, 112,  67,  64,
+     200, 146,  59, 221, 133, 152,  61, 188, 132, 213,  69, 190, 132, 246,  77, 222,
+     132, 247,  69,  94, 132, 214,  77,  94, 137, 211,  68, 192, 132, 183,  68,  62,
+     208, 185,  68,  64, 154, 183,  43, 160,  69, 185,  35, 160,  85, 182,  51, 160,
+     213, 181,  75, 160, 229, 180,  91, 161, 233, 180, 115, 190, 164, 180, 115, 191,
+      80, 212,  75,  62,  97, 179,  42, 166,  80, 178,   8,  15 };
+
+constexpr byte Sound_C3_CHEMISE_DE_NUIT [164] PROGMEM = {
+       0, 164,  47,  47,  22, 182, 112,   0, 116, 218, 166, 176,  20, 217, 150,  80,
+       5, 187, 254, 112,  65, 183, 252, 143, 212, 181, 100, 173, 230, 148, 109, 190,
+     214, 148, 109, 191, 133, 115,  92, 191, 201, 112,  67,  64, 200, 146,  59, 221,
+     133, 152,  61, 188, 132, 213,  69, 191, 132, 247,  69,  64, 132, 214,  77,  95,
+     137, 211,  68, 223, 208, 185,  67, 223, 213, 183,  67,  64, 107, 181,  48,  33,
+     107, 181,  53,  36, 171, 181,  86, 163, 235, 181,  95,  64, 234, 181,  94, 160,
+     230, 181,  86,  61, 212, 180,  56,   0, 212, 180,  56,   0, 212, 180,  59,  32,
+     216, 179,  52,  63, 216, 182,  60, 222, 148, 214,  52, 192, 152, 182,  60,  63,
+     196, 177,  60,  32, 144, 216,  60, 189, 176, 152,  69,  95, 177, 151,  68, 223,
+     240, 184,  59, 223, 212, 216,  59, 160, 217, 216,  51, 192, 217, 216,  67, 164,
+     217, 216,  56,  13 };
+
+constexpr byte Sound_C3_CUBE [88] PROGMEM = {
+       0,  88,  47,  47,  84, 183,  96,   0,  32, 183, 157, 176,  32, 248, 173,  16,
+      32, 153, 196, 176, 178, 184,  52, 175, 231, 152,  61,  37, 247, 151,  61,  64,
+     246, 151,  53,  91, 162, 151,  61,  60, 225, 183,  60, 188, 144, 119,  32, 112,
+     132, 179,  24, 112, 149, 179,  66, 178, 245, 179, 116,  37, 169, 178, 125,  32,
+     238, 179, 134,  63, 254, 178, 141, 190, 249, 179, 141,  63, 165, 178, 107, 160,
+     165, 177,  75,   9, 169, 177,  64,  13 };
+
+constexpr byte Sound_C3_CUILLERE [112] PROGMEM = {
+       0, 112,  47,  47,  68, 182, 120,   0,   8, 182,   6, 176,   4, 151, 133,  16,
+      32, 184,   4, 176, 100, 183,   4, 175, 234, 152,  60, 196, 224, 216,  60, 223,
+     225, 249,  60,  92, 232, 248,  52, 221, 228, 217,  61,  61, 245, 217,  70,  32,
+     244, 216,  94, 190, 249, 184, 118, 188, 229, 183, 126, 160, 229, 183, 142, 222,
+     245, 183, 142, 192, 249, 183, 134, 190, 249, 183, 142, 223, 249, 183, 134,  63,
+     248, 183, 141, 160, 249, 183, 133, 192, 229, 183, 133, 223, 229, 183, 133,  64,
+     229, 151, 124, 191, 232, 151, 124,  64, 197, 150, 123, 168, 213, 150, 120,  12 };
+
+constexpr byte Sound_C3_CUILLERE_A_DESSERT [204] PROGMEM = {
+       0, 204,  47,  47,  64, 183, 104,   0,   4, 185, 254, 176,  16, 218, 172, 176,
+      32, 186, 252, 176, 181, 184,  60, 175, 246, 184,  60, 164, 247, 184,  61,  61,
+     235, 216,  61,  32, 234, 216,  53,  32, 245, 216,  53,  95, 229, 216,  61,  33,
+     229, 216,  70,  33, 229, 184, 102, 160, 233, 184, 111,  64, 233, 183, 127,  95,
+     233, 182, 118,  61, 165, 180, 125,  48, 148, 180, 125,  61, 169, 179, 150,  33,
+     169, 178, 166, 191, 153, 178, 166, 192, 169, 180, 158, 223, 232, 180, 134,  62,
+     144, 180, 100, 189, 148, 179,  84,  63, 144, 214,  67,  63, 144, 214,  64,  64,
+     233, 183,  93, 166, 233, 183, 102,  63, 233, 184, 102,  95, 229, 184,  93, 191,
+     237, 184,  85,  62, 169, 184,  68,  32, 119, 215,  93,  48,  22, 215,  76, 240,
+      21, 182,   4, 240, 218, 181,  92,  13, 253, 181, 117, 184, 228, 181, 125,  61,
+     229, 181, 142,  62, 245, 182, 142,  95, 228, 182, 141,  63, 228, 182, 132, 191,
+     192, 183, 132,  62, 208, 182, 139, 192, 228, 183, 132,  64, 229, 183, 123, 223,
+     232, 183, 114, 160, 224, 183, 113, 169, 224, 183, 104,  13 };
+
+constexpr byte Sound_C3_CUILLERE_A_SOUPE [168] PROGMEM = {
+       0, 168,  47,  47,  64, 183, 104,   0,   4, 185, 254, 176,  16, 218, 172, 176,
+      32, 186, 252, 176, 181, 184,  60, 175, 246, 184,  60, 164, 247, 184,  61,  61,
+     235, 216,  61,  32, 234, 216,  53,  32, 245, 216,  53,  95, 229, 216,  61,  33,
+     229, 216,  70,  33, 229, 184, 102, 160, 233, 184, 111,  64, 233, 183, 127,  95,
+     233, 182, 118,  61, 165, 180, 125,  48, 148, 180, 125,  61, 169, 179, 150, 161,
+     169, 178, 166, 191, 169, 178, 167,  62, 164, 180, 142, 223, 164, 180, 116, 191,
+     150, 181, 125,  48,  22, 215, 117, 112,  20, 215, 132, 240,  64, 185, 252,  48,
+     129, 183,  75,  60, 193, 169,  74, 221, 149, 167,  58,  94, 129, 168,  57, 191,
+     208, 180,  72, 112, 192, 182,  72, 112, 192, 182,  72, 112,  84, 178, 117,  48,
+     185, 177, 107,  31, 232, 176, 123,  32, 165, 177, 139, 223, 217, 177, 147,  32,
+     164, 177, 130, 168, 100, 177, 136,  13 };
+
+constexpr byte Sound_C3_DERRIERE [140] PROGMEM = {
+       0, 140,  47,  47, 128, 119,  32,   0,   0, 182,   5,  48,  86, 181,  85, 171,
+     248, 183, 118, 160, 248, 183, 127,  32, 249, 183, 135,  63, 224, 183, 126, 160,
+     224, 183, 126,  32, 208, 183, 125, 160, 230, 181, 101,  93, 170, 214, 100, 193,
+     229, 215,  92, 190, 196, 185,  92, 160, 129, 187,  91, 186, 210, 186,  90, 191,
+     130, 186,  80,  48, 245, 217,  60,  60, 244, 217,  77,  33, 245, 216,  94,  32,
+     245, 183, 118, 190, 245, 183, 135,  37, 245, 182, 150, 222, 245, 182, 142,  95,
+     245, 183, 142,  95, 229, 183, 134,  63, 228, 183, 133, 160, 212, 183, 125,  63,
+     196, 151, 124, 160, 200, 152, 116,  32, 208, 151, 116,  64, 165, 181, 108,  64,
+     149, 180, 107, 191, 165, 179, 107, 141, 165, 179, 104,  15 };
+
+constexpr byte Sound_C3_DEVANT [108] PROGMEM = {
+       0, 108,  47,  47, 128, 119,  32,   0,   0, 182,   5,  16,  86, 181,  85, 171,
+     166, 180, 102, 162, 214, 180, 110, 162, 170, 179, 102, 192, 234, 179, 102,  32,
+     250, 179,  93, 190, 170, 178,  85,  61, 170, 178,  92, 187, 230, 178,  92,  61,
+     213, 178,  98, 160, 128, 181,  50, 160, 148, 182,  74, 160, 148, 214,  83, 160,
+      69, 178,  75, 160,  89, 175, 116, 186, 169, 174, 125,  32, 100, 173, 141,  95,
+     102, 204, 141,  95,  98, 172, 140, 190,  98, 172, 148,  32, 102, 171, 131, 191,
+     103, 171,  99,  62,  86, 168,  74,  38,  85, 168,  64,  14 };
+
+constexpr byte Sound_C3_DISTANCE [152] PROGMEM = {
+       0, 152,  40,  47, 128, 119,  32,   0,   0, 182,   5,  16,  86, 181,  85, 171,
+     200, 216,  60, 153, 216, 217,  52, 165, 216, 217,  52, 167, 196, 217,  60, 163,
+     208, 220,  60, 190, 132, 187,  44, 177, 153, 184,  68, 177,  86, 247,  68, 208,
+      86, 247,  76, 240,  80, 215,  72,  16,  80, 215,  72,  80,  81, 182, 149,  48,
+     144, 213, 100, 145, 213, 179, 125, 175, 149, 178, 134,  38,  85, 208, 142,  62,
+     164, 206, 133, 222,  96, 206, 133,  62,  97, 173, 117,  63,  97, 172, 133,  95,
+      97, 173, 132, 190,  97, 173, 124, 192,  84, 175, 116, 223,  96, 175, 107, 190,
+       5, 246, 124, 208,  85, 247, 140, 208,  21, 247, 116, 240,  21, 245,   4, 208,
+     153, 211,  92, 208, 196, 177, 115, 164, 192, 213, 123, 191, 128, 210, 115, 192,
+     101, 179,  26, 188,   0, 179,  80,  15 };
+
+constexpr byte Sound_C3_GANT [60] PROGMEM = {
+       0,  60,  47,  47, 145, 184,  40,   0,   8, 116, 253,  56,  32, 151,  93,  31,
+     160, 182,  93,  15,  81, 182, 118,  14, 154, 148, 135,  34,  90, 177, 159,  33,
+     154, 176, 159,  32, 166, 174, 158,  95, 102, 172, 150,  94, 102, 171, 141, 221,
+      37, 171, 124, 189, 117, 171, 115,  32, 100, 170, 120,  12 };
+
+constexpr byte Sound_C3_GILET [108] PROGMEM = {
+       0, 108,  47,  47,  16, 216,   0,   0,  16, 216,   2, 143,  20, 217,   4,   9,
+       1, 217,   4, 160,  17, 250,   4, 129, 153, 218,  69,  61, 209, 216,  53,  68,
+     212, 216,  52, 163, 192, 218,  60,  32, 128, 214,  60,  94, 196, 214,  60, 189,
+     216, 215,  52,  60, 224, 214,  61,  61, 245, 214,  61,  93, 229, 182,  85, 190,
+     249, 182, 102, 188, 249, 182, 102, 160, 249, 183, 126, 191, 249, 183, 126, 191,
+     245, 183, 126,  63, 245, 183, 117, 160, 229, 183, 109, 160, 208, 183, 100, 160,
+     208, 184, 100,  63, 208, 184, 108,  35, 212, 184,  80,  13 };
+
+constexpr byte Sound_C3_GRANDEUR [132] PROGMEM = {
+       0, 132,  47,  47,  32, 114,  72,   0,  32, 177,   4, 176, 165, 175, 108, 187,
+     106, 174, 100, 161, 146, 172, 124,  66, 105, 172, 140, 164, 106, 171, 141, 164,
+     106, 171, 133, 163, 170, 170, 133, 196, 181, 171, 133,  37, 178, 172, 125,  35,
+     245, 173, 125,  63, 229, 174, 117,  63, 236, 174,  75, 184, 212, 173,  66, 189,
+      65, 178,  40,  80,   0, 214, 118,  48, 233, 180, 109, 188, 249, 180, 126, 182,
+     169, 179, 134, 222, 250, 179, 142, 223, 233, 179, 134, 223, 249, 179, 142,  96,
+     248, 179, 141, 188, 248, 179, 133, 160, 248, 179, 133,  32, 232, 179, 123, 191,
+     212, 180, 123,  32, 181, 179,  67,  32, 165, 179,  83,  64,  85, 178,  99,  38,
+     150, 178,  80,  14 };
+
+constexpr byte Sound_C3_HAUTEUR [128] PROGMEM = {
+       0, 128,  47,  47, 248, 175, 128,   0, 169, 174, 133, 155, 238, 173, 126,  33,
+     217, 172, 126,  68, 154, 172, 126,  36, 153, 173, 119,  32, 250, 173, 110,  32,
+     230, 175, 100, 160, 145, 178,  76, 161, 192, 172, 112, 112,   1, 183, 168, 112,
+       1, 182,   6,  16,   1, 215, 150,  48,  85, 183, 101,  17, 233, 180, 126, 164,
+     233, 180, 142, 220, 229, 179, 150, 222, 185, 179, 142, 223, 233, 179, 142,  63,
+     229, 179, 141, 191, 153, 179, 133, 223, 228, 179, 133,  63, 224, 179, 124, 190,
+     224, 179, 124,  32, 197, 179, 132,  64, 212, 178, 115, 223, 229, 147,  99, 192,
+     169, 147, 107, 160, 164, 179, 115, 160, 152, 179,  99,  40,  84, 178,  88,  14 };
+
+constexpr byte Sound_C3_IMPERMEABLE [192] PROGMEM = {
+       0, 192,  43,  57, 169, 181, 128,   1, 180, 181, 151,   3, 165, 181, 159,  35,
+     164, 181, 167,  67, 164, 180, 150, 163, 148, 147, 117,  58,  81, 181, 131,  63,
+     128, 181, 120, 112, 101, 181, 132, 176, 213, 180,  92,  15, 229, 181, 126,  33,
+     245, 181, 134, 188, 232, 180, 134,  61, 212, 179, 141,  61, 154, 178, 100, 187,
+     150, 177, 100,  34,  70, 138, 116,  35, 148, 171,  75,  63, 216, 174,  67,  32,
+     216, 177,  60,  95, 165, 181, 110,  59, 165, 183, 126, 188, 233, 184, 126, 187,
+     229, 184, 118,  95, 245, 184, 118,  94, 181, 183, 134, 160, 165, 182, 159,  63,
+     169, 181, 174, 160, 233, 180, 175,  63, 250, 179, 182, 192, 186, 179, 174, 192,
+     249, 178, 165, 192, 250, 178, 157, 223, 250, 177, 124, 160, 169, 178,  80,  16,
+     144, 176,  40,  48,  84, 181,  64, 112, 100, 181, 100, 163, 168, 181, 101, 160,
+     252, 180, 100, 191, 236, 181, 100, 160, 253, 180, 101,  64, 253, 180, 133, 160,
+     190, 179, 141,  32, 185, 179, 132, 160, 168, 179,  99, 190, 185, 179,  88,  15 };
+
+constexpr byte Sound_C3_JUPE [80] PROGMEM = {
+       0,  80,  47,  47, 144, 216,  72,   0, 144, 216,  77,  67, 212, 182,  77, 165,
+     241, 182,  69, 196, 242, 182,  70,  32, 162, 150,  62,  92, 225, 150,  52, 182,
+     197, 118,  59,  32, 208, 214,  64, 112, 129, 181,  48, 112,  16, 181,  64, 112,
+     185, 114,  91, 160, 212, 113, 107, 191, 197, 114, 116,  63, 149, 114, 116, 223,
+     148, 114, 108,  63,  21, 115,  17, 162, 101, 114,  99,  32, 100, 114,  64,   4 };
+
+constexpr byte Sound_C3_LARGEUR [148] PROGMEM = {
+       0, 148,  47,  47, 248, 181, 136,   0, 248, 181, 108, 186, 253, 181, 117, 193,
+     232, 181, 150, 166, 244, 180, 183,  34, 169, 178, 183,  66, 148, 178, 166,  35,
+      85, 176, 109,  32,  80, 176, 100, 161, 101, 178,  76,  32, 101, 176,  51, 160,
+      85, 176,  43, 160, 150, 177,  59, 192, 150, 177,  68,  63, 132, 180,  84, 189,
+      16, 216,   4, 136,  20, 217,   4, 128,   1, 217,   4, 160,  17, 186,   4, 129,
+       5, 180, 109, 217,   4, 211, 109, 192, 153, 178, 125, 223, 233, 179, 142,  94,
+     233, 179, 141, 223, 232, 179, 141, 191, 228, 179, 124, 192, 228, 179, 124,  64,
+     244, 179, 116,  95, 224, 179, 123, 160, 228, 180, 124,  32, 228, 179, 131, 160,
+     233, 179, 115, 192, 153, 178,  91, 156, 136, 177, 123,  63, 136, 177, 122, 168,
+     216, 177, 120,  15 };
+
+constexpr byte Sound_C3_LOIN_DE [132] PROGMEM = {
+       0, 132,  47,  47, 164, 181,  80,   0, 244, 181,  75,  59, 245, 149,  67, 160,
+     245, 149,  68, 163, 246, 117,  68, 194, 186,  84,  60, 164, 246,  83,  68, 163,
+     169, 177, 101, 163, 214, 172,  93,  64, 138, 168, 109,  32,  41, 160,  93, 161,
+      73, 164, 142,  34,  90, 167, 134,  33, 170, 173, 134, 160, 166, 176, 151,  32,
+     166, 178, 159, 192, 165, 179, 159,  64, 161, 180, 151,  63, 160, 181, 134, 160,
+     148, 181, 109, 189, 140, 179,  68,  63,  67, 181,  83, 185, 129, 213,  72, 112,
+      65, 215, 101, 176, 149, 181,  93,  61, 233, 180, 102,  62, 165, 180, 110,  60,
+     165, 180, 101, 222, 169, 180, 109, 223, 165, 180, 101,  62, 196, 178,  91,  38,
+     196, 178,  96,  14 };
+
+constexpr byte Sound_C3_LONGUEUR [132] PROGMEM = {
+       0, 132,  47,  47, 253, 181,  80,   0, 249, 180,  77,  24, 165, 180,  85,  37,
+     165, 178, 126,  36, 250, 175, 125, 161, 154, 173, 126,  34,  73, 169, 134,  35,
+     137, 170, 142,  33, 136, 163, 133, 161, 136, 168, 101,  64, 140, 171,  84, 160,
+     140, 174,  68,  62, 136, 174,  51, 190, 132, 174,  58, 190,  20, 182,  40,  80,
+     161, 152,  85,  58, 230, 184,  94,  32, 229, 183, 110, 160, 229, 182, 126, 188,
+     249, 180, 134, 255, 169, 180, 142, 224, 233, 180, 142,  94, 233, 180, 133, 192,
+     244, 180, 133,  32, 228, 180, 132, 160, 169, 180, 125,  32, 165, 180, 125,  64,
+     149, 179,  91, 160, 144, 212,  99,  63,  64, 178, 106, 160, 168, 177, 106, 165,
+      36, 178,  88,  14 };
+
+constexpr byte Sound_C3_MANTEAU [104] PROGMEM = {
+       0, 104,  47,  46, 149, 180,  96,   1,  85, 179,  82, 190, 141, 179,  60, 161,
+     152, 177,  60, 192, 136, 180,  69,  35,  85, 174, 117, 165, 150, 172, 126,  33,
+      83, 171, 142,  35, 131, 170, 150,  66,  67, 169, 141, 162, 198, 172, 133, 162,
+     145, 173, 125,  32, 128, 170, 115, 186, 129, 146, 120, 112, 148, 183, 128, 112,
+      20, 182, 238,  48,   0, 217,  37, 176,  69, 171, 100,  53, 222, 169, 108,  59,
+     174, 168,  83, 223, 237, 166,  91,  62, 222, 167,  99,  95, 217, 165,  98,  63,
+     153, 166,  98,  35, 148, 168,  72,  15 };
+
+constexpr byte Sound_C3_PAIRE_DE_LUNETTE [204] PROGMEM = {
+       0, 204,  47,  47, 144, 213, 120,   0, 165, 181,  84,  15, 249, 182, 102,  46,
+     245, 182, 110, 189, 244, 183, 118, 192, 228, 183, 118,  32, 228, 182, 117, 162,
+     208, 181, 100, 160, 144, 179,  92,  62, 146, 176, 107, 160, 230, 176,  99, 160,
+     129, 210,  75, 221, 133, 211,  59,  57, 193, 175,  40,  48,  85, 213,  52,  60,
+     170, 181,  85, 160, 250, 180, 101, 160, 233, 180, 102,  62, 165, 181,  94,  95,
+     116, 150,  36, 190, 181, 150,  60, 161, 181, 150,  68, 189, 180, 150,  60,  38,
+     182, 150,  69,  68, 181, 151,  61,  66, 224, 183,  51,  38, 200, 180,  67,  65,
+     216, 179,  59,  92, 212, 181,  60, 189, 249, 182, 118, 188, 229, 182, 134, 188,
+     249, 182, 134, 190, 249, 182, 134, 223, 249, 182, 126,  62, 245, 183, 109, 190,
+     245, 183, 100, 189, 166, 182,  96,  48, 192, 184,  88, 112, 128, 152, 120, 112,
+       0, 182, 248, 112,  21, 182, 204, 176,   1, 182,  93,  48, 233, 180, 117,  44,
+     233, 180, 125, 189, 165, 180, 134,  61, 233, 180, 141, 223, 101, 179, 125, 190,
+      85, 179, 132, 190,  85, 177,  67,  35, 149, 177,  96,  15 };
+
+constexpr byte Sound_C3_PANTALON [132] PROGMEM = {
+       0, 132,  47,  47,  16, 212, 144,   0,  16, 179, 156,  16, 101, 173, 141,  15,
+     170, 171, 149, 174, 170, 171, 150,  33, 166, 171, 141, 162, 165, 172, 133,  36,
+     225, 174, 125,  64, 133, 174, 116, 187, 129, 174, 115, 186, 149, 169,  96,  48,
+     192, 217, 128,  80,  84, 214, 125,  16,  20, 214, 117,  16, 232, 180, 126,  35,
+     249, 180, 151,  62, 229, 180, 167,  92, 249, 181, 151,  95, 168, 181, 110, 189,
+     252, 181, 102,  32, 253, 181,  93, 188, 185, 180,  93,  62, 233, 180,  84, 189,
+     164, 179, 109,  62, 170, 177, 117,  62, 174, 176, 116, 190, 173, 174, 115, 190,
+     137, 171, 123, 192,  68, 170, 115, 191, 132, 174, 115, 160, 136, 173, 106, 166,
+     136, 173,  96,  13 };
+
+constexpr byte Sound_C3_PARAPLUIE [136] PROGMEM = {
+       0, 136,  47,  47, 144, 213, 120,   0, 165, 181,  84,  15, 249, 182, 101,  14,
+     233, 178, 166,  35, 229, 178, 191,  65, 169, 178, 183,  33, 100, 178, 174,  32,
+     168, 176, 149,  61,  90, 177, 124, 191,  73, 178, 140, 160,  85, 178, 132, 159,
+      69, 177, 116, 160, 148, 175, 149,  34, 164, 176, 157, 190, 168, 177, 142,  94,
+     148, 177, 101,  58, 132, 174, 128,  80, 128, 184, 144, 112,  26, 179,   5,  48,
+      21, 181,  28, 176, 100, 180,  75, 186, 148, 117,  67, 223, 101, 116,  51, 221,
+     144, 183,  76, 161, 161, 183,  77,  32, 176, 184,  69,  64, 229, 216,  69,  64,
+     245, 216,  68, 190, 228, 216,  68,  32, 212, 216,  59,  32, 232, 216,  42, 160,
+     212, 216,  34,  34,  68, 215,  32,  14 };
+
+constexpr byte Sound_C3_PIJAMA [108] PROGMEM = {
+       0, 108,  47,  47, 144, 182,  96,   0,  25, 183,   6, 176, 153, 217,  61, 175,
+     233, 217,  61,  71, 233, 185,  61,  93,  82, 217,  70,  62,  80, 217,  45, 188,
+      16, 216,   5, 150,  20, 217,   6, 144,   1, 217,   7,  48, 244, 181, 118, 192,
+     229, 181, 135,  62, 165, 180, 159, 222, 165, 179, 151,  61,  88, 146,  77, 190,
+     152, 177,  69,  32, 136, 178,  68, 191, 220, 176,  59, 190, 216, 177,  51,  62,
+     216, 176,  59,  95, 168, 178, 133,  62, 100, 178, 149, 191, 168, 177, 174,  64,
+     185, 177, 173, 192, 164, 176, 157,  34,  96, 176, 120,  14 };
+
+constexpr byte Sound_C3_POIDS [76] PROGMEM = {
+       0,  76,  47,  47,  84, 182, 112,   0,   0, 181, 149,  48,   0, 151, 251, 144,
+      64, 148, 116,  40,  22, 163, 124, 160,  70, 163, 133,  33, 134, 167, 133,  33,
+     199, 169, 125, 160, 151, 171, 133, 191, 150, 173, 142, 160, 102, 174, 159,  62,
+     106, 175, 167,  62, 105, 175, 175,  95, 185, 175, 166,  61,  96, 175, 157, 188,
+     160, 143, 157,  63,  96, 175, 123,  63,  96, 175, 120,  12 };
+
+constexpr byte Sound_C3_PRES_DE [100] PROGMEM = {
+       0, 100,  47,  47, 192, 181,  96,   0,  16, 181, 166,  48,   0, 118, 252, 144,
+      33, 176, 221, 176,  53, 177, 181, 176, 149, 180, 108, 170, 233, 180, 125, 160,
+     234, 181, 134, 161, 233, 182, 135,  64, 249, 182, 127,  95, 249, 182, 127,  62,
+     253, 182, 102,  61, 232, 181,  84,  32, 224, 183, 104,  48,  86, 215, 112, 112,
+     134, 184,  92,  48, 149, 182,  85,  56, 169, 180, 101, 190, 229, 180, 109, 223,
+     229, 179, 100, 190, 233, 179,  99, 191, 229, 179,  91,  63, 196, 181,  90, 165,
+     192, 181,  80,  14 };
+
+constexpr byte Sound_C3_PROFONDEUR [188] PROGMEM = {
+       0, 188,  47,  47,  84, 181, 136,   0,  17, 176,   4, 176, 129, 180, 164,  58,
+     133, 175, 196,  64, 134, 176, 188,  32, 150, 169, 115, 175, 228, 168, 124, 175,
+     229, 167, 116, 195, 148, 170, 116,  61,  68, 213, 124, 183,   0, 213, 149, 176,
+      20, 214, 173, 208,  84, 180, 141, 240, 148, 167, 107,  36, 169, 167, 115, 190,
+     153, 166, 124, 189, 149, 166, 132, 190,  84, 168, 132, 190, 153, 171, 125,  62,
+     170, 174, 125, 190, 219, 176, 109, 186, 157, 174,  67,  62, 132, 173,  66, 187,
+      65, 160,  96,  48, 161, 215,  85,  16,  82, 181,  69,  42, 169, 180, 109, 191,
+     170, 179, 101, 185, 169, 179, 126, 190, 233, 179, 142, 191, 254, 179, 142, 222,
+     250, 179, 150,  63, 249, 179, 150,  32, 249, 179, 141, 191, 232, 179, 133, 160,
+     233, 179, 133, 192, 232, 179, 133,  64, 248, 179, 132, 191, 248, 179, 132, 192,
+     232, 178, 132,  63, 200, 173, 139,  32, 169, 177,  91,  32, 169, 176, 115,  32,
+      54, 176,  59,  32,  33, 176,   3,  38,  33, 176, 136,  14 };
+
+constexpr byte Sound_C3_PULLOVER [140] PROGMEM = {
+       0, 140,  47,  47,  88, 182,  88,   0, 133, 151, 253, 176, 133, 151, 253, 144,
+      21, 151,   5, 143, 165, 150,  77, 143, 235, 117,  85, 175, 166, 150,  86,  45,
+     185, 150,  69,  58, 169, 149,  85, 189, 165, 181, 102, 160, 102, 179, 119, 188,
+     235, 177, 119,  91, 175, 177, 118, 186, 251, 176, 110,  60, 170, 176, 101, 188,
+     149, 177,  84,  62,  64, 182,  68,  94, 165, 179, 108, 160, 153, 179, 109, 161,
+     233, 180, 134, 160, 169, 181, 142, 221, 250, 181, 151,  95, 250, 181, 142, 160,
+     229, 181, 142,  63, 233, 181, 125, 192, 245, 182, 133,  64, 213, 183, 125,  95,
+     212, 182, 116, 192, 216, 182, 100,  63, 232, 150,  92,  62, 176, 183, 107, 160,
+     149, 150, 115, 192,  85, 150, 115,  38, 101, 181, 112,  14 };
+
+constexpr byte Sound_C3_ROBE_DE_CHAMBRE [204] PROGMEM = {
+       0, 204,  42,  47,  18, 170,  40,   0,  64, 171, 122, 146, 165, 172, 115,  47,
+     165, 172, 124, 163, 170, 172, 133,  36, 187, 173, 142,  66, 175, 173, 125, 163,
+     255, 173, 108,  32, 166, 172,  74, 191, 150, 171,  90,  62, 150, 173,  72,  62,
+     140, 177,  64, 112, 149, 182,  51,  51, 107, 180,  35, 164, 171, 180,  77,  38,
+     239, 180,  94,  32, 235, 180, 110,  95, 229, 179, 100, 188, 193, 180,  92,  63,
+     145, 187,  84, 190,   5, 183, 253, 176,  20, 218, 101, 208,  20, 218,  61,  80,
+       0, 219,   5, 208,  36, 218, 253,  80,   8, 148, 243, 176, 128, 180, 107, 159,
+     150, 177, 124, 188, 102, 175, 124, 189, 166, 173, 124,  62, 102, 172, 107, 191,
+      86, 170, 124, 223, 103, 170, 132,  64, 162, 170, 123,  63, 209, 169, 122, 159,
+     167, 169, 106, 160, 167, 168, 114, 191, 155, 168, 114,  32, 102, 169,  90, 160,
+      85, 167, 106, 192,  89, 167, 106, 164,   0, 147,   0,  80, 102, 176, 104, 112,
+     102, 175, 115,  58,  22, 174, 107, 160, 104, 174, 148, 208, 169, 174, 139, 130,
+     165, 174, 115,  63,  97, 142,  18, 160,  97, 142,  16,  15 };
+
+constexpr byte Sound_C3_SHORT [104] PROGMEM = {
+       0, 104,  47,  47,  84, 182,  88,   0,  32, 217,   6,  80,  32, 217,   6,  80,
+      64, 186, 254,  80,   5, 185, 254, 112, 148, 179, 108, 172, 230, 146, 125, 190,
+     166, 145, 142,  63, 170, 175, 158,  94, 170, 174, 158,  93, 185, 174, 148, 188,
+     170, 174, 124,  32, 118, 173, 124,  48,  86, 175, 140,  80,  37, 174,   5, 176,
+      53, 174,   5, 176,  26, 175, 174,  48,  86, 211, 157,  48,  17, 179,   0,  48,
+      81, 213,  96,  80,  81, 213,  96, 112,  81, 213,  96, 112,  21, 214,   5, 176,
+      21, 180, 253, 176,  21, 180, 248,  10 };
+
+constexpr byte Sound_C3_SOUS_VETEMENT [152] PROGMEM = {
+       0, 152,  47,  47, 198, 184,  80,   0,  91, 215, 100, 112,  11, 214,   4, 240,
+      27, 213,   4, 240, 146, 181,  75, 143, 151, 177,  84, 175, 215, 175,  84,  39,
+     251, 172,  75, 223, 167, 173,  75,  61, 213, 142,  66,  59, 145, 174,  57, 184,
+     149, 180, 100,  38, 233, 180, 125, 160, 233, 181, 134, 160, 229, 182, 142, 190,
+     244, 182, 126,  62, 228, 182, 116, 189, 148, 182,  88,  17, 208, 183, 128,  80,
+     148, 215, 136, 112,  85, 215, 156, 144,   5, 215, 125,  48,   4, 217, 125,  48,
+      69, 180,  48,  48, 128, 171,  58, 167, 136, 179,  59, 188, 140, 177,  59, 220,
+     220, 176,  51,  62, 216, 174,  58, 191, 164, 174,  99,  61, 164, 174, 115, 160,
+     181, 173, 132,  64, 181, 173, 131, 190, 165, 172, 123,  32, 101, 171, 115,  64,
+     166, 170,  98,  36, 151, 170, 104,  12 };
+
+constexpr byte Sound_C3_SURFACE [116] PROGMEM = {
+       0, 116,  43,  47, 168, 181, 136,   0,  26, 214,  69, 176,  10, 215, 165, 112,
+      26, 218,   5, 112, 215, 150,  77,  71, 218, 146,  92, 190, 213, 176,  83, 191,
+      66, 208,  75,  48,  64, 181, 243,  48,  64, 214, 131, 176,  27, 180, 221, 176,
+      11, 181, 213, 208,  27, 181,   5, 240,  27, 181, 101, 176, 169, 177, 133, 162,
+     233, 177, 150, 177, 249, 178, 166, 188, 248, 178, 174,  94, 184, 179, 166,  32,
+     168, 179, 157, 190, 168, 180, 140, 190, 168, 181, 124,  35, 164, 181, 123, 144,
+      88, 214, 148, 176,  26, 214, 148, 240,  26, 214, 148, 240,  26, 214,  92, 240,
+     149, 211,  88, 192 };
+
+constexpr byte Sound_C3_TABLIER [124] PROGMEM = {
+       0, 124,  47,  47,   0, 214,  88,   0,   0, 215, 197, 144,  80, 214, 125,  15,
+     248, 182, 134,  47, 168, 181, 151,  65, 164, 181, 142, 191, 212, 146, 117,  57,
+      64, 150,  99,  61, 144, 150, 120,  32,  64, 182,  72,  80, 144, 150,  84, 191,
+     249, 150,  77, 160, 181, 183,  61, 160, 242, 183,  53, 191, 246, 215,  45,  62,
+     228, 216,  61, 160, 244, 217,  53, 189, 232, 249,  53,  95, 228, 249,  44, 188,
+     232, 249,  52,  62, 216, 249,  35, 222, 216, 249,  43, 223, 212, 217,  43, 190,
+     228, 217,  60,  64, 230, 216,  68,  63, 225, 184,  76, 192, 208, 185,  76,  95,
+     208, 216,  76,  63, 209, 186,  67,  39, 225, 185,  72,  13 };
+
+constexpr byte Sound_C3_VERRE [104] PROGMEM = {
+       0, 104,  47,  47,  73, 181,  24,   0,  69, 182,  51,  63,  65, 183,  59,  34,
+      90, 180,  76,  38, 165, 179, 117,  40, 233, 180, 142, 163, 233, 180, 151,  32,
+     249, 181, 159, 160, 248, 182, 151, 192, 248, 182, 151,  62, 244, 182, 143,  61,
+     248, 182, 143,  93, 249, 183, 134, 221, 233, 183, 134,  61, 233, 183, 134,  62,
+     233, 183, 133, 190, 233, 183, 125,  63, 233, 183, 117,  64, 233, 183, 108, 191,
+     232, 182,  99, 160, 232, 182, 107, 191, 213, 181, 115,  32, 165, 180, 107,  32,
+      97, 211, 106, 162,  97, 179,  88,  14 };
+
+constexpr byte Sound_C3_VESTE [92] PROGMEM = {
+       0,  92,  47,  47,  81, 215,  64,   0,  21, 182,  28,   4,  85, 180, 101,  36,
+     249, 181, 134, 162, 249, 182, 143, 194, 248, 183, 127,  64, 232, 183, 118,  60,
+     228, 183, 117,  62, 229, 183, 101,  59, 102, 215,  69, 144,  70, 214, 109, 240,
+       6, 214, 101, 240,  64, 214,  96, 112,  64, 214,  96, 112,   0, 215, 156, 176,
+     145, 181, 107, 144, 210, 180,  91,  17, 212, 179, 107,  59, 208, 179, 123,  63,
+     132, 176, 114, 191, 136, 166, 114, 141, 129, 178, 112,  14 };
+
+constexpr byte Sound_C3_VOLUME [140] PROGMEM = {
+       0, 140,  47,  47,  68, 183,  16,   0,   1, 150, 251, 183,  21, 181,   4,  47,
+      81, 174,  68, 162, 166, 174, 109, 166, 230, 175, 110,  35, 230, 177, 110, 161,
+     148, 180, 119,  32, 160, 148, 102, 189, 160, 149,  78,  63, 180, 150,  61, 188,
+     181, 150,  69,  61, 165, 183,  61, 189, 229, 183,  70,  32, 229, 184,  62,  63,
+     224, 216,  53, 191, 224, 217,  61, 191, 240, 184,  61,  94, 160, 183,  53,  63,
+     200, 152,  51,  62, 200, 149,  51, 192, 204, 149,  44,  63, 204, 180,  52,  63,
+     156, 180,  52,  64, 204, 179,  43, 160, 157, 178,  52, 192,  89, 178,  69,  62,
+     181, 178,  85,  32, 181, 178,  84, 160,  84, 178,  67, 190,  97, 179,  43, 160,
+      97, 179,  75,  35,  81, 179,  74, 162,  81, 178,  72,  14 };
+
+constexpr byte Sound_C3_ABRICOT [116] PROGMEM = {
+       0, 116,  47,  47, 164, 181, 152,   0, 164, 181, 165, 172, 164, 181, 166, 160,
+     164, 181, 167,  32, 164, 180, 151,  35, 165, 177, 125, 191, 136, 180,  76,  63,
+     128, 176,  91,  64, 166, 175,  75, 223, 165, 211,  76,  94, 145, 214,  84, 162,
+     213, 185,  77,  66, 208, 217,  60, 191, 145, 218,  42, 189, 192, 182,  72, 112,
+      64, 152, 248, 112,  96, 176, 252, 176,  32, 174, 180,  48, 144, 152, 250, 144,
+      64, 179,  91,  23, 129, 174, 100,  61, 133, 171, 124,  95, 137, 171, 116,  63,
+     197, 171, 116,  62, 193, 170,  99, 160, 197, 169, 107, 190, 213, 169,  99,  63,
+     225, 169,  88,  13 };
+
+constexpr byte Sound_C3_AUTOROUTE [152] PROGMEM = {
+       0, 152,  47,  47,  84, 179, 112,   0, 235, 176, 116, 175, 171, 175, 118,  37,
+     171, 175, 118,  65, 230, 176, 117, 161, 134, 211,  76, 192, 196, 207,  90,  32,
+     193, 175,  96,  48, 197, 216, 104,  80,  21, 181,   6, 176, 229, 175, 109,  64,
+     170, 173, 117, 220,  70, 169, 125, 223,  70, 167, 125,  62,  35, 162, 100, 189,
+      71, 161, 131, 185, 130, 196, 106, 190, 131, 200,  90, 160, 131, 148, 130,  32,
+     131, 169,  98, 187, 129, 148,  99,  64,  64, 203,  92,  64,  64, 209,  75, 223,
+     132, 180,  75,  60, 148, 180,  50,  32, 144, 213,  80,  80, 144, 213,  80, 112,
+       0, 180, 120, 112,   0, 215, 237,  48,  17, 214, 156, 176,  86, 180,  84, 176,
+     217, 179,  98, 134, 197, 174, 122, 192, 149, 178, 114, 221, 149, 178,  98,  38,
+      89, 178,  89, 164,  85, 179,  48,  10 };
+
+constexpr byte Sound_C3_BANANE [136] PROGMEM = {
+       0, 136,  47,  47, 128, 179,  24,   0, 212, 179, 117,  19, 232, 179, 142,  15,
+     249, 180, 167, 169, 232, 181, 167,  67, 178, 182, 158, 163, 176, 150, 141,  32,
+     162, 149,  99, 160,  67, 116,  83, 161, 136, 179,  59, 219, 164, 182, 118,  58,
+     164, 214, 150, 187, 164, 181, 159,  63, 164, 181, 175,  63, 181, 180, 183,  95,
+     101, 181, 158, 192, 164, 181, 150, 190, 180, 181, 134,  32, 228, 181, 125, 191,
+     168, 181,  84,  63, 140, 180,  59, 160, 140, 179,  59, 160, 204, 179,  51, 192,
+     140, 181,  59, 192, 136, 181,  68,  64, 168, 180,  92,  32, 186, 180, 132,  64,
+     181, 180, 131, 191, 181, 180, 131,  62,  97, 148,  98, 160,  85, 146, 106, 160,
+      85, 146,  82, 140,  17, 177,   0,  12 };
+
+constexpr byte Sound_C3_BEEFSTEAK [112] PROGMEM = {
+       0, 112,  47,  47, 192, 145,  48,   0, 196, 146,  49, 129, 166, 183,  77, 175,
+     250, 215,  70,  40, 246, 216,  77, 169, 213, 216,  76, 163, 213, 184,  52,  32,
+     169, 183,  68,  16,  37, 183,  69,  48,  17, 185,  85,  80, 193, 183,  80,  48,
+      84, 214,  88, 112,  37, 182, 156, 176, 150, 182, 131, 144, 233, 182, 116,  17,
+     254, 181, 126,  49, 250, 182, 142,  87, 245, 182, 141, 160, 229, 183, 117,  64,
+     229, 152, 100, 190, 205, 152, 107,  32, 208, 152, 104, 112,   1, 185, 248, 112,
+       8, 217, 196, 176,   8, 220, 115,  48,   5, 217,   2,  32,   5, 185,   0,  14 };
+
+constexpr byte Sound_C3_BIERE [92] PROGMEM = {
+       0,  92,  47,  47,  64, 152,  64,   0,  65, 134,  60, 144,  85, 216,  62,  48,
+     217, 217,  54,   0, 245, 216,  53, 162, 227, 216,  61, 164, 228, 216,  77, 164,
+     244, 216, 118, 193, 244, 183, 142, 223, 244, 183, 150, 221, 248, 183, 134, 254,
+     244, 183, 133,  61, 245, 183, 117,  95, 224, 184, 100, 192, 233, 151, 108,  95,
+     217, 151,  91, 191, 128, 150,  99,  32, 165, 180,  83,  64, 165, 180,  83,  32,
+     165, 180,  83,  96, 106, 177,  56,  10, 106, 177,  56,  14 };
+
+constexpr byte Sound_C3_BLANC [68] PROGMEM = {
+       0,  68,  47,  47, 197, 149,  24,   0, 169, 148,  86,  34, 168, 181,  94, 189,
+     172, 180,  86,  32, 168, 180,  94,  64, 228, 178, 142, 161, 166, 176, 159,  32,
+     162, 173, 158, 192, 130, 172, 158,  66,  18, 167, 174,  35,  82, 169, 141,  36,
+      82, 169, 124,  32, 165, 200,  99, 161,  16, 164,  98, 160,  64, 197, 106,  23,
+      16, 192,   0,  17 };
+
+constexpr byte Sound_C3_BLEU [60] PROGMEM = {
+       0,  60,  47,  47, 192, 182,  24,   0,  20, 149,  29, 164, 100, 180,  86, 160,
+      20, 181,   6, 160, 100, 181,  62, 160, 100, 181,  62,  32, 100, 181,  30,  63,
+     168, 180,  94, 161, 165, 179, 111,  64, 166, 179, 102, 193, 214, 179, 102,  67,
+     229, 178, 108, 166, 213, 177,  67, 181, 130, 145,  64,  18 };
+
+constexpr byte Sound_C3_BOEUF [80] PROGMEM = {
+       0,  80,  47,  47, 208, 178,  16,   0,  81, 182,  19, 144,  81, 181, 101, 139,
+     234, 179, 134, 168, 234, 178, 143,  34, 229, 179, 151, 161, 228, 179, 151,  64,
+     230, 147, 134, 221, 213, 178, 134,  58, 214, 146, 125,  63, 150, 181, 132, 208,
+      85, 182, 149, 176, 150, 183, 142,  48, 234, 183, 149, 176,  85, 183, 133, 176,
+     101, 183, 125,  80,  86, 182, 116, 176,  16, 182,  60, 208,  16, 182,  56,  25 };
+
+constexpr byte Sound_C3_CAFE [84] PROGMEM = {
+       0,  84,  47,  47, 192, 215,  80, 128,   4, 182, 199,  48,   8, 183, 141, 143,
+     224, 184, 110,  43, 229, 183, 135,  32, 229, 182, 143,  95, 213, 149, 117, 190,
+     149, 181,  85,  63, 234, 182, 133, 208, 106, 182, 157, 112,  90, 183, 108, 240,
+     209, 182, 100,  17, 229, 182, 109, 187, 228, 182, 109,  60, 229, 183, 109,  63,
+     229, 184, 101, 223, 228, 184,  92, 191, 224, 185,  90, 160, 240, 185,  82, 160,
+     224, 185,  80,  14 };
+
+constexpr byte Sound_C3_CAMPAGNE [124] PROGMEM = {
+       0, 124,  47,  47, 144, 215, 136,   0,  64, 117, 252, 144,  33, 179, 190,  48,
+      90, 174, 150,  73,  91, 169, 165, 193,  90, 166, 140, 193,  89, 166,  84,  62,
+      72, 173,  74, 177,  84, 173,  90,  49,  81, 186, 128, 112,   1, 153, 100, 144,
+      89, 177, 149, 171, 170, 178, 175,  61, 252, 179, 190, 223, 186, 180, 183,  94,
+     185, 181, 174,  95, 185, 182, 141, 191, 184, 182, 108, 190, 152, 181,  67, 160,
+     104, 182,  75,  63, 114, 183,  74, 160, 132, 116,  50,  64, 136, 118,  58, 192,
+     128, 218,  75, 224, 132, 185, 100,  64, 169, 182, 100,  64,  80, 182,  99, 191,
+      64, 152, 115,  32,  68, 151, 106,  15,   5, 180,  72,  15 };
+
+constexpr byte Sound_C3_CHOCOLAT [100] PROGMEM = {
+       0, 100,  47,  47,  21, 185, 248,   0,  17, 186, 253, 176,  26, 186, 253, 176,
+      17, 219, 253, 208,  17, 219, 253, 240,  16, 219, 253, 176, 170, 144, 117, 204,
+     231, 141,  92, 190, 146, 141,  66, 191, 213, 141,  80,  48,  65, 173, 112,  80,
+      65, 143, 181,  48,  16, 141,   4,  48, 150, 142, 100, 131, 215, 142, 117, 160,
+     235, 144, 118, 189, 100, 148, 119,  92, 100, 149,  78,  60, 239, 180,  94,  94,
+     238, 180, 118, 188, 248, 180, 142, 186, 228, 180, 158,  32, 233, 178, 173, 224,
+     170, 178, 168,  13 };
+
+constexpr byte Sound_C3_CITRON [96] PROGMEM = {
+       0,  96,  47,  47, 166, 215,  88,   0, 149, 215,  94, 144, 133, 216, 102,  48,
+      13, 184, 134, 240,  29, 217, 127,  48, 237, 216,  71,  47, 245, 216,  71,  70,
+     228, 216,  62,  60, 192, 216,  60,  49, 192, 216,  56,  16,  17, 216, 104, 112,
+      20, 216, 191,  16,  18, 181, 255, 176,  16, 210,   6, 176,  18, 207,   5,  48,
+      65, 181, 189,  80, 134, 177, 124,  48,  42, 162, 133,  59, 137, 162, 149, 222,
+     134, 169, 135, 224, 136, 173, 125,  59, 136, 170, 115, 191,  65, 183, 136,  14 };
+
+constexpr byte Sound_C3_CLEMENTINE [148] PROGMEM = {
+       0, 148,  47,  47,  64, 182, 120,   0,  20, 183, 222, 176,  16, 218, 119,  48,
+     164, 215,  86,  43, 228, 183,  78, 161, 229, 183,  78, 195, 228, 184, 119, 195,
+     212, 182, 118, 162, 152, 178,  77,  34, 152, 176,  85,  65, 132, 176, 117, 190,
+     161, 173, 134,  95, 145, 173, 125, 192, 152, 174, 101, 221, 137, 173,  76,  54,
+     132, 175,  67,  61,  69, 172,  64,  16,  64, 181, 104, 112,   4, 214, 173, 176,
+      13, 217,  77, 208, 201, 215,  61,  37, 248, 216,  61, 218, 244, 248,  53,  61,
+     228, 216,  44, 189, 212, 218,  68, 160, 196, 217,  59, 160, 161, 151,  68,  62,
+     168, 183,  76, 223, 168, 182,  68,  64, 220, 181,  60, 223, 204, 178,  68,  64,
+     249, 181, 124,  64, 181, 180, 131, 192, 164, 179, 115,  37,  84, 179, 115,  32,
+      20, 178, 112,  14 };
+
+constexpr byte Sound_C3_CORNICHON [120] PROGMEM = {
+       0, 120,  47,  47,  16, 217, 248,   0,  16, 217, 254, 144, 136, 184, 134, 144,
+     136, 184,  86, 144, 136, 184,  94,  16, 150, 177, 126, 175, 150, 174, 151,  70,
+     134, 173, 150, 191,  83, 171, 141, 190, 162, 171, 116, 161, 149, 174, 125,  65,
+     136, 175,  92,  64, 213, 208,  76, 255, 213, 207,  76,  63, 128, 216,  76, 222,
+      89, 184,  53, 189,   1, 184,   6, 144,  18, 185, 255,  48,  70, 185, 255,  80,
+      20, 217, 254, 240,  49, 185, 253, 208,   1, 149,   5,  17, 149, 145, 125, 222,
+      69, 169, 149,  93,  37, 165,   4, 222,  20, 164, 107, 160,  32, 160,   2, 191,
+     129, 183, 138,  32,  65, 183, 120,  15 };
+
+constexpr byte Sound_C3_ESCARGOT [128] PROGMEM = {
+       0, 128,  47,  47, 148, 182,  80,   0, 144, 215, 127, 201, 228, 183, 127,  38,
+     232, 215, 118,  34, 165, 215,  93, 185, 213, 183,  85,  59, 244, 215, 125, 176,
+      33, 214,  93, 208,  16, 214, 109, 176, 192, 184, 120,  80,  24, 151, 167, 176,
+     196, 183, 101, 175, 208, 182, 135,  33, 161, 148, 159, 219, 144, 146, 150, 190,
+     149, 143, 150,  63, 145, 142, 133, 191,  82, 173, 117,  62, 166, 176,  92, 190,
+      98, 177,  76, 191,  87, 177,  76,  16,  17,  80,   4,  48, 128, 211,  56, 112,
+      32, 207, 124, 178,  65, 174,  76,  32, 133, 171, 101,  64, 149, 170,  92,  61,
+      69, 168, 124, 191, 129, 167, 100, 192, 225, 200,  90, 160, 209, 166,  80,  14 };
+
+constexpr byte Sound_C3_FLEUVE [104] PROGMEM = {
+       0, 104,  47,  47,  16, 182,   0,   0,  21, 181,   5,  48,   2, 118, 253, 112,
+      16, 182,   5, 240,  96, 150,  84, 143, 100, 180,  85,  37, 168, 180,  77, 160,
+     104, 180, 110, 160, 234, 180, 143, 192, 186, 180, 151, 221, 254, 180, 143,  93,
+     169, 180, 134, 222, 173, 180, 125, 222, 169, 179, 100, 192, 233, 179, 100,  62,
+     168, 179,  83,  64, 133, 181,  66, 223,  69, 181,  50, 224,  85, 180,  83,  64,
+      89, 178, 107, 160, 105, 178, 131, 160, 154, 178, 123, 192, 105, 178, 107,  95,
+     125, 178,  98, 140, 101, 179, 104,  15 };
+
+constexpr byte Sound_C3_FRAISE [100] PROGMEM = {
+       0, 100,  47,  47, 165, 180, 144,   0, 154, 181, 140,  16,  74, 183, 173,  48,
+      10, 181, 197,  80,  26, 178, 221, 112,  42, 179, 124, 240, 168, 180, 124, 143,
+     233, 181, 134,  37, 169, 181, 151,  32, 180, 182, 159,  64, 248, 182, 159,  94,
+     244, 183, 151,  94, 248, 183, 134, 222, 248, 183, 126,  94, 249, 183, 118,  95,
+     248, 182, 109,  95, 232, 182, 100,  95, 229, 182,  58, 223, 129, 182,  90, 192,
+     149, 182,  66, 224, 165, 179, 114, 192, 128, 180,  58,  33,  80, 147,  48,  15,
+      80, 147,  48,   6 };
+
+constexpr byte Sound_C3_FROMAGE [132] PROGMEM = {
+       0, 132,  47,  47, 218, 181,  96,   0, 154, 181, 100,  16,  26, 181, 100,  48,
+      26, 178, 108, 240,  42, 166, 116, 240, 210, 202, 123,  47, 199, 171, 124, 162,
+     163, 171, 126,  66, 170, 172, 117, 160, 153, 175,  93, 191, 152, 175,  69,  32,
+     157, 178,  61,  92, 169, 176,  86,  32, 102, 177, 167, 186, 165, 177, 167,  61,
+     165, 178, 175,  94, 165, 178, 183,  95, 168, 179, 174, 223, 169, 179, 158,  95,
+     165, 179, 125, 192, 165, 179, 125, 223,  84, 180, 125, 208,  69, 181, 117,  62,
+      73, 185,  29, 176,  85, 185,  85, 208, 100, 217,  93, 160,  68, 180, 117,  33,
+      84, 180, 133,  64,  84, 179, 132, 190,  84, 179,   2, 164,  80, 179,   8,  15,
+      80, 179,   8,   1 };
+
+constexpr byte Sound_C3_GATEAU [80] PROGMEM = {
+       0,  80,  47,  47, 144, 184,  64,   0, 136, 182,  59, 144,   8, 183,   4, 143,
+     229, 185, 102,  38, 229, 184, 127,  35, 241, 183, 151, 161, 244, 182, 151,  34,
+     224, 182, 142,  33, 208, 183,  92,  32, 144, 184, 128, 112, 217, 214, 136, 112,
+      25, 215, 157,  16,  20, 214,  69,  48, 145, 213,  92, 145, 129, 178, 109, 217,
+     209, 173,  99, 188, 149, 170,  91,  63, 133, 168,  90, 191, 213, 168,  80,  14 };
+
+constexpr byte Sound_C3_HUITRE [100] PROGMEM = {
+       0, 100,  47,  47, 145, 218,  64,   0, 224, 216,  66, 173, 230, 151,  67, 163,
+     230, 151,  69,  32, 230, 151,  69, 163, 197, 215,  78,  32, 197, 215,  78,  64,
+     192, 218,  69, 219, 209, 216,  69,  61, 192, 216,  80, 112, 128, 179,  72, 112,
+      32, 182, 253, 176,  33, 182,   6,  48,  64, 184, 253, 208,  33, 180, 165,  80,
+     144, 179, 116, 184,  85, 178, 140,  61,  85, 177, 148,  61, 106, 177, 148,  95,
+     165, 177, 131, 190,  97, 177, 123,  32, 101, 177,  74,  36,  84, 176, 104,   7,
+      84, 176, 104,   9 };
+
+constexpr byte Sound_C3_JAMBON [104] PROGMEM = {
+       0, 104,  47,  47,  84, 180,  96,   0,  84, 180,  97,  18,  84, 181,  91,  32,
+      97, 185,  92, 160, 100, 217,  85, 160, 101, 217,  78,  16, 101, 217,  94,  80,
+       4, 151, 174, 175,  80, 175, 142, 195,  64, 169, 166,  67, 129, 180, 149, 196,
+     196, 203, 125, 223, 136, 174,  93,  62, 216, 176,  60,  59, 200, 173,  59,  59,
+     204, 173,  50, 188, 153, 171,  32,  16, 148, 168,  48,  48,  81, 213,  77,  52,
+     170, 171, 108, 165, 158, 170, 141, 223, 137, 168, 149, 222, 132, 199, 132, 223,
+     132, 202, 115,  62, 130, 149, 128,  14 };
+
+constexpr byte Sound_C3_LAIT [64] PROGMEM = {
+       0,  64,  47,  47, 116, 182,  64,   0, 180, 150,  60, 185, 180, 182,  61,  32,
+     252, 182,  69,  65, 253, 182,  69, 193, 254, 182,  70,  65, 255, 182,  77, 163,
+     182, 182,  69, 161, 249, 183, 119,  37, 249, 183, 127, 192, 245, 184, 119, 223,
+     245, 184, 119,  60, 245, 184, 102, 188, 228, 152,  92,  63, 224, 184,  88,   6 };
+
+constexpr byte Sound_C3_MARRON [100] PROGMEM = {
+       0, 100,  47,  47, 200, 173,  40,   0, 140, 180,  43, 191, 140, 178,  44, 193,
+     220, 177,  45, 194, 166, 176, 150,  36, 165, 177, 190,  32, 164, 177, 190, 160,
+      84, 177, 190, 129,  80, 177, 182,  33,   0, 177, 205, 160,  96, 176, 125, 191,
+      85, 174, 101,  63,  21, 172,   4, 160,  22, 172,   3, 222,   5, 167,   3,  95,
+     150, 169, 114, 190, 158, 168, 131, 190, 137, 168, 141,  95, 137, 166, 148, 160,
+     132, 167, 125,  64, 132, 198, 124, 193, 129, 165, 116,  34, 130, 165, 107,  32,
+     129, 133, 112,  31 };
+
+constexpr byte Sound_C3_MER [76] PROGMEM = {
+       0,  76,  47,  47, 122, 180, 104,   0, 156, 182,  52, 192, 156, 182,  61,  66,
+     170, 181,  69, 166, 166, 181, 134, 129, 181, 182, 159,  33, 180, 182, 159, 161,
+     184, 183, 159, 192, 184, 183, 151,  94, 185, 183, 143,  92, 185, 183, 142, 187,
+     185, 183, 134,  95, 186, 183, 134,  95, 186, 183, 133,  95, 164, 183, 108,  64,
+     152, 183,  99, 160, 149, 183,  99,  35, 213, 183,  96,  15 };
+
+constexpr byte Sound_C3_MONTAGNE [144] PROGMEM = {
+       0, 144,  47,  47, 105, 178,  64,   0,  88, 178,  60,  29,  28, 177,   5,  33,
+      72, 179,  52, 161,   8, 178,   5,  36, 137, 174, 133,  35, 133, 172, 141, 162,
+     134, 173, 149,  68, 138, 173, 124, 162,  73, 170, 116,  32,  69, 181,  76,  63,
+      36, 161,   0,  48,  20, 215,   0, 112,  85, 215, 165, 176, 148, 181, 108,  17,
+     169, 180, 150,  32, 185, 180, 175,  54, 186, 180, 183,  61, 106, 180, 191,  32,
+     121, 181, 174, 223, 112, 181, 141, 191, 164, 182, 125,  62, 229, 182, 108, 190,
+     148, 181,  67, 161, 212, 182,  59, 160, 160, 215,  68,  63, 160, 119,  59, 192,
+     136, 116,  58, 192, 146, 216,  58, 192, 129, 215,  67,  63, 129, 218,  83, 160,
+     185, 182,  59, 224, 145, 181,  91,  32,  89, 180, 106,  35, 101, 180,  56,  14 };
+
+constexpr byte Sound_C3_MOULE [96] PROGMEM = {
+       0,  96,  47,  47,  88, 179,  32,   0,  72, 179,  41, 153, 136, 180,  58, 161,
+     136, 180,  43, 163, 136, 180,  44,  36, 136, 181,  45,  35, 136, 180,  53,  39,
+     136, 178,  77, 161, 136, 171, 109, 161,  72, 168, 125, 193, 136, 139,  93, 255,
+      73, 138, 102,  58,  85, 145,  54,  92, 164, 149,  77, 222, 232, 181,  85, 223,
+     252, 181,  94,  95, 189, 180, 101, 192, 253, 180, 133, 192, 250, 180, 141,  62,
+     250, 180, 148, 192, 249, 179, 140,  32, 228, 178, 138, 163, 228, 178, 136,  95 };
+
+constexpr byte Sound_C3_MOUTARDE [128] PROGMEM = {
+       0, 128,  47,  47, 105, 178, 112,   0, 140, 183,  52, 192, 140, 181,  53,  69,
+     130, 153, 109,  39, 136, 177,  93, 163, 142, 176,  77,  34, 198, 177,  68,  32,
+     132, 211,  59, 191, 193, 183,  64,  48, 192, 213,  72, 112,  20, 215, 222,  48,
+     165, 181, 117, 186, 229, 180, 158, 220, 165, 179, 182, 221, 165, 178, 182, 255,
+     165, 178, 174, 223, 165, 177, 166,  62, 166, 176, 149,  33,  98, 175, 124,  48,
+      22, 173,  51, 144,  37, 174,   5, 176,  17, 175,   4, 176, 128, 179, 108,  32,
+     144, 178,  75, 187, 128, 179,  40,  80,  81, 182,  59, 163, 152, 180,  99, 161,
+     144, 180, 123, 192,  20, 178,  43,  64, 165, 180,  34, 160,  97, 180,   0,  14 };
+
+constexpr byte Sound_C3_MOUTON [92] PROGMEM = {
+       0,  92,  47,  47, 153, 178,  48,   0, 216, 177,  43,  62, 216, 178,  35, 160,
+     136, 180,  44, 162, 200, 178,  52, 198, 130, 185,  85,  37,  77, 172,  85,  67,
+     138, 140,  76,  33, 193, 178,  67, 190, 196, 179,  58, 191, 196, 179,  72, 112,
+     128, 213,  64, 112,   5, 180, 252, 144,   1, 214, 190, 176, 150, 178, 118,  54,
+     134, 173, 134,  93, 150, 169, 141, 188, 136, 166, 141,  62, 132, 160, 124,  95,
+      16, 160,  35,  63, 129, 183,  74, 191,  36, 160,   0,  10 };
+
+constexpr byte Sound_C3_NOIR [100] PROGMEM = {
+       0, 100,  49,  47, 140, 180,  32,   0, 200, 182,  35,  63, 220, 180,  44, 160,
+     156, 180,  45,  32, 140, 180,  53,  97, 168, 177, 101, 193, 136, 171, 117, 192,
+     136, 164, 141, 192, 153, 172, 141, 223, 166, 173, 142,  63, 166, 175, 158, 191,
+     166, 176, 167,  63, 182, 176, 183,  96, 101, 176, 174, 223, 101, 176, 174, 192,
+     101, 176, 166, 194, 101, 175, 158,  38, 180, 176, 141, 165, 160, 176, 116, 160,
+     160, 175,  99, 160, 160, 176,  83,  32,  85, 175,  26, 192,  80, 176,  42,  59,
+      97, 176,  58,  93 };
+
+constexpr byte Sound_C3_OEUF [60] PROGMEM = {
+       0,  60,  47,  47, 169, 181,  72,   0, 230, 181, 124, 170, 230, 181, 141, 161,
+     166, 180, 142, 160, 166, 180, 143,  32, 166, 180, 143,  96, 230, 180, 135,  60,
+     230, 180, 118, 188, 209, 180, 109,  58, 154, 181, 109,  48,  86, 182, 142, 112,
+      90, 184, 166, 112,  26, 182, 157, 208,  21, 180, 120,   6 };
+
+constexpr byte Sound_C3_OLIVE [112] PROGMEM = {
+       0, 112,  47,  47, 149, 173, 112,   0, 149, 175, 115, 143, 149, 175, 124, 139,
+     153, 176, 117, 131, 170, 176, 117, 131, 170, 177, 118,  36, 149, 147, 110, 162,
+     160, 150,  79,  32, 245, 182,  70,  95, 249, 183,  62,  91, 245, 216,  54, 190,
+     244, 216,  54, 223, 244, 217,  46, 223, 248, 217,  46,  61, 244, 217,  53, 191,
+     244, 216,  53, 223, 224, 183,  60, 222, 213, 151,  60,  62, 150, 150,  36,  32,
+     213, 149,  40,  48,  69, 179,  32, 112,  85, 179, 101,  64, 169, 179, 124, 158,
+     232, 179, 140, 192, 149, 178, 132,  62,  85, 177,  83, 194,  84, 178,  72,  14 };
+
+constexpr byte Sound_C3_ORANGE [140] PROGMEM = {
+       0, 140,  47,  47, 229, 181, 112,   0, 213, 178, 123,  41, 229, 176, 125,  34,
+     229, 176, 126,  64, 234, 173, 134,  65, 166, 172, 133, 160, 234, 171, 132, 190,
+     166, 172, 107, 186, 145, 203,  99,  32,  81, 204,  99,  16,  69, 174,  67, 176,
+     150, 172, 116,  62, 166, 173, 124, 160, 102, 173, 149,  32, 162, 173, 157,  64,
+     163, 172, 149,  64,  87, 172, 157,  95, 150, 172, 149,  95,  86, 169, 157,  61,
+      25, 166, 164, 223,  72, 165, 164, 192,  72, 170, 148, 223,  68, 177, 140, 192,
+      81, 147, 132,  63,  16, 180, 116,  64,  16, 218, 100,  32, 164, 217, 100,  64,
+      69, 217,  92,  64,  68, 218, 100,  32,  85, 179, 124,  64,  84, 178, 123, 192,
+      84, 178, 122, 128,  68, 178, 114,   7,  68, 178, 112,  11 };
+
+constexpr byte Sound_C3_PAIN [48] PROGMEM = {
+       0,  48,  47,  47, 192, 153,  80,   0,  81, 151, 158,  48, 170, 177, 134,  47,
+     238, 177, 151,  33, 165, 178, 167, 192, 165, 178, 159, 222, 145, 178, 159,  92,
+     160, 178, 150,  60,  80, 178, 100, 188, 145, 145,  75, 189,  80, 145,  80,  14 };
+
+constexpr byte Sound_C3_PAMPLEMOUSSE [136] PROGMEM = {
+       0, 136,  47,  47, 192, 215,  96,   0, 148, 214, 133, 176,  64, 178, 156, 143,
+     170, 172, 133, 175, 227, 172, 141, 194, 165, 169, 133,  64, 137, 170, 124, 160,
+      68, 170,  74, 180, 192, 217, 128,  80,   0, 179,   5, 176,   1, 150, 156, 144,
+      17, 149, 115, 144, 144, 117,  75, 139, 217, 115,  75, 160, 213, 148, 101,  32,
+     238, 147, 110,  94, 170, 146, 101, 188,  89, 145,  69,  62, 136, 179,  60, 222,
+     136, 181,  52, 223, 140, 166, 108, 222,  76, 163, 108, 223,  70, 144,  76, 222,
+     129, 180,  68,  95,   4, 215,  52, 160,   4, 215,   5, 176,  17, 215,   5, 208,
+      20, 215,   5, 112,  20, 215,   5, 112, 137, 180,  99,  31, 212, 179, 106,  32,
+     208, 178, 113,  11, 209, 178, 112,   6 };
+
+constexpr byte Sound_C3_PATE [88] PROGMEM = {
+       0,  88,  47,  47, 196, 216,  88,   0,  17, 182, 108, 144,  17, 182, 117,  15,
+     212, 177, 157, 167, 213, 177, 174,  32, 213, 178, 182, 160, 213, 179, 183,  32,
+     165, 179, 191,  93, 165, 179, 182, 221, 160, 180, 141,  93, 128, 150, 152, 112,
+      64, 184, 144, 112,   0, 215,   8, 112, 100, 214, 172, 144,  21, 215,  44,  48,
+     145, 181,  99, 176, 229, 179, 107, 189, 225, 179, 131, 192, 225, 179, 131,  63,
+     165, 179,  90,  64, 133, 179,  96,  15 };
+
+constexpr byte Sound_C3_PECHE [76] PROGMEM = {
+       0,  76,  47,  47,  65, 181,  80,   0,  86, 182,  99,  15, 233, 181, 134,  37,
+     249, 182, 143,  95, 244, 183, 135,  94, 232, 183, 126, 190, 244, 183, 126,  62,
+     224, 151, 125,  60, 160, 182, 100, 190,  85, 217,  94,  80,  37, 218,  94, 112,
+      21, 217,  93, 176,  21, 217,  93, 208,  21, 217,  93, 240, 133, 217, 100,  48,
+     169, 179, 115,  34,  85, 179, 130, 222,  85, 179, 128,  11 };
+
+constexpr byte Sound_C3_PLAGE [120] PROGMEM = {
+       0, 120,  47,  47,  68, 179,  80,   0,   0, 181,  17, 144,   5, 151,   4, 176,
+      89, 151,  68,  15, 172, 181,  93,  36, 172, 180, 102,  65, 169, 180, 143,  34,
+     169, 180, 167, 160, 169, 180, 183, 223, 169, 180, 183,  61, 169, 179, 191,  94,
+     169, 179, 191,  94, 105, 180, 183,  62, 106, 179, 174, 190, 106, 179, 166,  63,
+     168, 179, 157, 223, 121, 180, 141,  95, 165, 180, 125,  63, 213, 148, 116,  32,
+     208, 180, 107, 160, 149, 181,  99, 191, 144, 214, 100,  63,  26, 186, 124,  15,
+      26, 186, 116,  65,  30, 186, 116,  80, 237, 178,  91, 176, 173, 178,  91,  32,
+     109, 178,  90, 160, 109, 178,  88,   0 };
+
+constexpr byte Sound_C3_POIRE [104] PROGMEM = {
+       0, 104,  47,  47, 128, 212, 128,   0,  68, 213, 149, 176,  64, 181, 124,  15,
+      68, 135, 115, 165,  90, 167, 116, 161, 138, 169, 125,  32, 219, 173, 142, 192,
+     174, 176, 167,  64, 186, 177, 175,  94, 165, 177, 183,  94, 164, 177, 182, 221,
+     164, 177, 174,  95, 164, 177, 173, 223, 164, 177, 165, 223, 170, 177, 165,  95,
+     166, 177, 157,  63, 169, 177, 140, 160, 100, 176, 123, 160,  17, 177, 235,  65,
+      33, 176, 251, 192, 106, 177,  99,  32, 153, 143, 114, 190, 149, 174, 122,  65,
+     168, 176,  89, 160,  20, 177,  56,  15 };
+
+constexpr byte Sound_C3_POMME [92] PROGMEM = {
+       0,  92,  47,  47,  81, 214, 128,   0,  17, 181, 141,  16, 149, 178, 124, 143,
+     238, 175, 133, 166, 230, 175, 142, 160, 214, 176, 142, 192, 234, 175, 134,  32,
+     230, 175, 133, 222, 169, 176, 117,  59,  88, 175,  84, 190, 136, 179,  68, 191,
+     136, 180,  60,  58, 136, 180,  68,  95,  76, 179,  52,  32, 156, 178,  59, 192,
+     156, 178,  51, 224, 169, 177, 108, 160, 165, 179, 157,  64, 165, 178, 156, 191,
+     149, 179, 155, 160,  80, 178,  90, 160,  80, 178, 120,  15 };
+
+constexpr byte Sound_C3_PORC [100] PROGMEM = {
+       0, 100,  47,  47,  80, 213,  72,   0,   9, 115, 253,  16,   5, 108, 117,  15,
+     251, 175, 125, 173, 239, 174, 142,  32, 235, 175, 150,  63, 234, 175, 150, 223,
+     250, 174, 150,  93, 251, 175, 150,  92, 251, 175, 149, 221, 250, 175, 149,  95,
+     250, 174, 140, 222, 255, 174, 140, 160, 233, 171, 131, 190, 232, 171, 131,  63,
+     160, 172, 115,  32, 149, 171,  99,  32, 130, 172, 115,  64,  18, 174,   3, 160,
+      18, 173,   3,   9,  34, 173,   4, 176,  34, 174,   4,  48,  38, 175,  36,  80,
+      38, 175,  32,  14 };
+
+constexpr byte Sound_C3_POULET [76] PROGMEM = {
+       0,  76,  47,  47, 192, 215,  80,   0,  68, 181, 190,  48,   0, 151, 221,  48,
+      16, 181,  60, 176, 128, 117, 100, 175, 133, 140,  76,  39, 234, 142,  76, 160,
+     166, 144,  69,  32, 162, 118,  60, 160, 225, 150,  69,  32, 229, 182,  77, 218,
+     181, 182,  94, 188, 245, 182, 118, 187, 245, 182, 127,  60, 245, 183, 135,  94,
+     245, 183, 126, 223, 245, 183, 126,   9, 229, 183, 104,   9 };
+
+constexpr byte Sound_C3_PRUNE [96] PROGMEM = {
+       0,  96,  47,  47,   0, 148, 136,   0,  69, 146, 140,  16,  85, 146, 156, 144,
+      25, 174,  68,  37,  82, 206,  75, 161, 134, 177,  91, 160,  86, 178, 101,  37,
+     150, 179, 102,  35, 170, 149,  94, 192, 234, 149,  86,  63, 165, 150,  94,  94,
+     145, 183,  93, 188, 144, 184,  85,  62, 132, 185,  68, 187, 136, 182,  59, 190,
+     152, 183,  59, 190, 156, 182,  67, 224, 156, 182,  67, 223, 140, 179,  67, 223,
+     153, 181,  83,  32, 229, 181, 131,  64, 229, 180, 136,  12, 229, 180, 136,   8 };
+
+constexpr byte Sound_C3_RAISIN [108] PROGMEM = {
+       0, 108,  47,  47, 165, 175, 120,   0,  18, 175,  83, 178,  34, 206,  84,  31,
+      34, 176,  92,  32,  33, 210,   4, 176, 166, 180, 108,  15, 184, 181, 117, 173,
+     248, 182, 126, 162, 228, 183, 118, 193, 248, 183,  94,  34, 248, 182,  85, 160,
+     248, 182,  76, 188, 161, 182,  76,  61, 225, 182,  75, 160, 225, 182,  75,  64,
+     169, 180,  76,  94, 229, 180, 101,  33, 233, 180, 125, 160, 228, 180, 142,  63,
+     164, 180, 150,  95, 161, 179, 157, 221, 145, 178, 132, 191, 144, 179, 123, 190,
+     144, 178,  75,  32, 144, 178,  80,   8, 144, 178,  80,  12 };
+
+constexpr byte Sound_C3_RIVIERE [116] PROGMEM = {
+       0, 116,  47,  47,  53, 179, 120,   0,  33, 212,  60, 185,  32, 247, 141, 192,
+     212, 218,  76, 202, 228, 218,  77, 162, 229, 217,  61,  64, 208, 184,  51, 223,
+     153, 216,  52,  93, 237, 216,  52, 221, 250, 216,  69, 223, 185, 216,  94, 161,
+     249, 183, 111,  63, 186, 183, 135, 191, 186, 183, 143,  63, 250, 182, 151,  62,
+     185, 182, 143,  95, 186, 183, 134, 223, 181, 183, 134,  64, 228, 183, 116, 223,
+     218, 149, 108,  64, 232, 148, 115, 223, 209, 179, 106, 192,  21, 178, 124,  48,
+      32, 178, 132,  80,  33, 177, 139,  63,   1, 177, 130, 192, 106, 178,  90,  13,
+      90, 178,  80,  15 };
+
+constexpr byte Sound_C3_RIZ [52] PROGMEM = {
+       0,  52,  47,  47, 146, 180, 104,   0,  82, 180, 117, 144,  97, 181, 109, 152,
+      97, 181, 109, 160, 229, 183,  86,  70, 228, 184,  86, 195, 228, 217,  79,  65,
+     244, 217,  62, 193, 244, 217,  53, 192, 241, 217,  44, 220, 134, 152,  67, 188,
+     134, 152,  72,  20 };
+
+constexpr byte Sound_C3_ROSEE [104] PROGMEM = {
+       0, 104,  47,  47, 149, 171, 120,   0, 165, 171, 122, 155, 218, 171, 132,  32,
+     166, 170, 115, 160, 166, 169, 123, 223,  66, 170, 131, 192, 130, 165, 116,  67,
+     162, 167, 100,  35, 230, 168, 108, 163, 134, 139, 133,  36, 171, 171, 125,  64,
+     235, 175, 109,  64, 230, 176,  92, 190, 229, 177,  76, 188, 201, 211,  84, 223,
+     128, 183,  93, 176, 213, 182,  85,  23, 213, 214,  93,  62, 225, 213,  77,  64,
+     229, 181,  94,  63, 240, 182, 102,  95, 208, 216, 101, 189, 224, 216,  93,  60,
+     160, 185,  60, 196, 224, 185,  80,  10 };
+
+constexpr byte Sound_C3_ROUTE [108] PROGMEM = {
+       0, 108,  47,  47,  35, 176, 186,   0,  19, 208, 139, 161,  19, 208, 140, 166,
+       6, 177, 125,  35, 129, 171, 106, 131, 130, 160, 115,  39,  66, 165,  99, 163,
+      66, 196, 108,  32,  66, 166, 124, 160,  66, 168, 149,  62,  71, 174, 101,  62,
+     162, 176,  85,  58, 153, 211,  60,  62, 128, 213,  88,  80, 128, 181,  80, 112,
+       1, 182,   0, 112,   1, 215, 253,  16,  17, 214, 206,  48,  65, 184,  92, 208,
+     194, 149, 107,  51, 149, 179, 123, 221,  97, 179, 123,  95,  89, 178, 114, 191,
+      69, 179,  97, 160,  69, 181, 105, 138,  85, 179,  48,  15 };
+
+constexpr byte Sound_C3_SAUCE [72] PROGMEM = {
+       0,  72,  47,  47, 180, 183, 128,   0, 110, 214, 166,  80,  30, 215, 141, 176,
+      30, 214, 157, 240,  30, 214,  94,  48,  14, 213,   6,  80, 133, 213, 100, 143,
+     229, 175, 109,  68, 226, 174, 100, 161, 225, 174,  92,  32, 193, 173,  91, 189,
+     133, 178,  83, 184,  90, 214,  62,  48, 138, 215, 102, 112, 197, 216, 102,  80,
+     213, 215,  93,  48, 193, 216,  88,  21 };
+
+constexpr byte Sound_C3_SUCRE [100] PROGMEM = {
+       0, 100,  47,  47,  90, 216,  88,   0,  10, 217,  62, 176,  26, 216,   6, 208,
+      10, 215,   6, 112, 165, 183,  69, 143, 161, 183,  69, 192,  97, 150,  61, 220,
+     146, 150,  61,  63, 225, 182,  60,  61, 208, 183,  64,  80, 128, 215,  96, 112,
+      20, 149,   4, 144,  20, 150, 126,  48,  96, 182, 141, 168,  37, 180,  62, 176,
+      32, 211, 150, 208, 101, 178, 126,  48, 149, 177, 115,  92, 148, 176, 114, 190,
+     101, 176,  66, 192,  20, 176,   3,  62,  32, 176,   2,  32,  16, 142,   1,  34,
+      16, 174,   0,  13 };
+
+constexpr byte Sound_C3_THE [52] PROGMEM = {
+       0,  52,  47,  47,   0, 182, 248,   0,  84, 215, 213, 144, 102, 182, 173, 176,
+     229, 182,  86,  47, 250, 182, 103,  38, 250, 183, 111,  95, 249, 183, 103,  94,
+     229, 184,  94,  60, 208, 184,  85,  59, 208, 185,  84,  57, 196, 153,  99,  62,
+     196, 151,  96,   6 };
+
+constexpr byte Sound_C3_TOMATE [116] PROGMEM = {
+       0, 116,  47,  47, 145, 216,  88,   0,  18, 215, 124, 176, 214, 180, 108, 143,
+     219, 179, 126, 174, 231, 177, 118, 188, 167, 176, 126,  61, 234, 175, 125,  60,
+     152, 177,  60,  62, 156, 177,  52,  64, 157, 177,  52, 221, 165, 177, 125, 189,
+     101, 179, 158,  32, 165, 179, 174,  64, 185, 180, 157,  95, 165, 180, 132, 191,
+     144, 181, 123, 191, 213, 180, 122,  34, 144, 212,  96,  48, 128, 180, 128,  80,
+     128, 180, 128, 112,   0, 150,   0, 112,  16, 182, 172, 144,  16, 181,   4,  48,
+     225, 179, 107,  62, 213, 178, 122, 190, 214, 178, 122, 192,  85, 178,  81, 160,
+      80, 179,  80,  13 };
+
+constexpr byte Sound_C3_VEAU [56] PROGMEM = {
+       0,  56,  47,  47, 101, 178,  40,   0,  21, 177,   3, 219,  20, 181,   3,  32,
+      85, 215,  27, 160,   1, 183,   4,  32,   0, 180,   4,  64,  20, 173,  68,  45,
+     149, 173, 100, 165, 233, 170, 101,  66, 149, 168, 109,  95,  69, 165, 116, 220,
+     149, 166,  99,  62, 213, 166,  88,   0 };
+
+constexpr byte Sound_C3_VERT [92] PROGMEM = {
+       0,  92,  47,  47, 196, 178,  64,   0, 144, 182,  75, 187,  80, 181,  43, 190,
+      85, 180,  35, 160,  85, 181,  35, 192,  85, 180,  12, 160, 105, 179,  37,  65,
+     101, 180, 110,  39, 185, 180, 126, 163, 184, 180, 135,  33, 248, 181, 151,  95,
+     248, 182, 143,  96, 244, 183, 143,  96, 248, 183, 126, 195, 244, 183, 126,  36,
+     224, 183, 101,  35, 224, 215, 116,  33, 228, 181,  75, 192, 164, 180, 115, 217,
+      37, 179, 132, 240,  36, 178, 124, 176,  36, 178, 120,  24 };
+
+constexpr byte Sound_C3_VILLAGE [116] PROGMEM = {
+       0, 116,  46,  47, 165, 182,  72,   0, 161, 183,  75, 148, 229, 184,  76,  35,
+     217, 216,  69,  70, 229, 216,  60, 198,  68, 248,  77, 223, 225, 182,  93, 222,
+     250, 182, 127,  61, 186, 182, 159, 186, 185, 181, 175, 188, 185, 180, 175,  61,
+     185, 180, 185,  95, 184, 180, 182, 223, 184, 180, 174,  95, 105, 180, 164, 223,
+     185, 180, 158,  64, 189, 179, 141,  64, 165, 180, 132, 192, 101, 180, 125,  64,
+     169, 179, 124, 192, 133, 179,  99, 192,  69, 186,  85,  62,  33, 218,  62,  80,
+      84, 218,  77, 208,  84, 218, 123, 192, 137, 179, 123,  32, 137, 178, 122, 163,
+     168, 178, 112,  15 };
+
+constexpr byte Sound_C3_VILLE [112] PROGMEM = {
+       0, 112,  47,  47, 164, 182,  88,   0,  86, 183,  67, 183,  85, 215, 108,  32,
+      16, 186,  45,  32,   5, 185,   5,  32, 233, 216,  69,  74, 249, 216,  61,  69,
+     249, 217,  61,  64, 249, 217,  53,  92, 249, 216,  52, 184, 213, 216,  44,  59,
+     229, 215,  69,  94, 182, 183,  77, 189, 250, 182,  77,  63, 241, 182,  76,  32,
+     225, 214,  75, 192, 230, 182,  67,  62, 230, 181,  67, 160, 250, 181,  84,  64,
+     250, 180,  92,  32, 189, 180, 117,  32, 185, 180, 133,  63, 184, 180, 124, 191,
+     164, 179, 116,  32,  85, 179,  99, 160, 105, 179,  91, 137, 101, 179,  96,  15 };
+
+constexpr byte Sound_C3_VINAIGRE [116] PROGMEM = {
+       0, 116,  47,  47,  36, 214,   0,   0, 165, 183,  75,  15, 238, 216,  60,  36,
+     229, 217,  53,  37, 192, 218,  69,  35, 192, 179,  68, 163, 210, 150,  76,  64,
+     220, 180,  68, 221, 229, 183,  94, 189, 229, 183, 127,  61, 229, 182, 143, 220,
+     181, 182, 143, 222, 245, 183, 143,  96, 249, 183, 134, 190, 245, 184, 110, 223,
+     229, 184, 101, 189, 229, 185,  93,  63, 140, 152,  83, 190, 200, 150,  74, 192,
+     192, 183,  90, 160, 165, 181,  75,  33, 165, 179, 100,  65,  85, 178, 124, 192,
+     184, 177, 140, 224,  80, 175, 107, 192,  64, 173, 122, 161,  36, 176,   2,  32,
+      16, 144, 184,  15 };
+
+constexpr byte Sound_C3_VIOLET [100] PROGMEM = {
+       0, 100,  47,  47, 197, 149,  32,   0, 144, 183,  25, 128, 145, 152,  34,  32,
+     149, 183,  27,  33,  89, 183,  52, 161, 167, 183,  61,  33, 170, 215,  61, 163,
+     237, 183,  69,  66, 229, 149, 101, 198, 233, 147, 110,  32, 250, 144, 126,  93,
+     234, 145, 126,  62, 234, 179, 126, 188, 169, 148, 110,  59, 165, 181,  94,  32,
+     233, 181,  93, 221, 248, 182, 102,  63, 244, 182, 126, 223, 244, 183, 134, 223,
+     245, 183, 118, 192, 224, 183, 125, 194, 224, 183, 101,  33, 208, 185,  91, 161,
+     144, 218,  80,   0 };
+
+constexpr byte Sound_C3_VIRAGE [108] PROGMEM = {
+       0, 108,  47,  47, 144, 182,  48,   0, 145, 183,  51,  17, 149, 184,  76, 166,
+     170, 216,  69, 195, 245, 216,  69, 196, 245, 216,  78,  34, 233, 184, 102, 192,
+     169, 182, 118,  60, 149, 181, 109,  54, 101, 179, 166,  64, 105, 177, 174, 161,
+     106, 176, 183,  62, 168, 178, 190, 255, 168, 178, 182,  95, 185, 178, 182, 223,
+     190, 179, 165, 192, 185, 179, 141,  95, 169, 179, 124, 192, 133, 179,  99, 192,
+      69, 186,  85,  63,  33, 218,  62,  80,  84, 218,  77, 208,  84, 218, 123, 192,
+     137, 179, 123,  32, 137, 178, 122, 164, 168, 178, 112,  15 };
+
+constexpr byte Sound_C3_YAOURT [112] PROGMEM = {
+       0, 112,  47,  47, 216, 248,  48,   0, 249, 248,  44,  32, 228, 216,  69,  39,
+     228, 216,  94, 165, 228, 183, 127,  34, 224, 182, 143,  64, 224, 148, 142,  66,
+     224, 174, 116, 222, 232, 169,  91, 221, 153, 167,  91, 219, 149, 166,  99,  95,
+     137, 167,  90,  95, 148, 165,  81, 191, 145, 166,  90,  64,  65, 203, 114, 160,
+      66, 174, 154, 192,  18, 175, 123, 160,  34, 176,   4,  32,  16, 212,  48, 112,
+      16, 212,  48, 112,   0, 215, 237,  48,  17, 214, 156, 176,  86, 180,  84, 176,
+     217, 179,  98, 156, 200, 177, 106, 161, 197, 174, 121, 162, 197, 178, 128,  12 };
+
+constexpr byte Sound_C3_ADDITION [124] PROGMEM = {
+       0, 124,  47,  47,   0, 153, 248,   0,  84, 181, 171, 143, 169, 180, 166,  36,
+     248, 181, 166, 160, 188, 182, 151,  66, 120, 182, 135,  34, 104, 182,  85, 160,
+     148, 182,  59,  32, 152, 182,  64,   1, 148, 215,  56,  80, 165, 215,  60, 144,
+     182, 216,  61, 176, 186, 216,  52, 148, 247, 216,  53,  33, 230, 216,  61, 192,
+     166, 216,  53, 161, 186, 216,  53,  63,   9, 186,   5, 208,   9, 217, 165, 112,
+      14, 216, 197, 208,  10, 218, 238,  80,   9, 218, 230, 208,  25, 218,   6,  80,
+      16, 151, 118,  91,  21, 175,  45, 223,  25, 166,  45,  94,  25, 165,  44, 223,
+      69, 171, 180,  64,  69, 168, 155,  95, 132, 169, 112,  14 };
+
+constexpr byte Sound_C3_ALPHABETIQUE [184] PROGMEM = {
+       0, 184,  47,  47,   0, 153, 248,   0, 169, 179, 190,  45, 185, 180, 183,  64,
+     189, 181, 151,  66, 122, 181, 118, 193, 105, 181, 101, 189,   4, 183,   5, 190,
+       4, 184,   5, 144,  21, 182, 214,  80,  16, 214, 213, 176,   5, 182, 254,  80,
+      25, 182,  77, 176, 168, 180, 142, 169, 190, 180, 159,  60, 190, 181, 151, 222,
+     126, 181, 126, 190, 170, 180,  99, 183, 169, 180,  91,  16, 169, 180,  67,  14,
+      89, 181,  84,  32, 170, 183, 110, 160, 185, 184,  94, 223, 185, 216,  86,  62,
+     122, 216,  69,  53, 148, 183,  72,  48, 212, 183,  96,  80,   9, 212, 168, 112,
+      25, 216, 164,  48,  25, 217, 172, 144, 158, 217,  68, 176, 239, 217,  60,   4,
+     185, 216,  60, 160, 185, 216,  61,  95, 185, 217,  60, 191, 181, 217,  68,  63,
+     245, 217,  42, 191, 224, 217,  32,  48, 128, 216,  40, 112, 128, 216,  40, 112,
+      21, 186, 229,  16,   4, 186, 205, 176, 153, 217,  93,  48, 249, 150, 116,  64,
+     213, 181, 131, 192, 169, 181, 120,  14 };
+
+constexpr byte Sound_C3_ALPHANUMERIQUE [208] PROGMEM = {
+       0, 208,  47,  47,  21, 179,   0,   0, 166, 179, 190,  37, 171, 180, 183,  66,
+     170, 180, 167,  66, 105, 181, 151,  34, 105, 181, 143,  65, 105, 181, 126, 160,
+     105, 181,  94,  64, 169, 181,  85,  61,  80, 185,  60, 188,  21, 180,   5, 176,
+      85, 182, 198,  48,   6, 182, 222, 208,   5, 182, 230,  80,   0, 180, 253, 208,
+       4, 180, 229,  80, 169, 178, 141, 170, 174, 180, 175,  95, 170, 180, 183,  63,
+     105, 182, 159,  64, 104, 182, 126, 190, 152, 181,  69, 160, 152, 214,  69, 160,
+     152, 215,  61,  64, 132, 216,  70,  64,  81, 185,  70, 190,  98, 184,  62,  95,
+     137, 150,  61,  96, 170, 151,  94,  61, 166, 183, 110, 160, 170, 184, 118, 223,
+     102, 184, 110, 223,  41, 183, 102,  62,  41, 182,  45, 144,  33, 214, 117, 208,
+     169, 184,  93, 240, 181, 185,  84, 145, 181, 217,  68,  62, 240, 217,  59,  63,
+     229, 217,  50, 223, 193, 216,  48,  48, 128, 183,  48,  80, 128, 183,  48, 112,
+      65, 181, 248, 112,   4, 217, 253,  16,  10, 217,   5, 176, 237, 184,  84, 176,
+     169, 183, 108, 138, 170, 181, 132,  94, 137, 181, 139, 194, 153, 181, 128,  11 };
+
+constexpr byte Sound_C3_AOUT [72] PROGMEM = {
+       0,  72,  47,  47, 128, 185, 112,   0, 128, 162,  89, 143,  37, 160,  92,  39,
+      85, 168,  84, 161,  84, 170,  93,  95,  81, 171,  85, 190,  81, 141,  70,  93,
+      64, 178,  61, 189, 144, 212,  68,  59, 128, 212,  72,  16, 193, 178,  80, 112,
+     128, 215,  88, 112, 132, 182,  56, 112,   5, 214, 174,  80,  64, 219, 253, 176,
+      21, 214,   5, 208,  21, 214,   0,   5 };
+
+constexpr byte Sound_C3_APPREND [100] PROGMEM = {
+       0, 100,  47,  47,   0, 153, 248,   0, 149, 179, 197,  15, 246, 178, 199,  40,
+     182, 178, 191, 160, 174, 177, 183, 192, 107, 177, 158,  34, 212, 176, 168,  80,
+      65, 182, 176, 112,   0, 182, 254,  48,  18, 145, 212, 176, 197, 175, 228, 208,
+      33, 203,   4, 176,  38, 172, 125,  48,  38, 171, 140,  48,  43, 170, 165,  49,
+      43, 170, 173, 188,  54, 202, 198,  94,  39, 202, 206,  95,  38, 202, 181, 223,
+     107, 202, 148,  62,  69, 169, 155, 192,  69, 166, 155,   0,  69, 163, 131,  11,
+       5, 200,  64,  12 };
+
+constexpr byte Sound_C3_AUGMENTE [152] PROGMEM = {
+       0, 152,  47,  47,   0, 153, 248,   0,  90, 172, 158,  46,  74, 172, 159,  32,
+      22, 169, 167, 161,  42, 171, 119,  33,   6, 170,  79,  63,  39, 170,  61,  32,
+     134, 170,  67,  32,  85, 171,  32,  80,  33, 177,   5,  16,  54, 178, 213,  48,
+      86, 180,  93,  30,  86, 147, 102, 192, 141, 180,  53, 221,  77, 179,  46,  94,
+      74, 183,  38, 222,  22, 169, 183,  95,  38, 172, 191,  95,  39, 203, 191,  95,
+      38, 201, 182, 192,  37, 168, 174,  64,  41, 170, 157, 223,  25, 174, 158,  95,
+     153, 178, 133,  62,  66, 178, 112,  48,  20, 174,  24, 112,  20, 174,  24, 112,
+       1, 183, 253,  16,  17, 215, 214,  48,  69, 182, 117, 176, 150, 180, 100, 140,
+     238, 179, 124, 160, 154, 179, 132, 192, 155, 178, 124, 192,  90, 179,  51,  63,
+     105, 178,  75,  32,  21, 178,   0,  14 };
+
+constexpr byte Sound_C3_AVRIL [124] PROGMEM = {
+       0, 124,  34,  47,  85, 179, 168,   0, 166, 179, 189, 163, 166, 179, 190,  36,
+     169, 179, 190, 160, 170, 179, 166, 194, 170, 178, 150,  32, 170, 177, 108, 191,
+      84, 178, 108,  62,  64, 213,  84,  93,   0, 182, 124,  95,  85, 208,  83, 190,
+     153, 181, 104,  80, 153, 182, 116, 128, 169, 183, 126,  32, 169, 183, 126, 190,
+     181, 184, 102, 223, 181, 184,  94,  62, 181, 216,  93, 191, 182, 216,  85,  62,
+     245, 216,  76, 191, 245, 216,  76,  32, 245, 215,  68,  63, 177, 215,  68,  32,
+     101, 182,  93,  64, 182, 182,  92, 160, 254, 181,  84,  32, 233, 181,  83, 160,
+     170, 181,  91, 160, 173, 181, 123, 192, 174, 180, 155,  64 };
+
+constexpr byte Sound_C3_CASSETTE [120] PROGMEM = {
+       0, 120,  46,  47,  26, 183, 128,   0,  73, 183, 157, 176, 153, 184, 124,  15,
+     169, 183, 135,  40, 185, 182, 159, 191, 185, 182, 143,  62, 168, 182, 117,  63,
+      20, 216, 132, 208,  17, 215, 252, 240,  24, 216, 212, 240, 149, 214, 108, 176,
+     105, 182, 125, 145, 125, 182, 142, 187, 185, 182, 142,  57, 249, 182, 141, 191,
+     232, 183, 124, 160, 229, 183, 116,  62, 217, 183,  99, 191, 128, 182,  80,  48,
+     144, 183, 104,  80, 144, 183, 104, 112,   0, 184, 248, 112,   0, 218, 238,  16,
+      89, 180, 133, 208, 221, 179, 107,  38, 221, 180, 123,  94, 153, 180, 115,  60,
+     165, 179,  90, 166, 145, 179,  64,  15 };
+
+constexpr byte Sound_C3_COULEUR [100] PROGMEM = {
+       0, 100,  47,  47, 128, 180, 192,   0,   0, 146, 202, 144,  85, 182, 245, 144,
+       6, 133,  76, 175,  27, 137,  77,  37,  23, 139,  78,  32,  21, 113,  78, 220,
+      36, 150,  78,  93,  36, 181,  78, 160, 105, 181, 135,  61, 173, 181, 151,  62,
+     185, 180, 158, 223, 189, 179, 166,  96, 189, 179, 158, 127, 110, 179, 158,  64,
+     174, 148, 141,  64,  90, 148, 141, 160,  94, 148, 133,  63,  54, 177, 149,  48,
+      39, 178, 236, 208,  33, 177, 244,  80, 201, 181, 252, 176,  37, 178,   3, 176,
+      37, 178,   0,  12 };
+
+constexpr byte Sound_C3_DECEMBRE [132] PROGMEM = {
+       0, 132,  47,  47, 192, 215,  16,   0,  21, 215,   5, 144, 249, 183,  93, 170,
+     249, 184, 102, 161, 233, 184, 111, 160, 168, 184, 103, 160, 232, 184,  94, 160,
+     216, 184,  77, 191, 169, 216, 101,  64, 233, 215, 102,  48,   5, 215, 125, 240,
+      24, 214, 117, 240,  88, 214, 125, 129, 164, 178, 158, 188, 105, 176, 175,  51,
+     102, 206, 166,  62,  98, 171, 156, 192,  18, 169, 173,  95,  34, 168, 164,  62,
+      34, 169, 107, 160,  98, 168, 115,  32,  36, 163,  51,  64,  76, 170,  59,  64,
+      67, 187,  66, 191,   4, 183,  88, 112,  85, 183, 150,  48,  18, 171,   4, 176,
+      38, 174,   4, 208, 154, 174, 122,  33,  36, 174,  98,  65, 129, 148, 248,  11,
+     129, 148, 248,  10 };
+
+constexpr byte Sound_C3_DEPLACE [116] PROGMEM = {
+       0, 116,  47,  47,   4, 183, 224,   0,   4, 216,   5, 143, 186, 184,  71,  47,
+     169, 184,  95, 160, 169, 184,  87,  32, 170, 184,  70, 191, 154, 181,  51, 190,
+     229, 184,  40,  48,  16, 183,  48, 112,   5, 147, 230,  48, 105, 150,  69,  38,
+      40, 182,  14, 186, 125, 181,  79,  59, 121, 181, 119,  63, 186, 181, 143,  95,
+     184, 182, 134, 191, 181, 182,  93,  32, 100, 182,  61,  16,  97, 216, 132, 240,
+      22, 216, 148, 240, 154, 183,  68, 240, 233, 183,  68,  61, 185, 184,  77,  94,
+     245, 184,  68,  94, 229, 184,  67,  61, 213, 185,  58, 191, 249, 185,  50,  32,
+     248, 185,  40,   9 };
+
+constexpr byte Sound_C3_DISQUETTE [136] PROGMEM = {
+       0, 136,  47,  47, 213, 215,  40,   0, 149, 216,  36, 144,  89, 216,  21, 144,
+     101, 248,  13, 176, 149, 218,  14,  68,  73, 186,   5, 192,  73, 184,   5,  16,
+      68, 184, 237, 176,  84, 183, 237, 112, 196, 153, 237,  80, 196, 153, 232,  16,
+      64, 185, 144, 112,  85, 186, 230, 144, 133, 218,  54, 176, 246, 184,  86, 162,
+     165, 183, 119,  94, 229, 183, 110, 223, 250, 183,  77, 222, 233, 182,  56,  16,
+     228, 182,  64,  16, 192, 182,  80, 112, 208, 215, 112, 112,   0, 215, 248, 112,
+      20, 182, 204, 144,  85, 182, 213, 176,  37, 181,  77,  48, 169, 179, 108,  30,
+      89, 180, 117,  32, 169, 179, 132, 192,  89, 178,  83,  95,  89, 178,  50, 155,
+      25, 177,  42, 136,   5, 179,  96,   3 };
+
+constexpr byte Sound_C3_DIVISION [116] PROGMEM = {
+       0, 116,  47,  47,   0, 214,   0,   0, 154, 216,  52, 176, 254, 216,  51, 143,
+     186, 216,  61,  37, 186, 216,  62,  35, 250, 217,  62, 193, 185, 217,  70,  34,
+     122, 216,  61, 160,  98, 152,  20, 189,  97, 152,  28, 222, 103, 184,  53,  32,
+     182, 216,  61, 160, 250, 216,  62,  64, 190, 216,  62,  64, 187, 216,  69, 190,
+     190, 216,  69,  63, 110, 184,  20, 222, 126, 183,  36,  28,  94, 184,  20, 160,
+      22, 245, 116,  59,  22, 245, 116, 160,  22, 245, 116, 160,  21, 183,   5,  32,
+      97, 150,  85, 192,  41, 168,   4, 224,  41, 162,   3,  95, 136, 179,  82, 224,
+      69, 174,  72,   7 };
+
+constexpr byte Sound_C3_EXPLICATION [176] PROGMEM = {
+       0, 176,  47,  47,   0, 153, 248,   0, 169, 183, 150,  45, 234, 183, 134, 160,
+     102, 184, 119,  65, 118, 184, 102, 190, 217, 152, 100, 160, 213, 183,  96,  16,
+     164, 183, 116,  16,  16, 148,   4, 208,  21, 216, 124, 208,  17, 216,   5,  80,
+      22, 182,   4, 176,   1, 184, 120,  48,  69, 150, 248, 112,  21, 183,   5, 208,
+     118, 216,  62,  32, 123, 216,  62, 191, 187, 217,  61, 190,  20, 185,  24, 112,
+      24, 184, 206,  16, 170, 185,  86,  48, 122, 184,  94, 141, 186, 182, 143,  92,
+     103, 181, 143,  95, 106, 182, 126, 191, 165, 182, 120,  48,  69, 183, 133,  16,
+     150, 216, 140, 176,   1, 217, 140, 240,  30, 216, 253, 112,  85, 185,  61, 112,
+     161, 185,  76,  17, 101, 151,  92, 189,   8, 146,  92, 223,   8, 175, 148,  62,
+      24, 170, 147, 160,  20, 166,   3,  32,  36, 164,   3,  32,  36, 164,   2,  63,
+      36, 196,   1, 191, 132, 174, 138,  63,  68, 205, 121, 169,  68, 176, 128,   6 };
+
+constexpr byte Sound_C3_FEVRIER [140] PROGMEM = {
+       0, 140,  47,  47, 128, 186,  88,   0, 137, 182, 251, 144,  17, 182, 132, 176,
+      17, 181, 253,  48,   0, 184, 245,  80,  17, 182,  77, 112,  21, 181,   5, 208,
+     233, 182, 109,  47, 249, 182, 118, 160, 186, 183, 119, 190, 186, 183, 111, 223,
+     122, 183,  95,  62,  90, 150,  94,  60,  90, 149,  92, 185,  65, 181,  84,  63,
+      20, 180,  93,  32,  85, 179, 108, 161,  33, 211, 116, 189, 101, 179, 125, 144,
+      34, 180, 182,  48, 102, 181,  93, 176, 165, 183,  84, 137, 233, 185,  93, 223,
+     181, 217,  77, 222, 245, 217,  69,  64, 245, 216,  76, 191, 245, 216,  85, 191,
+     224, 184,  93, 224, 213, 184,  93, 192, 229, 184,  85,  32, 181, 184,  85,  63,
+     245, 216,  84, 160, 229, 184,  56,  10, 229, 184,  56,   9 };
+
+constexpr byte Sound_C3_FICHE [112] PROGMEM = {
+       0, 112,  47,  47,   5, 183, 208,   0,   5, 183, 214,  16,  22, 182, 222, 176,
+      69, 182, 255,  48,   9, 184,   7,  80, 122, 216,  71,  37, 246, 216,  62,  32,
+     230, 216,  62,  32, 230, 216,  54,  61, 245, 216,  54,  62, 229, 217,  53, 190,
+     230, 217,  53, 191,  21, 185,   6,  32,  17, 186,   6,  16,   2, 217, 255,  80,
+     101, 218, 255, 112,  24, 218, 255, 112,  41, 218, 254, 208, 101, 218, 254,  48,
+      33, 218, 109, 176,  73, 181, 124, 158, 165, 180, 124,  32, 213, 180, 131, 191,
+     233, 179, 139, 160,  68, 179, 139,  63,  64, 177, 131,  64,   0, 177,  96,  12 };
+
+constexpr byte Sound_C3_INDEX [128] PROGMEM = {
+       0, 128,  47,  47,  64, 153, 232,   0, 148, 213, 158,  43, 229, 180, 158, 192,
+     230, 212, 159,  66, 168, 213, 127,  96, 153, 181,  86,  32, 200, 180,  53,  63,
+     216, 180,  44,  61, 200, 180,  58, 189, 200, 180,  40,  64, 132, 184,  42, 130,
+     172, 182,  84, 160, 249, 182, 118,  89, 249, 184, 126, 224,  32, 181, 248,  16,
+      32, 181, 248,  48,  32, 181, 248,  80,  32, 181, 254,  48,  32, 181, 252, 144,
+      51, 215, 171, 176,  51, 215, 171, 176,  51, 215, 172,  16,  51, 215, 172, 144,
+      51, 215, 172, 176,  50, 215, 180, 176,  26, 215, 204,  48,  26, 215, 204,  48,
+      26, 215, 220,  16, 253, 178,  91, 176, 253, 178,  91, 176, 253, 178,  88,  10 };
+
+constexpr byte Sound_C3_JANVIER [128] PROGMEM = {
+       0, 128,  47,  47, 149, 180,  88,   0, 149, 181,  82, 150,  88, 213,  83, 160,
+     164, 218,  84, 160,   5, 216,  93, 163,  89, 218,  86, 160,   4, 216, 126,  41,
+       5, 144, 110, 163,  21, 172, 134, 193,  21, 167, 182,  64,  69, 170, 165, 161,
+     132, 168, 157, 161, 132, 167, 149,  32,  72, 167, 133,  32,  73, 172,  92, 223,
+       0, 173, 115, 184,  64, 216,  83,  48,  84, 214,  99, 176,  98, 216,  68, 176,
+      89, 184,  60, 187, 218, 216,  59, 190, 233, 216,  51, 221, 248, 216,  59, 192,
+     249, 216,  68, 160, 185, 216,  77, 160, 117, 216,  86,  32, 185, 216,  93, 223,
+     245, 216,  85,  64, 228, 184,  67, 161, 245, 184,  75,  35, 149, 184,  48,  14 };
+
+constexpr byte Sound_C3_JUILLET [100] PROGMEM = {
+       0, 100,  47,  47,  21, 186, 120,   0,  21, 186, 124,   0,  21, 186, 125,  32,
+      25, 186, 117, 160,  30, 186, 118,  80,  30, 186, 118,   0,  16, 216,   6,  36,
+      32, 182,  30,  66,  85, 150,  61, 193, 182, 184,  62, 192, 249, 217,  62,  64,
+     249, 249,  61, 222, 185, 249,  45,  93, 229, 249,  44, 189, 253, 217,  45, 192,
+     249, 217,  78,  32, 185, 184, 103,  95, 185, 183, 119,  94, 185, 183, 118, 160,
+     185, 183, 110,  63, 185, 183, 101, 161, 229, 183,  93,  34, 212, 183,  76,  32,
+     212, 184,  88,  14 };
+
+constexpr byte Sound_C3_JUIN [76] PROGMEM = {
+       0,  76,  47,  47,  89, 182, 104,   0, 168, 181, 106, 145, 169, 181,  91, 191,
+      85, 182,  84, 162,   5, 183,  61,  32,  20, 215,  29, 192,   4, 151,  70,  38,
+      32, 183,  70,  34, 112, 214,  69, 194,  96, 182,  85, 193,  85, 149, 126,  64,
+      85, 180, 150, 223,  85, 180, 158, 223,  81, 180, 174, 223,  21, 179, 174, 221,
+      17, 179, 173, 190,  81, 179, 148,  32,  84, 179,  96,  13 };
+
+constexpr byte Sound_C3_LECTEUR [108] PROGMEM = {
+       0, 108,  48,  47, 249, 181,  96,   0, 188, 181,  69,  67, 173, 181,  62,  67,
+     189, 182,  94, 169, 185, 183, 119,  64, 246, 184, 111,  33, 246, 184,  94,  62,
+     225, 183, 112, 112,  89, 185, 238,  48,  96, 219, 165,  48, 145, 186, 124,  48,
+     149, 184, 112,  48,  69, 218, 232, 112,  68, 249, 156, 144,  64, 182, 237,  48,
+      85, 181,   5, 176, 169, 181,  93, 131, 234, 180, 109, 160, 238, 180, 109, 192,
+     234, 180, 109, 192, 238, 180, 109, 193, 239, 179, 109,  95, 155, 177, 108, 187,
+      86, 176,  84, 176,  82, 208,  88,  17,  65, 215,  16,  17 };
+
+constexpr byte Sound_C3_MAGNETOPHONE [188] PROGMEM = {
+       0, 188,  47,  47, 136, 182,  48,   0, 136, 184,  41, 130, 200, 184,  34,  32,
+     200, 183,  35,  65, 138, 182,  53,  66,  90, 179,  53, 162, 106, 181, 159,  36,
+     123, 181, 159, 162, 168, 183, 143,  65, 152, 182,  69,  36, 104, 184,  85,  34,
+     161, 153,  77,  32, 207, 150,  77,  64, 162, 185,  77,  62, 145, 217,  77, 160,
+     150, 217,  86,  63, 186, 217, 110, 223, 124, 216,  94,  62, 188, 216,  76, 153,
+     249, 216,  56,   0, 232, 216,  80,  48, 209, 184,  88,  80,   6, 215, 205, 176,
+      38, 181,   5, 176, 170, 178, 108, 161,  94, 175, 125, 221,  27, 173, 117,  63,
+     158, 174, 115, 191,  91, 206, 124, 240, 219, 207, 132, 240, 153, 175, 123, 149,
+     185, 175, 148, 192, 185, 176, 149,  62, 190, 177, 149,  64, 233, 179, 116,  95,
+     150, 180, 107, 190, 206, 176,  50, 191, 207, 178,  50, 192, 203, 182,  51,  65,
+     207, 184,  51,  64, 207, 181,  50, 160, 203, 182,  51,  64, 170, 181,  84,  32,
+      86, 181, 100,  64,  21, 179, 115, 223,  73, 179,  88,  14 };
+
+constexpr byte Sound_C3_MAI [76] PROGMEM = {
+       0,  76,  47,  47, 136, 149,  48,   0, 140, 180,  66, 188, 206, 179,  58, 160,
+     200, 181,  50, 160, 141, 182,  60, 162, 141, 182,  61,  33, 141, 182,  69,  65,
+     141, 149,  61, 194,  69, 181,  62,  37, 166, 182, 134, 160, 185, 182, 142, 160,
+     169, 183, 142, 192, 169, 184, 134, 223, 169, 184, 134,  59, 169, 184, 125, 187,
+     164, 184, 117,  60, 164, 184, 124,  32, 228, 184, 120,  12 };
+
+constexpr byte Sound_C3_MARS [112] PROGMEM = {
+       0, 112,  47,  47,  72, 181,  72,   0, 200, 181,  58, 188, 140, 181,  51, 192,
+      76, 179,  29,  35,  12, 179,   5, 161,  28, 177,   6,  65, 106, 178, 167, 163,
+     102, 179, 191, 192, 101, 178, 199,  96, 102, 178, 191,  93, 102, 177, 182, 222,
+      38, 177, 166,  61,  38, 177, 141,  62,  38, 176,  67, 208, 128, 185, 253,  80,
+      41, 178, 221,  80,   4, 181, 253, 208,  68, 219, 252, 208,  64, 186, 252,  80,
+      37, 216,  52,  80,  25, 216,  44,  80,   1, 216,  44,  80,   1, 215,  35, 208,
+     253, 178,  91,  48, 253, 178,  91,  48, 253, 178,  88,   9, 253, 178,  88,  11 };
+
+constexpr byte Sound_C3_MOIS [60] PROGMEM = {
+       0,  60,  47,  47, 217, 176,  40,   0,  76, 181,  52,  57,  76, 184,  36, 161,
+      76, 184,  45,  37, 130, 187, 133,  65, 200, 187, 149, 162, 136, 175, 165, 193,
+     137, 170, 174,  32,  86, 173, 166, 223, 106, 175, 182, 222, 122, 175, 190, 189,
+     164, 175, 181, 192, 100, 174, 123, 160, 101, 175,  88,   8 };
+
+constexpr byte Sound_C3_MONITEUR [128] PROGMEM = {
+       0, 128,  41,  47, 201, 182,  32,   0, 200, 182,  44, 194, 200, 184,  53,  66,
+     201, 184,  53, 195,  22, 174,  95,  36,  22, 175,  95,  34,  23, 179,  95, 194,
+     151, 181,  87,  33, 153, 182,  78,  34, 217, 213,  77, 160, 148, 216,  77, 192,
+     209, 216,  86,  63, 218, 216,  78, 221, 214, 216,  70,  63, 229, 216,  53,  60,
+     196, 216,  64, 112,  65, 215,   0, 112,  66, 185, 238,  48,  73, 184, 198,  48,
+      89, 181,  69,  19, 234, 180, 126,  63, 235, 180, 134, 188, 170, 179, 142, 190,
+     170, 179, 150, 224, 174, 179, 142,  94, 234, 179, 125,  64, 154, 180, 125,  64,
+     233, 179, 116, 192, 170, 180, 108,  95, 154, 180,  91, 192, 150, 178,  91, 191 };
+
+constexpr byte Sound_C3_MONOCHROME [176] PROGMEM = {
+       0, 176,  47,  47, 202, 180,  40,   0, 200, 183,  42,   5, 200, 179,  34, 192,
+     197, 182,  36,  33, 138, 182,  53,  67,  25, 169,  62,  36,  42, 169,  70, 161,
+      38, 171,   7,  35,  22, 175,   7,  66,   6, 177,   6, 161,  72, 181,  69, 192,
+      73, 181,  69,  32,  22, 179,  54, 189,  21, 177,   6, 190,  21, 172,   6, 222,
+      41, 171,   6,  63,  46, 171,   5,  63,  69, 171,  96, 112, 192, 152, 216, 112,
+      66, 173, 220, 176,  18, 171,  93,  48, 134, 186, 204, 160,  38, 166,   4, 144,
+      43, 168, 125,  48,  91, 168, 139, 145,  42, 166, 125,  92,  26, 167, 133,  64,
+      25, 166, 133, 192,  29, 166, 141,  32,  77, 170, 124,  32, 137, 169, 107, 192,
+      72, 169,  99,  32,  72, 184,  52,  63,  72, 183,  44, 160, 141, 182,  44, 192,
+     157, 177,  43, 192, 218, 177,  51, 192, 158, 177,  43, 192, 122, 176, 100,  63,
+     105, 176, 124, 160,  26, 176,   4, 160, 106, 177, 132, 192,  42, 177, 112,  12 };
+
+constexpr byte Sound_C3_MULTIPLICATION [184] PROGMEM = {
+       0, 184,  47,  47, 224, 249,  24,   0, 202, 148,  26, 164, 197, 151,  28,  32,
+     209, 152,  28, 161, 197, 152,  36, 195, 208, 152,  45, 164, 145, 151,  54, 162,
+     101, 183,  14, 193, 241, 151,  53,  66, 176, 183,  35, 160,  85, 214,   0,  80,
+      65, 182,   0, 112,  89, 215, 188, 176, 158, 216,  36, 176, 235, 216,  44,  26,
+     251, 216,  45,  32, 247, 184,  53, 191, 151, 151,  53,  58, 209, 184,  40, 112,
+      69, 181,   5,  48,  88, 215,   5,  80, 186, 216,  53, 162, 249, 216,  46,  63,
+     246, 216,  45, 190, 242, 217,  44, 189, 133, 183,   8,  48, 209, 184,  40,  80,
+      72, 182,   4, 144,  68, 178, 102,  48, 246, 184,  78, 166, 230, 183, 111,  59,
+     186, 182, 111,  94, 170, 182, 110, 191, 186, 182, 110,  32, 153, 216, 124, 240,
+      73, 215, 236, 240,  89, 218, 237, 112, 169, 216,  45,  80,  73, 147, 101,  90,
+     136, 175, 115, 223, 153, 169, 106, 192, 104, 166,  98, 192, 132, 187,  98, 223,
+     200, 185,  66,  36, 129, 184, 144,  14 };
+
+constexpr byte Sound_C3_NOVEMBRE [152] PROGMEM = {
+       0, 152,  47,  47,  68, 180,  64,   0, 140, 182,  58,  61, 204, 180,  42, 161,
+     140, 182,  44, 161, 140, 182,  53,  34, 140, 182,  53, 163, 140, 181,  53, 193,
+     140, 181,  61, 194,  86, 179,  87,  35, 169, 175, 118, 192, 169, 174, 126,  95,
+     173, 173, 117, 189,  84, 173, 100, 189,   0, 178, 116,  62,  64, 215, 120,  80,
+       0, 216, 109,  80,   0, 172, 100,  59, 185, 172, 133,  64, 102, 172, 149, 222,
+     165, 171, 132,  95, 166, 170, 115,  95,  20, 166, 139, 192,  80, 167,  99,  64,
+      88, 166,  74, 190,  25, 162,  50, 160,  67, 186,  58, 165, 140, 168,  56,  48,
+     128, 211,  32,  80,  70, 211, 141, 176,  18, 192,   3,  48,  22, 170,   3, 176,
+      17, 173,   5,  80,  38, 206,  83, 176, 107, 174, 106, 128, 157, 174, 122, 160,
+     105, 174, 114,  64, 105, 174, 112,  14 };
+
+constexpr byte Sound_C3_NUMERIQUE [132] PROGMEM = {
+       0, 132,  47,  47,   0,   0,   0,   0, 152, 215,  58, 175, 152, 215,  60,  32,
+     152, 215,  61,  32, 132, 216,  69, 160, 132, 216,  69, 192,  81, 185,  70,  62,
+      98, 184,  61, 223, 137, 150,  61,  96, 170, 151,  94,  61, 166, 183, 110, 160,
+     170, 184, 118, 223, 102, 184, 110, 223,  41, 183, 102,  62,  41, 182,  45, 144,
+      33, 214, 117, 208, 169, 184,  93, 240, 181, 185,  84, 145, 181, 217,  68,  62,
+     240, 217,  59,  63, 229, 217,  50, 223, 192, 216,  80, 112, 192, 216,  80, 112,
+     192, 216,  80, 112,   9, 183, 220, 176,  89, 217,  84,  48, 233, 184,  82, 156,
+     229, 184, 107, 160, 229, 181, 139,  64, 229, 180, 139,   2, 213, 180, 138, 137,
+     213, 180, 136,  14 };
+
+constexpr byte Sound_C3_OCTOBRE [136] PROGMEM = {
+       0, 136,  47,  47,   0, 152, 176,   0,  85, 175, 147, 140, 235, 176, 158, 161,
+     166, 174, 134,  65,  98, 174, 124, 160,  96, 178, 120, 112,  33, 179, 237, 176,
+      32, 213, 182,  48,   1, 182, 158, 176,  70, 215, 100, 176,  82, 213,  96,  80,
+      82, 213,  96, 112,   1, 216, 214, 176, 213, 181, 117, 183, 165, 179, 135,  34,
+     105, 177, 159,  94,  89, 175, 167,  94,  89, 175, 158, 191, 170, 175, 141, 191,
+     169, 174, 116,  32, 229, 173, 108,  32, 232, 172,  99,  32, 165, 173, 104,  16,
+     128, 179, 112, 112,   1, 180, 149,  48, 102, 203, 100,  48,  18, 171,   3, 208,
+      37, 173,   4, 176,  22, 175, 237, 176, 102, 173,  84,  80,  81, 173, 130, 192,
+      88, 174, 114,  33,  92, 174,  80,  14 };
+
+constexpr byte Sound_C3_REGARDE [144] PROGMEM = {
+       0, 144,  47,  47,  41, 173,  64,   0,  22, 205, 116, 176,  34, 172, 196, 208,
+      22, 171,  84, 208,  22, 173, 125, 174,  26, 174, 126, 166,  90, 176, 135,  34,
+     107, 180, 111,  64,  27, 150,   6, 184, 139, 151,  60, 187, 137, 149,  67,  63,
+     134, 148,  48,  80,  25, 184,  78,  48, 182, 184,  94,  62, 166, 184, 135,  62,
+     106, 183, 159,  62, 175, 181, 175,  62, 191, 180, 183,  32, 170, 179, 191,  95,
+     186, 179, 198, 160, 170, 178, 198,  63, 186, 177, 198,  64, 105, 176, 190,  64,
+     109, 175, 173, 191, 110, 175, 165,  32, 170, 174, 164, 160, 104, 174, 156, 192,
+     190, 176, 156, 192, 174, 177, 140,  63,  64, 183,  64, 112,  42, 180,  60, 176,
+     170, 181, 132,  48, 238, 180, 140,  28, 252, 180, 139, 192,  90, 180, 144,  14 };
+
+constexpr byte Sound_C3_REGLE [116] PROGMEM = {
+       0, 116,  47,  47,  37, 178, 104,   0,  41, 177,  27, 150,  37, 178,  69,  16,
+      25, 178, 166,  80,  41, 178, 166,  40, 174, 180, 174, 197, 191, 180, 167,  33,
+     186, 182, 159,  64, 185, 183, 151,  95, 185, 183, 142, 221, 122, 184, 126, 222,
+     122, 184, 118,  62, 185, 185, 101, 191, 181, 153,  84, 160, 160, 185,  56,  80,
+      80, 185,  80, 112,   4, 119, 253, 176, 177, 185,  75, 176, 176, 216,  83, 159,
+     161, 184,  92,  32, 253, 181,  99, 190, 253, 181,  99,  63, 173, 181,  99, 192,
+     110, 180, 100,  63, 169, 181, 140, 191, 253, 180, 156,  32, 170, 180, 155,  63,
+     154, 180, 160,  15 };
+
+constexpr byte Sound_C3_RETENUE [128] PROGMEM = {
+       0, 128,  47,  47,  18, 165,   0,   0,  38, 171,   2, 150,  34, 170,   4,  16,
+      34, 170,   4,  13,  22, 168,   5,  16,  22, 170,   5,  40,  22, 172,   6,  42,
+      26, 175, 118, 165,  26, 180, 111,  64,  25, 181,  78,  32, 153, 179,  96,  48,
+     154, 214, 120, 112,  26, 214, 141,  16,   1, 214, 109,  48,  22, 181,  45,  30,
+     166, 180, 101, 160, 106, 181, 110, 187,  90, 182,  88, 223,  88, 183,  78,  62,
+     157, 181,  61,  64, 233, 182,  61,  61, 148, 182,  52, 221, 148, 182,  44,  94,
+      80, 184,  52, 160, 160, 184,  69,  95, 177, 183,  69,  95, 161, 151,  68, 189,
+     177, 151,  60,  64, 176, 183,  59, 190, 177, 151,  51,  32, 113, 183,  48,  15 };
+
+constexpr byte Sound_C3_RETIENT [120] PROGMEM = {
+       0, 120,  47,  47,  40, 173,   0,   0, 107, 173, 122, 150, 106, 173, 124,  32,
+      41, 172, 132, 160,  22, 168, 108,  66,  38, 169,   4, 166,  38, 170,   5, 166,
+      42, 172,   6,  41,  26, 175, 151,  36,  90, 180, 127,  65,  90, 181, 102, 160,
+     202, 178, 112,  48, 217, 178, 120, 112,  86, 217, 132, 208,  10, 216, 109,  48,
+       9, 218,   5, 240, 102, 216,  61,  49, 118, 216,  86,  55, 101, 216, 103,  31,
+     102, 184, 127,  63, 105, 183, 151,  61,  42, 181, 167,  94,  89, 180, 183,  32,
+     106, 179, 183,  95,  42, 179, 182, 191, 107, 179, 182,  63, 101, 178, 140,  64,
+      85, 178, 107,  35,  16, 211,  56,  15 };
+
+constexpr byte Sound_C3_SEMAINE [112] PROGMEM = {
+       0, 112,  47,  47, 155, 213,  88,   0,  75, 215,  45,  16,  75, 215, 116, 176,
+      27, 213,   5, 112,  11, 212, 173, 112, 217, 179, 101,  47, 229, 180, 109, 168,
+     229, 180, 110,  62, 230, 179, 101, 188, 216, 145,  68,  61, 201, 147,  52, 253,
+      89, 180,  77,  60, 101, 181, 142,  60, 185, 182, 150,  62, 185, 182, 150,  64,
+     249, 182, 141, 223, 228, 183, 133,  32, 170, 183, 125,  64, 251, 182, 109,  95,
+     206, 180,  51, 160, 206, 177,  51,  32, 205, 178,  59,  96, 205, 178,  59,  96,
+     148, 181,  99,  63, 170, 180, 122, 194, 101, 180, 122,  35, 101, 180, 120,  12 };
+
+constexpr byte Sound_C3_SEPTEMBRE [168] PROGMEM = {
+       0, 168,  47,  47,  24, 182, 248,   0,   4, 181, 237,  48,  16, 215, 237, 176,
+       1, 214, 237, 208,  20, 214, 214,  80,  21, 214, 174, 112, 244, 182, 118,  43,
+     181, 182, 135,  64,  96, 148, 108, 187, 212, 181, 131,  32, 208, 182, 128,  16,
+     209, 214, 128,  80,  85, 215, 117,  48,  21, 215,   5, 176, 192, 215, 120,  48,
+     132, 215, 112, 112,  10, 184, 252, 144,  85, 182, 125, 176, 166, 180, 134, 190,
+     150, 178, 151,  61,  85, 175, 166, 188, 102, 173, 166,  63,  38, 172, 157, 190,
+     103, 172, 140, 190,  85, 171, 124,  32,  82, 169, 131, 191,  82, 169, 123,  32,
+     150, 169, 147, 191,  25, 164, 155, 192,  24, 162,  99,  32,  76, 169,  58, 190,
+     140, 174,  32,  48,  24, 160,   0,  80,  23, 170,  88, 112,  27, 171,   5,  16,
+      35, 174, 125, 176, 154, 174, 131, 176, 158, 174, 138, 161,  85, 175,  90, 160,
+     106, 177, 121, 165,  90, 176,  96,  12 };
+
+constexpr byte Sound_C3_SON [68] PROGMEM = {
+       0,  68,  47,  47,  22, 215, 232,   0,   5, 215, 253, 208,  18, 217, 254, 112,
+       6, 214, 254, 112,   2, 214, 254, 176,  70, 218, 254, 208,  38, 172,   6,  72,
+      21, 172,   6,  94, 133, 178, 142,  61, 133, 213, 134,  94, 134, 213, 125, 190,
+     133, 213, 125,  61, 132, 212, 116, 188, 132, 211, 108,  61, 132, 209,  99, 160,
+      68, 173,  80,  14 };
+
+constexpr byte Sound_C3_SUIS [68] PROGMEM = {
+       0,  68,  47,  47,  40, 245,  24,   0,  29, 246,   3, 176,  10, 245,   4, 176,
+       0, 248, 253, 112,   1, 251, 253, 240,  17, 252, 254, 240,  21, 247, 254,  48,
+      21, 183,   6,  15,  34, 152,   6,  68,  34, 184,   6, 127, 118, 184,  54,  60,
+     181, 217,  61, 223, 245, 217,  61,  59, 229, 217,  52,  61, 225, 217,  51, 191,
+     240, 217,  40,   7 };
+
+constexpr byte Sound_C3_TRAVAIL [152] PROGMEM = {
+       0, 152,  47,  47,  65, 183, 232,   0,  98, 179,  93,  48,  96, 180, 172, 176,
+     101, 179, 204, 176, 117, 178,   4, 176,  85, 177, 140, 143, 170, 176, 166,  41,
+     170, 176, 199,  64, 170, 177, 183,  64, 175, 177, 150,  60, 174, 178, 124, 187,
+     174, 177, 124, 144, 173, 177, 108, 176, 105, 177,  28, 176, 109, 177, 108, 155,
+     238, 177, 158,  62, 238, 178, 174, 187, 254, 178, 174, 191, 250, 178, 182, 192,
+     249, 178, 190, 192, 250, 179, 182,  95, 249, 181, 174,  64, 253, 182, 149, 223,
+     233, 182, 133,  32, 233, 183, 125,  32, 249, 215,  93,  64, 249, 215,  84,  63,
+     233, 216,  67, 160, 244, 216,  59,  63, 212, 215,  58, 192, 228, 215,  58,  63,
+     228, 216,  66, 160, 233, 183,  75,  32, 229, 183,  99,  32, 246, 183,  99,   5,
+     246, 183, 107,   1, 246, 182, 112,  14 };
+
+// VOLUME is twice in catalog 3, this is the second one
+constexpr byte Sound_C3_VOLUME_2 [124] PROGMEM = {
+       0, 124,  47,  47,   5, 179,   0,   0,   1, 180,   3, 151,   1, 145,   4, 193,
+      21, 175,   5,  34,  17, 174,   5, 168, 106, 173, 110,  40, 107, 173, 118, 164,
+     155, 175, 127,  65, 150, 146, 119,  64,  85, 148, 102, 190,  37, 117,  54,  61,
+      36, 117,   6,  61,  36, 150,   6, 187,  20, 150,   6,  92,  37, 183,   7,  64,
+      32, 184,   7,  95,  32, 183,   7,  95,  32, 151,   6,  95,  73, 151,  61, 191,
+     137, 149,  52, 224, 143, 149,  52, 223, 143, 150,  52, 192,  78, 149,  45,  63,
+      78, 180,  61,  64,  78, 180,  52, 161,  25, 178,  92, 161, 105, 178, 164, 192,
+     106, 178, 172,  64, 106, 178, 155, 160,  25, 178, 128,  15 };
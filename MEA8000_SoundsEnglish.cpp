@@ -0,0 +1,162 @@
+/*
+
+    MEA8000_SoundsEnglish.cpp
+
+    The numbers in English (Sound_ZerOO .. Sound_And).
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// Numbers in English 
+//
+constexpr byte Sound_ZerOO [56] PROGMEM = { 0x89, 0x91, 0x88, 0x00, 0x95, 0x91, 0x83, 0x20, 0xE4, 0x90, 0x95, 0xA2, 0xE4, 0x90, 0x96, 0x25, 
+                                            0xF8, 0x90, 0x96, 0xC1, 0xED, 0x90, 0x97, 0x5F, 0xE8, 0x91, 0x8E, 0xFF, 0xE9, 0x90, 0x86, 0xDE, 
+                                            0xDA, 0x90, 0x7D, 0x7F, 0xDE, 0x8F, 0x7D, 0x20, 0xC5, 0x8E, 0x74, 0xFE, 0xD5, 0x8D, 0x73, 0xE0, 
+                                            0xD9, 0x8D, 0x7B, 0xE0, 0xD4, 0xB0, 0x70, 0x40 };
+                       
+constexpr byte Sound_One [64] PROGMEM = {   0x20, 0xA0, 0x70, 0x00, 0x95, 0x85, 0x6B, 0x40, 0x9A, 0x89, 0x7D, 0x41, 0x9A, 0x8C, 0x96, 0xC2,
+                                            0xA9, 0x8E, 0x9F, 0x41, 0xAA, 0x8F, 0x9F, 0x5E, 0xA8, 0x8F, 0x97, 0x3F, 0xA8, 0x8F, 0x96, 0xDE, 
+                                            0x80, 0x91, 0x64, 0xDD, 0x80, 0x6C, 0x6C, 0x40, 0xC0, 0x8D, 0x6B, 0x7F, 0x80, 0x8E, 0x6A, 0xE0, 
+                                            0x80, 0xB3, 0x62, 0x40, 0x95, 0xB3, 0x84, 0x20, 0xE4, 0xB3, 0x7A, 0xC0, 0x50, 0xB1, 0x91, 0xE0 };
+                            
+constexpr byte Sound_Two [64] PROGMEM = {   0x11, 0xD7, 0xC7, 0x30, 0x01, 0xD8, 0x97, 0x30, 0x42, 0xB9, 0xFF, 0x50, 0x8A, 0xB7, 0xFE, 0xB0, 
+                                            0x36, 0xB5, 0x25, 0xB0, 0xED, 0x94, 0x76, 0xA0, 0xEA, 0x94, 0x76, 0xDE, 0xEA, 0x94, 0x6E, 0xDE, 
+                                            0xEF, 0x93, 0x66, 0x5E, 0xEA, 0x92, 0x65, 0xDE, 0xEE, 0x92, 0x6C, 0xDE, 0xD5, 0x90, 0x63, 0xC0, 
+                                            0xD4, 0x8E, 0x63, 0x5E, 0xD9, 0x8E, 0x63, 0x60, 0xD5, 0x8D, 0x63, 0x40, 0xD5, 0xAE, 0x6A, 0xC0 };
+                
+constexpr byte Sound_Three [72] PROGMEM = { 0x40, 0xB9, 0xF8, 0x10, 0x45, 0xB9, 0xFA, 0x50, 0x40, 0xB9, 0xFC, 0xD0,
+                                            0x45, 0xB9, 0xF6, 0x50, 0x55, 0xB9, 0xC6, 0xB0, 0x56, 0xB6, 0x9E, 0x90, 0xA6, 0x93, 0x84, 0x20, 
+                                            0xE4, 0x93, 0x6D, 0x3F, 0xA0, 0x93, 0x75, 0xDE, 0xA5, 0x94, 0x6E, 0xE0, 0xE5, 0xB7, 0x6F, 0x7F,
+                                            0xE4, 0xB8, 0x66, 0x7E, 0xE4, 0xB9, 0x65, 0x40, 0xE4, 0xB9, 0x5C, 0x7F, 0xE4, 0xB9, 0x5C, 0x40, 
+                                            0xE1, 0xD9, 0x53, 0x40, 0xE0, 0xBA, 0x62, 0xFC, 0x84, 0xB7, 0x71, 0x40 }; 
+                                        
+constexpr byte Sound_Four [64] PROGMEM = {  0x10, 0xBA, 0xFC, 0x10, 0x05, 0xB5, 0xFD, 0xF0, 0x84, 0xB5, 0xFD, 0xD0, 0x85, 0xB3, 0xE5, 0x30, 
+                                            0x90, 0xAB, 0x8C, 0xA0, 0x90, 0xAA, 0x8D, 0xC0, 0x90, 0xAA, 0x8D, 0xC0, 0x90, 0xA9, 0x8D, 0xFF,
+                                            0xA5, 0xA9, 0x8D, 0xDE, 0xAA, 0xA9, 0x8D, 0xDF, 0xE9, 0xA9, 0x8D, 0x7F, 0xE9, 0xAA, 0x8C, 0xDF,
+                                            0xF8, 0xAA, 0x84, 0x40, 0xB5, 0xAA, 0x7A, 0xC0, 0xA4, 0xAA, 0x79, 0x40, 0x54, 0xAB, 0x80, 0x41 };
+
+constexpr byte Sound_Five [84] PROGMEM = {  0x55, 0xB6, 0x78, 0x10, 0x09, 0xB7, 0xFD, 0x50, 0x15, 0xB4, 0xFE, 0x70, 0x45, 0xB6, 0xFE, 0x70, 
+                                            0x55, 0xB5, 0xFE, 0x30, 0x99, 0xBF, 0x9E, 0xC0, 0xAE, 0x8E, 0x9F, 0x5F, 0xAD, 0xAF, 0x9F, 0x40, 
+                                            0xAC, 0xB0, 0x9F, 0x7F, 0xAC, 0xB0, 0x9E, 0xDF, 0xAB, 0xB3, 0x9E, 0x7E, 0xE8, 0xB4, 0x9D, 0xDF, 
+                                            0xE8, 0xB4, 0x8D, 0xC0, 0xE4, 0xB5, 0x7C, 0x7F, 0xE8, 0xB5, 0x74, 0x40, 0x69, 0xB5, 0x7B, 0xB0,
+                                            0x89, 0xB5, 0x6B, 0xD0, 0xE4, 0xB2, 0x7B, 0x50, 0xE4, 0xB2, 0x7B, 0xB0, 0xD4, 0xB2, 0x7A, 0xA1, 
+                                            0x91, 0xB4, 0x71, 0x40 };
+
+constexpr byte Sound_Six [92] PROGMEM = {   0x01, 0xDB, 0xF8, 0x10, 0x05, 0xDB, 0xFC, 0x30, 0x06, 0xDB, 0xFD, 0x50, 0x05, 0xFB, 0xFD, 0xF0,
+                                            0x01, 0xFB, 0xFE, 0xF0, 0x87, 0xBB, 0xFF, 0x30, 0x4B, 0xBB, 0xFE, 0x30, 0xE8, 0xB5, 0x76, 0xA0,
+                                            0xE9, 0xB5, 0x77, 0xBE, 0xF8, 0xB6, 0x77, 0xBC, 0xE5, 0xB6, 0x77, 0x3B, 0xE9, 0xB7, 0x7E, 0xBB, 
+                                            0xD5, 0x98, 0x6C, 0x5E, 0xD0, 0xB7, 0x71, 0xC0, 0xC0, 0xD6, 0x68, 0x40, 0x40, 0xB4, 0x60, 0x40,
+                                            0x40, 0xD6, 0x30, 0x40, 0x40, 0xB5, 0x80, 0x20, 0x26, 0xB4, 0xBE, 0x30, 0x01, 0xD7, 0xFE, 0x50,
+                                            0x04, 0xFC, 0xFE, 0x50, 0x08, 0xF9, 0xFB, 0x70, 0x05, 0xFA, 0xF8, 0xD0 };
+                                    
+constexpr byte Sound_Seven [108] PROGMEM = {    0x01, 0xDB, 0xF8, 0x10, 0x05, 0xDB, 0xFC, 0x30, 0x06, 0xDB, 0xFD, 0x50, 0x05, 0xFB, 0xFD, 0xF0, 
+                                                0x01, 0xFB, 0xFE, 0xF0, 0x87, 0xBB, 0xFF, 0x30, 0xE8, 0xB3, 0x8F, 0xC1, 0xE8, 0xB3, 0x8F, 0x5F, 
+                                                0xE8, 0xB3, 0x86, 0xBF, 0xE4, 0xB2, 0x7D, 0x3F, 0x94, 0xB5, 0x6C, 0x5E, 0xA5, 0xB5, 0x6C, 0xBE, 
+                                                0xE4, 0xB1, 0x6D, 0x20, 0xE8, 0xB1, 0x7E, 0x3F, 0xE8, 0xB1, 0x86, 0x3F, 0xE8, 0xB1, 0x8D, 0xBE, 
+                                                0xEC, 0xB2, 0x85, 0x5E, 0xE8, 0xB1, 0x7D, 0x3F, 0xC0, 0x8E, 0x63, 0xBF, 0xC0, 0x8E, 0x5B, 0x5F,
+                                                0xC0, 0xB2, 0x5B, 0x60, 0xD6, 0xB1, 0x6C, 0x20, 0xD4, 0xB3, 0x7C, 0x40, 0xE4, 0xB3, 0x7B, 0xBD, 
+                                                0x80, 0xB5, 0x61, 0x5B, 0xA9, 0xB4, 0x70, 0x3E, 0x50, 0xD8, 0x8A, 0xD0 };
+                    
+constexpr byte Sound_Eight [64] PROGMEM = {     0xE8, 0xB3, 0x90, 0x00, 0xE8, 0xB4, 0x95, 0x20, 0xE8, 0xB4, 0x97, 0x5F, 0xE8, 0xB5, 0x87, 0x5F, 
+                                                0xE8, 0xB7, 0x7E, 0xDF, 0xE8, 0xB8, 0x76, 0x5D, 0xE0, 0xB9, 0x5B, 0x5B, 0xE0, 0xD8, 0x6C, 0x39, 
+                                                0xC0, 0xD6, 0x71, 0x5D, 0x40, 0xD6, 0x70, 0x7F, 0x15, 0xB6, 0xC0, 0x70, 0x56, 0xD7, 0xDF, 0xB0,
+                                                0x12, 0xDA, 0xFE, 0xD0, 0x7B, 0xB5, 0xB4, 0xF0, 0x40, 0xB4, 0x9A, 0x70, 0x40, 0xB4, 0x98, 0x50 };
+                                                
+constexpr byte Sound_Nine [68] PROGMEM = {  0x40, 0xB5, 0x78, 0x00, 0xD0, 0xAA, 0x5B, 0xC0, 0xC0, 0xAC, 0x5C, 0xC1, 0xC0, 0xD0, 0x65, 0xC0,
+                                            0xE9, 0xB2, 0x7E, 0xA1, 0xE8, 0xB2, 0x86, 0xA1, 0xF8, 0xB2, 0x96, 0xC0, 0xE8, 0xB3, 0x97, 0x5E,
+                                            0xF9, 0xB3, 0x96, 0xDF, 0xF9, 0xB4, 0x96, 0xDF, 0xE8, 0xB5, 0x8E, 0x5E, 0xE8, 0xB6, 0x7D, 0xDF,
+                                            0xD4, 0xB7, 0x7C, 0xDF, 0x84, 0xAB, 0x73, 0x21, 0x80, 0xAC, 0x62, 0xE0, 0xC5, 0xAE, 0x62, 0xE0,
+                                            0x00, 0x00, 0x00, 0x3B  };
+                                     
+constexpr byte Sound_Ten [76] PROGMEM = {   0x00, 0xB6, 0x90, 0x10, 0x11, 0xD7, 0xD6, 0xB0, 0x45, 0xD7, 0xF7, 0xB0, 0x0A, 0xB7,
+                                            0xFF, 0x50, 0x2A, 0xB5, 0xC6, 0x30, 0xA9, 0xB5, 0x8D, 0xA0, 0xE8, 0xB5, 0x87, 0x40, 0xF8, 0xB5, 
+                                            0x97, 0x5E, 0xF8, 0xB5, 0x97, 0x5E, 0xE8, 0xB5, 0x96, 0xDE, 0xE8, 0xB5, 0x96, 0x3E, 0xE8, 0xB4, 
+                                            0x7D, 0x3D, 0x90, 0xAC, 0x63, 0xBF, 0x80, 0x8D, 0x5C, 0x5F, 0xC0, 0xAD, 0x64, 0x40, 0xC0, 0xAD, 
+                                            0x6B, 0xA0, 0xC0, 0xAD, 0x6A, 0xA0, 0xC4, 0xAD, 0x69, 0xA0, 0xC0, 0x96, 0x70, 0x59 };
+
+constexpr byte Sound_Eleven [120] PROGMEM = {   0x10, 0xD8, 0x58, 0x00, 0xE2, 0xB8, 0x65, 0x40, 0xE8, 0xB8, 0x6E, 0xC0, 0xE8, 0xB6,
+                                                0x6F, 0xC0, 0xE8, 0xB6, 0x6F, 0x20, 0xE1, 0xD4, 0x5D, 0xC0, 0xE0, 0xD4, 0x65, 0xC0, 0xE4, 0xD3, 
+                                                0x5D, 0xC0, 0xE8, 0xB3, 0x76, 0xA1, 0xE8, 0xB3, 0x87, 0xA4, 0xE8, 0xB3, 0x8F, 0xC1, 0xE8, 0xB3,
+                                                0x8F, 0x5F, 0xE8, 0xB3, 0x86, 0xBF, 0xE4, 0xB2, 0x7D, 0x3F, 0x94, 0xB5, 0x6C, 0x5E, 0xA5, 0xB5,
+                                                0x6C, 0xBE, 0xE4, 0xB1, 0x6D, 0x20, 0xE8, 0xB1, 0x7E, 0x3F, 0xE8, 0xB1, 0x86, 0x3F, 0xE8, 0xB1,
+                                                0x8D, 0xBE, 0xEC, 0xB2, 0x85, 0x5E, 0xE8, 0xB1, 0x7D, 0x3F, 0xC0, 0x8E, 0x63, 0xBF, 0xC0, 0x8E,
+                                                0x5B, 0x5F, 0xC0, 0xB2, 0x5B, 0x60, 0xD6, 0xB1, 0x6C, 0x20, 0xD4, 0xB3, 0x7C, 0x40, 0xE4, 0xB3,
+                                                0x7B, 0xBD, 0x80, 0xB5, 0x61, 0x5B, 0xA9, 0xB4, 0x70, 0x3E };
+        
+constexpr byte Sound_Twelve [88] PROGMEM = {    0x00, 0xF9, 0xF8, 0x10, 0x01, 0x99, 0xFF, 0x30, 0x86, 0x98, 0xFE, 0xB0, 0x81, 0xB7, 0xFE, 0x30, 
+                                                0x55, 0xB2, 0xB4, 0xD0, 0x50, 0xB1, 0x8B, 0xB0, 0xE0, 0xBB, 0x73, 0xA0, 0xEA, 0x8D, 0x7E, 0x40,
+                                                0xE8, 0x91, 0x97, 0x40, 0xE9, 0xB2, 0x9F, 0xFE, 0xE8, 0xAF, 0x8E, 0xFE, 0xE8, 0xAC, 0x85, 0x7F,
+                                                0xE4, 0xAB, 0x7B, 0xFF, 0xE8, 0xAB, 0x72, 0xC0, 0xE5, 0xAC, 0x6A, 0xDD, 0xE5, 0xAC, 0x6A, 0xDD,
+                                                0x40, 0xB6, 0x75, 0x20, 0x04, 0xB3, 0xC5, 0x50, 0x24, 0xB1, 0xB5, 0x50, 0x26, 0xB1, 0x93, 0xB0, 
+                                                0xA4, 0xB2, 0x7B, 0x5F, 0x60, 0xB3, 0x81, 0xC0 };
+
+constexpr byte Sound_Thir_ [68] PROGMEM = {     0x05, 0xB9, 0xE8, 0x10, 0x04, 0xB7, 0xFC, 0xB0, 0x04, 0xB9, 0x8D, 0x30, 0x05, 0xB8, 0xA5, 0xB0,
+                                                0x05, 0xB8, 0xAE, 0x30, 0x05, 0xB8, 0xAE, 0x30, 0x09, 0xB7, 0xA5, 0xB0, 0x5A, 0xB7, 0x85, 0x30,
+                                                0xE9, 0xB3, 0x77, 0x40, 0xFD, 0xB3, 0x87, 0x5F, 0xE9, 0xB3, 0x8F, 0x7F, 0xF9, 0xB3, 0x87, 0x3F, 
+                                                0xE9, 0xB3, 0x86, 0xDE, 0xE5, 0xB3, 0x7E, 0x20, 0x80, 0xB3, 0x7A, 0x5E, 0xD1, 0xB5, 0x79, 0xA1, 
+                                                0x15, 0xB7, 0xBD, 0xB0 };
+
+constexpr byte Sound_Four_  [52] PROGMEM = {    0x10, 0xBA, 0xF8, 0x10, 0x05, 0xB5, 0xFE, 0x70, 0x84, 0xB5, 0xFD, 0xD0, 0x85, 0xB3,
+                                                0xE5, 0x30, 0x90, 0xAB, 0x8C, 0xA0, 0x90, 0xAA, 0x8D, 0xC0, 0x90, 0xAA, 0x8D, 0xC0, 0x90, 0xA9,
+                                                0x8D, 0xFF, 0xAA, 0xA9, 0x8D, 0xDD, 0xE9, 0xA9, 0x8D, 0x7F, 0xE9, 0xAA, 0x8C, 0xDF, 0xF8, 0xAA,
+                                                0x84, 0x40, 0xB5, 0xAA, 0x7A, 0xC0 };
+
+constexpr byte Sound_Fif_ [64] PROGMEM = {      0x25, 0xB3, 0xF8, 0x10, 0x12, 0xB4, 0xFB, 0x50, 0x16, 0xB3, 0xFB, 0xD0, 0x05, 0xB4, 0xFC, 0x50, 
+                                                0x05, 0xB5, 0xFC, 0xD0, 0x1A, 0xB5, 0xFE, 0x50, 0x1A, 0xB5, 0xFE, 0x30, 0x1E, 0xB5, 0xCC, 0xB0,
+                                                0xE9, 0x94, 0x76, 0x20, 0xE9, 0x94, 0x76, 0x20, 0xE9, 0x94, 0x76, 0xC0, 0xE1, 0xB6, 0x6D, 0xA0,
+                                                0x16, 0xB6, 0xFE, 0xD0, 0x06, 0xB9, 0xFE, 0x50, 0x05, 0xB5, 0xFD, 0xF0, 0x05, 0xB8, 0xFD, 0xF0 };
+                          
+constexpr byte Sound__teen [96] PROGMEM = {     0x01, 0xD8, 0xF8, 0x10, 0x01, 0xD8, 0xFE, 0x10, 0x11, 0xD9, 0xFE, 0xB0, 
+                                                0x46, 0xD9, 0xFF, 0x30, 0x45, 0xD8, 0xFF, 0x30, 0x2A, 0xB7, 0xF7, 0x30, 0xAE, 0xB7, 0x7D, 0xB0, 
+                                                0xE8, 0xB8, 0x65, 0xC0, 0xE4, 0xB9, 0x64, 0xE0, 0xE4, 0xB9, 0x64, 0xA0, 0xE1, 0xBA, 0x74, 0xBF, 
+                                                0xE0, 0xBA, 0x74, 0xDF, 0xE4, 0xBA, 0x6C, 0xA0, 0xE0, 0xDA, 0x6C, 0xC0, 0x80, 0xB9, 0x5A, 0xDE, 
+                                                0xC0, 0x98, 0x62, 0xDF, 0x80, 0x76, 0x62, 0xC0, 0x80, 0x95, 0x62, 0xC0, 0x80, 0xD5, 0x63, 0x21, 
+                                                0xEA, 0xB4, 0x75, 0x20, 0xD4, 0xB4, 0x7B, 0xA0, 0xA0, 0xD4, 0x7A, 0xC0, 0xA4, 0xB4, 0x91, 0x43, 
+                                                0x60, 0xB4, 0x90, 0x25 };
+
+constexpr byte Sound_Twen_ [64] PROGMEM = {     0x50, 0xB6, 0xA0, 0x10, 0x05, 0xB6, 0xBE, 0x90, 0x01, 0xB5, 0xD7, 0xB0, 0x29, 0xB4, 0xC6, 0xB0,
+                                                0x80, 0x96, 0xB5, 0xD0, 0x24, 0x8F, 0xBC, 0xB0, 0xA4, 0x8F, 0x83, 0xA0, 0xF9, 0x8F, 0x7E, 0x20,
+                                                0xE9, 0x91, 0x87, 0x3F, 0xE8, 0x93, 0x8F, 0x3E, 0xE8, 0x94, 0x8F, 0x3E, 0xE8, 0xB5, 0x87, 0x3E,
+                                                0xD8, 0xB5, 0x6E, 0xBE, 0xD0, 0xAF, 0x54, 0x5E, 0xC0, 0xB1, 0x53, 0xFF, 0x50, 0xD7, 0x68, 0xE0 };
+            
+constexpr byte Sound__ty [60] PROGMEM = {   0x50, 0xD7, 0x68, 0x00, 0x16, 0xDB, 0xED, 0xD0, 0x8A, 0xB7, 0xFE, 0x50, 0x06, 0xB6, 0xB6, 0x30,
+                                            0x9E, 0xB6, 0x9C, 0xB0, 0xC4, 0xB5, 0x6B, 0xBE, 0xE8, 0xB7, 0x6D, 0xDE, 0xE8, 0xB8, 0x6D, 0xDE, 
+                                            0xD4, 0xB9, 0x6B, 0xDF, 0xC4, 0x99, 0x6B, 0xC0, 0xD9, 0xB8, 0x62, 0xC0, 0x94, 0xB8, 0x7B, 0x50,
+                                            0x84, 0xB6, 0x92, 0x50, 0x55, 0xB6, 0x80, 0xD0, 0x55, 0xB6, 0x80, 0x30 };
+                                    
+constexpr byte Sound_Hundred [92] PROGMEM = {   0x14, 0xB3, 0x60, 0x00, 0x64, 0xB2, 0x9D, 0xB0, 0x64, 0xB2, 0xAD, 0xB0, 0x64, 0xB2, 0x95, 0xD0, 
+                                                0x91, 0xD0, 0x85, 0x42, 0xA4, 0xCF, 0x9E, 0xA2, 0xA4, 0xD0, 0x9F, 0x3F, 0x81, 0x91, 0x75, 0xDE, 
+                                                0x80, 0xB1, 0x5D, 0x5F, 0xC0, 0xB0, 0x5D, 0x5F, 0xC0, 0xAD, 0x5B, 0x5F, 0xD0, 0xB5, 0x52, 0xA0,
+                                                0x14, 0xB6, 0x87, 0x30, 0x14, 0xB7, 0x6F, 0x30, 0xE5, 0x92, 0x76, 0x41, 0xE5, 0x93, 0x7E, 0xE0,
+                                                0xE5, 0x93, 0x76, 0x22, 0xE8, 0xB4, 0x5E, 0x20, 0xC0, 0xB5, 0x6A, 0x5E, 0x05, 0xB7, 0x9D, 0xB0,
+                                                0x14, 0xDB, 0xE6, 0x30, 0x66, 0xB4, 0x7C, 0x50, 0xB1, 0xB4, 0x62, 0x57 };
+
+constexpr byte Sound_Telephone [124] PROGMEM = {    0x01, 0xB7, 0xE0, 0x10, 0x01, 0xB7, 0xDE, 0x30, 0x42, 0xB7, 0xA6, 0xB0, 0x16, 0xB6, 0x7E, 0xB0,
+                                                    0x65, 0xB5, 0x96, 0x30, 0xA0, 0xB4, 0x8D, 0xA0, 0xE0, 0xB4, 0x8F, 0x3F, 0xE1, 0xB3, 0x8F, 0xC0,
+                                                    0xE2, 0x92, 0x5D, 0x40, 0xE2, 0xD3, 0x55, 0x21, 0xE5, 0xB4, 0x7F, 0x40, 0xE4, 0xB4, 0x76, 0xA1, 
+                                                    0xD0, 0xB3, 0x64, 0xDE, 0x94, 0xB5, 0x6C, 0xBF, 0x15, 0xB5, 0x6D, 0xB0, 0x2A, 0xB4, 0x8C, 0xF0, 
+                                                    0xEA, 0xB2, 0x8E, 0xDE, 0xF8, 0xB1, 0x96, 0xC0, 0xE8, 0xB1, 0x96, 0xC0, 0xE8, 0xB1, 0x8E, 0x7F,
+                                                    0xE4, 0xB2, 0x7E, 0x7F, 0xC4, 0xB0, 0x5C, 0xC0, 0xC4, 0xB0, 0x5C, 0x40, 0xC0, 0xAE, 0x5B, 0xC0,
+                                                    0xD0, 0xAC, 0x5A, 0xA1, 0x80, 0xD1, 0x64, 0xA1, 0xD0, 0xD3, 0x7C, 0x22, 0xC0, 0xB0, 0x73, 0x22,
+                                                    0x80, 0xAF, 0x72, 0xA1, 0xB6, 0xB3, 0x71, 0xA0, 0x17, 0xB4, 0x60, 0x60 };
+
+constexpr byte Sound_Number [96] PROGMEM = {    0x17, 0xB4, 0x60, 0x60, 0x40, 0x8D, 0x7A, 0x21, 0xD0, 0x8B, 0x53, 0x20, 0xC4, 0xAF, 0x5B, 0xC0, 
+                                                0xE9, 0xB2, 0x8E, 0xC0, 0xE5, 0xB1, 0x96, 0xC0, 0xE6, 0xAF, 0x8E, 0x41, 0x91, 0x8E, 0x5D, 0x40,
+                                                0xD5, 0x8F, 0x54, 0xE0, 0xC0, 0x91, 0x5C, 0xA0, 0xD0, 0x8F, 0x53, 0xDF, 0xC0, 0x8E, 0x53, 0x21,
+                                                0xC0, 0xAE, 0x52, 0xA1, 0xA4, 0xB1, 0x7E, 0x21, 0xE5, 0xB0, 0x8E, 0xA1, 0xE5, 0xB1, 0x95, 0xFF,
+                                                0xE5, 0xB1, 0x95, 0xA2, 0xE5, 0xB1, 0x8C, 0xC0, 0xE5, 0xB0, 0x8C, 0x20, 0xD0, 0xB0, 0x83, 0xA1,
+                                                0x94, 0xB2, 0x73, 0x3F, 0x95, 0xB2, 0x8A, 0x5E, 0x95, 0xB2, 0x89, 0x40, 0x95, 0xB2, 0x88, 0x40 }; 
+
+constexpr byte Sound_Code [76] PROGMEM = {  0x10, 0x97, 0xD0, 0x10, 0x38, 0x97, 0xAF, 0x30, 0x75, 0xB7, 0xE6, 0xD0, 0x26, 0xB6, 0xFE, 0x30, 
+                                            0x66, 0xB3, 0x85, 0x20, 0xE6, 0x92, 0x8E, 0xA9, 0xE5, 0x92, 0x96, 0xC0, 0xFE, 0x92, 0x7E, 0x7F,
+                                            0xFA, 0x92, 0x6E, 0x60, 0xEA, 0x92, 0x66, 0x60, 0xEE, 0x93, 0x65, 0xE0, 0xD0, 0xB3, 0x62, 0x5D,
+                                            0x11, 0xB6, 0xCE, 0xB0, 0x15, 0xD6, 0xD7, 0x90, 0x06, 0xB4, 0xE6, 0x30, 0xBA, 0xB4, 0x5C, 0xB0,
+                                            0xE4, 0xB4, 0x5B, 0x5D, 0x00, 0xB4, 0x59, 0x60, 0x00, 0x00, 0x00, 0x70 };
+
+constexpr byte Sound_And [60] PROGMEM = {   0x00, 0xB7, 0x60, 0x00, 0x90, 0xB2, 0xA3, 0x40, 0xA8, 0xB3, 0xA6, 0x40, 0xE8, 0xB3, 0xA6, 0xFF, 
+                                            0xA8, 0xB3, 0x9E, 0x5F, 0xEC, 0xB2, 0x96, 0x40, 0x81, 0xB1, 0x64, 0xC0, 0x94, 0xAD, 0x5C, 0x41,
+                                            0xD4, 0xAC, 0x54, 0x40, 0xC0, 0xB0, 0x4B, 0xDF, 0x85, 0xD8, 0x54, 0x20, 0x45, 0xBA, 0x9E, 0x30,
+                                            0x46, 0xDA, 0x76, 0xB0, 0xED, 0xB2, 0x64, 0xD8, 0x40, 0xD7, 0x61, 0xDD };
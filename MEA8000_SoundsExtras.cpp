@@ -0,0 +1,55 @@
+/*
+
+    MEA8000_SoundsExtras.cpp
+
+    The self designed samples (the h sounds) and my own extras (Sound_OMELETTE).
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// Self designed samples
+// (There was no 'h' (Hotel, Him and Her, Help) in this French data set.)
+
+// hooo  
+constexpr byte Sound_hooo [64] PROGMEM = {  0x00, 0x99, 0xF8, 0x10, 0xF9, 0xAC, 0x95, 0x20, 0xE4, 0xAB, 0x95, 0xA0, 0xD0, 0xAC, 0x96, 0x20, 
+                                            0x90, 0x8D, 0x9E, 0xA1, 0xD0, 0xAD, 0x8E, 0xA1, 0xE4, 0xAD, 0x86, 0xA0, 0xE4, 0xAE, 0x7E, 0xA0, 
+                                            0xF9, 0xD1, 0x7F, 0x20, 0xC8, 0xD3, 0x76, 0x3F, 0x40, 0xD3, 0x3B, 0xB0, 0x00, 0x90, 0x03, 0x30, 
+                                            0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30 };
+
+// ho  
+constexpr byte Sound_ho [32] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0xF9, 0xAC, 0x95, 0x20, 0xE4, 0xAB, 0x95, 0xA0, 0xD0, 0xAC, 0x96, 0x20, 
+                                            0x90, 0x8D, 0x9E, 0xA1, 0xD0, 0xAD, 0x8E, 0xA1, 0xE4, 0xAD, 0x86, 0xA0, 0xE4, 0xAE, 0x7E, 0xA0 };
+                               
+// h
+constexpr byte Sound_h  [16] PROGMEM = {    0x95, 0x96, 0x58, 0x00, 0xD9, 0x97, 0x4C, 0x5E, 0xE9, 0xB6, 0x43, 0xDA, 0xD5, 0x95, 0x44, 0x42 };
+
+// uhu
+constexpr byte Sound_hu [24] PROGMEM = {    0x95, 0x96, 0x58, 0x20, 0xD9, 0x97, 0x4B, 0x5E, 0xE9, 0xB6, 0x43, 0xDA, 0xD5, 0x95, 0x44, 0x42,
+                                            0xF5, 0x95, 0x4D, 0xC4, 0xDA, 0xB7, 0x4F, 0x20 };
+
+// heu
+constexpr byte Sound_he [32] PROGMEM = {    0x66, 0xB5, 0x95, 0x01, 0x77, 0xB4, 0x97, 0x20, 0x77, 0xB4, 0x97, 0xC0, 0xB7, 0xB4, 0x97, 0x5F,
+                                            0x77, 0xB4, 0x97, 0x40, 0xF7, 0xB5, 0x96, 0xDF, 0xB7, 0xB5, 0x8E, 0xC0, 0xF6, 0xB5, 0xBE, 0x5F };
+  
+// HA (base 10 data)
+constexpr byte Sound_ha [28] PROGMEM = {  0,  80,  47,  47,  84, 179, 192,   0, 149, 176, 182,  66, 102, 178, 207,  64,
+                                        102, 178, 207,  95, 106, 180, 183,  95, 132, 214,  88,   8 };
+
+
+// My own extra's
+
+constexpr byte Sound_OMELETTE [168] PROGMEM = {
+       0,  36,  47,  47,   0, 153, 248,   0,  64, 174, 132,  15, 217, 168, 117,  32,
+     169, 167, 109,  32, 153, 198, 109,  96, 237, 166, 100,  59, 217, 165,  99, 159,
+     148, 165,  88,  28,  68, 181,  48,   0, 132, 181,  58, 148, 132, 154,  43,  32,
+     144, 185,  52, 160, 144, 217,  52, 193,  80, 217,  53,  64,  80, 217,  61, 161,
+      84, 183,  78,  32, 100, 183,  86, 224, 144, 184,  86, 224, 149, 183,  86,  64,
+     252, 182,  96,   0, 164, 182, 108,  19, 248, 182,  92, 160, 232, 182,  93,  32, 
+     248, 182,  93, 193, 248, 214,  94,  33, 245, 214,  86,  65,   0, 153, 248,   0,  
+      84, 182, 171, 135, 253, 182, 158,  32, 233, 182, 150, 160, 250, 182, 151,  65, 
+     168, 183, 135,  64, 244, 183, 118,  33, 232, 183, 117, 191, 233, 183,  92, 190, 
+     161, 215, 100,  63, 192, 215, 104, 112, 128, 153, 112, 112,   1, 185, 251, 176,   
+      85, 177, 148,  48,  25, 176,  96,  27 };
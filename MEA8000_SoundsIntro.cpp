@@ -0,0 +1,70 @@
+/*
+
+    MEA8000_SoundsIntro.cpp
+
+    "Ici le synthetiseur de parole MEA8000" from catalog 1, in three parts.
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// One extra and long one from catalog 1 (in base-16)
+//
+// In my Arduino code the sound samples have a maximum length of 256 bytes.
+// Longer samples are split into sections of maximum 256 byte.
+//
+// "Ici le synthetiseur de parole MEA8000"
+// in three parts (max. 256 bytes) 
+constexpr byte Sound_INTRO_MEA8000_P1 [256] PROGMEM = {
+                            0x02, 0xB0, 0x1F, 0x31, 0x86, 0xD8, 0x70, 0x01, 0x86, 0xD8, 0x74, 0x88,
+    0xB6, 0xD9, 0x57, 0x27, 0xA6, 0xD9, 0x4F, 0x41, 0xA6, 0xD9, 0x47, 0x5F, 0xB7, 0xD9, 0x47, 0x3D,
+    0xA0, 0xD8, 0x5E, 0xDF, 0x05, 0xF8, 0x56, 0xF0, 0x05, 0xF8, 0x5D, 0xF0, 0xE6, 0xD8, 0x65, 0xC0,
+    0xF1, 0xB8, 0x4E, 0x40, 0xF0, 0xD9, 0x4E, 0xC1, 0xE1, 0xD9, 0x47, 0x41, 0xE4, 0xDA, 0x47, 0x41,
+    0xE8, 0xDA, 0x46, 0x40, 0xD8, 0xDA, 0x4C, 0x5F, 0x61, 0xB6, 0x30, 0x5E, 0x74, 0xB5, 0x3A, 0x30,
+    0x74, 0xB5, 0x54, 0x20, 0x74, 0xB6, 0x2E, 0x5E, 0x74, 0xB5, 0x26, 0x21, 0x28, 0xB5, 0x56, 0x42,
+    0x69, 0xB4, 0x76, 0xA0, 0x6A, 0xB4, 0x76, 0xC0, 0x6B, 0xB4, 0x77, 0x40, 0xAB, 0xB4, 0x6E, 0xDE,
+    0xEB, 0xB4, 0x5A, 0xBD, 0x42, 0xD7, 0x55, 0x42, 0x23, 0xF8, 0x55, 0x10, 0x06, 0xF7, 0x56, 0x10,
+    0x06, 0xF6, 0x5E, 0x30, 0x02, 0xF6, 0x66, 0xD0, 0x02, 0xD6, 0x6F, 0x50, 0x65, 0xB5, 0x6F, 0x2F,
+    0xB9, 0xB4, 0x9F, 0x2F, 0xB8, 0xB3, 0xAF, 0x2A, 0x69, 0xB3, 0xA7, 0x25, 0xA8, 0xD4, 0x9F, 0x3F,
+    0xA5, 0xB4, 0x7F, 0x20, 0x40, 0xB4, 0x71, 0x5F, 0x54, 0xD3, 0x78, 0x3F, 0x55, 0xF4, 0x75, 0x10,
+    0x16, 0xD7, 0x5E, 0x90, 0xE9, 0xB8, 0x66, 0xDF, 0x85, 0xB8, 0x66, 0xBF, 0xD4, 0xB8, 0x44, 0xDE,
+    0x99, 0xB7, 0x3B, 0x3F, 0xC5, 0xB7, 0x4A, 0xBF, 0x81, 0xB7, 0x4A, 0x9E, 0x09, 0xF7, 0x4B, 0x10,
+    0x4C, 0xF8, 0x4D, 0x10, 0x08, 0xF8, 0x4D, 0x90, 0x8D, 0xD9, 0x4D, 0x9B, 0x84, 0xDA, 0x45, 0xDF,
+    0xD5, 0xD9, 0x4D, 0xC1, 0xD9, 0xB8, 0x5D, 0xBA, 0xE6, 0xB7, 0x45, 0xDB, 0x5A, 0xF6, 0x44, 0xB0,
+    0x56, 0xF5, 0x4D, 0x30, 0xAA, 0xF5, 0x5D, 0x9A, 0x99, 0xB5, 0x77, 0x28, 0xEA, 0xB4, 0x8F, 0xC3,
+    0x5A, 0xB2, 0x87, 0xBE };
+
+constexpr byte Sound_INTRO_MEA8000_P2 [256] PROGMEM = {
+                            0x1A, 0xB0, 0x9F, 0xBF, 0x15, 0xAE, 0x87, 0x57, 0x6B, 0xCE, 0x76, 0x3C,
+    0x95, 0xCE, 0x53, 0xBC, 0x99, 0xAD, 0x5A, 0xA9, 0x56, 0xD4, 0x5C, 0xAF, 0x9B, 0xB4, 0x5E, 0xAD,
+    0x8A, 0xB4, 0x7E, 0xA4, 0x95, 0xB2, 0x7E, 0xBF, 0x96, 0xB1, 0x53, 0x5F, 0xE6, 0xB1, 0x62, 0x3F,
+    0x80, 0xB3, 0x60, 0x5E, 0x80, 0xB3, 0x60, 0x02, 0x15, 0xB5, 0x76, 0x90, 0x15, 0xB5, 0x86, 0x90,
+    0x55, 0xB4, 0x8D, 0x9C, 0x6A, 0xB1, 0xAF, 0x3E, 0x26, 0xB1, 0xCF, 0xDF, 0x26, 0xB1, 0xCF, 0x9E,
+    0x2B, 0xB0, 0xCF, 0x80, 0x57, 0xB0, 0xBF, 0x36, 0x6A, 0xB0, 0xA6, 0xB8, 0x69, 0xB0, 0x9E, 0x3C,
+    0x6A, 0xAF, 0x9E, 0x3D, 0x6A, 0xAF, 0xBF, 0x42, 0x6E, 0xB0, 0xA7, 0x40, 0x69, 0xB1, 0x9F, 0x40,
+    0xA8, 0xB2, 0x86, 0x41, 0xFC, 0xB3, 0x5D, 0x62, 0xFC, 0xB3, 0x54, 0xFF, 0xFC, 0xB3, 0x5D, 0x23,
+    0xBD, 0xB3, 0x8E, 0xC0, 0xFD, 0xB3, 0x9E, 0xC0, 0xBE, 0xB3, 0x96, 0x5F, 0x7E, 0xB3, 0x95, 0x39,
+    0x99, 0xB3, 0x92, 0x5E, 0xD4, 0xB3, 0x91, 0x22, 0xD5, 0xB3, 0x98, 0x7C, 0xD5, 0xB3, 0x98, 0x60,
+    0xD5, 0xB3, 0x98, 0x60, 0xD5, 0xB3, 0x98, 0x60, 0xD5, 0xB3, 0x98, 0x60, 0xD5, 0xB3, 0x98, 0x60,
+    0xD5, 0xB3, 0x98, 0x60, 0x65, 0xB5, 0xB4, 0xCF, 0xB6, 0xB6, 0xA7, 0x2F, 0xAA, 0xB6, 0x9F, 0xAF,
+    0xAA, 0xB6, 0x8F, 0xA0, 0xBA, 0xB6, 0x87, 0xBF, 0xBA, 0xB6, 0x97, 0xBF, 0xAA, 0xB6, 0x97, 0xBF,
+    0xAB, 0xB4, 0x7F, 0x3E, 0x9A, 0x94, 0x55, 0xBF, 0x6E, 0xB3, 0x35, 0xBD, 0x6E, 0xB3, 0x4D, 0xBE,
+    0x6E, 0xB3, 0x45, 0xBD, 0x6E, 0xB2, 0x45, 0xBE, 0xAE, 0xB2, 0x45, 0xDD, 0xAE, 0xB2, 0x44, 0x5E,
+    0xAB, 0xB1, 0x54, 0x3D, 0xFA, 0xB2, 0x6A, 0x5F, 0x65, 0xB2, 0x71, 0x30, 0x65, 0xB2, 0x70, 0x10,
+    0x65, 0xB2, 0x70, 0x70 }; 
+    
+constexpr byte Sound_INTRO_MEA8000_P3 [176] PROGMEM = {
+                            0x00, 0xB3, 0x80, 0x30, 0x66, 0xB3, 0xAC, 0x30, 0x6B, 0xB3, 0x9E, 0x3C,
+    0xAF, 0xB3, 0x97, 0x5F, 0x6B, 0xB3, 0x87, 0x7E, 0xBB, 0xB3, 0x8E, 0xA2, 0xFB, 0xB3, 0x8B, 0x5E,
+    0xD6, 0xB2, 0x81, 0xA0, 0xC6, 0xB1, 0x79, 0x9E, 0x29, 0xB0, 0x90, 0x62, 0x2D, 0xB1, 0xBD, 0xA4,
+    0x6F, 0xB1, 0xD6, 0xC1, 0xAE, 0xB1, 0xCE, 0xDF, 0x69, 0xB1, 0xD7, 0x3F, 0x6E, 0xB1, 0xCF, 0x5F,
+    0xBF, 0xB1, 0xBE, 0xFF, 0x6A, 0xB1, 0xAC, 0xC0, 0xA5, 0xAF, 0x99, 0xC0, 0xA0, 0xB0, 0x90, 0x27, 
+    0xA0, 0xB0, 0x90, 0x60, 0xA0, 0xB0, 0x90, 0x60, 0xA0, 0xB0, 0x90, 0x60, 0x56, 0xB7, 0x59, 0x7D,
+    0xD7, 0x96, 0x43, 0xA4, 0xE7, 0x95, 0x44, 0x5F, 0xB6, 0xB5, 0x45, 0xC5, 0xA7, 0x97, 0x46, 0x2B,
+    0x57, 0xB9, 0x3E, 0xAE, 0x4A, 0xB8, 0x2F, 0x25, 0x5A, 0xB8, 0x47, 0xAA, 0xA6, 0xB8, 0x36, 0xDE,
+    0x90, 0x99, 0x45, 0x3A, 0x8A, 0x95, 0x3C, 0xBA, 0x8A, 0x94, 0x4D, 0x59, 0x51, 0xB8, 0x5F, 0x3B,
+    0xEA, 0xB8, 0x66, 0xB9, 0xEC, 0xB8, 0x55, 0xDB, 0xE8, 0xB8, 0x64, 0xDE, 0xBD, 0xB5, 0x5C, 0xFD,
+    0xBC, 0xB4, 0x64, 0xFE, 0xFD, 0xB3, 0x5C, 0xFF, 0xBD, 0xB3, 0x5C, 0xA1, 0xBD, 0xB4, 0x94, 0xC0,
+    0xAD, 0xB3, 0x98, 0x45 };
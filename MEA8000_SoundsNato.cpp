@@ -0,0 +1,297 @@
+/*
+
+    MEA8000_SoundsNato.cpp
+
+    The words of the NATO phonetic alphabet (Sound_Alpha .. Sound_Zulu).
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+// Words - NATO phonetic alphabet ---------------------------------------------------------------------------------------
+
+
+constexpr byte Sound_Alpha [140] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0x94, 0xD1, 0xCE, 0x20, 0xA8, 0xD1, 0xCF, 0x20, 0xE9, 0xD2, 0xCF, 0xA1,
+                                                0xE9, 0xD3, 0xCF, 0xA0, 0xD4, 0xD3, 0xCF, 0x20, 0xD4, 0xD3, 0xBF, 0xBF, 0xEB, 0xD4, 0x9F, 0x20,
+                                                0xD4, 0xB5, 0x8F, 0x20, 0xE5, 0xB5, 0x7E, 0xA0, 0xE1, 0xB5, 0x76, 0x20, 0xE2, 0xB5, 0x65, 0xBF, 
+                                                0xE5, 0x95, 0x5D, 0x3F, 0xE0, 0x95, 0x6C, 0xA0, 0x44, 0xB6, 0x54, 0x30, 0x11, 0x77, 0x54, 0xB0, 
+                                                0x14, 0xD6, 0x5C, 0xB0, 0x40, 0xD9, 0x5E, 0x30, 0x00, 0xDB, 0x65, 0xB0, 0x54, 0xD7, 0x65, 0xB0, 
+                                                0x00, 0xD8, 0x6D, 0x30, 0x00, 0xB8, 0x6D, 0x30, 0x00, 0xD6, 0x75, 0x30, 0x00, 0xB4, 0x73, 0xB0, 
+                                                0x90, 0xD1, 0x7C, 0x30, 0xE8, 0xD1, 0x9D, 0x20, 0xF8, 0xD1, 0xAE, 0xBD, 0xE4, 0xD1, 0xBE, 0xBE, 
+                                                0xA4, 0xD1, 0xBE, 0xBE, 0xA4, 0xD1, 0xC6, 0xBF, 0xA4, 0xD1, 0xBE, 0xBE, 0x91, 0xD2, 0xD5, 0x3F,
+                                                0x93, 0xB2, 0xDC, 0x30, 0x42, 0x95, 0xEA, 0xB0, 0x40, 0x55, 0xF8, 0x30 };
+
+
+constexpr byte Sound_Bravo [120] PROGMEM = {    0x00, 0x99, 0xF0, 0x10, 0xF8, 0xCD, 0x94, 0x20, 0xA9, 0xCD, 0x94, 0xA0, 0xA8, 0xCE, 0xAD, 0x21, 
+                                                0xB8, 0xCE, 0xBD, 0xA2, 0xB9, 0xCE, 0xBE, 0xA1, 0xA8, 0xCF, 0xC7, 0x24, 0x94, 0xCF, 0xD7, 0xA1, 
+                                                0x94, 0xCF, 0xD7, 0xA2, 0x94, 0xD0, 0xCF, 0xA1, 0x94, 0xD0, 0xC7, 0x20, 0x94, 0xD0, 0xAF, 0x21, 
+                                                0x94, 0xD0, 0x8E, 0x20, 0xF9, 0xD0, 0x75, 0xBE, 0xA9, 0xB0, 0x65, 0xBF, 0x66, 0xB0, 0x3C, 0xBC, 
+                                                0x11, 0xB1, 0x2C, 0x3F, 0x15, 0xAF, 0x2D, 0x3E, 0x16, 0xB0, 0x3D, 0x21, 0x51, 0xB0, 0x56, 0x24, 
+                                                0x95, 0xAC, 0x6D, 0x24, 0xE1, 0xAB, 0x75, 0x22, 0xD0, 0xAA, 0x7D, 0x3F, 0xD1, 0x8A, 0x7C, 0xBE, 
+                                                0x80, 0xC9, 0x7C, 0xBF, 0x81, 0xC6, 0x74, 0x3E, 0x81, 0xC5, 0x6C, 0x3E, 0x90, 0xA5, 0x6B, 0xBC, 
+                                                0x61, 0xA3, 0x6A, 0xA0, 0x00, 0x75, 0x68, 0x20 };
+            
+ 
+constexpr byte Sound_Charlie [164] PROGMEM = {  0x00, 0x99, 0xF8, 0x10, 0x25, 0xBA, 0xF3, 0xB0, 0x25, 0xBA, 0xE4, 0xB0, 0x25, 0xBA, 0xD5, 0x30, 
+                                                0x25, 0xBA, 0xC5, 0xB0, 0x25, 0xBA, 0xBD, 0xB0, 0x25, 0xBA, 0xAE, 0x30, 0x25, 0xBA, 0x9E, 0x30, 
+                                                0x25, 0xBA, 0x8D, 0xB0, 0x25, 0xBA, 0x86, 0x30, 0x25, 0xB9, 0x86, 0x30, 0x18, 0xD6, 0x85, 0xB0, 
+                                                0x94, 0xD4, 0x96, 0xA0, 0x94, 0xB2, 0xB7, 0x20, 0xA8, 0xB2, 0xBF, 0x3F, 0xE8, 0xB2, 0xC7, 0xA0, 
+                                                0xE8, 0xB1, 0xC7, 0xA0, 0xA8, 0xD0, 0xC7, 0xBF, 0xA4, 0xD0, 0xC7, 0x3F, 0xB5, 0xAF, 0xB6, 0x3D, 
+                                                0xB9, 0xAF, 0xA5, 0xBF, 0xA9, 0xAE, 0x9D, 0xBF, 0xAD, 0xAD, 0x94, 0x30, 0x59, 0xAD, 0x94, 0xB0, 
+                                                0x4C, 0xAD, 0xA4, 0xB0, 0x5C, 0xAE, 0x9D, 0x21, 0x98, 0xB0, 0x95, 0xA0, 0x94, 0xB1, 0x85, 0x3F, 
+                                                0x90, 0xB3, 0x7D, 0x3F, 0x52, 0xB4, 0x55, 0x3F, 0x92, 0xB7, 0x65, 0x20, 0xD8, 0xD9, 0x6E, 0x21, 
+                                                0xD4, 0xDA, 0x66, 0x20, 0xE0, 0xDB, 0x5D, 0x3F, 0xE4, 0xDB, 0x55, 0x3F, 0xE4, 0xDB, 0x55, 0x20, 
+                                                0xE4, 0xDC, 0x55, 0x3F, 0xF1, 0xBB, 0x5A, 0x3F, 0xE8, 0xBC, 0x4C, 0x3E, 0x82, 0xB8, 0x43, 0x3E, 
+                                                0x44, 0xD8, 0x20, 0x30 };
+        
+constexpr byte Sound_Delta [140] PROGMEM = {    0x80, 0xD7, 0x20, 0x10, 0x04, 0xB5, 0x4B, 0x80, 0x40, 0xB7, 0x7D, 0x80, 0xF8, 0xD7, 0x75, 0x80, 
+                                                0xF2, 0xB7, 0x85, 0x80, 0xE8, 0xD7, 0x96, 0xA0, 0xE8, 0xD7, 0x97, 0xA0, 0xE8, 0xD7, 0x9F, 0xA0,
+                                                0xD8, 0xD7, 0x9F, 0xA1, 0xE8, 0xD7, 0x9F, 0xA0, 0xD0, 0xB6, 0x8F, 0x20, 0xE4, 0xB6, 0x6E, 0x20,
+                                                0xE6, 0xB5, 0x6E, 0x20, 0xE7, 0xB6, 0x65, 0xBE, 0xE1, 0xB7, 0x66, 0x20, 0xE5, 0x97, 0x4D, 0xBF,
+                                                0xE1, 0xB7, 0x4D, 0x3F, 0xF1, 0xB7, 0x44, 0x20, 0xA0, 0xB7, 0x33, 0x30, 0x40, 0xB8, 0x39, 0x30,
+                                                0x40, 0xB8, 0x38, 0x70, 0x40, 0xB8, 0x38, 0x70, 0x00, 0xB8, 0xE3, 0x30, 0x01, 0x98, 0xCD, 0x30, 
+                                                0xA2, 0xD6, 0x96, 0x27, 0x98, 0xD5, 0xA6, 0xBA, 0x82, 0xD3, 0xBE, 0xBD, 0x93, 0xB3, 0xBE, 0xBE,
+                                                0xE8, 0xD3, 0xC7, 0x3F, 0xA8, 0xD2, 0xC6, 0xBF, 0xA8, 0xD1, 0xBE, 0xBE, 0x58, 0xD0, 0xC5, 0xBE,
+                                                0x22, 0x91, 0xF3, 0xB0, 0x11, 0x72, 0xFA, 0xB0, 0x10, 0xB2, 0xE0, 0x30 };
+
+
+constexpr byte Sound_Echo [100] PROGMEM = { 0x44, 0xD5, 0x88, 0x10, 0xE4, 0xDA, 0x74, 0xA0, 0xC8, 0xBA, 0x76, 0x20, 0xE4, 0xBA, 0x77, 0x20, 
+                                            0xF0, 0xDA, 0x77, 0x20, 0xF4, 0xDA, 0x77, 0xA0, 0xE4, 0xDB, 0x6F, 0x20, 0xE0, 0xDB, 0x5E, 0x20, 
+                                            0xE0, 0xBB, 0x45, 0xBD, 0xCC, 0xBA, 0x3B, 0xB0, 0x84, 0xB5, 0x59, 0xB0, 0x88, 0xB4, 0x60, 0x70,
+                                            0x88, 0xB4, 0x60, 0x70, 0x40, 0xB9, 0xE9, 0x30, 0x90, 0xAF, 0xBD, 0x30, 0x50, 0xAC, 0x73, 0xB0,
+                                            0xE5, 0xA9, 0x5C, 0x23, 0xE6, 0xA7, 0x64, 0xA0, 0xE1, 0xC7, 0x64, 0xBE, 0x91, 0xC5, 0x64, 0x20, 
+                                            0x90, 0xC4, 0x64, 0x3F, 0x90, 0xC4, 0x63, 0xBF, 0x94, 0xC5, 0x5C, 0x3E, 0x95, 0xC5, 0x53, 0x3D,
+                                            0x20, 0xA0, 0x00, 0x30 };
+        
+
+
+constexpr byte Sound_Foxtrot [232] PROGMEM = {  0x00, 0x99, 0xF0, 0x10, 0x00, 0x97, 0xD3, 0xB0, 0x1A, 0xB7, 0xC4, 0x30, 0x16, 0xB6, 0xBC, 0x30, 
+                                                0x16, 0xB6, 0xB4, 0xB0, 0x16, 0xB6, 0xAC, 0xB0, 0x16, 0xB6, 0xA4, 0xB0, 0x16, 0xB6, 0x95, 0x30, 
+                                                0x16, 0xB6, 0x8D, 0x30, 0xAA, 0xAF, 0x7D, 0x20, 0xFF, 0xAF, 0x8E, 0xA0, 0xEF, 0xAF, 0x9F, 0x20, 
+                                                0xEA, 0xAE, 0x9F, 0xA0, 0xFA, 0xAD, 0x8E, 0xBF, 0xB5, 0xCC, 0x65, 0x20, 0x75, 0xAD, 0x43, 0x30, 
+                                                0x90, 0xAF, 0x9A, 0x30, 0x80, 0xB0, 0x91, 0xB0, 0x80, 0xB0, 0x90, 0x30, 0x10, 0xB6, 0xC4, 0xB0, 
+                                                0x60, 0xB7, 0xA5, 0x30, 0x25, 0xD7, 0x6E, 0xB0, 0x15, 0xD8, 0xBE, 0x30, 0x05, 0xD7, 0xCD, 0xB0, 
+                                                0x14, 0xF7, 0xC5, 0xB0, 0x14, 0xD7, 0x8D, 0xB0, 0x00, 0xD8, 0xD8, 0x30, 0x00, 0xD8, 0xD8, 0x30, 
+                                                0x00, 0xD8, 0xD8, 0x30, 0x00, 0xD8, 0xD8, 0x30, 0x00, 0xD8, 0xD8, 0x30, 0x00, 0xD8, 0xD8, 0x30, 
+                                                0x00, 0xD8, 0xD8, 0x30, 0x10, 0xB8, 0xAC, 0xB0, 0x00, 0xB9, 0xFE, 0x30, 0x20, 0xD1, 0x05, 0x30, 
+                                                0x10, 0xD0, 0x44, 0xB0, 0x99, 0xAD, 0x9D, 0xB0, 0xE4, 0xAD, 0xA6, 0xA0, 0xA4, 0xCE, 0xB7, 0x3C, 
+                                                0xA4, 0xAF, 0xB7, 0x3E, 0xE4, 0xD0, 0xAF, 0x20, 0xE8, 0xD1, 0x9F, 0x20, 0xD8, 0xD2, 0x97, 0x3E, 
+                                                0xE8, 0xD3, 0x74, 0xA0, 0x50, 0xAF, 0x3A, 0x30, 0x40, 0xD2, 0xA2, 0x30, 0x90, 0xB0, 0xA0, 0x30, 
+                                                0x90, 0xB0, 0xA0, 0x30, 0x90, 0xB0, 0xA0, 0x30, 0x91, 0xF0, 0xA0, 0x30, 0x91, 0xF0, 0xA0, 0x30, 
+                                                0x91, 0xF0, 0xA3, 0xB0, 0x91, 0xF0, 0xA5, 0x30, 0x91, 0xF0, 0xA4, 0x30, 0x91, 0xF0, 0xA3, 0x30, 
+                                                0x91, 0xF0, 0xA2, 0x30, 0x91, 0xF0, 0xA0, 0x30 };
+
+constexpr byte Sound_Golf [124] PROGMEM = { 0x80, 0xB6, 0x30, 0x10, 0x20, 0xB7, 0xEC, 0x20, 0x64, 0xB6, 0x75, 0x20, 0xC8, 0xD7, 0x75, 0x20, 
+                                            0xD8, 0xD3, 0x7E, 0x20, 0xD8, 0xD2, 0x8E, 0xA0, 0xDD, 0xD1, 0x9F, 0xA1, 0xDD, 0xD1, 0x9F, 0xA0, 
+                                            0xD9, 0xD1, 0x9F, 0x20, 0xEC, 0xB2, 0x9F, 0x20, 0xA7, 0x93, 0x8E, 0xBF, 0xA7, 0x93, 0x86, 0xA0, 
+                                            0xA7, 0x94, 0x7E, 0xBE, 0x96, 0x94, 0x76, 0x3F, 0xE1, 0x74, 0x6D, 0x3E, 0x91, 0x75, 0x65, 0x3E, 
+                                            0xA0, 0x76, 0x6C, 0x30, 0x16, 0xB7, 0x6B, 0xB0, 0x16, 0xB7, 0x83, 0xB0, 0x56, 0xB7, 0xFB, 0xB0, 
+                                            0x16, 0xB7, 0xFC, 0x30, 0x16, 0xB7, 0xDC, 0xB0, 0x16, 0xB7, 0xFC, 0xB0, 0x16, 0xB7, 0xD5, 0x30, 
+                                            0x16, 0xB7, 0xD5, 0x30, 0x16, 0xB7, 0xD4, 0xB0, 0x16, 0xB7, 0xD4, 0xB0, 0x16, 0xB7, 0xD4, 0xB0, 
+                                            0x16, 0xB7, 0xD4, 0x30, 0x16, 0xB7, 0xEA, 0x30, 0x16, 0xB7, 0xC8, 0x10 };
+
+constexpr byte Sound_Hotel [184] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0xF9, 0xAC, 0x95, 0x20, 0xE4, 0xAB, 0x95, 0xA0, 0xD0, 0xAC, 0x96, 0x20, 
+                                                0x90, 0x8D, 0x9E, 0xA1, 0xD0, 0xAD, 0x8E, 0xA1, 0xE4, 0xAD, 0x86, 0xA0, 0xE4, 0xAE, 0x7E, 0xA0, 
+                                                0xF9, 0xD1, 0x7F, 0x20, 0xC8, 0xD3, 0x76, 0x3F, 0x40, 0xD3, 0x3B, 0xB0, 0x00, 0x90, 0x03, 0x30, 
+                                                0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 
+                                                0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 0x00, 0x96, 0xF0, 0x30, 
+                                                0x00, 0x96, 0xF0, 0x30, 0x14, 0xD8, 0xCE, 0x30, 0xE2, 0xD7, 0x8E, 0x3F, 0xE4, 0xD7, 0x97, 0xA0, 
+                                                0xE8, 0xD7, 0x9F, 0xBC, 0xE8, 0xD7, 0x9F, 0xA0, 0xF2, 0xD7, 0x9F, 0x20, 0xE2, 0xD7, 0x9F, 0xA0, 
+                                                0xD4, 0xD6, 0x97, 0xBF, 0xE8, 0xD5, 0x7E, 0xBE, 0xF5, 0xB5, 0x6E, 0x20, 0xF6, 0xB5, 0x76, 0x20, 
+                                                0xF2, 0xB5, 0x76, 0x20, 0xE2, 0xB5, 0x76, 0x20, 0xD2, 0xB5, 0x7E, 0x20, 0xD6, 0xB4, 0x7E, 0xA0, 
+                                                0xD6, 0xB4, 0x7E, 0x3F, 0xC6, 0xB4, 0x7E, 0x20, 0xC2, 0xB3, 0x7E, 0x20, 0xC6, 0xB3, 0x76, 0x20, 
+                                                0xD6, 0xB4, 0x75, 0xA0, 0x84, 0xD5, 0x7E, 0x20, 0x22, 0x96, 0x8C, 0xB0, 0x21, 0x96, 0x6B, 0xB0, 
+                                                0x11, 0x76, 0x9B, 0x30, 0x00, 0xB4, 0x08, 0x30 };
+
+constexpr byte Sound_India [152] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0xE2, 0xDB, 0x54, 0xA0, 0xCE, 0xBA, 0x5D, 0x20, 0xE8, 0xDB, 0x5E, 0x20, 
+                                                0xE1, 0xDB, 0x55, 0xA2, 0xF0, 0xBB, 0x55, 0xA1, 0xF2, 0xDB, 0x4E, 0x20, 0xF8, 0xDB, 0x4E, 0x3F, 
+                                                0xAA, 0xB8, 0x54, 0xBD, 0x88, 0xB2, 0x5C, 0xA1, 0x86, 0xAC, 0x54, 0xA0, 0x96, 0xA9, 0x4C, 0xBF, 
+                                                0x86, 0xA7, 0x4C, 0x3F, 0x84, 0xC6, 0x4B, 0xBE, 0x80, 0xC5, 0x4B, 0x3E, 0x84, 0xA6, 0x4B, 0xBF, 
+                                                0x84, 0xA9, 0x5A, 0xB0, 0x80, 0xAE, 0x6A, 0x30, 0x14, 0xB2, 0x52, 0x30, 0x44, 0xD7, 0x3A, 0x30, 
+                                                0xB8, 0xDA, 0x43, 0xB0, 0xF8, 0xDA, 0x44, 0xA0, 0xB2, 0xDA, 0x55, 0x22, 0xF4, 0xDB, 0x5D, 0xA0, 
+                                                0xF8, 0xDB, 0x5E, 0x20, 0xF8, 0xDA, 0x6E, 0xA0, 0xF8, 0xDA, 0x7F, 0xA0, 0xE4, 0xD9, 0x8F, 0xA0, 
+                                                0xE8, 0xD8, 0xA7, 0x3E, 0xD4, 0xD6, 0xB7, 0x3F, 0x88, 0xD5, 0xB7, 0x3F, 0x88, 0xB3, 0xBE, 0xA0, 
+                                                0x93, 0xB4, 0xCE, 0x3F, 0x64, 0xD3, 0xAD, 0x30, 0x12, 0x72, 0x8C, 0x30, 0x42, 0x74, 0x74, 0x30, 
+                                                0x14, 0xB1, 0x53, 0x30, 0x00, 0xAD, 0x38, 0x30 };
+        
+constexpr byte Sound_Juliet [148] PROGMEM = {   0x00, 0x99, 0xF8, 0x10, 0x1D, 0xB8, 0xFB, 0xB0, 0x48, 0xBB, 0xFC, 0x30, 0x61, 0xBB, 0xFC, 0xB0,
+                                                0x88, 0xDB, 0xFC, 0xB0, 0xA4, 0xDB, 0xFD, 0x30, 0x18, 0xB8, 0xFD, 0xB0, 0x64, 0xB7, 0x5D, 0x20, 
+                                                0x84, 0xB7, 0x65, 0x20, 0x84, 0xB1, 0x65, 0x21, 0x99, 0xAE, 0x5C, 0xA2, 0xA8, 0xAC, 0x5C, 0xA0, 
+                                                0x48, 0xB0, 0x64, 0x3C, 0x52, 0xB0, 0x33, 0x3F, 0x9C, 0xB2, 0x3B, 0xA0, 0x06, 0x73, 0x25, 0x20, 
+                                                0x94, 0xBA, 0x4E, 0x22, 0xE9, 0xBA, 0x46, 0x22, 0xF0, 0xDB, 0x46, 0x20, 0xF4, 0xDB, 0x56, 0x20, 
+                                                0xE4, 0xDB, 0x66, 0xA0, 0xE4, 0xDA, 0x7F, 0x20, 0xE4, 0xD9, 0x87, 0x3F, 0xE8, 0xD8, 0x97, 0xBE,
+                                                0xE8, 0xD8, 0x9F, 0xBE, 0xE8, 0xD7, 0x9F, 0x3E, 0xFC, 0xD7, 0x96, 0x3D, 0xB2, 0xD7, 0x6C, 0xBF, 
+                                                0x52, 0xD8, 0x49, 0xB0, 0x90, 0xD7, 0x80, 0x70, 0x90, 0xD7, 0x80, 0x70, 0x90, 0xD7, 0x80, 0x70, 
+                                                0x90, 0xD7, 0x80, 0x50, 0x01, 0xF3, 0xC0, 0x30, 0x41, 0xF7, 0x9C, 0x30, 0x61, 0xF7, 0x7A, 0xB0, 
+                                                0x60, 0xD7, 0x78, 0x30 };
+
+constexpr byte Sound_Kilo [108] PROGMEM = { 0x00, 0x99, 0xF8, 0x10, 0x00, 0xD8, 0xE4, 0x90, 0x00, 0xD9, 0xDF, 0x10, 0x01, 0xBA, 0xF6, 0x30, 
+                                            0x48, 0xFA, 0x64, 0xA0, 0xE8, 0xFB, 0x45, 0xA0, 0xF1, 0xDB, 0x46, 0xA0, 0xF5, 0xDB, 0x47, 0x20, 
+                                            0xF5, 0xDB, 0x47, 0x20, 0xE9, 0xDB, 0x47, 0x3F, 0xA5, 0xDA, 0x4F, 0x3F, 0x99, 0xB7, 0x46, 0xBE,
+                                            0xA9, 0xB6, 0x4E, 0xA0, 0xEC, 0xD6, 0x4F, 0x3F, 0xAC, 0xB6, 0x4F, 0x3F, 0xA8, 0xB5, 0x4E, 0xBE, 
+                                            0xA8, 0xB4, 0x4E, 0x3F, 0xC6, 0xB2, 0x76, 0xA0, 0xD9, 0xAE, 0x76, 0xA0, 0x9E, 0xAC, 0x76, 0x3E, 
+                                            0x9D, 0xCA, 0x76, 0x3E, 0xE8, 0xC8, 0x65, 0x3E, 0xD1, 0xC9, 0x64, 0xBF, 0xA4, 0xC7, 0x5B, 0xBE, 
+                                            0xA4, 0xC7, 0x52, 0xB0, 0x21, 0xA5, 0x01, 0x30, 0x20, 0xA6, 0x00, 0x10 };
+
+constexpr byte Sound_Lima [124] PROGMEM = { 0x45, 0xB7, 0x58, 0x10, 0xD1, 0xB7, 0x5B, 0xA0, 0x91, 0xB8, 0x75, 0x20, 0xE1, 0xB7, 0x65, 0xA0, 
+                                            0xE0, 0xB7, 0x65, 0x22, 0xD0, 0xD7, 0x55, 0xA1, 0xD4, 0xD8, 0x45, 0x21, 0xD0, 0xDA, 0x5E, 0x24, 
+                                            0xD4, 0xDB, 0x56, 0xA2, 0xE4, 0xDB, 0x46, 0x21, 0xE0, 0xDB, 0x46, 0x20, 0xE4, 0xFC, 0x46, 0x20, 
+                                            0xE4, 0xDB, 0x46, 0x20, 0x88, 0xB7, 0x5D, 0x20, 0x43, 0xB9, 0x65, 0x21, 0x43, 0xB9, 0x6D, 0x20, 
+                                            0x8C, 0xB3, 0x55, 0xA0, 0x8C, 0xB2, 0x4D, 0xBF, 0x8C, 0xB2, 0x4D, 0xBE, 0x9C, 0xB1, 0x45, 0xA0, 
+                                            0xE8, 0xB1, 0x86, 0x3F, 0xA8, 0xD2, 0xAF, 0x3E, 0xBC, 0xD2, 0xBF, 0x3F, 0xFC, 0xD2, 0xC7, 0xBE, 
+                                            0xA8, 0xD2, 0xC7, 0x3E, 0xA8, 0xD2, 0xCE, 0xBF, 0xA9, 0xD1, 0xC5, 0xBD, 0xA8, 0xD1, 0xC5, 0x3E,
+                                            0x52, 0xB2, 0xCC, 0xB0, 0x12, 0x90, 0xDB, 0xB0, 0x11, 0x71, 0xE8, 0x30 };
+                                        
+
+// 188 bytes for "Michael" and 112 const byte for (official) "Mike"
+constexpr byte Sound_Michael [188] PROGMEM = {  0x00, 0x99, 0xF8, 0x10, 0x00, 0x99, 0xF8, 0x30, 0x00, 0x99, 0xF8, 0x30, 0x00, 0x99, 0xF8, 0x30, 
+                                                0x00, 0x99, 0xF8, 0x30, 0xF8, 0xB0, 0x4A, 0xB0, 0x6C, 0xB0, 0x4C, 0x20, 0x5C, 0xAF, 0x3D, 0x20, 
+                                                0xB8, 0xAF, 0x95, 0x20, 0xB5, 0xB0, 0xB6, 0x21, 0xB4, 0xB1, 0xC6, 0xA1, 0xFD, 0xB2, 0xC7, 0x21, 
+                                                0xFD, 0xB3, 0xBF, 0xA1, 0xE8, 0xB5, 0xB7, 0xA0, 0xE8, 0xB7, 0x9F, 0xA0, 0xD8, 0xD8, 0x8F, 0x21, 
+                                                0xE4, 0xDA, 0x7F, 0x20, 0xF4, 0xDB, 0x6E, 0x20, 0xF4, 0xDB, 0x4D, 0xA0, 0xF0, 0xFB, 0x44, 0xBF, 
+                                                0x8D, 0xB8, 0x33, 0x30, 0x84, 0xB5, 0x39, 0xB0, 0x84, 0xB4, 0x49, 0x30, 0x84, 0xB4, 0x48, 0x30,
+                                                0x84, 0xB4, 0x48, 0x30, 0x84, 0xB4, 0x48, 0x30, 0x84, 0xB4, 0x48, 0x30, 0x84, 0xB4, 0x48, 0x30, 
+                                                0x10, 0xDA, 0xFD, 0xB0, 0x10, 0xBA, 0xF5, 0xB0, 0xD8, 0xB9, 0x64, 0x21, 0xD8, 0xB8, 0x7D, 0x20,
+                                                0xE8, 0xB7, 0x8D, 0xBC, 0xEC, 0xB6, 0x95, 0xBF, 0xC8, 0xB6, 0x9D, 0xBF, 0xD9, 0xB4, 0x95, 0x3F,
+                                                0xE8, 0xD4, 0x84, 0xBF, 0xF5, 0xB5, 0x6C, 0xBF, 0xE2, 0xB5, 0x7D, 0x20, 0xE2, 0xB5, 0x7D, 0x3F, 
+                                                0xA7, 0xB5, 0x7D, 0x20, 0xE2, 0xB5, 0x7C, 0x3F, 0xE2, 0x95, 0x7B, 0xBF, 0xE2, 0xB5, 0x73, 0xB0, 
+                                                0x52, 0xD6, 0x42, 0xB0, 0x44, 0xD7, 0x59, 0xB0, 0x41, 0xB8, 0x90, 0x30 };
+
+constexpr byte Sound_November [200] PROGMEM = { 0x00, 0x99, 0xF8, 0x10, 0x41, 0xAE, 0x63, 0x30, 0x81, 0xAE, 0x63, 0xA0, 0x86, 0xAC, 0x54, 0xA0, 
+                                                0x85, 0xAB, 0x55, 0x21, 0x8A, 0xAC, 0x55, 0x21, 0xD4, 0xB4, 0x76, 0x24, 0xE4, 0xD3, 0x8F, 0xA0, 
+                                                0xE8, 0xD2, 0x97, 0xA1, 0xF8, 0xD1, 0x97, 0xA1, 0xE8, 0xCF, 0x97, 0x20, 0xE4, 0xCF, 0x97, 0x20, 
+                                                0xE8, 0xCF, 0x8E, 0xBF, 0xE4, 0xCE, 0x7E, 0x3E, 0xA8, 0xCF, 0x6D, 0xBF, 0xA8, 0xB0, 0x6E, 0x20, 
+                                                0xFC, 0xD1, 0x7E, 0xA1, 0xF8, 0xD2, 0x87, 0x21, 0xF8, 0xD2, 0x97, 0xA0, 0xF8, 0xD3, 0x97, 0xA0, 
+                                                0xF8, 0xD3, 0x8F, 0xBF, 0xF8, 0xD2, 0x7E, 0x3E, 0xE8, 0xB2, 0x5D, 0xBF, 0xE8, 0xB2, 0x4D, 0x21,
+                                                0xD8, 0xD2, 0x4D, 0x21, 0xD8, 0xB2, 0x4D, 0x3F, 0xD0, 0xB2, 0x4C, 0xBF, 0xD8, 0xB3, 0x4D, 0x3F,
+                                                0xD8, 0xB3, 0x4D, 0x20, 0xD8, 0xB3, 0x4D, 0x20, 0xCC, 0xB3, 0x4C, 0xBF, 0xDC, 0xB3, 0x44, 0xBF, 
+                                                0xDC, 0xB3, 0x44, 0x30, 0x94, 0xB4, 0x7D, 0xB0, 0xE8, 0xB4, 0x87, 0x21, 0xE8, 0xB4, 0x97, 0x20,
+                                                0xE4, 0xD4, 0x9F, 0x3F, 0xE8, 0xD5, 0x9F, 0x3F, 0xF8, 0xD5, 0x9F, 0xA0, 0xF4, 0xD5, 0x9F, 0x20, 
+                                                0xE8, 0xD5, 0x9F, 0x3F, 0xE8, 0xD4, 0x9F, 0x20, 0xE0, 0xD4, 0xA6, 0xA0, 0xE4, 0xD4, 0xA6, 0xA0,
+                                                0xE4, 0xD3, 0xA6, 0x3F, 0x84, 0xD2, 0x8D, 0xA0, 0x5C, 0xD0, 0x8D, 0x20, 0x24, 0xD0, 0x03, 0xB0,
+                                                0x15, 0xB0, 0x03, 0x30, 0x14, 0xAE, 0x00, 0x30 };
+
+constexpr byte Sound_Oscar [164] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0xA4, 0xCD, 0x8C, 0xA0, 0xF9, 0xCD, 0x9E, 0x20, 0xF4, 0xCE, 0x9E, 0xA0, 
+                                                0xE8, 0xD0, 0x9F, 0x20, 0xE8, 0xB1, 0x97, 0xA0, 0xE8, 0xD2, 0x8F, 0x21, 0x88, 0xD3, 0x7E, 0x3F, 
+                                                0x40, 0xB5, 0x5D, 0xB0, 0x40, 0xD8, 0x95, 0x30, 0x55, 0xF7, 0xA5, 0xB0, 0x05, 0xF7, 0x86, 0x30, 
+                                                0x04, 0xF8, 0x76, 0xB0, 0x24, 0xF8, 0x06, 0xB0, 0x20, 0xD8, 0x00, 0x30, 0x20, 0xD8, 0x00, 0x30, 
+                                                0x20, 0xD8, 0x00, 0x30, 0x20, 0xD8, 0x00, 0x30, 0x20, 0xD8, 0x00, 0x30, 0x20, 0xD8, 0x00, 0x30,
+                                                0x00, 0x92, 0xF1, 0x30, 0x10, 0xB9, 0xCF, 0x30, 0x50, 0xD8, 0x9E, 0xBF, 0xC4, 0xB7, 0x7F, 0x28,
+                                                0xC4, 0xD2, 0x97, 0x3C, 0xD4, 0xB4, 0x9F, 0xBE, 0xD4, 0xB3, 0xA7, 0xA0, 0xE4, 0xB3, 0xB7, 0xBE, 
+                                                0xE8, 0xB3, 0xB7, 0xBF, 0xE8, 0xB3, 0xB7, 0xBF, 0xA8, 0xD3, 0xB7, 0x20, 0xB8, 0xD3, 0xBF, 0x3F, 
+                                                0xA8, 0xD3, 0xBF, 0x3F, 0xA8, 0xD3, 0xBF, 0x3F, 0xA4, 0xD2, 0xBE, 0xBF, 0xA8, 0xD2, 0xC6, 0x3F, 
+                                                0xA4, 0xD1, 0xBD, 0x20, 0x58, 0xD1, 0xC4, 0xA0, 0x24, 0xD0, 0x4B, 0xA0, 0xAA, 0x92, 0x4B, 0x20,
+                                                0x64, 0xB1, 0x90, 0x20 };
+
+constexpr byte Sound_Papa [128] PROGMEM = { 0x00, 0x99, 0xF8, 0x10, 0x90, 0x94, 0x94, 0x20, 0xA8, 0xCF, 0xB6, 0x20, 0xA4, 0xD0, 0xC7, 0x20,
+                                            0xA8, 0xD0, 0xCF, 0xBF, 0xA2, 0xD0, 0xCF, 0x20, 0xA1, 0xD0, 0xC7, 0x20, 0xE4, 0xCF, 0xAF, 0x3F,
+                                            0x90, 0xAE, 0x84, 0xBF, 0x10, 0xCE, 0x13, 0x30, 0x20, 0xB0, 0x72, 0x30, 0x20, 0xB0, 0x70, 0x30,
+                                            0x20, 0xB0, 0x70, 0x30, 0x20, 0xB0, 0x70, 0x30, 0x20, 0xB0, 0x70, 0x30, 0x20, 0xB0, 0x70, 0x30, 
+                                            0x20, 0xB0, 0x70, 0x30, 0x20, 0xB0, 0x70, 0x30, 0x41, 0xB2, 0x9D, 0xA9, 0xE8, 0xD0, 0xAF, 0x20,
+                                            0xE8, 0xD0, 0xBF, 0xBA, 0xA8, 0xD0, 0xBF, 0xBE, 0xF8, 0xD0, 0xC7, 0xA0, 0xF8, 0xD0, 0xC7, 0x3F,
+                                            0xA8, 0xD0, 0xC7, 0xBF, 0xE8, 0xD0, 0xC7, 0x20, 0xA8, 0xD0, 0xC6, 0xBE, 0x18, 0xCE, 0xD5, 0x30,
+                                            0x82, 0x97, 0xF4, 0xB0, 0x81, 0x77, 0xF3, 0xB0, 0x41, 0x96, 0xF9, 0xB0, 0x10, 0xB1, 0xF8, 0x10 };
+
+constexpr byte Sound_Quebec [148] PROGMEM = {   0x00, 0x99, 0xF8, 0x10, 0x14, 0xDA, 0xDE, 0x30, 0x04, 0xB7, 0x8D, 0xB0, 0x90, 0xDB, 0x6C, 0xA0,
+                                                0xE0, 0xDB, 0x66, 0x20, 0xE0, 0xDA, 0x76, 0x20, 0xE0, 0xDA, 0x7E, 0xA0, 0xD4, 0xB9, 0x7F, 0x3F, 
+                                                0xE9, 0xB8, 0x77, 0x20, 0xDA, 0xB4, 0x5D, 0x3A, 0xD9, 0xB2, 0x2B, 0x3F, 0xC4, 0xB2, 0x2A, 0xB0, 
+                                                0xD8, 0xB2, 0x32, 0x30, 0xD8, 0xB3, 0x32, 0x30, 0xA9, 0xB4, 0x33, 0xB0, 0xF9, 0xB6, 0x7E, 0xA5, 
+                                                0xE9, 0xB6, 0x8F, 0x20, 0xE9, 0xB7, 0x97, 0xA0, 0xE9, 0xB7, 0x97, 0x3F, 0xE9, 0xB8, 0x8F, 0xBF, 
+                                                0xE9, 0xB8, 0x8F, 0x3E, 0xE9, 0xB9, 0x7F, 0x3F, 0xEC, 0xB9, 0x5D, 0xBE, 0xA0, 0xBB, 0x6A, 0xB0, 
+                                                0x90, 0xB8, 0x69, 0xB0, 0x90, 0xB8, 0x68, 0x30, 0x90, 0xB8, 0x68, 0x30, 0x90, 0xB8, 0x68, 0x30, 
+                                                0x90, 0xB8, 0x68, 0x30, 0x90, 0xB8, 0x68, 0x30, 0x90, 0xB8, 0x68, 0x30, 0x90, 0xB8, 0x68, 0x30,
+                                                0x90, 0xB8, 0x68, 0x30, 0x05, 0xBB, 0xB4, 0xB0, 0x24, 0xDB, 0xC5, 0x30, 0x00, 0xDA, 0x83, 0xB0,
+                                                0x00, 0xDA, 0x80, 0x10 };
+
+constexpr byte Sound_Romeo [156] PROGMEM = {    0x95, 0xAE, 0x60, 0x10, 0xE4, 0xAD, 0x82, 0xA0, 0x90, 0xAB, 0x83, 0xA0, 0x52, 0xA7, 0x83, 0xA0, 
+                                                0x96, 0xA9, 0x8B, 0xBF, 0x82, 0xA3, 0x93, 0x22, 0x91, 0xA7, 0x9C, 0x20, 0xD9, 0xA8, 0x9D, 0x20, 
+                                                0x9A, 0xA8, 0x9D, 0xA4, 0xC9, 0xAA, 0x96, 0x22, 0xC0, 0xAD, 0x9E, 0xA4, 0x85, 0xAB, 0x96, 0xA2, 
+                                                0x84, 0xAD, 0x8F, 0x21, 0xC0, 0xAF, 0x86, 0xA1, 0xD4, 0xAE, 0x7E, 0xA0, 0xDC, 0xAD, 0x76, 0x3F, 
+                                                0x5C, 0xB0, 0x4E, 0x3E, 0x9C, 0xB1, 0x46, 0x21, 0x8C, 0xB2, 0x45, 0xA0, 0xDC, 0xB2, 0x45, 0xA0, 
+                                                0xEC, 0xB5, 0x76, 0xA0, 0xD8, 0xB7, 0x7F, 0x3F, 0xD4, 0xB8, 0x7F, 0xA0, 0xE8, 0xD9, 0x7F, 0x20, 
+                                                0xE8, 0xD9, 0x7F, 0x20, 0xD4, 0xD9, 0x7F, 0x20, 0xE4, 0xB9, 0x7F, 0xBF, 0xE8, 0xB8, 0x7F, 0x20, 
+                                                0xE8, 0xB5, 0x76, 0xBF, 0xE9, 0xB0, 0x76, 0x3F, 0xE8, 0xAE, 0x76, 0x3F, 0xF4, 0xAB, 0x6D, 0x3F, 
+                                                0xE9, 0xA9, 0x65, 0x3F, 0xE5, 0xA8, 0x64, 0xBF, 0x95, 0xC7, 0x64, 0xBF, 0x90, 0xA6, 0x6B, 0xBE, 
+                                                0xA2, 0xA7, 0x62, 0xB0, 0x40, 0xA3, 0x91, 0x30, 0x54, 0xAD, 0x60, 0x10 };
+
+constexpr byte Sound_Sierra [120] PROGMEM = {   0x09, 0xF9, 0xF8, 0x10, 0x09, 0xF9, 0xBC, 0xB0, 0x59, 0xF9, 0xAC, 0xB0, 0x59, 0xFA, 0xBC, 0xB0, 
+                                                0x19, 0xFA, 0x9C, 0xB0, 0x69, 0xFA, 0xAC, 0xB0, 0xD4, 0xDB, 0x5D, 0xA0, 0xD4, 0xDA, 0x6E, 0x20, 
+                                                0xE8, 0xDA, 0x7E, 0xA0, 0xE8, 0xD9, 0x7F, 0x3F, 0xE8, 0xD9, 0x7F, 0xBF, 0xE9, 0xB8, 0x87, 0xBF,
+                                                0xE8, 0xB7, 0x8F, 0x3F, 0xE8, 0xD6, 0x8E, 0xBF, 0x98, 0xB4, 0x8E, 0x3E, 0x68, 0xB4, 0x65, 0x30, 
+                                                0xAA, 0xB2, 0x8D, 0x30, 0x65, 0xB1, 0x84, 0xB0, 0xA8, 0xB0, 0xA5, 0xB0, 0xAC, 0xB0, 0xAD, 0xBF, 
+                                                0xA9, 0xB0, 0xBF, 0x20, 0xAD, 0xB0, 0xBF, 0x3F, 0xA8, 0xB0, 0xC7, 0x3F, 0xE8, 0xD0, 0xC7, 0x3F,
+                                                0xE8, 0xD0, 0xC7, 0x20, 0xA4, 0xD0, 0xC6, 0xBF, 0x64, 0xD0, 0xCE, 0x3F, 0x18, 0xCD, 0xDC, 0xB0, 
+                                                0x41, 0x97, 0xF3, 0x30, 0x80, 0xB8, 0xF0, 0x30 };
+
+constexpr byte Sound_Tango [120] PROGMEM = {    0x00, 0x99, 0xF8, 0x10, 0x00, 0xDA, 0xEF, 0xB0, 0xD4, 0xD3, 0x8E, 0xA0, 0xE4, 0xB2, 0xA7, 0xA0, 
+                                                0xF5, 0xB0, 0xAF, 0x3F, 0xE1, 0xAF, 0x9E, 0xBF, 0xB5, 0xAD, 0x8E, 0x20, 0xAD, 0xAE, 0x7E, 0x20, 
+                                                0x48, 0xB2, 0x8E, 0xA0, 0x48, 0xB6, 0xA6, 0xA0, 0x44, 0xB4, 0xAE, 0xA0, 0x48, 0xB0, 0xAE, 0xBF,
+                                                0x49, 0xAB, 0x76, 0x20, 0x5C, 0xAB, 0x6D, 0xBF, 0x4C, 0xA9, 0x75, 0xA0, 0x1C, 0xAA, 0x65, 0x3E,
+                                                0x1C, 0xAC, 0x6C, 0xBE, 0x23, 0xAD, 0x63, 0x3D, 0x20, 0xAF, 0x6D, 0xA0, 0xB9, 0xAF, 0x5C, 0xA0,
+                                                0xEC, 0xAF, 0x65, 0x24, 0xF4, 0xCD, 0x6C, 0xA0, 0xE4, 0xCC, 0x6C, 0xA0, 0xF4, 0xAC, 0x6D, 0x20,
+                                                0xE4, 0xAB, 0x75, 0x20, 0xF1, 0xCA, 0x6C, 0xBF, 0xE1, 0xA9, 0x6C, 0x3F, 0xF5, 0xA8, 0x5B, 0xBE,
+                                                0x50, 0xC8, 0x52, 0x30, 0x00, 0xC5, 0x00, 0x10 };
+
+constexpr byte Sound_Uniform [204] PROGMEM = {  0x00, 0x99, 0xF8, 0x10, 0xCC, 0xB8, 0x4B, 0xA0, 0xE4, 0xDB, 0x4C, 0x20, 0xF8, 0xDB, 0x45, 0x20, 
+                                                0xF4, 0xDB, 0x3D, 0x22, 0xE4, 0xDB, 0x3D, 0xA0, 0xE4, 0xDB, 0x3D, 0xA1, 0xF4, 0xDB, 0x3D, 0xA1,
+                                                0xE0, 0xBA, 0x46, 0x24, 0xD9, 0xB7, 0x4F, 0x24, 0xC9, 0xB6, 0x57, 0x23, 0x89, 0xAB, 0x5F, 0x22,
+                                                0x4A, 0xA4, 0x67, 0x20, 0x8A, 0xA5, 0x6F, 0x21, 0x8A, 0xAC, 0x67, 0x21, 0x8A, 0xB3, 0x67, 0xA0, 
+                                                0x89, 0xB6, 0x5F, 0x3D, 0x4C, 0xB9, 0x76, 0xA0, 0x4C, 0xBA, 0x6E, 0xBF, 0x8D, 0xB4, 0x4E, 0xBE, 
+                                                0xD4, 0xDA, 0x5F, 0x3E, 0xD4, 0xDA, 0x5E, 0xA0, 0xE5, 0xBA, 0x4E, 0xBE, 0xD4, 0xB9, 0x4D, 0xBF, 
+                                                0x94, 0xB7, 0x3C, 0xB0, 0x10, 0xB6, 0xFC, 0xB0, 0x11, 0xB7, 0xFD, 0x30, 0x41, 0xB8, 0xFD, 0xB0, 
+                                                0x45, 0xB4, 0xFD, 0xB0, 0x10, 0xD7, 0xB6, 0x30, 0x41, 0xB9, 0xFE, 0xB0, 0x00, 0xD8, 0xCC, 0xB0, 
+                                                0xE4, 0xB0, 0x7D, 0x3D, 0xE9, 0xB0, 0x97, 0x3F, 0xE9, 0xB0, 0x97, 0x3F, 0xE8, 0xB0, 0xA7, 0x3F, 
+                                                0xE8, 0xAF, 0xA7, 0x3F, 0xE8, 0xCF, 0xA6, 0xBF, 0xE4, 0xAF, 0xAF, 0x3F, 0xF4, 0xAE, 0xAE, 0x20, 
+                                                0xA9, 0xAD, 0xA6, 0xBF, 0xA9, 0xAC, 0xAE, 0xBF, 0xFD, 0xAC, 0xA6, 0x3F, 0xA9, 0xAC, 0x9D, 0xBF, 
+                                                0xED, 0xAC, 0x7D, 0x3E, 0x25, 0xAE, 0x25, 0xA2, 0x64, 0xAE, 0x44, 0xA1, 0x45, 0xAC, 0x44, 0x20, 
+                                                0x84, 0xD8, 0x3B, 0x3F, 0x16, 0xB1, 0x01, 0x30, 0x01, 0xA9, 0xC0, 0x10 };
+
+constexpr byte Sound_Victor [160] PROGMEM = {   0x00, 0xD7, 0x00, 0x10, 0xD0, 0xB8, 0x2A, 0x30, 0x80, 0xB9, 0x1A, 0x30, 0x94, 0xB9, 0x4C, 0x20, 
+                                                0xD0, 0xBA, 0x55, 0xA0, 0x90, 0xDB, 0x57, 0x20, 0x90, 0xDB, 0x4F, 0xA4, 0xC8, 0xBB, 0x47, 0x20, 
+                                                0x8C, 0xBA, 0x34, 0xBE, 0x84, 0xB7, 0x2A, 0x30, 0xC4, 0xBA, 0x21, 0x30, 0x88, 0xB7, 0x50, 0xB0, 
+                                                0x01, 0xB8, 0xBE, 0x30, 0x01, 0xB6, 0x34, 0x30, 0x48, 0xB6, 0x08, 0x30, 0x48, 0xB6, 0x08, 0x30, 
+                                                0x48, 0xB6, 0x08, 0x30, 0x48, 0xB6, 0x08, 0x30, 0x48, 0xB6, 0x08, 0x30, 0x48, 0xB6, 0x08, 0x30, 
+                                                0x05, 0xD6, 0x7A, 0x30, 0x00, 0xBA, 0xE5, 0x30, 0xE8, 0xD6, 0x7D, 0xBE, 0xD4, 0xD5, 0x8E, 0xBD, 
+                                                0xD8, 0xD4, 0x96, 0xBE, 0xE8, 0xD3, 0x9E, 0xA0, 0xE8, 0xD2, 0x9E, 0xA0, 0xFC, 0xD2, 0xA6, 0xA0, 
+                                                0xF8, 0xD1, 0xA6, 0xBF, 0xE8, 0xD1, 0xA6, 0xBE, 0xEC, 0xD1, 0xA6, 0x3F, 0xF8, 0xD0, 0xA5, 0xBF, 
+                                                0xF8, 0xD0, 0xA5, 0xBF, 0xF8, 0xD0, 0xA5, 0xBF, 0xE4, 0xCF, 0xA5, 0xBF, 0xE4, 0xCF, 0xA5, 0x3F, 
+                                                0xE4, 0xCE, 0x9C, 0xBF, 0xA4, 0xCC, 0x94, 0x3E, 0x71, 0xAC, 0x5A, 0x30, 0x20, 0xAC, 0x00, 0x10 };
+
+constexpr byte Sound_Whisky [128] PROGMEM = {   0x00, 0x88, 0x80, 0x10, 0x28, 0xA0, 0x7B, 0x20, 0x9C, 0xA2, 0x83, 0xA0, 0x59, 0xA5, 0x64, 0x20, 
+                                                0xE9, 0xAA, 0x64, 0xA3, 0xF9, 0xAE, 0x66, 0x22, 0xEC, 0xB2, 0x66, 0xA1, 0xC8, 0xB9, 0x67, 0xA2, 
+                                                0xE0, 0xDB, 0x5F, 0xA1, 0xF2, 0xDB, 0x56, 0x20, 0xE8, 0xDA, 0x4E, 0x3F, 0x09, 0xB9, 0x4D, 0xB0,
+                                                0x21, 0xBA, 0x4D, 0x30, 0x64, 0xFA, 0x4E, 0x30, 0x14, 0xFA, 0x4E, 0x30, 0x24, 0xF9, 0x4E, 0x30, 
+                                                0x04, 0xF4, 0x4C, 0x30, 0x04, 0xB4, 0x48, 0x30, 0x04, 0xB4, 0x48, 0x70, 0x00, 0xB5, 0x4C, 0x50, 
+                                                0x04, 0xDB, 0x4F, 0xB0, 0x04, 0xDC, 0x4E, 0x30, 0xE0, 0xDC, 0x56, 0x3F, 0xE0, 0xDB, 0x5F, 0x3E,
+                                                0xE4, 0xDB, 0x5F, 0xBE, 0xE4, 0xDB, 0x67, 0x3F, 0xE4, 0xDB, 0x67, 0x3F, 0xF0, 0xDC, 0x67, 0x3E,
+                                                0xF4, 0xDB, 0x66, 0xBE, 0xF0, 0xDB, 0x65, 0xBE, 0xA4, 0xDB, 0x2C, 0xB0, 0x81, 0xB7, 0xD8, 0x30 };
+
+constexpr byte Sound_X_ray [104] PROGMEM = {    0x51, 0x99, 0x70, 0x10, 0xF4, 0xDA, 0x6D, 0xA0, 0xE9, 0xDA, 0x67, 0x20, 0xE5, 0xBA, 0x67, 0xC0,
+                                                0x98, 0xBA, 0x5F, 0xBF, 0x88, 0xBA, 0x3D, 0x39, 0xF0, 0xDB, 0x32, 0xB0, 0x8C, 0xB6, 0x62, 0x30, 
+                                                0x04, 0xB8, 0x64, 0xB0, 0x04, 0xB7, 0x66, 0x30, 0x14, 0xB8, 0x6D, 0x30, 0x11, 0xF8, 0x75, 0xF0, 
+                                                0x11, 0xF5, 0x86, 0xF0, 0x11, 0xF5, 0x8C, 0xD0, 0x24, 0xB3, 0x8D, 0x30, 0xA4, 0xB3, 0x95, 0xA1, 
+                                                0xD8, 0xB3, 0x9E, 0x20, 0xD8, 0xB4, 0xA7, 0x40, 0xE0, 0xB5, 0xA7, 0x21, 0xD0, 0xB5, 0xA7, 0x3F, 
+                                                0xE4, 0xD7, 0x9F, 0x40, 0xD8, 0xD7, 0x96, 0xBF, 0x64, 0xD8, 0x64, 0xBF, 0x02, 0x98, 0xE4, 0xB0, 
+                                                0x30, 0xB8, 0x99, 0xB0, 0x70, 0xD8, 0x90, 0x30 };
+
+constexpr byte Sound_Yankee [160] PROGMEM = {   0xC4, 0xBA, 0x68, 0x10, 0xE0, 0xBB, 0x5B, 0xA0, 0xF8, 0xDB, 0x5C, 0xA0, 0xF4, 0xDB, 0x55, 0x20, 
+                                                0xF4, 0xFB, 0x55, 0xA0, 0xFC, 0xFB, 0x55, 0xA1, 0xF4, 0xFB, 0x55, 0xA1, 0xF4, 0xDB, 0x66, 0xA1, 
+                                                0xE4, 0xDA, 0x7F, 0x23, 0xD8, 0xB7, 0x97, 0xA0, 0xED, 0xB4, 0x9F, 0xA0, 0xEC, 0xB1, 0x9F, 0x20, 
+                                                0xEC, 0xCF, 0x96, 0x20, 0xE8, 0xAE, 0x85, 0x20, 0xE8, 0xAD, 0x74, 0xBF, 0x98, 0xAE, 0x64, 0xA0, 
+                                                0x4C, 0xA7, 0x74, 0xBF, 0x4C, 0xA8, 0x7D, 0x20, 0x9C, 0xAB, 0x5C, 0xBF, 0xAC, 0xAB, 0x54, 0x3F, 
+                                                0x48, 0xAA, 0x32, 0xB0, 0x08, 0xA1, 0x6A, 0x30, 0x48, 0xAE, 0x80, 0x30, 0x48, 0xAE, 0x80, 0x30, 
+                                                0x48, 0xAE, 0x80, 0x30, 0x48, 0xAE, 0x80, 0x30, 0x48, 0xAE, 0x80, 0x30, 0x48, 0xAE, 0x80, 0x30, 
+                                                0x00, 0xDB, 0xFC, 0xB0, 0x04, 0xDB, 0xE5, 0xB0, 0x08, 0xD5, 0xFD, 0xB0, 0xD9, 0xBB, 0x4D, 0x21, 
+                                                0xE5, 0xBB, 0x56, 0x20, 0xF0, 0xDB, 0x5D, 0xBE, 0xF0, 0xDB, 0x55, 0xBF, 0xE0, 0xDB, 0x5D, 0xBF,
+                                                0xE1, 0xDB, 0x55, 0xA0, 0xE4, 0xDB, 0x4C, 0xBF, 0xE1, 0xDC, 0x3B, 0x3F, 0x45, 0xB3, 0xD0, 0x30 };
+        
+constexpr byte Sound_Zulu [116] PROGMEM = { 0x80, 0xD6, 0x30, 0x10, 0xD2, 0xD8, 0x4C, 0x20, 0xEC, 0xD8, 0x4C, 0xA0, 0xE4, 0xD8, 0x45, 0xBD, 
+                                            0xA8, 0xD8, 0x46, 0x30, 0x01, 0xD8, 0x26, 0xB0, 0x02, 0xD8, 0x26, 0xB0, 0x9D, 0xB8, 0x57, 0x28, 
+                                            0x94, 0xB7, 0x5F, 0x25, 0x94, 0xB4, 0x5F, 0x20, 0x48, 0xCE, 0x5E, 0xA1, 0x48, 0xAC, 0x5E, 0xA0, 
+                                            0x48, 0xC7, 0x66, 0x20, 0x4C, 0xA5, 0x66, 0x20, 0x98, 0xA9, 0x4D, 0xA0, 0x58, 0xA9, 0x3C, 0x3E, 
+                                            0x84, 0xAC, 0x3C, 0x3F, 0x58, 0xB0, 0x3D, 0x3E, 0xA8, 0xD1, 0x4D, 0xA0, 0xA8, 0xD0, 0x55, 0xBF, 
+                                            0x94, 0xB0, 0x66, 0x20, 0xEB, 0xAC, 0x66, 0x20, 0xE9, 0xCB, 0x5D, 0xBF, 0xEC, 0xCA, 0x5D, 0xBF,
+                                            0xE8, 0xC8, 0x54, 0xBF, 0xA4, 0xC6, 0x54, 0x3F, 0x90, 0xA6, 0x64, 0x3F, 0x14, 0xC4, 0x2B, 0x30,
+                                            0x24, 0xC6, 0x00, 0x10 };
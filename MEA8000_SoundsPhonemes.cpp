@@ -0,0 +1,134 @@
+/*
+
+    MEA8000_SoundsPhonemes.cpp
+
+    The sounds based on French phonemes (NoSound, Sound_a .. Sound_o), used by the
+    text to speech of MEA8000_French.h.
+    Declared in MEA8000_Sounds.h, see MEA8000_Sounds.cpp for the layout of the data.
+
+ */
+
+#include "MEA8000_Sounds.h"
+
+
+constexpr byte NoSound [8] PROGMEM = { 0xAB, 0xB3, 0x80, 0x20, 0xAB, 0xB3, 0x80, 0x20 };
+
+// Phonemes
+
+constexpr byte Sound_a  [32] PROGMEM = { 0x86, 0xB3, 0xCD, 0xA0, 0x86, 0xB3, 0xCD, 0xA0, 0x86, 0xB2, 0xD6, 0xA0, 0x86, 0xB2, 0xD6, 0xA0,
+                                         0x96, 0xB2, 0xCE, 0xA0, 0x96, 0xB2, 0xCE, 0xA0, 0x97, 0xB1, 0xCD, 0xA0, 0x97, 0xB1, 0xCD, 0xA0 }; 
+
+constexpr byte Sound_e  [32] PROGMEM = { 0xAF, 0xB3, 0x85, 0x20, 0xAF, 0xB3, 0x85, 0x20, 0xAB, 0xB3, 0x7E, 0x20, 0xAB, 0xB3, 0x7E, 0x20,
+                                         0xAB, 0xB3, 0x86, 0x20, 0xAB, 0xB3, 0x86, 0x20, 0xFF, 0xB3, 0x85, 0x20, 0xFF, 0xB3, 0x85, 0x20 };
+
+constexpr byte Sound_i  [32] PROGMEM = { 0xAF, 0xDA, 0x5D, 0x20, 0xAF, 0xDA, 0x5D, 0x20, 0xAF, 0xDA, 0x5E, 0x20, 0xAF, 0xDA, 0x5E, 0x20,
+                                         0xAF, 0xDA, 0x66, 0x20, 0xAF, 0xDA, 0x66, 0x20, 0xAF, 0xDA, 0x65, 0x20, 0xAF, 0xDA, 0x65, 0x20 };  
+
+constexpr byte Sound_oo [32] PROGMEM = { 0xC7, 0xAC, 0x84, 0xA0, 0xC7, 0xAC, 0x84, 0xA0, 0xC6, 0xAB, 0x85, 0x20, 0xC6, 0xAB, 0x85, 0x20,
+                                         0xC6, 0xAB, 0x85, 0x20, 0xC6, 0xAB, 0x85, 0x20, 0xD6, 0xAB, 0x84, 0xA0, 0xD6, 0xAB, 0x84, 0xA0 };
+
+constexpr byte Sound_u  [32] PROGMEM = { 0xB7, 0xB7, 0x5D, 0x20, 0xB7, 0xB7, 0x5D, 0x20, 0xB7, 0xB7, 0x66, 0xA0, 0xB7, 0xB7, 0x66, 0xA0,
+                                         0xB7, 0xB7, 0x66, 0xA0, 0xB7, 0xB7, 0x66, 0xA0, 0xB7, 0xB7, 0x5D, 0x20, 0xB7, 0xB7, 0x5D, 0x20 };
+
+constexpr byte Sound_eh [32] PROGMEM = { 0xA6, 0xB6, 0xB5, 0x20, 0xA6, 0xB6, 0xB5, 0x20, 0xB6, 0xB6, 0xBF, 0x20, 0xB6, 0xB6, 0xBF, 0x20,
+                                         0xB6, 0xB6, 0xB7, 0x20, 0xB6, 0xB6, 0xB7, 0x20, 0xFA, 0xB7, 0xA5, 0x20, 0xFA, 0xB7, 0xA5, 0x20 }; 
+
+constexpr byte Sound_ee [32] PROGMEM = { 0xBB, 0xB8, 0x85, 0xA0, 0xBB, 0xB8, 0x85, 0xA0, 0xBB, 0xB8, 0x87, 0x20, 0xBB, 0xB8, 0x87, 0x20,
+                                         0xBB, 0xB8, 0x87, 0x20, 0xBB, 0xB8, 0x87, 0x20, 0xFB, 0xB8, 0x85, 0xA0, 0xFB, 0xB8, 0x85, 0xA0 };
+
+constexpr byte Sound_oh [32] PROGMEM = { 0x52, 0xCA, 0xBD, 0x20, 0x52, 0xCA, 0xBD, 0x20, 0x97, 0xCA, 0xBD, 0xA0, 0x97, 0xCA, 0xBD, 0xA0,
+                                         0x97, 0xCA, 0xBD, 0xA0, 0x97, 0xCA, 0xBD, 0xA0, 0x83, 0xCA, 0xBD, 0x20, 0x83, 0xCA, 0xBD, 0x20 }; 
+
+constexpr byte Sound_w  [32] PROGMEM = { 0x66, 0xB4, 0xBD, 0xA0, 0x66, 0xB4, 0xBD, 0xA0, 0x66, 0xB5, 0xBF, 0x20, 0x66, 0xB5, 0xBF, 0x20,
+                                         0x65, 0xB5, 0xC7, 0x20, 0x65, 0xB5, 0xC7, 0x20, 0x61, 0xB5, 0xD5, 0xA0, 0x61, 0xB5, 0xD5, 0xA0 };  
+
+constexpr byte Sound_A  [32] PROGMEM = { 0x82, 0xD1, 0xA5, 0x20, 0x82, 0xD1, 0xA5, 0xA0, 0x83, 0xCD, 0xAE, 0xA0, 0xC3, 0xCE, 0xAE, 0xA0,
+                                         0xC3, 0xD1, 0x9E, 0xA0, 0xD2, 0xD3, 0x96, 0x20, 0x92, 0xD2, 0x95, 0x20, 0x92, 0xD2, 0x95, 0x20 };
+
+constexpr byte Sound_I  [56] PROGMEM = { 0x5A, 0x84, 0x9C, 0x20, 0x5A, 0x84, 0x9C, 0x20, 0x5A, 0x84, 0x9D, 0x20, 0x5A, 0x84, 0x9D, 0x20,
+                                         0x5A, 0x8A, 0xB6, 0xA0, 0x5A, 0x8A, 0xB6, 0xA0, 0x87, 0xAD, 0xC6, 0xA0, 0x87, 0xAD, 0xC6, 0xA0,
+                                         0x47, 0xB1, 0xCE, 0xA0, 0x47, 0xB1, 0xCE, 0xA0, 0x97, 0xB2, 0xC6, 0x20, 0x97, 0xB2, 0xC6, 0x20,
+                                         0x9B, 0xB1, 0xC4, 0x20, 0x9B, 0xB1, 0xC4, 0x20 };
+
+constexpr byte Sound_O  [32] PROGMEM = { 0xD6, 0xB3, 0x6C, 0xA0, 0xD6, 0xB3, 0x6D, 0x20, 0xFA, 0xB4, 0x66, 0x20, 0xFA, 0xB4, 0x66, 0x20,
+                                         0xFA, 0xB4, 0x66, 0x20, 0xFA, 0xB4, 0x66, 0x20, 0xF6, 0xB4, 0x65, 0x20, 0xEA, 0xB4, 0x64, 0xA0 };
+
+constexpr byte Sound_W  [32] PROGMEM = { 0x9B, 0xAD, 0x6C, 0xA0, 0x9B, 0xAD, 0x6C, 0xA0, 0xDB, 0xAE, 0x6D, 0x20, 0xDB, 0xAE, 0x6D, 0x20,
+                                         0xDB, 0xAE, 0x6D, 0x20, 0xDB, 0xAE, 0x6D, 0x20, 0x9B, 0xAE, 0x6C, 0xA0, 0x9B, 0xAE, 0x6C, 0xA0 };
+
+constexpr byte Sound_b  [24] PROGMEM = { 0x80, 0xD6, 0x18, 0x20, 0x60, 0xD6, 0x1A, 0xA0, 0x90, 0xB2, 0x13, 0xA0, 0xA4, 0xB2, 0x13, 0xA0,
+                                         0xA5, 0xB1, 0x24, 0xA0, 0xE1, 0x91, 0x76, 0x20 };
+
+constexpr byte Sound_d  [24] PROGMEM = { 0x80, 0xB5, 0x18, 0x20, 0x80, 0xB5, 0x1B, 0xA0, 0x10, 0xD5, 0x04, 0xA0, 0xA0, 0xD5, 0x0C, 0x20,
+                                         0x40, 0xD2, 0x2C, 0xA0, 0x40, 0xD9, 0x5E, 0x20 };
+
+constexpr byte Sound_f  [32] PROGMEM = { 0x16, 0xB7, 0xFD, 0xB0, 0x16, 0xB7, 0xFE, 0x30, 0x16, 0xB7, 0xFE, 0xB0, 0x16, 0xB7, 0xFE, 0xB0,
+                                         0x16, 0xB7, 0xFE, 0xB0, 0x16, 0xB7, 0xFE, 0xB0, 0x16, 0xBF, 0xFE, 0x30, 0x16, 0xB7, 0xFD, 0xB0 };
+
+constexpr byte Sound_g  [16] PROGMEM = { 0xFF, 0x97, 0x60, 0x20, 0xFF, 0x97, 0x63, 0xA0, 0xFA, 0x97, 0x66, 0xA0, 0xA6, 0x97, 0x66, 0xA0 };
+
+constexpr byte Sound_j  [20] PROGMEM = { 0x1E, 0xBA, 0x7C, 0x30, 0x1E, 0xBA, 0x7D, 0xA0, 0x1E, 0xBA, 0x76, 0xB0, 0x1E, 0xBA, 0x76, 0xA0,
+                                         0x1E, 0xBA, 0x75, 0xB0 };
+
+constexpr byte Sound_k  [16] PROGMEM = { 0x09, 0x97, 0x88, 0x30, 0x0D, 0x97, 0x8F, 0xB0, 0x09, 0x97, 0x8E, 0xB0, 0x67, 0x96, 0x86, 0x20 };
+
+constexpr byte Sound_l  [20] PROGMEM = { 0x74, 0xB5, 0x55, 0x20, 0x74, 0xB5, 0x55, 0x20, 0x74, 0xB6, 0x2E, 0x20, 0x74, 0xB6, 0x2E, 0x20,
+                                         0x28, 0xB5, 0x55, 0x20 };
+
+constexpr byte Sound_m  [32] PROGMEM = { 0x4C, 0xB4, 0x5C, 0xA0, 0x4C, 0xB4, 0x5C, 0xA0, 0x4C, 0xB4, 0x5D, 0x20, 0x4C, 0xB4, 0x5D, 0xA0,
+                                         0x4A, 0xB4, 0xB4, 0x5E, 0x4A, 0xB4, 0x5E, 0x20, 0x4A, 0xB4, 0x5D, 0xA0, 0x4A, 0xB4, 0x5D, 0x20 };
+
+constexpr byte Sound_n  [16] PROGMEM = { 0x88, 0xB4, 0x55, 0x20, 0x48, 0xB4, 0x5E, 0x20, 0x4C, 0xB4, 0x5F, 0x20, 0x4A, 0xB4, 0x5E, 0x20 };
+
+constexpr byte Sound_p  [20] PROGMEM = { 0xC2, 0xB9, 0x38, 0x30, 0xC2, 0xB9, 0x38, 0x30, 0x11, 0xB6, 0x97, 0xB0, 0x16, 0xB3, 0x8E, 0x30,
+                                         0x5B, 0xB2, 0x8D, 0xA0 };
+
+constexpr byte Sound_R  [16] PROGMEM = { 0x3A, 0xB3, 0x84, 0x20, 0x36, 0xB3, 0x8D, 0xA0, 0x79, 0xB2, 0x96, 0x20, 0x97, 0xB1, 0xCD, 0x20 };
+
+constexpr byte Sound_r  [20] PROGMEM = { 0xF5, 0xB0, 0xA4, 0xA0, 0xB5, 0x8F, 0x86, 0x20, 0xB5, 0x8F, 0x83, 0xA0, 0x54, 0xB0, 0x3C, 0xA0,
+                                         0x54, 0xB0, 0x3A, 0xA0 };
+
+constexpr byte Sound_s  [28] PROGMEM = { 0x09, 0xF3, 0xBD, 0x30, 0x09, 0xF3, 0xBD, 0x30, 0x09, 0xF3, 0xBD, 0xB0, 0x09, 0xF3, 0x8D, 0xB0,
+                                         0x09, 0xF3, 0x8D, 0xB0, 0x09, 0xF3, 0x8D, 0x30, 0x09, 0xF3, 0x8D, 0x30 };
+
+constexpr byte Sound_t  [16] PROGMEM = { 0xB6, 0xF6, 0x90, 0x30, 0xB6, 0xF6, 0x94, 0x30, 0xB6, 0xF6, 0x96, 0x30, 0x9B, 0xB4, 0x8D, 0x10 };
+
+constexpr byte Sound_v  [28] PROGMEM = { 0x6A, 0xB2, 0x84, 0xA0, 0x6A, 0xB2, 0x85, 0x20, 0x6A, 0xB2, 0x86, 0x20, 0x6A, 0xB2, 0x86, 0xA0,
+                                         0x6A, 0xB2, 0x86, 0xB0, 0x6A, 0xB2, 0x86, 0xB0, 0x6A, 0xB2, 0x86, 0x30 };
+
+constexpr byte Sound_z  [16] PROGMEM = { 0x12, 0xF5, 0x76, 0x20, 0x12, 0xF5, 0x76, 0xA0, 0x12, 0xF5, 0x77, 0x30, 0xAA, 0xB4, 0x76, 0xA0 };
+
+constexpr byte Sound_ch [28] PROGMEM = { 0x29, 0xBA, 0x8E, 0x30, 0x29, 0xBA, 0x8E, 0xB0, 0x29, 0xBA, 0x8E, 0xB0, 0x29, 0xBA, 0x8E, 0xB0,
+                                         0x29, 0xBA, 0x8E, 0xB0, 0x29, 0xBA, 0x8E, 0xB0, 0x29, 0xBA, 0x8E, 0x30 };
+
+constexpr byte Sound_N  [52] PROGMEM = { 0x98, 0xD7, 0x5D, 0xA0, 0x98, 0xD7, 0x5D, 0xA0, 0x98, 0xD7, 0x5D, 0xA0, 0x99, 0xD6, 0x55, 0x20,
+                                         0x8E, 0xD6, 0x5C, 0x20, 0x8F, 0xD8, 0x5E, 0x20, 0x8F, 0xD8, 0x5E, 0x20, 0xAF, 0xD8, 0x56, 0xA0,
+                                         0xAF, 0xD8, 0x56, 0xA0, 0xAF, 0xD8, 0x56, 0xA0, 0x7F, 0xD8, 0x5F, 0x20, 0x7F, 0xD8, 0x5F, 0x20,
+                                         0x6B, 0xB7, 0x6F, 0xA0 };
+
+constexpr byte Sound_ai [60] PROGMEM = { 0x57, 0xB3, 0xDD, 0xA0, 0x46, 0xB4, 0xE7, 0xA0, 0x46, 0xB4, 0xDF, 0xA0, 0xAB, 0xB4, 0xCF, 0xA0,
+                                         0xAB, 0xB4, 0xCF, 0xA0, 0xEA, 0xB5, 0xC7, 0x20, 0xEA, 0xB5, 0xC7, 0x20, 0xFA, 0xB6, 0xB6, 0xA0,
+                                         0xFA, 0xB6, 0xB6, 0xA0, 0xBA, 0xB7, 0x9E, 0x20, 0xBA, 0xB7, 0x9E, 0x20, 0xBA, 0xD8, 0x7D, 0x20,
+                                         0xBA, 0xD8, 0x7D, 0x20, 0xFA, 0xD8, 0x73, 0x20, 0xFA, 0xD8, 0x73, 0x20 };
+
+constexpr byte Sound_ej [60] PROGMEM = { 0xBB, 0xB7, 0xB6, 0x20, 0xBB, 0xB7, 0xB6, 0x20, 0xFB, 0xB7, 0xAF, 0x20, 0xFB, 0xB7, 0xAF, 0x20,
+                                         0xFB, 0xB7, 0xAF, 0xA0, 0xFB, 0xB7, 0xAF, 0xA0, 0xBB, 0xB7, 0x9F, 0xA0, 0xBB, 0xB7, 0x9F, 0xA0,
+                                         0xB6, 0xB8, 0x9F, 0x20, 0xBA, 0xD8, 0x8F, 0x20, 0xBA, 0xD8, 0x8F, 0x20, 0xBA, 0xD8, 0x7E, 0xA0,
+                                         0xBA, 0xD8, 0x7E, 0xA0, 0xFA, 0xD8, 0x75, 0xA0, 0xFA, 0xD8, 0x75, 0xA0 };
+
+constexpr byte Sound_ui [60] PROGMEM = { 0xEB, 0xB3, 0xAE, 0x20, 0xEB, 0xB3, 0xAE, 0x20, 0x97, 0xB4, 0xA7, 0x20, 0x97, 0xB4, 0xA7, 0x20,
+                                         0x97, 0xB4, 0xA7, 0xA0, 0x57, 0xB4, 0xA7, 0xA0, 0x67, 0xB6, 0x9F, 0x20, 0x67, 0xB6, 0x9F, 0x20,
+                                         0x77, 0xB6, 0x87, 0x20, 0xBB, 0xB7, 0x7E, 0xA0, 0xEB, 0xB7, 0x7E, 0xA0, 0xAB, 0xB8, 0x7E, 0x20,
+                                         0xAB, 0xD8, 0x76, 0x20, 0x6B, 0xD8, 0x76, 0x20, 0xBA, 0xB7, 0x8C, 0xA0 };
+
+constexpr byte Sound_ie [60] PROGMEM = { 0x7F, 0xD8, 0x6D, 0x20, 0x7F, 0xD8, 0x6E, 0xA0, 0x7F, 0xD8, 0x6E, 0xA0, 0xBF, 0xD7, 0x87, 0x20,
+                                         0xFB, 0xD7, 0x8F, 0x20, 0xBB, 0xD7, 0x9F, 0xA0, 0x67, 0xD6, 0xBF, 0xA0, 0x67, 0xD6, 0xBF, 0xA0,
+                                         0x67, 0xD5, 0xBF, 0x20, 0x67, 0xD5, 0xBF, 0x20, 0x61, 0xD5, 0xBE, 0x20, 0x61, 0xD5, 0xBE, 0x20,
+                                         0x61, 0xD5, 0xBE, 0x20, 0x61, 0xD4, 0xC5, 0x20, 0x61, 0xD4, 0xC5, 0x20 };
+
+constexpr byte Sound_oi [40] PROGMEM = { 0x86, 0x94, 0xBD, 0xA0, 0x86, 0x94, 0xBE, 0xA0, 0x86, 0x96, 0xC7, 0x20, 0x42, 0xB4, 0xD7, 0xA0,
+                                         0x53, 0xB5, 0xCF, 0xA0, 0x62, 0xB5, 0xC7, 0x20, 0x62, 0xB5, 0xC6, 0xA0, 0x62, 0xB5, 0xC6, 0x20,
+                                         0x62, 0xB5, 0xC5, 0xA0, 0x62, 0xB5, 0xC5, 0x20 };
+
+constexpr byte Sound_o  [32] PROGMEM = { 0xAD, 0xAF, 0xA5, 0x20, 0xAD, 0xAF, 0xA5, 0x20, 0xAD, 0xAF, 0xA6, 0x20, 0xAD, 0xAF, 0xA6, 0x20,
+                                         0xAD, 0xAD, 0x96, 0x20, 0xAD, 0xAD, 0x96, 0x20, 0xF9, 0xAD, 0x8D, 0x20, 0xF9, 0xAD, 0x8D, 0x20 };
@@ -0,0 +1,55 @@
+/*
+
+    MEA8000_Spell.cpp
+
+    Spelling of codes with the NATO alphabet, see MEA8000_Spell.h
+
+ */
+
+#include "MEA8000_Spell.h"
+#include "MEA8000_Numbers.h"
+
+
+// (The official "Mike" is not in the data set, "Michael" is)
+const SoundSpan natoAlphabet [26] PROGMEM = {
+    SOUND(Sound_Alpha),   SOUND(Sound_Bravo),   SOUND(Sound_Charlie), SOUND(Sound_Delta),   SOUND(Sound_Echo),
+    SOUND(Sound_Foxtrot), SOUND(Sound_Golf),    SOUND(Sound_Hotel),   SOUND(Sound_India),   SOUND(Sound_Juliet),
+    SOUND(Sound_Kilo),    SOUND(Sound_Lima),    SOUND(Sound_Michael), SOUND(Sound_November), SOUND(Sound_Oscar),
+    SOUND(Sound_Papa),    SOUND(Sound_Quebec),  SOUND(Sound_Romeo),   SOUND(Sound_Sierra),  SOUND(Sound_Tango),
+    SOUND(Sound_Uniform), SOUND(Sound_Victor),  SOUND(Sound_Whisky),  SOUND(Sound_X_ray),   SOUND(Sound_Yankee),
+    SOUND(Sound_Zulu) };
+
+
+bool spellCharacter(char character, SoundSpan *span) {
+    if (character >= 'a' && character <= 'z') character -= 'a' - 'A';
+
+    if (character >= 'A' && character <= 'Z') {
+        *span = readSoundSpan(&natoAlphabet[character - 'A']);
+        return true;
+    }
+    if (character >= '0' && character <= '9') {
+        *span = readSoundSpan(&englishParts[EN_ZERO + character - '0']);
+        return true;
+    }
+    return false;
+}
+
+byte spellCode(const char *text, SoundSpan *spans, byte maxSpans, byte gap) {
+    const SoundSpan silence = SOUND(NoSound);
+    byte            count   = 0;
+    byte            pending = 0;        // gaps still to put in front of the next word
+
+    for (; *text; text++) {
+        SoundSpan word;
+        if (!spellCharacter(*text, &word)) {
+            if (*text == ' ' || *text == '-') pending++;
+            continue;
+        }
+        if (count > 0) pending += gap;
+        if (count + pending + 1 > maxSpans) break;
+
+        for (; pending > 0; pending--) spans[count++] = silence;
+        spans[count++] = word;
+    }
+    return count;
+}
@@ -0,0 +1,35 @@
+/*
+
+    MEA8000_Spell.h
+
+    Spelling of codes (serial numbers and the like) with the NATO alphabet.
+
+    Letters are spoken as Alpha .. Zulu, digits as the English numbers Zero .. Nine.
+    The result is a list of SoundSpans pointing into Flash, between the words
+    'gap' times NoSound is inserted (NoSound is 2 frames of 16 ms, so 32 ms per gap).
+    A space or a '-' in the text adds one extra gap.
+
+    Nothing is copied or allocated, hand the list to a SoundStream to play it:
+
+        SoundSpan   spans[32];
+        byte        count = spellCode("AB-1234", spans, 32, 2);
+        SoundStream stream(spans, count);
+
+ */
+
+#ifndef MEA8000_SPELL_H
+#define MEA8000_SPELL_H
+
+#include "MEA8000_Sounds.h"
+
+
+extern const SoundSpan  natoAlphabet [26] PROGMEM;
+
+// The sound for one letter or digit, false for anything else
+bool spellCharacter(char character, SoundSpan *span);
+
+// Fill 'spans' (room for 'maxSpans') with the spelling of 'text'.
+// Returns the number of spans used. Stops at the last complete word that fits.
+byte spellCode(const char *text, SoundSpan *spans, byte maxSpans, byte gap);
+
+#endif
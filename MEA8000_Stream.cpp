@@ -0,0 +1,44 @@
+/*
+
+    MEA8000_Stream.cpp
+
+    Frame by frame reading of sounds, see MEA8000_Stream.h
+
+ */
+
+#include "MEA8000_Stream.h"
+#include "MEA8000_Flash.h"
+
+
+SoundStream::SoundStream() {
+    begin(NULL, 0);
+}
+
+SoundStream::SoundStream(const SoundSpan *spans, byte count) {
+    begin(spans, count);
+}
+
+void SoundStream::begin(const SoundSpan *spans, byte count) {
+    this->spans = spans;
+    this->count = count;
+    index       = 0;
+    startSpan();
+}
+
+void SoundStream::startSpan() {
+    offset = (index < count) ? soundHeaderSize(spans[index].data, spans[index].length) : 0;
+}
+
+bool SoundStream::nextFrame(byte *frame) {
+    while (index < count) {
+        const SoundSpan &span = spans[index];
+        if (offset + MEA8000_FRAME_SIZE <= span.length) {
+            flashReadFrame(frame, span.data + offset);
+            offset += MEA8000_FRAME_SIZE;
+            return true;
+        }
+        index++;
+        startSpan();
+    }
+    return false;
+}
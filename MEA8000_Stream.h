@@ -0,0 +1,49 @@
+/*
+
+    MEA8000_Stream.h
+
+    Frame by frame reading of sounds.
+
+    A FrameSource hands out one 4 byte frame at a time, ready to be written to the
+    MEA8000 (or to a software renderer). SoundStream is the basic one: it walks over
+    a list of SoundSpans, skips the headers and reads the frames straight from Flash.
+    Nothing is copied, only the frame being handed out.
+
+ */
+
+#ifndef MEA8000_STREAM_H
+#define MEA8000_STREAM_H
+
+#include "MEA8000_Sounds.h"
+#include "MEA8000_Frame.h"
+
+
+class FrameSource {
+public:
+    // Copy the next frame (MEA8000_FRAME_SIZE bytes) into 'frame', false at the end
+    virtual bool nextFrame(byte *frame) = 0;
+};
+
+
+class SoundStream : public FrameSource {
+public:
+    SoundStream();
+    SoundStream(const SoundSpan *spans, byte count);
+
+    // (Re)start on a list of spans, the list itself must stay in place while streaming
+    void begin(const SoundSpan *spans, byte count);
+    bool nextFrame(byte *frame);
+
+    // The span the last frame came from
+    byte spanIndex() const  { return index; }
+
+private:
+    void startSpan();
+
+    const SoundSpan *spans;
+    byte            count;
+    byte            index;
+    uint16_t        offset;
+};
+
+#endif
@@ -0,0 +1,27 @@
+/*
+
+    MEA8000_Tables.cpp
+
+    The values behind the frame fields, see MEA8000_Tables.h
+
+ */
+
+#include "MEA8000_Tables.h"
+
+
+const uint16_t frameFM1Hz [32] PROGMEM = {
+     150,  162,  174,  188,  202,  217,  233,  250,  267,  286,  305,  325,  346,  368,  391,  415,
+     440,  466,  494,  523,  554,  587,  622,  659,  698,  740,  784,  830,  880,  932,  988, 1047 };
+
+const uint16_t frameFM2Hz [32] PROGMEM = {
+     440,  466,  494,  523,  554,  587,  622,  659,  698,  740,  784,  830,  880,  932,  988, 1047,
+    1100, 1179, 1254, 1337, 1428, 1528, 1639, 1761, 1897, 2047, 2214, 2400, 2609, 2842, 3105, 3400 };
+
+const uint16_t frameFM3Hz [8] PROGMEM = {
+    1179, 1337, 1528, 1761, 2047, 2400, 2842, 3400 };
+
+const uint16_t frameBWHz [4] PROGMEM = {
+     726,  309,  125,   50 };
+
+const uint16_t frameAMPLScale [16] PROGMEM = {
+       0,    8,   11,   16,   22,   31,   44,   62,   88,  125,  177,  250,  354,  500,  707, 1000 };
@@ -0,0 +1,33 @@
+/*
+
+    MEA8000_Tables.h
+
+    The values behind the frame fields, from the table at the top of MEA8000_Sounds.cpp.
+    For the code that has to know what a frame sounds like (renderers, encoders, voice
+    changes), the chip itself does not need them.
+
+ */
+
+#ifndef MEA8000_TABLES_H
+#define MEA8000_TABLES_H
+
+#include "MEA8000_Frame.h"
+
+
+#define MEA8000_FM4_HZ          3500
+#define MEA8000_SAMPLE_RATE     8000    // the chip's output rate
+#define MEA8000_STEP_SAMPLES    64      // samples in 8 ms
+#define MEA8000_DEFAULT_PITCH   47      // start pitch (Hz / 2) for sounds without a header
+
+extern const uint16_t frameFM1Hz [32] PROGMEM;
+extern const uint16_t frameFM2Hz [32] PROGMEM;
+extern const uint16_t frameFM3Hz [8] PROGMEM;
+extern const uint16_t frameBWHz [4] PROGMEM;
+extern const uint16_t frameAMPLScale [16] PROGMEM;     // in 1/1000
+
+// The start pitch (Hz / 2) of a sound in Flash: that of its header, MEA8000_DEFAULT_PITCH without one
+inline byte soundStartPitch(const byte *data, uint16_t length) {
+    return soundHeaderSize(data, length) ? pgm_read_byte(data + 2) : MEA8000_DEFAULT_PITCH;
+}
+
+#endif
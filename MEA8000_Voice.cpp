@@ -0,0 +1,86 @@
+/*
+
+    MEA8000_Voice.cpp
+
+    Other voices from the same sounds, see MEA8000_Voice.h
+
+ */
+
+#include "MEA8000_Voice.h"
+
+
+const VoiceProfile voiceProfiles [VOICES] PROGMEM = {
+    { 100, 100 },       // VOICE_NORMAL
+    {  88,  72 },       // VOICE_DEEP
+    { 108, 130 },       // VOICE_HIGH
+    { 120, 165 },       // VOICE_CHILD
+};
+
+
+// For every index of 'table' the index closest to its frequency times 'scale' %
+static void scaleTable(const uint16_t *table, byte size, byte scale, byte *map) {
+    byte nearest = 0;
+
+    for (byte index = 0; index < size; index++) {
+        int32_t wanted = (int32_t)pgm_read_word(&table[index]) * scale / 100;
+
+        // The table goes up, so the nearest index only goes up as well
+        while (nearest + 1 < size && pgm_read_word(&table[nearest + 1]) <= wanted) nearest++;
+        if (nearest + 1 < size && pgm_read_word(&table[nearest + 1]) - wanted < wanted - pgm_read_word(&table[nearest])) {
+            map[index] = nearest + 1;
+        } else {
+            map[index] = nearest;
+        }
+    }
+}
+
+void voiceMap(byte voice, VoiceMap *map) {
+    VoiceProfile profile;
+    memcpy_P(&profile, &voiceProfiles[voice < VOICES ? voice : (byte)VOICE_NORMAL], sizeof(VoiceProfile));
+
+    scaleTable(frameFM1Hz, 32, profile.formants, map->fm1);
+    scaleTable(frameFM2Hz, 32, profile.formants, map->fm2);
+    scaleTable(frameFM3Hz, 8,  profile.formants, map->fm3);
+    map->pitch = profile.pitch;
+}
+
+byte voicePitch(const VoiceMap *map, byte pitch) {
+    uint16_t scaled = ((uint16_t)pitch * map->pitch + 50) / 100;
+    return scaled > 255 ? 255 : (byte)scaled;
+}
+
+
+VoiceStream::VoiceStream() {
+    begin(NULL, NULL);
+}
+
+VoiceStream::VoiceStream(FrameSource *source, const VoiceMap *map) {
+    begin(source, map);
+}
+
+void VoiceStream::begin(FrameSource *source, const VoiceMap *map) {
+    this->source = source;
+    this->map    = map;
+    sourcePitch  = 0;
+    outPitch     = 0;
+}
+
+bool VoiceStream::nextFrame(byte *frame) {
+    if (!source || !source->nextFrame(frame)) return false;
+    if (!map) return true;
+
+    frame[1] = (byte)((map->fm3[frameFM3(frame)] << 5) | map->fm2[frameFM2(frame)]);
+    frame[2] = (byte)((map->fm1[frameFM1(frame)] << 3) | (frame[2] & 0x07));
+
+    if (framePI(frame) != MEA8000_PI_NOISE) {
+        byte    steps  = frameSteps(frame);
+        sourcePitch   += pitchIncrement(framePI(frame)) * steps;
+
+        // Where the scaled pitch should be, the increment per step rounded to the nearest
+        int     wanted = (int)((long)sourcePitch * map->pitch / 100) - outPitch;
+        int     pi     = (wanted >= 0 ? wanted + steps / 2 : wanted - steps / 2) / steps;
+        setFramePI(frame, pitchIncrementCode(pi));
+        outPitch += pitchIncrement(framePI(frame)) * steps;
+    }
+    return true;
+}
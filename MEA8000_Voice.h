@@ -0,0 +1,73 @@
+/*
+
+    MEA8000_Voice.h
+
+    Other voices (deeper, higher, a child) from the same sounds, without extra data.
+
+    A voice is a scale on the formant frequencies and one on the pitch. When a voice is
+    chosen its tables are made once (voiceMap): for every FM1, FM2 and FM3 index the index
+    that is closest to the scaled frequency. After that a frame costs three table reads:
+    - VoiceStream rewrites FM1/FM2/FM3 and PI of the frames of any FrameSource, for the chip.
+      The pitch increments are scaled with the rest carried over, so the contour is kept.
+      The start pitch (the header byte) is given by voicePitch.
+    - The host renderer takes the scaled frequencies themselves (VoiceTables in
+      host/MEA8000_Render.h), so nothing is rounded to the chip's tables there.
+    The chip's tables end at 1047 Hz (FM1) and 3400 Hz (FM2, FM3), a formant that would go
+    past the end stays at the last index.
+
+ */
+
+#ifndef MEA8000_VOICE_H
+#define MEA8000_VOICE_H
+
+#include "MEA8000_Stream.h"
+#include "MEA8000_Tables.h"
+
+
+enum Voice : byte {
+    VOICE_NORMAL = 0,
+    VOICE_DEEP,                 // lower formants and pitch, a larger speaker
+    VOICE_HIGH,
+    VOICE_CHILD,                // higher formants, much higher pitch
+    VOICES
+};
+
+// Scales in %
+struct VoiceProfile {
+    byte    formants;
+    byte    pitch;
+};
+
+extern const VoiceProfile voiceProfiles [VOICES] PROGMEM;
+
+// The tables of a voice, made once (in RAM, 73 bytes)
+struct VoiceMap {
+    byte    fm1 [32];
+    byte    fm2 [32];
+    byte    fm3 [8];
+    byte    pitch;              // %
+};
+
+void voiceMap(byte voice, VoiceMap *map);
+
+// Start pitch (Hz / 2, as the header byte) for a voice, to be sent to the chip
+byte voicePitch(const VoiceMap *map, byte pitch);
+
+
+class VoiceStream : public FrameSource {
+public:
+    VoiceStream();
+    VoiceStream(FrameSource *source, const VoiceMap *map);
+
+    // 'map' must stay in place while streaming
+    void begin(FrameSource *source, const VoiceMap *map);
+    bool nextFrame(byte *frame);
+
+private:
+    FrameSource     *source;
+    const VoiceMap  *map;
+    int             sourcePitch;    // pitch at the end of the frames read, Hz from the start
+    int             outPitch;       // pitch at the end of the frames sent
+};
+
+#endif
@@ -0,0 +1,260 @@
+/*
+
+    MEA8000_WordTrie.cpp
+
+    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.
+    589 words in 3936 bytes.
+
+ */
+
+#include "MEA8000_Words.h"
+
+
+const byte frenchWordTrie [3936] PROGMEM = {
+    0x61, 0x00, 0x5e, 0x81, 0x29, 0x42, 0x07, 0xd2, 0xc9, 0xc3, 0xcf, 0xb4, 0x02, 0x5d, 0x43, 0x08,
+    0xc3, 0xcf, 0xcc, 0xc1, 0xc4, 0xa5, 0x00, 0x5f, 0x44, 0x0c, 0xc4, 0xc9, 0xd4, 0xc9, 0xcf, 0xee,
+    0x02, 0x98, 0xce, 0xa5, 0x01, 0x94, 0x46, 0x07, 0xc6, 0xc9, 0xc3, 0xc8, 0xa5, 0x01, 0x95, 0x49,
+    0x05, 0xcd, 0xc5, 0xb2, 0x00, 0x60, 0x4a, 0x06, 0xcf, 0xd5, 0xd4, 0xa5, 0x01, 0x96, 0x4c, 0x26,
+    0x4c, 0x04, 0xc5, 0xb2, 0x00, 0x61, 0x4f, 0x04, 0xd2, 0xb3, 0x00, 0x62, 0xd0, 0xc8, 0xc1, 0x42,
+    0x0a, 0xc5, 0xf4, 0x01, 0x97, 0xc9, 0xd1, 0xd5, 0xa5, 0x02, 0x99, 0xce, 0xd5, 0xcd, 0xc5, 0xd2,
+    0xc9, 0xd1, 0xd5, 0xa5, 0x02, 0x9a, 0x4d, 0x03, 0xa9, 0x00, 0x63, 0x4e, 0x2e, 0x41, 0x06, 0xcc,
+    0xd9, 0xd3, 0xa5, 0x01, 0x98, 0x25, 0x01, 0xe1, 0x00, 0x49, 0x0a, 0xcd, 0xc1, 0x2c, 0x00, 0x64,
+    0x00, 0xd5, 0xb8, 0x00, 0x65, 0x4e, 0x10, 0x45, 0x03, 0xa5, 0x00, 0x66, 0xc9, 0xd6, 0xc5, 0xd2,
+    0xd3, 0xc1, 0xc9, 0xd2, 0xa5, 0x00, 0x67, 0xd4, 0xa9, 0x00, 0x68, 0x4f, 0x04, 0xd5, 0xb4, 0x02,
+    0x9b, 0x50, 0x16, 0x50, 0x0f, 0x52, 0x09, 0xc5, 0xce, 0xe4, 0x02, 0x9c, 0xd2, 0xa5, 0x00, 0x69,
+    0xd5, 0xa9, 0x00, 0x6a, 0xd2, 0xc5, 0xb3, 0x00, 0x6b, 0x52, 0x0d, 0x4d, 0x06, 0xcf, 0xc9, 0xd2,
+    0xa5, 0x02, 0x01, 0xd2, 0xc5, 0xb4, 0x00, 0x6c, 0x53, 0x18, 0x53, 0x0c, 0x45, 0x03, 0xba, 0x00,
+    0x6d, 0xc9, 0xc5, 0xd4, 0xd4, 0xa5, 0x00, 0x6e, 0xd4, 0xc5, 0xd2, 0xc9, 0xd3, 0xd1, 0xd5, 0xa5,
+    0x00, 0x6f, 0x54, 0x09, 0xd4, 0xc5, 0xce, 0xd4, 0xc9, 0xcf, 0xae, 0x01, 0x99, 0x75, 0x00, 0x70,
+    0x20, 0x47, 0x07, 0xcd, 0xc5, 0xce, 0xd4, 0xa5, 0x02, 0x9d, 0x53, 0x04, 0xd3, 0xa9, 0x00, 0x71,
+    0xd4, 0xef, 0x01, 0xb6, 0x42, 0x04, 0xd5, 0xb3, 0x01, 0xb7, 0xd2, 0xcf, 0xd5, 0xd4, 0xa5, 0x02,
+    0x5e, 0xd6, 0x41, 0x04, 0xce, 0xb4, 0x00, 0x72, 0x45, 0x03, 0xa3, 0x02, 0x35, 0x49, 0x04, 0xcf,
+    0xae, 0x01, 0xb8, 0x4f, 0x04, 0xc9, 0xb2, 0x00, 0x73, 0xd2, 0xc9, 0xac, 0x02, 0x9e, 0x62, 0x00,
+    0x74, 0x80, 0xc8, 0x41, 0x2e, 0x49, 0x08, 0xc7, 0xce, 0xcf, 0xc9, 0xd2, 0xa5, 0x02, 0x02, 0x4c,
+    0x05, 0xc1, 0xc9, 0xb3, 0x02, 0x03, 0x4e, 0x0b, 0x41, 0x04, 0xce, 0xa5, 0x02, 0x5f, 0xd1, 0xd5,
+    0xa5, 0x01, 0xe2, 0x52, 0x04, 0xd2, 0xa5, 0x00, 0x75, 0x33, 0x00, 0x76, 0x00, 0xd4, 0xc5, 0xc1,
+    0xb5, 0x01, 0xba, 0x45, 0x0e, 0x42, 0x03, 0xa5, 0x01, 0x9a, 0xc5, 0xc6, 0xd3, 0xd4, 0xc5, 0xc1,
+    0xab, 0x02, 0x60, 0x49, 0x11, 0x42, 0x06, 0xc5, 0xd2, 0xcf, 0xae, 0x02, 0x04, 0xc5, 0x2e, 0x00,
+    0x77, 0x00, 0xd2, 0xa5, 0x02, 0x61, 0x4c, 0x12, 0x41, 0x04, 0xce, 0xa3, 0x02, 0x62, 0x45, 0x03,
+    0xb5, 0x02, 0x63, 0xcf, 0xc3, 0xc1, 0xc7, 0xa5, 0x00, 0x78, 0x4f, 0x44, 0x45, 0x04, 0xd5, 0xa6,
+    0x02, 0x64, 0x49, 0x11, 0x52, 0x03, 0xa5, 0x00, 0x79, 0xd4, 0xc5, 0xc0, 0xc4, 0xc5, 0xc0, 0xce,
+    0xd5, 0xc9, 0xb4, 0x01, 0xe3, 0x6e, 0x00, 0x7a, 0x13, 0x48, 0x06, 0xcf, 0xcd, 0xcd, 0xa5, 0x01,
+    0x9b, 0x4a, 0x05, 0xcf, 0xd5, 0xb2, 0x00, 0x7b, 0xce, 0xa5, 0x00, 0x7c, 0xd5, 0x43, 0x09, 0xc8,
+    0x25, 0x01, 0xe4, 0x00, 0xcf, 0xae, 0x02, 0x05, 0xd4, 0xc5, 0xc9, 0xcc, 0xcc, 0xa5, 0x02, 0x06,
+    0x52, 0x09, 0xc1, 0x33, 0x01, 0xe5, 0x00, 0xd6, 0xaf, 0x00, 0x7d, 0xd5, 0xd2, 0xc5, 0xc1, 0xd5,
+    0xc0, 0xc4, 0xc5, 0xc0, 0xd0, 0xcf, 0xd3, 0xd4, 0xa5, 0x01, 0xe6, 0x63, 0x00, 0x80, 0x81, 0xdb,
+    0x40, 0x0c, 0xc5, 0x53, 0x03, 0xb4, 0x00, 0x7e, 0xd4, 0xc1, 0xc9, 0xb4, 0x00, 0x7f, 0x41, 0x49,
+    0x46, 0x03, 0xa5, 0x02, 0x65, 0x4c, 0x05, 0xc3, 0xd5, 0xac, 0x00, 0x81, 0x4d, 0x17, 0xd0, 0x41,
+    0x05, 0xc7, 0xce, 0xa5, 0x02, 0x66, 0xc9, 0xce, 0xc7, 0x40, 0x05, 0xc3, 0xc1, 0xb2, 0x01, 0xbb,
+    0xc3, 0xc1, 0xb2, 0x01, 0xbb, 0x4e, 0x05, 0xc1, 0xd2, 0xa4, 0x01, 0xe7, 0x72, 0x01, 0xbc, 0x0a,
+    0x41, 0x04, 0xc6, 0xa5, 0x02, 0x07, 0xd2, 0xa5, 0x01, 0xbd, 0xd3, 0xd3, 0xc5, 0x52, 0x05, 0xcf,
+    0xcc, 0xa5, 0x02, 0x08, 0xd4, 0xd4, 0xa5, 0x02, 0x9f, 0x65, 0x00, 0x82, 0x2e, 0x43, 0x03, 0xa9,
+    0x00, 0x83, 0x49, 0x07, 0xce, 0xd4, 0xd5, 0xd2, 0xa5, 0x02, 0x36, 0x4e, 0x18, 0xf4, 0x01, 0x8f,
+    0x49, 0x04, 0xcd, 0xa5, 0x01, 0xbe, 0xd2, 0xc5, 0xc0, 0xc3, 0xcf, 0xcd, 0xcd, 0xc5, 0xd2, 0xc3,
+    0xc9, 0xc1, 0xac, 0x01, 0xe8, 0xd2, 0xc3, 0xcc, 0xa5, 0x01, 0xbf, 0x48, 0x66, 0x41, 0x27, 0x49,
+    0x04, 0xd3, 0xa5, 0x02, 0x09, 0x4d, 0x05, 0xc2, 0xd2, 0xa5, 0x02, 0x0a, 0x50, 0x05, 0xc5, 0xc1,
+    0xb5, 0x02, 0x37, 0x34, 0x01, 0xe9, 0x00, 0xd5, 0xd3, 0xd3, 0x45, 0x05, 0xd4, 0xd4, 0xa5, 0x02,
+    0x38, 0xd5, 0xd2, 0xa5, 0x02, 0x39, 0x45, 0x1c, 0x4d, 0x0f, 0xc9, 0xd3, 0xe5, 0x02, 0x3a, 0xc0,
+    0xc4, 0xc5, 0xc0, 0xce, 0xd5, 0xc9, 0xb4, 0x02, 0x3b, 0xd6, 0x41, 0x03, 0xac, 0x01, 0xea, 0xc5,
+    0xd5, 0xb8, 0x01, 0xeb, 0x49, 0x0b, 0x45, 0x03, 0xae, 0x01, 0xec, 0xc6, 0xc6, 0xd2, 0xa5, 0x00,
+    0x84, 0xcf, 0x43, 0x06, 0xcf, 0xcc, 0xc1, 0xb4, 0x02, 0x67, 0xc9, 0x53, 0x03, 0xa9, 0x00, 0x85,
+    0xb8, 0x00, 0x86, 0x49, 0x12, 0x4e, 0x0a, 0xf1, 0x01, 0x73, 0xd5, 0xc1, 0xce, 0xd4, 0xa5, 0x01,
+    0x8c, 0xd4, 0xd2, 0xcf, 0xae, 0x02, 0x68, 0x4c, 0x1c, 0x41, 0x0c, 0x53, 0x04, 0xd3, 0xa5, 0x00,
+    0x87, 0xd6, 0xc9, 0xc5, 0xb2, 0x00, 0x88, 0xc5, 0x26, 0x00, 0x89, 0x00, 0xcd, 0xc5, 0xce, 0xd4,
+    0xc9, 0xce, 0xa5, 0x02, 0x69, 0x4f, 0x6c, 0x4d, 0x27, 0x42, 0x05, 0xc9, 0xc5, 0xae, 0x00, 0x8a,
+    0x4d, 0x0a, 0xe5, 0x00, 0x8b, 0xd2, 0xc3, 0xc9, 0xc1, 0xac, 0x00, 0x8c, 0xd0, 0x52, 0x07, 0xc5,
+    0xce, 0xc4, 0xd2, 0xa5, 0x00, 0x8d, 0xd4, 0xc5, 0x32, 0x00, 0x8e, 0x00, 0xd5, 0xb2, 0x02, 0x0c,
+    0x4e, 0x08, 0xce, 0xc1, 0xc9, 0xd4, 0xd2, 0xa5, 0x00, 0x8f, 0x50, 0x04, 0xc9, 0xa5, 0x00, 0x90,
+    0x52, 0x1e, 0x4e, 0x07, 0xc9, 0xc3, 0xc8, 0xcf, 0xae, 0x02, 0x6a, 0xd2, 0xc5, 0x43, 0x06, 0xd4,
+    0xc9, 0xcf, 0xae, 0x01, 0x9c, 0xd3, 0xd0, 0xcf, 0xce, 0xc4, 0xc1, 0xce, 0xd4, 0xa5, 0x00, 0x91,
+    0x54, 0x04, 0xc5, 0xa5, 0x00, 0x92, 0xd5, 0x4c, 0x05, 0xc5, 0xd5, 0xb2, 0x00, 0x93, 0xd3, 0xc9,
+    0xae, 0x01, 0x9d, 0x52, 0x0e, 0x41, 0x05, 0xd9, 0xcf, 0xae, 0x00, 0x94, 0xcf, 0xc3, 0xc8, 0xc5,
+    0xb4, 0x00, 0x95, 0xd5, 0x42, 0x03, 0xa5, 0x02, 0x3c, 0x49, 0x29, 0x4c, 0x1a, 0xcc, 0xc5, 0xd2,
+    0xe5, 0x02, 0x3d, 0xc0, 0xc1, 0xc0, 0x44, 0x08, 0xc5, 0xd3, 0xd3, 0xc5, 0xd2, 0xb4, 0x02, 0x3e,
+    0xd3, 0xcf, 0xd5, 0xd0, 0xa5, 0x02, 0x3f, 0xd3, 0xc9, 0xce, 0x25, 0x02, 0x0d, 0x00, 0xc9, 0xc5,
+    0xd2, 0xa5, 0x02, 0x0e, 0xd2, 0xd3, 0xc5, 0xd5, 0xb2, 0x00, 0x96, 0x64, 0x00, 0x98, 0x80, 0xeb,
+    0x20, 0x00, 0x97, 0x00, 0x41, 0x04, 0xce, 0xb3, 0x00, 0x99, 0x65, 0x00, 0x9a, 0x57, 0x42, 0x04,
+    0xd5, 0xb4, 0x00, 0x9b, 0x43, 0x07, 0xc5, 0xcd, 0xc2, 0xd2, 0xa5, 0x02, 0xa1, 0x4a, 0x03, 0xa1,
+    0x00, 0x9c, 0x4c, 0x05, 0xc5, 0xd4, 0xa5, 0x00, 0x9d, 0x4d, 0x0b, 0x41, 0x06, 0xce, 0xc4, 0xc5,
+    0xb2, 0x00, 0x9e, 0xa9, 0x00, 0x9f, 0x4e, 0x07, 0xd4, 0xc9, 0xd3, 0xd4, 0xa5, 0x01, 0xed, 0x50,
+    0x06, 0xcc, 0xc1, 0xc3, 0xa5, 0x02, 0xa2, 0x52, 0x07, 0xd2, 0xc9, 0xc5, 0xd2, 0xa5, 0x02, 0x40,
+    0x73, 0x00, 0xa0, 0x06, 0xc9, 0xd2, 0xc5, 0xb2, 0x00, 0xa1, 0x55, 0x03, 0xb8, 0x01, 0x70, 0xd6,
+    0xc1, 0xce, 0xb4, 0x02, 0x41, 0x49, 0x56, 0x45, 0x04, 0xda, 0xa5, 0x00, 0xa2, 0x46, 0x08, 0xc6,
+    0xc9, 0xc3, 0xc9, 0xcc, 0xa5, 0x00, 0xa3, 0x4d, 0x06, 0xc9, 0xce, 0xd5, 0xa5, 0x01, 0x9e, 0x52,
+    0x09, 0x25, 0x00, 0xa4, 0x00, 0xc9, 0xc7, 0xa5, 0x00, 0xa5, 0x53, 0x10, 0x51, 0x07, 0xd5, 0xc5,
+    0xd4, 0xd4, 0xa5, 0x02, 0xa3, 0xd4, 0xc1, 0xce, 0xc3, 0xa5, 0x02, 0x42, 0x56, 0x07, 0xc9, 0xd3,
+    0xc9, 0xcf, 0xae, 0x02, 0xa4, 0xf8, 0x01, 0x7b, 0xc0, 0x48, 0x05, 0xd5, 0xc9, 0xb4, 0x01, 0x85,
+    0x4e, 0x05, 0xc5, 0xd5, 0xa6, 0x01, 0x87, 0xd3, 0xc5, 0xd0, 0xb4, 0x01, 0x84, 0x6f, 0x00, 0xa6,
+    0x1f, 0x49, 0x04, 0xc7, 0xb4, 0x01, 0xee, 0x4c, 0x08, 0xcc, 0xc1, 0xf2, 0x00, 0xa7, 0xa4, 0x00,
+    0xa7, 0x4e, 0x08, 0x23, 0x00, 0xa8, 0x00, 0xce, 0xa5, 0x00, 0xa9, 0xd5, 0xda, 0xa5, 0x01, 0x7f,
+    0x52, 0x06, 0xcf, 0xc9, 0xd4, 0xa5, 0x00, 0xaa, 0xb5, 0x00, 0xab, 0x65, 0x00, 0xac, 0x80, 0xd2,
+    0x43, 0x1f, 0x4c, 0x08, 0xc1, 0xc9, 0xd2, 0xc1, 0xc7, 0xa5, 0x02, 0x0f, 0x4f, 0x09, 0xd5, 0xd4,
+    0xe5, 0x00, 0xad, 0xd5, 0xb2, 0x00, 0xae, 0xd2, 0x41, 0x03, 0xae, 0x00, 0xaf, 0xc9, 0xb3, 0x00,
+    0xb0, 0x46, 0x06, 0xc6, 0xc1, 0xc3, 0xa5, 0x00, 0xb1, 0x47, 0x04, 0xc1, 0xac, 0x00, 0xb2, 0x4c,
+    0x10, 0x45, 0x0a, 0xc3, 0xd4, 0xd2, 0xc9, 0xc3, 0xc9, 0xd4, 0xa5, 0x01, 0xc0, 0xcc, 0xa5, 0x00,
+    0xb3, 0x6e, 0x00, 0xb4, 0x13, 0x43, 0x05, 0xcf, 0xd2, 0xa5, 0x00, 0xb5, 0x46, 0x05, 0xc1, 0xce,
+    0xb4, 0x00, 0xb6, 0xd4, 0xc5, 0xb2, 0x00, 0xb7, 0x50, 0x06, 0xcf, 0xce, 0xc7, 0xa5, 0x02, 0x10,
+    0x53, 0x23, 0x43, 0x0c, 0xc1, 0x50, 0x03, 0xa5, 0x00, 0xb8, 0xd2, 0xc7, 0xcf, 0xb4, 0x02, 0x6b,
+    0x50, 0x05, 0xc1, 0xc3, 0xa5, 0x00, 0xb9, 0x53, 0x04, 0xc1, 0xb9, 0x00, 0xba, 0xf4, 0x00, 0xbb,
+    0xc0, 0xc3, 0xa5, 0x00, 0xbc, 0x74, 0x00, 0xbd, 0x0a, 0x40, 0x04, 0xd5, 0xae, 0x01, 0x92, 0xd2,
+    0xa5, 0x00, 0xbe, 0x35, 0x00, 0xbf, 0x00, 0x56, 0x0a, 0xc9, 0x45, 0x03, 0xb2, 0x02, 0x11, 0xd4,
+    0xa5, 0x01, 0xa0, 0xd8, 0x41, 0x05, 0xc3, 0xd4, 0xa5, 0x00, 0xc0, 0x43, 0x0a, 0xcc, 0xc1, 0xcd,
+    0xc1, 0xd4, 0xc9, 0xcf, 0xae, 0x00, 0xc1, 0x45, 0x0e, 0x4d, 0x05, 0xd0, 0xcc, 0xa5, 0x00, 0xc2,
+    0xd2, 0xc3, 0xc9, 0xc3, 0xa5, 0x00, 0xc3, 0xd0, 0xcc, 0xc9, 0xc3, 0xc1, 0xd4, 0xc9, 0xcf, 0xae,
+    0x02, 0xa5, 0x66, 0x00, 0xc4, 0x79, 0x41, 0x21, 0x43, 0x05, 0xc9, 0xcc, 0xa5, 0x00, 0xc5, 0x49,
+    0x08, 0x52, 0x03, 0xa5, 0x00, 0xc6, 0xb3, 0x00, 0xc7, 0x4d, 0x06, 0xc9, 0xcc, 0xcc, 0xa5, 0x01,
+    0xa1, 0xd5, 0xd4, 0xc5, 0xd5, 0xc9, 0xac, 0x02, 0x12, 0x45, 0x15, 0x4d, 0x04, 0xcd, 0xa5, 0x00,
+    0xc8, 0x4e, 0x06, 0xc5, 0xd4, 0xd2, 0xa5, 0x01, 0xc1, 0xd6, 0xd2, 0xc9, 0xc5, 0xb2, 0x02, 0xa6,
+    0x49, 0x05, 0xc3, 0xc8, 0xa5, 0x02, 0xa7, 0x4c, 0x0c, 0xc5, 0x43, 0x04, 0xc8, 0xa5, 0x00, 0xc9,
+    0xd5, 0xd6, 0xa5, 0x02, 0x6c, 0x4f, 0x0d, 0x49, 0x03, 0xb3, 0x00, 0xca, 0xce, 0xc3, 0xd4, 0xc9,
+    0xcf, 0xae, 0x00, 0xcb, 0xd2, 0x41, 0x0a, 0x49, 0x04, 0xd3, 0xa5, 0x02, 0x6d, 0xce, 0xa3, 0x00,
+    0xcc, 0x45, 0x05, 0xc9, 0xce, 0xa5, 0x01, 0xa2, 0xcf, 0xcd, 0xc1, 0xc7, 0xa5, 0x02, 0x6e, 0x67,
+    0x00, 0xcd, 0x47, 0x41, 0x1d, 0x4e, 0x03, 0xb4, 0x02, 0x43, 0x52, 0x09, 0x41, 0x04, 0xc7, 0xa5,
+    0x02, 0x13, 0xa5, 0x01, 0xc3, 0x54, 0x05, 0xc5, 0xc1, 0xb5, 0x02, 0x6f, 0xd5, 0xc3, 0xc8, 0xa5,
+    0x00, 0xce, 0x49, 0x05, 0xcc, 0xc5, 0xb4, 0x02, 0x44, 0x52, 0x15, 0x41, 0x09, 0xce, 0xe4, 0x00,
+    0xcf, 0xc5, 0xd5, 0xb2, 0x02, 0x45, 0xc5, 0xce, 0xcf, 0xd5, 0xc9, 0xcc, 0xcc, 0xa5, 0x01, 0xef,
+    0xd5, 0xc9, 0xcc, 0xcc, 0xc5, 0xcd, 0xc5, 0xb4, 0x00, 0xd0, 0x68, 0x00, 0xd1, 0x37, 0x41, 0x10,
+    0x40, 0x05, 0xce, 0xcf, 0xad, 0x00, 0xd2, 0xd5, 0xf4, 0x01, 0xc4, 0xc5, 0xd5, 0xb2, 0x02, 0x46,
+    0x45, 0x11, 0x4c, 0x0a, 0xc9, 0xc3, 0xcf, 0xd0, 0xd4, 0xc5, 0xd2, 0xa5, 0x01, 0xc5, 0xd5, 0xd2,
+    0xa5, 0x01, 0xc6, 0x4f, 0x07, 0xd0, 0xc9, 0xd4, 0xc1, 0xac, 0x01, 0xf0, 0xd5, 0xc9, 0xf4, 0x01,
+    0x78, 0xd2, 0xa5, 0x02, 0x70, 0x69, 0x00, 0xd3, 0x41, 0x2c, 0x00, 0xd4, 0x00, 0x4d, 0x0b, 0xd0,
+    0xc5, 0xd2, 0xcd, 0xc5, 0xc1, 0xc2, 0xcc, 0xa5, 0x02, 0x47, 0xce, 0x44, 0x04, 0xc5, 0xb8, 0x02,
+    0xa8, 0x45, 0x07, 0xd8, 0xc1, 0xc3, 0xd4, 0xa5, 0x00, 0xd5, 0x46, 0x08, 0xc5, 0xd2, 0xc9, 0xc5,
+    0xd5, 0xb2, 0x00, 0xd6, 0xd4, 0xc5, 0xd2, 0xd2, 0x4f, 0x08, 0xc7, 0xc1, 0xd4, 0xc9, 0xcf, 0xae,
+    0x00, 0xd7, 0xd5, 0xd0, 0xd4, 0xc5, 0xd5, 0xb2, 0x02, 0x14, 0x6a, 0x00, 0xd8, 0x44, 0x41, 0x18,
+    0x4d, 0x0f, 0x41, 0x04, 0xc9, 0xb3, 0x00, 0xd9, 0xc2, 0x25, 0x01, 0xf1, 0x00, 0xcf, 0xae, 0x02,
+    0x71, 0xce, 0xd6, 0xc9, 0xc5, 0xb2, 0x02, 0xa9, 0x25, 0x00, 0xda, 0x00, 0x4f, 0x0d, 0x55, 0x03,
+    0xb2, 0x00, 0xdb, 0xd9, 0xd3, 0xd4, 0xc9, 0xc3, 0xab, 0x00, 0xdc, 0xd5, 0x49, 0x0a, 0x4c, 0x05,
+    0xcc, 0xc5, 0xb4, 0x02, 0xaa, 0xae, 0x02, 0xab, 0x50, 0x03, 0xa5, 0x02, 0x48, 0xd3, 0xd4, 0xa5,
+    0x00, 0xdd, 0x6b, 0x00, 0xde, 0x05, 0xc9, 0xcc, 0xaf, 0x01, 0xc7, 0x6c, 0x00, 0xe1, 0x80, 0x92,
+    0x60, 0x00, 0xdf, 0x07, 0xc5, 0xc3, 0xd2, 0xc1, 0xae, 0x00, 0xe0, 0x61, 0x00, 0xe3, 0x34, 0x40,
+    0x05, 0xc2, 0xc1, 0xb3, 0x00, 0xe2, 0x49, 0x03, 0xb4, 0x02, 0x72, 0x4d, 0x04, 0xd0, 0xa5, 0x02,
+    0x15, 0x52, 0x06, 0xc7, 0xc5, 0xd5, 0xb2, 0x02, 0x49, 0xd6, 0x41, 0x04, 0xc2, 0xaf, 0x02, 0x16,
+    0xc5, 0xc0, 0xd6, 0xc1, 0xc9, 0xd3, 0xd3, 0xc5, 0x49, 0x04, 0xcc, 0xa5, 0x02, 0x17, 0xcc, 0xcc,
+    0xa5, 0x02, 0x17, 0x65, 0x00, 0xe4, 0x1a, 0x43, 0x06, 0xd4, 0xc5, 0xd5, 0xb2, 0x02, 0xac, 0x4e,
+    0x08, 0xd4, 0xc5, 0xcd, 0xc5, 0xce, 0xb4, 0x01, 0xa3, 0x33, 0x00, 0xe5, 0x00, 0xd5, 0xb2, 0x00,
+    0xe6, 0x49, 0x15, 0x47, 0x04, 0xce, 0xa5, 0x01, 0xa4, 0x4e, 0x04, 0xc7, 0xa5, 0x02, 0x18, 0x34,
+    0x01, 0xa5, 0x00, 0xd6, 0xd2, 0xa5, 0x00, 0xe7, 0x4f, 0x10, 0x49, 0x06, 0xce, 0xc0, 0xc4, 0xa5,
+    0x02, 0x4a, 0xce, 0xc7, 0xd5, 0xc5, 0xd5, 0xb2, 0x02, 0x4b, 0xd5, 0xcd, 0xc9, 0xc5, 0xd2, 0xa5,
+    0x01, 0xcc, 0x6d, 0x00, 0xe8, 0x81, 0x46, 0x61, 0x00, 0xe9, 0x73, 0x43, 0x17, 0xc8, 0xc9, 0xce,
+    0xc5, 0xc0, 0xc1, 0xc0, 0xcc, 0xc1, 0xd6, 0xc5, 0xd2, 0xc0, 0xcc, 0xc5, 0xc0, 0xcc, 0xc9, 0xce,
+    0xc7, 0xa5, 0x12, 0x19, 0x44, 0x05, 0xc1, 0xcd, 0xa5, 0x00, 0xea, 0x47, 0x0b, 0xce, 0xc5, 0xd4,
+    0xcf, 0xd0, 0xc8, 0xcf, 0xce, 0xa5, 0x02, 0xad, 0x69, 0x02, 0xae, 0x13, 0x6e, 0x01, 0xf2, 0x08,
+    0xd4, 0xc5, 0xce, 0xc1, 0xce, 0xb4, 0x00, 0xeb, 0xf3, 0x00, 0xec, 0xcf, 0xae, 0x00, 0xed, 0x4a,
+    0x08, 0xd5, 0xd3, 0xc3, 0xd5, 0xcc, 0xa5, 0x00, 0xee, 0x4d, 0x04, 0xc1, 0xae, 0x01, 0xa6, 0x4e,
+    0x0d, 0x45, 0x05, 0xd4, 0xd4, 0xa5, 0x00, 0xef, 0xd4, 0xc5, 0xc1, 0xb5, 0x02, 0x4c, 0x52, 0x09,
+    0x52, 0x04, 0xcf, 0xae, 0x02, 0x73, 0xb3, 0x02, 0xaf, 0xd4, 0xc9, 0xae, 0x00, 0xf0, 0x65, 0x00,
+    0xf1, 0x39, 0x44, 0x06, 0xc5, 0xc3, 0xc9, 0xae, 0x01, 0xf3, 0x72, 0x02, 0x74, 0x08, 0x43, 0x03,
+    0xa9, 0x00, 0xf2, 0xa5, 0x01, 0xa7, 0x73, 0x00, 0xf3, 0x10, 0x44, 0x06, 0xc1, 0xcd, 0xc5, 0xb3,
+    0x00, 0xf4, 0xd3, 0xc9, 0xc5, 0xd5, 0xd2, 0xb3, 0x00, 0xf5, 0xf4, 0x00, 0xf6, 0x52, 0x07, 0x25,
+    0x01, 0xcd, 0x00, 0xaf, 0x01, 0xce, 0xd4, 0xd2, 0xa5, 0x00, 0xf7, 0x69, 0x00, 0xf8, 0x21, 0x44,
+    0x03, 0xa9, 0x00, 0xf9, 0x45, 0x08, 0x2e, 0x00, 0xfa, 0x00, 0xd5, 0xb8, 0x00, 0xfb, 0x4c, 0x0a,
+    0xcc, 0x25, 0x01, 0x90, 0x00, 0xc9, 0xcf, 0xae, 0x01, 0x91, 0xce, 0xd5, 0xd4, 0xa5, 0x01, 0xcf,
+    0x4f, 0x4d, 0x69, 0x00, 0xfc, 0x08, 0x4e, 0x03, 0xb3, 0x00, 0xfd, 0xb3, 0x02, 0xb0, 0x6e, 0x00,
+    0xfe, 0x21, 0x49, 0x06, 0xd4, 0xc5, 0xd5, 0xb2, 0x02, 0xb1, 0x4f, 0x08, 0xc3, 0xc8, 0xd2, 0xcf,
+    0xcd, 0xa5, 0x02, 0xb2, 0x53, 0x06, 0xc9, 0xc5, 0xd5, 0xb2, 0x00, 0xff, 0xd4, 0xc1, 0xc7, 0xce,
+    0xa5, 0x02, 0x75, 0x34, 0x01, 0x01, 0x00, 0x55, 0x11, 0x4c, 0x03, 0xa5, 0x02, 0x76, 0xd4, 0x41,
+    0x05, 0xd2, 0xc4, 0xa5, 0x02, 0x77, 0xcf, 0xae, 0x02, 0x78, 0xd9, 0xc5, 0xae, 0x01, 0x00, 0xd5,
+    0x4c, 0x18, 0xd4, 0xc9, 0xd0, 0x49, 0x05, 0xcc, 0xc9, 0xa5, 0x01, 0xa8, 0xcc, 0xc9, 0x43, 0x07,
+    0xc1, 0xd4, 0xc9, 0xcf, 0xae, 0x02, 0xb3, 0xa5, 0x01, 0xa8, 0xb2, 0x01, 0xd0, 0x6e, 0x01, 0x02,
+    0x4c, 0x41, 0x05, 0xd0, 0xd0, 0xa5, 0x02, 0x1c, 0x65, 0x01, 0x03, 0x08, 0x55, 0x03, 0xa6, 0x01,
+    0x7a, 0xba, 0x01, 0xf4, 0x4f, 0x29, 0x49, 0x03, 0xb2, 0x02, 0x79, 0x6d, 0x01, 0x05, 0x05, 0xc2,
+    0xd2, 0xa5, 0x01, 0x04, 0x33, 0x01, 0x06, 0x00, 0x54, 0x08, 0x25, 0x01, 0x07, 0x00, 0xd2, 0xa5,
+    0x01, 0x08, 0x55, 0x03, 0xb3, 0x01, 0x09, 0xd6, 0xc5, 0xcd, 0xc2, 0xd2, 0xa5, 0x02, 0xb4, 0xd5,
+    0xcd, 0xc5, 0xd2, 0x49, 0x05, 0xd1, 0xd5, 0xa5, 0x02, 0xb5, 0xaf, 0x01, 0x0a, 0x6f, 0x01, 0x0b,
+    0x6e, 0x42, 0x08, 0xd3, 0xd4, 0xc1, 0xc3, 0xcc, 0xa5, 0x01, 0xa9, 0x43, 0x07, 0xd4, 0xcf, 0xc2,
+    0xd2, 0xa5, 0x02, 0xb6, 0x45, 0x04, 0xd5, 0xa6, 0x02, 0x7a, 0x4c, 0x05, 0xc9, 0xd6, 0xa5, 0x02,
+    0x7b, 0x6e, 0x01, 0x0c, 0x0a, 0x43, 0x04, 0xcc, 0xa5, 0x01, 0xaa, 0xda, 0xa5, 0x01, 0x7e, 0x50,
+    0x0e, 0xd4, 0xc9, 0x43, 0x05, 0xc9, 0xc5, 0xae, 0x01, 0xf5, 0xd1, 0xd5, 0xa5, 0x01, 0x0d, 0x72,
+    0x01, 0x0e, 0x1a, 0x41, 0x05, 0xce, 0xc7, 0xa5, 0x02, 0x7c, 0x45, 0x06, 0xc9, 0xcc, 0xcc, 0xa5,
+    0x01, 0xf6, 0xd4, 0xc8, 0xcf, 0xc7, 0xd2, 0xc1, 0xd0, 0xc8, 0xa5, 0x01, 0xab, 0xf5, 0x01, 0x0f,
+    0x29, 0x01, 0x10, 0x00, 0xd6, 0xd2, 0xc5, 0xc0, 0xc2, 0xcf, 0xc9, 0xd4, 0xa5, 0x02, 0x1d, 0x70,
+    0x01, 0x11, 0x81, 0x80, 0x41, 0x67, 0x49, 0x13, 0x2e, 0x02, 0x7d, 0x00, 0xd2, 0xc5, 0xc0, 0xc4,
+    0xc5, 0xc0, 0xcc, 0xd5, 0xce, 0xc5, 0xd4, 0xd4, 0xa5, 0x02, 0x4d, 0x4d, 0x0b, 0xd0, 0xcc, 0xc5,
+    0xcd, 0xcf, 0xd5, 0xd3, 0xd3, 0xa5, 0x02, 0x7e, 0x4e, 0x07, 0xd4, 0xc1, 0xcc, 0xcf, 0xae, 0x02,
+    0x4e, 0x50, 0x0c, 0x21, 0x01, 0xac, 0x00, 0xc5, 0xd4, 0xc5, 0xd2, 0xc9, 0xa5, 0x01, 0xf7, 0x52,
+    0x21, 0x41, 0x07, 0xd0, 0xcc, 0xd5, 0xc9, 0xa5, 0x02, 0x4f, 0x45, 0x0a, 0xce, 0xf4, 0x01, 0xad,
+    0xc8, 0xc5, 0xd3, 0xa5, 0x01, 0x12, 0x46, 0x05, 0xc1, 0xc9, 0xb4, 0x01, 0x13, 0xcc, 0xc5, 0xb2,
+    0x01, 0x14, 0x53, 0x05, 0xd3, 0xc5, 0xb2, 0x01, 0x15, 0xd4, 0xa5, 0x02, 0x7f, 0x45, 0x27, 0x43,
+    0x04, 0xc8, 0xa5, 0x02, 0x80, 0x4c, 0x04, 0xcc, 0xa5, 0x02, 0x1e, 0x4e, 0x05, 0xd3, 0xc5, 0xb2,
+    0x01, 0x16, 0x52, 0x03, 0xa5, 0x01, 0xae, 0x54, 0x04, 0xc9, 0xb4, 0x01, 0x17, 0xd5, 0xd4, 0xc0,
+    0xc5, 0xd4, 0xd2, 0xa5, 0x01, 0x18, 0x48, 0x09, 0xc1, 0xd2, 0xcd, 0xc1, 0xc3, 0xc9, 0xa5, 0x01,
+    0xf8, 0x49, 0x10, 0x45, 0x08, 0x43, 0x03, 0xa5, 0x01, 0xd1, 0xa4, 0x01, 0xf9, 0xca, 0xc1, 0xcd,
+    0xa1, 0x02, 0x50, 0x4c, 0x28, 0x41, 0x22, 0x43, 0x09, 0x41, 0x04, 0xd2, 0xa4, 0x02, 0x1f, 0xa5,
+    0x01, 0xaf, 0x46, 0x05, 0xcf, 0xce, 0xa4, 0x02, 0x20, 0x47, 0x03, 0xa5, 0x02, 0x81, 0x4e, 0x06,
+    0xc3, 0xc8, 0xc5, 0xb2, 0x01, 0xd2, 0xb4, 0x02, 0x21, 0xd5, 0xb3, 0x01, 0x19, 0x4f, 0x53, 0x45,
+    0x04, 0xcc, 0xa5, 0x02, 0x22, 0x49, 0x15, 0x44, 0x03, 0xb3, 0x02, 0x51, 0x47, 0x05, 0xce, 0xc5,
+    0xa5, 0x01, 0x1a, 0x4e, 0x03, 0xb4, 0x01, 0x1b, 0xd2, 0xa5, 0x02, 0x82, 0x4d, 0x04, 0xcd, 0xa5,
+    0x02, 0x83, 0x52, 0x08, 0x23, 0x02, 0x84, 0x00, 0xd4, 0xa5, 0x01, 0xd3, 0x53, 0x09, 0xc9, 0xd4,
+    0xc9, 0xcf, 0xce, 0xce, 0xa5, 0x01, 0x1c, 0xd5, 0x42, 0x06, 0xc5, 0xcc, 0xcc, 0xa5, 0x02, 0x23,
+    0x4c, 0x06, 0xe5, 0x01, 0xfa, 0xb4, 0x02, 0x85, 0xf2, 0x01, 0x1d, 0xc0, 0xc3, 0xc5, 0xce, 0xb4,
+    0x01, 0x1e, 0x52, 0x33, 0x45, 0x19, 0x4d, 0x05, 0xc9, 0xc5, 0xb2, 0x01, 0x1f, 0x4e, 0x0a, 0x44,
+    0x04, 0xd2, 0xa5, 0x01, 0x20, 0xcf, 0xad, 0x01, 0x21, 0xd3, 0xc0, 0xc4, 0xa5, 0x02, 0x52, 0x4f,
+    0x11, 0x42, 0x06, 0xcc, 0xc5, 0xcd, 0xa5, 0x01, 0x22, 0xc6, 0xcf, 0xce, 0xc4, 0xc5, 0xd5, 0xb2,
+    0x02, 0x53, 0xd5, 0xce, 0xa5, 0x02, 0x86, 0x55, 0x14, 0x49, 0x0a, 0xf3, 0x01, 0x23, 0xd3, 0xc1,
+    0xce, 0xc3, 0xa5, 0x01, 0x24, 0xcc, 0xcc, 0xcf, 0xd6, 0xc5, 0xb2, 0x02, 0x54, 0xd9, 0xca, 0xc1,
+    0xcd, 0xa1, 0x02, 0x50, 0x71, 0x01, 0x25, 0x56, 0xd5, 0x60, 0x01, 0x26, 0x0d, 0x45, 0x07, 0xd3,
+    0xd4, 0xc0, 0xc3, 0xa5, 0x01, 0x27, 0xc9, 0xac, 0x01, 0x2e, 0x41, 0x21, 0x4e, 0x03, 0xa4, 0x01,
+    0x28, 0x52, 0x06, 0xc1, 0xce, 0xd4, 0xa5, 0x01, 0x8b, 0xd4, 0x4f, 0x05, 0xd2, 0xda, 0xa5, 0x01,
+    0x81, 0xd2, 0xe5, 0x01, 0x72, 0xc0, 0xd6, 0xc9, 0xce, 0xc7, 0xb4, 0x01, 0x8e, 0x65, 0x01, 0x29,
+    0x10, 0x6c, 0x01, 0x2a, 0x05, 0xd1, 0xd5, 0xa5, 0x01, 0x2b, 0xd3, 0xd4, 0xc9, 0xcf, 0xae, 0x01,
+    0x2c, 0x69, 0x01, 0x2d, 0x05, 0xce, 0xda, 0xa5, 0x01, 0x82, 0xcf, 0xa9, 0x01, 0x2f, 0x72, 0x01,
+    0x30, 0x80, 0xa6, 0x41, 0x10, 0x44, 0x08, 0xc9, 0xc1, 0xd4, 0xc5, 0xd5, 0xb2, 0x02, 0x24, 0xc9,
+    0xd3, 0xc9, 0xae, 0x02, 0x87, 0x65, 0x01, 0x31, 0x54, 0x43, 0x18, 0x4f, 0x08, 0xcd, 0xcd, 0xc5,
+    0xce, 0xc3, 0xa5, 0x01, 0x32, 0x54, 0x07, 0xc1, 0xce, 0xc7, 0xcc, 0xa5, 0x01, 0xd4, 0xd5, 0xcc,
+    0xa5, 0x01, 0xb1, 0x46, 0x0c, 0xd2, 0xc9, 0xc7, 0xc5, 0xd2, 0xc1, 0xd4, 0xc5, 0xd5, 0xb2, 0x02,
+    0x25, 0x47, 0x0b, 0x41, 0x05, 0xd2, 0xc4, 0xa5, 0x01, 0x33, 0xcc, 0xa5, 0x02, 0xb8, 0x50, 0x06,
+    0xcf, 0xce, 0xd3, 0xa5, 0x01, 0x34, 0x53, 0x07, 0xd5, 0xcc, 0xd4, 0xc1, 0xb4, 0x01, 0x35, 0xd4,
+    0x45, 0x05, 0xce, 0xd5, 0xa5, 0x02, 0xb9, 0xc9, 0xc5, 0xce, 0xb4, 0x02, 0xba, 0x49, 0x17, 0x44,
+    0x05, 0xc5, 0xc1, 0xb5, 0x02, 0x26, 0x45, 0x03, 0xae, 0x01, 0x36, 0x56, 0x06, 0xc9, 0xc5, 0xd2,
+    0xa5, 0x02, 0x88, 0xba, 0x02, 0x89, 0xcf, 0x42, 0x15, 0x45, 0x0d, 0xc0, 0xc4, 0xc5, 0xc0, 0xc3,
+    0xc8, 0xc1, 0xcd, 0xc2, 0xd2, 0xa5, 0x02, 0x55, 0xc9, 0xce, 0xc5, 0xb4, 0x02, 0x27, 0x53, 0x04,
+    0xc5, 0xa5, 0x02, 0x8a, 0xd5, 0xd4, 0xa5, 0x02, 0x8b, 0x73, 0x01, 0x37, 0x81, 0x35, 0x61, 0x01,
+    0x38, 0x45, 0x4c, 0x32, 0x41, 0x06, 0xc4, 0xc9, 0xc5, 0xb2, 0x02, 0x28, 0x4c, 0x16, 0xc5, 0xc0,
+    0x41, 0x09, 0xc0, 0xcd, 0xc1, 0xce, 0xc7, 0xc5, 0xb2, 0x02, 0x29, 0xc4, 0xc5, 0xc0, 0xc2, 0xc1,
+    0xc9, 0xae, 0x02, 0x2a, 0xcf, 0xee, 0x02, 0x2b, 0xc0, 0xc4, 0xc5, 0xc0, 0xc3, 0xcf, 0xc9, 0xc6,
+    0xc6, 0xd5, 0xd2, 0xa5, 0x01, 0xfb, 0x4e, 0x03, 0xb3, 0x01, 0x39, 0x55, 0x04, 0xc3, 0xa5, 0x02,
+    0x8c, 0xd6, 0xcf, 0xc9, 0xb2, 0x01, 0x3a, 0x43, 0x05, 0xcf, 0xd2, 0xa5, 0x01, 0x3b, 0x65, 0x01,
+    0x3c, 0x3f, 0x49, 0x04, 0xda, 0xa5, 0x01, 0x83, 0x4c, 0x0b, 0xc5, 0xc3, 0xd4, 0xc9, 0xcf, 0xce,
+    0xce, 0xc5, 0xa5, 0x01, 0x3d, 0x4d, 0x06, 0xc1, 0xc9, 0xce, 0xa5, 0x02, 0xbb, 0x50, 0x0a, 0xf4,
+    0x01, 0x77, 0xc5, 0xcd, 0xc2, 0xd2, 0xa5, 0x02, 0xbc, 0x52, 0x13, 0x50, 0x09, 0xc9, 0xcc, 0xcc,
+    0xc9, 0xc5, 0xd2, 0xa5, 0x02, 0x2c, 0xd6, 0xc9, 0xc5, 0xd4, 0xd4, 0xa5, 0x02, 0x2d, 0xb3, 0x01,
+    0x3e, 0x48, 0x05, 0xcf, 0xd2, 0xb4, 0x02, 0x56, 0x69, 0x01, 0x3f, 0x18, 0x40, 0x07, 0xce, 0xcf,
+    0xd4, 0xc5, 0xa0, 0x01, 0x40, 0x45, 0x03, 0xae, 0x01, 0x41, 0x4d, 0x05, 0xd0, 0xcc, 0xa5, 0x01,
+    0x42, 0xb8, 0x01, 0x75, 0x4c, 0x05, 0xc1, 0xd3, 0xa8, 0x01, 0x43, 0x4f, 0x37, 0x45, 0x04, 0xd5,
+    0xb2, 0x01, 0xb2, 0x49, 0x0b, 0x32, 0x01, 0x44, 0x00, 0xd8, 0xc1, 0xce, 0xd4, 0xa5, 0x01, 0x8d,
+    0x6c, 0x01, 0x45, 0x07, 0xd5, 0xd4, 0xc9, 0xcf, 0xae, 0x01, 0x46, 0x2e, 0x01, 0x47, 0x00, 0xd5,
+    0xd3, 0x40, 0x0a, 0xd6, 0xc5, 0xd4, 0xc5, 0xcd, 0xc5, 0xce, 0xb4, 0x02, 0x57, 0xd4, 0xd2, 0xc1,
+    0xc9, 0xb4, 0x01, 0xb3, 0x54, 0x0f, 0xc1, 0xd4, 0xc9, 0xcf, 0xce, 0xc0, 0xd3, 0xc5, 0xd2, 0xd6,
+    0xc9, 0xc3, 0xa5, 0x01, 0xfc, 0x55, 0x23, 0x43, 0x04, 0xd2, 0xa5, 0x02, 0x8d, 0x49, 0x08, 0x33,
+    0x02, 0xbe, 0x00, 0xd4, 0xa5, 0x01, 0x48, 0x50, 0x08, 0xc5, 0xd2, 0xc9, 0xc5, 0xd5, 0xb2, 0x01,
+    0x49, 0xf2, 0x01, 0x4a, 0xc6, 0xc1, 0xc3, 0xa5, 0x02, 0x58, 0xd9, 0xce, 0xd4, 0xc8, 0xc5, 0xd3,
+    0xa5, 0x01, 0xb4, 0x74, 0x01, 0x4b, 0x80, 0xd3, 0x40, 0x07, 0xd5, 0xee, 0x01, 0x59, 0xa5, 0x01,
+    0x5a, 0x61, 0x01, 0x4c, 0x21, 0x42, 0x0f, 0x41, 0x03, 0xa3, 0x01, 0xfd, 0xcc, 0x25, 0x01, 0xd5,
+    0x00, 0xc9, 0xc5, 0xb2, 0x02, 0x59, 0x4e, 0x04, 0xd4, 0xa5, 0x01, 0xb5, 0x50, 0x04, 0xc9, 0xb3,
+    0x02, 0x2f, 0xd8, 0xa9, 0x01, 0xd6, 0x65, 0x01, 0x4d, 0x21, 0x4c, 0x11, 0xc5, 0x50, 0x06, 0xc8,
+    0xcf, 0xce, 0xa5, 0x01, 0xd7, 0xd6, 0xc9, 0xd3, 0xc9, 0xcf, 0xae, 0x01, 0xd8, 0x4d, 0x04, 0xd0,
+    0xb3, 0x01, 0x4e, 0x33, 0x01, 0x4f, 0x00, 0xd4, 0xa5, 0x01, 0xfe, 0x48, 0x03, 0xa5, 0x02, 0x8e,
+    0x49, 0x15, 0x45, 0x03, 0xae, 0x01, 0x50, 0xd2, 0xc5, 0x40, 0x09, 0xc2, 0xcf, 0xd5, 0xc3, 0xc8,
+    0xcf, 0xae, 0x02, 0x30, 0xb4, 0x01, 0x51, 0x4f, 0x2a, 0x69, 0x01, 0x52, 0x0b, 0x4c, 0x06, 0xc5,
+    0xd4, 0xd4, 0xa5, 0x02, 0x31, 0xb4, 0x02, 0x32, 0x4d, 0x05, 0xc1, 0xd4, 0xa5, 0x02, 0x8f, 0x6e,
+    0x01, 0x53, 0x04, 0xce, 0xa5, 0x01, 0xd9, 0xd5, 0x4a, 0x06, 0xcf, 0xd5, 0xd2, 0xb3, 0x01, 0x54,
+    0xb4, 0x01, 0x55, 0x52, 0x33, 0x41, 0x0b, 0x49, 0x03, 0xae, 0x01, 0xda, 0xd6, 0xc1, 0xc9, 0xac,
+    0x02, 0xbf, 0x45, 0x0f, 0x49, 0x04, 0xda, 0xa5, 0x01, 0x80, 0x4e, 0x04, 0xd4, 0xa5, 0x01, 0x8a,
+    0xb3, 0x01, 0x56, 0x49, 0x07, 0xc1, 0xce, 0xc7, 0xcc, 0xa5, 0x01, 0xdb, 0xcf, 0x49, 0x03, 0xb3,
+    0x01, 0x71, 0xd5, 0xd6, 0xc5, 0xb2, 0x01, 0x57, 0xb5, 0x01, 0x58, 0x75, 0x01, 0x5b, 0x09, 0xee,
+    0x01, 0x5c, 0xe5, 0x01, 0x5d, 0xa0, 0x01, 0xde, 0x76, 0x01, 0x5e, 0x80, 0xb8, 0x41, 0x1a, 0x43,
+    0x04, 0xc8, 0xa5, 0x01, 0xff, 0x49, 0x08, 0xd3, 0xd3, 0xc5, 0xcc, 0xcc, 0xa5, 0x02, 0x33, 0xcc,
+    0xc9, 0xc4, 0xc1, 0xd4, 0xc9, 0xcf, 0xae, 0x01, 0x5f, 0x45, 0x27, 0x41, 0x03, 0xb5, 0x02, 0x90,
+    0x4e, 0x08, 0x49, 0x03, 0xb2, 0x01, 0x60, 0xb4, 0x01, 0x61, 0x52, 0x08, 0x52, 0x03, 0xa5, 0x02,
+    0x5a, 0xb4, 0x02, 0x91, 0x53, 0x04, 0xd4, 0xa5, 0x02, 0x5b, 0xd4, 0xc5, 0xcd, 0xc5, 0xce, 0xb4,
+    0x01, 0xdf, 0x49, 0x36, 0x4c, 0x0a, 0xcc, 0x41, 0x04, 0xc7, 0xa5, 0x02, 0x92, 0xa5, 0x02, 0x93,
+    0x4e, 0x0c, 0x41, 0x06, 0xc9, 0xc7, 0xd2, 0xa5, 0x02, 0x94, 0xc7, 0xb4, 0x01, 0x88, 0x4f, 0x05,
+    0xcc, 0xc5, 0xb4, 0x02, 0x95, 0x52, 0x0c, 0x41, 0x04, 0xc7, 0xa5, 0x02, 0x96, 0xc7, 0xd5, 0xcc,
+    0xa5, 0x01, 0x62, 0xd4, 0xd2, 0xc9, 0xce, 0xa5, 0x02, 0x00, 0x4f, 0x30, 0x49, 0x14, 0x43, 0x03,
+    0xa9, 0x01, 0x63, 0x4c, 0x03, 0xa1, 0x01, 0x64, 0x32, 0x01, 0x65, 0x00, 0xd4, 0xd5, 0xd2, 0xa5,
+    0x01, 0xe0, 0x4c, 0x0a, 0x45, 0x03, 0xb4, 0x02, 0x34, 0xd5, 0xcd, 0xa5, 0x02, 0x5c, 0x33, 0x01,
+    0x66, 0x00, 0x54, 0x04, 0xd2, 0xa5, 0x01, 0x67, 0xd5, 0xb3, 0x01, 0x68, 0xd2, 0xc1, 0xc9, 0xcd,
+    0xc5, 0xce, 0xb4, 0x01, 0x69, 0x37, 0x01, 0x6a, 0x00, 0x38, 0x01, 0x6b, 0x00, 0x79, 0x01, 0x6c,
+    0x07, 0xc1, 0xcf, 0xd5, 0xd2, 0xb4, 0x02, 0x97, 0xfa, 0x01, 0x6d, 0xc5, 0xd2, 0xaf, 0x01, 0x6e
+};
@@ -0,0 +1,167 @@
+/*
+
+    MEA8000_Words.cpp
+
+    Text lookup in the words of catalog 2 and 3, see MEA8000_Words.h.
+
+    Layout of frenchWordTrie (written by tools/MEA8000_MakeCatalog.cpp):
+    The children of a node are a row of letters, sorted ('_' first, then A .. Z).
+    Every letter is:
+
+        byte        bits 0-4    letter: 0 = '_' (space or apostrophe), 1 .. 26 = A .. Z
+                    bit 5       a word ends here, 2 bytes value follow
+                    bit 6       the letter has children
+                    bit 7       last letter of the row
+        2 bytes     (bit 5) value: sound id (bits 0-11), extra parts (bits 12-13), high byte first
+        1-2 bytes   (not bit 7) bytes to skip to the next letter of the row, after this field
+                    (one byte below 0x80, else two with bit 7 set in the first)
+        ...         (bit 6) the row of the children
+
+    The trie starts with the row of the first letters.
+
+ */
+
+#include "MEA8000_Words.h"
+
+
+#define TRIE_LETTER     0x1F
+#define TRIE_VALUE      0x20
+#define TRIE_CHILDREN   0x40
+#define TRIE_LAST       0x80
+
+#define TRIE_NONE       0xFFFF
+
+#define WORD_SPACE      0       // space, apostrophe or any other separator(s)
+#define WORD_END        0xFF    // end of the text
+
+
+// The next character of the text as a letter of the trie. A row of separators is one WORD_SPACE.
+// œ is two letters, 'ligature' holds the e until the next call.
+static byte wordLetter(const char **text, bool *ligature) {
+    if (*ligature) {
+        *ligature = false;
+        return 'e' - 'a' + 1;
+    }
+    if (!**text) return WORD_END;
+
+    const char *next   = *text;
+    char        letter = frenchNormalize(&next);
+
+    if (!letter) {
+        for (*text = next; **text; *text = next) {
+            if (frenchNormalize(&next)) break;
+        }
+        return WORD_SPACE;
+    }
+    *text = next;
+    if (letter == '@' || letter == '&') return 'e' - 'a' + 1;
+    if (letter == '$')                  return 'c' - 'a' + 1;
+    if (letter == '%') {
+        *ligature = true;
+        return 'o' - 'a' + 1;
+    }
+    return letter - 'a' + 1;
+}
+
+// Moves 'text' past the separators (letters = false) or past the letters of a word (letters = true)
+static const char *skipText(const char *text, bool letters) {
+    for (const char *next = text; *text && (frenchNormalize(&next) != 0) == letters; next = text) text = next;
+    return text;
+}
+
+
+byte frenchWordLookup(const char *text, uint16_t *id, byte *parts) {
+    const char *start       = text;
+    const char *end         = NULL;         // end of the longest word found
+    const char *pendingEnd  = NULL;         // a word that is found if the next character is a separator
+    uint16_t    pending     = 0;
+    uint16_t    value       = 0;
+    uint16_t    node        = 0;
+    bool        ligature    = false;
+
+    for (;;) {
+        byte letter = wordLetter(&text, &ligature);
+
+        if (pendingEnd && (letter == WORD_SPACE || letter == WORD_END)) {
+            value = pending;
+            end   = pendingEnd;
+        }
+        pendingEnd = NULL;
+        if (letter == WORD_END || node == TRIE_NONE) break;
+
+        for (;;) {
+            byte        flags     = pgm_read_byte(&frenchWordTrie[node++]);
+            uint16_t    nodeValue = 0;
+            uint16_t    skip      = 0;
+
+            if (flags & TRIE_VALUE) {
+                nodeValue = (pgm_read_byte(&frenchWordTrie[node]) << 8) | pgm_read_byte(&frenchWordTrie[node + 1]);
+                node += 2;
+            }
+            if (!(flags & TRIE_LAST)) {
+                skip = pgm_read_byte(&frenchWordTrie[node++]);
+                if (skip & 0x80) skip = ((skip & 0x7F) << 8) | pgm_read_byte(&frenchWordTrie[node++]);
+            }
+
+            byte nodeLetter = flags & TRIE_LETTER;
+            if (nodeLetter == letter) {
+                if (flags & TRIE_VALUE) {
+                    if (letter == WORD_SPACE) {         // ends with an apostrophe: D_, L_, QU_
+                        value = nodeValue;
+                        end   = text;
+                    } else {
+                        pending    = nodeValue;
+                        pendingEnd = text;
+                    }
+                }
+                if (!(flags & TRIE_CHILDREN)) node = TRIE_NONE;
+                break;
+            }
+            if (nodeLetter > letter || (flags & TRIE_LAST)) {
+                node = TRIE_NONE;
+                break;
+            }
+            node += skip;
+        }
+    }
+    if (!end) return 0;
+
+    *id    = value & 0x0FFF;
+    *parts = (value >> 12) + 1;
+    return (byte)(end - start);
+}
+
+
+byte frenchSentence(const char *text, SoundSpan *spans, byte maxSpans, byte gap, bool rules, bool trim) {
+    const SoundSpan silence = SOUND(NoSound);
+    byte            count   = 0;
+
+    for (;;) {
+        text = skipText(text, false);
+        if (!*text) break;
+
+        SoundSpan   word [FRENCH_MAX_PHONEMES];
+        byte        length = 0;
+        uint16_t    id;
+        byte        parts;
+        byte        size = frenchWordLookup(text, &id, &parts);
+
+        if (size) {
+            for (; length < parts; length++) {
+                word[length] = trim ? trimmedSound(id + length, length == 0, length + 1 == parts) : catalogSound(id + length);
+            }
+            text += size;
+        } else {
+            if (rules) FrenchReader(text).nextWord(word, FRENCH_MAX_PHONEMES, &length);
+            text = skipText(text, true);
+        }
+        if (length == 0) continue;
+
+        byte pending = count > 0 ? gap : 0;
+        if (count + pending + length > maxSpans) break;
+
+        for (; pending > 0; pending--) spans[count++] = silence;
+        for (byte i = 0; i < length; i++) spans[count++] = word[i];
+    }
+    return count;
+}
@@ -0,0 +1,41 @@
+/*
+
+    MEA8000_Words.h
+
+    Text lookup in the words of catalog 2 and 3.
+
+    The words are in a trie in Flash (MEA8000_WordTrie.cpp, about 4 kB for ~600 words),
+    nothing of it is copied to RAM. A sentence is read from left to right, at every word
+    the longest word of the catalogs that fits is taken, so "qu'est-ce que" gives QU_EST_CE
+    and QUE, and "peut être" gives PEUT_ETRE. A lookup reads a few bytes of Flash per letter.
+
+    The text may have accents (UTF-8 or Latin-1, see frenchNormalize) and capitals,
+    a space, '-' or an apostrophe between the words are the same to the lookup.
+
+ */
+
+#ifndef MEA8000_WORDS_H
+#define MEA8000_WORDS_H
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_French.h"
+
+
+#define WORD_MAX_PARTS      4       // sounds of one word (MACHINE_A_LAVER_LE_LINGE has 2)
+
+extern const byte frenchWordTrie [] PROGMEM;
+
+// The longest word of the catalogs at the start of 'text' (that has no separators in front).
+// Returns the number of characters (bytes) of the text it covers, 0 if there is none.
+// 'id' is the first sound of the word (see MEA8000_Catalog.h), 'parts' the number of sounds.
+byte frenchWordLookup(const char *text, uint16_t *id, byte *parts);
+
+// The sounds for a sentence: the words of the catalogs, with 'gap' times NoSound between
+// the words. Other words are said with the phonemes (frenchWord) if 'rules' is set,
+// else they are left out. With 'trim' the words of the catalogs are played without their
+// silent lead-in and lead-out (see trimmedSound), so 'gap' is the only pause between them;
+// their headers are left out too, the start pitch for the list is then spanPitch(spans[0]).
+// Stops at the last word that fits in 'spans'. Returns the number of spans.
+byte frenchSentence(const char *text, SoundSpan *spans, byte maxSpans, byte gap = 1, bool rules = true, bool trim = false);
+
+#endif
@@ -0,0 +1,145 @@
+/*
+
+    MEA8000_Cepstrum.cpp
+
+    Spectral distance between rendered sounds, see MEA8000_Cepstrum.h
+
+ */
+
+#include "MEA8000_Cepstrum.h"
+#include "MEA8000_Render.h"
+
+#include <cmath>
+#include <complex>
+
+
+#define FFT_SIZE        256
+#define MEL_BANDS       24
+#define SILENCE_DB      45          // frames this far below the loudest are silence
+
+
+static void fft(std::complex<float> *x) {
+    for (int i = 1, j = 0; i < FFT_SIZE; i++) {
+        int bit = FFT_SIZE >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (int length = 2; length <= FFT_SIZE; length <<= 1) {
+        std::complex<float> step = std::polar(1.0f, -2 * (float)M_PI / length);
+        for (int i = 0; i < FFT_SIZE; i += length) {
+            std::complex<float> w = 1;
+            for (int j = 0; j < length / 2; j++, w *= step) {
+                std::complex<float> u = x[i + j], v = x[i + j + length / 2] * w;
+                x[i + j]              = u + v;
+                x[i + j + length / 2] = u - v;
+            }
+        }
+    }
+}
+
+static float hzToMel(float hz)  { return 2595.0f * log10f(1 + hz / 700.0f); }
+static float melToHz(float mel) { return 700.0f * (powf(10, mel / 2595.0f) - 1); }
+
+// Triangular mel filters over the FFT bins, built once
+struct MelBank {
+    float weight [MEL_BANDS][FFT_SIZE / 2 + 1];
+
+    MelBank() {
+        float top = hzToMel(MEA8000_SAMPLE_RATE / 2);
+        for (int band = 0; band < MEL_BANDS; band++) {
+            float low    = melToHz(top * band / (MEL_BANDS + 1));
+            float center = melToHz(top * (band + 1) / (MEL_BANDS + 1));
+            float high   = melToHz(top * (band + 2) / (MEL_BANDS + 1));
+            for (int bin = 0; bin <= FFT_SIZE / 2; bin++) {
+                float hz = bin * (float)MEA8000_SAMPLE_RATE / FFT_SIZE;
+                weight[band][bin] = hz <= low || hz >= high ? 0
+                                  : hz <= center ? (hz - low) / (center - low) : (high - hz) / (high - center);
+            }
+        }
+    }
+};
+
+Cepstra cepstra(const std::vector<float> &samples) {
+    static const MelBank    bank;
+    int                     count = (int)samples.size() / MEA8000_STEP_SAMPLES;
+    std::vector<float>      all(count * CEPSTRUM_STRIDE, 0.0f);
+    std::vector<float>      energy(count);
+    float                   loudest = -1e30f;
+
+    for (int f = 0; f < count; f++) {
+        std::complex<float> x [FFT_SIZE];
+        int                 center = f * MEA8000_STEP_SAMPLES + MEA8000_STEP_SAMPLES / 2;
+
+        for (int n = 0; n < FFT_SIZE; n++) {
+            int at = center - FFT_SIZE / 2 + n;
+            x[n] = (at >= 0 && at < (int)samples.size() ? samples[at] : 0.0f)
+                   * (0.54f - 0.46f * cosf(2 * (float)M_PI * n / (FFT_SIZE - 1)));
+        }
+        fft(x);
+
+        float   bands [MEL_BANDS];
+        float   total = 0;
+        for (int band = 0; band < MEL_BANDS; band++) {
+            float sum = 0;
+            for (int bin = 0; bin <= FFT_SIZE / 2; bin++) sum += bank.weight[band][bin] * std::norm(x[bin]);
+            total      += sum;
+            bands[band] = logf(sum + 1e-10f);
+        }
+        energy[f] = 10 * log10f(total + 1e-10f);
+        if (energy[f] > loudest) loudest = energy[f];
+
+        float *c = &all[f * CEPSTRUM_STRIDE];
+        for (int k = 0; k < CEPSTRUM_SIZE; k++) {
+            float sum = 0;
+            for (int band = 0; band < MEL_BANDS; band++) sum += bands[band] * cosf((float)M_PI * (k + 1) * (band + 0.5f) / MEL_BANDS);
+            c[k] = sum * sqrtf(2.0f / MEL_BANDS);
+        }
+    }
+
+    // Leave out the silence at both ends
+    int first = 0, last = count;
+    while (first < last && energy[first] < loudest - SILENCE_DB) first++;
+    while (last > first && energy[last - 1] < loudest - SILENCE_DB) last--;
+
+    Cepstra result;
+    result.frames = last - first;
+    result.data.assign(all.begin() + first * CEPSTRUM_STRIDE, all.begin() + last * CEPSTRUM_STRIDE);
+    return result;
+}
+
+float cepstrumDistance(const float *a, const float *b) {
+    float sum = 0;
+    for (int k = 0; k < CEPSTRUM_STRIDE; k++) sum += (a[k] - b[k]) * (a[k] - b[k]);     // the padding is 0
+    return sqrtf(sum);
+}
+
+float soundDistance(const Cepstra &a, const Cepstra &b, float limit) {
+    int n = a.frames, m = b.frames;
+    if (n == 0 || m == 0) return n == m ? 0 : 1e30f;
+
+    // The band has to reach the corner, and a quarter of the longest on top of that
+    int band = abs(n - m) + (n > m ? n : m) / 4 + 1;
+
+    std::vector<float>  previous(m + 1, 1e30f), current(m + 1);
+    previous[0] = 0;
+
+    for (int i = 1; i <= n; i++) {
+        float rowBest = 1e30f;
+        current[0] = 1e30f;
+        for (int j = 1; j <= m; j++) {
+            if (abs(i * m / n - j) > band) {
+                current[j] = 1e30f;
+                continue;
+            }
+            float best = previous[j - 1];
+            if (previous[j] < best) best = previous[j];
+            if (current[j - 1] < best) best = current[j - 1];
+            current[j] = best + cepstrumDistance(a.frame(i - 1), b.frame(j - 1));
+            if (current[j] < rowBest) rowBest = current[j];
+        }
+        if (rowBest > limit * (n + m)) return rowBest / (n + m) + limit;      // can only grow
+        previous.swap(current);
+    }
+    return previous[m] / (n + m);
+}
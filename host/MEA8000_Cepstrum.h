@@ -0,0 +1,41 @@
+/*
+
+    MEA8000_Cepstrum.h
+
+    Spectral distance between rendered sounds, for the host tools.
+
+    A sound is turned into a row of cepstra (12 mel cepstral coefficients per 8 ms,
+    32 ms window), the silence at both ends is left out. Two sounds are compared with
+    dynamic time warping (within a band of 25 % of the length, so a slower or faster
+    take of the same word still matches), the result is the mean distance per step.
+    The level (c0) is not used, the same word at another volume is the same word.
+
+ */
+
+#ifndef MEA8000_CEPSTRUM_H
+#define MEA8000_CEPSTRUM_H
+
+#include <vector>
+
+
+#define CEPSTRUM_SIZE       12
+#define CEPSTRUM_STRIDE     16      // floats per frame, room for vector loads
+
+
+struct Cepstra {
+    std::vector<float>  data;       // frames * CEPSTRUM_STRIDE
+    int                 frames = 0;
+
+    const float *frame(int index) const     { return &data[index * CEPSTRUM_STRIDE]; }
+};
+
+// Cepstra of samples at 8 kHz
+Cepstra cepstra(const std::vector<float> &samples);
+
+float cepstrumDistance(const float *a, const float *b);
+
+// Mean distance per step along the best warping path, 'limit' stops early (returns
+// a value above it) when the result can't be below it
+float soundDistance(const Cepstra &a, const Cepstra &b, float limit = 1e30f);
+
+#endif
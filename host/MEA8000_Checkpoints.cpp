@@ -0,0 +1,100 @@
+/*
+
+    MEA8000_Checkpoints.cpp
+
+    Rendering a long sound from any position, see MEA8000_Checkpoints.h
+
+ */
+
+#include "MEA8000_Checkpoints.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+void CheckpointedSound::begin(const byte *data, uint16_t length, int every, float gain, const VoiceTables *voice) {
+    SoundSpan span = { data, length };
+    begin(&span, 1, every, gain, voice);
+}
+
+void CheckpointedSound::begin(const SoundSpan *spans, byte count, int every, float gain, const VoiceTables *voice, byte pitch) {
+    this->spans.assign(spans, spans + count);
+    this->gain  = gain;
+    this->voice = voice;
+    total       = 0;
+    points.clear();
+
+    if (!pitch) pitch = count > 0 ? soundStartPitch(spans[0].data, spans[0].length) : MEA8000_DEFAULT_PITCH;
+    this->pitch = 2.0f * pitch;
+
+    Synth       synth;
+    float       samples [SYNTH_MAX_SAMPLES];
+    int         frame    = 0;
+    byte        span     = 0;
+    uint16_t    offset   = 0;
+    const byte  *previous = NULL;
+
+    synth.begin(this->pitch, gain);
+    synth.setVoice(voice);
+    for (const byte *data; (data = frameAt(span, offset)); offset += MEA8000_FRAME_SIZE, frame++) {
+        if (frame % (every > 0 ? every : 1) == 0) {
+            Checkpoint point;
+            synth.save(&point.state);
+            point.sample   = total;
+            point.span     = span;
+            point.offset   = offset;
+            point.previous = previous;
+            points.push_back(point);
+        }
+        total   += synth.render(data, samples);
+        previous = data;
+    }
+}
+
+// The frame at 'span', 'offset', moved on over the ends (and the headers) of the spans. NULL at the end.
+const byte *CheckpointedSound::frameAt(byte &span, uint16_t &offset) const {
+    for (; span < spans.size(); span++, offset = 0) {
+        if (offset == 0) offset = soundHeaderSize(spans[span].data, spans[span].length);
+        if (offset + MEA8000_FRAME_SIZE <= spans[span].length) return spans[span].data + offset;
+    }
+    return NULL;
+}
+
+// A renderer at the checkpoint
+Synth CheckpointedSound::start(const Checkpoint &point) const {
+    Synth synth;
+
+    synth.begin(pitch, gain);
+    synth.setVoice(voice);
+    if (point.previous) synth.restore(point.state, point.previous);
+    return synth;
+}
+
+int CheckpointedSound::render(uint32_t position, float *out, int count) {
+    if (points.empty() || position >= total) return 0;
+
+    // The last checkpoint at or before 'position'
+    auto        after = std::upper_bound(points.begin(), points.end(), position,
+                                         [](uint32_t at, const Checkpoint &point) { return at < point.sample; });
+    const Checkpoint &point = *(after - 1);
+
+    Synth       synth  = start(point);
+    uint32_t    sample = point.sample;
+    int         done   = 0;
+    float       samples [SYNTH_MAX_SAMPLES];
+
+    byte        span   = point.span;
+    uint16_t    offset = point.offset;
+    for (const byte *data; done < count && (data = frameAt(span, offset)); offset += MEA8000_FRAME_SIZE) {
+        int     size  = synth.render(data, samples);
+        int     first = position + done > sample ? (int)(position + done - sample) : 0;
+        int     take  = std::min(size - first, count - done);
+
+        if (take > 0) {
+            memcpy(out + done, samples + first, take * sizeof(float));
+            done += take;
+        }
+        sample += size;
+    }
+    return done;
+}
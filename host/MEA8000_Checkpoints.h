@@ -0,0 +1,67 @@
+/*
+
+    MEA8000_Checkpoints.h
+
+    Rendering a long sound from any position (scrubbing, going on in the middle of
+    Sound_INTRO_MEA8000_P2), without rendering everything before it again.
+
+    The sound is rendered once, and every 'every' frames the state of the renderer is kept
+    (SynthState, 44 bytes: the filters, the pitch and the pulse phase). A position is then
+    rendered from the checkpoint before it: at most 'every' frames of work. The samples
+    are the same as those of a render from the start.
+
+    The frames themselves stay where they are (in memory, as the sound arrays, also for a
+    list of sounds: the checkpoints point into them), only the checkpoints are stored: one
+    for every 8 frames is at most 1/40 of the size of the samples (as floats) it stands for.
+
+ */
+
+#ifndef MEA8000_CHECKPOINTS_H
+#define MEA8000_CHECKPOINTS_H
+
+#include "MEA8000_Render.h"
+
+#include <vector>
+
+
+#define CHECKPOINT_DEFAULT_FRAMES   8
+
+
+class CheckpointedSound {
+public:
+    // 'data' must stay in place, 'voice' as well (NULL is the normal voice)
+    void begin(const byte *data, uint16_t length, int every = CHECKPOINT_DEFAULT_FRAMES,
+               float gain = 1, const VoiceTables *voice = NULL);
+
+    // A list of sounds (a sentence) as one, as renderSounds does ('pitch' as well). The list
+    // is copied, the sounds must stay in place.
+    void begin(const SoundSpan *spans, byte count, int every = CHECKPOINT_DEFAULT_FRAMES,
+               float gain = 1, const VoiceTables *voice = NULL, byte pitch = 0);
+
+    uint32_t samples() const        { return total; }
+    size_t   checkpoints() const    { return points.size(); }
+
+    // 'count' samples from 'position' on, returns how many there are (fewer at the end)
+    int render(uint32_t position, float *out, int count);
+
+private:
+    struct Checkpoint {
+        SynthState  state;
+        uint32_t    sample;         // first sample of the frame at 'offset'
+        byte        span;           // the frame that comes next
+        uint16_t    offset;
+        const byte  *previous;      // the frame before it, NULL at the start
+    };
+
+    const byte              *frameAt(byte &span, uint16_t &offset) const;
+    Synth                   start(const Checkpoint &point) const;
+
+    std::vector<SoundSpan>  spans;
+    float                   pitch;
+    float                   gain;
+    const VoiceTables       *voice;
+    uint32_t                total;
+    std::vector<Checkpoint> points;
+};
+
+#endif
@@ -0,0 +1,136 @@
+/*
+
+    MEA8000_ChipSim.cpp
+
+    A simulated MEA8000 with the timing of the frames, see MEA8000_ChipSim.h
+
+ */
+
+#include "MEA8000_ChipSim.h"
+
+
+void SimulatedChip::begin() {
+    now        = 0;
+    frames     = 0;
+    underruns  = 0;
+    silence    = 0;
+    minMargin  = INT32_MAX;
+    pitch      = 0;
+    state      = CHIP_IDLE;
+    playing    = false;
+    stopping   = false;
+    requesting = false;
+    requested  = 0;
+    frameEnd   = 0;
+    dryFrom    = 0;
+    inputBytes = 0;
+    next       = false;
+}
+
+void SimulatedChip::startFrame() {
+    frameEnd = now + (8000u << frameFD(input));
+    playing  = true;
+    next     = false;
+    state    = CHIP_PLAYING;
+    frames++;
+    raise();
+}
+
+void SimulatedChip::write(byte value) {
+    if (state == CHIP_IDLE) {
+        pitch      = value;
+        state      = CHIP_WAITING;
+        stopping   = false;
+        inputBytes = 0;
+        raise();
+        return;
+    }
+    input[inputBytes++] = value;
+    if (inputBytes < MEA8000_FRAME_SIZE) return;
+    inputBytes = 0;
+
+    if (playing) {
+        int32_t margin = (int32_t)(frameEnd - now);
+        if (margin < minMargin) minMargin = margin;
+        next = true;
+    } else {
+        if (dryFrom) silence += now - dryFrom;
+        dryFrom = 0;
+        startFrame();
+    }
+}
+
+void SimulatedChip::stop() {
+    stopping = true;
+    if (!playing) {
+        state = CHIP_IDLE;
+        raise();
+    }
+}
+
+void SimulatedChip::advance() {
+    if (!playing || now < frameEnd) return;
+    playing = false;
+
+    if (next) {
+        startFrame();
+    } else if (stopping) {
+        state = CHIP_IDLE;
+        raise();
+    } else {
+        underruns++;
+        dryFrom = now;
+        state   = CHIP_WAITING;
+    }
+}
+
+
+void simulateDriver(MEA8000Driver &driver, SimulatedChip &chip, const DriverTiming &timing, DriverStats *stats) {
+    uint32_t    start       = chip.now;
+    uint32_t    nextService = chip.now;
+    uint32_t    period      = timing.servicePeriod ? timing.servicePeriod : 1;
+
+    memset(stats, 0, sizeof(DriverStats));
+#ifdef DRIVER_COUNT_CYCLES
+    uint32_t    driverStart = driverCycles;
+#endif
+#ifdef FLASH_COUNT_CYCLES
+    uint32_t    flashStart  = flashCycles;
+#endif
+    uint16_t    lateStart   = driver.lateFrames();
+    uint32_t    framesStart = chip.frames, underrunsStart = chip.underruns;
+
+    chip.minMargin = INT32_MAX;
+    while (!driver.isIdle() || chip.request()) {
+        uint32_t interrupt = chip.request() ? chip.requestTime() + timing.latency : CHIPSIM_NEVER;
+        uint32_t event     = chip.nextEvent();
+
+        // At the same time: the interrupt, then the main loop, then the chip
+        if (interrupt <= nextService && interrupt <= event) {
+            chip.now = interrupt;
+            chip.acknowledge();
+            driver.onRequest();
+            stats->interrupts++;
+        } else if (nextService <= event) {
+            chip.now = nextService;
+            driver.service();
+            nextService += period;
+            stats->services++;
+        } else {
+            chip.now = event;
+            chip.advance();
+        }
+    }
+
+    stats->time       = chip.now - start;
+    stats->frames     = chip.frames - framesStart;
+    stats->underruns  = chip.underruns - underrunsStart;
+    stats->lateFrames = driver.lateFrames() - lateStart;
+    stats->minMargin  = chip.minMargin;
+#ifdef DRIVER_COUNT_CYCLES
+    stats->cycles += driverCycles - driverStart;
+#endif
+#ifdef FLASH_COUNT_CYCLES
+    stats->cycles += flashCycles - flashStart;
+#endif
+}
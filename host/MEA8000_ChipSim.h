@@ -0,0 +1,101 @@
+/*
+
+    MEA8000_ChipSim.h
+
+    A simulated MEA8000 on the bus of MEA8000Driver, with the timing of the frames, to see
+    how much room a firmware has without the chip on the table.
+
+    The chip, as far as the feeding goes:
+    - the first byte after a stop is the pitch, it then raises REQ for the first frame and
+      waits for it;
+    - it plays a frame for 8, 16, 32 or 64 ms (FD) and raises REQ when it starts it;
+    - the next frame has to be complete before the frame playing ends. The time left then
+      is the margin of that frame. When it is not there the chip runs dry: an underrun,
+      silence until a frame comes;
+    - after stop() it ends with the frame playing and raises REQ once more.
+
+    simulateDriver runs a driver against it, with the interrupt coming 'latency' µs after
+    REQ and the main loop calling service() every 'servicePeriod' µs, until everything
+    queued has been said. Times are in µs.
+
+ */
+
+#ifndef MEA8000_CHIPSIM_H
+#define MEA8000_CHIPSIM_H
+
+#include "../MEA8000_Driver.h"
+
+
+#define CHIPSIM_NEVER       0xFFFFFFFFu
+#define CHIPSIM_CPU_MHZ     16
+
+
+class SimulatedChip : public MEA8000Bus {
+public:
+    SimulatedChip()                     { begin(); }
+
+    void begin();
+
+    void write(byte value);
+    void stop();
+
+    // Time of the next thing the chip does by itself (the end of a frame), and doing it
+    uint32_t nextEvent() const          { return playing ? frameEnd : CHIPSIM_NEVER; }
+    void     advance();
+
+    // The REQ line, raised at requestTime
+    bool     request() const            { return requesting; }
+    uint32_t requestTime() const        { return requested; }
+    void     acknowledge()              { requesting = false; }
+
+    uint32_t    now;                    // set by whoever runs the simulation
+
+    // What happened
+    uint32_t    frames;                 // frames played
+    uint32_t    underruns;              // frames that were not there in time
+    uint32_t    silence;                // time without a frame because of them
+    int32_t     minMargin;              // smallest time left between a frame coming and being needed
+    byte        pitch;                  // the last start pitch
+
+private:
+    void raise()                        { requesting = true; requested = now; }
+    void startFrame();
+
+    enum State { CHIP_IDLE, CHIP_WAITING, CHIP_PLAYING };
+
+    State       state;
+    bool        playing;
+    bool        stopping;
+    bool        requesting;
+    uint32_t    requested;
+    uint32_t    frameEnd;
+    uint32_t    dryFrom;                // start of an underrun
+    byte        input [MEA8000_FRAME_SIZE];
+    byte        inputBytes;
+    bool        next;                   // a complete frame waits in 'input'
+};
+
+
+struct DriverTiming {
+    uint32_t    latency;                // from REQ to the interrupt
+    uint32_t    servicePeriod;          // between calls of service()
+};
+
+struct DriverStats {
+    uint32_t    time;                   // until all was said
+    uint32_t    frames;
+    uint32_t    underruns;
+    uint32_t    lateFrames;             // written by service() instead of the interrupt
+    int32_t     minMargin;
+    uint32_t    interrupts;
+    uint32_t    services;
+    uint64_t    cycles;                 // estimated ATmega cycles of the driver and its Flash reads
+
+    // Part of the CPU (CHIPSIM_CPU_MHZ) spent on feeding the chip
+    double load() const                 { return time ? (double)cycles / ((double)time * CHIPSIM_CPU_MHZ) : 0; }
+};
+
+// Run 'driver' (with its phrases queued, its bus 'chip') until it is idle
+void simulateDriver(MEA8000Driver &driver, SimulatedChip &chip, const DriverTiming &timing, DriverStats *stats);
+
+#endif
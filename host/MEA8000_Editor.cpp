@@ -0,0 +1,88 @@
+/*
+
+    MEA8000_Editor.cpp
+
+    An editing session on one sound, see MEA8000_Editor.h
+
+ */
+
+#include "MEA8000_Editor.h"
+
+#include <cstring>
+
+
+void SoundEditor::begin(const byte *data, uint16_t length) {
+    bytes.assign(data, data + length);
+    header = 0;
+    pitch  = 2 * MEA8000_DEFAULT_PITCH;
+    if (length >= MEA8000_HEADER_SIZE && isSoundHeader(data[0], data[2], data[3])) {
+        header = MEA8000_HEADER_SIZE;
+        pitch  = 2.0f * data[2];
+    }
+    states.clear();
+    starts.assign(1, 0);
+    pcm.clear();
+
+    Synth   synth;
+    float   samples [SYNTH_MAX_SAMPLES];
+
+    synth.begin(pitch);
+    for (uint16_t offset = header; offset + MEA8000_FRAME_SIZE <= length; offset += MEA8000_FRAME_SIZE) {
+        SynthState state;
+        synth.save(&state);
+        states.push_back(state);
+
+        int count = synth.render(&bytes[offset], samples);
+        pcm.insert(pcm.end(), samples, samples + count);
+        starts.push_back((uint32_t)pcm.size());
+    }
+}
+
+bool SoundEditor::settled(const SynthState &a, const SynthState &b) const {
+    if (a.pitch != b.pitch || a.phase != b.phase || a.noise != b.noise) return false;
+    // The same values, not close ones: a difference left behind would add up over the edits.
+    // A decaying difference goes below the last bit of the floats within a few frames.
+    for (int i = 0; i < 4; i++) {
+        if (a.y1[i] != b.y1[i] || a.y2[i] != b.y2[i]) return false;
+    }
+    return true;
+}
+
+int SoundEditor::setFrame(int index, const byte *frame) {
+    if (index < 0 || index >= frames()) return 0;
+    memcpy(&bytes[header + index * MEA8000_FRAME_SIZE], frame, MEA8000_FRAME_SIZE);
+
+    Synth               synth;
+    float               samples [SYNTH_MAX_SAMPLES];
+    std::vector<float>  fresh;
+    int                 end = index;
+
+    synth.begin(pitch);
+    if (index > 0) synth.restore(states[index], this->frame(index - 1));
+
+    // The frame after the changed one glides from it, so it is always rendered again
+    while (end < frames()) {
+        int count = synth.render(this->frame(end), samples);
+        fresh.insert(fresh.end(), samples, samples + count);
+        end++;
+        if (end == frames()) break;
+
+        SynthState state;
+        synth.save(&state);
+        if (end > index + 1 && settled(state, states[end])) break;
+        states[end] = state;
+    }
+
+    // Frames index .. end - 1 are new, their length may have changed (FD)
+    uint32_t    first = starts[index];
+    long        moved = (long)fresh.size() - (long)(starts[end] - first);
+
+    pcm.erase(pcm.begin() + first, pcm.begin() + starts[end]);
+    pcm.insert(pcm.begin() + first, fresh.begin(), fresh.end());
+    for (int k = index + 1; k <= end; k++) {
+        if (k < end) starts[k] = starts[k - 1] + (uint32_t)(MEA8000_STEP_SAMPLES * frameSteps(this->frame(k - 1)));
+        else         starts[k] = (uint32_t)(starts[k] + moved);
+    }
+    for (int k = end + 1; k <= frames(); k++) starts[k] = (uint32_t)(starts[k] + moved);
+    return end - index;
+}
@@ -0,0 +1,53 @@
+/*
+
+    MEA8000_Editor.h
+
+    An editing session on one sound, for fixing frames by hand (typing errors of the
+    OCR, see tools/MEA8000_Duplicates.cpp) while listening to the result.
+
+    The session keeps a copy of the sound, its samples and the state of the renderer
+    before every frame (SynthState, 44 bytes a frame). After a frame is changed only the
+    part that changes is rendered again: from the checkpoint of that frame on, until the
+    state of the renderer is back to what it was before the change (the filters have
+    settled to the same values, the pitch and the pulse phase are the same). From there
+    the old samples are still right, the same as a render of the whole edited sound, so
+    no error adds up over many edits (tools/MEA8000_EditCheck.cpp checks this). A change
+    of PI moves the pitch of everything after it, then the rest of the sound is rendered,
+    that is the worst case.
+
+ */
+
+#ifndef MEA8000_EDITOR_H
+#define MEA8000_EDITOR_H
+
+#include "MEA8000_Render.h"
+
+#include <vector>
+
+
+class SoundEditor {
+public:
+    // A copy of the sound is made
+    void begin(const byte *data, uint16_t length);
+
+    int                         frames() const      { return (int)states.size(); }
+    const byte                 *frame(int index) const  { return &bytes[header + index * MEA8000_FRAME_SIZE]; }
+    const std::vector<byte>    &data() const        { return bytes; }
+    const std::vector<float>   &samples() const     { return pcm; }
+    uint32_t                    firstSample(int index) const    { return starts[index]; }
+
+    // Change frame 'index' and render what changes, returns the number of frames rendered
+    int setFrame(int index, const byte *frame);
+
+private:
+    bool settled(const SynthState &a, const SynthState &b) const;
+
+    std::vector<byte>       bytes;
+    uint16_t                header;
+    float                   pitch;
+    std::vector<SynthState> states;     // before every frame
+    std::vector<uint32_t>   starts;     // first sample of every frame, and the end
+    std::vector<float>      pcm;
+};
+
+#endif
@@ -0,0 +1,141 @@
+/*
+
+    MEA8000_FeedSim.cpp
+
+    Discrete-event model of feeding the MEA8000, see MEA8000_FeedSim.h
+
+ */
+
+#include "MEA8000_FeedSim.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+
+// -- latencies ---------------------------------------------------------------------
+
+bool parseLatency(const char *text, Latency *latency) {
+    char        kind [16];
+    unsigned    a = 0, b = 0, spike = 0;
+    float       chance = 0;
+    int         used = 0;
+
+    memset(latency, 0, sizeof(Latency));
+    if (sscanf(text, "%15[a-z]:%n", kind, &used) != 1 || used == 0) return false;
+    text += used;
+
+    if (!strcmp(kind, "fixed")) {
+        if (sscanf(text, "%u%n", &a, &used) != 1) return false;
+        latency->kind = Latency::FIXED;
+        b = a;
+    } else if (!strcmp(kind, "uniform")) {
+        if (sscanf(text, "%u:%u%n", &a, &b, &used) != 2 || b < a) return false;
+        latency->kind = Latency::UNIFORM;
+    } else if (!strcmp(kind, "exp")) {
+        if (sscanf(text, "%u%n", &a, &used) != 1) return false;
+        latency->kind = Latency::EXPONENTIAL;
+    } else {
+        return false;
+    }
+    text += used;
+    latency->low  = a;
+    latency->high = b;
+
+    if (!*text) return true;
+    if (sscanf(text, "+spike:%f:%u%n", &chance, &spike, &used) != 2 || text[used] || chance < 0 || chance > 1) return false;
+    latency->spikeChance = chance;
+    latency->spike       = spike;
+    return true;
+}
+
+uint32_t FeedRandom::draw(const Latency &latency) {
+    double time = latency.low;
+
+    if (latency.kind == Latency::UNIFORM)     time += uniform() * (latency.high - latency.low);
+    if (latency.kind == Latency::EXPONENTIAL) time = -log(1 - uniform()) * latency.low;
+
+    if (latency.spikeChance > 0 && uniform() < latency.spikeChance) time += uniform() * latency.spike;
+    return (uint32_t)time;
+}
+
+
+// -- the simulation ----------------------------------------------------------------
+
+void FeedSimulation::begin(const SoundSpan *spans, byte count) {
+    SoundStream stream(spans, count);
+    byte        frame [MEA8000_FRAME_SIZE];
+
+    durations.clear();
+    owner.clear();
+    total     = 0;
+    partCount = count;
+    while (stream.nextFrame(frame)) {
+        durations.push_back(8000u << frameFD(frame));
+        owner.push_back(stream.spanIndex());
+        total += durations.back();
+    }
+}
+
+void FeedSimulation::clear(FeedPart *result) const {
+    for (size_t i = 0; i < partCount; i++) {
+        result[i].underruns      = 0;
+        result[i].lateInterrupts = 0;
+        result[i].depth          = 0;
+        result[i].minMargin      = INT32_MAX;
+    }
+}
+
+void FeedSimulation::run(uint32_t seed, uint32_t depth, const Latency &interrupt, const Latency &service, FeedPart *result) const {
+    // Two streams of random numbers: the same draws whatever the depth
+    FeedRandom  interruptTimes(seed * 2 + 1), visitTimes(seed * 2 + 2);
+    size_t      n        = durations.size();
+    uint32_t    visit    = visitTimes.draw(service);        // the main loop starts the phrase
+    uint32_t    request  = visit;
+    uint32_t    end      = 0;                           // of the frame playing, 0 before the first
+    size_t      filled   = depth < n ? depth : n;       // frames read into the buffer
+    size_t      lastFill = 0;                           // frames taken at the last visit
+
+    visit += visitTimes.draw(service);
+
+    for (size_t i = 0; i < n; i++) {
+        FeedPart    &part  = result[owner[i]];
+        uint32_t    called = request + interruptTimes.draw(interrupt);
+        uint32_t    arrival;
+
+        // The visits of the main loop before the interrupt (at the same time the interrupt goes first)
+        while (visit < called) {
+            lastFill = i;
+            filled   = depth < n - i ? i + depth : n;
+            visit   += visitTimes.draw(service);
+        }
+
+        if (end) {
+            if (called > end) {
+                part.lateInterrupts++;
+            } else if (visit > end) {
+                // Only the buffer can save this frame: all taken since the last visit must fit
+                uint32_t needed = (uint32_t)(i - lastFill) + 1;
+                if (needed > part.depth) part.depth = needed;
+            }
+        }
+
+        if (filled > i) {
+            arrival = called;
+        } else {
+            arrival  = visit;                           // the request waits for the main loop
+            lastFill = i;
+            filled   = depth < n - i ? i + depth : n;
+            visit   += visitTimes.draw(service);
+        }
+
+        if (end) {
+            int32_t margin = (int32_t)(end - arrival);
+            if (margin < part.minMargin) part.minMargin = margin;
+            if (margin < 0) part.underruns++;
+        }
+        uint32_t start = end > arrival ? end : arrival;
+        end     = start + durations[i];
+        request = start;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+
+    MEA8000_FeedSim.h
+
+    How much the firmware may lag before the MEA8000 runs dry, and how many frames the feed
+    buffer must hold to ride it out. A discrete-event model of the feeding of MEA8000Driver
+    (the chip of MEA8000_ChipSim without the driver code around it), fast enough for
+    thousands of scenarios a second:
+
+    - the chip asks for the next frame (REQ) when it starts one and needs it before that
+      one ends (8 .. 64 ms, the FD of the frames), the first frame it waits for;
+    - the interrupt comes a random time after REQ and takes a frame from the buffer;
+    - the main loop comes by at random intervals: it tops the buffer up to 'depth' frames
+      and writes the frame to a request that found the buffer empty;
+    - a frame that comes after the one playing has ended is an underrun: the chip is
+      silent until it comes.
+
+    The random times are Latency distributions: fixed, uniform or exponential, with now and
+    then a spike on top (a main loop that is blocked for a while, interrupts that are off).
+
+    The depth a scenario needs is the most frames taken between two visits of the main loop,
+    counted only where the main loop would come too late to save the frame. Underruns that
+    no buffer can prevent (the interrupt itself too late) are counted apart.
+
+    FramePrefetch (MEA8000_Flash.h) fills halves of FLASH_PREFETCH_FRAMES: at worst only one
+    half is full when the main loop leaves, its depth is FLASH_PREFETCH_FRAMES.
+
+ */
+
+#ifndef MEA8000_FEEDSIM_H
+#define MEA8000_FEEDSIM_H
+
+#include "../MEA8000_Stream.h"
+
+#include <vector>
+
+
+#define FEEDSIM_UNLIMITED   0x7FFFFFFF      // a buffer that never runs empty
+
+
+// A random time in µs: base + the distribution + sometimes a spike
+struct Latency {
+    enum Kind { FIXED, UNIFORM, EXPONENTIAL };
+
+    Kind        kind;
+    uint32_t    low;                // FIXED: the time, UNIFORM: low .. high, EXPONENTIAL: the mean
+    uint32_t    high;
+    float       spikeChance;        // chance of a spike, 0 .. 1
+    uint32_t    spike;              // its length: up to this (uniform)
+};
+
+// "fixed:T", "uniform:LOW:HIGH" or "exp:MEAN", with an optional "+spike:CHANCE:MAX" (µs)
+bool parseLatency(const char *text, Latency *latency);
+
+
+// A small random generator (xorshift), the same numbers for the same seed
+class FeedRandom {
+public:
+    FeedRandom(uint32_t seed = 1)       { begin(seed); }
+
+    void        begin(uint32_t seed)    { state = seed ? seed : 0x9E3779B9u; }
+    uint32_t    next()                  { state ^= state << 13; state ^= state >> 17; state ^= state << 5; return state; }
+    double      uniform()               { return (next() >> 8) * (1.0 / 16777216.0); }      // 0 .. 1
+    uint32_t    draw(const Latency &latency);
+
+private:
+    uint32_t    state;
+};
+
+
+// What happened to a part (a sound of the sequence) in one or more scenarios
+struct FeedPart {
+    uint32_t    underruns;          // frames too late with the buffer depth given
+    uint32_t    lateInterrupts;     // ... of them because the interrupt itself was too late
+    uint32_t    depth;              // buffer depth needed, the most of all scenarios (run with
+                                    // FEEDSIM_UNLIMITED: the timing without buffer underruns)
+    int32_t     minMargin;          // smallest time left before a frame was needed (µs)
+};
+
+
+class FeedSimulation {
+public:
+    // The frames of a sequence of sounds, as one phrase. The parts are the spans.
+    void begin(const SoundSpan *spans, byte count);
+
+    size_t  frames() const              { return durations.size(); }
+    size_t  parts() const               { return partCount; }
+    uint32_t time() const               { return total; }          // µs without underruns
+
+    // One scenario with a buffer of 'depth' frames, added to 'result' (parts() of them)
+    void run(uint32_t seed, uint32_t depth, const Latency &interrupt, const Latency &service, FeedPart *result) const;
+
+    // Clear 'result' before the first run
+    void clear(FeedPart *result) const;
+
+private:
+    std::vector<uint32_t>   durations;  // of the frames (µs)
+    std::vector<byte>       owner;      // the part of each frame
+    size_t                  partCount;
+    uint32_t                total;
+};
+
+#endif
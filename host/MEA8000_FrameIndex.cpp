@@ -0,0 +1,114 @@
+/*
+
+    MEA8000_FrameIndex.cpp
+
+    Nearest frame for wanted formant values, see MEA8000_FrameIndex.h
+
+ */
+
+#include "MEA8000_FrameIndex.h"
+
+#include <cmath>
+
+
+// Zwicker & Terhardt
+float hzToBark(float hz) {
+    return 13.0f * atanf(0.00076f * hz) + 3.5f * atanf((hz / 7500.0f) * (hz / 7500.0f));
+}
+
+static float octaves(float value) {
+    return log2f(value > 1e-4f ? value : 1e-4f);
+}
+
+const FrameWeights frameDefaultWeights = {
+    { 1.0f, 1.0f, 0.5f },                   // FM1 .. FM3, per Bark
+    { 0.2f, 0.2f, 0.1f, 0.05f },            // BW1 .. BW4, per octave
+    0.3f                                    // AMPL, per octave (6 dB)
+};
+
+
+void FrameAxis::build(const float *values, int count, float (*scale)(float), float cells) {
+    this->scale = scale;
+    this->cells = cells;
+    points.resize(count);
+    for (int i = 0; i < count; i++) points[i] = scale(values[i]);
+
+    // The table covers the values with half a step of room on both sides
+    low = points[0] - (points[1] - points[0]) / 2;
+    float   high = points[count - 1] + (points[count - 1] - points[count - 2]) / 2;
+    int     size = (int)ceilf((high - low) * cells) + 1;
+
+    lower.resize(size);
+    upper.resize(size);
+    for (int cell = 0; cell < size; cell++) {
+        for (int edge = 0; edge < 2; edge++) {
+            float   at   = low + (cell + edge) / cells;
+            int     best = 0;
+            for (int i = 1; i < count; i++) {
+                if (fabsf(points[i] - at) < fabsf(points[best] - at)) best = i;
+            }
+            (edge ? upper : lower)[cell] = (byte)best;
+        }
+    }
+}
+
+byte FrameAxis::nearest(float value) const {
+    float   at   = scale(value);
+    int     cell = (int)((at - low) * cells);
+
+    if (cell < 0)                   return 0;
+    if (cell >= (int)lower.size())  return (byte)(points.size() - 1);
+
+    byte a = lower[cell], b = upper[cell];
+    if (a == b) return a;
+    return fabsf(points[a] - at) <= fabsf(points[b] - at) ? a : b;
+}
+
+float FrameAxis::distance(float value, byte index) const {
+    return scale(value) - points[index];
+}
+
+
+FrameIndex::FrameIndex() {
+    float values [32];
+
+    for (int i = 0; i < 32; i++) values[i] = frameFM1Hz[i];
+    fmAxis[0].build(values, 32, hzToBark, 32);
+    for (int i = 0; i < 32; i++) values[i] = frameFM2Hz[i];
+    fmAxis[1].build(values, 32, hzToBark, 32);
+    for (int i = 0; i < 8; i++)  values[i] = frameFM3Hz[i];
+    fmAxis[2].build(values, 8, hzToBark, 32);
+
+    // The tables go from wide to narrow and from soft to loud, as the fields do
+    for (int i = 0; i < 4; i++)  values[i] = 1.0f / frameBWHz[i];
+    bwAxis.build(values, 4, octaves, 8);
+    for (int i = 0; i < 16; i++) values[i] = i ? frameAMPLScale[i] / 1000.0f : frameAMPLScale[1] / 2000.0f;
+    amplAxis.build(values, 16, octaves, 8);
+}
+
+void FrameIndex::nearest(const FrameValues &values, byte *frame, byte fd, byte pi) const {
+    byte bw [4];
+    for (int i = 0; i < 4; i++) bw[i] = bwAxis.nearest(1.0f / values.bw[i]);
+
+    byte ampl = values.ampl <= 0 ? 0 : amplAxis.nearest(values.ampl);
+    packFrame(frame, bw[0], bw[1], bw[2], bw[3],
+              fmAxis[2].nearest(values.fm[2]), fmAxis[1].nearest(values.fm[1]), fmAxis[0].nearest(values.fm[0]),
+              ampl, fd, pi);
+}
+
+float FrameIndex::distance(const FrameValues &values, const byte *frame, const FrameWeights &weights) const {
+    byte    fm [3] = { frameFM1(frame), frameFM2(frame), frameFM3(frame) };
+    byte    bw [4] = { frameBW1(frame), frameBW2(frame), frameBW3(frame), frameBW4(frame) };
+    float   sum    = 0;
+
+    for (int i = 0; i < 3; i++) {
+        float d = fmAxis[i].distance(values.fm[i], fm[i]);
+        sum += weights.fm[i] * d * d;
+    }
+    for (int i = 0; i < 4; i++) {
+        float d = bwAxis.distance(1.0f / values.bw[i], bw[i]);
+        sum += weights.bw[i] * d * d;
+    }
+    float d = amplAxis.distance(values.ampl > 0 ? values.ampl : frameAMPLScale[1] / 2000.0f, frameAMPL(frame));
+    return sum + weights.ampl * d * d;
+}
@@ -0,0 +1,77 @@
+/*
+
+    MEA8000_FrameIndex.h
+
+    Nearest frame for wanted formant values, on a PC (encoders, smoothing tools).
+
+    The distance is perceptual: formant frequencies in Bark, bandwidths and amplitude on a
+    log scale, each field with its own weight. The frame fields are independent and the
+    distance is a weighted sum over the fields, so the nearest frame of the whole
+    32 x 32 x 8 x 4^4 x 16 grid is the nearest value of every field on its own.
+    No tree is needed: every field has a table over its axis (1/32 Bark or 1/8 octave
+    per cell) with the nearest index at both edges of the cell. When they are the same
+    that is the answer, else the two are compared; the result is exact and a query is
+    a few table reads per field (well under a microsecond for a whole frame).
+    tools/MEA8000_FrameIndexCheck compares it with a brute force search and times it.
+
+ */
+
+#ifndef MEA8000_FRAMEINDEX_H
+#define MEA8000_FRAMEINDEX_H
+
+#include "MEA8000_Render.h"
+
+
+float hzToBark(float hz);
+
+
+// Weights of the fields in the distance (squared Bark / squared octaves)
+struct FrameWeights {
+    float   fm [3];
+    float   bw [4];
+    float   ampl;
+};
+
+extern const FrameWeights frameDefaultWeights;
+
+
+class FrameAxis {
+public:
+    // 'values' (count of them, rising) are mapped with 'scale' (Bark or log2),
+    // the table has 'cells' per unit of the scale
+    void    build(const float *values, int count, float (*scale)(float), float cells);
+
+    byte    nearest(float value) const;
+    float   distance(float value, byte index) const;    // on the scale, not weighted
+
+private:
+    float               (*scale)(float);
+    float               low;
+    float               cells;
+    std::vector<float>  points;         // the values on the scale
+    std::vector<byte>   lower;          // nearest index at the lower edge of every cell
+    std::vector<byte>   upper;
+};
+
+
+class FrameIndex {
+public:
+    FrameIndex();
+
+    // The nearest frame to 'values' (values.fm[3] and noise are not used), FD and PI as given
+    void    nearest(const FrameValues &values, byte *frame, byte fd = 0, byte pi = 0) const;
+
+    // Weighted distance between 'values' and a frame
+    float   distance(const FrameValues &values, const byte *frame, const FrameWeights &weights = frameDefaultWeights) const;
+
+    const FrameAxis &fm(int formant) const      { return fmAxis[formant]; }
+    const FrameAxis &bw() const                 { return bwAxis; }
+    const FrameAxis &ampl() const               { return amplAxis; }
+
+private:
+    FrameAxis   fmAxis [3];
+    FrameAxis   bwAxis;
+    FrameAxis   amplAxis;
+};
+
+#endif
@@ -0,0 +1,173 @@
+/*
+
+    MEA8000_Mixer.cpp
+
+    Several voices mixed for an audio callback, see MEA8000_Mixer.h
+
+ */
+
+#include "MEA8000_Mixer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+void mixSaturate(int16_t *out, const int16_t *in, int count) {
+    int i = 0;
+#if defined(__SSE2__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i sum = _mm_adds_epi16(_mm_loadu_si128((const __m128i *)(out + i)), _mm_loadu_si128((const __m128i *)(in + i)));
+        _mm_storeu_si128((__m128i *)(out + i), sum);
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) vst1q_s16(out + i, vqaddq_s16(vld1q_s16(out + i), vld1q_s16(in + i)));
+#endif
+    for (; i < count; i++) {
+        int32_t sum = out[i] + in[i];
+        out[i] = sum > INT16_MAX ? INT16_MAX : sum < INT16_MIN ? INT16_MIN : (int16_t)sum;
+    }
+}
+
+
+Mixer::Mixer(int channels) : stopping(false), misses(0) {
+    for (int i = 0; i < channels; i++) {
+        all.emplace_back(new Channel());
+        Channel &channel = *all.back();
+        channel.speaking = false;
+        channel.block    = NULL;
+        channel.used     = 0;
+        channel.started  = false;
+        channel.worker   = std::thread(&Mixer::work, this, std::ref(channel));
+    }
+}
+
+Mixer::~Mixer() {
+    stopping = true;
+    for (auto &channel : all) {
+        { std::lock_guard<std::mutex> hold(channel->lock); }
+        channel->wake.notify_one();
+        channel->worker.join();
+    }
+}
+
+void Mixer::say(int channel, const SoundSpan *spans, byte count, float gain, const VoiceTables *voice, byte pitch) {
+    if (channel < 0 || channel >= channels() || count == 0) return;
+
+    Channel &c = *all[channel];
+    {
+        std::lock_guard<std::mutex> hold(c.lock);
+        c.phrases.push_back(Phrase { std::vector<SoundSpan>(spans, spans + count), gain, voice, pitch });
+    }
+    c.wake.notify_one();
+}
+
+bool Mixer::busy(int channel) {
+    Channel &c = *all[channel];
+    std::lock_guard<std::mutex> hold(c.lock);
+    return !c.phrases.empty() || c.speaking || !c.queue.empty();
+}
+
+bool Mixer::busy() {
+    for (int i = 0; i < channels(); i++) if (busy(i)) return true;
+    return false;
+}
+
+
+// -- the workers -------------------------------------------------------------------
+
+// A free block to fill, waits while the queue is full. False when the mixer stops.
+bool Mixer::waitForBlock(Channel &channel, int16_t **block) {
+    while (!(*block = channel.queue.writeBlock())) {
+        if (stopping) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void Mixer::work(Channel &channel) {
+    float   samples [SYNTH_MAX_SAMPLES];
+
+    for (;;) {
+        Phrase phrase;
+        {
+            std::unique_lock<std::mutex> hold(channel.lock);
+            channel.wake.wait(hold, [&] { return stopping || !channel.phrases.empty(); });
+            if (stopping) return;
+            phrase = std::move(channel.phrases.front());
+            channel.phrases.pop_front();
+            channel.speaking = true;        // with the lock: busy() never sees neither
+        }
+
+        const std::vector<SoundSpan> &spans = phrase.spans;
+        Synth       synth;
+        float       scale = SYNTH_PCM_SCALE * phrase.gain;
+        int16_t     *block = NULL;
+        int         used  = 0;
+
+        synth.begin(2.0f * (phrase.pitch ? phrase.pitch : soundStartPitch(spans[0].data, spans[0].length)));
+        synth.setVoice(phrase.voice);
+
+        for (const SoundSpan &span : spans) {
+            for (uint16_t offset = soundHeaderSize(span.data, span.length); offset + MEA8000_FRAME_SIZE <= span.length; offset += MEA8000_FRAME_SIZE) {
+                int count = synth.render(span.data + offset, samples);
+
+                for (int i = 0; i < count; i++) {
+                    // A full block waits for the next sample: the last one is published with the mark
+                    if (used == MIXER_BLOCK) {
+                        channel.queue.publish();
+                        block = NULL;
+                        used  = 0;
+                    }
+                    if (!block && !waitForBlock(channel, &block)) return;
+                    block[used++] = synthPcm(samples[i], scale);
+                }
+            }
+        }
+        if (used > 0) {
+            std::fill(block + used, block + MIXER_BLOCK, 0);
+            channel.queue.publish(true);
+        }
+        channel.speaking = false;
+    }
+}
+
+
+// -- the callback ------------------------------------------------------------------
+
+void Mixer::mix(int16_t *out, int count) {
+    memset(out, 0, count * sizeof(int16_t));
+
+    for (auto &pointer : all) {
+        Channel &channel = *pointer;
+
+        for (int done = 0; done < count; ) {
+            if (!channel.block) {
+                channel.block = channel.queue.readBlock();
+                channel.used  = 0;
+            }
+            if (!channel.block) {
+                // Nothing in the middle of a phrase is an underrun, before its first block its latency
+                if (channel.started) misses++;
+                break;
+            }
+            channel.started = true;
+
+            int take = std::min(MIXER_BLOCK - channel.used, count - done);
+            mixSaturate(out + done, channel.block + channel.used, take);
+            done         += take;
+            channel.used += take;
+            if (channel.used == MIXER_BLOCK) {
+                if (channel.queue.lastBlock()) channel.started = false;
+                channel.queue.release();
+                channel.block = NULL;
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*
+
+    MEA8000_Mixer.h
+
+    Several voices at once (a beep or a phrase on one channel, a spoken number on another)
+    mixed to one 16 bit stream, for an audio callback on a PC.
+
+    Every channel has a worker thread that renders its phrases (lists of sounds, see
+    renderSounds) into blocks of MIXER_BLOCK samples, and hands them over through a
+    BlockQueue: a ring of blocks with one writer (the worker) and one reader (the callback),
+    wait-free, nothing but two atomic counters. The callback (mix) takes the blocks of all
+    channels and adds them with saturation (SSE2 or NEON when there is one): no locks, no
+    allocation, no waiting. When a worker falls behind its channel is silent for that
+    callback, counted as an underrun. The last block of a phrase is marked in the queue, so
+    the wait for the first block of the next phrase (its latency) is not counted.
+
+    say() is called from the control thread: it may lock, the phrase list is copied there.
+
+ */
+
+#ifndef MEA8000_MIXER_H
+#define MEA8000_MIXER_H
+
+#include "MEA8000_Render.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+#define MIXER_BLOCK         256         // samples in a block (32 ms)
+#define MIXER_QUEUE_BLOCKS  8           // blocks queued per channel
+#define MIXER_CHANNELS      4
+
+
+// Wait-free ring of sample blocks, one producer thread and one consumer thread
+class BlockQueue {
+public:
+    BlockQueue() : head(0), tail(0) {}
+
+    // Producer: the free block to fill (NULL when all are queued), then publish it
+    // ('last': it ends a phrase)
+    int16_t *writeBlock() {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        return t - head.load(std::memory_order_acquire) < MIXER_QUEUE_BLOCKS ? blocks[t % MIXER_QUEUE_BLOCKS] : NULL;
+    }
+    void publish(bool last = false) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        ends[t % MIXER_QUEUE_BLOCKS] = last;
+        tail.store(t + 1, std::memory_order_release);
+    }
+
+    // Consumer: the oldest block (NULL when there is none), whether it ends a phrase, then give it back
+    const int16_t *readBlock() {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        return tail.load(std::memory_order_acquire) != h ? blocks[h % MIXER_QUEUE_BLOCKS] : NULL;
+    }
+    bool lastBlock() const          { return ends[head.load(std::memory_order_relaxed) % MIXER_QUEUE_BLOCKS]; }
+    void release()                  { head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    bool empty() const              { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+
+private:
+    int16_t                 blocks [MIXER_QUEUE_BLOCKS][MIXER_BLOCK];
+    bool                    ends [MIXER_QUEUE_BLOCKS];
+    std::atomic<uint32_t>   head;               // blocks read
+    char                    apart [64];         // (the counters on cache lines of their own)
+    std::atomic<uint32_t>   tail;               // blocks written
+};
+
+
+// out[i] + in[i], clipped to -32768 .. 32767
+void mixSaturate(int16_t *out, const int16_t *in, int count);
+
+
+class Mixer {
+public:
+    Mixer(int channels = MIXER_CHANNELS);
+    ~Mixer();
+
+    // Queue a list of sounds on a channel, said after what is queued there. The list is
+    // copied, the sounds must stay in place ('voice' as well, NULL is the normal voice).
+    // 'pitch' is the start pitch as for renderSounds, 0 takes the header of the first sound.
+    void say(int channel, const SoundSpan *spans, byte count, float gain = 1, const VoiceTables *voice = NULL,
+             byte pitch = 0);
+
+    // Something left to say or to play
+    bool busy(int channel);
+    bool busy();
+
+    // The audio callback: the next 'count' samples of all channels
+    void mix(int16_t *out, int count);
+
+    int      channels() const       { return (int)all.size(); }
+    uint32_t underruns() const      { return misses.load(); }
+
+private:
+    struct Phrase {
+        std::vector<SoundSpan>  spans;
+        float                   gain;
+        const VoiceTables       *voice;
+        byte                    pitch;
+    };
+
+    struct Channel {
+        BlockQueue              queue;
+        std::thread             worker;
+        std::mutex              lock;
+        std::condition_variable wake;
+        std::deque<Phrase>      phrases;
+        std::atomic<bool>       speaking;   // the worker has a phrase
+        const int16_t           *block;     // the block being played (the callback's)
+        int                     used;
+        bool                    started;    // a phrase plays, until its last block is done
+    };
+
+    void work(Channel &channel);
+    bool waitForBlock(Channel &channel, int16_t **block);
+
+    std::vector<std::unique_ptr<Channel>>   all;
+    std::atomic<bool>                       stopping;
+    std::atomic<uint32_t>                   misses;
+};
+
+#endif
@@ -0,0 +1,181 @@
+/*
+
+    MEA8000_Render.cpp
+
+    Host renderer of MEA8000 frames, see MEA8000_Render.h
+
+ */
+
+#include "MEA8000_Render.h"
+
+#include <cmath>
+
+
+#define VOICE_MAX_HZ    (MEA8000_SAMPLE_RATE / 2 - 200)
+
+
+// A formant must stay below half the sample rate
+static float voiceHz(uint16_t hz, float scale) {
+    return fminf(hz * scale, VOICE_MAX_HZ);
+}
+
+void voiceTables(byte voice, VoiceTables *tables) {
+    VoiceProfile    profile = voiceProfiles[voice < VOICES ? voice : (byte)VOICE_NORMAL];
+    float           scale   = profile.formants / 100.0f;
+
+    for (int i = 0; i < 32; i++) tables->fm1[i] = voiceHz(frameFM1Hz[i], scale);
+    for (int i = 0; i < 32; i++) tables->fm2[i] = voiceHz(frameFM2Hz[i], scale);
+    for (int i = 0; i < 8;  i++) tables->fm3[i] = voiceHz(frameFM3Hz[i], scale);
+    tables->fm4   = voiceHz(MEA8000_FM4_HZ, scale);
+    tables->pitch = profile.pitch / 100.0f;
+}
+
+void frameValues(const byte *frame, FrameValues *values, const VoiceTables *voice) {
+    if (voice) {
+        values->fm[0] = voice->fm1[frameFM1(frame)];
+        values->fm[1] = voice->fm2[frameFM2(frame)];
+        values->fm[2] = voice->fm3[frameFM3(frame)];
+        values->fm[3] = voice->fm4;
+    } else {
+        values->fm[0] = frameFM1Hz[frameFM1(frame)];
+        values->fm[1] = frameFM2Hz[frameFM2(frame)];
+        values->fm[2] = frameFM3Hz[frameFM3(frame)];
+        values->fm[3] = MEA8000_FM4_HZ;
+    }
+    values->bw[0] = frameBWHz[frameBW1(frame)];
+    values->bw[1] = frameBWHz[frameBW2(frame)];
+    values->bw[2] = frameBWHz[frameBW3(frame)];
+    values->bw[3] = frameBWHz[frameBW4(frame)];
+    values->ampl  = frameAMPLScale[frameAMPL(frame)] / 1000.0f;
+    values->noise = framePI(frame) == MEA8000_PI_NOISE;
+}
+
+float formantGain(float f, float fm, float bw) {
+    float   r   = expf(-(float)M_PI * bw / MEA8000_SAMPLE_RATE);
+    float   b   = 2 * r * cosf(2 * (float)M_PI * fm / MEA8000_SAMPLE_RATE);
+    float   c   = -r * r;
+    float   w   = 2 * (float)M_PI * f / MEA8000_SAMPLE_RATE;
+
+    // |1 - b z^-1 - c z^-2| at z = e^jw
+    float   re  = 1 - b * cosf(w) - c * cosf(2 * w);
+    float   im  = b * sinf(w) + c * sinf(2 * w);
+    return (1 - b - c) / sqrtf(re * re + im * im);
+}
+
+
+Synth::Synth() {
+    voice = NULL;
+    begin();
+}
+
+void Synth::begin(float pitch, float gain) {
+    for (int i = 0; i < 4; i++) {
+        from.fm[i] = i < 3 ? 500.0f * (2 * i + 1) : MEA8000_FM4_HZ;
+        from.bw[i] = frameBWHz[0];
+        y1[i] = y2[i] = 0;
+    }
+    from.ampl    = 0;
+    from.noise   = false;
+    currentPitch = pitch;
+    this->gain   = gain;
+    phase        = 0;
+    noise        = 1;
+}
+
+void Synth::save(SynthState *state) const {
+    for (int i = 0; i < 4; i++) {
+        state->y1[i] = y1[i];
+        state->y2[i] = y2[i];
+    }
+    state->pitch = currentPitch;
+    state->phase = phase;
+    state->noise = noise;
+}
+
+void Synth::restore(const SynthState &state, const byte *previous) {
+    for (int i = 0; i < 4; i++) {
+        y1[i] = state.y1[i];
+        y2[i] = state.y2[i];
+    }
+    currentPitch = state.pitch;
+    phase        = state.phase;
+    noise        = state.noise;
+    frameValues(previous, &from, voice);
+    from.ampl   *= gain;
+}
+
+int Synth::render(const byte *frame, float *samples) {
+    FrameValues to;
+    frameValues(frame, &to, voice);
+    to.ampl *= gain;
+
+    int     count     = MEA8000_STEP_SAMPLES * frameSteps(frame);
+    float   increment = (float)pitchIncrement(framePI(frame)) / MEA8000_STEP_SAMPLES;
+
+    for (int block = 0; block < count; block += SYNTH_BLOCK) {
+        float   t = (block + SYNTH_BLOCK / 2) / (float)count;
+        float   a [4], b [4], c [4];
+
+        for (int i = 0; i < 4; i++) {
+            float fm = from.fm[i] + (to.fm[i] - from.fm[i]) * t;
+            float bw = from.bw[i] + (to.bw[i] - from.bw[i]) * t;
+            float r  = expf(-(float)M_PI * bw / MEA8000_SAMPLE_RATE);
+            b[i] = 2 * r * cosf(2 * (float)M_PI * fm / MEA8000_SAMPLE_RATE);
+            c[i] = -r * r;
+            a[i] = 1 - b[i] - c[i];
+        }
+
+        for (int n = block; n < block + SYNTH_BLOCK; n++) {
+            float   ampl = from.ampl + (to.ampl - from.ampl) * (n + 1) / count;
+            float   x;
+
+            if (to.noise) {
+                noise = noise * 1664525u + 1013904223u;
+                x = ampl * 1.732f * ((int32_t)noise / 2147483648.0f);
+            } else {
+                float pitch  = voice ? currentPitch * voice->pitch : currentPitch;
+                float period = MEA8000_SAMPLE_RATE / (pitch > 16 ? pitch : 16);
+                x = 0;
+                if (++phase >= period) {
+                    phase -= period;
+                    x = ampl * sqrtf(period);
+                }
+                currentPitch += increment;
+            }
+
+            for (int i = 0; i < 4; i++) {
+                float y = a[i] * x + b[i] * y1[i] + c[i] * y2[i];
+                y2[i] = y1[i];
+                y1[i] = y;
+                x     = y;
+            }
+            samples[n] = x;
+        }
+    }
+    from = to;
+    return count;
+}
+
+
+std::vector<float> renderSound(const byte *data, uint16_t length, float gain, const VoiceTables *voice) {
+    SoundSpan span = { data, length };
+    return renderSounds(&span, 1, gain, voice);
+}
+
+std::vector<float> renderSounds(const SoundSpan *spans, byte count, float gain, const VoiceTables *voice, byte pitch) {
+    std::vector<float>  samples;
+    Synth               synth;
+    float               frame [SYNTH_MAX_SAMPLES];
+
+    if (!pitch) pitch = count > 0 ? soundStartPitch(spans[0].data, spans[0].length) : MEA8000_DEFAULT_PITCH;
+    synth.begin(2.0f * pitch, gain);
+    synth.setVoice(voice);
+    for (byte i = 0; i < count; i++) {
+        const byte *data = spans[i].data;
+        for (uint16_t offset = soundHeaderSize(data, spans[i].length); offset + MEA8000_FRAME_SIZE <= spans[i].length; offset += MEA8000_FRAME_SIZE) {
+            int size = synth.render(data + offset, frame);
+            samples.insert(samples.end(), frame, frame + size);
+        }
+    }
+    return samples;
+}
@@ -0,0 +1,118 @@
+/*
+
+    MEA8000_Render.h
+
+    Host (PC) renderer of MEA8000 frames to samples, for the tools: encoding,
+    comparing sounds, writing WAV files. Floating point, not for the Arduino.
+
+    It follows the chip as far as the data sheet tells: 8 kHz output, a pulse train
+    (or noise for PI 16) through 4 formant filters in a row (2-pole resonators),
+    the values of a frame are reached with a straight line from the values of the
+    frame before, over the frame's duration. The pitch changes by PI Hz every 8 ms.
+    It is close to the chip, it is not a bit exact model of it.
+
+ */
+
+#ifndef MEA8000_RENDER_H
+#define MEA8000_RENDER_H
+
+#include "../MEA8000_Tables.h"
+#include "../MEA8000_Voice.h"
+
+#include <cmath>
+#include <vector>
+
+
+#define SYNTH_MAX_SAMPLES       (8 * MEA8000_STEP_SAMPLES)      // one frame of 64 ms
+#define SYNTH_BLOCK             8                               // samples between filter updates
+#define SYNTH_PCM_SCALE         100.0f                          // samples to 16 bit (the loudest sounds peak near 14000)
+
+// A rendered sample as 16 bit PCM: times 'scale' (SYNTH_PCM_SCALE, with a gain), rounded and clipped
+inline int16_t synthPcm(float sample, float scale = SYNTH_PCM_SCALE) {
+    float value = sample * scale;
+    return value >= INT16_MAX ? INT16_MAX : value <= INT16_MIN ? INT16_MIN : (int16_t)lrintf(value);
+}
+
+
+// What a frame sounds like, in Hz and linear amplitude (0 .. 1)
+struct FrameValues {
+    float   fm [4];
+    float   bw [4];
+    float   ampl;
+    bool    noise;
+};
+
+// The frequencies of a voice (see MEA8000_Voice.h), made once by voiceTables
+struct VoiceTables {
+    float   fm1 [32];
+    float   fm2 [32];
+    float   fm3 [8];
+    float   fm4;
+    float   pitch;              // scale
+};
+
+void voiceTables(byte voice, VoiceTables *tables);
+
+// 'voice' NULL is the chip's own tables
+void frameValues(const byte *frame, FrameValues *values, const VoiceTables *voice = NULL);
+
+// Gain of one formant filter (unity at 0 Hz) at 'f' Hz
+float formantGain(float f, float fm, float bw);
+
+
+// The state of the filters and the pitch between two frames, what is needed to go on from
+// there (the values of the frame before are taken from that frame again, see Synth::restore)
+struct SynthState {
+    float       y1 [4];
+    float       y2 [4];
+    float       pitch;
+    float       phase;
+    uint32_t    noise;
+};
+
+
+class Synth {
+public:
+    Synth();
+
+    // Start of a sound, 'pitch' in Hz (2 * the header byte), 'gain' on the amplitude of every frame
+    void begin(float pitch = 2 * MEA8000_DEFAULT_PITCH, float gain = 1);
+
+    // The samples of one frame (MEA8000_STEP_SAMPLES << FD of them), returns how many
+    int  render(const byte *frame, float *samples);
+
+    // The voice to render with from now on, NULL for the normal one (kept in place by the caller)
+    void setVoice(const VoiceTables *voice)     { this->voice = voice; }
+
+    // Save the state after a frame, and go on from it: 'previous' is the frame it was saved after.
+    // The samples that follow are the same as without the save (same gain and voice).
+    void save(SynthState *state) const;
+    void restore(const SynthState &state, const byte *previous);
+
+    // The pitch of the sound, without the scale of the voice
+    float pitch() const     { return currentPitch; }
+
+private:
+    FrameValues from;           // values at the end of the frame before
+    float       y1 [4];
+    float       y2 [4];
+    float       currentPitch;
+    float       gain;
+    const VoiceTables *voice;
+    float       phase;          // samples since the last pulse
+    uint32_t    noise;
+};
+
+
+// All samples of a sound (data in memory, header pitch used if there is one)
+std::vector<float> renderSound(const byte *data, uint16_t length, float gain = 1, const VoiceTables *voice = NULL);
+
+// All samples of a list of sounds (a sentence) as one, the way SoundStream hands it to the
+// chip: the pitch of the first header (or 'pitch', Hz / 2, for trimmed sounds: soundPitch),
+// the headers of the others skipped, no copies
+std::vector<float> renderSounds(const SoundSpan *spans, byte count, float gain = 1, const VoiceTables *voice = NULL, byte pitch = 0);
+
+// The gain of a loudness correction in AMPL steps (see MEA8000_Loudness.h), 3 dB a step
+inline float loudnessGain(int steps)    { return powf(2.0f, steps / 2.0f); }
+
+#endif
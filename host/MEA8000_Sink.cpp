@@ -0,0 +1,135 @@
+/*
+
+    MEA8000_Sink.cpp
+
+    Where the rendered samples go, see MEA8000_Sink.h
+
+ */
+
+#include "MEA8000_Sink.h"
+#include "MEA8000_Wav.h"
+
+#include <cstring>
+
+
+// -- the buffer --------------------------------------------------------------------
+
+AudioSink::AudioSink() : buffer(new int16_t[SINK_BUFFER]), used(0), total(0), error(false), finished(false) {
+}
+
+AudioSink::~AudioSink() {
+    delete[] buffer;
+}
+
+bool AudioSink::flush() {
+    if (used == 0) return !error;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (size_t i = 0; i < used; i++) buffer[i] = (int16_t)__builtin_bswap16((uint16_t)buffer[i]);
+#endif
+    if (!error && !output(buffer, used)) error = true;
+    total += used;
+    used   = 0;
+    return !error;
+}
+
+int16_t *AudioSink::reserve(size_t count) {
+    if (used + count > SINK_BUFFER) flush();
+    return buffer + used;
+}
+
+bool AudioSink::write(const float *samples, size_t count, float scale) {
+    while (count > 0) {
+        size_t  part = count < SINK_BUFFER ? count : SINK_BUFFER;
+        int16_t *out = reserve(part);
+
+        for (size_t i = 0; i < part; i++) out[i] = synthPcm(samples[i], scale);
+        commit(part);
+        samples += part;
+        count   -= part;
+    }
+    return !error;
+}
+
+bool AudioSink::write(const int16_t *samples, size_t count) {
+    while (count > 0) {
+        size_t part = count < SINK_BUFFER ? count : SINK_BUFFER;
+        memcpy(reserve(part), samples, part * sizeof(int16_t));
+        commit(part);
+        samples += part;
+        count   -= part;
+    }
+    return !error;
+}
+
+bool AudioSink::finish() {
+    if (finished) return !error;
+    finished = true;
+    flush();
+    if (!close()) error = true;
+    return !error;
+}
+
+
+// -- the sinks ---------------------------------------------------------------------
+
+WavSink::WavSink(const char *fileName, int rate) : file(fopen(fileName, "wb")), rate(rate), name(fileName) {
+    if (!file) {
+        fprintf(stderr, "Can't write %s\n", fileName);
+        fail();
+        return;
+    }
+    writeWavHeader(file, rate, 0);          // made again at the end, with the size
+}
+
+bool WavSink::output(const int16_t *samples, size_t count) {
+    return file && fwrite(samples, sizeof(int16_t), count, file) == count;
+}
+
+bool WavSink::close() {
+    if (!file) return false;
+
+    fseek(file, 0, SEEK_SET);
+    writeWavHeader(file, rate, (uint32_t)samples());
+    bool ok = !ferror(file);
+    if (fclose(file) != 0) ok = false;
+    file = NULL;
+    if (!ok) fprintf(stderr, "Can't write %s\n", name.c_str());
+    return ok;
+}
+
+
+RawSink::RawSink(const char *fileName) : file(strcmp(fileName, "-") ? fopen(fileName, "wb") : stdout) {
+    if (!file) {
+        fprintf(stderr, "Can't write %s\n", fileName);
+        fail();
+    }
+}
+
+bool RawSink::output(const int16_t *samples, size_t count) {
+    return file && fwrite(samples, sizeof(int16_t), count, file) == count;
+}
+
+bool RawSink::close() {
+    if (!file) return false;
+    bool ok = file == stdout ? fflush(file) == 0 : fclose(file) == 0;
+    file = NULL;
+    return ok;
+}
+
+
+AudioSink *openSink(const char *text) {
+    AudioSink *sink = NULL;
+
+    if      (!strcmp(text, "null"))         sink = new NullSink();
+    else if (!strncmp(text, "wav:", 4))     sink = new WavSink(text + 4);
+    else if (!strncmp(text, "raw:", 4))     sink = new RawSink(text + 4);
+    else {
+        fprintf(stderr, "%s: not a sink (null, wav:<file> or raw:<file>)\n", text);
+        return NULL;
+    }
+    if (sink->failed()) {
+        delete sink;
+        return NULL;
+    }
+    return sink;
+}
@@ -0,0 +1,105 @@
+/*
+
+    MEA8000_Sink.h
+
+    Where the rendered samples go: an AudioSink takes 16 bit samples in a buffer that is
+    made once (SINK_BUFFER samples) and writes it out a full buffer at a time.
+
+    - NullSink drops them, to time the rendering alone.
+    - WavSink writes a WAV file (the header is made right at the end).
+    - RawSink writes raw PCM (16 bit, little endian, mono) to a file or a pipe, "-" is
+      stdout: ./renderbench -s raw:- | aplay -f S16_LE -r 8000
+
+    Samples are written straight into the buffer: write() scales the renderer's floats
+    (SYNTH_PCM_SCALE) into it, or reserve() / commit() give the place to write to.
+
+ */
+
+#ifndef MEA8000_SINK_H
+#define MEA8000_SINK_H
+
+#include "MEA8000_Render.h"
+
+#include <cstdio>
+#include <string>
+
+
+#define SINK_BUFFER     32768       // samples (64 kB)
+
+
+class AudioSink {
+public:
+    AudioSink();
+    virtual ~AudioSink();
+
+    // Room for 'count' samples (at most SINK_BUFFER) to be written in place, then commit them
+    int16_t *reserve(size_t count);
+    void     commit(size_t count)       { used += count; }
+
+    // Rendered samples, scaled to 16 bit and clipped
+    bool write(const float *samples, size_t count, float scale = SYNTH_PCM_SCALE);
+    bool write(const int16_t *samples, size_t count);
+
+    // Writes what is left and closes, false if anything went wrong
+    bool finish();
+
+    uint64_t samples() const            { return total + used; }
+    bool     failed() const             { return error; }
+
+protected:
+    // A full buffer (or the rest at the end)
+    virtual bool output(const int16_t *samples, size_t count) = 0;
+    virtual bool close()                { return true; }
+
+    void fail()                         { error = true; }
+
+private:
+    bool flush();
+
+    int16_t     *buffer;
+    size_t      used;
+    uint64_t    total;
+    bool        error;
+    bool        finished;
+};
+
+
+class NullSink : public AudioSink {
+public:
+    ~NullSink()                         { finish(); }
+protected:
+    bool output(const int16_t *, size_t) { return true; }
+};
+
+
+class WavSink : public AudioSink {
+public:
+    WavSink(const char *fileName, int rate = MEA8000_SAMPLE_RATE);
+    ~WavSink()                          { finish(); }
+protected:
+    bool output(const int16_t *samples, size_t count);
+    bool close();
+private:
+    FILE        *file;
+    int         rate;
+    std::string name;
+};
+
+
+class RawSink : public AudioSink {
+public:
+    RawSink(const char *fileName);      // "-" is stdout
+    ~RawSink()                          { finish(); }
+protected:
+    bool output(const int16_t *samples, size_t count);
+    bool close();
+private:
+    FILE        *file;
+};
+
+
+// A sink from a description: "null", "wav:<file>" or "raw:<file>" ("raw:-" is stdout).
+// NULL (with a message on stderr) when it can't be made.
+AudioSink *openSink(const char *text);
+
+#endif
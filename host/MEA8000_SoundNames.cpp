@@ -0,0 +1,722 @@
+/*
+
+    MEA8000_SoundNames.cpp
+
+    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.
+
+ */
+
+#include "MEA8000_SoundNames.h"
+
+
+const char *const soundNames [SOUND_COUNT] = {
+    "NoSound",
+    "Sound_a",
+    "Sound_e",
+    "Sound_i",
+    "Sound_oo",
+    "Sound_u",
+    "Sound_eh",
+    "Sound_ee",
+    "Sound_oh",
+    "Sound_w",
+    "Sound_A",
+    "Sound_I",
+    "Sound_O",
+    "Sound_W",
+    "Sound_b",
+    "Sound_d",
+    "Sound_f",
+    "Sound_g",
+    "Sound_j",
+    "Sound_k",
+    "Sound_l",
+    "Sound_m",
+    "Sound_n",
+    "Sound_p",
+    "Sound_R",
+    "Sound_r",
+    "Sound_s",
+    "Sound_t",
+    "Sound_v",
+    "Sound_z",
+    "Sound_ch",
+    "Sound_N",
+    "Sound_ai",
+    "Sound_ej",
+    "Sound_ui",
+    "Sound_ie",
+    "Sound_oi",
+    "Sound_o",
+    "Sound_Alpha",
+    "Sound_Bravo",
+    "Sound_Charlie",
+    "Sound_Delta",
+    "Sound_Echo",
+    "Sound_Foxtrot",
+    "Sound_Golf",
+    "Sound_Hotel",
+    "Sound_India",
+    "Sound_Juliet",
+    "Sound_Kilo",
+    "Sound_Lima",
+    "Sound_Michael",
+    "Sound_November",
+    "Sound_Oscar",
+    "Sound_Papa",
+    "Sound_Quebec",
+    "Sound_Romeo",
+    "Sound_Sierra",
+    "Sound_Tango",
+    "Sound_Uniform",
+    "Sound_Victor",
+    "Sound_Whisky",
+    "Sound_X_ray",
+    "Sound_Yankee",
+    "Sound_Zulu",
+    "Sound_hooo",
+    "Sound_ho",
+    "Sound_h",
+    "Sound_hu",
+    "Sound_he",
+    "Sound_ha",
+    "Sound_ZerOO",
+    "Sound_One",
+    "Sound_Two",
+    "Sound_Three",
+    "Sound_Four",
+    "Sound_Five",
+    "Sound_Six",
+    "Sound_Seven",
+    "Sound_Eight",
+    "Sound_Nine",
+    "Sound_Ten",
+    "Sound_Eleven",
+    "Sound_Twelve",
+    "Sound_Thir_",
+    "Sound_Four_",
+    "Sound_Fif_",
+    "Sound__teen",
+    "Sound_Twen_",
+    "Sound__ty",
+    "Sound_Hundred",
+    "Sound_Telephone",
+    "Sound_Number",
+    "Sound_Code",
+    "Sound_And",
+    "Sound_C2_A",
+    "Sound_C2_ACCOLADE",
+    "Sound_C2_AIMER",
+    "Sound_C2_ALLER",
+    "Sound_C2_ALORS",
+    "Sound_C2_AMI",
+    "Sound_C2_ANIMAL",
+    "Sound_C2_ANIMAUX",
+    "Sound_C2_ANNEE",
+    "Sound_C2_ANNIVERSAIRE",
+    "Sound_C2_ANTI",
+    "Sound_C2_APPRENDRE",
+    "Sound_C2_APPUI",
+    "Sound_C2_APRES",
+    "Sound_C2_ARRET",
+    "Sound_C2_ASSEZ",
+    "Sound_C2_ASSIETTE",
+    "Sound_C2_ASTERISQUE",
+    "Sound_C2_AU",
+    "Sound_C2_AUSSI",
+    "Sound_C2_AVANT",
+    "Sound_C2_AVOIR",
+    "Sound_C2_B",
+    "Sound_C2_BARRE",
+    "Sound_C2_BAS",
+    "Sound_C2_BIEN",
+    "Sound_C2_BLOCAGE",
+    "Sound_C2_BOIRE",
+    "Sound_C2_BON",
+    "Sound_C2_BONJOUR",
+    "Sound_C2_BONNE",
+    "Sound_C2_BRAVO",
+    "Sound_C2_C_EST",
+    "Sound_C2_C_ETAIT",
+    "Sound_C2_C",
+    "Sound_C2_CALCUL",
+    "Sound_C2_CE",
+    "Sound_C2_CECI",
+    "Sound_C2_CHIFFRE",
+    "Sound_C2_CHOISI",
+    "Sound_C2_CHOIX",
+    "Sound_C2_CLASSE",
+    "Sound_C2_CLAVIER",
+    "Sound_C2_CLEF",
+    "Sound_C2_COMBIEN",
+    "Sound_C2_COMME",
+    "Sound_C2_COMMERCIAL",
+    "Sound_C2_COMPRENDRE",
+    "Sound_C2_COMPTER",
+    "Sound_C2_CONNAITRE",
+    "Sound_C2_COPIE",
+    "Sound_C2_CORRESPONDANTE",
+    "Sound_C2_COTEE",
+    "Sound_C2_COULEUR",
+    "Sound_C2_CRAYON",
+    "Sound_C2_CROCHET",
+    "Sound_C2_CURSEUR",
+    "Sound_C2_D_",
+    "Sound_C2_D",
+    "Sound_C2_DANS",
+    "Sound_C2_DE",
+    "Sound_C2_DEBUT",
+    "Sound_C2_DEJA",
+    "Sound_C2_DELETE",
+    "Sound_C2_DEMANDER",
+    "Sound_C2_DEMI",
+    "Sound_C2_DES",
+    "Sound_C2_DESIRER",
+    "Sound_C2_DIEZE",
+    "Sound_C2_DIFFICILE",
+    "Sound_C2_DIRE",
+    "Sound_C2_DIRIGE",
+    "Sound_C2_DO",
+    "Sound_C2_DOLLARD",
+    "Sound_C2_DONC",
+    "Sound_C2_DONNE",
+    "Sound_C2_DROITE",
+    "Sound_C2_DU",
+    "Sound_C2_E",
+    "Sound_C2_ECOUTE",
+    "Sound_C2_ECOUTEUR",
+    "Sound_C2_ECRAN",
+    "Sound_C2_ECRIS",
+    "Sound_C2_EFFACE",
+    "Sound_C2_EGAL",
+    "Sound_C2_ELLE",
+    "Sound_C2_EN",
+    "Sound_C2_ENCORE",
+    "Sound_C2_ENFANT",
+    "Sound_C2_ENTER",
+    "Sound_C2_ESCAPE",
+    "Sound_C2_ESPACE",
+    "Sound_C2_ESSAY",
+    "Sound_C2_EST",
+    "Sound_C2_EST_CE",
+    "Sound_C2_ET",
+    "Sound_C2_ETRE",
+    "Sound_C2_EU",
+    "Sound_C2_EXACTE",
+    "Sound_C2_EXCLAMATION",
+    "Sound_C2_EXEMPLE",
+    "Sound_C2_EXERCICE",
+    "Sound_C2_F",
+    "Sound_C2_FACILE",
+    "Sound_C2_FAIRE",
+    "Sound_C2_FAIS",
+    "Sound_C2_FEMME",
+    "Sound_C2_FLECHE",
+    "Sound_C2_FOIS",
+    "Sound_C2_FONCTION",
+    "Sound_C2_FRANC",
+    "Sound_C2_G",
+    "Sound_C2_GAUCHE",
+    "Sound_C2_GRAND",
+    "Sound_C2_GUILLEMET",
+    "Sound_C2_H",
+    "Sound_C2_HA_NOM",
+    "Sound_C2_I",
+    "Sound_C2_IL",
+    "Sound_C2_INEXACTE",
+    "Sound_C2_INFERIEUR",
+    "Sound_C2_INTERROGATION",
+    "Sound_C2_J",
+    "Sound_C2_JAMAIS",
+    "Sound_C2_JE",
+    "Sound_C2_JOUR",
+    "Sound_C2_JOYSTICK",
+    "Sound_C2_JUSTE",
+    "Sound_C2_K",
+    "Sound_C2_L_",
+    "Sound_C2_L_ECRAN",
+    "Sound_C2_L",
+    "Sound_C2_LA_BAS",
+    "Sound_C2_LA",
+    "Sound_C2_LE",
+    "Sound_C2_LES",
+    "Sound_C2_LEUR",
+    "Sound_C2_LIVRE",
+    "Sound_C2_M",
+    "Sound_C2_MA",
+    "Sound_C2_MADAME",
+    "Sound_C2_MAINTENANT",
+    "Sound_C2_MAIS",
+    "Sound_C2_MAISON",
+    "Sound_C2_MAJUSCULE",
+    "Sound_C2_MANETTE",
+    "Sound_C2_MATIN",
+    "Sound_C2_ME",
+    "Sound_C2_MERCI",
+    "Sound_C2_MES",
+    "Sound_C2_MESDAMES",
+    "Sound_C2_MESSIEURS",
+    "Sound_C2_MET",
+    "Sound_C2_METTRE",
+    "Sound_C2_MI",
+    "Sound_C2_MIDI",
+    "Sound_C2_MIEN",
+    "Sound_C2_MIEUX",
+    "Sound_C2_MOI",
+    "Sound_C2_MOINS",
+    "Sound_C2_MON",
+    "Sound_C2_MONSIEUR",
+    "Sound_C2_MOYEN",
+    "Sound_C2_MOT",
+    "Sound_C2_N",
+    "Sound_C2_NE",
+    "Sound_C2_NOMBRE",
+    "Sound_C2_NOM",
+    "Sound_C2_NOS",
+    "Sound_C2_NOTE",
+    "Sound_C2_NOTRE",
+    "Sound_C2_NOUS",
+    "Sound_C2_NUMERO",
+    "Sound_C2_O",
+    "Sound_C2_ON",
+    "Sound_C2_OPTIQUE",
+    "Sound_C2_OR",
+    "Sound_C2_OU",
+    "Sound_C2_OUI",
+    "Sound_C2_P",
+    "Sound_C2_PARENTHESE",
+    "Sound_C2_PARFAIT",
+    "Sound_C2_PARLER",
+    "Sound_C2_PASSER",
+    "Sound_C2_PENSER",
+    "Sound_C2_PETIT",
+    "Sound_C2_PEUT_ETRE",
+    "Sound_C2_PLUS",
+    "Sound_C2_POIGNEE",
+    "Sound_C2_POINT",
+    "Sound_C2_POSITIONNE",
+    "Sound_C2_POUR",
+    "Sound_C2_POUR_CENT",
+    "Sound_C2_PREMIER",
+    "Sound_C2_PRENDRE",
+    "Sound_C2_PRENOM",
+    "Sound_C2_PROBLEME",
+    "Sound_C2_PUIS",
+    "Sound_C2_PUISSANCE",
+    "Sound_C2_Q",
+    "Sound_C2_QU_",
+    "Sound_C2_QU_EST_CE",
+    "Sound_C2_QUAND",
+    "Sound_C2_QUE",
+    "Sound_C2_QUEL",
+    "Sound_C2_QUELQUE",
+    "Sound_C2_QUESTION",
+    "Sound_C2_QUI",
+    "Sound_C2_QU_IL",
+    "Sound_C2_QUOI",
+    "Sound_C2_R",
+    "Sound_C2_RE",
+    "Sound_C2_RECOMMENCE",
+    "Sound_C2_REGARDE",
+    "Sound_C2_REPONSE",
+    "Sound_C2_RESULTAT",
+    "Sound_C2_RIEN",
+    "Sound_C2_S",
+    "Sound_C2_SA",
+    "Sound_C2_SANS",
+    "Sound_C2_SAVOIR",
+    "Sound_C2_SCORE",
+    "Sound_C2_SE",
+    "Sound_C2_SELECTIONNEE",
+    "Sound_C2_SES",
+    "Sound_C2_SI",
+    "Sound_C2_SI_NOTE_",
+    "Sound_C2_SIEN",
+    "Sound_C2_SIMPLE",
+    "Sound_C2_SLASH",
+    "Sound_C2_SOIR",
+    "Sound_C2_SOL",
+    "Sound_C2_SOLUTION",
+    "Sound_C2_SON",
+    "Sound_C2_SUITE",
+    "Sound_C2_SUPERIEUR",
+    "Sound_C2_SUR",
+    "Sound_C2_T",
+    "Sound_C2_TA",
+    "Sound_C2_TE",
+    "Sound_C2_TEMPS",
+    "Sound_C2_TES",
+    "Sound_C2_TIEN",
+    "Sound_C2_TIRET",
+    "Sound_C2_TOI",
+    "Sound_C2_TON",
+    "Sound_C2_TOUJOURS",
+    "Sound_C2_TOUT",
+    "Sound_C2_TRES",
+    "Sound_C2_TROUVER",
+    "Sound_C2_TU",
+    "Sound_C2_T_UN",
+    "Sound_C2_T_UNE",
+    "Sound_C2_U",
+    "Sound_C2_UN",
+    "Sound_C2_UNE",
+    "Sound_C2_V",
+    "Sound_C2_VALIDATION",
+    "Sound_C2_VENIR",
+    "Sound_C2_VENT",
+    "Sound_C2_VIRGULE",
+    "Sound_C2_VOICI",
+    "Sound_C2_VOILA",
+    "Sound_C2_VOIR",
+    "Sound_C2_VOS",
+    "Sound_C2_VOTRE",
+    "Sound_C2_VOUS",
+    "Sound_C2_VRAIMENT",
+    "Sound_C2_W",
+    "Sound_C2_X",
+    "Sound_C2_Y",
+    "Sound_C2_Z",
+    "Sound_C2_ZERO_NR",
+    "Sound_C2_UN_NR",
+    "Sound_C2_DEUX_NR",
+    "Sound_C2_TROIS_NR",
+    "Sound_C2_QUATRE_NR",
+    "Sound_C2_CINQ_NR",
+    "Sound_C2_CIN_CENT_NR",
+    "Sound_C2_SIX_NR",
+    "Sound_C2_SI_CENT_NR",
+    "Sound_C2_SEPT_NR",
+    "Sound_C2_HUIT_NR",
+    "Sound_C2_HUI_CENT_NR",
+    "Sound_C2_NEUF_NR",
+    "Sound_C2_DIX_NR",
+    "Sound_C2_DI_MILLE_NR",
+    "Sound_C2_ONZE_NR_ugly",
+    "Sound_C2_ONZE_NR",
+    "Sound_C2_DOUZE_NR",
+    "Sound_C2_TREIZE_NR",
+    "Sound_C2_QUATORZE_NR",
+    "Sound_C2_QUINZE_NR",
+    "Sound_C2_SEIZE_NR",
+    "Sound_C2_DIX_SEPT_NR",
+    "Sound_C2_DIX_HUIT",
+    "Sound_C2_DIX_HUI_MILLE_NR",
+    "Sound_C2_DIX_NEUF_NR",
+    "Sound_C2_VINGT_NR",
+    "Sound_C2_VIN_MILLE_NR",
+    "Sound_C2_TRENTE_NR",
+    "Sound_C2_QUARANTE_NR",
+    "Sound_C2_CINQUANTE_NR",
+    "Sound_C2_SOIXANTE_NR",
+    "Sound_C2_QUATRE_VINGT_NR",
+    "Sound_C2_CENT_NR",
+    "Sound_C2_MILLE_NR",
+    "Sound_C2_MILLION_NR",
+    "Sound_C2_ET_UN_NR",
+    "Sound_C2_ET_NR",
+    "Sound_C3_ADDITIONNE",
+    "Sound_C3_AFFICHE",
+    "Sound_C3_AJOUTE",
+    "Sound_C3_ALPHABET",
+    "Sound_C3_ANALYSE",
+    "Sound_C3_ATTENTION",
+    "Sound_C3_BEBE",
+    "Sound_C3_BONHOMME",
+    "Sound_C3_CORRECTION",
+    "Sound_C3_COUSIN",
+    "Sound_C3_DIMINUE",
+    "Sound_C3_ENFANT",
+    "Sound_C3_EVITE",
+    "Sound_C3_FAMILLE",
+    "Sound_C3_FREINE",
+    "Sound_C3_LENTEMENT",
+    "Sound_C3_LIGNE",
+    "Sound_C3_LIT",
+    "Sound_C3_MAMAN",
+    "Sound_C3_MERE",
+    "Sound_C3_MULTIPILIE",
+    "Sound_C3_OBSTACLE",
+    "Sound_C3_ONCLE",
+    "Sound_C3_ORTHOGRAPHE",
+    "Sound_C3_PAPA",
+    "Sound_C3_PARENT",
+    "Sound_C3_PERE",
+    "Sound_C3_PLACE",
+    "Sound_C3_RECOMMENCE",
+    "Sound_C3_RECULE",
+    "Sound_C3_SOEUR",
+    "Sound_C3_SOUSTRAIT",
+    "Sound_C3_SYNTHESE",
+    "Sound_C3_TANTE",
+    "Sound_C3_AUTO",
+    "Sound_C3_AUTOBUS",
+    "Sound_C3_AVION",
+    "Sound_C3_BAS",
+    "Sound_C3_BATEAU",
+    "Sound_C3_CAMPINGCAR",
+    "Sound_C3_CAR",
+    "Sound_C3_CARRE",
+    "Sound_C3_CENTIME",
+    "Sound_C3_CERCLE",
+    "Sound_C3_ELECTRICITE",
+    "Sound_C3_FENETRE",
+    "Sound_C3_FRANC",
+    "Sound_C3_GARE",
+    "Sound_C3_HAUT",
+    "Sound_C3_HELICOPTERE",
+    "Sound_C3_HEURE",
+    "Sound_C3_KILO",
+    "Sound_C3_L_",
+    "Sound_C3_LA",
+    "Sound_C3_LE",
+    "Sound_C3_LES",
+    "Sound_C3_LUMIERE",
+    "Sound_C3_METRE",
+    "Sound_C3_METRO",
+    "Sound_C3_MINUTE",
+    "Sound_C3_MUR",
+    "Sound_C3_PIECE",
+    "Sound_C3_PLANCHER",
+    "Sound_C3_PORTE",
+    "Sound_C3_RECTANGLE",
+    "Sound_C3_TABLE",
+    "Sound_C3_TAXI",
+    "Sound_C3_TELEPHONE",
+    "Sound_C3_TELEVISION",
+    "Sound_C3_TONNE",
+    "Sound_C3_TRAIN",
+    "Sound_C3_TRIANGLE",
+    "Sound_C3_UN",
+    "Sound_C3_UNE",
+    "Sound_C3_UNE_",
+    "Sound_C3_VETEMENT",
+    "Sound_C3_VOITURE",
+    "Sound_C3_ANE",
+    "Sound_C3_BANQUE",
+    "Sound_C3_BOITE_DE_NUIT",
+    "Sound_C3_BOUCHE",
+    "Sound_C3_BRAS",
+    "Sound_C3_BUREAU_DE_POSTE",
+    "Sound_C3_CANARD",
+    "Sound_C3_CENTRE_COMMERCIAL",
+    "Sound_C3_CHAT",
+    "Sound_C3_CHEVAL",
+    "Sound_C3_CHEVEUX",
+    "Sound_C3_CHIEN",
+    "Sound_C3_DENTISTE",
+    "Sound_C3_DOIGT",
+    "Sound_C3_GRENOUILLE",
+    "Sound_C3_HOPITAL",
+    "Sound_C3_JAMBE",
+    "Sound_C3_MAIN",
+    "Sound_C3_MEDECIN",
+    "Sound_C3_NEZ",
+    "Sound_C3_OPTICIEN",
+    "Sound_C3_OREILLE",
+    "Sound_C3_PAPETERIE",
+    "Sound_C3_PHARMACIE",
+    "Sound_C3_PIED",
+    "Sound_C3_POULE",
+    "Sound_C3_SALON_DE_COIFFURE",
+    "Sound_C3_STATION_SERVICE",
+    "Sound_C3_TABAC",
+    "Sound_C3_TETE",
+    "Sound_C3_VACHE",
+    "Sound_C3_VITRINE",
+    "Sound_C3_ARMOIRE",
+    "Sound_C3_BAIGNOIRE",
+    "Sound_C3_BALAIS",
+    "Sound_C3_BIBERON",
+    "Sound_C3_BOUCHON",
+    "Sound_C3_BOUTEILLE",
+    "Sound_C3_CARAFE",
+    "Sound_C3_CASSEROLE",
+    "Sound_C3_CHAISE",
+    "Sound_C3_CHAMBRE",
+    "Sound_C3_CLEF",
+    "Sound_C3_COMPTEUR",
+    "Sound_C3_CUISINE",
+    "Sound_C3_CUISINIERE",
+    "Sound_C3_ECLAIRAGE",
+    "Sound_C3_EPONGE",
+    "Sound_C3_EVIER",
+    "Sound_C3_FAUTEUIL",
+    "Sound_C3_GARAGE",
+    "Sound_C3_INTERRUPTEUR",
+    "Sound_C3_LAMPE",
+    "Sound_C3_LAVABO",
+    "Sound_C3_LAVE_VAISSEILE",
+    "Sound_C3_LINGE",
+    "Sound_C3_MACHINE_A_LAVER_LE_LINGE_A",
+    "Sound_C3_MACHINE_A_LAVER_LE_LINGE_B",
+    "Sound_C3_MAISON",
+    "Sound_C3_NAPPE",
+    "Sound_C3_OUVRE_BOITE",
+    "Sound_C3_PELLE",
+    "Sound_C3_PLACARD",
+    "Sound_C3_PLAFOND",
+    "Sound_C3_PLAT",
+    "Sound_C3_POELE",
+    "Sound_C3_POUBELLE",
+    "Sound_C3_RADIATEUR",
+    "Sound_C3_REFRIGERATEUR",
+    "Sound_C3_RIDEAU",
+    "Sound_C3_ROBINET",
+    "Sound_C3_SALADIER",
+    "Sound_C3_SALLE_A_MANGER",
+    "Sound_C3_SALLE_DE_BAIN",
+    "Sound_C3_SALON",
+    "Sound_C3_SERPILLIERE",
+    "Sound_C3_SERVIETTE",
+    "Sound_C3_SOL",
+    "Sound_C3_TAPIS",
+    "Sound_C3_TIRE_BOUCHON",
+    "Sound_C3_TOILETTE",
+    "Sound_C3_TOIT",
+    "Sound_C3_VAISSELLE",
+    "Sound_C3_VOLET",
+    "Sound_C3_AVEC",
+    "Sound_C3_CEINTURE",
+    "Sound_C3_CHAPEAU",
+    "Sound_C3_CHAUSSETTE",
+    "Sound_C3_CHAUSSURE",
+    "Sound_C3_CHEMISE",
+    "Sound_C3_CHEMISE_DE_NUIT",
+    "Sound_C3_CUBE",
+    "Sound_C3_CUILLERE",
+    "Sound_C3_CUILLERE_A_DESSERT",
+    "Sound_C3_CUILLERE_A_SOUPE",
+    "Sound_C3_DERRIERE",
+    "Sound_C3_DEVANT",
+    "Sound_C3_DISTANCE",
+    "Sound_C3_GANT",
+    "Sound_C3_GILET",
+    "Sound_C3_GRANDEUR",
+    "Sound_C3_HAUTEUR",
+    "Sound_C3_IMPERMEABLE",
+    "Sound_C3_JUPE",
+    "Sound_C3_LARGEUR",
+    "Sound_C3_LOIN_DE",
+    "Sound_C3_LONGUEUR",
+    "Sound_C3_MANTEAU",
+    "Sound_C3_PAIRE_DE_LUNETTE",
+    "Sound_C3_PANTALON",
+    "Sound_C3_PARAPLUIE",
+    "Sound_C3_PIJAMA",
+    "Sound_C3_POIDS",
+    "Sound_C3_PRES_DE",
+    "Sound_C3_PROFONDEUR",
+    "Sound_C3_PULLOVER",
+    "Sound_C3_ROBE_DE_CHAMBRE",
+    "Sound_C3_SHORT",
+    "Sound_C3_SOUS_VETEMENT",
+    "Sound_C3_SURFACE",
+    "Sound_C3_TABLIER",
+    "Sound_C3_VERRE",
+    "Sound_C3_VESTE",
+    "Sound_C3_VOLUME",
+    "Sound_C3_ABRICOT",
+    "Sound_C3_AUTOROUTE",
+    "Sound_C3_BANANE",
+    "Sound_C3_BEEFSTEAK",
+    "Sound_C3_BIERE",
+    "Sound_C3_BLANC",
+    "Sound_C3_BLEU",
+    "Sound_C3_BOEUF",
+    "Sound_C3_CAFE",
+    "Sound_C3_CAMPAGNE",
+    "Sound_C3_CHOCOLAT",
+    "Sound_C3_CITRON",
+    "Sound_C3_CLEMENTINE",
+    "Sound_C3_CORNICHON",
+    "Sound_C3_ESCARGOT",
+    "Sound_C3_FLEUVE",
+    "Sound_C3_FRAISE",
+    "Sound_C3_FROMAGE",
+    "Sound_C3_GATEAU",
+    "Sound_C3_HUITRE",
+    "Sound_C3_JAMBON",
+    "Sound_C3_LAIT",
+    "Sound_C3_MARRON",
+    "Sound_C3_MER",
+    "Sound_C3_MONTAGNE",
+    "Sound_C3_MOULE",
+    "Sound_C3_MOUTARDE",
+    "Sound_C3_MOUTON",
+    "Sound_C3_NOIR",
+    "Sound_C3_OEUF",
+    "Sound_C3_OLIVE",
+    "Sound_C3_ORANGE",
+    "Sound_C3_PAIN",
+    "Sound_C3_PAMPLEMOUSSE",
+    "Sound_C3_PATE",
+    "Sound_C3_PECHE",
+    "Sound_C3_PLAGE",
+    "Sound_C3_POIRE",
+    "Sound_C3_POMME",
+    "Sound_C3_PORC",
+    "Sound_C3_POULET",
+    "Sound_C3_PRUNE",
+    "Sound_C3_RAISIN",
+    "Sound_C3_RIVIERE",
+    "Sound_C3_RIZ",
+    "Sound_C3_ROSEE",
+    "Sound_C3_ROUTE",
+    "Sound_C3_SAUCE",
+    "Sound_C3_SUCRE",
+    "Sound_C3_THE",
+    "Sound_C3_TOMATE",
+    "Sound_C3_VEAU",
+    "Sound_C3_VERT",
+    "Sound_C3_VILLAGE",
+    "Sound_C3_VILLE",
+    "Sound_C3_VINAIGRE",
+    "Sound_C3_VIOLET",
+    "Sound_C3_VIRAGE",
+    "Sound_C3_YAOURT",
+    "Sound_C3_ADDITION",
+    "Sound_C3_ALPHABETIQUE",
+    "Sound_C3_ALPHANUMERIQUE",
+    "Sound_C3_AOUT",
+    "Sound_C3_APPREND",
+    "Sound_C3_AUGMENTE",
+    "Sound_C3_AVRIL",
+    "Sound_C3_CASSETTE",
+    "Sound_C3_COULEUR",
+    "Sound_C3_DECEMBRE",
+    "Sound_C3_DEPLACE",
+    "Sound_C3_DISQUETTE",
+    "Sound_C3_DIVISION",
+    "Sound_C3_EXPLICATION",
+    "Sound_C3_FEVRIER",
+    "Sound_C3_FICHE",
+    "Sound_C3_INDEX",
+    "Sound_C3_JANVIER",
+    "Sound_C3_JUILLET",
+    "Sound_C3_JUIN",
+    "Sound_C3_LECTEUR",
+    "Sound_C3_MAGNETOPHONE",
+    "Sound_C3_MAI",
+    "Sound_C3_MARS",
+    "Sound_C3_MOIS",
+    "Sound_C3_MONITEUR",
+    "Sound_C3_MONOCHROME",
+    "Sound_C3_MULTIPLICATION",
+    "Sound_C3_NOVEMBRE",
+    "Sound_C3_NUMERIQUE",
+    "Sound_C3_OCTOBRE",
+    "Sound_C3_REGARDE",
+    "Sound_C3_REGLE",
+    "Sound_C3_RETENUE",
+    "Sound_C3_RETIENT",
+    "Sound_C3_SEMAINE",
+    "Sound_C3_SEPTEMBRE",
+    "Sound_C3_SON",
+    "Sound_C3_SUIS",
+    "Sound_C3_TRAVAIL",
+    "Sound_C3_VOLUME_2",
+    "Sound_OMELETTE",
+    "Sound_INTRO_MEA8000_P1",
+    "Sound_INTRO_MEA8000_P2",
+    "Sound_INTRO_MEA8000_P3",
+};
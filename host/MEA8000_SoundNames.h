@@ -0,0 +1,29 @@
+/*
+
+    MEA8000_SoundNames.h
+
+    The names of the sounds by id ("Sound_C2_BONJOUR"), for the host tools.
+    Not for the Arduino, the names would take about 12 kB of Flash.
+
+ */
+
+#ifndef MEA8000_SOUNDNAMES_H
+#define MEA8000_SOUNDNAMES_H
+
+#include "../MEA8000_Catalog.h"
+
+#include <cstring>
+
+
+extern const char *const soundNames [SOUND_COUNT];
+
+// The id of the sound 'name' (with or without "Sound_"), SOUND_NONE if there is none
+inline uint16_t soundId(const char *name) {
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        const char *known = soundNames[id];
+        if (!strcmp(known, name) || (!strncmp(known, "Sound_", 6) && !strcmp(known + 6, name))) return id;
+    }
+    return SOUND_NONE;
+}
+
+#endif
@@ -0,0 +1,125 @@
+/*
+
+    MEA8000_Wav.cpp
+
+    Reading and writing of WAV files, see MEA8000_Wav.h
+
+ */
+
+#include "MEA8000_Wav.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+
+static uint32_t readLE(const unsigned char *bytes, int count) {
+    uint32_t value = 0;
+    for (int i = count - 1; i >= 0; i--) value = (value << 8) | bytes[i];
+    return value;
+}
+
+static void writeLE(FILE *file, uint32_t value, int count) {
+    for (int i = 0; i < count; i++, value >>= 8) fputc(value & 0xFF, file);
+}
+
+bool readWav(const char *fileName, std::vector<float> &samples, int *rate) {
+    FILE            *file = fopen(fileName, "rb");
+    unsigned char   header [12];
+    int             channels = 0, bits = 0;
+    bool            format = false;
+
+    if (!file) {
+        fprintf(stderr, "Can't open %s\n", fileName);
+        return false;
+    }
+    if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        fprintf(stderr, "%s is not a WAV file\n", fileName);
+        fclose(file);
+        return false;
+    }
+
+    unsigned char chunk [8];
+    while (fread(chunk, 1, 8, file) == 8) {
+        uint32_t size = readLE(chunk + 4, 4);
+
+        if (!memcmp(chunk, "fmt ", 4)) {
+            unsigned char fmt [16];
+            if (size < 16 || fread(fmt, 1, 16, file) != 16) break;
+            format   = readLE(fmt, 2) == 1;
+            channels = readLE(fmt + 2, 2);
+            *rate    = readLE(fmt + 4, 4);
+            bits     = readLE(fmt + 14, 2);
+            fseek(file, size - 16 + (size & 1), SEEK_CUR);
+        } else if (!memcmp(chunk, "data", 4)) {
+            if (!format || channels < 1 || (bits != 8 && bits != 16)) break;
+
+            std::vector<unsigned char> data(size);
+            size = fread(data.data(), 1, size, file);
+
+            int bytes  = bits / 8;
+            int frames = size / (bytes * channels);
+            samples.assign(frames, 0.0f);
+            for (int n = 0; n < frames; n++) {
+                float sum = 0;
+                for (int c = 0; c < channels; c++) {
+                    const unsigned char *p = &data[(n * channels + c) * bytes];
+                    sum += bits == 8 ? (p[0] - 128) / 128.0f : (int16_t)readLE(p, 2) / 32768.0f;
+                }
+                samples[n] = sum / channels;
+            }
+            fclose(file);
+            return true;
+        } else {
+            fseek(file, size + (size & 1), SEEK_CUR);
+        }
+    }
+    fprintf(stderr, "%s: only PCM 8 or 16 bit is read\n", fileName);
+    fclose(file);
+    return false;
+}
+
+bool writeWav(const char *fileName, const std::vector<float> &samples, int rate, float scale) {
+    FILE *file = fopen(fileName, "wb");
+    if (!file) {
+        fprintf(stderr, "Can't write %s\n", fileName);
+        return false;
+    }
+    writeWavHeader(file, rate, samples.size());
+    for (float sample : samples) {
+        float value = sample * scale;
+        value = value > 1 ? 1 : value < -1 ? -1 : value;
+        writeLE(file, (uint16_t)(int16_t)lrintf(value * 32767), 2);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+static void putLE(unsigned char *bytes, uint32_t value, int count) {
+    for (int i = 0; i < count; i++, value >>= 8) bytes[i] = value & 0xFF;
+}
+
+void makeWavHeader(unsigned char *header, int rate, uint32_t samples) {
+    uint32_t size = samples * 2;
+
+    memcpy(header, "RIFF", 4);          putLE(header + 4, 36 + size, 4);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    putLE(header + 16, 16, 4);          putLE(header + 20, 1, 2);           putLE(header + 22, 1, 2);
+    putLE(header + 24, rate, 4);        putLE(header + 28, rate * 2, 4);    putLE(header + 32, 2, 2);
+    putLE(header + 34, 16, 2);
+    memcpy(header + 36, "data", 4);     putLE(header + 40, size, 4);
+}
+
+void writeWavHeader(FILE *file, int rate, uint32_t samples) {
+    unsigned char header [WAV_HEADER_SIZE];
+    makeWavHeader(header, rate, samples);
+    fwrite(header, 1, WAV_HEADER_SIZE, file);
+}
+
+float wavNormalize(const std::vector<float> &samples, float peak) {
+    float loudest = 0;
+    for (float sample : samples) loudest = fmaxf(loudest, fabsf(sample));
+    return loudest > 0 ? peak / loudest : 1.0f;
+}
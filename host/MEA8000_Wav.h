@@ -0,0 +1,33 @@
+/*
+
+    MEA8000_Wav.h
+
+    Reading and writing of WAV files (PCM, 8 or 16 bit) for the host tools.
+
+ */
+
+#ifndef MEA8000_WAV_H
+#define MEA8000_WAV_H
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+
+// Reads a PCM WAV file, channels are mixed to mono, samples are -1 .. 1.
+// Returns false (with a message on stderr) when the file can't be read.
+bool readWav(const char *fileName, std::vector<float> &samples, int *rate);
+
+// Writes a 16 bit mono WAV file, samples are multiplied by 'scale' and clipped to -1 .. 1.
+bool writeWav(const char *fileName, const std::vector<float> &samples, int rate, float scale = 1.0f);
+
+#define WAV_HEADER_SIZE     44
+
+// The header of a 16 bit mono WAV file with 'samples' samples, in memory or at the current position
+void makeWavHeader(unsigned char *header, int rate, uint32_t samples);
+void writeWavHeader(FILE *file, int rate, uint32_t samples);
+
+// Scale that brings the loudest sample to 'peak'
+float wavNormalize(const std::vector<float> &samples, float peak = 0.9f);
+
+#endif
@@ -0,0 +1,188 @@
+/*
+
+    MEA8000_DriverSim.cpp
+
+    Host tool that runs MEA8000Driver (MEA8000_Driver.h) against the simulated chip of
+    host/MEA8000_ChipSim.h: every sound of the catalog as a phrase, for main loops that
+    call service() every 1 .. 64 ms:
+
+        g++ -std=c++11 -O2 -I. -DDRIVER_COUNT_CYCLES -DFLASH_COUNT_CYCLES -DFLASH_TEST_HANDOFF \
+            -o driversim tools/MEA8000_DriverSim.cpp \
+            host/MEA8000_ChipSim.cpp MEA8000_Driver.cpp MEA8000_Flash.cpp MEA8000_Stream.cpp \
+            MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./driversim [-l latency] [period ...]
+
+    'latency' is the time (µs, default 20) from REQ to the interrupt, the periods are in
+    ms. For each period it shows the frames that were written late (by service instead of
+    the interrupt), the underruns (the chip ran dry, the word is cut), the smallest margin
+    left before a frame was needed and the part of a 16 MHz CPU spent on the feeding.
+    All frames of the catalog must reach the chip, the tool stops with an error if not.
+
+    Then every sound is said once more to a chip that plays a frame at once and asks for
+    the next one right away, with its REQ answered inside FramePrefetch::fill (flashHandoff,
+    MEA8000_Flash.h): between the reads of a block and its handoff, when both halves are
+    empty. The driver must wait for the block, also the last one, not stop before it.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "host/MEA8000_ChipSim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+// -- a REQ in the middle of fill ---------------------------------------------------
+
+// A chip that plays every frame at once: it asks for the next one as soon as it has one.
+// Its requests are answered while the driver has frames, the one after the last frame
+// stays up until the next fill and comes in there, between the reads and the handoff.
+class InstantChip : public MEA8000Bus {
+public:
+    void begin(MEA8000Driver *driver, uint32_t frames) {
+        this->driver = driver;
+        this->frames = frames;
+        bytes        = 0;
+        handedOver   = 0;
+        asking       = stopped = false;
+        afterStop    = 0;
+        raced        = 0;
+    }
+
+    // The pitch and every whole frame make it ask again
+    void write(byte)        { if (stopped) afterStop++; if (++bytes % MEA8000_FRAME_SIZE == 1) asking = true; }
+    void stop()             { stopped = asking = true; }
+
+    uint32_t said() const   { return bytes ? (bytes - 1) / MEA8000_FRAME_SIZE : 0; }
+
+    // The interrupt of the REQ line, if it is up
+    void interrupt() {
+        if (!asking) return;
+        asking = false;
+        driver->onRequest();
+    }
+
+    // From the main loop: the requests the driver has frames (or the stop) for
+    void play() {
+        while (asking && (stopped || said() < handedOver || handedOver == frames)) interrupt();
+    }
+
+    // From fill (flashHandoff)
+    void inFill(bool handed) {
+        if (handed) {
+            handedOver = handedOver + FLASH_PREFETCH_FRAMES < frames ? handedOver + FLASH_PREFETCH_FRAMES : frames;
+        } else if (asking && said() == handedOver) {
+            raced++;
+            interrupt();
+        }
+    }
+
+    MEA8000Driver   *driver;
+    uint32_t        frames;         // of the sound
+    uint32_t        bytes;
+    uint32_t        handedOver;     // frames fill handed over
+    bool            asking;
+    bool            stopped;
+    uint32_t        afterStop;      // bytes written after the stop
+    uint32_t        raced;          // requests inside fill with both halves empty
+};
+
+static InstantChip instantChip;
+
+static void requestInFill(bool handedOver) {
+    instantChip.inFill(handedOver);
+}
+
+// False (with a message) when a sound lost frames
+static bool raceFill(const vector<SoundSpan> &spans, const vector<uint32_t> &frames, uint32_t *raced) {
+    MEA8000Driver driver;
+    bool          ok = true;
+
+    *raced       = 0;
+    flashHandoff = requestInFill;
+    for (size_t id = 0; id < spans.size() && ok; id++) {
+        driver.begin(&instantChip);
+        instantChip.begin(&driver, frames[id]);
+        driver.queue(&spans[id], 1);
+
+        for (uint32_t loops = 0; (!driver.isIdle() || instantChip.asking) && loops <= frames[id] + 4; loops++) {
+            driver.service();
+            instantChip.play();
+        }
+        *raced += instantChip.raced;
+
+        if (instantChip.said() != frames[id] || !instantChip.stopped || instantChip.afterStop || !driver.isIdle()) {
+            fprintf(stderr, "REQ inside fill, sound %u: %u of %u frames said, %s\n", (unsigned)id,
+                    instantChip.said(), frames[id], instantChip.stopped ? "stopped" : "not stopped");
+            ok = false;
+        }
+    }
+    flashHandoff = NULL;
+    return ok;
+}
+
+
+int main(int argc, char **argv) {
+    DriverTiming    timing = { 20, 0 };
+    vector<int>     periods;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-l") && i + 1 < argc) timing.latency = atoi(argv[++i]);
+        else                                        periods.push_back(atoi(argv[i]));
+    }
+    if (periods.empty()) periods = { 1, 2, 4, 8, 16, 24, 32, 48, 64 };
+
+    vector<SoundSpan>   spans;
+    vector<uint32_t>    frames;
+    uint32_t            expected = 0;
+    byte                frame [MEA8000_FRAME_SIZE];
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        spans.push_back(catalogSound(id));
+        frames.push_back(0);
+        SoundStream stream(&spans.back(), 1);
+        while (stream.nextFrame(frame)) frames.back()++;
+        expected += frames.back();
+    }
+
+    printf("latency %u us, %u sounds, %u frames\n\n", timing.latency, SOUND_COUNT, expected);
+    printf("period ms    late  underruns  min margin ms   CPU load\n");
+
+    for (int period : periods) {
+        MEA8000Driver   driver;
+        SimulatedChip   chip;
+        DriverStats     total, stats;
+
+        memset(&total, 0, sizeof(total));
+        total.minMargin    = INT32_MAX;
+        timing.servicePeriod = period * 1000;
+        driver.begin(&chip);
+
+        for (size_t id = 0; id < spans.size(); ) {
+            while (id < spans.size() && driver.queue(&spans[id], 1)) id++;
+            simulateDriver(driver, chip, timing, &stats);
+
+            total.time       += stats.time;
+            total.frames     += stats.frames;
+            total.underruns  += stats.underruns;
+            total.lateFrames += stats.lateFrames;
+            total.cycles     += stats.cycles;
+            if (stats.minMargin < total.minMargin) total.minMargin = stats.minMargin;
+        }
+
+        if (total.frames != expected) {
+            fprintf(stderr, "period %d ms: %u frames reached the chip, not %u\n", period, total.frames, expected);
+            return 1;
+        }
+        printf("%9d  %6u  %9u  %13.2f  %8.2f%%\n", period, total.lateFrames, total.underruns,
+               total.minMargin / 1000.0, total.load() * 100);
+    }
+
+    uint32_t raced;
+    if (!raceFill(spans, frames, &raced)) return 1;
+    printf("\nREQ inside fill: %u requests between the reads and the handoff of a block, all frames said\n", raced);
+    return 0;
+}
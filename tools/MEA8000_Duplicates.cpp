@@ -0,0 +1,217 @@
+/*
+
+    MEA8000_Duplicates.cpp
+
+    Host tool that compares every sound of the catalog with every other one, to find
+    near-duplicates (a word in both catalogs, an _ugly take, Michael and Mike) that could
+    be left out of Flash, and frames that look like typing errors in the arrays.
+
+        g++ -std=c++11 -O3 -march=native -pthread -I. -o duplicates tools/MEA8000_Duplicates.cpp \
+            host/MEA8000_Cepstrum.cpp host/MEA8000_Render.cpp host/MEA8000_FrameIndex.cpp \
+            host/MEA8000_SoundNames.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./duplicates
+
+    Options:
+        -d <n>      largest distance reported as a near-duplicate (default 1.5)
+        -j <n>      number of threads (default: all cores)
+
+    Every sound is rendered (host/MEA8000_Render) and turned into mel cepstra
+    (host/MEA8000_Cepstrum). All pairs (about 250000) are compared with dynamic time
+    warping, spread over the threads a row at a time. Pairs that differ more than
+    1.6 times in length are not compared, and a comparison stops as soon as it can't
+    end below -d. The pairs found are listed from the closest, with the bytes that
+    leaving out the larger one would save.
+
+    The sounds with the same word in their name (C2_BAS and C3_BAS, ONZE_NR and
+    ONZE_NR_ugly) are listed with their distance whatever it is, to see how far
+    the known variants are apart.
+
+    A frame is reported as a possible typing error when a formant (in Bark) or the
+    amplitude jumps away and back again, while the frames around it agree. Silent
+    frames (stops) are left alone, and the formants of noise frames.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Frame.h"
+#include "host/MEA8000_Cepstrum.h"
+#include "host/MEA8000_FrameIndex.h"
+#include "host/MEA8000_Render.h"
+#include "host/MEA8000_SoundNames.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+
+#define MAX_LENGTH_RATIO    1.6f
+#define SPIKE_BARK          2.5f        // a formant this far from both neighbours ...
+#define SPIKE_AMPL          6           // ... or the AMPL index
+#define SPIKE_AGREE         1.0f        // ... while the neighbours are this close
+
+
+struct Pair {
+    uint16_t    a, b;
+    float       distance;
+};
+
+
+static void prepare(vector<Cepstra> &all, atomic<int> &next) {
+    for (int id; (id = next++) < SOUND_COUNT; ) {
+        SoundSpan span = catalogSound(id);
+        all[id] = cepstra(renderSound(span.data, span.length));
+    }
+}
+
+static void compare(const vector<Cepstra> &all, float limit, atomic<int> &next, vector<Pair> &found, mutex &lock) {
+    vector<Pair>    mine;
+
+    for (int a; (a = next++) < SOUND_COUNT; ) {
+        for (int b = a + 1; b < SOUND_COUNT; b++) {
+            int n = all[a].frames, m = all[b].frames;
+            if (n == 0 || m == 0) continue;
+            if (n > m * MAX_LENGTH_RATIO || m > n * MAX_LENGTH_RATIO) continue;
+
+            float distance = soundDistance(all[a], all[b], limit);
+            if (distance <= limit) mine.push_back({ (uint16_t)a, (uint16_t)b, distance });
+        }
+    }
+    lock_guard<mutex> guard(lock);
+    found.insert(found.end(), mine.begin(), mine.end());
+}
+
+
+// The word of a name: without Sound_, C2_ / C3_, _NR, _ugly and a trailing '_'
+static string word(const char *name) {
+    static const char *cuts [] = { "_ugly", "_NR", "_" };
+    string key = name;
+
+    if (!key.compare(0, 6, "Sound_")) key.erase(0, 6);
+    if (!key.compare(0, 3, "C2_") || !key.compare(0, 3, "C3_")) key.erase(0, 3);
+    for (const char *cut : cuts) {
+        size_t length = strlen(cut);
+        if (key.size() > length && !key.compare(key.size() - length, length, cut)) key.erase(key.size() - length);
+    }
+    return key;
+}
+
+
+// -- typing errors -----------------------------------------------------------------
+
+static void frameFeatures(const byte *frame, float *features) {
+    FrameValues values;
+    frameValues(frame, &values);
+    for (int i = 0; i < 3; i++) features[i] = hzToBark(values.fm[i]);
+    features[3] = frameAMPL(frame);
+}
+
+static int spikes(uint16_t id) {
+    SoundSpan   span   = catalogSound(id);
+    byte        header = soundHeaderSize(span.data, span.length);
+    int         frames = (span.length - header) / MEA8000_FRAME_SIZE;
+    int         count  = 0;
+
+    for (int k = 1; k + 1 < frames; k++) {
+        const byte *frame = span.data + header + k * MEA8000_FRAME_SIZE;
+        const byte *around [3] = { frame - MEA8000_FRAME_SIZE, frame, frame + MEA8000_FRAME_SIZE };
+        bool        silent = false, noise = false;
+        for (const byte *f : around) {
+            silent |= frameIsSilent(f);                     // a silent frame is a stop, not an error
+            noise  |= framePI(f) == MEA8000_PI_NOISE;       // the formants of noise move freely
+        }
+        if (silent) continue;
+
+        float before [4], here [4], after [4];
+        frameFeatures(frame - MEA8000_FRAME_SIZE, before);
+        frameFeatures(frame, here);
+        frameFeatures(frame + MEA8000_FRAME_SIZE, after);
+
+        for (int i = noise ? 3 : 0; i < 4; i++) {
+            float jump  = i < 3 ? SPIKE_BARK : SPIKE_AMPL;
+            float agree = i < 3 ? SPIKE_AGREE : SPIKE_AMPL / 3;
+            if (fabsf(here[i] - before[i]) < jump || fabsf(here[i] - after[i]) < jump
+                || fabsf(before[i] - after[i]) > agree || (here[i] - before[i]) * (here[i] - after[i]) < 0) continue;
+
+            static const char *fields [] = { "FM1", "FM2", "FM3", "AMPL" };
+            printf("  %-32s frame %3d (byte %4d): %s %.1f between %.1f and %.1f  [%d, %d, %d, %d]\n",
+                   soundNames[id], k, header + k * MEA8000_FRAME_SIZE, fields[i], here[i], before[i], after[i],
+                   frame[0], frame[1], frame[2], frame[3]);
+            count++;
+            break;
+        }
+    }
+    return count;
+}
+
+
+int main(int argc, char **argv) {
+    float   limit   = 1.5f;
+    int     threads = thread::hardware_concurrency() ? thread::hardware_concurrency() : 1;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-d")) limit   = (float)atof(argv[i + 1]);
+        if (!strcmp(argv[i], "-j")) threads = atoi(argv[i + 1]) > 0 ? atoi(argv[i + 1]) : 1;
+    }
+
+    auto                start = chrono::steady_clock::now();
+    vector<Cepstra>     all(SOUND_COUNT);
+    vector<Pair>        found;
+    vector<thread>      workers;
+    atomic<int>         next(0);
+    mutex               lock;
+
+    for (int t = 0; t < threads; t++) workers.push_back(thread(prepare, ref(all), ref(next)));
+    for (thread &worker : workers) worker.join();
+    workers.clear();
+
+    // The rows get shorter, taking them one at a time keeps the threads equally busy
+    next = 0;
+    for (int t = 0; t < threads; t++) workers.push_back(thread(compare, cref(all), limit, ref(next), ref(found), ref(lock)));
+    for (thread &worker : workers) worker.join();
+
+    sort(found.begin(), found.end(), [](const Pair &x, const Pair &y) { return x.distance < y.distance; });
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    long saved = 0;
+    printf("Near-duplicates (distance up to %.2f):\n", limit);
+    for (const Pair &pair : found) {
+        uint16_t    larger = catalogSound(pair.a).length >= catalogSound(pair.b).length ? pair.a : pair.b;
+        printf("  %5.2f  %-32s %-32s %5d bytes\n", pair.distance, soundNames[pair.a], soundNames[pair.b],
+               catalogSound(larger).length);
+        saved += catalogSound(larger).length;
+    }
+    printf("%d pairs, up to %ld bytes\n\nVariants of the same word:\n", (int)found.size(), saved);
+
+    map<string, vector<uint16_t>> words;
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) words[word(soundNames[id])].push_back(id);
+    for (const auto &same : words) {
+        for (size_t i = 0; i < same.second.size(); i++) {
+            for (size_t j = i + 1; j < same.second.size(); j++) {
+                uint16_t a = same.second[i], b = same.second[j];
+                printf("  %5.2f  %-32s %-32s %5d bytes\n", soundDistance(all[a], all[b]), soundNames[a], soundNames[b],
+                       max(catalogSound(a).length, catalogSound(b).length));
+            }
+        }
+    }
+
+    printf("\nPossible typing errors:\n");
+
+    int errors = 0;
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) errors += spikes(id);
+    printf("%d frames\n", errors);
+
+    fprintf(stderr, "%d sounds, %ld pairs in %.2f s with %d threads\n",
+            SOUND_COUNT, (long)SOUND_COUNT * (SOUND_COUNT - 1) / 2, seconds, threads);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+
+    MEA8000_EditCheck.cpp
+
+    Host tool that makes random edits in every sound of the catalog with the editing
+    session of host/MEA8000_Editor, and checks the samples after every edit against a
+    render of the whole edited sound:
+
+        g++ -std=c++11 -O2 -I. -o editcheck tools/MEA8000_EditCheck.cpp host/MEA8000_Editor.cpp \
+            host/MEA8000_Render.cpp host/MEA8000_SoundNames.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp \
+            MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./editcheck [-n edits] [sound name]
+
+    Options:
+        -n <n>      edits per sound, one after the other in the same session (default 300)
+
+    An edit sets one field of a random frame (a bandwidth, a formant, AMPL, FD or PI) to
+    a random value. For every sound it shows the frames rendered per edit (mean and
+    most), the time of an edit and of the whole render, and the largest difference of a
+    sample from the whole render after any of its edits: that must be 0, the samples of
+    the session are the same as the whole render however many edits there were.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "host/MEA8000_Editor.h"
+#include "host/MEA8000_SoundNames.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+// One field of 'frame' set to a random value
+static void randomEdit(byte *frame) {
+    byte    fields [10] = { frameBW1(frame), frameBW2(frame), frameBW3(frame), frameBW4(frame), frameFM3(frame),
+                            frameFM2(frame), frameFM1(frame), frameAMPL(frame), frameFD(frame), framePI(frame) };
+    static const byte sizes [10] = { 4, 4, 4, 4, 8, 32, 32, 16, 4, 32 };
+    int     field = rand() % 10;
+
+    fields[field] = (byte)(rand() % sizes[field]);
+    packFrame(frame, fields[0], fields[1], fields[2], fields[3], fields[4], fields[5], fields[6], fields[7],
+              fields[8], fields[9]);
+}
+
+static double since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+
+int main(int argc, char **argv) {
+    int         edits = 300;
+    const char *name  = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) edits = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+        else                                        name  = argv[i];
+    }
+
+    float       worst       = 0;
+    uint64_t    rendered    = 0, total = 0;
+    double      editTime    = 0, wholeTime = 0;
+    int         sounds      = 0;
+
+    printf("%-30s %7s %14s %10s %10s %10s\n", "", "frames", "per edit (max)", "edit", "whole", "error");
+    srand(1);
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        if (name && strcmp(name, soundNames[id]) && strcmp(name, soundNames[id] + 6)) continue;
+
+        SoundSpan   span = catalogSound(id);
+        SoundEditor editor;
+        editor.begin(span.data, span.length);
+        if (editor.frames() < 2) continue;
+        bool        headed = soundHeaderSize(span.data, span.length) > 0;
+
+        float       error = 0;
+        int         most  = 0;
+        uint64_t    count = 0;
+        double      edit  = 0, whole = 0;
+
+        for (int e = 0; e < edits; e++) {
+            int     index = rand() % editor.frames();
+            byte    frame [MEA8000_FRAME_SIZE];
+            // Without a header the first frame must not become one, or the whole render skips it
+            do {
+                memcpy(frame, editor.frame(index), MEA8000_FRAME_SIZE);
+                randomEdit(frame);
+            } while (index == 0 && !headed && isSoundHeader(frame[0], frame[2], frame[3]));
+
+            auto    start = chrono::steady_clock::now();
+            int     n     = editor.setFrame(index, frame);
+            edit += since(start);
+
+            start = chrono::steady_clock::now();
+            vector<float> samples = renderSound(editor.data().data(), (uint16_t)editor.data().size());
+            whole += since(start);
+
+            const vector<float> &edited = editor.samples();
+            if (edited.size() != samples.size()) {
+                fprintf(stderr, "%s: %zu samples after edit %d, %zu in the whole render\n",
+                        soundNames[id], edited.size(), e, samples.size());
+                return 1;
+            }
+            for (size_t i = 0; i < samples.size(); i++) error = fmaxf(error, fabsf(edited[i] - samples[i]));
+            count += n;
+            if (n > most) most = n;
+        }
+
+        printf("%-30s %7d %8.1f (%3d) %7.1f us %7.1f us %10.2g\n", soundNames[id] + 6, editor.frames(),
+               (double)count / edits, most, edit / edits * 1e6, whole / edits * 1e6, error);
+        worst      = fmaxf(worst, error);
+        rendered  += count;
+        total     += (uint64_t)editor.frames() * edits;
+        editTime  += edit;
+        wholeTime += whole;
+        sounds++;
+    }
+    if (!sounds) {
+        fprintf(stderr, "No sound %s\n", name);
+        return 1;
+    }
+
+    printf("\n%d sounds, %d edits each: %.1f %% of the frames rendered, %.1f times faster than the whole render\n",
+           sounds, edits, 100.0 * rendered / total, wholeTime / editTime);
+    printf("largest difference from the whole render %.2g\n", worst);
+    return worst > 0 ? 1 : 0;
+}
@@ -0,0 +1,453 @@
+/*
+
+    MEA8000_Encode.cpp
+
+    Host tool that makes MEA8000 frames from a recording (WAV, PCM 8 or 16 bit, any rate),
+    so new words can be added to the catalog. The array is written in the style of
+    catalog 2 and 3 (base-10, with the 4 byte header), longer sounds in parts of
+    up to 511 bytes.
+
+        g++ -std=c++11 -O3 -march=native -pthread -I. -o encode tools/MEA8000_Encode.cpp \
+            host/MEA8000_Render.cpp host/MEA8000_Wav.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./encode word.wav Sound_C3_NEW_WORD >> new_words.cpp
+
+    Options (after the file names):
+        -t <n>      how far frames may differ to be joined into one longer frame (default 1,
+                    0 keeps every 8 ms frame)
+        -j <n>      number of threads (default: all cores)
+
+    Steps:
+    1. The recording is resampled to 8 kHz and cut in 8 ms frames (32 ms window).
+    2. Per frame (spread over the threads): pitch and voicing from the autocorrelation,
+       the spectral envelope from an LPC analysis. The formants (FM1/2/3 index, BW1..4)
+       are fitted to the envelope: a search over the whole FM1 x FM2 grid, then changing one
+       formant at a time (frequency and bandwidth) while the error goes down. The error is
+       computed on the log spectrum, from tables of the response of every possible formant
+       filter, so it is a sum over 64 bins per try (plain loops the compiler vectorizes).
+    3. Frames that are close are joined into 16, 32 or 64 ms frames.
+    4. Analysis by synthesis, frame by frame in order: AMPL is chosen by rendering the frame
+       with every amplitude (host/MEA8000_Render) from the state the frames before left, and
+       taking the one closest to the loudness of the recording. PI follows the pitch.
+
+ */
+
+#include "host/MEA8000_Render.h"
+#include "host/MEA8000_Wav.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+
+#define WINDOW          256                         // analysis window, 32 ms
+#define BINS            64                          // envelope points, 0 .. 4 kHz
+#define LPC_ORDER       12
+#define PITCH_MIN       60                          // Hz
+#define PITCH_MAX       400
+#define VOICED          0.35f                       // autocorrelation peak for a voiced frame
+#define SILENCE         0.003f                      // frames below this part of the loudest one are silent
+#define RMS_SAMPLES     (4 * MEA8000_STEP_SAMPLES)  // loudness is measured over 32 ms
+
+struct Analysis {
+    float   rms;
+    float   pitch;          // Hz, 0 for noise
+    byte    fm [3];         // FM1, FM2, FM3 index
+    byte    bw [4];
+    byte    steps;          // 8 ms steps after joining
+};
+
+
+// -- resampling --------------------------------------------------------------------
+
+static vector<float> resample(const vector<float> &input, int rate) {
+    if (rate == MEA8000_SAMPLE_RATE) return input;
+
+    double          ratio  = (double)rate / MEA8000_SAMPLE_RATE;
+    double          cutoff = ratio > 1 ? 0.9 / ratio : 0.9;        // low pass below 3.6 kHz
+    int             taps   = 16 * (ratio > 1 ? (int)ceil(ratio) : 1);
+    vector<float>   output((size_t)(input.size() / ratio));
+
+    for (size_t n = 0; n < output.size(); n++) {
+        double  t   = n * ratio;
+        int     k0  = (int)floor(t) - taps + 1;
+        double  sum = 0;
+
+        for (int k = k0; k < k0 + 2 * taps; k++) {
+            if (k < 0 || k >= (int)input.size()) continue;
+            double x = (t - k) * cutoff;
+            double w = 0.5 + 0.5 * cos(M_PI * (t - k) / taps);
+            sum += input[k] * (x == 0 ? 1 : sin(M_PI * x) / (M_PI * x)) * w * cutoff;
+        }
+        output[n] = (float)sum;
+    }
+    return output;
+}
+
+
+// -- the formant filter tables -----------------------------------------------------
+
+// Log gain of every formant filter the chip has, at the envelope points
+struct FormantTables {
+    float   fm1 [32][4][BINS];
+    float   fm2 [32][4][BINS];
+    float   fm3 [8][4][BINS];
+    float   fm4 [4][BINS];
+};
+
+static float binHz(int bin) {
+    return (bin + 0.5f) * (MEA8000_SAMPLE_RATE / 2) / BINS;
+}
+
+static void makeTables(FormantTables *tables) {
+    for (int bw = 0; bw < 4; bw++) {
+        for (int k = 0; k < BINS; k++) {
+            float f = binHz(k);
+            for (int fm = 0; fm < 32; fm++) {
+                tables->fm1[fm][bw][k] = logf(formantGain(f, frameFM1Hz[fm], frameBWHz[bw]));
+                tables->fm2[fm][bw][k] = logf(formantGain(f, frameFM2Hz[fm], frameBWHz[bw]));
+            }
+            for (int fm = 0; fm < 8; fm++) tables->fm3[fm][bw][k] = logf(formantGain(f, frameFM3Hz[fm], frameBWHz[bw]));
+            tables->fm4[bw][k] = logf(formantGain(f, MEA8000_FM4_HZ, frameBWHz[bw]));
+        }
+    }
+}
+
+// Squared error between 'target' and 'model' on the log scale, the gain (mean) left out
+static float fitError(const float *target, const float *a, const float *b, const float *c, const float *d) {
+    float diff [BINS];
+    float mean = 0, error = 0;
+
+    for (int k = 0; k < BINS; k++) {
+        diff[k] = target[k] - a[k] - b[k] - c[k] - d[k];
+        mean   += diff[k];
+    }
+    mean /= BINS;
+    for (int k = 0; k < BINS; k++) error += (diff[k] - mean) * (diff[k] - mean);
+    return error;
+}
+
+
+// -- analysis of one frame ---------------------------------------------------------
+
+// Log spectral envelope from LPC (autocorrelation method, Levinson-Durbin)
+static void lpcEnvelope(const float *window, float *envelope) {
+    double  r [LPC_ORDER + 1], a [LPC_ORDER + 1] = { 1 }, previous [LPC_ORDER + 1];
+
+    for (int lag = 0; lag <= LPC_ORDER; lag++) {
+        r[lag] = 0;
+        for (int n = lag; n < WINDOW; n++) r[lag] += window[n] * window[n - lag];
+    }
+    r[0] = r[0] * 1.0001 + 1e-9;          // a little white noise keeps it stable
+
+    double error = r[0];
+    for (int i = 1; i <= LPC_ORDER; i++) {
+        double k = r[i];
+        for (int j = 1; j < i; j++) k -= a[j] * r[i - j];
+        k /= error;
+        memcpy(previous, a, sizeof(a));
+        a[i] = k;
+        for (int j = 1; j < i; j++) a[j] = previous[j] - k * previous[i - j];
+        error *= 1 - k * k;
+    }
+
+    for (int bin = 0; bin < BINS; bin++) {
+        double w = 2 * M_PI * binHz(bin) / MEA8000_SAMPLE_RATE, re = 1, im = 0;
+        for (int j = 1; j <= LPC_ORDER; j++) {
+            re -= a[j] * cos(w * j);
+            im += a[j] * sin(w * j);
+        }
+        envelope[bin] = (float)(-0.5 * log(re * re + im * im));
+    }
+}
+
+static float findPitch(const float *window, float *strength) {
+    int     best = 0;
+    double  bestValue = 0, energy = 0;
+
+    for (int n = 0; n < WINDOW; n++) energy += window[n] * window[n];
+    for (int lag = MEA8000_SAMPLE_RATE / PITCH_MAX; lag <= MEA8000_SAMPLE_RATE / PITCH_MIN; lag++) {
+        double sum = 0;
+        for (int n = lag; n < WINDOW; n++) sum += window[n] * window[n - lag];
+        sum *= (double)WINDOW / (WINDOW - lag);
+        if (sum > bestValue) {
+            bestValue = sum;
+            best      = lag;
+        }
+    }
+    *strength = energy > 0 ? (float)(bestValue / energy) : 0;
+    return best ? (float)MEA8000_SAMPLE_RATE / best : 0;
+}
+
+static void fitFormants(const FormantTables &tables, const float *target, Analysis *frame) {
+    int     fm [3] = { 0, 0, 4 }, bw [4] = { 1, 1, 1, 1 };
+    float   best   = 1e30f;
+
+    for (int fm1 = 0; fm1 < 32; fm1++) {
+        for (int fm2 = 0; fm2 < 32; fm2++) {
+            if (frameFM2Hz[fm2] <= frameFM1Hz[fm1]) continue;
+            float error = fitError(target, tables.fm1[fm1][1], tables.fm2[fm2][1], tables.fm3[4][1], tables.fm4[1]);
+            if (error < best) { best = error; fm[0] = fm1; fm[1] = fm2; }
+        }
+    }
+
+    for (bool better = true; better; ) {
+        better = false;
+        for (int formant = 0; formant < 4; formant++) {
+            int count = formant < 2 ? 32 : formant == 2 ? 8 : 1;
+            for (int f = 0; f < count; f++) {
+                for (int b = 0; b < 4; b++) {
+                    int tryFm [3] = { fm[0], fm[1], fm[2] }, tryBw [4] = { bw[0], bw[1], bw[2], bw[3] };
+                    if (formant < 3) tryFm[formant] = f;
+                    tryBw[formant] = b;
+
+                    float error = fitError(target, tables.fm1[tryFm[0]][tryBw[0]], tables.fm2[tryFm[1]][tryBw[1]],
+                                           tables.fm3[tryFm[2]][tryBw[2]], tables.fm4[tryBw[3]]);
+                    if (error < best - 1e-6f) {
+                        best = error;
+                        memcpy(fm, tryFm, sizeof(fm));
+                        memcpy(bw, tryBw, sizeof(bw));
+                        better = true;
+                    }
+                }
+            }
+        }
+    }
+    for (int i = 0; i < 3; i++) frame->fm[i] = fm[i];
+    for (int i = 0; i < 4; i++) frame->bw[i] = bw[i];
+}
+
+static void analyse(const vector<float> &audio, const FormantTables &tables, vector<Analysis> &frames, int first, int last) {
+    float window [WINDOW], envelope [BINS];
+
+    for (int i = first; i < last; i++) {
+        int     center = i * MEA8000_STEP_SAMPLES + MEA8000_STEP_SAMPLES / 2;
+        double  energy = 0;
+
+        for (int n = 0; n < WINDOW; n++) {
+            int     at = center - WINDOW / 2 + n;
+            float   x  = at >= 0 && at < (int)audio.size() ? audio[at] : 0;
+            if (n >= (WINDOW - RMS_SAMPLES) / 2 && n < (WINDOW + RMS_SAMPLES) / 2) energy += x * x;
+            window[n] = x * (0.54f - 0.46f * cosf(2 * (float)M_PI * n / (WINDOW - 1)));
+        }
+        for (int n = WINDOW - 1; n > 0; n--) window[n] -= 0.4f * window[n - 1];    // a little pre-emphasis
+
+        float strength;
+        frames[i].rms   = (float)sqrt(energy / RMS_SAMPLES);
+        frames[i].pitch = findPitch(window, &strength);
+        if (strength < VOICED) frames[i].pitch = 0;
+        frames[i].steps = 1;
+
+        lpcEnvelope(window, envelope);
+        for (int k = 0; k < BINS; k++) envelope[k] -= 0.5f * logf(1 + 0.16f - 0.8f * cosf(2 * (float)M_PI * binHz(k) / MEA8000_SAMPLE_RATE));
+        fitFormants(tables, envelope, &frames[i]);
+    }
+}
+
+
+// -- joining frames ----------------------------------------------------------------
+
+static bool closeFrames(const Analysis &a, const Analysis &b, int tolerance) {
+    if ((a.pitch == 0) != (b.pitch == 0)) return false;
+    for (int i = 0; i < 3; i++) if (abs(a.fm[i] - b.fm[i]) > tolerance) return false;
+    for (int i = 0; i < 4; i++) if (a.bw[i] != b.bw[i] && tolerance == 0) return false;
+    float ratio = (a.rms + 1e-6f) / (b.rms + 1e-6f);
+    return ratio < 1.0f + 0.4f * tolerance && ratio > 1.0f / (1.0f + 0.4f * tolerance);
+}
+
+// Every frame that is kept becomes the last one of its run, with the number of steps
+static vector<Analysis> joinFrames(const vector<Analysis> &frames, int tolerance) {
+    vector<Analysis> joined;
+
+    for (size_t i = 0; i < frames.size(); ) {
+        int length = 8;
+        for (; length > 1; length /= 2) {
+            if (i + length > frames.size()) continue;
+            bool close = true;
+            for (int j = 0; j < length - 1 && close; j++) close = closeFrames(frames[i + j], frames[i + length - 1], tolerance);
+            if (close) break;
+        }
+        Analysis frame = frames[i + length - 1];
+        frame.steps    = length;
+        joined.push_back(frame);
+        i += length;
+    }
+    return joined;
+}
+
+
+// -- analysis by synthesis ---------------------------------------------------------
+
+// Loudness of 'frame' after the frames 'synth' has had. A frame of 8 ms may have no pitch
+// pulse at all, so the frame is held (as 8 ms frames) until there are RMS_SAMPLES.
+static float renderRms(Synth synth, const byte *frame) {
+    float   samples [SYNTH_MAX_SAMPLES];
+    byte    hold [MEA8000_FRAME_SIZE];
+    int     total = 0;
+    double  sum   = 0;
+
+    memcpy(hold, frame, MEA8000_FRAME_SIZE);
+    setFrameFD(hold, 0);
+    setFramePI(hold, framePI(frame) == MEA8000_PI_NOISE ? MEA8000_PI_NOISE : 0);
+    for (const byte *next = frame; total < RMS_SAMPLES; next = hold) {
+        int count = synth.render(next, samples);
+        for (int n = 0; n < count; n++) sum += samples[n] * samples[n];
+        total += count;
+    }
+    return (float)sqrt(sum / total);
+}
+
+static byte fdCode(byte steps) {
+    return steps >= 8 ? 3 : steps >= 4 ? 2 : steps >= 2 ? 1 : 0;
+}
+
+// The frames (no header), 'pitches' gets the pitch (Hz) at the start of every frame
+static vector<byte> synthesize(const vector<Analysis> &frames, vector<float> &pitches) {
+    vector<byte>    data;
+    float           loudest = 0;
+    size_t          loudestFrame = 0;
+    float           startPitch = 2 * MEA8000_DEFAULT_PITCH;
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (frames[i].rms > loudest) { loudest = frames[i].rms; loudestFrame = i; }
+    }
+    for (const Analysis &frame : frames) {
+        if (frame.pitch > 0) { startPitch = frame.pitch; break; }
+    }
+    int headerPitch = (int)lrintf(startPitch / 2);
+    headerPitch = headerPitch < 20 ? 20 : headerPitch > 63 ? 63 : headerPitch;      // < 64, else it is no header
+
+    // The loudest frame, held, with AMPL 15 sets the scale
+    const Analysis &top = frames[loudestFrame];
+    byte    frame [MEA8000_FRAME_SIZE];
+    Synth   synth;
+    packFrame(frame, top.bw[0], top.bw[1], top.bw[2], top.bw[3], top.fm[2], top.fm[1], top.fm[0], 15, 0,
+              top.pitch > 0 ? 0 : MEA8000_PI_NOISE);
+    synth.begin(top.pitch > 0 ? top.pitch : startPitch);
+    float   samples [SYNTH_MAX_SAMPLES];
+    for (int i = 0; i < 4; i++) synth.render(frame, samples);
+    float scale = loudest > 0 ? renderRms(synth, frame) / loudest : 1;
+
+    synth.begin(2.0f * headerPitch);
+    float pitch = 2.0f * headerPitch;
+
+    for (const Analysis &a : frames) {
+        pitches.push_back(pitch);
+        byte steps = 1 << fdCode(a.steps);
+        byte pi    = MEA8000_PI_NOISE;
+
+        if (a.pitch > 0) {
+            float change = (a.pitch - pitch) / steps;
+            pi     = pitchIncrementCode((int)lrintf(change));
+            pitch += pitchIncrement(pi) * steps;
+        }
+
+        byte ampl = 0;
+        if (a.rms >= loudest * SILENCE) {
+            float bestError = 1e30f;
+            for (byte tryAmpl = 1; tryAmpl < 16; tryAmpl++) {
+                packFrame(frame, a.bw[0], a.bw[1], a.bw[2], a.bw[3], a.fm[2], a.fm[1], a.fm[0], tryAmpl, fdCode(a.steps), pi);
+                float error = fabsf(logf(renderRms(synth, frame) + 1e-9f) - logf(a.rms * scale));
+                if (error < bestError) { bestError = error; ampl = tryAmpl; }
+            }
+        }
+        packFrame(frame, a.bw[0], a.bw[1], a.bw[2], a.bw[3], a.fm[2], a.fm[1], a.fm[0], ampl, fdCode(a.steps), pi);
+
+        synth.render(frame, samples);
+        data.insert(data.end(), frame, frame + MEA8000_FRAME_SIZE);
+    }
+    return data;
+}
+
+
+// -- output ------------------------------------------------------------------------
+
+// A header is only seen as one up to 511 bytes (see isSoundHeader), longer sounds are
+// written in parts (_P1, _P2, ...) like Sound_INTRO_MEA8000, every part with its own header.
+#define PART_FRAMES     ((512 - MEA8000_HEADER_SIZE) / MEA8000_FRAME_SIZE - 1)
+
+static void writeArrays(const char *name, const vector<byte> &frames, const vector<float> &pitches) {
+    size_t          count = pitches.size();
+    int             parts = (int)((count + PART_FRAMES - 1) / PART_FRAMES);
+    vector<string>  declarations;
+
+    for (int part = 0; part < parts; part++) {
+        size_t  first = part * PART_FRAMES;
+        size_t  last  = first + PART_FRAMES < count ? first + PART_FRAMES : count;
+        string  partName = parts > 1 ? string(name) + "_P" + to_string(part + 1) : string(name);
+        int     pitch = (int)lrintf(pitches[first] / 2);
+
+        vector<byte> data;
+        data.push_back(0);
+        data.push_back(0);
+        data.push_back((byte)(pitch < 20 ? 20 : pitch > 63 ? 63 : pitch));
+        data.push_back(47);
+        data.insert(data.end(), frames.begin() + first * MEA8000_FRAME_SIZE, frames.begin() + last * MEA8000_FRAME_SIZE);
+        data[0] = (byte)(data.size() >> 8);
+        data[1] = (byte)(data.size() & 0xFF);
+
+        printf("constexpr byte %s [%d] PROGMEM = {\n", partName.c_str(), (int)data.size());
+        for (size_t i = 0; i < data.size(); i++) {
+            printf("%s%4d%s", i % 16 ? "" : "    ", data[i],
+                   i + 1 == data.size() ? " };\n\n" : i % 16 == 15 ? ",\n" : ",");
+        }
+
+        char declaration [100];
+        snprintf(declaration, sizeof(declaration), "extern const byte %-36s [%d] PROGMEM;", partName.c_str(), (int)data.size());
+        declarations.push_back(declaration);
+    }
+    printf("// for MEA8000_Sounds.h:\n");
+    for (const string &declaration : declarations) printf("// %s\n", declaration.c_str());
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <file.wav> <array name> [-t tolerance] [-j threads]\n", argv[0]);
+        return 1;
+    }
+    int tolerance = 1;
+    int threads   = thread::hardware_concurrency() ? thread::hardware_concurrency() : 1;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-t")) tolerance = atoi(argv[i + 1]);
+        if (!strcmp(argv[i], "-j")) threads   = atoi(argv[i + 1]) > 0 ? atoi(argv[i + 1]) : 1;
+    }
+
+    auto            start = chrono::steady_clock::now();
+    vector<float>   input;
+    int             rate;
+    if (!readWav(argv[1], input, &rate)) return 1;
+
+    vector<float>       audio = resample(input, rate);
+    vector<Analysis>    frames(audio.size() / MEA8000_STEP_SAMPLES);
+    FormantTables      *tables = new FormantTables;
+    makeTables(tables);
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        int first = (int)(frames.size() * t / threads), last = (int)(frames.size() * (t + 1) / threads);
+        workers.push_back(thread(analyse, cref(audio), cref(*tables), ref(frames), first, last));
+    }
+    for (thread &worker : workers) worker.join();
+    delete tables;
+
+    if (frames.empty()) {
+        fprintf(stderr, "%s is too short\n", argv[1]);
+        return 1;
+    }
+    vector<Analysis>    joined = joinFrames(frames, tolerance);
+    vector<float>       pitches;
+    vector<byte>        data   = synthesize(joined, pitches);
+    writeArrays(argv[2], data, pitches);
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "%s: %.2f s of sound, %d frames (%d of 8 ms), %d bytes, in %.2f s with %d threads\n",
+            argv[1], audio.size() / (double)MEA8000_SAMPLE_RATE, (int)joined.size(), (int)frames.size(),
+            (int)data.size(), seconds, threads);
+    return 0;
+}
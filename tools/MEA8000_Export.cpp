@@ -0,0 +1,209 @@
+/*
+
+    MEA8000_Export.cpp
+
+    Host tool that writes every sound of the catalog to a WAV file, named after its
+    symbol, in a directory per group (wav/catalog2/Sound_C2_BONJOUR.wav):
+
+        g++ -std=c++11 -O2 -pthread -I. -o export tools/MEA8000_Export.cpp host/MEA8000_Render.cpp \
+            host/MEA8000_Wav.cpp host/MEA8000_SoundNames.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp \
+            MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./export [-o directory] [-j threads]
+
+    Options:
+        -o <dir>    where the group directories are made (default: wav)
+        -j <n>      number of render threads (default: all cores)
+
+    The render threads take the sounds one at a time and make each file whole in memory:
+    the header and the 16 bit samples (synthPcm, host/MEA8000_Render.h) in one buffer.
+    One more thread writes the files that are ready, each with a single write, so the
+    rendering goes on while the disk is busy. The report shows the time spent on both.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "host/MEA8000_Render.h"
+#include "host/MEA8000_SoundNames.h"
+#include "host/MEA8000_Wav.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/stat.h>
+
+using namespace std;
+
+
+static const char *const groupNames [SOUND_GROUPS] = {
+    "phonemes", "nato", "self", "english", "catalog2", "catalog3", "extra", "intro" };
+
+// A file made by a render thread, waiting for the writer
+struct WavImage {
+    uint16_t                id;
+    vector<unsigned char>   bytes;
+};
+
+
+// -- the files waiting to be written -----------------------------------------------
+
+class WriteQueue {
+public:
+    WriteQueue(int producers) : producers(producers) {}
+
+    void put(WavImage &image) {
+        lock_guard<mutex> hold(lock);
+        ready.push_back(WavImage());
+        ready.back().id = image.id;
+        ready.back().bytes.swap(image.bytes);
+        wake.notify_one();
+    }
+
+    void done() {
+        lock_guard<mutex> hold(lock);
+        producers--;
+        wake.notify_one();
+    }
+
+    // All files that are ready (waits for at least one), false when there will be no more
+    bool take(deque<WavImage> &batch) {
+        unique_lock<mutex> hold(lock);
+        wake.wait(hold, [this] { return !ready.empty() || producers == 0; });
+        batch.swap(ready);
+        return !batch.empty();
+    }
+
+private:
+    mutex               lock;
+    condition_variable  wake;
+    deque<WavImage>     ready;
+    int                 producers;
+};
+
+
+// -- rendering and writing ---------------------------------------------------------
+
+static double since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static void render(atomic<int> &next, WriteQueue &queue, double *busy) {
+    *busy = 0;
+    for (int id; (id = next++) < SOUND_COUNT; ) {
+        auto            start   = chrono::steady_clock::now();
+        SoundSpan       span    = catalogSound(id);
+        vector<float>   samples = renderSound(span.data, span.length);
+        WavImage        image;
+
+        image.id = id;
+        image.bytes.resize(WAV_HEADER_SIZE + 2 * samples.size());
+        makeWavHeader(image.bytes.data(), MEA8000_SAMPLE_RATE, samples.size());
+
+        unsigned char *out = image.bytes.data() + WAV_HEADER_SIZE;
+        for (float sample : samples) {
+            int16_t pcm = synthPcm(sample);
+            *out++ = (uint16_t)pcm & 0xFF;
+            *out++ = (uint16_t)pcm >> 8;
+        }
+        *busy += since(start);
+        queue.put(image);
+    }
+    queue.done();
+}
+
+// The files of the sounds, from the queue until the render threads are done.
+// Returns the number of files that could not be written.
+static int writeAll(WriteQueue &queue, const string &directory, double *busy, uint64_t *bytes, int *batches) {
+    deque<WavImage> batch;
+    int             failed = 0;
+
+    *busy = 0;
+    while (queue.take(batch)) {
+        auto start = chrono::steady_clock::now();
+        for (WavImage &image : batch) {
+            byte    group = 0;
+            while (soundGroupEnd(group) <= image.id) group++;
+
+            string  name = directory + "/" + groupNames[group] + "/" + soundNames[image.id] + ".wav";
+            FILE    *file = fopen(name.c_str(), "wb");
+            bool    ok    = file != NULL;
+
+            if (file) {
+                setvbuf(file, NULL, _IONBF, 0);     // the whole file is one write, no copy into a buffer
+                ok = fwrite(image.bytes.data(), 1, image.bytes.size(), file) == image.bytes.size();
+                if (fclose(file) != 0) ok = false;
+            }
+            if (ok) {
+                *bytes += image.bytes.size();
+            } else {
+                fprintf(stderr, "Can't write %s\n", name.c_str());
+                failed++;
+            }
+        }
+        batch.clear();
+        *busy += since(start);
+        (*batches)++;
+    }
+    return failed;
+}
+
+
+int main(int argc, char **argv) {
+    string  directory = "wav";
+    int     threads   = thread::hardware_concurrency() ? thread::hardware_concurrency() : 1;
+
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "-o") && i + 1 < argc) directory = argv[++i];
+        else if (!strcmp(argv[i], "-j") && i + 1 < argc) threads   = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+        else {
+            fprintf(stderr, "usage: export [-o directory] [-j threads]\n");
+            return 1;
+        }
+    }
+
+    mkdir(directory.c_str(), 0777);
+    for (byte group = 0; group < SOUND_GROUPS; group++) {
+        string path = directory + "/" + groupNames[group];
+        struct stat info;
+        if (mkdir(path.c_str(), 0777) != 0 && (stat(path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode))) {
+            fprintf(stderr, "Can't make the directory %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    auto            started = chrono::steady_clock::now();
+    WriteQueue      queue(threads);
+    atomic<int>     next(0);
+    vector<thread>  workers;
+    vector<double>  rendering(threads);
+
+    for (int t = 0; t < threads; t++) workers.push_back(thread(render, ref(next), ref(queue), &rendering[t]));
+
+    double      writing = 0;
+    uint64_t    bytes   = 0;
+    int         batches = 0;
+    int         failed  = writeAll(queue, directory, &writing, &bytes, &batches);
+
+    for (thread &worker : workers) worker.join();
+
+    double  seconds = since(started);
+    double  render  = 0;
+    for (double busy : rendering) render += busy;
+    int     written = SOUND_COUNT - failed;
+    double  audio   = (bytes - (uint64_t)written * WAV_HEADER_SIZE) / 2.0 / MEA8000_SAMPLE_RATE;
+
+    printf("%d sounds to %s/ in %.2f s: %.1f s of audio (%.1f MB), %.0f files/s, %.1f MB/s\n",
+           written, directory.c_str(), seconds, audio, bytes / 1e6,
+           written / seconds, bytes / 1e6 / seconds);
+    printf("rendering %.2f s on %d threads, writing %.2f s in %d batches\n", render, threads, writing, batches);
+    if (failed) fprintf(stderr, "%d files could not be written\n", failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+/*
+
+    MEA8000_FeedSim.cpp
+
+    Host tool that sizes the feed buffer of MEA8000Driver for a firmware with jitter, with
+    the model of host/MEA8000_FeedSim.h:
+
+        g++ -std=c++11 -O2 -I. -o feedsim tools/MEA8000_FeedSim.cpp host/MEA8000_FeedSim.cpp \
+            host/MEA8000_SoundNames.cpp MEA8000_Flash.cpp MEA8000_Stream.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./feedsim [-n scenarios] [-d depth] [-i latency] [-s latency] [sound ...]
+
+    -n  scenarios for each sound (default 1000)
+    -d  buffer depth in frames for the underruns (default FLASH_PREFETCH_FRAMES)
+    -i  time from REQ to the interrupt (default fixed:20)
+    -s  time between the visits of the main loop (default uniform:1000:10000+spike:0.002:100000)
+
+    The times are in µs, see parseLatency. With sounds (names, with or without "Sound_")
+    they are said as one phrase and each of them is shown. Without, every sound of the
+    catalog is run on its own: the depths needed, and the sounds that are cut with the
+    depth given. The depth needed is the most of all scenarios, at least 1.
+
+ */
+
+#include "host/MEA8000_FeedSim.h"
+#include "host/MEA8000_SoundNames.h"
+#include "MEA8000_Flash.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+#define MAX_SOUNDS      64
+#define DEPTH_COLUMNS   16
+
+
+// Runs 'scenarios' scenarios, 'safe' with an unlimited buffer (for the depth), 'cut' with 'depth'
+static void simulate(const FeedSimulation &sim, int scenarios, uint32_t depth, const Latency &interrupt,
+                     const Latency &service, FeedPart *safe, FeedPart *cut) {
+    sim.clear(safe);
+    sim.clear(cut);
+    for (int seed = 0; seed < scenarios; seed++) {
+        sim.run(seed, FEEDSIM_UNLIMITED, interrupt, service, safe);
+        sim.run(seed, depth, interrupt, service, cut);
+    }
+}
+
+int main(int argc, char **argv) {
+    int             scenarios = 1000;
+    uint32_t        depth     = FLASH_PREFETCH_FRAMES;
+    const char      *interruptText = "fixed:20", *serviceText = "uniform:1000:10000+spike:0.002:100000";
+    vector<SoundSpan> spans;
+
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "-n") && i + 1 < argc) scenarios     = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc) depth         = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-i") && i + 1 < argc) interruptText = argv[++i];
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) serviceText   = argv[++i];
+        else {
+            uint16_t id = soundId(argv[i]);
+            if (id == SOUND_NONE || spans.size() >= MAX_SOUNDS) {
+                fprintf(stderr, "%s: no such sound (or too many)\n", argv[i]);
+                return 1;
+            }
+            spans.push_back(catalogSound(id));
+        }
+    }
+
+    Latency interrupt, service;
+    if (!parseLatency(interruptText, &interrupt) || !parseLatency(serviceText, &service) || scenarios < 1 || depth < 1) {
+        fprintf(stderr, "usage: feedsim [-n scenarios] [-d depth] [-i latency] [-s latency] [sound ...]\n"
+                        "latency: fixed:T, uniform:LOW:HIGH or exp:MEAN, with an optional +spike:CHANCE:MAX (us)\n");
+        return 1;
+    }
+    printf("interrupt %s, main loop %s, depth %u, %d scenarios\n\n", interruptText, serviceText, depth, scenarios);
+
+    auto            started = chrono::steady_clock::now();
+    uint64_t        runs    = 0;
+    FeedSimulation  sim;
+
+    if (!spans.empty()) {
+        FeedPart safe [MAX_SOUNDS], cut [MAX_SOUNDS];
+
+        sim.begin(spans.data(), (byte)spans.size());
+        simulate(sim, scenarios, depth, interrupt, service, safe, cut);
+        runs += 2 * scenarios;
+
+        printf("sound                          frames  underruns  late irq  depth  min margin ms\n");
+        for (size_t i = 0; i < spans.size(); i++) {
+            uint16_t id     = catalogFind(spans[i].data);
+            int      frames = 0;
+            SoundStream stream(&spans[i], 1);
+            for (byte frame [MEA8000_FRAME_SIZE]; stream.nextFrame(frame); ) frames++;
+
+            printf("%-30s %6d  %9u  %8u  %5u  %13.2f\n", soundNames[id], frames, cut[i].underruns,
+                   cut[i].lateInterrupts, safe[i].depth > 1 ? safe[i].depth : 1,
+                   cut[i].minMargin == INT32_MAX ? 0 : cut[i].minMargin / 1000.0);
+        }
+    } else {
+        uint32_t    histogram [DEPTH_COLUMNS] = { 0 };
+        uint32_t    cutSounds = 0, lateSounds = 0, worst = 1;
+
+        for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+            SoundSpan span = catalogSound(id);
+            FeedPart  safe, cut;
+
+            sim.begin(&span, 1);
+            simulate(sim, scenarios, depth, interrupt, service, &safe, &cut);
+            runs += 2 * scenarios;
+
+            uint32_t needed = safe.depth > 1 ? safe.depth : 1;
+            histogram[needed < DEPTH_COLUMNS ? needed : DEPTH_COLUMNS - 1]++;
+            if (needed > worst)     worst = needed;
+            if (safe.lateInterrupts) lateSounds++;
+            if (cut.underruns > cut.lateInterrupts) {
+                cutSounds++;
+                printf("%-30s needs %2u, cut in %5.1f%% of the scenarios\n", soundNames[id], needed,
+                       100.0 * (cut.underruns - cut.lateInterrupts) / scenarios);
+            }
+        }
+
+        printf("\ndepth needed:  ");
+        for (int d = 1; d < DEPTH_COLUMNS; d++) if (histogram[d]) printf("  %s%d: %u", d == DEPTH_COLUMNS - 1 ? ">=" : "", d, histogram[d]);
+        printf("\nworst %u, %u sounds cut with depth %u, %u with interrupts too late\n", worst, cutSounds, depth, lateSounds);
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+    printf("\n%llu scenarios in %.2f s, %.0f a second\n", (unsigned long long)runs, seconds, runs / seconds);
+    return 0;
+}
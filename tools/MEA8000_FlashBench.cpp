@@ -0,0 +1,104 @@
+/*
+
+    MEA8000_FlashBench.cpp
+
+    Host tool that compares the ways of reading the frames of the whole catalog from Flash,
+    in estimated ATmega cycles, and checks FramePrefetch (MEA8000_Flash.h):
+
+        g++ -std=c++11 -O2 -I. -DFLASH_COUNT_CYCLES -o flashbench tools/MEA8000_FlashBench.cpp \
+            MEA8000_Flash.cpp MEA8000_Stream.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./flashbench
+
+    The costs of pgm_read_byte and memcpy_P are counted from the code avr-gcc makes for them:
+    - pgm_read_byte, a byte at a time:  address in Z (2), LPM (3), store (2), loop (2)
+    - memcpy_P of a frame:              call and return (8), setup (6), per byte LPM Z+, store, loop (9)
+    - flashReadFrame:                   2 + 5 a byte (see MEA8000_Flash.h)
+    - flashRead of a block of frames:   4 + 5 a byte, for FLASH_PREFETCH_FRAMES frames at once
+
+    FramePrefetch is filled at random moments between the frames (as a main loop would),
+    the frames it hands out must be those of SoundStream, with an underrun counted every
+    time the main loop came too late.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Flash.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+#define PGM_READ_BYTE_CYCLES    9
+#define MEMCPY_P_CYCLES         14
+#define MEMCPY_P_BYTE_CYCLES    9
+
+
+int main() {
+    uint32_t    frames = 0, bytes = 0, perByte = 0, memcpyP = 0, frameReads, blockReads;
+    byte        frame [MEA8000_FRAME_SIZE];
+
+    // SoundStream reads with flashReadFrame
+    flashCycles = 0;
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        SoundSpan   span = catalogSound(id);
+        SoundStream stream(&span, 1);
+        while (stream.nextFrame(frame)) frames++;
+    }
+    frameReads = flashCycles;
+    bytes      = frames * MEA8000_FRAME_SIZE;
+    perByte    = bytes * PGM_READ_BYTE_CYCLES;
+    memcpyP    = frames * (MEMCPY_P_CYCLES + MEA8000_FRAME_SIZE * MEMCPY_P_BYTE_CYCLES);
+
+    // Blocks of frames straight from the arrays
+    flashCycles = 0;
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        SoundSpan   span   = catalogSound(id);
+        uint16_t    offset = soundHeaderSize(span.data, span.length);
+        byte        block [FLASH_PREFETCH_FRAMES * MEA8000_FRAME_SIZE];
+
+        while (offset + MEA8000_FRAME_SIZE <= span.length) {
+            uint16_t size = (span.length - offset) / MEA8000_FRAME_SIZE * MEA8000_FRAME_SIZE;
+            if (size > sizeof(block)) size = sizeof(block);
+            flashRead(block, span.data + offset, (byte)size);
+            offset += size;
+        }
+    }
+    blockReads = flashCycles;
+
+    printf("%u frames (%u bytes) of %d sounds, estimated ATmega cycles:\n", frames, bytes, SOUND_COUNT);
+    printf("    pgm_read_byte a byte      %8u  %5.1f a frame\n", perByte, (double)perByte / frames);
+    printf("    memcpy_P a frame          %8u  %5.1f a frame\n", memcpyP, (double)memcpyP / frames);
+    printf("    flashReadFrame            %8u  %5.1f a frame\n", frameReads, (double)frameReads / frames);
+    printf("    flashRead, %d frames       %8u  %5.1f a frame\n", FLASH_PREFETCH_FRAMES, blockReads, (double)blockReads / frames);
+
+    // FramePrefetch against SoundStream, with a main loop that is late now and then
+    uint32_t    served = 0, underruns = 0;
+    srand(1);
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        SoundSpan       span = catalogSound(id);
+        SoundStream     direct(&span, 1), source(&span, 1);
+        FramePrefetch   prefetch(&source);
+        byte            expected [MEA8000_FRAME_SIZE];
+
+        while (!prefetch.isDone()) {
+            if (rand() % 4 != 0) prefetch.fill();           // the main loop, 3 times out of 4 in time
+            if (!prefetch.nextFrame(frame)) continue;
+            if (!direct.nextFrame(expected) || memcmp(frame, expected, MEA8000_FRAME_SIZE)) {
+                fprintf(stderr, "FramePrefetch: frame %u of sound %u is not the same\n", served, id);
+                return 1;
+            }
+            served++;
+        }
+        if (direct.nextFrame(expected)) {
+            fprintf(stderr, "FramePrefetch: sound %u ends too soon\n", id);
+            return 1;
+        }
+        underruns += prefetch.underruns();
+    }
+    printf("FramePrefetch: %u frames the same as SoundStream, %u underruns (main loop late 1 in 4)\n", served, underruns);
+    return 0;
+}
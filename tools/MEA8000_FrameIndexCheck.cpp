@@ -0,0 +1,258 @@
+/*
+
+    MEA8000_FrameIndexCheck.cpp
+
+    Host tool that checks the nearest frames of host/MEA8000_FrameIndex against a brute
+    force search, and times the queries:
+
+        g++ -std=c++11 -O2 -I. -o frameindexcheck tools/MEA8000_FrameIndexCheck.cpp \
+            host/MEA8000_FrameIndex.cpp host/MEA8000_Render.cpp MEA8000_Stream.cpp \
+            MEA8000_Catalog.cpp MEA8000_Sounds*.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./frameindexcheck [-n targets] [-g grid targets] [-s seed]
+
+    Options:
+        -n <n>      targets compared with every frame of the catalog (default 1000)
+        -g <n>      targets compared with every frame of the whole grid (default 20)
+        -s <n>      seed of the random targets (default 1)
+
+    Three checks, each counting the queries where the index is farther than the search:
+      - every distinct frame of the catalog, made into values, must come back as itself;
+      - the targets (half of them catalog frames with jittered values, half anywhere in
+        and around the range of the chip) against all distinct frames of the catalog:
+        the index searches a grid that holds them all, so it may only be nearer;
+      - the first targets against all 32 x 32 x 8 x 4^4 x 16 frames of the grid, the
+        exact answer. The distance of every value of a field is found once per target.
+
+    Distances are FrameIndex::distance with the default weights, the same sum for both
+    frames, so the compare is exact. The times are per query, the searches included.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Stream.h"
+#include "host/MEA8000_FrameIndex.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace std;
+
+
+typedef uint32_t FrameKey;      // the four bytes of a frame, FD and PI cleared
+
+static FrameKey frameKey(const byte *frame) {
+    return ((FrameKey)frame[0] << 24) | ((FrameKey)frame[1] << 16) | ((FrameKey)frame[2] << 8) | (frame[3] & 0x80);
+}
+
+static void keyFrame(FrameKey key, byte *frame) {
+    for (int i = 0; i < 4; i++) frame[i] = (byte)(key >> (24 - 8 * i));
+}
+
+static double since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+
+// -- targets -----------------------------------------------------------------------
+
+static float logUniform(mt19937 &random, float low, float high) {
+    return low * powf(high / low, uniform_real_distribution<float>(0, 1)(random));
+}
+
+static void makeTargets(const vector<FrameKey> &catalog, int count, unsigned seed, vector<FrameValues> &targets) {
+    mt19937                     random(seed);
+    normal_distribution<float>  jitter(0, 1);
+
+    targets.resize(count);
+    for (int i = 0; i < count; i++) {
+        FrameValues &values = targets[i];
+
+        if (i % 2 == 0) {
+            byte frame [MEA8000_FRAME_SIZE];
+            keyFrame(catalog[random() % catalog.size()], frame);
+            frameValues(frame, &values);
+            for (int f = 0; f < 3; f++) values.fm[f] *= expf(0.1f * jitter(random));
+            for (int b = 0; b < 4; b++) values.bw[b] *= expf(0.5f * jitter(random));
+            values.ampl *= expf(0.5f * jitter(random));
+        } else {
+            values.fm[0] = logUniform(random, 100, 1500);
+            values.fm[1] = logUniform(random, 300, 4000);
+            values.fm[2] = logUniform(random, 1000, 5000);
+            values.fm[3] = MEA8000_FM4_HZ;
+            for (int b = 0; b < 4; b++) values.bw[b] = logUniform(random, 20, 1500);
+            values.ampl  = random() % 8 ? logUniform(random, 0.0005f, 2) : 0;
+            values.noise = false;
+        }
+    }
+}
+
+
+// -- brute force -------------------------------------------------------------------
+
+// The nearest of the catalog frames
+static FrameKey nearestOf(const FrameIndex &index, const FrameValues &values, const vector<FrameKey> &frames) {
+    FrameKey    best     = frames[0];
+    float       distance = INFINITY;
+
+    for (FrameKey key : frames) {
+        byte frame [MEA8000_FRAME_SIZE];
+        keyFrame(key, frame);
+        float d = index.distance(values, frame);
+        if (d < distance) {
+            distance = d;
+            best     = key;
+        }
+    }
+    return best;
+}
+
+// The nearest frame of the whole grid. The distance of every value of a field comes
+// from FrameIndex::distance with the weight of that field alone, then all frames are summed.
+static void nearestOfGrid(const FrameIndex &index, const FrameValues &values, byte *nearest) {
+    float   fm1 [32], fm2 [32], fm3 [8], bw [4][4], ampl [16];
+    byte    frame [MEA8000_FRAME_SIZE];
+
+    for (int field = 0; field < 8; field++) {
+        FrameWeights weights;
+        memset(&weights, 0, sizeof(weights));
+        if (field < 3)      weights.fm[field]     = frameDefaultWeights.fm[field];
+        else if (field < 7) weights.bw[field - 3] = frameDefaultWeights.bw[field - 3];
+        else                weights.ampl          = frameDefaultWeights.ampl;
+
+        int count = field < 2 ? 32 : field == 2 ? 8 : field < 7 ? 4 : 16;
+        for (int v = 0; v < count; v++) {
+            byte bws [4] = { 0, 0, 0, 0 };
+            if (field >= 3 && field < 7) bws[field - 3] = v;
+            packFrame(frame, bws[0], bws[1], bws[2], bws[3], field == 2 ? v : 0, field == 1 ? v : 0,
+                      field == 0 ? v : 0, field == 7 ? v : 0, 0, 0);
+
+            float d = index.distance(values, frame, weights);
+            switch (field) {
+                case 0:  fm1[v] = d;            break;
+                case 1:  fm2[v] = d;            break;
+                case 2:  fm3[v] = d;            break;
+                case 7:  ampl[v] = d;           break;
+                default: bw[field - 3][v] = d;  break;
+            }
+        }
+    }
+
+    float   distance = INFINITY;
+    for (int f1 = 0; f1 < 32; f1++) for (int f2 = 0; f2 < 32; f2++) for (int f3 = 0; f3 < 8; f3++) {
+        float fm = fm1[f1] + fm2[f2] + fm3[f3];
+        for (int b = 0; b < 256; b++) {
+            float sum = fm + bw[0][b >> 6] + bw[1][(b >> 4) & 3] + bw[2][(b >> 2) & 3] + bw[3][b & 3];
+            for (int a = 0; a < 16; a++) {
+                if (sum + ampl[a] < distance) {
+                    distance = sum + ampl[a];
+                    packFrame(nearest, b >> 6, (b >> 4) & 3, (b >> 2) & 3, b & 3, f3, f2, f1, a, 0, 0);
+                }
+            }
+        }
+    }
+}
+
+// Counts a query where the index is farther than the search
+static bool farther(const FrameIndex &index, const FrameValues &values, const byte *found, const byte *searched) {
+    float a = index.distance(values, found), b = index.distance(values, searched);
+    if (a <= b) return false;
+
+    printf("  fm %.0f %.0f %.0f bw %.0f %.0f %.0f %.0f ampl %.4f: index %02X%02X%02X%02X at %g, search %02X%02X%02X%02X at %g\n",
+           values.fm[0], values.fm[1], values.fm[2], values.bw[0], values.bw[1], values.bw[2], values.bw[3], values.ampl,
+           found[0], found[1], found[2], found[3], a, searched[0], searched[1], searched[2], searched[3], b);
+    return true;
+}
+
+
+int main(int argc, char **argv) {
+    int         count = 1000, grid = 20;
+    unsigned    seed  = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "-n") && i + 1 < argc) count = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+        else if (!strcmp(argv[i], "-g") && i + 1 < argc) grid  = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 0;
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed  = (unsigned)atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: frameindexcheck [-n targets] [-g grid targets] [-s seed]\n");
+            return 1;
+        }
+    }
+    if (grid > count) grid = count;
+
+    FrameIndex      index;
+    set<FrameKey>   distinct;
+    for (int id = 0; id < SOUND_COUNT; id++) {
+        SoundSpan   span = catalogSound(id);
+        SoundStream stream(&span, 1);
+        byte        frame [MEA8000_FRAME_SIZE];
+        while (stream.nextFrame(frame)) distinct.insert(frameKey(frame));
+    }
+    vector<FrameKey> catalog(distinct.begin(), distinct.end());
+    printf("%zu distinct frames in the catalog (FD and PI left out)\n", catalog.size());
+
+    // The catalog frames come back as themselves
+    int failed = 0, wrong = 0;
+    for (FrameKey key : catalog) {
+        byte        frame [MEA8000_FRAME_SIZE], found [MEA8000_FRAME_SIZE];
+        FrameValues values;
+        keyFrame(key, frame);
+        frameValues(frame, &values);
+        index.nearest(values, found);
+        if (frameKey(found) != key) wrong += farther(index, values, found, frame) ? 1 : 0;
+    }
+    printf("catalog frames:  %6zu queries, %d farther than the frame itself\n", catalog.size(), wrong);
+    failed += wrong;
+
+    vector<FrameValues> targets;
+    makeTargets(catalog, count, seed, targets);
+
+    // Against the catalog frames
+    wrong = 0;
+    auto begin = chrono::steady_clock::now();
+    for (const FrameValues &values : targets) {
+        byte found [MEA8000_FRAME_SIZE], searched [MEA8000_FRAME_SIZE];
+        index.nearest(values, found);
+        keyFrame(nearestOf(index, values, catalog), searched);
+        wrong += farther(index, values, found, searched) ? 1 : 0;
+    }
+    double catalogTime = since(begin) / count;
+    printf("catalog search:  %6d queries, %d farther, %.1f us a search\n", count, wrong, catalogTime * 1e6);
+    failed += wrong;
+
+    // Against the whole grid
+    wrong = 0;
+    begin = chrono::steady_clock::now();
+    for (int i = 0; i < grid; i++) {
+        byte found [MEA8000_FRAME_SIZE], searched [MEA8000_FRAME_SIZE];
+        index.nearest(targets[i], found);
+        nearestOfGrid(index, targets[i], searched);
+        wrong += farther(index, targets[i], found, searched) ? 1 : 0;
+    }
+    double gridTime = grid ? since(begin) / grid : 0;
+    printf("grid search:     %6d queries, %d farther, %.0f ms a search\n", grid, wrong, gridTime * 1e3);
+    failed += wrong;
+
+    // The index alone, over and over for half a second
+    uint64_t    queries = 0;
+    unsigned    check   = 0;
+    begin = chrono::steady_clock::now();
+    double      seconds;
+    do {
+        for (const FrameValues &values : targets) {
+            byte frame [MEA8000_FRAME_SIZE];
+            index.nearest(values, frame);
+            check += frame[0] + frame[1] + frame[2] + frame[3];
+        }
+        queries += targets.size();
+    } while ((seconds = since(begin)) < 0.5);
+    printf("index:           %6.3f us a query (%.0f queries/s, check %u)\n", seconds / queries * 1e6, queries / seconds, check);
+
+    printf(failed ? "%d queries where the index was not the nearest\n" : "the index is exact on all queries\n", failed);
+    return failed ? 1 : 0;
+}
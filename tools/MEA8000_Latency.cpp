@@ -0,0 +1,95 @@
+/*
+
+    MEA8000_Latency.cpp
+
+    Host tool that shows what trimming the silent lead-in and lead-out of the words
+    (frenchSentence with 'trim', see trimmedSound in MEA8000_Catalog.h) does to the
+    time a sentence takes on the chip:
+
+        g++ -std=c++11 -O2 -I. -o latency tools/MEA8000_Latency.cpp MEA8000_Words.cpp MEA8000_WordTrie.cpp \
+            MEA8000_French.cpp MEA8000_Join.cpp MEA8000_Stream.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./latency ["sentence" ...]
+
+    The time is counted in steps of 8 ms, as the chip plays the frames: the time until
+    the first frame that is heard (time to speech), the time of the whole sentence and
+    the silence in it. The frames that are heard, and the pitch the first of them starts
+    at (spanPitch for the trimmed list), must be the same with and without trimming, the
+    tool stops with an error if they are not.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Stream.h"
+#include "MEA8000_Words.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+#define MAX_SPANS   64
+
+struct Timing {
+    int             first = -1;     // steps before the first frame that is heard
+    int             total = 0;
+    int             silent = 0;
+    int             pitch = 0;      // Hz, at the first frame that is heard
+    vector<byte>    heard;          // the frames that are heard
+};
+
+static Timing measure(const char *text, bool trim) {
+    SoundSpan   spans [MAX_SPANS];
+    byte        count = frenchSentence(text, spans, MAX_SPANS, 1, true, trim);
+    SoundStream stream(spans, count);
+    Timing      timing;
+    byte        frame [MEA8000_FRAME_SIZE];
+    int         pitch = count > 0 ? 2 * spanPitch(spans[0]) : 0;
+
+    while (stream.nextFrame(frame)) {
+        if (frameIsSilent(frame)) {
+            timing.silent += frameSteps(frame);
+        } else {
+            if (timing.first < 0) {
+                timing.first = timing.total;
+                timing.pitch = pitch;
+            }
+            timing.heard.insert(timing.heard.end(), frame, frame + MEA8000_FRAME_SIZE);
+        }
+        timing.total += frameSteps(frame);
+        pitch        += pitchIncrement(framePI(frame)) * frameSteps(frame);
+    }
+    return timing;
+}
+
+
+int main(int argc, char **argv) {
+    static const char  *examples [] = {
+        "bonjour madame", "il est midi", "quelle heure est-il ?", "c'est bien, recommence",
+        "la clef est dans la maison", "appuie sur la touche entree", "je ne comprends pas",
+    };
+    vector<const char *>    sentences(examples, examples + sizeof(examples) / sizeof(examples[0]));
+    int                     totals [2] = { 0, 0 }, firsts [2] = { 0, 0 };
+
+    if (argc > 1) sentences.assign(argv + 1, argv + argc);
+
+    printf("%-32s %21s %21s %21s\n", "", "time to speech (ms)", "whole sentence (ms)", "silence (ms)");
+    for (const char *text : sentences) {
+        Timing full    = measure(text, false);
+        Timing trimmed = measure(text, true);
+
+        if (full.heard != trimmed.heard || abs(full.pitch - trimmed.pitch) > 1) {
+            fprintf(stderr, "\"%s\": the frames heard are not the same when trimmed (start pitch %d / %d Hz)\n",
+                    text, full.pitch, trimmed.pitch);
+            return 1;
+        }
+        printf("%-32s %9d -> %-9d %9d -> %-9d %9d -> %-9d\n", text, full.first * 8, trimmed.first * 8,
+               full.total * 8, trimmed.total * 8, full.silent * 8, trimmed.silent * 8);
+        firsts[0] += full.first;    firsts[1] += trimmed.first;
+        totals[0] += full.total;    totals[1] += trimmed.total;
+    }
+    printf("%-32s %9d -> %-9d %9d -> %-9d\n", "all", firsts[0] * 8, firsts[1] * 8, totals[0] * 8, totals[1] * 8);
+    return 0;
+}
@@ -0,0 +1,371 @@
+/*
+
+    MEA8000_MakeCatalog.cpp
+
+    Host tool that writes the generated files of the catalog from MEA8000_Sounds.h
+    (and the data in the MEA8000_Sounds*.cpp files of the groups):
+
+        MEA8000_Catalog.cpp     all sounds in one table (the sound id is the index),
+                                with the silent frames at both ends of every sound
+        MEA8000_WordTrie.cpp    the words of catalog 2 and 3 as a trie in Flash
+        host/MEA8000_SoundNames.cpp     the names of the sounds, for the host tools
+
+    Run it from the root of the repository after adding or removing sounds:
+
+        g++ -std=c++11 -O2 -o makecatalog tools/MEA8000_MakeCatalog.cpp
+        ./makecatalog
+
+    The words are the names of the arrays, without Sound_C2_ / Sound_C3_:
+    - '_' stands for a space or an apostrophe (C_EST, QU_EST_CE, L_ECRAN).
+    - _NR (the numbers) is dropped, the _ugly variants are left out.
+    - The short forms of the numbers in front of CENT and MILLE are left out,
+      CIN_CENT_NR is only the "cin" of "cinq cents" (see partialNumbers).
+    - A sound in two parts (_A, _B) is one word of 2 sounds.
+    - A word that is twice in the catalogs uses the first one (catalog 2 before 3).
+    A few misspelled names also get the right spelling, see wordAliases.
+
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+struct Sound {
+    string          name;
+    int             length;
+    int             group;
+    vector<int>     data;
+    int             lead = 0;       // silent frames at the start and at the end, see soundTrim
+    int             tail = 0;
+};
+
+// The group names in the order of MEA8000_Sounds.h, see MEA8000_Catalog.h
+static const char *groupNames [] = {
+    "SOUND_GROUP_PHONEMES", "SOUND_GROUP_NATO", "SOUND_GROUP_SELF", "SOUND_GROUP_ENGLISH",
+    "SOUND_GROUP_CATALOG2", "SOUND_GROUP_CATALOG3", "SOUND_GROUP_EXTRA", "SOUND_GROUP_INTRO"
+};
+static const int groupCount = sizeof(groupNames) / sizeof(groupNames[0]);
+
+// The files with the data of the groups, see MEA8000_Sounds.cpp
+static const char *soundFiles [] = {
+    "MEA8000_SoundsPhonemes.cpp", "MEA8000_SoundsNato.cpp", "MEA8000_SoundsEnglish.cpp", "MEA8000_SoundsCatalog2.cpp",
+    "MEA8000_SoundsCatalog3.cpp", "MEA8000_SoundsIntro.cpp", "MEA8000_SoundsExtras.cpp"
+};
+
+static const char *partialNumbers [] = {
+    "CIN_CENT", "SI_CENT", "HUI_CENT", "DI_MILLE", "DIX_HUI_MILLE", "VIN_MILLE"
+};
+
+static const char *wordAliases [][2] = {
+    { "CAMPINGCAR",     "CAMPING_CAR"       },
+    { "DOLLARD",        "DOLLAR"            },
+    { "LAVE_VAISSEILE", "LAVE_VAISSELLE"    },
+    { "MULTIPILIE",     "MULTIPLIE"         },
+    { "PIJAMA",         "PYJAMA"            },
+};
+
+
+static vector<Sound> readSounds(const char *fileName) {
+    ifstream        file(fileName);
+    vector<Sound>   sounds;
+    string          line;
+    int             group = -1;
+    bool            newGroup = false;
+
+    if (!file) {
+        fprintf(stderr, "Can't read %s (run from the root of the repository)\n", fileName);
+        exit(1);
+    }
+    while (getline(file, line)) {
+        if (line.compare(0, 3, "// ") == 0) newGroup = true;
+        if (line.compare(0, 18, "extern const byte ") != 0) continue;
+
+        istringstream   words(line.substr(18));
+        Sound           sound;
+        char            bracket;
+
+        words >> sound.name >> bracket >> sound.length;
+        if (newGroup) group++;
+        newGroup = false;
+        sound.group = group;
+        sounds.push_back(sound);
+    }
+    if (group + 1 != groupCount) {
+        fprintf(stderr, "Found %d groups of sounds in %s, expected %d\n", group + 1, fileName, groupCount);
+        exit(1);
+    }
+    return sounds;
+}
+
+// The bytes of every array in 'fileName' (hexadecimal or decimal), added to those of other files
+static void readData(const char *fileName, vector<Sound> &sounds) {
+    ifstream            file(fileName);
+    map<string, int>    ids;
+    string              line;
+    Sound              *sound = NULL;
+
+    if (!file) {
+        fprintf(stderr, "Can't read %s (run from the root of the repository)\n", fileName);
+        exit(1);
+    }
+    for (size_t id = 0; id < sounds.size(); id++) ids[sounds[id].name] = (int)id;
+
+    while (getline(file, line)) {
+        size_t  at = 0;
+
+        if (line.compare(0, 15, "constexpr byte ") == 0) {
+            istringstream   words(line.substr(15));
+            string          name;
+
+            words >> name;
+            sound = ids.count(name) ? &sounds[ids[name]] : NULL;
+            at    = line.find('{');
+            if (at == string::npos) continue;
+            at++;
+        }
+        if (!sound) continue;
+
+        size_t  end = line.find("//");
+        if (end != string::npos) line.erase(end);
+        for (const char *c = line.c_str() + at; *c; ) {
+            char   *next;
+            long    value = strtol(c, &next, 0);
+            if (next != c) {
+                sound->data.push_back((int)value);
+                c = next;
+            } else if (*c == '}') {
+                sound = NULL;
+                break;
+            } else {
+                c++;
+            }
+        }
+    }
+}
+
+static bool endsWith(const string &text, const char *end) {
+    size_t  length = strlen(end);
+    return text.size() >= length && text.compare(text.size() - length, length, end) == 0;
+}
+
+
+// -- the silence at both ends -----------------------------------------------------
+
+// The same tests as isSoundHeader and frameIsSilent (MEA8000_Frame.h)
+static bool looksLikeHeader(const int *bytes)   { return bytes[0] <= 1 && bytes[2] < 64 && bytes[3] >= 32 && bytes[3] < 64; }
+static bool silentFrame(const int *frame)       { return (frame[2] & 0x07) == 0 && (frame[3] & 0x80) == 0; }
+
+static int headerSize(const Sound &sound)       { return sound.length >= 4 && looksLikeHeader(sound.data.data()) ? 4 : 0; }
+static int frameCount(const Sound &sound)       { return (sound.length - headerSize(sound)) / 4; }
+
+// A sound that is all silence (NoSound) is kept as it is. The first frame that is kept
+// must not look like a header, the player would skip it (a frame more of the lead-in is kept).
+static void findTrim(Sound &sound) {
+    int         frames = frameCount(sound);
+    const int  *frame  = sound.data.data() + headerSize(sound);
+
+    while (sound.lead < frames && silentFrame(frame + 4 * sound.lead)) sound.lead++;
+    if (sound.lead == frames) {
+        sound.lead = 0;
+        return;
+    }
+    while (silentFrame(frame + 4 * (frames - 1 - sound.tail))) sound.tail++;
+    while (sound.lead > 0 && looksLikeHeader(frame + 4 * sound.lead)) sound.lead--;
+
+    if (sound.lead > 255 || sound.tail > 255) {
+        fprintf(stderr, "%s: more than 255 silent frames\n", sound.name.c_str());
+        exit(1);
+    }
+}
+
+// Steps (8 ms) of the frames from..to of a sound
+static int steps(const Sound &sound, int from, int to) {
+    int total = 0;
+    for (int k = from; k < to; k++) total += 1 << ((sound.data[headerSize(sound) + 4 * k + 3] >> 5) & 0x03);
+    return total;
+}
+
+
+// -- the trie ----------------------------------------------------------------------
+
+struct TrieNode {
+    map<int, TrieNode>      children;       // by letter: 0 = '_', 1 .. 26 = A .. Z
+    int                     value = -1;
+};
+
+// 'value' is the sound id, with the number of extra parts (0 .. 3) in bits 12-13
+static void addWord(TrieNode &root, const string &key, int value, map<string, int> &words) {
+    if (words.count(key)) return;
+    words[key] = value;
+
+    TrieNode   *node = &root;
+    for (char c : key) node = &node->children[c == '_' ? 0 : c - 'A' + 1];
+    node->value = value;
+}
+
+static void addSkip(vector<unsigned char> &out, size_t skip) {
+    if (skip < 0x80) {
+        out.push_back((unsigned char)skip);
+    } else {
+        if (skip > 0x7FFF) { fprintf(stderr, "Trie too large\n"); exit(1); }
+        out.push_back((unsigned char)(0x80 | (skip >> 8)));
+        out.push_back((unsigned char)(skip & 0xFF));
+    }
+}
+
+// The layout is described in MEA8000_Words.cpp
+static vector<unsigned char> writeChildren(const TrieNode &node) {
+    vector<unsigned char>   out;
+    size_t                  left = node.children.size();
+
+    for (const auto &child : node.children) {
+        vector<unsigned char>   below = writeChildren(child.second);
+        bool                    last = --left == 0;
+
+        out.push_back((unsigned char)(child.first
+                                      | (child.second.value >= 0 ? 0x20 : 0)
+                                      | (below.empty() ? 0 : 0x40)
+                                      | (last ? 0x80 : 0)));
+        if (child.second.value >= 0) {
+            out.push_back((unsigned char)(child.second.value >> 8));
+            out.push_back((unsigned char)(child.second.value & 0xFF));
+        }
+        if (!last) addSkip(out, below.size());
+        out.insert(out.end(), below.begin(), below.end());
+    }
+    return out;
+}
+
+
+// -- the output files --------------------------------------------------------------
+
+static FILE *create(const char *fileName) {
+    FILE   *file = fopen(fileName, "w");
+    if (!file) {
+        fprintf(stderr, "Can't write %s\n", fileName);
+        exit(1);
+    }
+    return file;
+}
+
+static void writeCatalog(const vector<Sound> &sounds) {
+    FILE   *file = create("MEA8000_Catalog.cpp");
+    int     first [groupCount + 1];
+
+    fprintf(file, "/*\n\n    MEA8000_Catalog.cpp\n\n"
+                  "    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.\n\n */\n\n"
+                  "#include \"MEA8000_Catalog.h\"\n\n\n"
+                  "const SoundSpan soundCatalog [SOUND_COUNT] PROGMEM = {\n");
+    for (size_t id = 0; id < sounds.size(); id++) {
+        if (id == 0 || sounds[id].group != sounds[id - 1].group) {
+            first[sounds[id].group] = (int)id;
+            fprintf(file, "%s    // %s\n", id ? "\n" : "", groupNames[sounds[id].group]);
+        }
+        fprintf(file, "    SOUND(%s),\n", sounds[id].name.c_str());
+    }
+    first[groupCount] = (int)sounds.size();
+
+    fprintf(file, "};\n\n"
+                  "const SoundTrim soundTrim [SOUND_COUNT] PROGMEM = {");
+    for (size_t id = 0; id < sounds.size(); id++) {
+        if (id % 8 == 0) fprintf(file, "\n   ");
+        fprintf(file, " { %d, %d },", sounds[id].lead, sounds[id].tail);
+    }
+    fprintf(file, "\n};\n\n"
+                  "const uint16_t soundGroupFirst [SOUND_GROUPS + 1] PROGMEM = {\n   ");
+    for (int group = 0; group <= groupCount; group++) fprintf(file, " %d,", first[group]);
+    fprintf(file, "\n};\n\n"
+                  "static_assert(SOUND_COUNT == %d, \"SOUND_COUNT in MEA8000_Catalog.h is out of date\");\n",
+                  (int)sounds.size());
+    fclose(file);
+}
+
+static void writeNames(const vector<Sound> &sounds) {
+    FILE   *file = create("host/MEA8000_SoundNames.cpp");
+
+    fprintf(file, "/*\n\n    MEA8000_SoundNames.cpp\n\n"
+                  "    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.\n\n */\n\n"
+                  "#include \"MEA8000_SoundNames.h\"\n\n\n"
+                  "const char *const soundNames [SOUND_COUNT] = {\n");
+    for (const Sound &sound : sounds) fprintf(file, "    \"%s\",\n", sound.name.c_str());
+    fprintf(file, "};\n");
+    fclose(file);
+}
+
+static void writeTrie(const vector<unsigned char> &trie, size_t words) {
+    FILE   *file = create("MEA8000_WordTrie.cpp");
+
+    fprintf(file, "/*\n\n    MEA8000_WordTrie.cpp\n\n"
+                  "    Generated by tools/MEA8000_MakeCatalog.cpp from MEA8000_Sounds.h, do not edit.\n"
+                  "    %d words in %d bytes.\n\n */\n\n"
+                  "#include \"MEA8000_Words.h\"\n\n\n"
+                  "const byte frenchWordTrie [%d] PROGMEM = {",
+                  (int)words, (int)trie.size(), (int)trie.size());
+    for (size_t i = 0; i < trie.size(); i++) {
+        fprintf(file, "%s0x%02x%s", i % 16 ? "" : "\n    ", trie[i], i + 1 < trie.size() ? (i % 16 == 15 ? "," : ", ") : "");
+    }
+    fprintf(file, "\n};\n");
+    fclose(file);
+}
+
+
+int main() {
+    vector<Sound>       sounds = readSounds("MEA8000_Sounds.h");
+    TrieNode            root;
+    map<string, int>    words;
+    int                 leadSteps = 0, tailSteps = 0;
+
+    for (const char *fileName : soundFiles) readData(fileName, sounds);
+    for (const Sound &sound : sounds) {
+        if ((int)sound.data.size() != sound.length) {
+            fprintf(stderr, "%s has %d bytes in the MEA8000_Sounds*.cpp files, expected %d\n", sound.name.c_str(), (int)sound.data.size(), sound.length);
+            exit(1);
+        }
+    }
+    for (Sound &sound : sounds) {
+        findTrim(sound);
+        leadSteps += steps(sound, 0, sound.lead);
+        tailSteps += steps(sound, frameCount(sound) - sound.tail, frameCount(sound));
+    }
+
+    for (size_t id = 0; id < sounds.size(); id++) {
+        const string   &name = sounds[id].name;
+        string          key;
+
+        if (name.compare(0, 9, "Sound_C2_") != 0 && name.compare(0, 9, "Sound_C3_") != 0) continue;
+        key = name.substr(9);
+        if (endsWith(key, "_ugly")) continue;
+        if (endsWith(name, "_B") && sounds[id - 1].name == name.substr(0, name.size() - 2) + "_A") continue;
+        if (endsWith(key, "_NR")) key.erase(key.size() - 3);
+        if (endsWith(key, "_2")) key.erase(key.size() - 2);
+
+        int     value = (int)id;
+        if (endsWith(key, "_A") && id + 1 < sounds.size()
+            && sounds[id + 1].name == name.substr(0, name.size() - 2) + "_B") {
+            key.erase(key.size() - 2);
+            value |= 1 << 12;
+        }
+        bool    partial = false;
+        for (auto number : partialNumbers) partial |= key == number;
+        if (partial) continue;
+
+        addWord(root, key, value, words);
+        for (auto &alias : wordAliases) if (key == alias[0]) addWord(root, alias[1], value, words);
+    }
+
+    vector<unsigned char>   trie = writeChildren(root);
+    writeCatalog(sounds);
+    writeNames(sounds);
+    writeTrie(trie, words.size());
+    printf("%d sounds, %d words, trie %d bytes\n", (int)sounds.size(), (int)words.size(), (int)trie.size());
+    printf("silence: %d ms at the start, %d ms at the end of the sounds\n", leadSteps * 8, tailSteps * 8);
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+
+    MEA8000_MakeLoudness.cpp
+
+    Host tool that measures the loudness of every sound of the catalog and writes the
+    corrections to MEA8000_LoudnessTable.cpp (see MEA8000_Loudness.h). Run it from the
+    root of the repository after adding or changing sounds (and MakeCatalog):
+
+        g++ -std=c++11 -O2 -I. -o makeloudness tools/MEA8000_MakeLoudness.cpp \
+            host/MEA8000_Render.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./makeloudness
+
+    The level of a sound is the mean power of its 8 ms blocks that are less than 30 dB
+    below its loudest one, so pauses and the silent ends don't count. The target is the
+    median level of all sounds, every sound gets the AMPL steps (3 dB) closest to it.
+    The levels are measured again with the corrected frames (a frame can't go above
+    AMPL 15 or below 1), the spread before and after is printed by group.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_Loudness.h"
+#include "host/MEA8000_Render.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+
+#define GATE_DB     30
+#define NO_LEVEL    -1000.0f        // a sound that is all silence
+
+
+static float level(const vector<float> &samples) {
+    vector<float>   power;
+    float           loudest = 0;
+
+    for (size_t block = 0; block + MEA8000_STEP_SAMPLES <= samples.size(); block += MEA8000_STEP_SAMPLES) {
+        float sum = 0;
+        for (int n = 0; n < MEA8000_STEP_SAMPLES; n++) sum += samples[block + n] * samples[block + n];
+        power.push_back(sum / MEA8000_STEP_SAMPLES);
+        loudest = max(loudest, power.back());
+    }
+    if (loudest <= 0) return NO_LEVEL;
+
+    double  sum   = 0;
+    int     count = 0;
+    for (float p : power) {
+        if (p < loudest * powf(10, -GATE_DB / 10.0f)) continue;
+        sum += p;
+        count++;
+    }
+    return 10 * log10f((float)(sum / count));
+}
+
+// The sound with 'steps' added to the AMPL of its frames
+static vector<float> corrected(SoundSpan span, int steps) {
+    vector<byte>    data(span.data, span.data + span.length);
+    byte            header = soundHeaderSize(span.data, span.length);
+
+    for (size_t offset = header; offset + MEA8000_FRAME_SIZE <= data.size(); offset += MEA8000_FRAME_SIZE) {
+        setFrameAMPL(&data[offset], loudnessAMPL(frameAMPL(&data[offset]), steps));
+    }
+    return renderSound(data.data(), (uint16_t)data.size());
+}
+
+static void spread(const char *title, const vector<float> &levels, float target) {
+    static const char *groups [] = { "phonemes", "NATO", "self", "English", "catalog 2", "catalog 3", "extra", "intro" };
+
+    printf("%s\n", title);
+    for (byte group = 0; group < SOUND_GROUPS; group++) {
+        double  sum = 0, squares = 0;
+        int     count = 0;
+        for (uint16_t id = soundGroupBegin(group); id < soundGroupEnd(group); id++) {
+            if (levels[id] == NO_LEVEL) continue;
+            sum     += levels[id] - target;
+            squares += (levels[id] - target) * (levels[id] - target);
+            count++;
+        }
+        if (count) printf("    %-10s %4d sounds, mean %+6.1f dB, rms from the target %5.1f dB\n",
+                          groups[group], count, sum / count, sqrt(squares / count));
+    }
+}
+
+
+int main() {
+    vector<float>   levels(SOUND_COUNT), after(SOUND_COUNT), sorted;
+    vector<int>     steps(SOUND_COUNT, 0);
+
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        SoundSpan span = catalogSound(id);
+        levels[id] = level(renderSound(span.data, span.length));
+        if (levels[id] != NO_LEVEL) sorted.push_back(levels[id]);
+    }
+    sort(sorted.begin(), sorted.end());
+    float target = sorted[sorted.size() / 2];
+
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        if (levels[id] != NO_LEVEL) steps[id] = max(-15, min(15, (int)lroundf((target - levels[id]) / LOUDNESS_STEP_DB)));
+        after[id] = levels[id] == NO_LEVEL ? NO_LEVEL : level(corrected(catalogSound(id), steps[id]));
+    }
+
+    FILE *file = fopen("MEA8000_LoudnessTable.cpp", "w");
+    if (!file) {
+        fprintf(stderr, "Can't write MEA8000_LoudnessTable.cpp\n");
+        return 1;
+    }
+    fprintf(file, "/*\n\n    MEA8000_LoudnessTable.cpp\n\n"
+                  "    Generated by tools/MEA8000_MakeLoudness.cpp, do not edit.\n"
+                  "    Target level %.1f dB (host renderer).\n\n */\n\n"
+                  "#include \"MEA8000_Loudness.h\"\n\n\n"
+                  "const int8_t soundLoudness [SOUND_COUNT] PROGMEM = {", target);
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) fprintf(file, "%s%3d,", id % 16 ? " " : "\n   ", steps[id]);
+    fprintf(file, "\n};\n");
+    fclose(file);
+
+    printf("Target %.1f dB\n", target);
+    spread("Before:", levels, target);
+    spread("After:", after, target);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+
+    MEA8000_MakeSynthTables.cpp
+
+    Host tool that writes MEA8000_SoftSynthTables.cpp, the fixed point tables of the
+    software synthesizer (see MEA8000_SoftSynth.h). Run it from the root of the repository:
+
+        g++ -std=c++11 -O2 -I. -o makesynthtables tools/MEA8000_MakeSynthTables.cpp MEA8000_Tables.cpp
+        ./makesynthtables
+
+    - softResonators: b and c of the 2-pole filter y = a x + b y1 + c y2 (a = 1 - b - c)
+      for every formant frequency and bandwidth, in 1/8192 (SOFTSYNTH_COEF_BITS).
+      Rows 0 .. 31 are FM1, 32 .. 63 FM2, 64 .. 71 FM3, 72 is FM4 (3500 Hz).
+    - softPulseGain: sqrt(8000 / pitch) for the pitch in steps of 8 Hz, in 1/8, so the
+      power of the pulse train doesn't depend on the pitch (as in host/MEA8000_Render).
+
+ */
+
+#include "MEA8000_Tables.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+
+static void resonator(float fm, float bw, int *b, int *c) {
+    float r = expf(-(float)M_PI * bw / MEA8000_SAMPLE_RATE);
+    *b = (int)lroundf(2 * r * cosf(2 * (float)M_PI * fm / MEA8000_SAMPLE_RATE) * 8192);
+    *c = (int)lroundf(-r * r * 8192);
+}
+
+int main() {
+    vector<float> rows;
+    for (int i = 0; i < 32; i++) rows.push_back(frameFM1Hz[i]);
+    for (int i = 0; i < 32; i++) rows.push_back(frameFM2Hz[i]);
+    for (int i = 0; i < 8; i++)  rows.push_back(frameFM3Hz[i]);
+    rows.push_back(MEA8000_FM4_HZ);
+
+    FILE *file = fopen("MEA8000_SoftSynthTables.cpp", "w");
+    if (!file) {
+        fprintf(stderr, "Can't write MEA8000_SoftSynthTables.cpp\n");
+        return 1;
+    }
+    fprintf(file, "/*\n\n    MEA8000_SoftSynthTables.cpp\n\n"
+                  "    Generated by tools/MEA8000_MakeSynthTables.cpp, do not edit.\n\n */\n\n"
+                  "#include \"MEA8000_SoftSynth.h\"\n\n\n"
+                  "const SoftResonator softResonators [SOFTSYNTH_ROWS][4] PROGMEM = {\n");
+    for (size_t row = 0; row < rows.size(); row++) {
+        fprintf(file, "    {");
+        for (int bw = 0; bw < 4; bw++) {
+            int b, c;
+            resonator(rows[row], frameBWHz[bw], &b, &c);
+            fprintf(file, " { %6d, %6d }%s", b, c, bw < 3 ? "," : "");
+        }
+        fprintf(file, " },     // %4.0f Hz\n", rows[row]);
+    }
+    fprintf(file, "};\n\n"
+                  "const byte softPulseGain [128] PROGMEM = {");
+    for (int i = 0; i < 128; i++) {
+        float pitch = i * 8 + 4;
+        fprintf(file, "%s%3d,", i % 16 ? " " : "\n   ", (int)lroundf(sqrtf(MEA8000_SAMPLE_RATE / fmaxf(pitch, 16)) * 8));
+    }
+    fprintf(file, "\n};\n");
+    fclose(file);
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+
+    MEA8000_Mix.cpp
+
+    Host tool that says several texts at once, each on its own channel of the mixer
+    (host/MEA8000_Mixer.h), and writes the mix to an audio sink (a WAV file by default):
+
+        g++ -std=c++11 -O2 -pthread -I. -o mix tools/MEA8000_Mix.cpp host/MEA8000_Mixer.cpp \
+            host/MEA8000_Sink.cpp host/MEA8000_Render.cpp host/MEA8000_Wav.cpp MEA8000_Words.cpp \
+            MEA8000_WordTrie.cpp MEA8000_French.cpp MEA8000_Join.cpp MEA8000_Stream.cpp \
+            MEA8000_Numbers.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./mix [-s sink] [-x speed] "text" [number] ...
+
+    The sink is "wav:mix.wav" by default, see openSink (host/MEA8000_Sink.h). A text is a
+    French sentence (frenchSentence), a number is said with frenchNumber.
+    The main thread plays the audio callback: a block of MIXER_BLOCK samples at a time,
+    'speed' times faster than real time (default 4). It shows the underruns and the time
+    the callback took.
+
+ */
+
+#include "host/MEA8000_Mixer.h"
+#include "host/MEA8000_Sink.h"
+#include "MEA8000_Numbers.h"
+#include "MEA8000_Words.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+
+#define MAX_SPANS   64
+
+
+int main(int argc, char **argv) {
+    const char      *output = "wav:mix.wav";
+    double          speed   = 4;
+    vector<const char *> texts;
+
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "-s") && i + 1 < argc) output = argv[++i];
+        else if (!strcmp(argv[i], "-x") && i + 1 < argc) speed  = atof(argv[++i]);
+        else                                             texts.push_back(argv[i]);
+    }
+    if (texts.empty() || (int)texts.size() > MIXER_CHANNELS || speed <= 0) {
+        fprintf(stderr, "usage: mix [-s sink] [-x speed] \"text\" [number] ... (at most %d)\n", MIXER_CHANNELS);
+        return 1;
+    }
+
+    unique_ptr<AudioSink> sink(openSink(output));
+    if (!sink) return 1;
+
+    Mixer       mixer((int)texts.size());
+    SoundSpan   spans [MAX_SPANS];
+    for (size_t i = 0; i < texts.size(); i++) {
+        const char  *text = texts[i];
+        byte        count = strspn(text, "0123456789") == strlen(text) ? frenchNumber(strtoul(text, NULL, 10), spans)
+                                                                      : frenchSentence(text, spans, MAX_SPANS);
+        mixer.say((int)i, spans, count);
+    }
+
+    int16_t         block [MIXER_BLOCK];
+    double          worst = 0, total = 0;
+    int             callbacks = 0;
+    auto            period = duration<double>(MIXER_BLOCK / (MEA8000_SAMPLE_RATE * speed));
+    auto            next   = steady_clock::now();
+
+    while (mixer.busy()) {
+        auto start = steady_clock::now();
+        mixer.mix(block, MIXER_BLOCK);
+        double took = duration<double, micro>(steady_clock::now() - start).count();
+
+        worst  = max(worst, took);
+        total += took;
+        callbacks++;
+        sink->write(block, MIXER_BLOCK);
+
+        next += duration_cast<steady_clock::duration>(period);
+        this_thread::sleep_until(next);
+    }
+
+    fprintf(stderr, "%d channels, %.2f s, %d callbacks of %d samples, %u underruns\n", mixer.channels(),
+            sink->samples() / (double)MEA8000_SAMPLE_RATE, callbacks, MIXER_BLOCK, mixer.underruns());
+    fprintf(stderr, "callback: %.1f us on average, %.1f us at most (a block lasts %.0f us)\n",
+            callbacks ? total / callbacks : 0, worst, MIXER_BLOCK * 1e6 / MEA8000_SAMPLE_RATE);
+    return sink->finish() ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+/*
+
+    MEA8000_RenderBench.cpp
+
+    Host tool that renders all sounds of the catalog into an audio sink (host/MEA8000_Sink.h)
+    and shows how fast that went:
+
+        g++ -std=c++11 -O2 -I. -o renderbench tools/MEA8000_RenderBench.cpp host/MEA8000_Sink.cpp \
+            host/MEA8000_Render.cpp host/MEA8000_Wav.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp \
+            MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./renderbench [-s sink] [-n rounds]
+
+    The sink is "null" (the default: the rendering alone), "wav:<file>" or "raw:<file>",
+    "raw:-" writes the samples to stdout (the report goes to stderr):
+
+        ./renderbench -s raw:- | aplay -f S16_LE -r 8000
+
+    The sounds are rendered one after the other, each with a new renderer, 'rounds' times.
+
+ */
+
+#include "host/MEA8000_Sink.h"
+#include "MEA8000_Catalog.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+using namespace std;
+
+
+int main(int argc, char **argv) {
+    const char  *description = "null";
+    int         rounds       = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "-s") && i + 1 < argc) description = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) rounds      = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: renderbench [-s null | wav:<file> | raw:<file>] [-n rounds]\n");
+            return 1;
+        }
+    }
+
+    unique_ptr<AudioSink> sink(openSink(description));
+    if (!sink) return 1;
+
+    auto    started = chrono::steady_clock::now();
+    float   samples [SYNTH_MAX_SAMPLES];
+
+    for (int round = 0; round < rounds; round++) {
+        for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+            SoundSpan   span   = catalogSound(id);
+            uint16_t    offset = soundHeaderSize(span.data, span.length);
+            Synth       synth;
+
+            synth.begin(offset ? 2.0f * span.data[2] : 2 * MEA8000_DEFAULT_PITCH);
+            for (; offset + MEA8000_FRAME_SIZE <= span.length; offset += MEA8000_FRAME_SIZE) {
+                sink->write(samples, synth.render(span.data + offset, samples));
+            }
+        }
+    }
+    bool    ok      = sink->finish();
+    double  seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+    double  audio   = sink->samples() / (double)MEA8000_SAMPLE_RATE;
+
+    fprintf(stderr, "%s: %d x %d sounds, %.1f s of audio (%.1f MB) in %.3f s, %.0f times real time, %.1f MB/s\n",
+            description, rounds, SOUND_COUNT, audio, sink->samples() * 2 / 1e6, seconds, audio / seconds,
+            sink->samples() * 2 / 1e6 / seconds);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+/*
+
+    MEA8000_SeekBench.cpp
+
+    Host tool that measures how long it takes to render from a random position in the
+    long sounds (the intro, the longest words), from the start of the sound and from the
+    checkpoints of host/MEA8000_Checkpoints, for a few checkpoint distances:
+
+        g++ -std=c++11 -O2 -I. -o seekbench tools/MEA8000_SeekBench.cpp host/MEA8000_Checkpoints.cpp \
+            host/MEA8000_Render.cpp host/MEA8000_SoundNames.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp \
+            MEA8000_Tables.cpp MEA8000_Voice.cpp
+        ./seekbench
+
+    Every seek renders 20 ms (160 samples) and checks them against a render of the
+    whole sound: they must be the same.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "host/MEA8000_Checkpoints.h"
+#include "host/MEA8000_SoundNames.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+
+#define SEEKS           200
+#define SEEK_SAMPLES    160
+
+
+int main() {
+    static const int    distances [] = { 1, 4, 8, 32 };
+    vector<uint16_t>    ids;
+
+    // The 5 longest sounds
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) ids.push_back(id);
+    sort(ids.begin(), ids.end(), [](uint16_t a, uint16_t b) { return catalogSound(a).length > catalogSound(b).length; });
+    ids.resize(5);
+
+    printf("%-30s %7s %12s", "", "frames", "from start");
+    for (int every : distances) printf("   every %-2d (bytes)", every);
+    printf("\n");
+
+    srand(1);
+    for (uint16_t id : ids) {
+        SoundSpan           span = catalogSound(id);
+        vector<float>       whole = renderSound(span.data, span.length);
+        vector<uint32_t>    positions;
+        float               out [SEEK_SAMPLES];
+
+        for (int i = 0; i < SEEKS; i++) positions.push_back((uint32_t)(rand() % (whole.size() - SEEK_SAMPLES)));
+        printf("%-30s %7d", soundNames[id] + 6, (span.length - soundHeaderSize(span.data, span.length)) / MEA8000_FRAME_SIZE);
+
+        for (int run = -1; run < (int)(sizeof(distances) / sizeof(distances[0])); run++) {
+            CheckpointedSound   sound;
+            int                 every = run < 0 ? 0x7FFF : distances[run];      // one checkpoint: from the start
+
+            sound.begin(span.data, span.length, every);
+            auto start = chrono::steady_clock::now();
+            for (uint32_t position : positions) {
+                if (sound.render(position, out, SEEK_SAMPLES) != SEEK_SAMPLES
+                    || !equal(out, out + SEEK_SAMPLES, whole.begin() + position)) {
+                    fprintf(stderr, "\n%s: samples from %u are not the same\n", soundNames[id], position);
+                    return 1;
+                }
+            }
+            double us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / SEEKS;
+            if (run < 0) printf(" %9.1f us", us);
+            else         printf(" %9.1f us (%4d)", us, (int)(sound.checkpoints() * sizeof(SynthState)));
+        }
+        printf("\n");
+    }
+    return 0;
+}
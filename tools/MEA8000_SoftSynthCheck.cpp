@@ -0,0 +1,139 @@
+/*
+
+    MEA8000_SoftSynthCheck.cpp
+
+    Host tool that checks the software synthesizer (MEA8000_SoftSynth) against the host
+    renderer (host/MEA8000_Render), on every sound of the catalog, and counts its cycles:
+
+        g++ -std=c++11 -O2 -I. -DSOFTSYNTH_COUNT_CYCLES -o softsynthcheck tools/MEA8000_SoftSynthCheck.cpp \
+            MEA8000_SoftSynth.cpp MEA8000_SoftSynthTables.cpp MEA8000_Flash.cpp MEA8000_Stream.cpp MEA8000_Catalog.cpp \
+            MEA8000_Sounds*.cpp MEA8000_Tables.cpp MEA8000_Voice.cpp host/MEA8000_Render.cpp \
+            host/MEA8000_Cepstrum.cpp host/MEA8000_SoundNames.cpp host/MEA8000_Wav.cpp
+        ./softsynthcheck [sound name]
+
+    For every sound: the spectral distance between the two renders (host/MEA8000_Cepstrum,
+    the same scale as tools/MEA8000_Duplicates: below 1.5 is "the same sound"), the level
+    difference, and the estimated ATmega cycles per sample (mean, and the worst sample:
+    one that starts a frame). With a sound name both renders are written as WAV files.
+
+    The frames come from a FramePrefetch, filled every 8 ms (64 samples) as by a main
+    loop, the way MEA8000_SoftSynth.h says it must be done; an underrun is an error.
+
+    The cycles are a fixed estimate (SOFTSYNTH_COST in MEA8000_SoftSynth.cpp, from counting
+    the instructions avr-gcc makes of each part), not a measurement: the worst sample is
+    the sum of the parts of a frame start, whatever the sound. What it shows is that all
+    of them fit in a sample, with the frame read from the prefetch and not from Flash.
+
+ */
+
+#include "MEA8000_Catalog.h"
+#include "MEA8000_SoftSynth.h"
+#include "host/MEA8000_Cepstrum.h"
+#include "host/MEA8000_Render.h"
+#include "host/MEA8000_SoundNames.h"
+#include "host/MEA8000_Wav.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+#define CPU_HZ      16000000UL
+#define FILL_EVERY  64          // samples between two fills of the prefetch (8 ms)
+
+
+static float rms(const vector<float> &samples) {
+    double sum = 0;
+    for (float s : samples) sum += s * s;
+    return samples.empty() ? 0 : (float)sqrt(sum / samples.size());
+}
+
+// The sound with SoftSynth, in the units of the host renderer
+static vector<float> softRender(uint16_t id, uint32_t *worst, double *seconds, uint16_t *underruns) {
+    SoundSpan       span = catalogSound(id);
+    byte            header = soundHeaderSize(span.data, span.length);
+    SoundStream     stream(&span, 1);
+    FramePrefetch   prefetch(&stream);
+    SoftSynth       synth;
+    vector<float>   samples;
+
+    prefetch.fill();
+    synth.begin(&prefetch, header ? pgm_read_byte(span.data + 2) : MEA8000_DEFAULT_PITCH);
+    *worst = 0;
+    auto start = chrono::steady_clock::now();
+    for (;;) {
+        if (samples.size() % FILL_EVERY == 0) prefetch.fill();
+
+        uint32_t before = softSynthCycles;
+        int16_t  value  = synth.nextValue();
+        if (synth.isDone()) break;
+        *worst = max(*worst, softSynthCycles - before);
+        samples.push_back(value / 64.0f);
+    }
+    *seconds   = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    *underruns = prefetch.underruns();
+    return samples;
+}
+
+
+int main(int argc, char **argv) {
+    uint16_t            only = argc > 1 ? soundId(argv[1]) : SOUND_NONE;
+    vector<float>       distances;
+    uint32_t            worstAll = 0;
+    double              seconds = 0, levels = 0;
+    size_t              samples = 0;
+    int                 counted = 0, underrun = 0;
+
+    if (argc > 1 && only == SOUND_NONE) {
+        fprintf(stderr, "There is no sound %s\n", argv[1]);
+        return 1;
+    }
+    for (uint16_t id = 0; id < SOUND_COUNT; id++) {
+        if (only != SOUND_NONE && id != only) continue;
+
+        SoundSpan       span = catalogSound(id);
+        vector<float>   host = renderSound(span.data, span.length);
+        uint32_t        worst;
+        double          time;
+        uint16_t        underruns;
+
+        softSynthCycles = 0;
+        vector<float>   soft = softRender(id, &worst, &time, &underruns);
+        if (underruns) {
+            fprintf(stderr, "%s: %u underruns of the prefetch\n", soundNames[id], underruns);
+            underrun++;
+        }
+        float           distance = soundDistance(cepstra(host), cepstra(soft));
+
+        seconds  += time;
+        samples  += soft.size();
+        worstAll  = max(worstAll, worst);
+        if (rms(host) > 0 && rms(soft) > 0) {
+            distances.push_back(distance);
+            levels += 20 * log10f(rms(soft) / rms(host));
+            counted++;
+        }
+        if (only != SOUND_NONE) {
+            printf("%s: distance %.2f, level %+.1f dB, %.0f cycles a sample, at most %u\n", soundNames[id], distance,
+                   20 * log10f(rms(soft) / rms(host)), (double)softSynthCycles / soft.size(), worst);
+            string name = soundNames[id];
+            writeWav((name + "_host.wav").c_str(), host, MEA8000_SAMPLE_RATE, wavNormalize(host));
+            writeWav((name + "_soft.wav").c_str(), soft, MEA8000_SAMPLE_RATE, wavNormalize(soft));
+        }
+    }
+    if (only != SOUND_NONE) return underrun ? 1 : 0;
+
+    sort(distances.begin(), distances.end());
+    printf("%d sounds: distance median %.2f, 90%% %.2f, worst %.2f, level %+.1f dB\n", counted,
+           distances[distances.size() / 2], distances[distances.size() * 9 / 10], distances.back(), levels / counted);
+    printf("ATmega at %lu MHz: at most %u of %lu cycles a sample (a fixed estimate, the frame from a FramePrefetch)\n",
+           CPU_HZ / 1000000, worstAll, CPU_HZ / MEA8000_SAMPLE_RATE);
+    printf("host: %.1f ns a sample\n", seconds * 1e9 / samples);
+    if (underrun) fprintf(stderr, "%d sounds had underruns of the prefetch\n", underrun);
+    return underrun ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+/*
+
+    MEA8000_SoundSizes.cpp
+
+    Host tool that shows the Flash the groups of sounds take (see MEA8000_Sounds.cpp), and
+    with the symbols of a program what of it was linked in:
+
+        g++ -std=c++11 -O2 -I. -o soundsizes tools/MEA8000_SoundSizes.cpp \
+            host/MEA8000_SoundNames.cpp MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./soundsizes [symbols]
+
+    'symbols' is the output of nm -S for the program (avr-nm -S sketch.elf > symbols, '-'
+    for stdin). The sounds of the program are found by name, with their sizes.
+
+ */
+
+#include "host/MEA8000_SoundNames.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+using namespace std;
+
+
+struct GroupInfo {
+    const char  *name;
+    const char  *file;
+};
+
+// In the order of SoundGroup (MEA8000_Catalog.h)
+static const GroupInfo groups [SOUND_GROUPS] = {
+    { "phonemes",       "MEA8000_SoundsPhonemes.cpp" },
+    { "NATO alphabet",  "MEA8000_SoundsNato.cpp" },
+    { "self designed",  "MEA8000_SoundsExtras.cpp" },
+    { "English numbers","MEA8000_SoundsEnglish.cpp" },
+    { "catalog 2",      "MEA8000_SoundsCatalog2.cpp" },
+    { "catalog 3",      "MEA8000_SoundsCatalog3.cpp" },
+    { "extra",          "MEA8000_SoundsExtras.cpp" },
+    { "intro",          "MEA8000_SoundsIntro.cpp" },
+};
+
+// The sizes of the symbols in the output of nm -S, by name
+static bool readSymbols(const char *fileName, map<string, unsigned long> &symbols) {
+    FILE *file = strcmp(fileName, "-") ? fopen(fileName, "r") : stdin;
+    if (!file) return false;
+
+    char line [512];
+    while (fgets(line, sizeof(line), file)) {
+        unsigned long   address, size;
+        char            type, name [256];
+        if (sscanf(line, "%lx %lx %c %255s", &address, &size, &type, name) == 4) symbols[name] = size;
+    }
+    if (file != stdin) fclose(file);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    map<string, unsigned long>  symbols;
+    bool                        linked = argc > 1;
+
+    if (linked && !readSymbols(argv[1], symbols)) {
+        fprintf(stderr, "Can't read %s\n", argv[1]);
+        return 1;
+    }
+
+    printf("group            file                          sounds    bytes%s\n", linked ? "   linked    bytes" : "");
+
+    unsigned long totalSounds = 0, totalBytes = 0, totalLinked = 0, totalLinkedBytes = 0;
+    for (byte group = 0; group < SOUND_GROUPS; group++) {
+        unsigned long sounds = 0, bytes = 0, linkedSounds = 0, linkedBytes = 0;
+
+        for (uint16_t id = soundGroupBegin(group); id < soundGroupEnd(group); id++) {
+            unsigned long length = catalogSound(id).length;
+            sounds++;
+            bytes += length;
+            if (symbols.count(soundNames[id])) {
+                linkedSounds++;
+                linkedBytes += symbols[soundNames[id]];
+            }
+        }
+        printf("%-16s %-28s %7lu %8lu", groups[group].name, groups[group].file, sounds, bytes);
+        if (linked) printf(" %8lu %8lu", linkedSounds, linkedBytes);
+        printf("\n");
+
+        totalSounds      += sounds;
+        totalBytes       += bytes;
+        totalLinked      += linkedSounds;
+        totalLinkedBytes += linkedBytes;
+    }
+    printf("%-45s %7lu %8lu", "all", totalSounds, totalBytes);
+    if (linked) printf(" %8lu %8lu", totalLinked, totalLinkedBytes);
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+
+    MEA8000_TextBench.cpp
+
+    Host tool that measures how fast French text turns into frames: frenchSentence (the
+    words of the catalogs, the rules for the others) and FrenchStream (the rules only):
+
+        g++ -std=c++11 -O2 -I. -o textbench tools/MEA8000_TextBench.cpp MEA8000_Words.cpp \
+            MEA8000_WordTrie.cpp MEA8000_French.cpp MEA8000_Join.cpp MEA8000_Stream.cpp \
+            MEA8000_Catalog.cpp MEA8000_Sounds*.cpp
+        ./textbench [-n rounds] [file ...]
+
+    The corpus is the UTF-8 text of the files, or a few paragraphs built in, read 'rounds'
+    times (default 2000). It is cut into sentences at . ! ? ; : and line ends, frenchSentence
+    gets one sentence at a time (at most 255 sounds), FrenchStream the whole text at once.
+
+    For each it shows the characters and the frames per second, and how many times faster
+    than the chip would say them (the frames with their FD). "lookup" is frenchSentence
+    alone, "sentence" also reads all frames of the sounds it gives.
+
+ */
+
+#include "MEA8000_Words.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+static const char *const builtinCorpus =
+    "Bonjour madame, bonjour monsieur. Le train de huit heures quinze partira de la voie trois.\n"
+    "Attention, la porte de l'ascenseur va se fermer. Veuillez patienter quelques minutes.\n"
+    "Il fait beau aujourd'hui, le soleil brille sur la ville et les enfants jouent dans le parc.\n"
+    "Ma sœur a acheté un bœuf et des œufs au marché ; c'est le meilleur prix de la semaine.\n"
+    "Le compteur indique quarante-deux kilomètres. Tournez à gauche après le pont, puis à droite.\n"
+    "Quelle heure est-il ? Il est midi moins le quart. Le déjeuner est servi dans la salle à manger.\n"
+    "La machine à laver le linge est en panne, appelez le réparateur avant vendredi soir.\n"
+    "Les élèves écoutent le professeur qui explique la leçon de géographie avec une grande carte.\n"
+    "Mesdames et messieurs, nous arrivons en gare de Lyon ; assurez-vous de n'oublier aucun bagage.\n"
+    "Un, deux, trois, quatre, cinq, six, sept, huit, neuf, dix. Au revoir et à bientôt !\n";
+
+
+static double since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char *name, size_t characters, uint64_t frames, uint64_t steps, double seconds) {
+    double speech = steps * 0.008;
+
+    printf("%-10s %9.2f s %12.0f chars/s %12.0f frames/s %10.0f x real time\n",
+           name, seconds, characters / seconds, frames / seconds, speech / seconds);
+}
+
+// The frames of a source, and their length in 8 ms steps
+static void readFrames(FrameSource &source, uint64_t *frames, uint64_t *steps) {
+    byte frame [MEA8000_FRAME_SIZE];
+
+    while (source.nextFrame(frame)) {
+        (*frames)++;
+        *steps += frameSteps(frame);
+    }
+}
+
+
+int main(int argc, char **argv) {
+    string  corpus;
+    int     rounds = 2000;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            rounds = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+            continue;
+        }
+        FILE *file = fopen(argv[i], "rb");
+        if (!file) {
+            fprintf(stderr, "Can't open %s\n", argv[i]);
+            return 1;
+        }
+        char    buffer [65536];
+        size_t  size;
+        while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) corpus.append(buffer, size);
+        fclose(file);
+        corpus += '\n';
+    }
+    if (corpus.empty()) corpus = builtinCorpus;
+
+    vector<string> sentences;
+    size_t         start = 0;
+    for (size_t i = 0; i <= corpus.size(); i++) {
+        if (i < corpus.size() && !strchr(".!?;:\n", corpus[i])) continue;
+        if (i > start) sentences.push_back(corpus.substr(start, i - start));
+        start = i + 1;
+    }
+
+    size_t characters = corpus.size() * rounds;
+    printf("%zu bytes of text, %zu sentences, %d rounds\n\n", corpus.size(), sentences.size(), rounds);
+
+    // frenchSentence alone
+    SoundSpan   spans [255];
+    uint64_t    sounds = 0;
+    auto        begin  = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const string &sentence : sentences) sounds += frenchSentence(sentence.c_str(), spans, 255);
+    }
+    double lookup = since(begin);
+
+    // frenchSentence and the frames of its sounds
+    uint64_t frames = 0, steps = 0;
+    begin = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const string &sentence : sentences) {
+            SoundStream stream(spans, frenchSentence(sentence.c_str(), spans, 255));
+            readFrames(stream, &frames, &steps);
+        }
+    }
+    double sentence = since(begin);
+
+    printf("%-10s %9.2f s %12.0f chars/s %12.0f sounds/s\n", "lookup", lookup, characters / lookup, sounds / lookup);
+    report("sentence", characters, frames, steps, sentence);
+
+    // FrenchStream, the rules only, joined
+    frames = steps = 0;
+    begin  = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        FrenchStream stream(corpus.c_str());
+        readFrames(stream, &frames, &steps);
+    }
+    report("rules", characters, frames, steps, since(begin));
+    return 0;
+}